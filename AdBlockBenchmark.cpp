@@ -0,0 +1,660 @@
+// AdBlockBenchmark.cpp
+//
+// Benchmark for the content filter, not linked into the browser. Build it
+// together with the engine sources (AdBlockEngine, AdBlockSnapshot,
+// AdBlockDecisionCache, BloomFilter, CosmeticFilterIndex, DomainTrie,
+// PatternAutomaton, PublicSuffixList, ScriptletLibrary, UrlScanner) against
+// QtCore.
+//
+//   AdBlockBenchmark [--rules easylist.txt]... [--corpus requests.tsv]
+//                    [--requests 1000000] [--threads 4] [--cache] [--hot-tier]
+//   AdBlockBenchmark --regex-scaling
+//   AdBlockBenchmark --url-scanner [--corpus requests.tsv]
+//
+// A corpus file holds one request per line: URL, first-party host and
+// resource type as an ABP option name ("script", "image", ...), separated
+// by tabs. Without one a synthetic corpus is replayed; --write-corpus saves
+// it so later runs, and other engines, see the same requests.
+
+#include "AdBlockDecisionCache.h"
+#include "AdBlockEngine.h"
+#include "PublicSuffixList.h"
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QHash>
+#include <QPair>
+#include <QRandomGenerator>
+#include <QTextStream>
+#include <QThread>
+#include <QUrl>
+#include <QVarLengthArray>
+#include <algorithm>
+
+namespace {
+
+const int RegexUrlCount = 20000;
+const int RegexRounds = 5;
+const int UrlCount = 100000;
+const int UrlRounds = 5;
+
+const char *const Words[] = {
+    "ad", "ads", "banner", "track", "pixel", "promo", "sponsor", "click", "beacon", "metrics",
+    "img", "static", "media", "video", "user", "api", "cdn", "assets", "page", "content"
+};
+const int WordCount = int(sizeof(Words) / sizeof(Words[0]));
+
+const char *const TopLevelDomains[] = { "com", "net", "org", "io", "co.uk", "de" };
+const int TopLevelDomainCount = int(sizeof(TopLevelDomains) / sizeof(TopLevelDomains[0]));
+
+struct TypeName {
+    const char *name;
+    AdBlockEngine::ResourceType type;
+};
+
+const TypeName TypeNames[] = {
+    { "document", AdBlockEngine::Document }, { "subdocument", AdBlockEngine::Subdocument },
+    { "stylesheet", AdBlockEngine::Stylesheet }, { "script", AdBlockEngine::Script },
+    { "image", AdBlockEngine::Image }, { "font", AdBlockEngine::Font },
+    { "object", AdBlockEngine::Object }, { "media", AdBlockEngine::Media },
+    { "xmlhttprequest", AdBlockEngine::XmlHttpRequest }, { "ping", AdBlockEngine::Ping },
+    { "websocket", AdBlockEngine::WebSocket }, { "other", AdBlockEngine::Other }
+};
+
+struct CorpusEntry {
+    QByteArray url;
+    QByteArray lowered;
+    QByteArray firstPartyHost;
+    AdBlockEngine::ResourceType type;
+    int hostBegin;
+    int hostEnd;
+    bool thirdParty;
+};
+
+struct RunResult {
+    QVector<qint64> latencies;
+    qint64 elapsedNs = 0;
+    qint64 blocked = 0;
+};
+
+QString word(QRandomGenerator &random)
+{
+    return QString::fromLatin1(Words[random.bounded(WordCount)]) + QString::number(random.bounded(1000));
+}
+
+// Skewed pick in [0, count): low indexes are far more popular, roughly
+// like real site and resource popularity
+int popular(QRandomGenerator &random, int count)
+{
+    const double r = random.generateDouble();
+    return qMin(count - 1, int(count * r * r * r));
+}
+
+QString trackerHost(int index)
+{
+    return QString::fromLatin1(Words[index % WordCount]) + QString::number(index) + "."
+        + TopLevelDomains[index % TopLevelDomainCount];
+}
+
+QString siteHost(int index)
+{
+    return "www.site" + QString::number(index) + "." + TopLevelDomains[index % TopLevelDomainCount];
+}
+
+// Roughly the mix and size of EasyList plus EasyPrivacy
+QStringList syntheticRules(QRandomGenerator &random)
+{
+    QStringList rules;
+    rules.append("[Adblock Plus 2.0]");
+    for (int i = 0; i < 30000; ++i) {
+        const QString host = trackerHost(i);
+        switch (random.bounded(4)) {
+            case 0: rules.append("||" + host + "^$third-party"); break;
+            case 1: rules.append("||" + host + "^$script,image,third-party"); break;
+            default: rules.append("||" + host + "^"); break;
+        }
+    }
+    for (int i = 0; i < 12000; ++i) {
+        switch (random.bounded(5)) {
+            case 0: rules.append("/" + word(random) + "/" + word(random) + "_"); break;
+            case 1: rules.append("-" + word(random) + "-ad-"); break;
+            case 2: rules.append("&" + word(random) + "="); break;
+            case 3: rules.append("/" + word(random) + "*" + word(random) + ".js"); break;
+            default: rules.append("." + word(random) + "/ads/*"); break;
+        }
+    }
+    for (int i = 0; i < 4000; ++i) {
+        rules.append("||" + trackerHost(random.bounded(30000)) + "/" + word(random) + "^$domain="
+                     + siteHost(random.bounded(5000)).mid(4) + "|~" + siteHost(random.bounded(5000)).mid(4));
+    }
+    for (int i = 0; i < 3000; ++i) {
+        rules.append("@@||" + trackerHost(random.bounded(30000)) + "/" + word(random) + "^$script");
+    }
+    for (int i = 0; i < 300; ++i) {
+        rules.append("/\\/" + word(random) + "[0-9]+\\/" + word(random) + "/");
+    }
+    for (int i = 0; i < 25000; ++i) {
+        switch (random.bounded(3)) {
+            case 0: rules.append("##.ad-" + word(random)); break;
+            case 1: rules.append(siteHost(random.bounded(5000)).mid(4) + "##." + word(random)); break;
+            default: rules.append(siteHost(random.bounded(5000)).mid(4) + "##div[id^=\"" + word(random) + "\"]"); break;
+        }
+    }
+    return rules;
+}
+
+// Regular expression rules shaped like the ones in EasyList and friends
+QStringList regexRules(int count, QRandomGenerator &random)
+{
+    QStringList rules;
+    for (int i = 0; i < count; ++i) {
+        switch (random.bounded(5)) {
+            case 0: rules.append("/\\/" + word(random) + "[0-9]+\\/" + word(random) + "/"); break;
+            case 1: rules.append("/[?&]" + word(random) + "=[a-z0-9]{8,}/"); break;
+            case 2: rules.append("/^https?:\\/\\/[a-z0-9.]+\\." + word(random) + "\\.(com|net)\\//"); break;
+            case 3: rules.append("/" + word(random) + "(s|er)?\\.js$/$script"); break;
+            default: rules.append("/\\.(com|net)\\/[a-z]{4,8}\\/" + word(random) + "_/"); break;
+        }
+    }
+    return rules;
+}
+
+// Same split as AdBlockInterceptor: the host sits between "//" and the
+// first '/', '?' or '#', without user info and port
+void findHost(const QByteArray &url, int &begin, int &end)
+{
+    begin = url.indexOf("://");
+    begin = begin < 0 ? 0 : begin + 3;
+    end = begin;
+    while (end < url.size() && url[end] != '/' && url[end] != '?' && url[end] != '#') {
+        if (url[end] == '@') {
+            begin = end + 1;
+        }
+        ++end;
+    }
+    const int port = url.indexOf(':', begin);
+    if (port >= 0 && port < end) {
+        end = port;
+    }
+}
+
+bool addEntry(QVector<CorpusEntry> &corpus, const QByteArray &url, const QByteArray &firstPartyHost,
+              AdBlockEngine::ResourceType type)
+{
+    CorpusEntry entry;
+    entry.url = url;
+    entry.lowered = url.toLower();
+    entry.firstPartyHost = firstPartyHost.toLower();
+    entry.type = type;
+    findHost(entry.lowered, entry.hostBegin, entry.hostEnd);
+    if (entry.hostEnd <= entry.hostBegin) {
+        return false;
+    }
+    const QByteArray host = entry.lowered.mid(entry.hostBegin, entry.hostEnd - entry.hostBegin);
+    entry.thirdParty = PublicSuffixList::site(host) != PublicSuffixList::site(entry.firstPartyHost);
+    corpus.append(entry);
+    return true;
+}
+
+QVector<CorpusEntry> syntheticCorpus(int count, QRandomGenerator &random)
+{
+    const AdBlockEngine::ResourceType types[] = {
+        AdBlockEngine::Script, AdBlockEngine::Script, AdBlockEngine::Script, AdBlockEngine::Image,
+        AdBlockEngine::Image, AdBlockEngine::Image, AdBlockEngine::Image, AdBlockEngine::Stylesheet,
+        AdBlockEngine::XmlHttpRequest, AdBlockEngine::XmlHttpRequest, AdBlockEngine::Subdocument,
+        AdBlockEngine::Font, AdBlockEngine::Ping, AdBlockEngine::Other
+    };
+    const int typeCount = int(sizeof(types) / sizeof(types[0]));
+
+    QVector<CorpusEntry> corpus;
+    corpus.reserve(count);
+    while (corpus.size() < count) {
+        // A page load fetches the same subresources every time the site is
+        // visited, so each site seeds its own generator; one request in
+        // five carries a fresh query string and is never seen again
+        const int siteIndex = popular(random, 5000);
+        const QString site = siteHost(siteIndex);
+        const quint32 seed = quint32(siteIndex);
+        QRandomGenerator page(seed);
+        const int resources = page.bounded(20, 80);
+        for (int r = 0; r < resources && corpus.size() < count; ++r) {
+            // Most requests go back to the site or to CDNs, the rest to
+            // trackers, some of which no rule lists
+            QString host;
+            const int kind = page.bounded(10);
+            if (kind < 4) {
+                host = site;
+            } else if (kind < 7) {
+                host = "cdn" + QString::number(popular(page, 200)) + ".static.net";
+            } else {
+                host = trackerHost(popular(page, 40000));
+            }
+
+            QString url = (page.bounded(20) ? "https://" : "http://") + host + "/";
+            const int segments = page.bounded(1, 5);
+            for (int s = 0; s < segments; ++s) {
+                url += QString::fromLatin1(Words[popular(page, WordCount)]) + QString::number(popular(page, 1000))
+                    + (page.bounded(5) ? "/" : "_");
+            }
+            url += QString::number(page.bounded(100000)) + (page.bounded(3) ? ".js" : ".png");
+            if (!random.bounded(5)) {
+                url += "?v=" + word(random);
+            }
+            addEntry(corpus, url.toLatin1(), site.toLatin1(), types[page.bounded(typeCount)]);
+        }
+    }
+    return corpus;
+}
+
+bool readCorpus(const QString &path, int limit, QVector<CorpusEntry> &corpus)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QHash<QByteArray, AdBlockEngine::ResourceType> types;
+    for (const TypeName &name : TypeNames) {
+        types.insert(name.name, name.type);
+    }
+    while (!file.atEnd() && corpus.size() < limit) {
+        const QList<QByteArray> fields = file.readLine().trimmed().split('\t');
+        if (fields.size() >= 3) {
+            addEntry(corpus, fields[0], fields[1], types.value(fields[2], AdBlockEngine::Other));
+        }
+    }
+    return true;
+}
+
+bool writeCorpus(const QString &path, const QVector<CorpusEntry> &corpus)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    for (const CorpusEntry &entry : corpus) {
+        const char *type = "other";
+        for (const TypeName &name : TypeNames) {
+            if (name.type == entry.type) {
+                type = name.name;
+            }
+        }
+        file.write(entry.url + '\t' + entry.firstPartyHost + '\t' + type + '\n');
+    }
+    return true;
+}
+
+AdBlockEngine::Request engineRequest(const CorpusEntry &entry)
+{
+    AdBlockEngine::Request request;
+    request.url = entry.lowered.constData();
+    request.originalUrl = entry.url.constData();
+    request.urlLength = entry.url.size();
+    request.hostBegin = entry.hostBegin;
+    request.hostEnd = entry.hostEnd;
+    request.firstPartyHost = entry.firstPartyHost.constData();
+    request.firstPartyHostLength = entry.firstPartyHost.size();
+    request.type = entry.type;
+    request.thirdParty = entry.thirdParty;
+    return request;
+}
+
+// Ranks the filters by their blocks over the first tenth of the corpus,
+// as the browser ranks them by the blocks it recorded
+QSharedPointer<const AdBlockEngine::HotTier> trainHotTier(const AdBlockEngine &engine,
+                                                          const QVector<CorpusEntry> &corpus)
+{
+    QHash<int, int> hits;
+    for (int i = 0; i < qMax(1, corpus.size() / 10); ++i) {
+        const AdBlockEngine::Decision decision = engine.match(engineRequest(corpus[i]));
+        if (decision.blocked) {
+            ++hits[decision.filter];
+        }
+    }
+
+    QVector<QPair<int, int>> ranked;
+    for (auto it = hits.constBegin(); it != hits.constEnd(); ++it) {
+        ranked.append(qMakePair(it.value(), it.key()));
+    }
+    std::sort(ranked.begin(), ranked.end(), [](const QPair<int, int> &a, const QPair<int, int> &b) {
+        return a.first > b.first;
+    });
+    QVector<int> filters;
+    for (int i = 0; i < ranked.size() && i < AdBlockEngine::MaxHotFilters; ++i) {
+        filters.append(ranked[i].second);
+    }
+    return engine.buildHotTier(filters);
+}
+
+// Replays |count| requests starting at |offset|, timing each one
+RunResult replay(const AdBlockEngine &engine, const AdBlockEngine::HotTier *hot, AdBlockDecisionCache *cache,
+                 const QVector<CorpusEntry> &corpus, int offset, int count)
+{
+    RunResult result;
+    result.latencies.reserve(count);
+    QElapsedTimer total;
+    QElapsedTimer timer;
+    total.start();
+    for (int i = 0; i < count; ++i) {
+        const CorpusEntry &entry = corpus[(offset + i) % corpus.size()];
+        timer.start();
+        const AdBlockEngine::Request request = engineRequest(entry);
+
+        bool blocked = false;
+        if (cache) {
+            const quint64 key = AdBlockDecisionCache::key(entry.url.constData(), entry.url.size(),
+                                                          entry.firstPartyHost.constData(),
+                                                          entry.firstPartyHost.size(), entry.type);
+            int filter = -1;
+            int redirect = -1;
+            if (!cache->lookup(key, 1, quint32(i), blocked, filter, redirect)) {
+                const AdBlockEngine::Decision decision = engine.match(request, hot);
+                blocked = decision.blocked;
+                cache->insert(key, 1, quint32(i), blocked, blocked ? decision.filter : -1,
+                              blocked ? decision.redirect : -1);
+            }
+        } else {
+            blocked = engine.match(request, hot).blocked;
+        }
+
+        result.latencies.append(timer.nsecsElapsed());
+        result.blocked += blocked;
+    }
+    result.elapsedNs = total.nsecsElapsed();
+    return result;
+}
+
+qint64 percentile(const QVector<qint64> &sorted, double fraction)
+{
+    return sorted.isEmpty() ? 0 : sorted[qMin(sorted.size() - 1, int(fraction * (sorted.size() - 1) + 0.5))];
+}
+
+void reportRun(QTextStream &out, int threads, const QVector<RunResult> &results, const AdBlockDecisionCache *cache)
+{
+    QVector<qint64> latencies;
+    qint64 elapsedNs = 0;
+    qint64 blocked = 0;
+    for (const RunResult &result : results) {
+        latencies += result.latencies;
+        elapsedNs = qMax(elapsedNs, result.elapsedNs);
+        blocked += result.blocked;
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    const double perSecond = elapsedNs ? latencies.size() * 1e9 / double(elapsedNs) : 0.0;
+    out << qSetFieldWidth(7) << threads << qSetFieldWidth(12) << qRound64(perSecond)
+        << qSetFieldWidth(8) << percentile(latencies, 0.5) << qSetFieldWidth(8) << percentile(latencies, 0.99)
+        << qSetFieldWidth(10) << percentile(latencies, 0.999) << qSetFieldWidth(10) << blocked;
+    if (cache) {
+        out << qSetFieldWidth(8) << qRound64(100.0 * cache->hitCount() / qMax<quint64>(1, cache->lookupCount()))
+            << qSetFieldWidth(0) << "%";
+    }
+    out << qSetFieldWidth(0) << "\n";
+    out.flush();
+}
+
+int runRegexScaling(QTextStream &out)
+{
+    QRandomGenerator random(42);
+    QVector<CorpusEntry> corpus;
+    for (int i = 0; i < RegexUrlCount; ++i) {
+        QString url = "https://" + word(random) + ".example" + QString::number(random.bounded(50)) + ".com/";
+        const int segments = random.bounded(1, 6);
+        for (int s = 0; s < segments; ++s) {
+            url += word(random) + (random.bounded(4) ? "/" : "?id=");
+        }
+        addEntry(corpus, (url + word(random) + ".js").toLatin1(), "news.example.org", AdBlockEngine::Script);
+    }
+
+    // Per-URL cost should grow with the matches, not with the rule count
+    out << "regex rules  compile ms  memory KB  ns/url  blocked\n";
+    for (int count : { 0, 100, 1000, 5000, 20000 }) {
+        QMap<QString, QStringList> lists;
+        lists["regex"] = regexRules(count, random);
+
+        QElapsedTimer timer;
+        timer.start();
+        const QSharedPointer<const AdBlockEngine> engine = AdBlockEngine::compile(lists);
+        const qint64 compileMs = timer.elapsed();
+        if (!engine) {
+            out << "compile failed for " << count << " rules\n";
+            return 1;
+        }
+
+        qint64 elapsedNs = 0;
+        qint64 blocked = 0;
+        for (int round = 0; round < RegexRounds; ++round) {
+            const RunResult result = replay(*engine, nullptr, nullptr, corpus, 0, corpus.size());
+            elapsedNs += result.elapsedNs;
+            blocked = result.blocked;
+        }
+        out << qSetFieldWidth(11) << count << qSetFieldWidth(12) << compileMs
+            << qSetFieldWidth(11) << engine->memoryUsage() / 1024
+            << qSetFieldWidth(8) << qRound64(double(elapsedNs) / (double(RegexRounds) * corpus.size()))
+            << qSetFieldWidth(9) << blocked << qSetFieldWidth(0) << "\n";
+        out.flush();
+    }
+    return 0;
+}
+
+// The request path before UrlScanner: QUrl components, then a per-byte
+// lowercase and token loop
+int byteLoopTokens(const QByteArray &encoded, quint32 *tokens)
+{
+    QVarLengthArray<char, 2048> lowered(encoded.size());
+    for (int i = 0; i < encoded.size(); ++i) {
+        const char c = encoded[i];
+        lowered[i] = (c >= 'A' && c <= 'Z') ? char(c + ('a' - 'A')) : c;
+    }
+    int count = 0;
+    int i = 0;
+    while (i < lowered.size() && count < AdBlockEngine::MaxUrlTokens) {
+        if (!UrlScanner::isTokenChar(lowered[i])) {
+            ++i;
+            continue;
+        }
+        const int begin = i;
+        while (i < lowered.size() && UrlScanner::isTokenChar(lowered[i])) {
+            ++i;
+        }
+        if (i - begin >= 2) {
+            tokens[count++] = UrlScanner::hashToken(lowered.constData() + begin, i - begin);
+        }
+    }
+    return count;
+}
+
+int scannerTokens(const QByteArray &encoded, quint32 *tokens)
+{
+    QVarLengthArray<char, 2048> lowered(encoded.size());
+    return UrlScanner::lowerAndTokenize(encoded.constData(), encoded.size(), lowered.data(), tokens,
+                                        AdBlockEngine::MaxUrlTokens);
+}
+
+template <typename Function>
+void reportUrlPath(QTextStream &out, const char *name, int urlCount, Function function)
+{
+    quint64 checksum = 0;
+    QElapsedTimer timer;
+    timer.start();
+    for (int round = 0; round < UrlRounds; ++round) {
+        checksum += function();
+    }
+    out << QString::fromLatin1(name).leftJustified(28) << qSetFieldWidth(8)
+        << qRound64(double(timer.nsecsElapsed()) / (double(UrlRounds) * urlCount))
+        << qSetFieldWidth(12) << checksum / UrlRounds << qSetFieldWidth(0) << "\n";
+    out.flush();
+}
+
+int runUrlScanner(QTextStream &out, const QVector<CorpusEntry> &corpus)
+{
+    QVector<QUrl> urls;
+    QVector<QByteArray> encoded;
+    for (int i = 0; i < corpus.size() && i < UrlCount; ++i) {
+        urls.append(QUrl::fromEncoded(corpus[i].url));
+        encoded.append(urls.last().toEncoded());
+    }
+
+    // Both QUrl rows start from the QUrl the interceptor is handed; the
+    // byte rows isolate the kernels. Equal token counts show both paths
+    // agree.
+    quint32 tokens[AdBlockEngine::MaxUrlTokens];
+    out << "path                          ns/url      tokens\n";
+    reportUrlPath(out, "QUrl components, byte loop", urls.size(), [&]() {
+        quint64 total = 0;
+        for (const QUrl &url : urls) {
+            const QString scheme = url.scheme();
+            const QString host = url.host();
+            if (!scheme.isEmpty() && !host.isEmpty()) {
+                total += byteLoopTokens(url.toEncoded(), tokens);
+            }
+        }
+        return total;
+    });
+    reportUrlPath(out, "QUrl encoded, UrlScanner", urls.size(), [&]() {
+        quint64 total = 0;
+        for (const QUrl &url : urls) {
+            const QByteArray bytes = url.toEncoded();
+            const UrlScanner::Parts parts = UrlScanner::parse(bytes.constData(), bytes.size());
+            if (parts.schemeEnd > 0 && parts.hostEnd > parts.hostBegin) {
+                total += scannerTokens(bytes, tokens);
+            }
+        }
+        return total;
+    });
+    reportUrlPath(out, "bytes, byte loop", urls.size(), [&]() {
+        quint64 total = 0;
+        for (const QByteArray &bytes : encoded) {
+            total += byteLoopTokens(bytes, tokens);
+        }
+        return total;
+    });
+    reportUrlPath(out, "bytes, UrlScanner", urls.size(), [&]() {
+        quint64 total = 0;
+        for (const QByteArray &bytes : encoded) {
+            total += scannerTokens(bytes, tokens);
+        }
+        return total;
+    });
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QTextStream out(stdout);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Content filter benchmark");
+    parser.addHelpOption();
+    QCommandLineOption rulesOption("rules", "Filter list to load instead of synthetic rules; repeatable", "file");
+    QCommandLineOption corpusOption("corpus", "Tab-separated request log to replay", "file");
+    QCommandLineOption writeCorpusOption("write-corpus", "Save the replayed corpus", "file");
+    QCommandLineOption requestsOption("requests", "Requests per run", "count", "1000000");
+    QCommandLineOption threadsOption("threads", "Concurrent threads for the second run", "count",
+                                     QString::number(qMax(2, QThread::idealThreadCount())));
+    QCommandLineOption cacheOption("cache", "Put the interceptor's decision cache in front of the engine");
+    QCommandLineOption hotOption("hot-tier", "Search a hot tier of the filters that block most first");
+    QCommandLineOption regexOption("regex-scaling", "Measure per-URL cost as the regex rule count grows");
+    QCommandLineOption urlOption("url-scanner", "Compare URL lowercasing and tokenizing with the QUrl path");
+    parser.addOptions({ rulesOption, corpusOption, writeCorpusOption, requestsOption, threadsOption, cacheOption,
+                        hotOption, regexOption, urlOption });
+    parser.process(app);
+
+    if (parser.isSet(regexOption)) {
+        return runRegexScaling(out);
+    }
+
+    QRandomGenerator corpusRandom(7);
+    const int requests = qMax(1, parser.value(requestsOption).toInt());
+    QVector<CorpusEntry> corpus;
+    if (parser.isSet(corpusOption)) {
+        if (!readCorpus(parser.value(corpusOption), requests, corpus) || corpus.isEmpty()) {
+            out << "cannot read corpus " << parser.value(corpusOption) << "\n";
+            return 1;
+        }
+    } else {
+        corpus = syntheticCorpus(requests, corpusRandom);
+    }
+    if (parser.isSet(writeCorpusOption) && !writeCorpus(parser.value(writeCorpusOption), corpus)) {
+        out << "cannot write " << parser.value(writeCorpusOption) << "\n";
+        return 1;
+    }
+    if (parser.isSet(urlOption)) {
+        return runUrlScanner(out, corpus);
+    }
+
+    QRandomGenerator random(42);
+    QMap<QString, QStringList> lists;
+    for (const QString &path : parser.values(rulesOption)) {
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            out << "cannot read " << path << "\n";
+            return 1;
+        }
+        lists[path] = QString::fromUtf8(file.readAll()).split('\n');
+    }
+    if (lists.isEmpty()) {
+        lists["synthetic"] = syntheticRules(random);
+    }
+    int lineCount = 0;
+    for (const QStringList &lines : lists) {
+        lineCount += lines.size();
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    const QSharedPointer<const AdBlockEngine> engine = AdBlockEngine::compile(lists);
+    const qint64 compileMs = timer.elapsed();
+    if (!engine) {
+        out << "compile failed\n";
+        return 1;
+    }
+    out << "rules        " << lineCount << " lines, " << engine->filterCount() << " network filters, "
+        << engine->cosmeticFilters().selectorCount() << " selectors\n"
+        << "compile      " << compileMs << " ms\n"
+        << "memory       " << engine->memoryUsage() / 1024 << " KB\n";
+
+    QSharedPointer<const AdBlockEngine::HotTier> hotTier;
+    if (parser.isSet(hotOption)) {
+        hotTier = trainHotTier(*engine, corpus);
+        out << "hot tier     " << hotTier->filterCount() << " filters, " << hotTier->memoryUsage() / 1024 << " KB\n";
+    }
+
+    out << "corpus       " << corpus.size() << " requests"
+        << (parser.isSet(corpusOption) ? "" : " (synthetic)") << "\n\n";
+
+    // Latencies include one clock read, a few tens of nanoseconds
+    const bool useCache = parser.isSet(cacheOption);
+    out << "threads  requests/s  p50 ns  p99 ns  p99.9 ns   blocked" << (useCache ? "  cache hits" : "") << "\n";
+    {
+        AdBlockDecisionCache cache;
+        reportRun(out, 1, { replay(*engine, hotTier.data(), useCache ? &cache : nullptr, corpus, 0, requests) },
+                  useCache ? &cache : nullptr);
+    }
+
+    const int threadCount = qMax(1, parser.value(threadsOption).toInt());
+    AdBlockDecisionCache sharedCache;
+    QVector<RunResult> results(threadCount);
+    QVector<QThread *> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        // Each thread starts elsewhere in the corpus so they do not run in
+        // lockstep through the same requests
+        const int offset = int(qint64(corpus.size()) * i / threadCount);
+        threads.append(QThread::create([&, i, offset]() {
+            results[i] = replay(*engine, hotTier.data(), useCache ? &sharedCache : nullptr, corpus, offset,
+                                requests / threadCount);
+        }));
+    }
+    for (QThread *thread : threads) {
+        thread->start();
+    }
+    for (QThread *thread : threads) {
+        thread->wait();
+        delete thread;
+    }
+    reportRun(out, threadCount, results, useCache ? &sharedCache : nullptr);
+    return 0;
+}
@@ -0,0 +1,137 @@
+// AdBlockDecisionCache.cpp
+
+#include "AdBlockDecisionCache.h"
+
+namespace {
+
+const quint64 ValidBit = Q_UINT64_C(1) << 63;
+const quint64 BlockedBit = Q_UINT64_C(1) << 62;
+// Generation, filter and redirect take bits 0-21, 22-41 and 42-61
+const int FilterShift = 22;
+const int RedirectShift = 42;
+const quint32 FilterMask = (1u << 20) - 1;
+const quint64 GenerationMask = (Q_UINT64_C(1) << FilterShift) - 1;
+
+quint64 fnv1a(quint64 hash, const char *data, int length)
+{
+    for (int i = 0; i < length; ++i) {
+        hash ^= quint8(data[i]);
+        hash *= Q_UINT64_C(0x100000001b3);
+    }
+    return hash;
+}
+
+// Ids too large to store come back as -1, like a decision without rule
+quint64 storedFilter(int filter)
+{
+    return filter >= 0 && quint32(filter) < FilterMask ? quint64(filter) + 1 : 0;
+}
+
+int loadedFilter(quint64 payload, int shift)
+{
+    return int((payload >> shift) & FilterMask) - 1;
+}
+
+} // namespace
+
+AdBlockDecisionCache::AdBlockDecisionCache(int capacity)
+    : m_shardMask(0)
+    , m_lookupCount(0)
+    , m_hitCount(0)
+{
+    // Round down to a power of two so the shard is a mask of the key
+    quint32 shards = 1;
+    while (shards * 2 * Ways <= quint32(qMax(capacity, int(Ways)))) {
+        shards *= 2;
+    }
+    m_shards.reset(new Shard[shards]);
+    m_shardMask = shards - 1;
+}
+
+quint64 AdBlockDecisionCache::key(const char *url, int urlLength, const char *firstPartyHost, int firstPartyHostLength,
+                                  quint32 type)
+{
+    quint64 hash = fnv1a(Q_UINT64_C(0xcbf29ce484222325), url, urlLength);
+    hash = fnv1a(hash ^ quint64(urlLength), firstPartyHost, firstPartyHostLength);
+    hash ^= quint64(type) << 32 | quint32(firstPartyHostLength);
+
+    // Finalise so the low bits that pick the shard depend on every byte
+    hash = (hash ^ (hash >> 30)) * Q_UINT64_C(0xbf58476d1ce4e5b9);
+    hash = (hash ^ (hash >> 27)) * Q_UINT64_C(0x94d049bb133111eb);
+    return hash ^ (hash >> 31);
+}
+
+bool AdBlockDecisionCache::lookup(quint64 key, quint64 generation, quint32 tick, bool &blocked, int &filter,
+                                  int &redirect)
+{
+    m_lookupCount.fetchAndAddRelaxed(1);
+    Shard &shard = m_shards[int(key & m_shardMask)];
+    for (Entry &entry : shard.entries) {
+        const quint64 value = entry.payload.loadRelaxed();
+        if (!isCurrent(value, generation) || (entry.check.loadRelaxed() ^ value) != key) {
+            continue;
+        }
+        entry.lastUsed.storeRelaxed(tick);
+        m_hitCount.fetchAndAddRelaxed(1);
+        blocked = value & BlockedBit;
+        filter = loadedFilter(value, FilterShift);
+        redirect = loadedFilter(value, RedirectShift);
+        return true;
+    }
+    return false;
+}
+
+void AdBlockDecisionCache::insert(quint64 key, quint64 generation, quint32 tick, bool blocked, int filter,
+                                  int redirect)
+{
+    Shard &shard = m_shards[int(key & m_shardMask)];
+
+    // Stale and empty entries go first, then the least recently used one
+    Entry *victim = nullptr;
+    quint32 victimAge = 0;
+    for (Entry &entry : shard.entries) {
+        const quint32 age = !isCurrent(entry.payload.loadRelaxed(), generation)
+            ? quint32(-1)
+            : tick - entry.lastUsed.loadRelaxed();
+        if (!victim || age > victimAge) {
+            victim = &entry;
+            victimAge = age;
+        }
+    }
+
+    const quint64 value = ValidBit | (blocked ? BlockedBit : 0) | storedFilter(filter) << FilterShift
+        | storedFilter(redirect) << RedirectShift | (generation & GenerationMask);
+    victim->payload.storeRelaxed(value);
+    victim->check.storeRelaxed(key ^ value);
+    victim->lastUsed.storeRelaxed(tick);
+}
+
+void AdBlockDecisionCache::clear()
+{
+    for (quint32 i = 0; i <= m_shardMask; ++i) {
+        for (Entry &entry : m_shards[int(i)].entries) {
+            entry.payload.storeRelaxed(0);
+            entry.check.storeRelaxed(0);
+        }
+    }
+}
+
+int AdBlockDecisionCache::capacity() const
+{
+    return int(m_shardMask + 1) * Ways;
+}
+
+quint64 AdBlockDecisionCache::lookupCount() const
+{
+    return m_lookupCount.loadRelaxed();
+}
+
+quint64 AdBlockDecisionCache::hitCount() const
+{
+    return m_hitCount.loadRelaxed();
+}
+
+bool AdBlockDecisionCache::isCurrent(quint64 payload, quint64 generation)
+{
+    return (payload & ValidBit) && (payload & GenerationMask) == (generation & GenerationMask);
+}
@@ -0,0 +1,64 @@
+// AdBlockDecisionCache.h
+
+#ifndef ADBLOCKDECISIONCACHE_H
+#define ADBLOCKDECISIONCACHE_H
+
+#include <QAtomicInteger>
+#include <QScopedArrayPointer>
+
+// Fixed-size cache of recent block decisions, keyed by a 64-bit hash of
+// URL, first-party host and resource type. The cache is split into
+// shards of four entries, two cache lines each, every shard evicting its
+// least recently used entry. Neither lookups nor inserts take a lock: an entry
+// stores its key xor'ed with its payload, so a read racing a write sees a
+// mismatch and counts as a miss. Entries from another rule set generation
+// never match, so publishing new rules needs no flush, except that only
+// the low 22 bits of the generation are kept: call clear() whenever a
+// generation is a multiple of GenerationCount. A request still on an old
+// rule set may insert after that clear; its entry could only match again
+// GenerationCount publishes later.
+class AdBlockDecisionCache
+{
+public:
+    static const quint64 GenerationCount = Q_UINT64_C(1) << 22;
+
+    explicit AdBlockDecisionCache(int capacity = 16384);
+
+    static quint64 key(const char *url, int urlLength, const char *firstPartyHost, int firstPartyHostLength,
+                       quint32 type);
+
+    // |tick| is any counter that grows with every request; it orders
+    // entries for eviction. |filter| is the deciding rule and |redirect|
+    // the filter naming a surrogate, each -1 when there is none.
+    bool lookup(quint64 key, quint64 generation, quint32 tick, bool &blocked, int &filter, int &redirect);
+    void insert(quint64 key, quint64 generation, quint32 tick, bool blocked, int filter, int redirect);
+    void clear();
+
+    int capacity() const;
+    quint64 lookupCount() const;
+    quint64 hitCount() const;
+
+private:
+    static const int Ways = 4;
+
+    struct Entry {
+        QAtomicInteger<quint64> check;
+        QAtomicInteger<quint64> payload;
+        QAtomicInteger<quint32> lastUsed;
+    };
+
+    struct alignas(64) Shard {
+        Entry entries[Ways];
+    };
+
+    static bool isCurrent(quint64 payload, quint64 generation);
+
+    QScopedArrayPointer<Shard> m_shards;
+    quint32 m_shardMask;
+    QAtomicInteger<quint64> m_lookupCount;
+    QAtomicInteger<quint64> m_hitCount;
+
+    Q_DISABLE_COPY(AdBlockDecisionCache)
+};
+
+#endif // ADBLOCKDECISIONCACHE_H
@@ -0,0 +1,1697 @@
+// AdBlockEngine.cpp
+
+#include "AdBlockEngine.h"
+#include <QHash>
+#include <QPair>
+#include <QSet>
+#include <QVarLengthArray>
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstring>
+
+namespace {
+
+// Bumped whenever the meaning of a snapshot section changes
+const quint32 FormatRevision = 8;
+
+// Names hosts files use for the loopback interface rather than a tracker
+const char *const LocalHostNames[] = {
+    "localhost", "localhost.localdomain", "local", "broadcasthost", "ip6-localhost", "ip6-loopback"
+};
+
+// Tokens that appear in nearly every URL make poor index keys
+const char *const BadTokens[] = {
+    "http", "https", "www", "com", "net", "org", "js", "html", "php", "cdn", "static"
+};
+
+// splitmix64 finaliser; spreads keys over all 64 bits for the prefilter
+quint64 mixKey(quint64 key)
+{
+    key = (key ^ (key >> 30)) * Q_UINT64_C(0xbf58476d1ce4e5b9);
+    key = (key ^ (key >> 27)) * Q_UINT64_C(0x94d049bb133111eb);
+    return key ^ (key >> 31);
+}
+
+bool isSeparator(char c)
+{
+    return !UrlScanner::isTokenChar(c) && c != '_' && c != '-' && c != '.';
+}
+
+bool isBadToken(quint32 token)
+{
+    static const QVector<quint32> badTokens = [] {
+        QVector<quint32> hashes;
+        for (const char *token : BadTokens) {
+            hashes.append(UrlScanner::hashToken(token, int(strlen(token))));
+        }
+        return hashes;
+    }();
+    return badTokens.contains(token);
+}
+
+quint32 typeFromOption(const QString &name)
+{
+    static const QHash<QString, quint32> types = {
+        { "document", AdBlockEngine::Document },
+        { "subdocument", AdBlockEngine::Subdocument },
+        { "stylesheet", AdBlockEngine::Stylesheet },
+        { "css", AdBlockEngine::Stylesheet },
+        { "script", AdBlockEngine::Script },
+        { "image", AdBlockEngine::Image },
+        { "font", AdBlockEngine::Font },
+        { "object", AdBlockEngine::Object },
+        { "object-subrequest", AdBlockEngine::Object },
+        { "media", AdBlockEngine::Media },
+        { "xmlhttprequest", AdBlockEngine::XmlHttpRequest },
+        { "xhr", AdBlockEngine::XmlHttpRequest },
+        { "ping", AdBlockEngine::Ping },
+        { "beacon", AdBlockEngine::Ping },
+        { "websocket", AdBlockEngine::WebSocket },
+        { "other", AdBlockEngine::Other }
+    };
+    return types.value(name, 0);
+}
+
+// Collects the tokens of a lowercased pattern that are guaranteed to appear
+// as whole tokens in every URL the pattern matches.
+QVector<quint32> patternTokens(const QByteArray &pattern, bool anchoredStart, bool anchoredEnd)
+{
+    QVector<quint32> tokens;
+    const char *p = pattern.constData();
+    const int length = pattern.size();
+    int i = 0;
+    while (i < length) {
+        if (!UrlScanner::isTokenChar(p[i])) {
+            ++i;
+            continue;
+        }
+        const int begin = i;
+        while (i < length && UrlScanner::isTokenChar(p[i])) {
+            ++i;
+        }
+        const bool leftBounded = begin > 0 ? p[begin - 1] != '*' : anchoredStart;
+        const bool rightBounded = i < length ? p[i] != '*' : anchoredEnd;
+        if (leftBounded && rightBounded && i - begin >= 2) {
+            tokens.append(UrlScanner::hashToken(p + begin, i - begin));
+        }
+    }
+    return tokens;
+}
+
+// Longest stretch of a glob pattern without wildcards or separators
+QByteArray globLiteral(const QByteArray &pattern)
+{
+    QByteArray best;
+    int begin = 0;
+    for (int i = 0; i <= pattern.size(); ++i) {
+        if (i == pattern.size() || pattern[i] == '*' || pattern[i] == '^') {
+            if (i - begin > best.size()) {
+                best = pattern.mid(begin, i - begin);
+            }
+            begin = i + 1;
+        }
+    }
+    return best.toLower();
+}
+
+// Index just past the group or character class opening at |i|, or -1
+int skipGroup(const QByteArray &source, int i)
+{
+    const int length = source.size();
+    if (source[i] == '[') {
+        ++i;
+        if (i < length && source[i] == '^') {
+            ++i;
+        }
+        if (i < length && source[i] == ']') {
+            ++i;
+        }
+        while (i < length && source[i] != ']') {
+            if (source[i] == '\\') {
+                i += 2;
+            } else if (source.mid(i, 2) == "[:") {
+                const int close = source.indexOf(":]", i + 2);
+                if (close < 0) {
+                    return -1;
+                }
+                i = close + 2;
+            } else {
+                ++i;
+            }
+        }
+        return i < length ? i + 1 : -1;
+    }
+
+    int depth = 0;
+    while (i < length) {
+        const char c = source[i];
+        if (c == '\\') {
+            i += 2;
+            continue;
+        }
+        if (c == '[') {
+            i = skipGroup(source, i);
+            if (i < 0) {
+                return -1;
+            }
+            continue;
+        }
+        ++i;
+        if (c == '(') {
+            ++depth;
+        } else if (c == ')' && --depth == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Longest literal run that every match of the regular expression must
+// contain. Anything not understood ends the current run, so the result
+// may be shorter than possible but never wrong. Alternation at the top
+// level and extended mode give up entirely.
+QByteArray regexLiteral(const QByteArray &source)
+{
+    const int length = source.size();
+    for (int at = source.indexOf("(?"); at >= 0; at = source.indexOf("(?", at + 2)) {
+        for (int j = at + 2; j < length && (isalpha(quint8(source[j])) || source[j] == '-'); ++j) {
+            if (source[j] == 'x') {
+                return QByteArray();
+            }
+        }
+    }
+
+    QByteArray best;
+    QByteArray run;
+    auto endRun = [&]() {
+        if (run.size() > best.size()) {
+            best = run;
+        }
+        run.clear();
+    };
+    auto skipLazy = [&](int i) {
+        return i < length && (source[i] == '?' || source[i] == '+') ? i + 1 : i;
+    };
+
+    int i = 0;
+    while (i < length) {
+        const char c = source[i];
+        if (c == '|' || c == ')') {
+            return QByteArray();
+        }
+        if (c == '(' || c == '[') {
+            endRun();
+            i = skipGroup(source, i);
+            if (i < 0) {
+                return QByteArray();
+            }
+        } else if (c == '*' || c == '?' || c == '{') {
+            // The preceding character may be missing altogether
+            run.chop(1);
+            endRun();
+            if (c == '{') {
+                const int close = source.indexOf('}', i);
+                i = close < 0 ? i : close;
+            }
+            i = skipLazy(i + 1);
+        } else if (c == '+') {
+            endRun();
+            i = skipLazy(i + 1);
+        } else if (c == '\\') {
+            if (i + 1 >= length || source[i + 1] == 'Q') {
+                return QByteArray();
+            }
+            const char escaped = source[i + 1];
+            i += 2;
+            if (!isalnum(quint8(escaped))) {
+                run.append(escaped);
+                continue;
+            }
+            // Classes, anchors and escapes that take an argument
+            endRun();
+            if (strchr("xuopPkgcN0123456789", escaped)) {
+                while (i < length && (isalnum(quint8(source[i])) || (source[i] && strchr("{}<>'", source[i])))) {
+                    ++i;
+                }
+            }
+        } else if (c == '.' || c == '^' || c == '$' || quint8(c) <= ' ' || quint8(c) > '~') {
+            endRun();
+            ++i;
+        } else {
+            run.append(c);
+            ++i;
+        }
+    }
+    endRun();
+    return best.toLower();
+}
+
+} // namespace
+
+QSharedPointer<const AdBlockEngine> AdBlockEngine::compile(const QMap<QString, QStringList> &lists,
+                                                           const PrefilterOptions &prefilter)
+{
+    QVector<Source> sources;
+    for (auto it = lists.constBegin(); it != lists.constEnd(); ++it) {
+        sources.append(Source{ &it.value(), true, true, it.key() });
+    }
+    return build(sources, prefilter, QSharedPointer<const AdBlockEngine>(), QVector<quint64>());
+}
+
+QSharedPointer<const AdBlockEngine> AdBlockEngine::compileDelta(const QSharedPointer<const AdBlockEngine> &engine,
+                                                                const QMap<QString, QStringList> &lists,
+                                                                const QStringList &added, const QStringList &removed,
+                                                                const PrefilterOptions &prefilter)
+{
+    const QSharedPointer<const AdBlockEngine> base = engine->m_base ? engine->m_base : engine;
+
+    QHash<QString, QVector<quint32>> baseFilters;
+    baseFilters.reserve(int(base->m_filterCount));
+    for (quint32 i = 0; i < base->m_filterCount; ++i) {
+        baseFilters[base->filterText(int(i))].append(i);
+    }
+
+    QVector<quint64> mask(int((base->m_filterCount + 63) / 64), 0);
+    if (engine->m_base) {
+        std::copy(engine->m_removed, engine->m_removed + engine->m_removedWordCount, mask.begin());
+    }
+
+    // A line dropped from one list stays active while another still has it
+    QSet<QString> listed;
+    if (!removed.isEmpty()) {
+        for (auto it = lists.constBegin(); it != lists.constEnd(); ++it) {
+            for (const QString &line : it.value()) {
+                listed.insert(line.trimmed());
+            }
+        }
+    }
+
+    QSet<QString> removedLines;
+    for (const QString &line : removed) {
+        const QString text = line.trimmed();
+        if (listed.contains(text)) {
+            continue;
+        }
+        removedLines.insert(text);
+        for (quint32 id : baseFilters.value(text)) {
+            mask[int(id / 64)] |= Q_UINT64_C(1) << (id % 64);
+        }
+    }
+
+    // Keep what the previous layer added unless it is being removed now
+    QStringList layerLines;
+    QSet<QString> layerSet;
+    for (quint32 i = 0; engine->m_base && i < engine->m_filterCount; ++i) {
+        const QString text = engine->filterText(int(base->m_filterCount + i));
+        if (!removedLines.contains(text) && !layerSet.contains(text)) {
+            layerSet.insert(text);
+            layerLines.append(text);
+        }
+    }
+
+    // Lines already compiled into the base only need unmasking
+    for (const QString &line : added) {
+        const QString text = line.trimmed();
+        const auto it = baseFilters.constFind(text);
+        if (it == baseFilters.constEnd()) {
+            if (!layerSet.contains(text)) {
+                layerSet.insert(text);
+                layerLines.append(text);
+            }
+            continue;
+        }
+        for (quint32 id : it.value()) {
+            mask[int(id / 64)] &= ~(Q_UINT64_C(1) << (id % 64));
+        }
+    }
+
+    // Layer filters keep the name of the list that carries them
+    QHash<QString, QString> lineLists;
+    for (auto it = lists.constBegin(); it != lists.constEnd() && lineLists.size() < layerSet.size(); ++it) {
+        for (const QString &line : it.value()) {
+            const QString text = line.trimmed();
+            if (layerSet.contains(text) && !lineLists.contains(text)) {
+                lineLists.insert(text, it.key());
+            }
+        }
+    }
+    QMap<QString, QStringList> layerLists;
+    for (const QString &text : layerLines) {
+        layerLists[lineLists.value(text)].append(text);
+    }
+
+    QVector<Source> sources;
+    for (auto it = layerLists.constBegin(); it != layerLists.constEnd(); ++it) {
+        sources.append(Source{ &it.value(), true, false, it.key() });
+    }
+    for (auto it = lists.constBegin(); it != lists.constEnd(); ++it) {
+        sources.append(Source{ &it.value(), false, true, it.key() });
+    }
+    return build(sources, prefilter, base, mask);
+}
+
+QSharedPointer<const AdBlockEngine> AdBlockEngine::build(const QVector<Source> &sources, const PrefilterOptions &prefilter,
+                                                         const QSharedPointer<const AdBlockEngine> &base,
+                                                         const QVector<quint64> &removed)
+{
+    CompileState state;
+    QVector<quint64> prefilterKeys;
+    QVector<QVector<quint32>> candidates;
+    QHash<quint32, int> tokenFrequency;
+
+    for (const Source &source : sources) {
+        int list = state.listNames.indexOf(source.list.toUtf8());
+        if (list < 0) {
+            list = state.listNames.size();
+            state.listNames.append(source.list.toUtf8());
+        }
+        for (const QString &line : *source.lines) {
+            NetworkFilter filter;
+            QByteArray pattern;
+            QByteArray redirect;
+            if (source.cosmetic ? state.cosmetic.addRule(line) : CosmeticFilterIndex::isCosmeticRule(line)) {
+                continue;
+            }
+            if (!source.network) {
+                continue;
+            }
+            if (parseHostsLine(line, pattern)) {
+                if (pattern.isEmpty()) {
+                    continue;
+                }
+                filter = NetworkFilter();
+                filter.typeMask = AllTypes & ~Document;
+                filter.regex = -1;
+                filter.flags = HostOnly;
+            } else if (!parseFilter(line, filter, pattern, redirect, state)) {
+                continue;
+            }
+
+            if (!redirect.isEmpty()) {
+                int resource = state.redirectNames.indexOf(redirect);
+                if (resource < 0) {
+                    resource = state.redirectNames.size();
+                    state.redirectNames.append(redirect);
+                }
+                state.redirects.append(RedirectEntry{ quint32(state.filters.size()), quint32(resource) });
+            }
+
+            filter.patternOffset = quint32(state.patterns.size());
+            filter.patternLength = quint16(pattern.size());
+            state.patterns.append(pattern);
+            state.sources.append(line.trimmed().toUtf8());
+            state.filterLists.append(quint16(list));
+
+            // Plain hostname rules are answered by the suffix tries alone
+            if ((filter.flags & HostOnly) || isHostPattern(filter, pattern)) {
+                QByteArray host = pattern;
+                if (host.endsWith('^')) {
+                    host.chop(1);
+                }
+                DomainTrie::Builder &trie = (filter.flags & Exception) ? state.hostAllows : state.hostBlocks;
+                if (trie.insert(host, state.filters.size())) {
+                    if (!(filter.flags & Exception)) {
+                        prefilterKeys.append(hostKey(host.constData(), host.size()));
+                    }
+                    filter.flags |= HostOnly;
+                    state.filters.append(filter);
+                    candidates.append(QVector<quint32>());
+                    continue;
+                }
+            }
+
+            QVector<quint32> tokens;
+            if (!(filter.flags & Regex)) {
+                tokens = patternTokens(pattern.toLower(),
+                                       filter.flags & (AnchorStart | AnchorHost),
+                                       filter.flags & AnchorEnd);
+            }
+            for (quint32 token : tokens) {
+                ++tokenFrequency[token];
+            }
+
+            state.filters.append(filter);
+            candidates.append(tokens);
+        }
+    }
+
+    // Key every filter on its rarest token so buckets stay short
+    QVector<QPair<quint32, quint32>> blockEntries;
+    QVector<QPair<quint32, quint32>> exceptionEntries;
+    QVector<QPair<quint32, quint32>> redirectEntries;
+    QVector<quint32> blockFallback;
+    QVector<quint32> exceptionFallback;
+    QVector<quint32> redirectFallback;
+    PatternAutomaton::Builder blockAutomaton;
+    PatternAutomaton::Builder exceptionAutomaton;
+    PatternAutomaton::Builder redirectAutomaton;
+    for (int i = 0; i < state.filters.size(); ++i) {
+        const quint16 flags = state.filters[i].flags;
+        if (flags & HostOnly) {
+            continue;
+        }
+        const bool exception = flags & Exception;
+        quint32 best = 0;
+        int bestScore = INT_MAX;
+        for (quint32 token : candidates[i]) {
+            int score = tokenFrequency.value(token);
+            if (isBadToken(token)) {
+                score += 1 << 20;
+            }
+            if (score < bestScore) {
+                bestScore = score;
+                best = token;
+            }
+        }
+
+        // A $redirect-rule filter decides nothing by itself
+        if (flags & (Redirect | RedirectRule)) {
+            if (best) {
+                redirectEntries.append(qMakePair(best, quint32(i)));
+            } else {
+                redirectFallback.append(quint32(i));
+                redirectAutomaton.addPattern(requiredLiteral(state.filters[i], state));
+            }
+            if (flags & RedirectRule) {
+                continue;
+            }
+        }
+
+        if (best) {
+            (exception ? exceptionEntries : blockEntries).append(qMakePair(best, quint32(i)));
+            if (!exception) {
+                prefilterKeys.append(tokenKey(best));
+            }
+        } else {
+            (exception ? exceptionFallback : blockFallback).append(quint32(i));
+            (exception ? exceptionAutomaton : blockAutomaton).addPattern(requiredLiteral(state.filters[i], state));
+        }
+    }
+
+    AdBlockSnapshot::Builder builder;
+    builder.addArray(FilterSection, state.filters);
+    builder.addSection(PatternSection, state.patterns.constData(), state.patterns.size());
+    builder.addArray(DomainSection, state.domainIds);
+    builder.addStringTable(RegexOffsetSection, RegexTextSection, state.regexSources);
+    builder.addStringTable(SourceOffsetSection, SourceTextSection, state.sources);
+    builder.addArray(FilterListSection, state.filterLists);
+    builder.addStringTable(ListOffsetSection, ListTextSection, state.listNames);
+    buildIndex(builder, BlockIndexSection, BlockTableSection, BlockIdSection, blockEntries, blockFallback);
+    buildIndex(builder, ExceptionIndexSection, ExceptionTableSection, ExceptionIdSection, exceptionEntries, exceptionFallback);
+    buildIndex(builder, RedirectIndexSection, RedirectTableSection, RedirectIdSection, redirectEntries, redirectFallback);
+    blockAutomaton.finish(builder, BlockAutomatonSection);
+    exceptionAutomaton.finish(builder, ExceptionAutomatonSection);
+    redirectAutomaton.finish(builder, RedirectAutomatonSection);
+    builder.addArray(RedirectFilterSection, state.redirects);
+    builder.addStringTable(RedirectOffsetSection, RedirectTextSection, state.redirectNames);
+    addTrie(builder, HostBlockNodeSection, HostBlockLabelSection, state.hostBlocks);
+    addTrie(builder, HostAllowNodeSection, HostAllowLabelSection, state.hostAllows);
+    addTrie(builder, DomainNodeSection, DomainLabelSection, state.domains);
+    state.cosmetic.finish(builder, CosmeticSection);
+
+    std::sort(prefilterKeys.begin(), prefilterKeys.end());
+    prefilterKeys.erase(std::unique(prefilterKeys.begin(), prefilterKeys.end()), prefilterKeys.end());
+    BloomFilter::Info prefilterInfo;
+    QVector<BloomFilter::Block> prefilterBlocks;
+    BloomFilter::build(prefilterKeys, prefilter.falsePositiveRate, prefilter.maxBytes, prefilterInfo, prefilterBlocks);
+    builder.addSection(PrefilterInfoSection, &prefilterInfo, sizeof(prefilterInfo));
+    builder.addArray(PrefilterBlockSection, prefilterBlocks);
+
+    QSharedPointer<AdBlockEngine> engine(new AdBlockEngine);
+    if (base) {
+        const LayerInfo layerInfo = { base->m_snapshot.buildId(), base->m_filterCount, 0 };
+        builder.addSection(LayerInfoSection, &layerInfo, sizeof(layerInfo));
+        builder.addArray(RemovedSection, removed);
+        engine->m_base = base;
+    }
+    if (!engine->m_snapshot.load(builder.finish(layout()), layout()) || !engine->attach()) {
+        return QSharedPointer<const AdBlockEngine>();
+    }
+    return engine;
+}
+
+QSharedPointer<const AdBlockEngine> AdBlockEngine::fromSnapshot(const QString &path, quint64 sourceStamp,
+                                                                const QString &basePath)
+{
+    QSharedPointer<AdBlockEngine> engine(new AdBlockEngine);
+    if (!engine->m_snapshot.open(path, layout()) || engine->m_snapshot.sourceStamp() != sourceStamp) {
+        return QSharedPointer<const AdBlockEngine>();
+    }
+
+    // The base predates the change the layer holds, so its stamp is stale;
+    // the layer's build id check ties the two together instead
+    qint64 layerInfoSize = 0;
+    if (engine->m_snapshot.section(LayerInfoSection, &layerInfoSize)) {
+        QSharedPointer<AdBlockEngine> base(new AdBlockEngine);
+        if (basePath.isEmpty() || !base->m_snapshot.open(basePath, layout()) || !base->attach()) {
+            return QSharedPointer<const AdBlockEngine>();
+        }
+        engine->m_base = base;
+    }
+
+    if (!engine->attach()) {
+        return QSharedPointer<const AdBlockEngine>();
+    }
+    return engine;
+}
+
+bool AdBlockEngine::writeSnapshot(const QString &path, quint64 sourceStamp) const
+{
+    return m_snapshot.save(path, sourceStamp);
+}
+
+bool AdBlockEngine::isMapped() const
+{
+    return m_snapshot.isMapped();
+}
+
+bool AdBlockEngine::isLayered() const
+{
+    return !m_base.isNull();
+}
+
+int AdBlockEngine::layerFilterCount() const
+{
+    return m_base ? int(m_filterCount) : 0;
+}
+
+QSharedPointer<const AdBlockEngine::HotTier> AdBlockEngine::buildHotTier(const QVector<int> &filters) const
+{
+    QSharedPointer<HotTier> hot(new HotTier);
+    hot->m_engine = this;
+
+    const AdBlockEngine *engines[2] = { this, m_base.data() };
+    const quint32 idOffsets[2] = { m_base ? m_base->m_filterCount : 0, 0 };
+    const int engineCount = m_base ? 2 : 1;
+
+    QSet<quint32> wanted[2];
+    int wantedCount = 0;
+    for (int filter : filters) {
+        if (filter < 0 || filter >= filterCount() || wantedCount == MaxHotFilters) {
+            continue;
+        }
+        const int i = (m_base && quint32(filter) < idOffsets[0]) ? 1 : 0;
+        const quint32 id = quint32(filter) - idOffsets[i];
+        const bool removed = i == 1 && (m_removed[id / 64] & (Q_UINT64_C(1) << (id % 64)));
+        if (!removed && !(engines[i]->m_filters[id].flags & (Exception | RedirectRule)) && !wanted[i].contains(id)) {
+            wanted[i].insert(id);
+            ++wantedCount;
+        }
+    }
+
+    for (int i = 0; i < engineCount; ++i) {
+        hot->m_promoted[i].fill(0, int((engines[i]->m_filterCount + 63) / 64));
+    }
+
+    auto copy = [&hot, &engines](int engine, quint32 id) {
+        const AdBlockEngine *owner = engines[engine];
+        hot->m_promoted[engine][int(id / 64)] |= Q_UINT64_C(1) << (id % 64);
+        HotTier::Entry entry = { owner->m_filters[id], id, engine };
+        NetworkFilter &filter = entry.filter;
+        const int patternOffset = hot->m_patterns.size();
+        hot->m_patterns.append(owner->m_patterns + filter.patternOffset, filter.patternLength);
+        filter.patternOffset = quint32(patternOffset);
+        const int domainOffset = hot->m_domainIds.size();
+        const quint32 *domains = owner->m_domainIds + filter.domainOffset;
+        for (int k = 0; k < filter.includeDomainCount + filter.excludeDomainCount; ++k) {
+            hot->m_domainIds.append(domains[k]);
+        }
+        filter.domainOffset = quint32(domainOffset);
+        return entry;
+    };
+
+    // Recover each filter's index token from the slots that list it
+    QVector<QPair<quint32, HotTier::Entry>> indexed;
+    QVector<HotTier::Entry> fallback;
+    QVector<HotTier::Entry> hosts;
+    for (int i = 0; i < engineCount; ++i) {
+        if (wanted[i].isEmpty()) {
+            continue;
+        }
+        const TokenIndex &index = engines[i]->m_blockIndex;
+        for (quint32 slot = 0; slot < index.tableSize; ++slot) {
+            const IndexSlot &indexSlot = index.table[slot];
+            for (quint32 k = indexSlot.begin; k < indexSlot.begin + indexSlot.count; ++k) {
+                if (wanted[i].contains(index.filterIds[k])) {
+                    indexed.append(qMakePair(indexSlot.token, copy(i, index.filterIds[k])));
+                }
+            }
+        }
+        for (quint32 k = index.fallbackBegin; k < index.fallbackBegin + index.fallbackCount; ++k) {
+            if (wanted[i].contains(index.filterIds[k])) {
+                fallback.append(copy(i, index.filterIds[k]));
+            }
+        }
+        for (quint32 id : wanted[i]) {
+            if (engines[i]->m_filters[id].flags & HostOnly) {
+                hosts.append(copy(i, id));
+            }
+        }
+    }
+
+    std::sort(indexed.begin(), indexed.end(), [](const QPair<quint32, HotTier::Entry> &a,
+                                                 const QPair<quint32, HotTier::Entry> &b) {
+        return a.first < b.first;
+    });
+    int distinct = 0;
+    for (int i = 0; i < indexed.size(); ++i) {
+        if (i == 0 || indexed[i].first != indexed[i - 1].first) {
+            ++distinct;
+        }
+    }
+    quint32 capacity = 16;
+    while (capacity < quint32(distinct) * 2) {
+        capacity <<= 1;
+    }
+    hot->m_table.fill(IndexSlot{ 0, 0, 0 }, int(capacity));
+    hot->m_mask = capacity - 1;
+    for (int i = 0; i < indexed.size();) {
+        const quint32 token = indexed[i].first;
+        const quint32 begin = quint32(hot->m_entries.size());
+        for (; i < indexed.size() && indexed[i].first == token; ++i) {
+            hot->m_entries.append(indexed[i].second);
+        }
+        quint32 slot = token & hot->m_mask;
+        while (hot->m_table[int(slot)].token) {
+            slot = (slot + 1) & hot->m_mask;
+        }
+        hot->m_table[int(slot)] = IndexSlot{ token, begin, quint32(hot->m_entries.size()) - begin };
+    }
+
+    hot->m_fallbackBegin = quint32(hot->m_entries.size());
+    hot->m_fallbackCount = quint32(fallback.size());
+    hot->m_entries += fallback;
+
+    for (const HotTier::Entry &entry : hosts) {
+        QByteArray host(hot->m_patterns.constData() + entry.filter.patternOffset, entry.filter.patternLength);
+        if (host.endsWith('^')) {
+            host.chop(1);
+        }
+        hot->m_hosts.append(HotTier::HostEntry{ hostKey(host.constData(), host.size()), quint32(hot->m_entries.size()) });
+        hot->m_entries.append(entry);
+    }
+    std::sort(hot->m_hosts.begin(), hot->m_hosts.end());
+
+    hot->m_entries.squeeze();
+    hot->m_patterns.squeeze();
+    hot->m_domainIds.squeeze();
+    return hot;
+}
+
+AdBlockEngine::Decision AdBlockEngine::match(const Request &request, const HotTier *hot) const
+{
+    Decision decision;
+    quint32 ownTokens[MaxUrlTokens];
+    const quint32 *tokens = request.tokens;
+    int tokenCount = request.tokenCount;
+    if (!tokens) {
+        tokens = ownTokens;
+        tokenCount = UrlScanner::tokenize(request.url, request.urlLength, ownTokens, MaxUrlTokens);
+    }
+
+    // A layer is searched together with the base it overlays. Base filters
+    // keep their ids and the layer's own filters are numbered after them.
+    const AdBlockEngine *engines[2] = { this, m_base.data() };
+    const quint32 idOffsets[2] = { m_base ? m_base->m_filterCount : 0, 0 };
+    const bool useHot = hot && hot->m_engine == this;
+    const quint64 *promoted[2] = { useHot ? hot->m_promoted[0].constData() : nullptr,
+                                   useHot ? hot->m_promoted[1].constData() : nullptr };
+    MatchContext contexts[2] = { { request, nullptr, promoted[0], {}, 0, false, false },
+                                 { request, m_removed, promoted[1], {}, 0, false, false } };
+    const int engineCount = m_base ? 2 : 1;
+
+    int filter = -1;
+    int filterEngine = 0;
+    bool important = false;
+    bool prefiltered = true;
+    // A blocked request also reports the first redirect filter that matches it
+    auto redirected = [&]() {
+        for (int i = 0; i < engineCount; ++i) {
+            const int redirect = engines[i]->findRedirect(contexts[i], tokens, tokenCount);
+            if (redirect >= 0) {
+                decision.redirect = int(idOffsets[i]) + redirect;
+                break;
+            }
+        }
+        return decision;
+    };
+    auto findColdBlock = [&]() {
+        for (int i = 0; i < engineCount && !important; ++i) {
+            const int found = engines[i]->findBlock(contexts[i], tokens, tokenCount, prefiltered);
+            if (found >= 0 && (filter < 0 || (engines[i]->m_filters[found].flags & Important))) {
+                filter = found;
+                filterEngine = i;
+                important = engines[i]->m_filters[found].flags & Important;
+            }
+        }
+    };
+
+    // Flags of a hot hit come from the tier's copy, so the mapped filter
+    // table stays untouched
+    const int hotEntry = useHot ? findHotMatch(*hot, contexts, tokens, tokenCount) : -1;
+    if (hotEntry >= 0) {
+        const HotTier::Entry &entry = hot->m_entries[hotEntry];
+        filter = int(entry.id);
+        filterEngine = entry.engine;
+        important = entry.filter.flags & Important;
+        prefiltered = false;
+    } else {
+        findColdBlock();
+    }
+
+    decision.prefiltered = prefiltered;
+    if (filter < 0) {
+        return decision;
+    }
+
+    decision.blocked = true;
+    decision.filter = int(idOffsets[filterEngine]) + filter;
+    if (important) {
+        return redirected();
+    }
+
+    int exception = -1;
+    int exceptionEngine = 0;
+    for (int i = 0; i < engineCount && exception < 0; ++i) {
+        exception = engines[i]->findException(contexts[i], tokens, tokenCount);
+        exceptionEngine = i;
+    }
+    if (exception < 0) {
+        return redirected();
+    }
+
+    // The hot tier only knows its own filters; an $important one elsewhere
+    // still overrides the exception
+    if (hotEntry >= 0) {
+        findColdBlock();
+        if (important) {
+            decision.filter = int(idOffsets[filterEngine]) + filter;
+            return redirected();
+        }
+    }
+
+    // The index scans above already preferred $important filters; host
+    // trie hits did not look for them yet
+    for (int i = 0; i < engineCount; ++i) {
+        if (!contexts[i].hostMatch) {
+            continue;
+        }
+        const int important = engines[i]->findMatch(engines[i]->m_blockIndex, contexts[i], tokens, tokenCount, true);
+        if (important >= 0 && (engines[i]->m_filters[important].flags & Important)) {
+            decision.filter = int(idOffsets[i]) + important;
+            return redirected();
+        }
+    }
+
+    decision.blocked = false;
+    decision.exception = int(idOffsets[exceptionEngine]) + exception;
+    return decision;
+}
+
+int AdBlockEngine::filterCount() const
+{
+    return int(m_filterCount) + (m_base ? m_base->filterCount() : 0);
+}
+
+qint64 AdBlockEngine::memoryUsage() const
+{
+    // Mapped snapshot pages are shared with other browser instances
+    return qint64(sizeof(AdBlockEngine)) + m_snapshot.size()
+        + m_regexes.size() * qint64(sizeof(QRegularExpression))
+        + m_blockIndex.fallback.memoryUsage() + m_exceptionIndex.fallback.memoryUsage()
+        + m_redirectIndex.fallback.memoryUsage()
+        + (m_base ? m_base->memoryUsage() : 0);
+}
+
+QString AdBlockEngine::filterText(int filter) const
+{
+    if (m_base) {
+        if (filter < m_base->filterCount()) {
+            return m_base->filterText(filter);
+        }
+        filter -= m_base->filterCount();
+    }
+    if (filter < 0 || quint32(filter) >= m_filterCount) {
+        return QString();
+    }
+    const quint32 begin = m_sourceOffsets[filter];
+    const quint32 end = m_sourceOffsets[filter + 1];
+    if (begin > end || end > m_sourceTextSize) {
+        return QString();
+    }
+    return QString::fromUtf8(m_sourceText + begin, int(end - begin));
+}
+
+QString AdBlockEngine::filterList(int filter) const
+{
+    if (m_base) {
+        if (filter < m_base->filterCount()) {
+            return m_base->filterList(filter);
+        }
+        filter -= m_base->filterCount();
+    }
+    if (filter < 0 || quint32(filter) >= m_filterCount) {
+        return QString();
+    }
+    const quint32 list = m_filterLists[filter];
+    const quint32 begin = m_listOffsets[list];
+    const quint32 end = m_listOffsets[list + 1];
+    if (begin > end || end > m_listTextSize) {
+        return QString();
+    }
+    return QString::fromUtf8(m_listText + begin, int(end - begin));
+}
+
+QByteArray AdBlockEngine::redirectResource(int filter) const
+{
+    if (m_base) {
+        if (filter < m_base->filterCount()) {
+            return m_base->redirectResource(filter);
+        }
+        filter -= m_base->filterCount();
+    }
+    if (filter < 0 || !m_redirectCount) {
+        return QByteArray();
+    }
+    const RedirectEntry *end = m_redirects + m_redirectCount;
+    const RedirectEntry *entry = std::lower_bound(m_redirects, end, quint32(filter),
+                                                  [](const RedirectEntry &a, quint32 b) { return a.filter < b; });
+    if (entry == end || entry->filter != quint32(filter)) {
+        return QByteArray();
+    }
+    const quint32 begin = m_redirectOffsets[entry->resource];
+    return QByteArray(m_redirectText + begin, int(m_redirectOffsets[entry->resource + 1] - begin));
+}
+
+const CosmeticFilterIndex &AdBlockEngine::cosmeticFilters() const
+{
+    return m_cosmetic;
+}
+
+int AdBlockEngine::HotTier::filterCount() const
+{
+    return m_entries.size();
+}
+
+qint64 AdBlockEngine::HotTier::memoryUsage() const
+{
+    return qint64(sizeof(HotTier)) + m_entries.size() * qint64(sizeof(Entry))
+        + m_table.size() * qint64(sizeof(IndexSlot)) + m_hosts.size() * qint64(sizeof(HostEntry))
+        + (m_promoted[0].size() + m_promoted[1].size()) * qint64(sizeof(quint64))
+        + m_patterns.size() + m_domainIds.size() * qint64(sizeof(quint32));
+}
+
+const BloomFilter &AdBlockEngine::prefilter() const
+{
+    return m_prefilter;
+}
+
+const AdBlockEngine::IndexSlot *AdBlockEngine::TokenIndex::find(quint32 token) const
+{
+    if (!tableSize) {
+        return nullptr;
+    }
+    const IndexSlot *slot = table;
+    quint32 i = token & mask;
+    while (slot[i].token) {
+        if (slot[i].token == token) {
+            return &slot[i];
+        }
+        i = (i + 1) & mask;
+    }
+    return nullptr;
+}
+
+bool AdBlockEngine::attach()
+{
+    m_filters = m_snapshot.array<NetworkFilter>(FilterSection, &m_filterCount);
+    m_domainIds = m_snapshot.array<quint32>(DomainSection, &m_domainIdCount);
+    m_patterns = m_snapshot.array<char>(PatternSection, &m_patternSize);
+    m_sourceOffsets = m_snapshot.array<quint32>(SourceOffsetSection, &m_sourceOffsetCount);
+    m_sourceText = m_snapshot.array<char>(SourceTextSection, &m_sourceTextSize);
+    if (m_sourceOffsetCount != m_filterCount + 1) {
+        return false;
+    }
+
+    quint32 filterListCount = 0;
+    m_filterLists = m_snapshot.array<quint16>(FilterListSection, &filterListCount);
+    m_listOffsets = m_snapshot.array<quint32>(ListOffsetSection, &m_listOffsetCount);
+    m_listText = m_snapshot.array<char>(ListTextSection, &m_listTextSize);
+    if (filterListCount != m_filterCount || !m_listOffsetCount) {
+        return false;
+    }
+    for (quint32 i = 0; i < m_filterCount; ++i) {
+        if (m_filterLists[i] + 1u >= m_listOffsetCount) {
+            return false;
+        }
+    }
+
+    quint32 regexOffsetCount = 0;
+    quint32 regexTextSize = 0;
+    const quint32 *regexOffsets = m_snapshot.array<quint32>(RegexOffsetSection, &regexOffsetCount);
+    const char *regexText = m_snapshot.array<char>(RegexTextSection, &regexTextSize);
+    for (quint32 i = 0; i + 1 < regexOffsetCount; ++i) {
+        if (regexOffsets[i] >= regexOffsets[i + 1] || regexOffsets[i + 1] > regexTextSize) {
+            return false;
+        }
+        // The first byte records whether the rule was $match-case
+        const char *source = regexText + regexOffsets[i];
+        const QRegularExpression::PatternOptions options = source[0] == 'c'
+            ? QRegularExpression::NoPatternOption
+            : QRegularExpression::CaseInsensitiveOption;
+        QRegularExpression regex(QString::fromUtf8(source + 1, int(regexOffsets[i + 1] - regexOffsets[i]) - 1), options);
+        regex.optimize();
+        m_regexes.append(regex);
+    }
+
+    // A damaged snapshot must not lead to reads outside the mapping
+    for (quint32 i = 0; i < m_filterCount; ++i) {
+        const NetworkFilter &filter = m_filters[i];
+        if (quint64(filter.patternOffset) + filter.patternLength > m_patternSize
+            || quint64(filter.domainOffset) + filter.includeDomainCount + filter.excludeDomainCount > m_domainIdCount
+            || ((filter.flags & Regex) && (filter.regex < 0 || filter.regex >= m_regexes.size()))) {
+            return false;
+        }
+    }
+
+    m_redirects = m_snapshot.array<RedirectEntry>(RedirectFilterSection, &m_redirectCount);
+    m_redirectOffsets = m_snapshot.array<quint32>(RedirectOffsetSection, &m_redirectOffsetCount);
+    m_redirectText = m_snapshot.array<char>(RedirectTextSection, &m_redirectTextSize);
+    for (quint32 i = 0; i < m_redirectCount; ++i) {
+        const RedirectEntry &entry = m_redirects[i];
+        if (entry.filter >= m_filterCount || entry.resource + 1 >= m_redirectOffsetCount
+            || (i && entry.filter <= m_redirects[i - 1].filter)) {
+            return false;
+        }
+        const quint32 begin = m_redirectOffsets[entry.resource];
+        const quint32 end = m_redirectOffsets[entry.resource + 1];
+        if (begin > end || end > m_redirectTextSize) {
+            return false;
+        }
+    }
+
+    quint32 layerInfoCount = 0;
+    const LayerInfo *layerInfo = m_snapshot.array<LayerInfo>(LayerInfoSection, &layerInfoCount);
+    if (layerInfoCount || m_base) {
+        if (layerInfoCount != 1 || !m_base || m_base->m_base || layerInfo->baseBuildId != m_base->m_snapshot.buildId()
+            || layerInfo->baseFilterCount != m_base->m_filterCount) {
+            return false;
+        }
+        m_removed = m_snapshot.array<quint64>(RemovedSection, &m_removedWordCount);
+        if (m_removedWordCount != (m_base->m_filterCount + 63) / 64) {
+            return false;
+        }
+    }
+
+    quint32 prefilterInfoCount = 0;
+    quint32 prefilterBlockCount = 0;
+    const BloomFilter::Info *prefilterInfo = m_snapshot.array<BloomFilter::Info>(PrefilterInfoSection, &prefilterInfoCount);
+    const BloomFilter::Block *prefilterBlocks = m_snapshot.array<BloomFilter::Block>(PrefilterBlockSection, &prefilterBlockCount);
+    if (prefilterInfoCount != 1 || !m_prefilter.attach(*prefilterInfo, prefilterBlocks, prefilterBlockCount)) {
+        return false;
+    }
+
+    return attachIndex(m_blockIndex, BlockIndexSection, BlockTableSection, BlockIdSection, BlockAutomatonSection)
+        && attachIndex(m_exceptionIndex, ExceptionIndexSection, ExceptionTableSection, ExceptionIdSection,
+                       ExceptionAutomatonSection)
+        && attachIndex(m_redirectIndex, RedirectIndexSection, RedirectTableSection, RedirectIdSection,
+                       RedirectAutomatonSection)
+        && attachTrie(m_hostBlocks, HostBlockNodeSection, HostBlockLabelSection)
+        && attachTrie(m_hostAllows, HostAllowNodeSection, HostAllowLabelSection)
+        && attachTrie(m_domains, DomainNodeSection, DomainLabelSection)
+        && m_cosmetic.attach(m_snapshot, CosmeticSection);
+}
+
+bool AdBlockEngine::attachIndex(TokenIndex &index, quint32 infoSection, quint32 tableSection, quint32 idSection,
+                                quint32 automatonSection) const
+{
+    quint32 infoCount = 0;
+    const IndexInfo *info = m_snapshot.array<IndexInfo>(infoSection, &infoCount);
+    if (infoCount != 1) {
+        return false;
+    }
+
+    index.table = m_snapshot.array<IndexSlot>(tableSection, &index.tableSize);
+    index.filterIds = m_snapshot.array<quint32>(idSection, &index.idCount);
+    index.mask = info->mask;
+    index.fallbackBegin = info->fallbackBegin;
+    index.fallbackCount = info->fallbackCount;
+
+    if (index.tableSize != index.mask + 1 || (index.tableSize & index.mask)
+        || quint64(index.fallbackBegin) + index.fallbackCount > index.idCount) {
+        return false;
+    }
+    for (quint32 i = 0; i < index.tableSize; ++i) {
+        if (quint64(index.table[i].begin) + index.table[i].count > index.idCount) {
+            return false;
+        }
+    }
+    for (quint32 i = 0; i < index.idCount; ++i) {
+        if (index.filterIds[i] >= m_filterCount) {
+            return false;
+        }
+    }
+    return index.fallback.attach(m_snapshot, automatonSection, index.fallbackCount);
+}
+
+bool AdBlockEngine::attachTrie(DomainTrie &trie, quint32 nodeSection, quint32 labelSection) const
+{
+    quint32 nodeCount = 0;
+    quint32 labelSize = 0;
+    const DomainTrie::Node *nodes = m_snapshot.array<DomainTrie::Node>(nodeSection, &nodeCount);
+    const char *labels = m_snapshot.array<char>(labelSection, &labelSize);
+
+    // Host trie values are filter ids and get dereferenced on a match
+    const bool filterValues = nodeSection != DomainNodeSection;
+    for (quint32 i = 0; filterValues && i < nodeCount; ++i) {
+        if (nodes[i].value >= 0 && quint32(nodes[i].value) >= m_filterCount) {
+            return false;
+        }
+    }
+    return trie.attach(nodes, nodeCount, labels, labelSize);
+}
+
+quint32 AdBlockEngine::layout()
+{
+    // Changes whenever a record stored in the snapshot changes shape
+    return FormatRevision << 24 | quint32(sizeof(NetworkFilter)) << 16 | quint32(sizeof(IndexSlot)) << 8
+        | quint32(sizeof(DomainTrie::Node));
+}
+
+bool AdBlockEngine::parseFilter(const QString &line, NetworkFilter &filter, QByteArray &pattern, QByteArray &redirect,
+                                CompileState &state)
+{
+    QString text = line.trimmed();
+    if (text.isEmpty() || text.startsWith('!') || text.startsWith('[')) {
+        return false;
+    }
+
+    // Element hiding rules the cosmetic index did not take are dropped too
+    if (text.contains("##") || text.contains("#@#") || text.contains("#?#") || text.contains("#$#")) {
+        return false;
+    }
+
+    filter = NetworkFilter();
+    filter.typeMask = AllTypes & ~Document;
+    filter.regex = -1;
+
+    if (text.startsWith("@@")) {
+        filter.flags |= Exception;
+        text.remove(0, 2);
+    }
+
+    const bool regexLike = text.startsWith('/');
+    int dollar = text.lastIndexOf('$');
+    if (regexLike && dollar < text.lastIndexOf('/')) {
+        dollar = -1;
+    }
+
+    QVector<quint32> includeDomains;
+    QVector<quint32> excludeDomains;
+    if (dollar >= 0) {
+        quint32 includeTypes = 0;
+        quint32 excludeTypes = 0;
+        const QStringList options = text.mid(dollar + 1).split(',', Qt::SkipEmptyParts);
+        text.truncate(dollar);
+
+        for (const QString &option : options) {
+            const bool negated = option.startsWith('~');
+            const QString name = (negated ? option.mid(1) : option).trimmed().toLower();
+
+            if (name == "third-party" || name == "3p") {
+                filter.flags |= negated ? FirstPartyOnly : ThirdPartyOnly;
+            } else if (name == "first-party" || name == "1p") {
+                filter.flags |= negated ? ThirdPartyOnly : FirstPartyOnly;
+            } else if (name == "important") {
+                filter.flags |= Important;
+            } else if (name == "match-case") {
+                filter.flags |= MatchCase;
+            } else if (!negated && (name.startsWith("redirect=") || name.startsWith("redirect-rule="))) {
+                // Priorities after the name are not honoured; the first
+                // matching redirect filter wins
+                redirect = name.section('=', 1).section(':', 0, 0).trimmed().toUtf8();
+                if (redirect.isEmpty()) {
+                    return false;
+                }
+                filter.flags |= name.startsWith("redirect=") ? Redirect : RedirectRule;
+            } else if (name.startsWith("domain=")) {
+                bool skippedInclude = false;
+                for (const QString &domain : name.mid(7).split('|', Qt::SkipEmptyParts)) {
+                    const bool excluded = domain.startsWith('~');
+                    const QByteArray host = (excluded ? domain.mid(1) : domain).toUtf8();
+                    if (!DomainTrie::isValidHost(host.constData(), host.size())) {
+                        skippedInclude |= !excluded;
+                        continue;
+                    }
+
+                    quint32 id = state.domainNames.value(host, quint32(state.domainNames.size()));
+                    if (id == quint32(state.domainNames.size())) {
+                        state.domainNames.insert(host, id);
+                        state.domains.insert(host, qint32(id));
+                    }
+                    (excluded ? excludeDomains : includeDomains).append(id);
+                }
+
+                // Dropping unsupported entries must not widen the rule
+                if (skippedInclude && includeDomains.isEmpty()) {
+                    return false;
+                }
+            } else if (quint32 type = typeFromOption(name)) {
+                (negated ? excludeTypes : includeTypes) |= type;
+            } else {
+                // Options we cannot honour would change the rule's meaning
+                return false;
+            }
+        }
+
+        if (includeTypes) {
+            filter.typeMask = includeTypes;
+        }
+        filter.typeMask &= ~excludeTypes;
+
+        // Exceptions to a particular redirect are not supported; dropping
+        // the rule keeps it from allowing the request outright
+        if ((filter.flags & Exception) && (filter.flags & (Redirect | RedirectRule))) {
+            return false;
+        }
+    }
+
+    if (regexLike && text.size() > 2 && text.endsWith('/')) {
+        const QRegularExpression::PatternOptions options = (filter.flags & MatchCase)
+            ? QRegularExpression::NoPatternOption
+            : QRegularExpression::CaseInsensitiveOption;
+        const QString source = text.mid(1, text.size() - 2);
+        if (!QRegularExpression(source, options).isValid()) {
+            return false;
+        }
+        filter.flags |= Regex;
+        filter.regex = state.regexSources.size();
+        state.regexSources.append(((filter.flags & MatchCase) ? "c" : "i") + source.toUtf8());
+    } else {
+        if (text.startsWith("||")) {
+            filter.flags |= AnchorHost;
+            text.remove(0, 2);
+        } else if (text.startsWith('|')) {
+            filter.flags |= AnchorStart;
+            text.remove(0, 1);
+        }
+        if (text.endsWith('|')) {
+            filter.flags |= AnchorEnd;
+            text.chop(1);
+        }
+
+        // Leading and trailing wildcards carry no information
+        if (text.startsWith('*')) {
+            filter.flags &= ~(AnchorStart | AnchorHost);
+        }
+        if (text.endsWith('*')) {
+            filter.flags &= ~AnchorEnd;
+        }
+        while (text.startsWith('*')) {
+            text.remove(0, 1);
+        }
+        while (text.endsWith('*')) {
+            text.chop(1);
+        }
+        while (text.contains("**")) {
+            text.replace("**", "*");
+        }
+
+        pattern = (filter.flags & MatchCase) ? text.toUtf8() : text.toLower().toUtf8();
+        if (pattern.size() > 0xffff) {
+            return false;
+        }
+    }
+
+    std::sort(includeDomains.begin(), includeDomains.end());
+    std::sort(excludeDomains.begin(), excludeDomains.end());
+    filter.domainOffset = quint32(state.domainIds.size());
+    filter.includeDomainCount = quint16(includeDomains.size());
+    filter.excludeDomainCount = quint16(excludeDomains.size());
+    state.domainIds += includeDomains;
+    state.domainIds += excludeDomains;
+
+    return true;
+}
+
+bool AdBlockEngine::parseHostsLine(const QString &line, QByteArray &host)
+{
+    // "0.0.0.0 ads.example.com" and friends; only the first name is used
+    const QStringList fields = line.section('#', 0, 0).simplified().split(' ', Qt::SkipEmptyParts);
+    if (fields.size() < 2) {
+        return false;
+    }
+
+    const QString &address = fields[0];
+    if (address != "0.0.0.0" && address != "127.0.0.1" && address != "::" && address != "::1") {
+        return false;
+    }
+
+    // Loopback aliases and malformed names are hosts syntax but not rules
+    host = fields[1].toLower().toUtf8();
+    for (const char *name : LocalHostNames) {
+        if (host == name) {
+            host.clear();
+        }
+    }
+    if (!DomainTrie::isValidHost(host.constData(), host.size())) {
+        host.clear();
+    }
+    return true;
+}
+
+bool AdBlockEngine::isHostPattern(const NetworkFilter &filter, const QByteArray &pattern)
+{
+    if ((filter.flags & ~Exception) != AnchorHost || filter.typeMask != (AllTypes & ~Document)
+        || filter.includeDomainCount || filter.excludeDomainCount) {
+        return false;
+    }
+
+    const int length = pattern.endsWith('^') ? pattern.size() - 1 : pattern.size();
+    return DomainTrie::isValidHost(pattern.constData(), length);
+}
+
+QByteArray AdBlockEngine::requiredLiteral(const NetworkFilter &filter, const CompileState &state)
+{
+    if (filter.flags & Regex) {
+        // Skip the case marker in front of the stored source
+        return regexLiteral(state.regexSources[filter.regex].mid(1));
+    }
+    return globLiteral(state.patterns.mid(int(filter.patternOffset), filter.patternLength));
+}
+
+void AdBlockEngine::addTrie(AdBlockSnapshot::Builder &builder, quint32 nodeSection, quint32 labelSection, const DomainTrie::Builder &trie)
+{
+    QVector<DomainTrie::Node> nodes;
+    QByteArray labels;
+    trie.finish(nodes, labels);
+    builder.addArray(nodeSection, nodes);
+    builder.addSection(labelSection, labels.constData(), labels.size());
+}
+
+int AdBlockEngine::findBlock(MatchContext &context, const quint32 *tokens, int tokenCount, bool &prefiltered) const
+{
+    // Most requests share no token or host with any block rule; only the
+    // unindexed fallback filters remain to be checked for those
+    const bool candidate = passesPrefilter(context.request, tokens, tokenCount);
+    prefiltered &= !candidate;
+    if (!candidate && !m_blockIndex.fallbackCount) {
+        return -1;
+    }
+
+    resolveDomains(context);
+    if (candidate && context.request.type != Document) {
+        const int filter = findHostMatch(m_hostBlocks, context);
+        if (filter >= 0) {
+            context.hostMatch = true;
+            return filter;
+        }
+    }
+    return findMatch(m_blockIndex, context, tokens, candidate ? tokenCount : 0, true);
+}
+
+int AdBlockEngine::findException(MatchContext &context, const quint32 *tokens, int tokenCount) const
+{
+    resolveDomains(context);
+    const int exception = findHostMatch(m_hostAllows, context);
+    return exception >= 0 ? exception : findMatch(m_exceptionIndex, context, tokens, tokenCount, false);
+}
+
+int AdBlockEngine::findRedirect(MatchContext &context, const quint32 *tokens, int tokenCount) const
+{
+    if (!m_redirectIndex.idCount) {
+        return -1;
+    }
+
+    // Redirect filters a hot tier copied are still candidates here
+    resolveDomains(context);
+    MatchContext redirectContext = context;
+    redirectContext.promoted = nullptr;
+    return findMatch(m_redirectIndex, redirectContext, tokens, tokenCount, false);
+}
+
+void AdBlockEngine::resolveDomains(MatchContext &context) const
+{
+    if (context.domainsResolved) {
+        return;
+    }
+    context.domainsResolved = true;
+    if (!m_domains.isEmpty()) {
+        context.domainIdCount = m_domains.findAll(context.request.firstPartyHost, context.request.firstPartyHostLength,
+                                                  context.domainIds, int(sizeof(context.domainIds) / sizeof(qint32)));
+    }
+}
+
+int AdBlockEngine::findMatch(const TokenIndex &index, const MatchContext &context, const quint32 *tokens, int tokenCount, bool stopAtImportant) const
+{
+    const quint32 *ids = index.filterIds;
+    int firstMatch = -1;
+
+    auto scan = [&](quint32 begin, quint32 count) {
+        for (quint32 i = begin; i < begin + count; ++i) {
+            const NetworkFilter &filter = m_filters[ids[i]];
+            if ((context.removed && isRemoved(context, ids[i])) || (context.promoted && isPromoted(context, ids[i]))
+                || !matchesFilter(filter, context)) {
+                continue;
+            }
+            if (firstMatch < 0) {
+                firstMatch = int(ids[i]);
+            }
+            if (!stopAtImportant || (filter.flags & Important)) {
+                firstMatch = int(ids[i]);
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (int t = 0; t < tokenCount; ++t) {
+        if (const IndexSlot *slot = index.find(tokens[t])) {
+            if (scan(slot->begin, slot->count)) {
+                return firstMatch;
+            }
+        }
+    }
+    if (!index.fallbackCount) {
+        return firstMatch;
+    }
+
+    // One pass over the URL marks the fallback filters whose literal occurs
+    // in it; they are then tried in their original order
+    QVarLengthArray<quint64, 64> hits(int((index.fallbackCount + 63) / 64));
+    std::fill(hits.begin(), hits.end(), 0);
+    index.fallback.scan(context.request.url, context.request.urlLength, [&hits](quint32 pattern) {
+        hits[int(pattern / 64)] |= Q_UINT64_C(1) << (pattern % 64);
+    });
+    for (int word = 0; word < hits.size(); ++word) {
+        for (quint64 bits = hits[word]; bits; bits &= bits - 1) {
+            const quint32 position = quint32(word) * 64 + quint32(qCountTrailingZeroBits(bits));
+            if (scan(index.fallbackBegin + position, 1)) {
+                return firstMatch;
+            }
+        }
+    }
+
+    return firstMatch;
+}
+
+bool AdBlockEngine::passesPrefilter(const Request &request, const quint32 *tokens, int tokenCount) const
+{
+    if (!m_prefilter.isEnabled()) {
+        return true;
+    }
+    for (int i = 0; i < tokenCount; ++i) {
+        if (m_prefilter.mayContain(tokenKey(tokens[i]))) {
+            return true;
+        }
+    }
+
+    // The host trie matches the host and each of its parent domains
+    const char *host = request.url + request.hostBegin;
+    const int length = request.hostEnd - request.hostBegin;
+    for (int begin = 0; begin < length; ++begin) {
+        if ((begin == 0 || host[begin - 1] == '.') && m_prefilter.mayContain(hostKey(host + begin, length - begin))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+quint64 AdBlockEngine::tokenKey(quint32 token)
+{
+    return mixKey(token);
+}
+
+quint64 AdBlockEngine::hostKey(const char *host, int length)
+{
+    // 64-bit FNV-1a, with a distinct basis so hosts and tokens do not collide
+    quint64 key = Q_UINT64_C(0xcbf29ce484222325) ^ Q_UINT64_C(0x5bd1e995);
+    for (int i = 0; i < length; ++i) {
+        key ^= quint8(host[i]);
+        key *= Q_UINT64_C(0x100000001b3);
+    }
+    return mixKey(key);
+}
+
+int AdBlockEngine::findHostMatch(const DomainTrie &trie, const MatchContext &context) const
+{
+    const Request &request = context.request;
+    if (trie.isEmpty() || request.hostEnd <= request.hostBegin) {
+        return -1;
+    }
+    const char *host = request.url + request.hostBegin;
+    const int length = request.hostEnd - request.hostBegin;
+    if (!context.removed) {
+        return trie.find(host, length);
+    }
+
+    // Fall back to a parent domain's rule when the closest one was removed
+    qint32 values[16];
+    const int count = trie.findAll(host, length, values, 16);
+    for (int i = 0; i < count; ++i) {
+        if (!isRemoved(context, quint32(values[i]))) {
+            return values[i];
+        }
+    }
+    return -1;
+}
+
+int AdBlockEngine::findHotMatch(const HotTier &hot, MatchContext *contexts, const quint32 *tokens, int tokenCount) const
+{
+    const AdBlockEngine *engines[2] = { this, m_base.data() };
+    int firstMatch = -1;
+
+    auto check = [&](quint32 index) {
+        const HotTier::Entry &entry = hot.m_entries[int(index)];
+        const AdBlockEngine *engine = engines[entry.engine];
+        MatchContext &context = contexts[entry.engine];
+        // The domain trie is only walked for filters that list domains
+        if (entry.filter.includeDomainCount || entry.filter.excludeDomainCount) {
+            engine->resolveDomains(context);
+        }
+        if (!engine->matchesFilter(entry.filter, context, hot.m_patterns.constData(), hot.m_domainIds.constData())) {
+            return false;
+        }
+        if (firstMatch < 0 || (entry.filter.flags & Important)) {
+            firstMatch = int(index);
+        }
+        return bool(entry.filter.flags & Important);
+    };
+
+    for (int t = 0; t < tokenCount; ++t) {
+        quint32 slot = tokens[t] & hot.m_mask;
+        while (hot.m_table[int(slot)].token && hot.m_table[int(slot)].token != tokens[t]) {
+            slot = (slot + 1) & hot.m_mask;
+        }
+        const IndexSlot &indexSlot = hot.m_table[int(slot)];
+        for (quint32 i = indexSlot.begin; indexSlot.token && i < indexSlot.begin + indexSlot.count; ++i) {
+            if (check(i)) {
+                return firstMatch;
+            }
+        }
+    }
+    for (quint32 i = hot.m_fallbackBegin; i < hot.m_fallbackBegin + hot.m_fallbackCount; ++i) {
+        if (check(i)) {
+            return firstMatch;
+        }
+    }
+    if (firstMatch >= 0 || hot.m_hosts.isEmpty()) {
+        return firstMatch;
+    }
+
+    // Hostname rules are never $important; any listed parent domain blocks
+    const Request &request = contexts[0].request;
+    const char *host = request.url + request.hostBegin;
+    const int length = request.hostEnd - request.hostBegin;
+    for (int begin = 0; begin < length; ++begin) {
+        if (begin > 0 && host[begin - 1] != '.') {
+            continue;
+        }
+        const HotTier::HostEntry key = { hostKey(host + begin, length - begin), 0 };
+        auto it = std::lower_bound(hot.m_hosts.constBegin(), hot.m_hosts.constEnd(), key);
+        for (; it != hot.m_hosts.constEnd() && it->key == key.key; ++it) {
+            if (hot.m_entries[int(it->entry)].filter.typeMask & request.type) {
+                return int(it->entry);
+            }
+        }
+    }
+    return -1;
+}
+
+bool AdBlockEngine::matchesFilter(const NetworkFilter &filter, const MatchContext &context) const
+{
+    return matchesFilter(filter, context, m_patterns, m_domainIds);
+}
+
+bool AdBlockEngine::matchesFilter(const NetworkFilter &filter, const MatchContext &context, const char *patterns,
+                                  const quint32 *domainIds) const
+{
+    const Request &request = context.request;
+    if (!(filter.typeMask & request.type)) {
+        return false;
+    }
+    if ((filter.flags & ThirdPartyOnly) && !request.thirdParty) {
+        return false;
+    }
+    if ((filter.flags & FirstPartyOnly) && request.thirdParty) {
+        return false;
+    }
+    return matchesDomain(filter, context, domainIds) && matchesPattern(filter, request, patterns);
+}
+
+bool AdBlockEngine::matchesDomain(const NetworkFilter &filter, const MatchContext &context, const quint32 *domainIds) const
+{
+    if (!filter.includeDomainCount && !filter.excludeDomainCount) {
+        return true;
+    }
+
+    const quint32 *includes = domainIds + filter.domainOffset;
+    const quint32 *excludes = includes + filter.includeDomainCount;
+
+    // The most specific listed domain wins
+    for (int i = 0; i < context.domainIdCount; ++i) {
+        const quint32 id = quint32(context.domainIds[i]);
+        if (std::binary_search(excludes, excludes + filter.excludeDomainCount, id)) {
+            return false;
+        }
+        if (std::binary_search(includes, includes + filter.includeDomainCount, id)) {
+            return true;
+        }
+    }
+
+    return filter.includeDomainCount == 0;
+}
+
+bool AdBlockEngine::matchesPattern(const NetworkFilter &filter, const Request &request, const char *patterns) const
+{
+    const char *url = (filter.flags & MatchCase) ? request.originalUrl : request.url;
+    const int length = request.urlLength;
+
+    if (filter.flags & Regex) {
+        return m_regexes[filter.regex].match(QString::fromLatin1(url, length)).hasMatch();
+    }
+
+    const char *pattern = patterns + filter.patternOffset;
+    const int patternLength = filter.patternLength;
+    const bool anchorEnd = filter.flags & AnchorEnd;
+
+    if (filter.flags & AnchorStart) {
+        return globMatch(pattern, patternLength, url, length, anchorEnd);
+    }
+
+    if (filter.flags & AnchorHost) {
+        for (int i = request.hostBegin; i < request.hostEnd; ++i) {
+            if ((i == request.hostBegin || url[i - 1] == '.')
+                && globMatch(pattern, patternLength, url + i, length - i, anchorEnd)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    if (patternLength == 0) {
+        return true;
+    }
+
+    const char first = pattern[0];
+    for (int i = 0; i < length; ++i) {
+        if (first != '^') {
+            const char *hit = static_cast<const char *>(memchr(url + i, first, size_t(length - i)));
+            if (!hit) {
+                return false;
+            }
+            i = int(hit - url);
+        }
+        if (globMatch(pattern, patternLength, url + i, length - i, anchorEnd)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AdBlockEngine::globMatch(const char *pattern, int patternLength, const char *text, int textLength, bool anchorEnd)
+{
+    int p = 0;
+    int t = 0;
+    int starPattern = -1;
+    int starText = 0;
+
+    for (;;) {
+        if (p == patternLength) {
+            if (!anchorEnd || t == textLength) {
+                return true;
+            }
+        } else if (pattern[p] == '*') {
+            starPattern = p++;
+            starText = t;
+            continue;
+        } else if (t < textLength && (pattern[p] == text[t] || (pattern[p] == '^' && isSeparator(text[t])))) {
+            ++p;
+            ++t;
+            continue;
+        } else if (t == textLength) {
+            // '^' also matches the end of the address
+            int rest = p;
+            while (rest < patternLength && (pattern[rest] == '^' || pattern[rest] == '*')) {
+                ++rest;
+            }
+            if (rest == patternLength) {
+                return true;
+            }
+        }
+
+        if (starPattern < 0 || starText >= textLength) {
+            return false;
+        }
+        p = starPattern + 1;
+        t = ++starText;
+    }
+}
+
+void AdBlockEngine::buildIndex(AdBlockSnapshot::Builder &builder, quint32 infoSection, quint32 tableSection, quint32 idSection,
+                               const QVector<QPair<quint32, quint32>> &entries, const QVector<quint32> &fallback)
+{
+    QVector<QPair<quint32, quint32>> sorted = entries;
+    std::sort(sorted.begin(), sorted.end());
+
+    int distinct = 0;
+    for (int i = 0; i < sorted.size(); ++i) {
+        if (i == 0 || sorted[i].first != sorted[i - 1].first) {
+            ++distinct;
+        }
+    }
+
+    // Keep the load factor at or below one half
+    quint32 capacity = 16;
+    while (capacity < quint32(distinct) * 2) {
+        capacity <<= 1;
+    }
+    QVector<IndexSlot> table(int(capacity), IndexSlot{ 0, 0, 0 });
+    QVector<quint32> filterIds;
+    filterIds.reserve(sorted.size() + fallback.size());
+    const quint32 mask = capacity - 1;
+
+    int i = 0;
+    while (i < sorted.size()) {
+        const quint32 token = sorted[i].first;
+        const quint32 begin = quint32(filterIds.size());
+        while (i < sorted.size() && sorted[i].first == token) {
+            filterIds.append(sorted[i].second);
+            ++i;
+        }
+
+        quint32 slot = token & mask;
+        while (table[int(slot)].token) {
+            slot = (slot + 1) & mask;
+        }
+        table[int(slot)] = IndexSlot{ token, begin, quint32(filterIds.size()) - begin };
+    }
+
+    const IndexInfo info = { mask, quint32(filterIds.size()), quint32(fallback.size()), 0 };
+    filterIds += fallback;
+
+    builder.addSection(infoSection, &info, sizeof(info));
+    builder.addArray(tableSection, table);
+    builder.addArray(idSection, filterIds);
+}
@@ -0,0 +1,418 @@
+// AdBlockEngine.h
+
+#ifndef ADBLOCKENGINE_H
+#define ADBLOCKENGINE_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QMap>
+#include <QRegularExpression>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "AdBlockSnapshot.h"
+#include "BloomFilter.h"
+#include "CosmeticFilterIndex.h"
+#include "DomainTrie.h"
+#include "PatternAutomaton.h"
+#include "UrlScanner.h"
+
+// Compiled set of ABP/EasyList network rules, plus the element hiding rules
+// from the same lists. Built once from raw filter lists and never modified
+// afterwards, so a single instance can be shared
+// between the GUI thread and WebEngine's IO thread. The compiled tables live
+// in an AdBlockSnapshot, either in memory or mapped from disk.
+class AdBlockEngine
+{
+public:
+    // URLs with more tokens are matched on their first MaxUrlTokens
+    static const int MaxUrlTokens = 256;
+    // A hot tier holds at most this many filters; enough for the rules
+    // behind nearly all blocks, small enough to stay in the L2 cache
+    static const int MaxHotFilters = 2048;
+
+    enum ResourceType : quint32 {
+        Document = 1 << 0,
+        Subdocument = 1 << 1,
+        Stylesheet = 1 << 2,
+        Script = 1 << 3,
+        Image = 1 << 4,
+        Font = 1 << 5,
+        Object = 1 << 6,
+        Media = 1 << 7,
+        XmlHttpRequest = 1 << 8,
+        Ping = 1 << 9,
+        WebSocket = 1 << 10,
+        Other = 1 << 11,
+        AllTypes = (1 << 12) - 1
+    };
+
+    // One request to classify. All pointers refer to caller-owned memory and
+    // |url| must already be lowercased; |originalUrl| is only consulted by
+    // $match-case rules. Host ranges are offsets into |url|. Callers that
+    // lowercased the URL with UrlScanner can pass its token hashes along;
+    // otherwise match() tokenizes the URL itself.
+    struct Request {
+        const char *url = nullptr;
+        const char *originalUrl = nullptr;
+        int urlLength = 0;
+        int hostBegin = 0;
+        int hostEnd = 0;
+        const char *firstPartyHost = nullptr;
+        int firstPartyHostLength = 0;
+        ResourceType type = Other;
+        bool thirdParty = false;
+        const quint32 *tokens = nullptr;
+        int tokenCount = 0;
+    };
+
+    class HotTier;
+
+    struct Decision {
+        bool blocked = false;
+        int filter = -1;
+        // The $redirect or $redirect-rule filter naming a surrogate for a
+        // blocked request, or -1
+        int redirect = -1;
+        int exception = -1;
+        // The prefilter ruled out every indexed block rule
+        bool prefiltered = false;
+    };
+
+    // Sizing of the Bloom filter consulted before the rule index. A
+    // |maxBytes| of zero turns it off.
+    struct PrefilterOptions {
+        PrefilterOptions() : falsePositiveRate(0.01), maxBytes(1 << 20) {}
+        double falsePositiveRate;
+        qint64 maxBytes;
+    };
+
+    static QSharedPointer<const AdBlockEngine> compile(const QMap<QString, QStringList> &lists,
+                                                       const PrefilterOptions &prefilter = PrefilterOptions());
+
+    // Compiles the network rules in |added| into a small layer over
+    // |engine| and masks the base filters whose source line is in
+    // |removed|; the base tables are shared, not rebuilt. A previous layer
+    // is folded into the new one. Element hiding rules are cheap to build
+    // and are recompiled from |lists|, which must already include the change.
+    static QSharedPointer<const AdBlockEngine> compileDelta(const QSharedPointer<const AdBlockEngine> &engine,
+                                                            const QMap<QString, QStringList> &lists,
+                                                            const QStringList &added, const QStringList &removed,
+                                                            const PrefilterOptions &prefilter = PrefilterOptions());
+
+    // Maps a snapshot written by writeSnapshot(). Returns null when the file
+    // is missing, was built from different lists or by another version. A
+    // layer snapshot also needs the base it was compiled against at |basePath|.
+    static QSharedPointer<const AdBlockEngine> fromSnapshot(const QString &path, quint64 sourceStamp,
+                                                            const QString &basePath = QString());
+    // A layered engine writes only its layer
+    bool writeSnapshot(const QString &path, quint64 sourceStamp) const;
+    bool isMapped() const;
+
+    bool isLayered() const;
+    int layerFilterCount() const;
+
+    // Copies the block filters among |filters| into a hot tier for this
+    // engine. Exceptions and filters this engine masks are left out.
+    QSharedPointer<const HotTier> buildHotTier(const QVector<int> &filters) const;
+
+    // A |hot| tier built by this engine is searched first; the Bloom
+    // prefilter and the full index only see requests it does not block.
+    // Tiers of other engines are ignored.
+    Decision match(const Request &request, const HotTier *hot = nullptr) const;
+
+    int filterCount() const;
+    qint64 memoryUsage() const;
+    QString filterText(int filter) const;
+    // Name of the list |filter| was compiled from
+    QString filterList(int filter) const;
+    // Surrogate a $redirect or $redirect-rule filter answers blocked
+    // requests with, such as "noop.js"; empty for other filters
+    QByteArray redirectResource(int filter) const;
+
+    const CosmeticFilterIndex &cosmeticFilters() const;
+    const BloomFilter &prefilter() const;
+
+private:
+    enum FilterFlag : quint16 {
+        Exception = 1 << 0,
+        Important = 1 << 1,
+        MatchCase = 1 << 2,
+        AnchorStart = 1 << 3,
+        AnchorEnd = 1 << 4,
+        AnchorHost = 1 << 5,
+        Regex = 1 << 6,
+        FirstPartyOnly = 1 << 7,
+        ThirdPartyOnly = 1 << 8,
+        HostOnly = 1 << 9,
+        // $redirect blocks and names a surrogate; $redirect-rule only names
+        // one for requests other filters block
+        Redirect = 1 << 10,
+        RedirectRule = 1 << 11
+    };
+
+    enum Section : quint32 {
+        FilterSection = 1,
+        PatternSection,
+        DomainSection,
+        BlockIndexSection,
+        BlockTableSection,
+        BlockIdSection,
+        ExceptionIndexSection,
+        ExceptionTableSection,
+        ExceptionIdSection,
+        RegexOffsetSection,
+        RegexTextSection,
+        SourceOffsetSection,
+        SourceTextSection,
+        HostBlockNodeSection,
+        HostBlockLabelSection,
+        HostAllowNodeSection,
+        HostAllowLabelSection,
+        DomainNodeSection,
+        DomainLabelSection,
+        PrefilterInfoSection,
+        PrefilterBlockSection,
+        LayerInfoSection,
+        RemovedSection,
+        FilterListSection,
+        ListOffsetSection,
+        ListTextSection,
+        RedirectIndexSection,
+        RedirectTableSection,
+        RedirectIdSection,
+        RedirectFilterSection,
+        RedirectOffsetSection,
+        RedirectTextSection,
+        BlockAutomatonSection,
+        ExceptionAutomatonSection = BlockAutomatonSection + PatternAutomaton::SectionCount,
+        RedirectAutomatonSection = ExceptionAutomatonSection + PatternAutomaton::SectionCount,
+        CosmeticSection = RedirectAutomatonSection + PatternAutomaton::SectionCount
+    };
+
+    struct NetworkFilter {
+        quint32 patternOffset;
+        quint16 patternLength;
+        quint16 flags;
+        quint32 typeMask;
+        quint32 domainOffset;
+        quint16 includeDomainCount;
+        quint16 excludeDomainCount;
+        qint32 regex;
+    };
+
+    struct IndexSlot {
+        quint32 token;
+        quint32 begin;
+        quint32 count;
+    };
+
+    struct IndexInfo {
+        quint32 mask;
+        quint32 fallbackBegin;
+        quint32 fallbackCount;
+        quint32 reserved;
+    };
+
+    // Open-addressed token -> filter id table. Filters without a usable
+    // token live in the fallback range; the automaton picks the ones whose
+    // required literal occurs in the URL, so only those are checked.
+    struct TokenIndex {
+        const IndexSlot *table = nullptr;
+        quint32 tableSize = 0;
+        const quint32 *filterIds = nullptr;
+        quint32 idCount = 0;
+        quint32 mask = 0;
+        quint32 fallbackBegin = 0;
+        quint32 fallbackCount = 0;
+        PatternAutomaton fallback;
+
+        const IndexSlot *find(quint32 token) const;
+    };
+
+    // Sorted by filter id
+    struct RedirectEntry {
+        quint32 filter;
+        quint32 resource;
+    };
+
+    struct LayerInfo {
+        quint64 baseBuildId;
+        quint32 baseFilterCount;
+        quint32 reserved;
+    };
+
+    struct Source {
+        const QStringList *lines;
+        bool network;
+        bool cosmetic;
+        QString list;
+    };
+
+    struct CompileState {
+        QVector<NetworkFilter> filters;
+        QByteArray patterns;
+        QVector<quint32> domainIds;
+        QVector<QByteArray> regexSources;
+        QVector<QByteArray> sources;
+        QVector<quint16> filterLists;
+        QVector<QByteArray> listNames;
+        QVector<RedirectEntry> redirects;
+        QVector<QByteArray> redirectNames;
+        QHash<QByteArray, quint32> domainNames;
+        DomainTrie::Builder domains;
+        DomainTrie::Builder hostBlocks;
+        DomainTrie::Builder hostAllows;
+        CosmeticFilterIndex::Builder cosmetic;
+    };
+
+    // Per-request state shared by all filters of one engine checked for
+    // one request. |removed| masks filters of a base hidden by its layer,
+    // |promoted| the ones a hot tier has checked already.
+    struct MatchContext {
+        const Request &request;
+        const quint64 *removed;
+        const quint64 *promoted;
+        qint32 domainIds[16];
+        int domainIdCount;
+        bool domainsResolved;
+        bool hostMatch;
+    };
+
+    AdBlockEngine() = default;
+    Q_DISABLE_COPY(AdBlockEngine)
+
+    static QSharedPointer<const AdBlockEngine> build(const QVector<Source> &sources, const PrefilterOptions &prefilter,
+                                                     const QSharedPointer<const AdBlockEngine> &base,
+                                                     const QVector<quint64> &removed);
+    bool attach();
+    bool attachIndex(TokenIndex &index, quint32 infoSection, quint32 tableSection, quint32 idSection,
+                     quint32 automatonSection) const;
+    bool attachTrie(DomainTrie &trie, quint32 nodeSection, quint32 labelSection) const;
+    static quint32 layout();
+
+    // |redirect| receives the surrogate named by $redirect or $redirect-rule
+    static bool parseFilter(const QString &line, NetworkFilter &filter, QByteArray &pattern, QByteArray &redirect,
+                            CompileState &state);
+    // True for hosts-file lines; |host| is left empty for entries to skip
+    static bool parseHostsLine(const QString &line, QByteArray &host);
+    static bool isHostPattern(const NetworkFilter &filter, const QByteArray &pattern);
+    // Text every URL the filter matches must contain, lowercased; empty
+    // when there is none to rely on
+    static QByteArray requiredLiteral(const NetworkFilter &filter, const CompileState &state);
+    static void addTrie(AdBlockSnapshot::Builder &builder, quint32 nodeSection, quint32 labelSection, const DomainTrie::Builder &trie);
+
+    bool passesPrefilter(const Request &request, const quint32 *tokens, int tokenCount) const;
+    static quint64 tokenKey(quint32 token);
+    static quint64 hostKey(const char *host, int length);
+
+    int findBlock(MatchContext &context, const quint32 *tokens, int tokenCount, bool &prefiltered) const;
+    int findException(MatchContext &context, const quint32 *tokens, int tokenCount) const;
+    void resolveDomains(MatchContext &context) const;
+    int findMatch(const TokenIndex &index, const MatchContext &context, const quint32 *tokens, int tokenCount, bool stopAtImportant) const;
+    int findHostMatch(const DomainTrie &trie, const MatchContext &context) const;
+    int findHotMatch(const HotTier &hot, MatchContext *contexts, const quint32 *tokens, int tokenCount) const;
+    int findRedirect(MatchContext &context, const quint32 *tokens, int tokenCount) const;
+    static bool isRemoved(const MatchContext &context, quint32 filter)
+    {
+        return context.removed[filter / 64] & (Q_UINT64_C(1) << (filter % 64));
+    }
+    static bool isPromoted(const MatchContext &context, quint32 filter)
+    {
+        return context.promoted[filter / 64] & (Q_UINT64_C(1) << (filter % 64));
+    }
+    bool matchesFilter(const NetworkFilter &filter, const MatchContext &context) const;
+    // Filters copied into a hot tier read their pattern and domains from
+    // the tier's arrays
+    bool matchesFilter(const NetworkFilter &filter, const MatchContext &context, const char *patterns,
+                       const quint32 *domainIds) const;
+    bool matchesDomain(const NetworkFilter &filter, const MatchContext &context, const quint32 *domainIds) const;
+    bool matchesPattern(const NetworkFilter &filter, const Request &request, const char *patterns) const;
+
+    static bool globMatch(const char *pattern, int patternLength, const char *text, int textLength, bool anchorEnd);
+    static void buildIndex(AdBlockSnapshot::Builder &builder, quint32 infoSection, quint32 tableSection, quint32 idSection,
+                           const QVector<QPair<quint32, quint32>> &entries, const QVector<quint32> &fallback);
+
+    AdBlockSnapshot m_snapshot;
+    const NetworkFilter *m_filters = nullptr;
+    quint32 m_filterCount = 0;
+    const char *m_patterns = nullptr;
+    quint32 m_patternSize = 0;
+    const quint32 *m_domainIds = nullptr;
+    quint32 m_domainIdCount = 0;
+    const quint32 *m_sourceOffsets = nullptr;
+    quint32 m_sourceOffsetCount = 0;
+    const char *m_sourceText = nullptr;
+    quint32 m_sourceTextSize = 0;
+    const quint16 *m_filterLists = nullptr;
+    const quint32 *m_listOffsets = nullptr;
+    quint32 m_listOffsetCount = 0;
+    const char *m_listText = nullptr;
+    quint32 m_listTextSize = 0;
+    QVector<QRegularExpression> m_regexes;
+    TokenIndex m_blockIndex;
+    TokenIndex m_exceptionIndex;
+    // Every $redirect and $redirect-rule filter, consulted once a request
+    // is known to be blocked
+    TokenIndex m_redirectIndex;
+    const RedirectEntry *m_redirects = nullptr;
+    quint32 m_redirectCount = 0;
+    const quint32 *m_redirectOffsets = nullptr;
+    quint32 m_redirectOffsetCount = 0;
+    const char *m_redirectText = nullptr;
+    quint32 m_redirectTextSize = 0;
+    DomainTrie m_hostBlocks;
+    DomainTrie m_hostAllows;
+    DomainTrie m_domains;
+    CosmeticFilterIndex m_cosmetic;
+    BloomFilter m_prefilter;
+    QSharedPointer<const AdBlockEngine> m_base;
+    const quint64 *m_removed = nullptr;
+    quint32 m_removedWordCount = 0;
+};
+
+// The most frequently hit block filters of one engine, copied with their
+// patterns and domains into a few small heap arrays. Requests these
+// filters block are decided without touching the mapped index, so its
+// pages only stay resident for the rest of the traffic.
+class AdBlockEngine::HotTier
+{
+public:
+    int filterCount() const;
+    qint64 memoryUsage() const;
+
+private:
+    friend class AdBlockEngine;
+
+    struct Entry {
+        // Offsets point into the tier's arrays
+        NetworkFilter filter;
+        quint32 id;
+        // Index into the engines a match searches: the engine or its base
+        int engine;
+    };
+
+    struct HostEntry {
+        quint64 key;
+        quint32 entry;
+        bool operator<(const HostEntry &other) const { return key < other.key; }
+    };
+
+    const AdBlockEngine *m_engine = nullptr;
+    // Entries indexed by token come first, grouped by token, then the
+    // unindexed ones, then the plain hostname rules
+    QVector<Entry> m_entries;
+    QVector<IndexSlot> m_table;
+    quint32 m_mask = 0;
+    quint32 m_fallbackBegin = 0;
+    quint32 m_fallbackCount = 0;
+    QVector<HostEntry> m_hosts;
+    // Bit per filter id of each engine, set for the filters copied here
+    QVector<quint64> m_promoted[2];
+    QByteArray m_patterns;
+    QVector<quint32> m_domainIds;
+};
+
+#endif // ADBLOCKENGINE_H
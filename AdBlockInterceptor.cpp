@@ -0,0 +1,364 @@
+// AdBlockInterceptor.cpp
+
+#include "AdBlockInterceptor.h"
+#include "PublicSuffixList.h"
+#include "SurrogateSchemeHandler.h"
+#include <QDateTime>
+#include <QHostAddress>
+#include <QTimer>
+#include <QUrl>
+#include <QVarLengthArray>
+#include <QWebEngineUrlRequestInfo>
+
+namespace {
+
+AdBlockEngine::ResourceType resourceType(QWebEngineUrlRequestInfo::ResourceType type)
+{
+    switch (type) {
+        case QWebEngineUrlRequestInfo::ResourceTypeMainFrame: return AdBlockEngine::Document;
+        case QWebEngineUrlRequestInfo::ResourceTypeSubFrame: return AdBlockEngine::Subdocument;
+        case QWebEngineUrlRequestInfo::ResourceTypeStylesheet: return AdBlockEngine::Stylesheet;
+        case QWebEngineUrlRequestInfo::ResourceTypeScript: return AdBlockEngine::Script;
+        case QWebEngineUrlRequestInfo::ResourceTypeImage: return AdBlockEngine::Image;
+        case QWebEngineUrlRequestInfo::ResourceTypeFavicon: return AdBlockEngine::Image;
+        case QWebEngineUrlRequestInfo::ResourceTypeFontResource: return AdBlockEngine::Font;
+        case QWebEngineUrlRequestInfo::ResourceTypeObject: return AdBlockEngine::Object;
+        case QWebEngineUrlRequestInfo::ResourceTypePluginResource: return AdBlockEngine::Object;
+        case QWebEngineUrlRequestInfo::ResourceTypeMedia: return AdBlockEngine::Media;
+        case QWebEngineUrlRequestInfo::ResourceTypeXhr: return AdBlockEngine::XmlHttpRequest;
+        case QWebEngineUrlRequestInfo::ResourceTypePing: return AdBlockEngine::Ping;
+        case QWebEngineUrlRequestInfo::ResourceTypeCspReport: return AdBlockEngine::Ping;
+        default: return AdBlockEngine::Other;
+    }
+}
+
+// Two hosts are first-party when they share a registrable domain or
+// belong to the same organization
+bool isThirdParty(const char *host, int hostLength, const QByteArray &firstParty, const EntityMap *entities)
+{
+    if (firstParty.isEmpty()) {
+        return false;
+    }
+    if (entities) {
+        return !entities->isSameParty(host, hostLength, firstParty.constData(), firstParty.size());
+    }
+    return !PublicSuffixList::isSameSite(host, hostLength, firstParty.constData(), firstParty.size());
+}
+
+bool isScheme(const QByteArray &url, const UrlScanner::Parts &parts, const char *scheme)
+{
+    return parts.schemeEnd == int(qstrlen(scheme)) && qstrnicmp(url.constData(), scheme, uint(parts.schemeEnd)) == 0;
+}
+
+} // namespace
+
+AdBlockInterceptor::AdBlockInterceptor(QObject *parent)
+    : QWebEngineUrlRequestInterceptor(parent)
+    , m_ruleSet(new RuleSet)
+    , m_requestCount(0)
+    , m_prefilteredCount(0)
+    , m_upgradedCount(0)
+    , m_strippedCount(0)
+{
+}
+
+void AdBlockInterceptor::setEngine(const QSharedPointer<const AdBlockEngine> &engine)
+{
+    RuleSet *ruleSet = new RuleSet(*m_ruleSet.current());
+    ruleSet->engine = engine;
+    ruleSet->hotTier.reset();
+    publish(ruleSet);
+}
+
+QSharedPointer<const AdBlockEngine> AdBlockInterceptor::engine() const
+{
+    RcuPointer<RuleSet>::Reader ruleSet(m_ruleSet);
+    return ruleSet->engine;
+}
+
+void AdBlockInterceptor::setEnabled(bool enabled)
+{
+    RuleSet *ruleSet = new RuleSet(*m_ruleSet.current());
+    ruleSet->enabled = enabled;
+    publish(ruleSet);
+}
+
+void AdBlockInterceptor::setAllowedSites(const QSet<QByteArray> &sites)
+{
+    RuleSet *ruleSet = new RuleSet(*m_ruleSet.current());
+    ruleSet->allowedSites = sites;
+    publish(ruleSet);
+}
+
+void AdBlockInterceptor::setEntityMap(const QSharedPointer<const EntityMap> &entities)
+{
+    // Changes which requests count as third-party
+    RuleSet *ruleSet = new RuleSet(*m_ruleSet.current());
+    ruleSet->entities = entities;
+    publish(ruleSet);
+}
+
+void AdBlockInterceptor::setHotTier(const QSharedPointer<const AdBlockEngine::HotTier> &hotTier)
+{
+    // The engine only searches a tier it built itself
+    RuleSet *ruleSet = new RuleSet(*m_ruleSet.current());
+    ruleSet->hotTier = hotTier;
+    replace(ruleSet);
+}
+
+QSharedPointer<const AdBlockEngine::HotTier> AdBlockInterceptor::hotTier() const
+{
+    RcuPointer<RuleSet>::Reader ruleSet(m_ruleSet);
+    return ruleSet->hotTier;
+}
+
+void AdBlockInterceptor::setHttpsOnly(bool httpsOnly, const QSharedPointer<const HttpsUpgradeList> &knownHosts)
+{
+    RuleSet *ruleSet = new RuleSet(*m_ruleSet.current());
+    ruleSet->httpsOnly = httpsOnly;
+    ruleSet->httpsHosts = knownHosts;
+    replace(ruleSet);
+}
+
+void AdBlockInterceptor::setHttpsUpgradeFailures(const QHash<QByteArray, qint64> &failures)
+{
+    RuleSet *ruleSet = new RuleSet(*m_ruleSet.current());
+    ruleSet->httpsFailures = failures;
+    replace(ruleSet);
+}
+
+void AdBlockInterceptor::setRequestHeaders(const QSharedPointer<const RequestHeaderRules> &headers)
+{
+    RuleSet *ruleSet = new RuleSet(*m_ruleSet.current());
+    ruleSet->requestHeaders = headers && !headers->isEmpty() ? headers : QSharedPointer<const RequestHeaderRules>();
+    replace(ruleSet);
+}
+
+void AdBlockInterceptor::setQueryParameterFilter(const QSharedPointer<const QueryParameterFilter> &filter)
+{
+    RuleSet *ruleSet = new RuleSet(*m_ruleSet.current());
+    ruleSet->queryParameters = filter;
+    replace(ruleSet);
+}
+
+quint64 AdBlockInterceptor::generation() const
+{
+    RcuPointer<RuleSet>::Reader ruleSet(m_ruleSet);
+    return ruleSet->generation;
+}
+
+bool AdBlockInterceptor::isAllowedSite(const QSet<QByteArray> &sites, const QByteArray &host)
+{
+    if (sites.isEmpty()) {
+        return false;
+    }
+    for (int begin = 0; begin < host.size(); ++begin) {
+        if ((begin == 0 || host[begin - 1] == '.') && sites.contains(host.mid(begin))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AdBlockInterceptor::shouldUpgrade(const RuleSet &ruleSet, const QByteArray &host)
+{
+    if (!ruleSet.httpsOnly || host.isEmpty()) {
+        return false;
+    }
+    if (ruleSet.httpsHosts && ruleSet.httpsHosts->contains(host.constData(), host.size())) {
+        return true;
+    }
+    // Local names and addresses rarely have a certificate to offer
+    if (host == "localhost" || host.endsWith(".localhost") || host.endsWith(".local") || host.startsWith('[')
+        || !QHostAddress(QString::fromLatin1(host)).isNull()) {
+        return false;
+    }
+    const auto failure = ruleSet.httpsFailures.constFind(host);
+    return failure == ruleSet.httpsFailures.constEnd() || failure.value() <= QDateTime::currentMSecsSinceEpoch();
+}
+
+bool AdBlockInterceptor::upgradesToHttps(const QUrl &url) const
+{
+    if (url.scheme() != QLatin1String("http") || (url.port() != -1 && url.port() != 80)) {
+        return false;
+    }
+    RcuPointer<RuleSet>::Reader ruleSet(m_ruleSet);
+    return shouldUpgrade(*ruleSet, url.host(QUrl::FullyEncoded).toLatin1().toLower());
+}
+
+void AdBlockInterceptor::interceptRequest(QWebEngineUrlRequestInfo &info)
+{
+    // Pinned for the whole request, so a concurrent update cannot free it
+    RcuPointer<RuleSet>::Reader ruleSet(m_ruleSet);
+    const AdBlockEngine *engine = ruleSet->engine.data();
+    const bool blocking = ruleSet->enabled && engine;
+    const RequestHeaderRules *requestHeaders = ruleSet->requestHeaders.data();
+    const QueryParameterFilter *queryParameters = ruleSet->queryParameters.data();
+    if (!blocking && !ruleSet->httpsOnly && !requestHeaders && !queryParameters) {
+        return;
+    }
+
+    // Scheme and host come straight from the encoded bytes rather than
+    // from QUrl's per-component strings
+    const QByteArray encoded = info.requestUrl().toEncoded();
+    const UrlScanner::Parts parts = UrlScanner::parse(encoded.constData(), encoded.size());
+
+    // Tracking parameters and plain http are fixed with one redirect. The
+    // new request comes back through here and is checked against the
+    // rules then.
+    const bool http = isScheme(encoded, parts, "http");
+    if (http || isScheme(encoded, parts, "https")) {
+        QByteArray stripped;
+        const bool strip = queryParameters
+            && queryParameters->strip(encoded.constData(), encoded.size(), parts.hostBegin, parts.hostEnd, stripped);
+        bool upgrade = false;
+        if (http && ruleSet->httpsOnly) {
+            const int port = info.requestUrl().port();
+            const QByteArray host = encoded.mid(parts.hostBegin, parts.hostEnd - parts.hostBegin).toLower();
+            upgrade = (port == -1 || port == 80) && shouldUpgrade(*ruleSet, host);
+        }
+        if (strip || upgrade) {
+            QUrl url = strip ? QUrl::fromEncoded(stripped) : info.requestUrl();
+            if (strip) {
+                m_strippedCount.fetchAndAddRelaxed(1);
+            }
+            if (upgrade) {
+                url.setScheme(QStringLiteral("https"));
+                url.setPort(-1);
+                m_upgradedCount.fetchAndAddRelaxed(1);
+            }
+            info.redirect(url);
+            return;
+        }
+    }
+
+    const bool webSocket = isScheme(encoded, parts, "ws") || isScheme(encoded, parts, "wss");
+    if (!webSocket && !isScheme(encoded, parts, "http") && !isScheme(encoded, parts, "https")) {
+        return;
+    }
+    // Set before the decision; a blocked request never sends them
+    if (requestHeaders) {
+        const RequestHeaderRules::Headers &headers =
+            requestHeaders->headers(encoded.constData() + parts.hostBegin, parts.hostEnd - parts.hostBegin);
+        for (const QPair<QByteArray, QByteArray> &header : headers) {
+            info.setHttpHeader(header.first, header.second);
+        }
+    }
+    if (!blocking) {
+        return;
+    }
+
+    const QByteArray firstPartyHost = info.firstPartyUrl().host(QUrl::FullyEncoded).toLatin1();
+    if (isAllowedSite(ruleSet->allowedSites, firstPartyHost)) {
+        return;
+    }
+
+    const AdBlockEngine::ResourceType type = webSocket ? AdBlockEngine::WebSocket : resourceType(info.resourceType());
+
+    // Pages re-request the same resources; the request count orders the
+    // cache entries by last use
+    const quint32 tick = quint32(m_requestCount.fetchAndAddRelaxed(1));
+    const quint64 cacheKey = AdBlockDecisionCache::key(encoded.constData(), encoded.size(), firstPartyHost.constData(),
+                                                       firstPartyHost.size(), type);
+    bool blocked = false;
+    int filter = -1;
+    int redirect = -1;
+    if (!m_decisionCache.lookup(cacheKey, ruleSet->generation, tick, blocked, filter, redirect)) {
+        QVarLengthArray<char, 2048> lowered(encoded.size());
+        quint32 tokens[AdBlockEngine::MaxUrlTokens];
+        AdBlockEngine::Request request;
+        request.tokenCount = UrlScanner::lowerAndTokenize(encoded.constData(), encoded.size(), lowered.data(),
+                                                          tokens, AdBlockEngine::MaxUrlTokens);
+        request.tokens = tokens;
+        request.url = lowered.constData();
+        request.originalUrl = encoded.constData();
+        request.urlLength = encoded.size();
+        request.hostBegin = parts.hostBegin;
+        request.hostEnd = parts.hostEnd;
+        request.firstPartyHost = firstPartyHost.constData();
+        request.firstPartyHostLength = firstPartyHost.size();
+        request.type = type;
+        request.thirdParty = isThirdParty(request.url + request.hostBegin,
+                                          request.hostEnd - request.hostBegin, firstPartyHost,
+                                          ruleSet->entities.data());
+
+        const AdBlockEngine::Decision decision = engine->match(request, ruleSet->hotTier.data());
+        if (decision.prefiltered) {
+            m_prefilteredCount.fetchAndAddRelaxed(1);
+        }
+        blocked = decision.blocked;
+        filter = blocked ? decision.filter : -1;
+        redirect = blocked ? decision.redirect : -1;
+        m_decisionCache.insert(cacheKey, ruleSet->generation, tick, blocked, filter, redirect);
+    }
+    if (blocked) {
+        m_statistics.recordBlock(firstPartyHost.constData(), firstPartyHost.size(), ruleSet->generation, filter, type);
+        // Scripts and images pages rely on are swapped for harmless ones
+        const QUrl surrogate = SurrogateSchemeHandler::surrogateUrl(engine->redirectResource(redirect));
+        if (surrogate.isValid() && type != AdBlockEngine::Document && type != AdBlockEngine::WebSocket) {
+            info.redirect(surrogate);
+        } else {
+            info.block(true);
+        }
+    }
+}
+
+void AdBlockInterceptor::publish(RuleSet *ruleSet)
+{
+    ruleSet->generation = m_ruleSet.current()->generation + 1;
+    if (ruleSet->generation % AdBlockDecisionCache::GenerationCount == 0) {
+        m_decisionCache.clear();
+    }
+    m_statistics.addRuleSet(ruleSet->generation, ruleSet->engine);
+    replace(ruleSet);
+}
+
+void AdBlockInterceptor::replace(RuleSet *ruleSet)
+{
+    if (m_ruleSet.publish(ruleSet)) {
+        // No request can record a block under an older generation now
+        m_statistics.retireRuleSets(ruleSet->generation);
+    } else {
+        QTimer::singleShot(1000, this, &AdBlockInterceptor::reclaimRuleSets);
+    }
+}
+
+void AdBlockInterceptor::reclaimRuleSets()
+{
+    // A request still held the previous rule set; try again later
+    if (m_ruleSet.reclaim()) {
+        m_statistics.retireRuleSets(m_ruleSet.current()->generation);
+    } else {
+        QTimer::singleShot(1000, this, &AdBlockInterceptor::reclaimRuleSets);
+    }
+}
+
+quint64 AdBlockInterceptor::requestCount() const
+{
+    return m_requestCount.loadRelaxed();
+}
+
+quint64 AdBlockInterceptor::prefilteredCount() const
+{
+    return m_prefilteredCount.loadRelaxed();
+}
+
+quint64 AdBlockInterceptor::upgradedCount() const
+{
+    return m_upgradedCount.loadRelaxed();
+}
+
+quint64 AdBlockInterceptor::strippedCount() const
+{
+    return m_strippedCount.loadRelaxed();
+}
+
+const AdBlockDecisionCache &AdBlockInterceptor::decisionCache() const
+{
+    return m_decisionCache;
+}
+
+AdBlockStatistics &AdBlockInterceptor::statistics()
+{
+    return m_statistics;
+}
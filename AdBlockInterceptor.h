@@ -0,0 +1,107 @@
+// AdBlockInterceptor.h
+
+#ifndef ADBLOCKINTERCEPTOR_H
+#define ADBLOCKINTERCEPTOR_H
+
+#include <QWebEngineUrlRequestInterceptor>
+#include <QAtomicInteger>
+#include <QHash>
+#include <QSet>
+#include <QSharedPointer>
+
+#include "AdBlockDecisionCache.h"
+#include "AdBlockEngine.h"
+#include "AdBlockStatistics.h"
+#include "EntityMap.h"
+#include "HttpsUpgradeList.h"
+#include "QueryParameterFilter.h"
+#include "RcuPointer.h"
+#include "RequestHeaderRules.h"
+
+class AdBlockInterceptor : public QWebEngineUrlRequestInterceptor
+{
+    Q_OBJECT
+
+public:
+    // Everything the request path reads. Never modified once published;
+    // each change publishes a new copy with the next generation number.
+    // The objects it points to are const and never change after they are
+    // built, so WebEngine's IO thread reads all of it without locking.
+    struct RuleSet {
+        QSharedPointer<const AdBlockEngine> engine;
+        // Searched before the engine's own index; reset with the engine
+        QSharedPointer<const AdBlockEngine::HotTier> hotTier;
+        bool enabled = false;
+        // First-party hosts whose pages, subdomains included, see no blocking
+        QSet<QByteArray> allowedSites;
+        // Plain http requests are redirected to https, except to hosts in
+        // httpsFailures whose entry, in msecs since the epoch, has not expired
+        bool httpsOnly = false;
+        QSharedPointer<const HttpsUpgradeList> httpsHosts;
+        QHash<QByteArray, qint64> httpsFailures;
+        // Added to requests by destination host; null when there are none
+        QSharedPointer<const RequestHeaderRules> requestHeaders;
+        // Tracking parameters removed from request URLs; null when off
+        QSharedPointer<const QueryParameterFilter> queryParameters;
+        // Domains of one organization are first-party to each other; null
+        // until the map is loaded
+        QSharedPointer<const EntityMap> entities;
+        quint64 generation = 0;
+    };
+
+    explicit AdBlockInterceptor(QObject *parent = nullptr);
+
+    // Setters belong to the GUI thread; none of them blocks the IO thread
+    void setEngine(const QSharedPointer<const AdBlockEngine> &engine);
+    QSharedPointer<const AdBlockEngine> engine() const;
+    void setEnabled(bool enabled);
+    void setAllowedSites(const QSet<QByteArray> &sites);
+    void setEntityMap(const QSharedPointer<const EntityMap> &entities);
+    // Ignored unless |hotTier| was built by the current engine. Decisions
+    // do not change, so the rule set keeps its generation.
+    void setHotTier(const QSharedPointer<const AdBlockEngine::HotTier> &hotTier);
+    QSharedPointer<const AdBlockEngine::HotTier> hotTier() const;
+    // Upgrades never change a blocking decision, so neither of these
+    // starts a new generation
+    void setHttpsOnly(bool httpsOnly, const QSharedPointer<const HttpsUpgradeList> &knownHosts);
+    void setHttpsUpgradeFailures(const QHash<QByteArray, qint64> &failures);
+    // Nor do the headers sent with a request
+    void setRequestHeaders(const QSharedPointer<const RequestHeaderRules> &headers);
+    // Nor does stripping tracking parameters, which redirects the request
+    void setQueryParameterFilter(const QSharedPointer<const QueryParameterFilter> &filter);
+    quint64 generation() const;
+
+    static bool isAllowedSite(const QSet<QByteArray> &sites, const QByteArray &host);
+    // Whether an http request to |host| is sent over https instead
+    static bool shouldUpgrade(const RuleSet &ruleSet, const QByteArray &host);
+    // Whether a request for |url| would be redirected to https
+    bool upgradesToHttps(const QUrl &url) const;
+
+    // Called on WebEngine's IO thread for every request
+    void interceptRequest(QWebEngineUrlRequestInfo &info) override;
+
+    // Requests classified so far, and how many of them the prefilter
+    // settled without an index lookup
+    quint64 requestCount() const;
+    quint64 prefilteredCount() const;
+    quint64 upgradedCount() const;
+    quint64 strippedCount() const;
+    const AdBlockDecisionCache &decisionCache() const;
+    // Blocks by site, list and rule; merged and read on the GUI thread
+    AdBlockStatistics &statistics();
+
+private:
+    void publish(RuleSet *ruleSet);
+    void replace(RuleSet *ruleSet);
+    void reclaimRuleSets();
+
+    RcuPointer<RuleSet> m_ruleSet;
+    AdBlockDecisionCache m_decisionCache;
+    AdBlockStatistics m_statistics;
+    QAtomicInteger<quint64> m_requestCount;
+    QAtomicInteger<quint64> m_prefilteredCount;
+    QAtomicInteger<quint64> m_upgradedCount;
+    QAtomicInteger<quint64> m_strippedCount;
+};
+
+#endif // ADBLOCKINTERCEPTOR_H
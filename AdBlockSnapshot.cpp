@@ -0,0 +1,219 @@
+// AdBlockSnapshot.cpp
+
+#include "AdBlockSnapshot.h"
+#include <QFile>
+#include <QRandomGenerator>
+#include <QSaveFile>
+#include <cstring>
+
+namespace {
+
+const char Magic[8] = { 'C', 'B', 'A', 'D', 'S', 'N', 'A', 'P' };
+
+// Sections start on a cache line so blocked structures stay within one
+const qint64 SectionAlignment = 64;
+
+struct FileHeader {
+    char magic[8];
+    quint32 version;
+    quint32 layout;
+    quint64 sourceStamp;
+    quint64 buildId;
+    quint32 sectionCount;
+    quint32 reserved;
+};
+
+struct SectionEntry {
+    quint32 id;
+    quint32 reserved;
+    quint64 offset;
+    quint64 size;
+};
+
+qint64 alignUp(qint64 value)
+{
+    return (value + SectionAlignment - 1) & ~(SectionAlignment - 1);
+}
+
+} // namespace
+
+void AdBlockSnapshot::Builder::addSection(quint32 id, const void *data, qint64 size)
+{
+    m_sections.insert(id, QByteArray(static_cast<const char *>(data), int(size)));
+}
+
+void AdBlockSnapshot::Builder::addStringTable(quint32 offsetsId, quint32 textId, const QVector<QByteArray> &strings)
+{
+    QVector<quint32> offsets;
+    offsets.reserve(strings.size() + 1);
+    QByteArray text;
+    for (const QByteArray &string : strings) {
+        offsets.append(quint32(text.size()));
+        text.append(string);
+    }
+    offsets.append(quint32(text.size()));
+
+    addArray(offsetsId, offsets);
+    addSection(textId, text.constData(), text.size());
+}
+
+QByteArray AdBlockSnapshot::Builder::finish(quint32 layout) const
+{
+    FileHeader header;
+    memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.layout = layout;
+    header.sourceStamp = 0;
+    header.buildId = QRandomGenerator::global()->generate64();
+    header.sectionCount = quint32(m_sections.size());
+    header.reserved = 0;
+
+    QVector<SectionEntry> entries;
+    qint64 offset = alignUp(sizeof(FileHeader) + m_sections.size() * qint64(sizeof(SectionEntry)));
+    for (auto it = m_sections.constBegin(); it != m_sections.constEnd(); ++it) {
+        entries.append(SectionEntry{ it.key(), 0, quint64(offset), quint64(it.value().size()) });
+        offset = alignUp(offset + it.value().size());
+    }
+
+    QByteArray data(int(offset), '\0');
+    memcpy(data.data(), &header, sizeof(header));
+    memcpy(data.data() + sizeof(header), entries.constData(), entries.size() * sizeof(SectionEntry));
+    int i = 0;
+    for (auto it = m_sections.constBegin(); it != m_sections.constEnd(); ++it, ++i) {
+        memcpy(data.data() + entries[i].offset, it.value().constData(), size_t(it.value().size()));
+    }
+    return data;
+}
+
+AdBlockSnapshot::AdBlockSnapshot()
+    : m_base(nullptr)
+    , m_size(0)
+    , m_sourceStamp(0)
+    , m_buildId(0)
+{
+}
+
+AdBlockSnapshot::~AdBlockSnapshot()
+{
+    if (m_file) {
+        m_file->unmap(const_cast<uchar *>(m_base));
+    }
+}
+
+bool AdBlockSnapshot::open(const QString &path, quint32 layout)
+{
+    QScopedPointer<QFile> file(new QFile(path));
+    if (!file->open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    uchar *data = file->map(0, file->size());
+    if (!data) {
+        return false;
+    }
+    if (!attach(data, file->size(), layout)) {
+        file->unmap(data);
+        return false;
+    }
+
+    m_file.swap(file);
+    return true;
+}
+
+bool AdBlockSnapshot::load(const QByteArray &data, quint32 layout)
+{
+    // Keep the in-memory copy as aligned as a page-aligned mapping
+    m_data = QByteArray(data.size() + int(SectionAlignment) - 1, Qt::Uninitialized);
+    const quintptr address = reinterpret_cast<quintptr>(m_data.constData());
+    const int padding = int((SectionAlignment - qint64(address % SectionAlignment)) % SectionAlignment);
+    memcpy(m_data.data() + padding, data.constData(), size_t(data.size()));
+    return attach(reinterpret_cast<const uchar *>(m_data.constData()) + padding, data.size(), layout);
+}
+
+bool AdBlockSnapshot::save(const QString &path, quint64 sourceStamp) const
+{
+    if (!m_base) {
+        return false;
+    }
+
+    FileHeader header;
+    memcpy(&header, m_base, sizeof(header));
+    header.sourceStamp = sourceStamp;
+
+    // QSaveFile replaces the file atomically, so processes still mapping
+    // the previous snapshot keep a consistent view of it
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(m_base) + sizeof(header), m_size - qint64(sizeof(header)));
+    return file.commit();
+}
+
+bool AdBlockSnapshot::isMapped() const
+{
+    return !m_file.isNull();
+}
+
+quint64 AdBlockSnapshot::sourceStamp() const
+{
+    return m_sourceStamp;
+}
+
+quint64 AdBlockSnapshot::buildId() const
+{
+    return m_buildId;
+}
+
+qint64 AdBlockSnapshot::size() const
+{
+    return m_size;
+}
+
+const char *AdBlockSnapshot::section(quint32 id, qint64 *size) const
+{
+    const auto it = m_sections.find(id);
+    if (it == m_sections.constEnd()) {
+        *size = 0;
+        return nullptr;
+    }
+    *size = it.value().second;
+    return reinterpret_cast<const char *>(m_base) + it.value().first;
+}
+
+bool AdBlockSnapshot::attach(const uchar *data, qint64 size, quint32 layout)
+{
+    if (size < qint64(sizeof(FileHeader))) {
+        return false;
+    }
+
+    FileHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version || header.layout != layout) {
+        return false;
+    }
+
+    const qint64 tableEnd = sizeof(FileHeader) + qint64(header.sectionCount) * qint64(sizeof(SectionEntry));
+    if (tableEnd > size) {
+        return false;
+    }
+
+    QMap<quint32, QPair<qint64, qint64>> sections;
+    for (quint32 i = 0; i < header.sectionCount; ++i) {
+        SectionEntry entry;
+        memcpy(&entry, data + sizeof(FileHeader) + i * sizeof(SectionEntry), sizeof(entry));
+        if (entry.offset % SectionAlignment || entry.offset < quint64(tableEnd) || entry.offset > quint64(size)
+            || entry.size > quint64(size) - entry.offset) {
+            return false;
+        }
+        sections.insert(entry.id, qMakePair(qint64(entry.offset), qint64(entry.size)));
+    }
+
+    m_base = data;
+    m_size = size;
+    m_sourceStamp = header.sourceStamp;
+    m_buildId = header.buildId;
+    m_sections = sections;
+    return true;
+}
@@ -0,0 +1,84 @@
+// AdBlockSnapshot.h
+
+#ifndef ADBLOCKSNAPSHOT_H
+#define ADBLOCKSNAPSHOT_H
+
+#include <QByteArray>
+#include <QMap>
+#include <QPair>
+#include <QScopedPointer>
+#include <QString>
+#include <QVector>
+
+class QFile;
+
+// Versioned binary container for a compiled filter set. A snapshot is a
+// header followed by cache-line aligned sections of plain arrays, so it can be
+// mapped read-only and used in place; processes mapping the same file share
+// its physical pages.
+class AdBlockSnapshot
+{
+public:
+    static const quint32 Version = 3;
+
+    class Builder
+    {
+    public:
+        void addSection(quint32 id, const void *data, qint64 size);
+
+        template <typename T>
+        void addArray(quint32 id, const QVector<T> &values)
+        {
+            addSection(id, values.constData(), values.size() * qint64(sizeof(T)));
+        }
+
+        // Stores |strings| as an offset array (one entry per string plus a
+        // terminator) followed by their concatenated bytes
+        void addStringTable(quint32 offsetsId, quint32 textId, const QVector<QByteArray> &strings);
+
+        QByteArray finish(quint32 layout) const;
+
+    private:
+        QMap<quint32, QByteArray> m_sections;
+    };
+
+    AdBlockSnapshot();
+    ~AdBlockSnapshot();
+
+    // Both return false if the data is truncated, from another format
+    // version or built with a different record layout
+    bool open(const QString &path, quint32 layout);
+    bool load(const QByteArray &data, quint32 layout);
+
+    bool save(const QString &path, quint64 sourceStamp) const;
+
+    bool isMapped() const;
+    quint64 sourceStamp() const;
+    // Random id assigned by Builder::finish(); survives save() and open()
+    quint64 buildId() const;
+    qint64 size() const;
+
+    template <typename T>
+    const T *array(quint32 id, quint32 *count) const
+    {
+        qint64 bytes = 0;
+        const char *data = section(id, &bytes);
+        *count = quint32(bytes / qint64(sizeof(T)));
+        return reinterpret_cast<const T *>(data);
+    }
+
+    const char *section(quint32 id, qint64 *size) const;
+
+private:
+    bool attach(const uchar *data, qint64 size, quint32 layout);
+
+    QByteArray m_data;
+    QScopedPointer<QFile> m_file;
+    const uchar *m_base;
+    qint64 m_size;
+    quint64 m_sourceStamp;
+    quint64 m_buildId;
+    QMap<quint32, QPair<qint64, qint64>> m_sections;
+};
+
+#endif // ADBLOCKSNAPSHOT_H
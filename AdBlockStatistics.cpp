@@ -0,0 +1,376 @@
+// AdBlockStatistics.cpp
+
+#include "AdBlockStatistics.h"
+#include <QThread>
+#include <QPair>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace {
+
+const qint64 MsecsPerMinute = 60 * 1000;
+
+// A blocked response never arrives, so its size is a typical transfer size
+// for the resource type rather than a measurement
+quint64 typicalSize(AdBlockEngine::ResourceType type)
+{
+    switch (type) {
+        case AdBlockEngine::Document: return 32 * 1024;
+        case AdBlockEngine::Subdocument: return 48 * 1024;
+        case AdBlockEngine::Stylesheet: return 8 * 1024;
+        case AdBlockEngine::Script: return 24 * 1024;
+        case AdBlockEngine::Image: return 12 * 1024;
+        case AdBlockEngine::Font: return 20 * 1024;
+        case AdBlockEngine::Object: return 16 * 1024;
+        case AdBlockEngine::Media: return 128 * 1024;
+        case AdBlockEngine::XmlHttpRequest: return 2 * 1024;
+        case AdBlockEngine::Ping: return 256;
+        case AdBlockEngine::WebSocket: return 0;
+        default: return 4 * 1024;
+    }
+}
+
+quint64 siteKey(const char *site, int length)
+{
+    // FNV-1a; zero marks an empty slot
+    quint64 hash = Q_UINT64_C(0xcbf29ce484222325);
+    for (int i = 0; i < length; ++i) {
+        hash ^= quint8(site[i]);
+        hash *= Q_UINT64_C(0x100000001b3);
+    }
+    return hash | 1;
+}
+
+template <typename Key>
+void addCounts(QHash<Key, quint64> &counts, const QHash<Key, quint64> &delta)
+{
+    for (auto it = delta.constBegin(); it != delta.constEnd(); ++it) {
+        counts[it.key()] += it.value();
+    }
+}
+
+template <typename Key>
+void subtractCounts(QHash<Key, quint64> &counts, const QHash<Key, quint64> &delta)
+{
+    for (auto it = delta.constBegin(); it != delta.constEnd(); ++it) {
+        auto count = counts.find(it.key());
+        if (count == counts.end()) {
+            continue;
+        }
+        if (count.value() <= it.value()) {
+            counts.erase(count);
+        } else {
+            count.value() -= it.value();
+        }
+    }
+}
+
+} // namespace
+
+AdBlockStatistics::AdBlockStatistics()
+    : m_shardCount(0)
+    , m_overflowBlocked(0)
+    , m_overflowBytes(0)
+    , m_retiredBefore(0)
+    , m_buckets(DayMinutes)
+    , m_minute(-1)
+{
+}
+
+AdBlockStatistics::~AdBlockStatistics()
+{
+    for (QAtomicPointer<Shard> &shard : m_shards) {
+        delete shard.loadAcquire();
+    }
+}
+
+void AdBlockStatistics::recordBlock(const char *site, int siteLength, quint64 generation, int filter,
+                                    AdBlockEngine::ResourceType type)
+{
+    Shard *shard = this->shard();
+    if (!shard) {
+        m_overflowBlocked.fetchAndAddRelaxed(1);
+        m_overflowBytes.fetchAndAddRelaxed(typicalSize(type));
+        return;
+    }
+
+    // Announce the write before choosing a table; pairs with the fence in
+    // merge() so a flip and a write never miss each other
+    shard->busy.storeRelaxed(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    Table &table = shard->tables[shard->active.loadAcquire()];
+
+    ++table.blocked;
+    table.bytesAvoided += typicalSize(type);
+
+    // A full neighbourhood drops the site or rule, never the block itself
+    const quint64 key = siteKey(site, siteLength);
+    for (int probe = 0; probe < MaxProbes; ++probe) {
+        SiteSlot &slot = table.sites[(key + quint64(probe)) % SiteSlots];
+        if (slot.key == key) {
+            ++slot.count;
+            break;
+        }
+        if (!slot.key) {
+            const int length = qMin(siteLength, SiteNameLength - 1);
+            memcpy(slot.name, site, size_t(length));
+            slot.name[length] = '\0';
+            slot.key = key;
+            slot.count = 1;
+            break;
+        }
+    }
+
+    if (filter >= 0) {
+        const quint64 ruleKey = generation << 32 | quint32(filter + 1);
+        const quint64 hash = ruleKey * Q_UINT64_C(0x9e3779b97f4a7c15);
+        for (int probe = 0; probe < MaxProbes; ++probe) {
+            RuleSlot &slot = table.rules[((hash >> 32) + quint64(probe)) % RuleSlots];
+            if (slot.key == ruleKey) {
+                ++slot.count;
+                break;
+            }
+            if (!slot.key) {
+                slot.key = ruleKey;
+                slot.count = 1;
+                break;
+            }
+        }
+    }
+
+    shard->busy.storeRelease(0);
+}
+
+void AdBlockStatistics::addRuleSet(quint64 generation, const QSharedPointer<const AdBlockEngine> &engine)
+{
+    m_ruleSets.insert(generation, engine);
+}
+
+void AdBlockStatistics::retireRuleSets(quint64 generation)
+{
+    m_retiredBefore = qMax(m_retiredBefore, generation);
+}
+
+void AdBlockStatistics::merge(qint64 currentMsecsSinceEpoch)
+{
+    advance(currentMsecsSinceEpoch / MsecsPerMinute);
+    // Retired before the flips below, so all their blocks get drained
+    const quint64 retiredBefore = m_retiredBefore;
+    bool deferred = false;
+
+    Totals delta;
+    delta.blocked = m_overflowBlocked.fetchAndStoreRelaxed(0);
+    delta.bytesAvoided = m_overflowBytes.fetchAndStoreRelaxed(0);
+
+    const int shardCount = qMin(m_shardCount.loadAcquire(), int(MaxShards));
+    for (int i = 0; i < shardCount; ++i) {
+        Shard *shard = m_shards[i].loadAcquire();
+        if (!shard) {
+            continue;
+        }
+
+        // Point the writer at the other table, then wait out a write that
+        // may still be using the old one. If it takes too long the old
+        // table keeps its counts; the next flip makes it active again and
+        // the one after drains it.
+        const int drained = shard->active.loadRelaxed();
+        shard->active.storeRelease(1 - drained);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int waits = 0;
+        while (shard->busy.loadAcquire() && waits < MaxFlipWaits) {
+            QThread::yieldCurrentThread();
+            ++waits;
+        }
+        if (shard->busy.loadAcquire()) {
+            deferred = true;
+            continue;
+        }
+        drain(shard->tables[drained], delta);
+    }
+
+    add(m_buckets[int(m_minute % DayMinutes)].totals, delta);
+    add(m_lastHour, delta);
+    add(m_lastDay, delta);
+
+    // A deferred table may still hold ids of the retired rule sets
+    if (!deferred) {
+        dropRuleSets(retiredBefore);
+    }
+}
+
+const AdBlockStatistics::Totals &AdBlockStatistics::lastHour() const
+{
+    return m_lastHour;
+}
+
+const AdBlockStatistics::Totals &AdBlockStatistics::lastDay() const
+{
+    return m_lastDay;
+}
+
+QVector<int> AdBlockStatistics::hotFilters(const AdBlockEngine *engine, int limit)
+{
+    // Rule sets that only changed other settings share the engine and its ids
+    QHash<int, quint64> hits;
+    for (auto it = m_filterHits.begin(); it != m_filterHits.end();) {
+        const auto ruleSet = m_ruleSets.find(it.key() >> 32);
+        if (ruleSet == m_ruleSets.end()) {
+            it = m_filterHits.erase(it);
+            continue;
+        }
+        if (ruleSet.value().data() == engine) {
+            hits[int(quint32(it.key())) - 1] += it.value();
+        }
+        it.value() /= 2;
+        if (it.value()) {
+            ++it;
+        } else {
+            it = m_filterHits.erase(it);
+        }
+    }
+
+    QVector<QPair<quint64, int>> ranked;
+    ranked.reserve(hits.size());
+    for (auto it = hits.constBegin(); it != hits.constEnd(); ++it) {
+        ranked.append(qMakePair(it.value(), it.key()));
+    }
+    std::sort(ranked.begin(), ranked.end(), [](const QPair<quint64, int> &a, const QPair<quint64, int> &b) {
+        return a.first > b.first;
+    });
+
+    QVector<int> filters;
+    for (int i = 0; i < ranked.size() && i < limit; ++i) {
+        filters.append(ranked[i].second);
+    }
+    return filters;
+}
+
+AdBlockStatistics::Shard *AdBlockStatistics::shard()
+{
+    if (m_shardIndex.hasLocalData()) {
+        const int index = m_shardIndex.localData();
+        return index < MaxShards ? m_shards[index].loadRelaxed() : nullptr;
+    }
+
+    // First block on this thread. Shards outlive their threads; WebEngine
+    // keeps its IO thread for the life of the profile.
+    const int index = m_shardCount.fetchAndAddRelaxed(1);
+    m_shardIndex.setLocalData(index);
+    if (index >= MaxShards) {
+        return nullptr;
+    }
+    Shard *shard = new Shard();
+    m_shards[index].storeRelease(shard);
+    return shard;
+}
+
+void AdBlockStatistics::advance(qint64 minute)
+{
+    // First merge, or asleep for more than a day: everything has expired
+    if (m_minute < 0 || minute - m_minute >= DayMinutes) {
+        m_buckets.fill(Bucket());
+        m_lastHour = Totals();
+        m_lastDay = Totals();
+        m_minute = minute;
+        m_buckets[int(m_minute % DayMinutes)].minute = m_minute;
+        return;
+    }
+
+    // A clock moved backwards keeps counting into the current minute
+    while (m_minute < minute) {
+        ++m_minute;
+        const Bucket &hourOld = m_buckets[int((m_minute - HourMinutes) % DayMinutes)];
+        if (hourOld.minute == m_minute - HourMinutes) {
+            subtract(m_lastHour, hourOld.totals);
+        }
+        Bucket &bucket = m_buckets[int(m_minute % DayMinutes)];
+        if (bucket.minute == m_minute - DayMinutes) {
+            subtract(m_lastDay, bucket.totals);
+        }
+        bucket = Bucket();
+        bucket.minute = m_minute;
+    }
+}
+
+void AdBlockStatistics::drain(Table &table, Totals &totals)
+{
+    totals.blocked += table.blocked;
+    totals.bytesAvoided += table.bytesAvoided;
+
+    for (const SiteSlot &slot : table.sites) {
+        if (slot.key) {
+            totals.sites[QByteArray(slot.name)] += slot.count;
+        }
+    }
+
+    for (const RuleSlot &slot : table.rules) {
+        if (!slot.key) {
+            continue;
+        }
+        m_filterHits[slot.key] += slot.count;
+        const QSharedPointer<const AdBlockEngine> engine = m_ruleSets.value(slot.key >> 32);
+        if (!engine) {
+            continue;
+        }
+        const int filter = int(quint32(slot.key)) - 1;
+        totals.rules[engine->filterText(filter)] += slot.count;
+        totals.lists[engine->filterList(filter)] += slot.count;
+    }
+
+    // The writer sees the cleared table once the next flip publishes it
+    memset(&table, 0, sizeof(Table));
+}
+
+void AdBlockStatistics::dropRuleSets(quint64 before)
+{
+    const auto kept = m_ruleSets.lowerBound(before);
+    if (kept == m_ruleSets.begin()) {
+        return;
+    }
+
+    // Hits move to the newest kept rule set with the same engine, whose
+    // filter ids are the same, so the hot tier still counts them
+    QHash<quint64, quint64> moved;
+    for (auto it = m_filterHits.begin(); it != m_filterHits.end();) {
+        const quint64 generation = it.key() >> 32;
+        if (generation >= before) {
+            ++it;
+            continue;
+        }
+        const QSharedPointer<const AdBlockEngine> engine = m_ruleSets.value(generation);
+        quint64 successor = 0;
+        for (auto later = kept; later != m_ruleSets.end(); ++later) {
+            if (engine && later.value() == engine) {
+                successor = later.key();
+            }
+        }
+        if (successor) {
+            moved[successor << 32 | quint32(it.key())] += it.value();
+        }
+        it = m_filterHits.erase(it);
+    }
+    addCounts(m_filterHits, moved);
+
+    while (m_ruleSets.begin() != kept) {
+        m_ruleSets.erase(m_ruleSets.begin());
+    }
+}
+
+void AdBlockStatistics::add(Totals &totals, const Totals &delta)
+{
+    totals.blocked += delta.blocked;
+    totals.bytesAvoided += delta.bytesAvoided;
+    addCounts(totals.sites, delta.sites);
+    addCounts(totals.lists, delta.lists);
+    addCounts(totals.rules, delta.rules);
+}
+
+void AdBlockStatistics::subtract(Totals &totals, const Totals &delta)
+{
+    totals.blocked -= qMin(totals.blocked, delta.blocked);
+    totals.bytesAvoided -= qMin(totals.bytesAvoided, delta.bytesAvoided);
+    subtractCounts(totals.sites, delta.sites);
+    subtractCounts(totals.lists, delta.lists);
+    subtractCounts(totals.rules, delta.rules);
+}
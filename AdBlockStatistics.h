@@ -0,0 +1,126 @@
+// AdBlockStatistics.h
+
+#ifndef ADBLOCKSTATISTICS_H
+#define ADBLOCKSTATISTICS_H
+
+#include <QAtomicInteger>
+#include <QAtomicPointer>
+#include <QHash>
+#include <QMap>
+#include <QSharedPointer>
+#include <QThreadStorage>
+#include <QVector>
+
+#include "AdBlockEngine.h"
+
+// Blocked request counts by first-party site, filter list and rule, plus
+// an estimate of the bytes not downloaded. Interceptor threads record into
+// their own cache-line aligned shard without locks or allocation. The GUI
+// thread periodically merges the shards into per-minute buckets and keeps
+// running totals for the last hour and the last day, so reading them never
+// walks the buckets.
+class AdBlockStatistics
+{
+public:
+    struct Totals {
+        quint64 blocked = 0;
+        quint64 bytesAvoided = 0;
+        QHash<QByteArray, quint64> sites;
+        QHash<QString, quint64> lists;
+        QHash<QString, quint64> rules;
+    };
+
+    AdBlockStatistics();
+    ~AdBlockStatistics();
+
+    // Interceptor threads. |filter| is the engine's id for the blocking
+    // rule, valid for the rule set |generation|.
+    void recordBlock(const char *site, int siteLength, quint64 generation, int filter,
+                     AdBlockEngine::ResourceType type);
+
+    // GUI thread. Rule ids are resolved against the engine of the rule set
+    // that recorded them, so every published rule set is announced here.
+    void addRuleSet(quint64 generation, const QSharedPointer<const AdBlockEngine> &engine);
+    // No request holds a rule set older than |generation| any more. Their
+    // engines are released once the next merge has drained their blocks.
+    void retireRuleSets(quint64 generation);
+    void merge(qint64 currentMsecsSinceEpoch);
+
+    const Totals &lastHour() const;
+    const Totals &lastDay() const;
+
+    // Ids of the |engine|'s filters that blocked most since the previous
+    // call, at most |limit|, most hits first. Earlier periods count half as
+    // much each time, so the ranking follows what is browsed now.
+    QVector<int> hotFilters(const AdBlockEngine *engine, int limit);
+
+private:
+    static const int MaxShards = 32;
+    static const int SiteSlots = 512;
+    static const int RuleSlots = 1024;
+    static const int MaxProbes = 16;
+    static const int SiteNameLength = 48;
+    static const int HourMinutes = 60;
+    static const int DayMinutes = 24 * 60;
+    // A write takes well under a microsecond; a shard whose writer is
+    // still busy after this many yields is drained at the next merge
+    static const int MaxFlipWaits = 64;
+
+    struct SiteSlot {
+        quint64 key;
+        quint64 count;
+        char name[SiteNameLength];
+    };
+
+    struct RuleSlot {
+        quint64 key;
+        quint64 count;
+    };
+
+    struct Table {
+        quint64 blocked;
+        quint64 bytesAvoided;
+        SiteSlot sites[SiteSlots];
+        RuleSlot rules[RuleSlots];
+    };
+
+    // One writer thread fills the active table while the merger drains the
+    // other one; |busy| tells the merger when a flip has taken effect
+    struct alignas(64) Shard {
+        QAtomicInteger<int> busy;
+        QAtomicInteger<int> active;
+        Table tables[2];
+    };
+
+    struct Bucket {
+        qint64 minute = -1;
+        Totals totals;
+    };
+
+    Shard *shard();
+    void advance(qint64 minute);
+    void drain(Table &table, Totals &totals);
+    void dropRuleSets(quint64 before);
+    static void add(Totals &totals, const Totals &delta);
+    static void subtract(Totals &totals, const Totals &delta);
+
+    QAtomicPointer<Shard> m_shards[MaxShards];
+    QAtomicInteger<int> m_shardCount;
+    QThreadStorage<int> m_shardIndex;
+    // Blocks from threads beyond MaxShards only reach the totals
+    QAtomicInteger<quint64> m_overflowBlocked;
+    QAtomicInteger<quint64> m_overflowBytes;
+
+    QMap<quint64, QSharedPointer<const AdBlockEngine>> m_ruleSets;
+    quint64 m_retiredBefore;
+    // Blocks per rule, keyed like the rule slots
+    QHash<quint64, quint64> m_filterHits;
+    QVector<Bucket> m_buckets;
+    qint64 m_minute;
+    Totals m_lastHour;
+    Totals m_lastDay;
+
+    Q_DISABLE_COPY(AdBlockStatistics)
+};
+
+#endif // ADBLOCKSTATISTICS_H
@@ -0,0 +1,84 @@
+// BloomFilter.cpp
+
+#include "BloomFilter.h"
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+const int BlockBits = 512;
+const quint32 MaxHashCount = 16;
+
+} // namespace
+
+void BloomFilter::build(const QVector<quint64> &keys, double falsePositiveRate, qint64 maxBytes,
+                        Info &info, QVector<Block> &blocks)
+{
+    info = Info{ 0, 0, quint32(keys.size()), 0 };
+    blocks.clear();
+
+    const qint64 maxBlocks = qMin(maxBytes / qint64(sizeof(Block)), qint64(1) << 30);
+    if (maxBlocks <= 0) {
+        return;
+    }
+
+    // Optimal classic sizing plus a margin for the blocked layout
+    const double rate = qBound(1e-6, falsePositiveRate, 0.5);
+    const double ln2 = std::log(2.0);
+    const double bitsPerKey = -std::log(rate) / (ln2 * ln2) * 1.1;
+    const qint64 wanted = qint64(std::ceil(keys.size() * bitsPerKey / BlockBits));
+    info.blockCount = quint32(qBound(qint64(1), wanted, maxBlocks));
+    info.hashCount = quint32(qBound(1.0, std::round(bitsPerKey / 1.1 * ln2), double(MaxHashCount)));
+
+    blocks.resize(int(info.blockCount));
+    memset(blocks.data(), 0, size_t(blocks.size()) * sizeof(Block));
+    for (quint64 hash : keys) {
+        Block &block = blocks[int(((hash >> 32) * info.blockCount) >> 32)];
+        const quint64 bits = hash * Q_UINT64_C(0x9e3779b97f4a7c15);
+        const quint32 step = quint32(bits >> 32) | 1;
+        quint32 bit = quint32(bits);
+        for (quint32 i = 0; i < info.hashCount; ++i, bit += step) {
+            block.words[(bit >> 6) & 7] |= Q_UINT64_C(1) << (bit & 63);
+        }
+    }
+}
+
+BloomFilter::BloomFilter()
+    : m_blocks(nullptr)
+    , m_blockCount(0)
+    , m_hashCount(0)
+    , m_keyCount(0)
+{
+}
+
+bool BloomFilter::attach(const Info &info, const Block *blocks, quint32 blockCount)
+{
+    if (info.blockCount != blockCount || info.hashCount > MaxHashCount || (blockCount && !info.hashCount)) {
+        return false;
+    }
+    m_blocks = blocks;
+    m_blockCount = blockCount;
+    m_hashCount = info.hashCount;
+    m_keyCount = info.keyCount;
+    return true;
+}
+
+bool BloomFilter::isEnabled() const
+{
+    return m_blockCount > 0;
+}
+
+qint64 BloomFilter::size() const
+{
+    return qint64(m_blockCount) * qint64(sizeof(Block));
+}
+
+double BloomFilter::falsePositiveRate() const
+{
+    if (!m_blockCount) {
+        return 1.0;
+    }
+    // Classic estimate; blocking adds a little on top
+    const double load = double(m_hashCount) * m_keyCount / (double(m_blockCount) * BlockBits);
+    return std::pow(1.0 - std::exp(-load), double(m_hashCount));
+}
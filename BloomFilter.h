@@ -0,0 +1,62 @@
+// BloomFilter.h
+
+#ifndef BLOOMFILTER_H
+#define BLOOMFILTER_H
+
+#include <QVector>
+
+// Cache-line blocked Bloom filter. Every key picks one 64-byte block and
+// sets all of its bits inside it, so a lookup costs one cache miss at the
+// price of a slightly higher false-positive rate than a classic filter.
+// Keys are 64-bit hashes supplied by the caller.
+class BloomFilter
+{
+public:
+    struct Block {
+        quint64 words[8];
+    };
+
+    struct Info {
+        quint32 blockCount;
+        quint32 hashCount;
+        quint32 keyCount;
+        quint32 reserved;
+    };
+
+    // Sizes the filter for |falsePositiveRate|, shrinking it to fit
+    // |maxBytes|. A |maxBytes| below one block yields no blocks, which
+    // disables the filter.
+    static void build(const QVector<quint64> &keys, double falsePositiveRate, qint64 maxBytes,
+                      Info &info, QVector<Block> &blocks);
+
+    BloomFilter();
+
+    bool attach(const Info &info, const Block *blocks, quint32 blockCount);
+
+    bool isEnabled() const;
+    qint64 size() const;
+    double falsePositiveRate() const;
+
+    // False means the key was certainly never inserted
+    bool mayContain(quint64 hash) const
+    {
+        const Block &block = m_blocks[((hash >> 32) * m_blockCount) >> 32];
+        const quint64 bits = hash * Q_UINT64_C(0x9e3779b97f4a7c15);
+        const quint32 step = quint32(bits >> 32) | 1;
+        quint32 bit = quint32(bits);
+        for (quint32 i = 0; i < m_hashCount; ++i, bit += step) {
+            if (!(block.words[(bit >> 6) & 7] & (Q_UINT64_C(1) << (bit & 63)))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    const Block *m_blocks;
+    quint32 m_blockCount;
+    quint32 m_hashCount;
+    quint32 m_keyCount;
+};
+
+#endif // BLOOMFILTER_H
@@ -1,13 +1,17 @@
 // Browser.cpp
 
 #include "Browser.h"
+#include "PrivateWindow.h"
+#include "UrlScanner.h"
 #include <QApplication>
+#include <QDateTime>
 #include <QDesktopServices>
 #include <QFileDialog>
 #include <QInputDialog>
 #include <QMessageBox>
 #include <QPrinter>
 #include <QPrintDialog>
+#include <QSet>
 #include <QSettings>
 #include <QShortcut>
 #include <QStyle>
@@ -15,6 +19,15 @@
 #include <QWebEngineHistory>
 #include <QWebEngineSettings>
 
+namespace {
+
+bool inRange(const QDateTime &time, const QDateTime &from, const QDateTime &to)
+{
+    return (!from.isValid() || time >= from) && (!to.isValid() || time <= to);
+}
+
+} // namespace
+
 Browser::Browser(QWidget *parent)
     : QMainWindow(parent)
     , m_webView(new QWebEngineView(this))
@@ -22,8 +35,8 @@ Browser::Browser(QWidget *parent)
     , m_urlBar(new QLineEdit(this))
     , m_progressBar(new QProgressBar(this))
     , m_profile(new QWebEngineProfile(this))
-    , m_privateProfile(new QWebEngineProfile(this))
-    , m_privacyManager(new PrivacyManager(this))
+    , m_privateProfile(new PrivateProfile(this))
+    , m_privacyManager(new PrivacyManager(m_webView, m_profile, this))
     , m_customizationEngine(new CustomizationEngine(this))
     , m_networkManager(new QNetworkAccessManager(this))
     , m_isPrivateBrowsing(false)
@@ -41,8 +54,6 @@ Browser::Browser(QWidget *parent)
 
     loadSettings();
 
-    m_privateProfile->setOffTheRecord(true);
-
     newTab();
 }
 
@@ -65,16 +76,20 @@ void Browser::setStartupUrl(const QUrl &url)
 
 void Browser::enablePrivateBrowsing(bool enable)
 {
+    if (enable == m_isPrivateBrowsing) {
+        return;
+    }
     m_isPrivateBrowsing = enable;
-    QWebEngineProfile *profile = enable ? m_privateProfile : m_profile;
 
-    for (int i = 0; i < m_tabWidget->count(); ++i) {
-        QWebEngineView *view = qobject_cast<QWebEngineView*>(m_tabWidget->widget(i));
-        if (view) {
-            WebPage *page = qobject_cast<WebPage*>(view->page());
-            if (page) {
-                page->setProfile(profile);
-            }
+    // A page keeps the profile it was created with, so private pages are
+    // never carried into the normal profile or the other way round
+    const int previousTabs = m_tabWidget->count();
+    if (previousTabs > 0) {
+        newTab();
+        for (int i = 0; i < previousTabs; ++i) {
+            QWidget *widget = m_tabWidget->widget(0);
+            m_tabWidget->removeTab(0);
+            delete widget;
         }
     }
 
@@ -84,7 +99,11 @@ void Browser::enablePrivateBrowsing(bool enable)
 void Browser::newTab(const QUrl &url)
 {
     QWebEngineView *webView = new QWebEngineView(this);
-    WebPage *page = new WebPage(m_isPrivateBrowsing ? m_privateProfile : m_profile, webView);
+    WebPage *page = new WebPage(m_isPrivateBrowsing ? m_privateProfile->profile() : m_profile, webView);
+    if (m_isPrivateBrowsing) {
+        m_privateProfile->addPage(page);
+    }
+    page->setPrivacyManager(m_privacyManager);
     webView->setPage(page);
 
     int index = m_tabWidget->addTab(webView, tr("New Tab"));
@@ -110,6 +129,16 @@ void Browser::newTab(const QUrl &url)
     }
 }
 
+void Browser::newPrivateWindow(const QUrl &url)
+{
+    // Children of this window, whose PrivacyManager they use, so none of
+    // them outlives it
+    PrivateWindow *window = new PrivateWindow(m_privateProfile, m_privacyManager, m_startupUrl, this);
+    window->setAttribute(Qt::WA_DeleteOnClose);
+    window->newTab(url);
+    window->show();
+}
+
 void Browser::closeTab(int index)
 {
     if (m_tabWidget->count() > 1) {
@@ -117,6 +146,13 @@ void Browser::closeTab(int index)
         m_tabWidget->removeTab(index);
         delete widget;
     } else {
+        // Closing may only hide the window; the last private tab still
+        // ends the session right away
+        if (m_isPrivateBrowsing) {
+            QWidget *widget = m_tabWidget->widget(index);
+            m_tabWidget->removeTab(index);
+            delete widget;
+        }
         close();
     }
 }
@@ -253,11 +289,74 @@ void Browser::showHistory()
 void Browser::clearHistory()
 {
     m_historyModel->clear();
+    m_historyRows.clear();
     if (currentWebView()) {
         currentWebView()->history()->clear();
     }
 }
 
+void Browser::removeHistory(const QVector<QUrl> &origins, const QDateTime &from, const QDateTime &to)
+{
+    if (origins.isEmpty() && !from.isValid() && !to.isValid()) {
+        clearHistory();
+        return;
+    }
+
+    QSet<QString> removed;
+    for (const QUrl &origin : origins) {
+        removed.insert(BrowsingDataCleaner::originString(origin));
+    }
+    for (int row = m_historyModel->rowCount() - 1; row >= 0; --row) {
+        const QStandardItem *item = m_historyModel->item(row);
+        if (!inRange(item->data(Qt::UserRole + 2).toDateTime(), from, to)) {
+            continue;
+        }
+        if (!removed.isEmpty() && !removed.contains(BrowsingDataCleaner::originString(item->data(Qt::UserRole).toUrl()))) {
+            continue;
+        }
+        m_historyRows.remove(item->data(Qt::UserRole + 1).toULongLong());
+        m_historyModel->removeRow(row);
+    }
+}
+
+void Browser::clearBrowsingData(const QDateTime &from, const QDateTime &to)
+{
+    if (!from.isValid() && !to.isValid()) {
+        // Storage of origins visited with a port or on a subdomain is only
+        // found through history
+        m_privacyManager->clearBrowsingData(historyOrigins(from, to));
+        return;
+    }
+
+    // Cookies and storage carry no dates; take the origins visited instead
+    BrowsingDataCleaner::Request request;
+    request.from = from;
+    request.to = to;
+    request.origins = historyOrigins(from, to);
+    // No origins would mean all of them
+    if (request.origins.isEmpty()) {
+        request.types = BrowsingDataCleaner::History;
+    }
+    m_privacyManager->clearBrowsingData(request);
+}
+
+QVector<QUrl> Browser::historyOrigins(const QDateTime &from, const QDateTime &to) const
+{
+    QVector<QUrl> origins;
+    QSet<QString> seen;
+    for (int row = 0; row < m_historyModel->rowCount(); ++row) {
+        const QStandardItem *item = m_historyModel->item(row);
+        const QUrl url = item->data(Qt::UserRole).toUrl();
+        const QString origin = BrowsingDataCleaner::originString(url);
+        if ((url.scheme() == QLatin1String("http") || url.scheme() == QLatin1String("https"))
+            && inRange(item->data(Qt::UserRole + 2).toDateTime(), from, to) && !seen.contains(origin)) {
+            seen.insert(origin);
+            origins.append(QUrl(origin));
+        }
+    }
+    return origins;
+}
+
 void Browser::showDownloads()
 {
     m_downloadsDock->show();
@@ -492,6 +591,7 @@ void Browser::createActions()
     m_homeAction = new QAction(style()->standardIcon(QStyle::SP_DirHomeIcon), tr("Home"), this);
 
     m_newTabAction = new QAction(tr("New Tab"), this);
+    m_newPrivateWindowAction = new QAction(tr("New Private Window"), this);
     m_closeTabAction = new QAction(tr("Close Tab"), this);
     m_nextTabAction = new QAction(tr("Next Tab"), this);
     m_previousTabAction = new QAction(tr("Previous Tab"), this);
@@ -526,6 +626,7 @@ void Browser::createMenus()
 {
     QMenu *fileMenu = menuBar()->addMenu(tr("&File"));
     fileMenu->addAction(m_newTabAction);
+    fileMenu->addAction(m_newPrivateWindowAction);
     fileMenu->addAction(m_closeTabAction);
     fileMenu->addSeparator();
     fileMenu->addAction(m_printAction);
@@ -616,6 +717,21 @@ void Browser::setupConnections()
         loadUrl(QUrl::fromUserInput(m_urlBar->text()));
     });
 
+    connect(m_customizationEngine, &CustomizationEngine::doNotTrackChanged,
+            m_privacyManager, &PrivacyManager::setDoNotTrack);
+    connect(m_privacyManager, &PrivacyManager::historyRemovalRequested, this, &Browser::removeHistory);
+    connect(m_privacyManager, &PrivacyManager::browsingDataClearProgress, this, [this](int done, int total) {
+        statusBar()->showMessage(tr("Clearing browsing data: %1 of %2").arg(done).arg(total));
+    });
+    connect(m_privacyManager, &PrivacyManager::browsingDataCleared, this, [this](const QStringList &errors) {
+        statusBar()->showMessage(errors.isEmpty() ? tr("Browsing data cleared")
+                                                  : tr("Browsing data cleared; %n step(s) failed", nullptr, errors.size()), 5000);
+    });
+    connect(m_customizationEngine, &CustomizationEngine::thirdPartyCookiesPolicyChanged,
+            m_privacyManager, &PrivacyManager::setThirdPartyCookiesPolicy);
+    // The normal profile is set up by the PrivacyManager itself
+    connect(m_privateProfile, &PrivateProfile::profileCreated, m_privacyManager, &PrivacyManager::protectProfile);
+
     connect(m_tabWidget, &QTabWidget::currentChanged, this, &Browser::handleTabChanged);
     connect(m_tabWidget, &QTabWidget::tabCloseRequested, this, &Browser::handleTabCloseRequested);
 
@@ -626,6 +742,9 @@ void Browser::setupConnections()
     connect(m_homeAction, &QAction::triggered, this, &Browser::navigateHome);
 
     connect(m_newTabAction, &QAction::triggered, this, &Browser::newTab);
+    connect(m_newPrivateWindowAction, &QAction::triggered, this, [this]() {
+        newPrivateWindow();
+    });
     connect(m_closeTabAction, &QAction::triggered, this, &Browser::closeCurrentTab);
     connect(m_nextTabAction, &QAction::triggered, this, &Browser::nextTab);
     connect(m_previousTabAction, &QAction::triggered, this, &Browser::previousTab);
@@ -666,6 +785,11 @@ void Browser::setupShortcuts()
     QShortcut *newTabShortcut = new QShortcut(QKeySequence::AddTab, this);
     connect(newTabShortcut, &QShortcut::activated, this, &Browser::newTab);
 
+    QShortcut *privateWindowShortcut = new QShortcut(QKeySequence(Qt::CTRL | Qt::SHIFT | Qt::Key_N), this);
+    connect(privateWindowShortcut, &QShortcut::activated, this, [this]() {
+        newPrivateWindow();
+    });
+
     QShortcut *closeTabShortcut = new QShortcut(QKeySequence::Close, this);
     connect(closeTabShortcut, &QShortcut::activated, this, &Browser::closeCurrentTab);
 
@@ -700,7 +824,10 @@ void Browser::loadSettings()
     restoreGeometry(settings.value("window/geometry").toByteArray());
     restoreState(settings.value("window/state").toByteArray());
 
-    // Load privacy settings
+    // Load privacy settings. The in-memory cache cap bounds how much a
+    // long private session, such as a kiosk shift, can accumulate.
+    m_privateProfile->setHttpCacheMaximumSize(
+        settings.value("privacy/private_http_cache_size", PrivateProfile::DefaultHttpCacheMaximumSize).toInt());
     bool privateMode = settings.value("privacy/private_mode", false).toBool();
     enablePrivateBrowsing(privateMode);
 
@@ -734,6 +861,7 @@ void Browser::saveSettings()
 
     // Save privacy settings
     settings.setValue("privacy/private_mode", m_isPrivateBrowsing);
+    settings.setValue("privacy/private_http_cache_size", m_privateProfile->httpCacheMaximumSize());
 
     // Save customization settings
     settings.setValue("customization/theme", m_customizationEngine->currentTheme());
@@ -786,13 +914,26 @@ WebPage *Browser::currentPage() const
 
 void Browser::addToHistory(const QUrl &url, const QString &title)
 {
+    // URLs differing only in the case of scheme or host are one entry
+    const QByteArray encoded = url.toEncoded();
+    const quint64 key = UrlScanner::normalizedKey(encoded.constData(), encoded.size());
+    const QPersistentModelIndex previous = m_historyRows.take(key);
+    if (previous.isValid()) {
+        m_historyModel->removeRow(previous.row());
+    }
+
     QStandardItem *item = new QStandardItem(title.isEmpty() ? url.toString() : title);
     item->setData(url, Qt::UserRole);
+    item->setData(QVariant::fromValue(key), Qt::UserRole + 1);
+    item->setData(QDateTime::currentDateTime(), Qt::UserRole + 2);
     m_historyModel->insertRow(0, item);
+    m_historyRows.insert(key, QPersistentModelIndex(item->index()));
 
     // Limit history size (e.g., to 1000 items)
     while (m_historyModel->rowCount() > 1000) {
-        m_historyModel->removeRow(m_historyModel->rowCount() - 1);
+        const int last = m_historyModel->rowCount() - 1;
+        m_historyRows.remove(m_historyModel->item(last)->data(Qt::UserRole + 1).toULongLong());
+        m_historyModel->removeRow(last);
     }
 }
 
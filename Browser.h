@@ -14,6 +14,8 @@
 #include <QToolBar>
 #include <QDockWidget>
 #include <QStandardItemModel>
+#include <QHash>
+#include <QPersistentModelIndex>
 #include <QListView>
 #include <QTreeView>
 #include <QStackedWidget>
@@ -25,6 +27,7 @@
 
 #include "WebPage.h"
 #include "PrivacyManager.h"
+#include "PrivateProfile.h"
 #include "CustomizationEngine.h"
 #include "DeveloperTools.h"
 #include "MediaController.h"
@@ -40,10 +43,15 @@ public:
 
     void loadUrl(const QUrl &url);
     void setStartupUrl(const QUrl &url);
+    // Switches the tabs of this window between the normal and the private
+    // profile; open tabs are replaced by a start page in the new mode
     void enablePrivateBrowsing(bool enable);
 
 public slots:
     void newTab(const QUrl &url = QUrl());
+    // A window whose tabs are all private, sharing this window's session
+    // and protections
+    void newPrivateWindow(const QUrl &url = QUrl());
     void closeTab(int index);
     void closeCurrentTab();
     void nextTab();
@@ -68,6 +76,12 @@ public slots:
     void addBookmark();
     void showHistory();
     void clearHistory();
+    // History entries of |origins|, or of every origin when empty, visited
+    // between |from| and |to|; invalid ends are open
+    void removeHistory(const QVector<QUrl> &origins, const QDateTime &from, const QDateTime &to);
+    // Clears history in the range, and the cookies and storage of the
+    // origins visited in it; everything when both ends are invalid
+    void clearBrowsingData(const QDateTime &from, const QDateTime &to);
 
     void showDownloads();
     void clearDownloads();
@@ -119,6 +133,8 @@ private:
 
     void updateWindowTitle();
     void updateNavigationActions();
+    // http and https origins in history visited between |from| and |to|
+    QVector<QUrl> historyOrigins(const QDateTime &from, const QDateTime &to) const;
 
     QWebEngineView *currentWebView() const;
     WebPage *currentPage() const;
@@ -135,6 +151,8 @@ private:
     QDockWidget *m_historyDock;
     QTreeView *m_historyView;
     QStandardItemModel *m_historyModel;
+    // Normalized URL key -> history row, so revisits move the existing row
+    QHash<quint64, QPersistentModelIndex> m_historyRows;
 
     QDockWidget *m_downloadsDock;
     QListView *m_downloadsView;
@@ -144,7 +162,8 @@ private:
     DeveloperTools *m_developerTools;
 
     QWebEngineProfile *m_profile;
-    QWebEngineProfile *m_privateProfile;
+    // Shared with this window's private windows
+    PrivateProfile *m_privateProfile;
 
     PrivacyManager *m_privacyManager;
     CustomizationEngine *m_customizationEngine;
@@ -160,6 +179,7 @@ private:
     QAction *m_homeAction;
 
     QAction *m_newTabAction;
+    QAction *m_newPrivateWindowAction;
     QAction *m_closeTabAction;
     QAction *m_nextTabAction;
     QAction *m_previousTabAction;
@@ -0,0 +1,182 @@
+// BrowsingDataCleaner.cpp
+
+#include "BrowsingDataCleaner.h"
+#include "CookieIndex.h"
+#include "DevToolsProtocol.h"
+#include <QJsonObject>
+#include <QNetworkCookie>
+#include <QSet>
+#include <QTimer>
+#include <QWebEngineCookieStore>
+#include <QWebEngineProfile>
+
+namespace {
+
+// Cookies and HTTP cache go through QtWebEngine, not the protocol
+const char StorageTypes[] = "appcache,file_systems,indexeddb,local_storage,shader_cache,websql,service_workers,cache_storage";
+
+bool isSubdomain(const QByteArray &name, const QByteArray &parent)
+{
+    return name.size() > parent.size() && name.endsWith(parent) && name.at(name.size() - parent.size() - 1) == '.';
+}
+
+// The cookie is sent to |host|, or belongs to one of its subdomains
+bool belongsTo(QByteArray domain, const QByteArray &host)
+{
+    const bool domainCookie = domain.startsWith('.');
+    if (domainCookie) {
+        domain.remove(0, 1);
+    }
+    return domain == host || (domainCookie && isSubdomain(host, domain)) || isSubdomain(domain, host);
+}
+
+} // namespace
+
+BrowsingDataCleaner::BrowsingDataCleaner(QWebEngineProfile *profile, const CookieIndex *cookieIndex,
+                                         DevToolsProtocol *devTools, QObject *parent)
+    : QObject(parent)
+    , m_profile(profile)
+    , m_cookieIndex(cookieIndex)
+    , m_devTools(devTools)
+    , m_done(0)
+{
+}
+
+bool BrowsingDataCleaner::isRunning() const
+{
+    return !m_steps.isEmpty();
+}
+
+bool BrowsingDataCleaner::start(const Request &request)
+{
+    if (isRunning()) {
+        return false;
+    }
+    m_done = 0;
+    m_errors.clear();
+    const bool everyOrigin = request.origins.isEmpty();
+
+    if (request.types & Cookies) {
+        if (everyOrigin) {
+            m_steps.append([this]() {
+                m_profile->cookieStore()->deleteAllCookies();
+                stepDone();
+            });
+        }
+        for (const QUrl &origin : request.origins) {
+            m_steps.append([this, origin]() { clearCookies(origin); });
+        }
+    }
+
+    if ((request.types & Storage) && !DevToolsProtocol::port()) {
+        m_steps.append([this]() { stepDone(tr("Site storage not cleared: remote debugging is off")); });
+    } else if (request.types & Storage) {
+        // The protocol clears one origin at a time; for all of them take
+        // the known origins and the sites that hold cookies, over both
+        // schemes
+        QVector<QUrl> origins = request.origins;
+        if (everyOrigin) {
+            origins = request.knownOrigins;
+            for (const QByteArray &site : m_cookieIndex->sites()) {
+                origins.append(QUrl(QStringLiteral("https://") + QString::fromUtf8(site)));
+                origins.append(QUrl(QStringLiteral("http://") + QString::fromUtf8(site)));
+            }
+        }
+        QSet<QString> seen;
+        for (const QUrl &origin : origins) {
+            if (!seen.contains(originString(origin))) {
+                seen.insert(originString(origin));
+                m_steps.append([this, origin]() { clearStorage(origin); });
+            }
+        }
+    }
+
+    if (request.types & History) {
+        m_steps.append([this, request]() {
+            emit historyRemovalRequested(request.origins, request.from, request.to);
+            stepDone();
+        });
+    }
+
+    // A targeted clear leaves the cache warm for every other site
+    if ((request.types & Cache) && everyOrigin) {
+        m_steps.append([this]() {
+            m_profile->clearHttpCache();
+            stepDone();
+        });
+    }
+
+    if (m_steps.isEmpty()) {
+        QTimer::singleShot(0, this, [this]() { emit finished(QStringList()); });
+        return true;
+    }
+    emit progress(0, m_steps.size());
+    QTimer::singleShot(0, this, &BrowsingDataCleaner::runNext);
+    return true;
+}
+
+void BrowsingDataCleaner::requestStorageUsage(const QUrl &origin)
+{
+    QJsonObject params;
+    params["origin"] = originString(origin);
+    m_devTools->call(QStringLiteral("Storage.getUsageAndQuota"), params, [this, origin](const QJsonObject &result, const QString &error) {
+        if (!error.isEmpty()) {
+            emit storageUsageAvailable(origin, -1, -1);
+            return;
+        }
+        emit storageUsageAvailable(origin, qint64(result["usage"].toDouble()), qint64(result["quota"].toDouble()));
+    });
+}
+
+QString BrowsingDataCleaner::originString(const QUrl &url)
+{
+    QString origin = url.scheme() + QStringLiteral("://") + url.host(QUrl::FullyEncoded);
+    if (url.port() != -1) {
+        origin += QLatin1Char(':') + QString::number(url.port());
+    }
+    return origin;
+}
+
+void BrowsingDataCleaner::clearCookies(const QUrl &origin)
+{
+    // Removals reach the index later, through the store's signal
+    const QByteArray host = origin.host(QUrl::FullyEncoded).toLatin1();
+    const QVector<QNetworkCookie> cookies = m_cookieIndex->cookies(CookieIndex::siteOf(host));
+    QWebEngineCookieStore *cookieStore = m_profile->cookieStore();
+    for (const QNetworkCookie &cookie : cookies) {
+        if (belongsTo(cookie.domain().toUtf8().toLower(), host)) {
+            cookieStore->deleteCookie(cookie);
+        }
+    }
+    stepDone();
+}
+
+void BrowsingDataCleaner::clearStorage(const QUrl &origin)
+{
+    QJsonObject params;
+    params["origin"] = originString(origin);
+    params["storageTypes"] = QLatin1String(StorageTypes);
+    m_devTools->call(QStringLiteral("Storage.clearDataForOrigin"), params, [this, origin](const QJsonObject &, const QString &error) {
+        stepDone(error.isEmpty() ? QString() : originString(origin) + QStringLiteral(": ") + error);
+    });
+}
+
+void BrowsingDataCleaner::runNext()
+{
+    if (m_done == m_steps.size()) {
+        m_steps.clear();
+        emit finished(m_errors);
+        return;
+    }
+    m_steps[m_done]();
+}
+
+void BrowsingDataCleaner::stepDone(const QString &error)
+{
+    if (!error.isEmpty()) {
+        m_errors.append(error);
+    }
+    ++m_done;
+    emit progress(m_done, m_steps.size());
+    QTimer::singleShot(0, this, &BrowsingDataCleaner::runNext);
+}
@@ -0,0 +1,88 @@
+// BrowsingDataCleaner.h
+
+#ifndef BROWSINGDATACLEANER_H
+#define BROWSINGDATACLEANER_H
+
+#include <QDateTime>
+#include <QObject>
+#include <QStringList>
+#include <QUrl>
+#include <QVector>
+#include <functional>
+
+class QWebEngineProfile;
+class CookieIndex;
+class DevToolsProtocol;
+
+// Clears browsing data for a set of origins, or for all of them, one step
+// per event loop turn so the UI stays responsive. Cookies are deleted
+// through the cookie store, site storage through the DevTools protocol,
+// and history by whoever keeps it, on historyRemovalRequested(). Without
+// remote debugging site storage is left alone and reported as an error.
+class BrowsingDataCleaner : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum DataType {
+        Cookies = 0x1,
+        Storage = 0x2,
+        History = 0x4,
+        // The HTTP cache is shared by every site and only ever cleared whole
+        Cache = 0x8
+    };
+    Q_DECLARE_FLAGS(DataTypes, DataType)
+
+    struct Request {
+        // scheme://host[:port]; none means every origin
+        QVector<QUrl> origins;
+        // Storage is kept per origin, so clearing every origin covers these,
+        // such as the ones in history, besides the sites holding cookies.
+        // Origins visited but found in neither keep their storage.
+        QVector<QUrl> knownOrigins;
+        // Limits the history removed; invalid ends are open
+        QDateTime from;
+        QDateTime to;
+        DataTypes types = DataTypes(Cookies | Storage | History);
+    };
+
+    BrowsingDataCleaner(QWebEngineProfile *profile, const CookieIndex *cookieIndex, DevToolsProtocol *devTools,
+                        QObject *parent = nullptr);
+
+    bool isRunning() const;
+    // Returns false while another request runs
+    bool start(const Request &request);
+
+    // Answered by storageUsageAvailable()
+    void requestStorageUsage(const QUrl &origin);
+
+    static QString originString(const QUrl &url);
+
+signals:
+    void progress(int done, int total);
+    void historyRemovalRequested(const QVector<QUrl> &origins, const QDateTime &from, const QDateTime &to);
+    // |usage| is -1 when it could not be read
+    void storageUsageAvailable(const QUrl &origin, qint64 usage, qint64 quota);
+    // Failed steps are skipped and listed in |errors|
+    void finished(const QStringList &errors);
+
+private:
+    typedef std::function<void()> Step;
+
+    void clearCookies(const QUrl &origin);
+    void clearStorage(const QUrl &origin);
+    void runNext();
+    void stepDone(const QString &error = QString());
+
+    QWebEngineProfile *m_profile;
+    const CookieIndex *m_cookieIndex;
+    DevToolsProtocol *m_devTools;
+    // Those of the running request, done ones included
+    QVector<Step> m_steps;
+    int m_done;
+    QStringList m_errors;
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(BrowsingDataCleaner::DataTypes)
+
+#endif // BROWSINGDATACLEANER_H
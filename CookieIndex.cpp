@@ -0,0 +1,109 @@
+// CookieIndex.cpp
+
+#include "CookieIndex.h"
+#include "PublicSuffixList.h"
+#include <algorithm>
+
+CookieIndex::CookieIndex()
+    : m_count(0)
+    , m_sitesChanged(false)
+{
+}
+
+QByteArray CookieIndex::siteOf(const QByteArray &domain)
+{
+    QByteArray host = domain.toLower();
+    while (host.startsWith('.')) {
+        host.remove(0, 1);
+    }
+    // Addresses and public suffixes are their own site
+    return PublicSuffixList::site(host);
+}
+
+bool CookieIndex::insert(const QNetworkCookie &cookie)
+{
+    const QByteArray site = siteOf(cookie.domain().toUtf8());
+    auto it = m_sites.find(site);
+    if (it == m_sites.end()) {
+        it = m_sites.insert(site, QVector<QNetworkCookie>());
+        m_sitesChanged = true;
+    }
+    for (QNetworkCookie &indexed : *it) {
+        if (indexed.hasSameIdentifier(cookie)) {
+            indexed = cookie;
+            return false;
+        }
+    }
+    it->append(cookie);
+    ++m_count;
+    return true;
+}
+
+bool CookieIndex::remove(const QNetworkCookie &cookie)
+{
+    auto it = m_sites.find(siteOf(cookie.domain().toUtf8()));
+    if (it == m_sites.end()) {
+        return false;
+    }
+    for (int i = 0; i < it->size(); ++i) {
+        if (it->at(i).hasSameIdentifier(cookie)) {
+            it->remove(i);
+            --m_count;
+            if (it->isEmpty()) {
+                m_sites.erase(it);
+                m_sitesChanged = true;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+QVector<QNetworkCookie> CookieIndex::takeSite(const QByteArray &site)
+{
+    const QVector<QNetworkCookie> cookies = m_sites.take(site);
+    if (!cookies.isEmpty()) {
+        m_count -= cookies.size();
+        m_sitesChanged = true;
+    }
+    return cookies;
+}
+
+void CookieIndex::clear()
+{
+    m_sites.clear();
+    m_count = 0;
+    m_sitesChanged = true;
+}
+
+const QVector<QNetworkCookie> &CookieIndex::cookies(const QByteArray &site) const
+{
+    static const QVector<QNetworkCookie> none;
+    auto it = m_sites.constFind(site);
+    return it == m_sites.constEnd() ? none : it.value();
+}
+
+int CookieIndex::count(const QByteArray &site) const
+{
+    return cookies(site).size();
+}
+
+int CookieIndex::count() const
+{
+    return m_count;
+}
+
+int CookieIndex::siteCount() const
+{
+    return m_sites.size();
+}
+
+const QVector<QByteArray> &CookieIndex::sites() const
+{
+    if (m_sitesChanged) {
+        m_sortedSites = m_sites.keys().toVector();
+        std::sort(m_sortedSites.begin(), m_sortedSites.end());
+        m_sitesChanged = false;
+    }
+    return m_sortedSites;
+}
@@ -0,0 +1,45 @@
+// CookieIndex.h
+
+#ifndef COOKIEINDEX_H
+#define COOKIEINDEX_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QNetworkCookie>
+#include <QVector>
+
+// Mirror of a profile's cookie store, filed by site: the registrable
+// domain of each cookie's domain. Fed from QWebEngineCookieStore's
+// cookieAdded and cookieRemoved signals, it answers per-site lookups,
+// counts and deletions without reading the whole store.
+class CookieIndex
+{
+public:
+    CookieIndex();
+
+    // Site |domain| belongs to, such as "example.com" for ".www.example.com"
+    static QByteArray siteOf(const QByteArray &domain);
+
+    // Replaces an indexed cookie with the same name, domain and path.
+    // Returns true when the cookie was not indexed before.
+    bool insert(const QNetworkCookie &cookie);
+    bool remove(const QNetworkCookie &cookie);
+    // Drops and returns the cookies of |site|
+    QVector<QNetworkCookie> takeSite(const QByteArray &site);
+    void clear();
+
+    const QVector<QNetworkCookie> &cookies(const QByteArray &site) const;
+    int count(const QByteArray &site) const;
+    int count() const;
+    int siteCount() const;
+    // Sites in name order; sorted again only after sites come or go
+    const QVector<QByteArray> &sites() const;
+
+private:
+    QHash<QByteArray, QVector<QNetworkCookie>> m_sites;
+    int m_count;
+    mutable QVector<QByteArray> m_sortedSites;
+    mutable bool m_sitesChanged;
+};
+
+#endif // COOKIEINDEX_H
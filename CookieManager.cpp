@@ -0,0 +1,246 @@
+// CookieManager.cpp
+
+#include "CookieManager.h"
+#include "CookieIndex.h"
+#include "PrivacyManager.h"
+#include <QDialogButtonBox>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QLineEdit>
+#include <QPushButton>
+#include <QTimer>
+#include <QTreeView>
+#include <QVBoxLayout>
+
+namespace {
+
+// Sites handed to the view per fetch
+const int SiteBatch = 256;
+// Lets a burst of cookie changes, such as the initial load, settle first
+const int ReloadDelay = 250;
+
+} // namespace
+
+CookieModel::CookieModel(const CookieIndex *index, QObject *parent)
+    : QAbstractItemModel(parent)
+    , m_index(index)
+    , m_fetchedSites(0)
+    , m_reloadTimer(new QTimer(this))
+{
+    m_reloadTimer->setSingleShot(true);
+    m_reloadTimer->setInterval(ReloadDelay);
+    connect(m_reloadTimer, &QTimer::timeout, this, &CookieModel::reload);
+    reload();
+}
+
+void CookieModel::setFilter(const QString &text)
+{
+    m_filter = text.trimmed().toLower();
+    reload();
+}
+
+QByteArray CookieModel::site(const QModelIndex &index) const
+{
+    if (!index.isValid()) {
+        return QByteArray();
+    }
+    const int row = index.internalId() ? int(index.internalId() - 1) : index.row();
+    return row < m_sites.size() ? m_sites[row] : QByteArray();
+}
+
+QModelIndex CookieModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (row < 0 || column < 0 || column >= ColumnCount) {
+        return QModelIndex();
+    }
+    // Cookie rows carry their site's row, plus one
+    if (parent.isValid()) {
+        return parent.internalId() ? QModelIndex() : createIndex(row, column, quintptr(parent.row() + 1));
+    }
+    return createIndex(row, column, quintptr(0));
+}
+
+QModelIndex CookieModel::parent(const QModelIndex &child) const
+{
+    if (!child.isValid() || !child.internalId()) {
+        return QModelIndex();
+    }
+    return createIndex(int(child.internalId() - 1), 0, quintptr(0));
+}
+
+int CookieModel::rowCount(const QModelIndex &parent) const
+{
+    if (!parent.isValid()) {
+        return m_fetchedSites;
+    }
+    if (parent.internalId() || parent.column() != 0 || parent.row() >= m_cookies.size()) {
+        return 0;
+    }
+    return m_cookies[parent.row()].size();
+}
+
+int CookieModel::columnCount(const QModelIndex &) const
+{
+    return ColumnCount;
+}
+
+QVariant CookieModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || (role != Qt::DisplayRole && role != Qt::ToolTipRole)) {
+        return QVariant();
+    }
+
+    const int siteRow = index.internalId() ? int(index.internalId() - 1) : index.row();
+    if (siteRow >= m_sites.size()) {
+        return QVariant();
+    }
+    const QVector<QNetworkCookie> &cookies = m_cookies[siteRow];
+    if (!index.internalId()) {
+        if (index.column() == NameColumn) {
+            return QString::fromUtf8(m_sites[siteRow]);
+        }
+        if (index.column() == DomainColumn) {
+            return tr("%n cookie(s)", nullptr, cookies.size());
+        }
+        return QVariant();
+    }
+
+    if (index.row() >= cookies.size()) {
+        return QVariant();
+    }
+    const QNetworkCookie &cookie = cookies[index.row()];
+    switch (index.column()) {
+        case NameColumn: return QString::fromUtf8(cookie.name());
+        case DomainColumn: return cookie.domain();
+        case PathColumn: return cookie.path();
+        case ExpiresColumn: return cookie.isSessionCookie() ? tr("Session") : cookie.expirationDate().toString(Qt::ISODate);
+        default: return QVariant();
+    }
+}
+
+QVariant CookieModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QVariant();
+    }
+    switch (section) {
+        case NameColumn: return tr("Name");
+        case DomainColumn: return tr("Domain");
+        case PathColumn: return tr("Path");
+        case ExpiresColumn: return tr("Expires");
+        default: return QVariant();
+    }
+}
+
+bool CookieModel::hasChildren(const QModelIndex &parent) const
+{
+    // Answered without counting, so collapsed sites cost nothing
+    return !parent.isValid() || (!parent.internalId() && parent.column() == 0);
+}
+
+bool CookieModel::canFetchMore(const QModelIndex &parent) const
+{
+    return !parent.isValid() && m_fetchedSites < m_sites.size();
+}
+
+void CookieModel::fetchMore(const QModelIndex &parent)
+{
+    if (parent.isValid()) {
+        return;
+    }
+    const int count = qMin(SiteBatch, m_sites.size() - m_fetchedSites);
+    if (count <= 0) {
+        return;
+    }
+    beginInsertRows(QModelIndex(), m_fetchedSites, m_fetchedSites + count - 1);
+    m_fetchedSites += count;
+    endInsertRows();
+}
+
+void CookieModel::indexChanged()
+{
+    m_reloadTimer->start();
+}
+
+void CookieModel::reload()
+{
+    m_reloadTimer->stop();
+    beginResetModel();
+    m_sites.clear();
+    m_cookies.clear();
+    const QByteArray filter = m_filter.toUtf8();
+    for (const QByteArray &site : m_index->sites()) {
+        if (filter.isEmpty() || site.contains(filter)) {
+            m_sites.append(site);
+            m_cookies.append(m_index->cookies(site));
+        }
+    }
+    m_fetchedSites = qMin(SiteBatch, m_sites.size());
+    endResetModel();
+}
+
+CookieManagerDialog::CookieManagerDialog(PrivacyManager *privacyManager, QWidget *parent)
+    : QDialog(parent)
+    , m_privacyManager(privacyManager)
+    , m_model(new CookieModel(&privacyManager->cookieIndex(), this))
+{
+    setWindowTitle(tr("Cookies"));
+    resize(720, 480);
+
+    QVBoxLayout *mainLayout = new QVBoxLayout(this);
+
+    m_filter = new QLineEdit(this);
+    m_filter->setPlaceholderText(tr("Search sites"));
+    m_filter->setClearButtonEnabled(true);
+    mainLayout->addWidget(m_filter);
+
+    m_view = new QTreeView(this);
+    m_view->setModel(m_model);
+    m_view->setUniformRowHeights(true);
+    m_view->setSelectionMode(QAbstractItemView::SingleSelection);
+    m_view->header()->setSectionResizeMode(CookieModel::NameColumn, QHeaderView::Stretch);
+    mainLayout->addWidget(m_view);
+
+    m_summary = new QLabel(this);
+    mainLayout->addWidget(m_summary);
+
+    QHBoxLayout *buttonLayout = new QHBoxLayout;
+    QPushButton *removeSiteButton = new QPushButton(tr("Remove Site"), this);
+    QPushButton *removeAllButton = new QPushButton(tr("Remove All"), this);
+    QDialogButtonBox *buttons = new QDialogButtonBox(QDialogButtonBox::Close, this);
+    buttonLayout->addWidget(removeSiteButton);
+    buttonLayout->addWidget(removeAllButton);
+    buttonLayout->addStretch();
+    buttonLayout->addWidget(buttons);
+    mainLayout->addLayout(buttonLayout);
+
+    setLayout(mainLayout);
+
+    connect(m_filter, &QLineEdit::textChanged, m_model, &CookieModel::setFilter);
+    connect(removeSiteButton, &QPushButton::clicked, this, &CookieManagerDialog::removeSelectedSite);
+    connect(removeAllButton, &QPushButton::clicked, this, &CookieManagerDialog::removeAll);
+    connect(buttons, &QDialogButtonBox::rejected, this, &QDialog::reject);
+    connect(m_privacyManager, &PrivacyManager::cookiesChanged, m_model, &CookieModel::indexChanged);
+    connect(m_model, &QAbstractItemModel::modelReset, this, &CookieManagerDialog::updateSummary);
+    updateSummary();
+}
+
+void CookieManagerDialog::removeSelectedSite()
+{
+    const QByteArray site = m_model->site(m_view->currentIndex());
+    if (!site.isEmpty()) {
+        m_privacyManager->clearSiteCookies(QString::fromUtf8(site));
+    }
+}
+
+void CookieManagerDialog::removeAll()
+{
+    m_privacyManager->clearCookies();
+}
+
+void CookieManagerDialog::updateSummary()
+{
+    const CookieIndex &index = m_privacyManager->cookieIndex();
+    m_summary->setText(tr("%1 cookies on %2 sites").arg(index.count()).arg(index.siteCount()));
+}
@@ -0,0 +1,88 @@
+// CookieManager.h
+
+#ifndef COOKIEMANAGER_H
+#define COOKIEMANAGER_H
+
+#include <QAbstractItemModel>
+#include <QDialog>
+#include <QNetworkCookie>
+#include <QVector>
+
+class QLabel;
+class QLineEdit;
+class QTimer;
+class QTreeView;
+class CookieIndex;
+class PrivacyManager;
+
+// Sites and, below each, their cookies, read straight from a CookieIndex.
+// Sites are handed to the view in batches as it scrolls and cookies only
+// when a site is expanded, so large stores open instantly. Changes to the
+// index are picked up in one reset after they settle; until then the
+// model serves the cookies it took at the last one.
+class CookieModel : public QAbstractItemModel
+{
+    Q_OBJECT
+
+public:
+    enum Column {
+        NameColumn,
+        DomainColumn,
+        PathColumn,
+        ExpiresColumn,
+        ColumnCount
+    };
+
+    explicit CookieModel(const CookieIndex *index, QObject *parent = nullptr);
+
+    // Only sites containing |text| are listed
+    void setFilter(const QString &text);
+    QByteArray site(const QModelIndex &index) const;
+
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override;
+    QModelIndex parent(const QModelIndex &child) const override;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+    bool hasChildren(const QModelIndex &parent = QModelIndex()) const override;
+    bool canFetchMore(const QModelIndex &parent) const override;
+    void fetchMore(const QModelIndex &parent) override;
+
+public slots:
+    // Schedules a reset
+    void indexChanged();
+
+private:
+    void reload();
+
+    const CookieIndex *m_index;
+    QString m_filter;
+    QVector<QByteArray> m_sites;
+    // Shared with the index until it changes, so taking them is cheap
+    QVector<QVector<QNetworkCookie>> m_cookies;
+    int m_fetchedSites;
+    QTimer *m_reloadTimer;
+};
+
+class CookieManagerDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit CookieManagerDialog(PrivacyManager *privacyManager, QWidget *parent = nullptr);
+
+private slots:
+    void removeSelectedSite();
+    void removeAll();
+    void updateSummary();
+
+private:
+    PrivacyManager *m_privacyManager;
+    CookieModel *m_model;
+    QLineEdit *m_filter;
+    QTreeView *m_view;
+    QLabel *m_summary;
+};
+
+#endif // COOKIEMANAGER_H
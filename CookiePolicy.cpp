@@ -0,0 +1,153 @@
+// CookiePolicy.cpp
+
+#include "CookiePolicy.h"
+#include <QTimer>
+#include <QUrl>
+#include <QVarLengthArray>
+
+namespace {
+
+typedef QVarLengthArray<char, 256> HostBuffer;
+
+// Hosts from QUrl are already lowercase; ACE keeps them ASCII
+void copyHost(const QUrl &url, HostBuffer &host)
+{
+    const QString name = url.host(QUrl::FullyEncoded);
+    host.resize(name.size());
+    const QChar *chars = name.constData();
+    for (int i = 0; i < name.size(); ++i) {
+        host[i] = char(chars[i].unicode());
+    }
+}
+
+} // namespace
+
+CookiePolicy *CookiePolicy::compile(const Settings &settings)
+{
+    CookiePolicy *policy = new CookiePolicy;
+    policy->m_acceptCookies = settings.acceptCookies;
+    policy->m_blockThirdParty = settings.blockThirdParty;
+    policy->m_entities = settings.entities;
+
+    DomainTrie::Builder builder;
+    for (auto it = settings.sites.constBegin(); it != settings.sites.constEnd(); ++it) {
+        if (builder.insert(it.key(), it.value()) && it.value() == SessionOnlyCookies) {
+            policy->m_hasSessionOnlySites = true;
+        }
+    }
+    builder.finish(policy->m_nodes, policy->m_labels);
+    policy->m_sites.attach(policy->m_nodes.constData(), quint32(policy->m_nodes.size()),
+                           policy->m_labels.constData(), quint32(policy->m_labels.size()));
+    return policy;
+}
+
+bool CookiePolicy::allowsEverything() const
+{
+    return m_acceptCookies && !m_blockThirdParty && m_sites.isEmpty();
+}
+
+bool CookiePolicy::blocksThirdParty() const
+{
+    return m_blockThirdParty;
+}
+
+bool CookiePolicy::hasSiteRules() const
+{
+    return !m_sites.isEmpty();
+}
+
+bool CookiePolicy::groupsEntities() const
+{
+    return m_acceptCookies && m_blockThirdParty && m_entities;
+}
+
+bool CookiePolicy::allows(const char *firstParty, int firstPartyLength, const char *origin, int originLength,
+                          bool thirdParty) const
+{
+    const qint32 originRule = siteRule(origin, originLength);
+    const qint32 firstPartyRule = firstPartyLength > 0 ? siteRule(firstParty, firstPartyLength) : -1;
+    if (originRule == BlockCookies || firstPartyRule == BlockCookies) {
+        return false;
+    }
+    // Listing a site, even session-only, lets it keep cookies
+    if (originRule >= 0 || firstPartyRule >= 0) {
+        return true;
+    }
+    if (thirdParty && m_blockThirdParty && m_entities && firstPartyLength > 0
+        && m_entities->isSameParty(firstParty, firstPartyLength, origin, originLength)) {
+        thirdParty = false;
+    }
+    return m_acceptCookies && !(thirdParty && m_blockThirdParty);
+}
+
+qint32 CookiePolicy::siteRule(const char *host, int length) const
+{
+    return m_sites.find(host, length);
+}
+
+CookieFilter::CookieFilter(QObject *parent)
+    : QObject(parent)
+    , m_policy(CookiePolicy::compile(CookiePolicy::Settings()))
+    , m_checkedCount(0)
+    , m_blockedCount(0)
+{
+}
+
+void CookieFilter::setPolicy(const CookiePolicy *policy)
+{
+    if (!m_policy.publish(policy)) {
+        QTimer::singleShot(1000, this, &CookieFilter::reclaimPolicies);
+    }
+}
+
+const CookiePolicy &CookieFilter::policy() const
+{
+    return *m_policy.current();
+}
+
+bool CookieFilter::accept(const QWebEngineCookieStore::FilterRequest &request) const
+{
+    m_checkedCount.fetchAndAddRelaxed(1);
+    RcuPointer<CookiePolicy>::Reader policy(m_policy);
+
+    if (policy->allowsEverything()) {
+        return true;
+    }
+
+    // Without site rules the answer only depends on the URLs when a blocked
+    // third party might belong to the page's organization
+    bool allowed;
+    if (!policy->hasSiteRules() && !(request.thirdParty && policy->groupsEntities())) {
+        allowed = policy->allows(nullptr, 0, nullptr, 0, request.thirdParty);
+    } else {
+        HostBuffer firstParty;
+        HostBuffer origin;
+        copyHost(request.firstPartyUrl, firstParty);
+        copyHost(request.origin, origin);
+        allowed = policy->allows(firstParty.constData(), firstParty.size(), origin.constData(), origin.size(),
+                                 request.thirdParty);
+    }
+
+    if (!allowed) {
+        m_blockedCount.fetchAndAddRelaxed(1);
+    }
+    return allowed;
+}
+
+quint64 CookieFilter::checkedCount() const
+{
+    return m_checkedCount.loadRelaxed();
+}
+
+quint64 CookieFilter::blockedCount() const
+{
+    return m_blockedCount.loadRelaxed();
+}
+
+void CookieFilter::reclaimPolicies()
+{
+    // The IO thread still held the previous policy; try again later
+    if (!m_policy.reclaim()) {
+        QTimer::singleShot(1000, this, &CookieFilter::reclaimPolicies);
+    }
+}
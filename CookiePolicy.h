@@ -0,0 +1,101 @@
+// CookiePolicy.h
+
+#ifndef COOKIEPOLICY_H
+#define COOKIEPOLICY_H
+
+#include <QAtomicInteger>
+#include <QByteArray>
+#include <QMap>
+#include <QObject>
+#include <QSharedPointer>
+#include <QVector>
+#include <QWebEngineCookieStore>
+
+#include "DomainTrie.h"
+#include "EntityMap.h"
+#include "RcuPointer.h"
+
+// Which cookies may be read and written, compiled from PrivacyManager's
+// settings. Site rules cover a host and its subdomains, the most specific
+// one winning. Never modified after compile(); checks only read it and
+// allocate nothing.
+class CookiePolicy
+{
+public:
+    enum SiteRule : qint32 {
+        AllowCookies,
+        BlockCookies,
+        // Allowed, but kept only until the browser closes
+        SessionOnlyCookies
+    };
+
+    struct Settings {
+        bool acceptCookies = true;
+        bool blockThirdParty = false;
+        // By lowercase ACE hostname
+        QMap<QByteArray, SiteRule> sites;
+        // Third-party cookies of the page's own organization are let
+        // through when third-party cookies are blocked
+        QSharedPointer<const EntityMap> entities;
+    };
+
+    static CookiePolicy *compile(const Settings &settings);
+
+    // True when every access is allowed without looking at the URLs
+    bool allowsEverything() const;
+    bool blocksThirdParty() const;
+    bool hasSiteRules() const;
+    // Whether blocking a third-party access first needs the hosts, to see
+    // if both belong to one organization
+    bool groupsEntities() const;
+
+    // |firstParty| is the host of the page, |origin| that of the cookie's
+    // URL; both lowercase. A block on either wins, then an allow on either,
+    // then the global settings. A third party owned by the page's
+    // organization counts as first-party.
+    bool allows(const char *firstParty, int firstPartyLength, const char *origin, int originLength,
+                bool thirdParty) const;
+    // Rule for |host|, or -1
+    qint32 siteRule(const char *host, int length) const;
+
+private:
+    CookiePolicy() = default;
+    Q_DISABLE_COPY(CookiePolicy)
+
+    bool m_acceptCookies = true;
+    bool m_blockThirdParty = false;
+    bool m_hasSessionOnlySites = false;
+    QSharedPointer<const EntityMap> m_entities;
+    QVector<DomainTrie::Node> m_nodes;
+    QByteArray m_labels;
+    DomainTrie m_sites;
+};
+
+// Holds the current policy for QWebEngineCookieStore::setCookieFilter(),
+// which calls accept() on the IO thread. The policy is replaced without
+// blocking those calls.
+class CookieFilter : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit CookieFilter(QObject *parent = nullptr);
+
+    // Takes ownership of |policy|; GUI thread only
+    void setPolicy(const CookiePolicy *policy);
+    const CookiePolicy &policy() const;
+
+    bool accept(const QWebEngineCookieStore::FilterRequest &request) const;
+
+    quint64 checkedCount() const;
+    quint64 blockedCount() const;
+
+private:
+    void reclaimPolicies();
+
+    RcuPointer<CookiePolicy> m_policy;
+    mutable QAtomicInteger<quint64> m_checkedCount;
+    mutable QAtomicInteger<quint64> m_blockedCount;
+};
+
+#endif // COOKIEPOLICY_H
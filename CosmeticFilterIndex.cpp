@@ -0,0 +1,504 @@
+// CosmeticFilterIndex.cpp
+
+#include "CosmeticFilterIndex.h"
+#include "ScriptletLibrary.h"
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QStringList>
+#include <algorithm>
+
+namespace {
+
+const int MaxHostEntries = 16;
+
+const char HideDeclaration[] = " { display: none !important; }\n";
+
+// Extended syntax we cannot express as plain CSS
+const char *const ProceduralOperators[] = {
+    ":-abp-", ":has-text(", ":xpath(", ":matches-css", ":upward(", ":remove(", ":style(", ":min-text-length("
+};
+
+enum SectionOffset : quint32 {
+    SelectorOffsetSection,
+    SelectorTextSection,
+    GenericSection,
+    HostNodeSection,
+    HostLabelSection,
+    HostEntrySection,
+    HostSelectorSection,
+    ScriptletOffsetSection,
+    ScriptletTextSection,
+    HostScriptletSection
+};
+
+bool isPlainSelector(const QString &selector)
+{
+    // Anything that could close the rule or the style element is rejected
+    if (selector.isEmpty() || selector.contains('{') || selector.contains('}') || selector.contains("</")
+        || selector.startsWith("+js(")) {
+        return false;
+    }
+    for (const char *op : ProceduralOperators) {
+        if (selector.contains(QLatin1String(op))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Arguments of +js(name, arg, ...); "\," is a literal comma and quotes
+// around an argument are dropped
+QStringList scriptletArguments(const QString &arguments)
+{
+    QStringList result;
+    QString current;
+    for (int i = 0; i <= arguments.size(); ++i) {
+        if (i < arguments.size() && arguments[i] == '\\' && i + 1 < arguments.size() && arguments[i + 1] == ',') {
+            current += ',';
+            ++i;
+        } else if (i == arguments.size() || arguments[i] == ',') {
+            current = current.trimmed();
+            if (current.size() >= 2 && (current.startsWith('"') || current.startsWith('\''))
+                && current.endsWith(current[0])) {
+                current = current.mid(1, current.size() - 2);
+            }
+            result.append(current);
+            current.clear();
+        } else {
+            current += arguments[i];
+        }
+    }
+    if (result.size() == 1 && result[0].isEmpty()) {
+        result.clear();
+    }
+    return result;
+}
+
+QVector<quint32> sortedIds(const QSet<quint32> &ids)
+{
+    QVector<quint32> sorted(ids.begin(), ids.end());
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
+}
+
+QVector<quint32> uniqueIds(QVector<quint32> ids)
+{
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+}
+
+} // namespace
+
+bool CosmeticFilterIndex::Builder::addRule(const QString &line)
+{
+    const QString text = line.trimmed();
+
+    // @@||example.com^$generichide,elemhide switches hiding off per site
+    if (text.startsWith("@@||")) {
+        const int dollar = text.lastIndexOf('$');
+        if (dollar < 0) {
+            return false;
+        }
+        quint32 flags = 0;
+        for (const QString &option : text.mid(dollar + 1).split(',', Qt::SkipEmptyParts)) {
+            const QString name = option.trimmed().toLower();
+            if (name == "generichide" || name == "ghide") {
+                flags |= GenericHide;
+            } else if (name == "elemhide" || name == "ehide") {
+                flags |= GenericHide | ElementHide;
+            } else {
+                return false;
+            }
+        }
+
+        QByteArray host = text.mid(4, dollar - 4).toLower().toUtf8();
+        if (host.endsWith('^')) {
+            host.chop(1);
+        }
+        if (DomainTrie::isValidHost(host.constData(), host.size())) {
+            m_hosts[host].flags |= flags;
+        }
+        return true;
+    }
+
+    int marker = -1;
+    int markerLength = 0;
+    bool exception = false;
+    for (int i = text.indexOf('#'); i >= 0; i = text.indexOf('#', i + 1)) {
+        if (text.mid(i, 2) == QLatin1String("##")) {
+            marker = i;
+            markerLength = 2;
+        } else if (text.mid(i, 3) == QLatin1String("#@#")) {
+            marker = i;
+            markerLength = 3;
+            exception = true;
+        } else if (text.mid(i, 3) == QLatin1String("#?#") || text.mid(i, 3) == QLatin1String("#$#")
+                   || text.mid(i, 4) == QLatin1String("#@?#") || text.mid(i, 4) == QLatin1String("#@$#")) {
+            return true;
+        } else {
+            continue;
+        }
+        break;
+    }
+    if (marker < 0) {
+        return false;
+    }
+
+    const QString selector = text.mid(marker + markerLength).trimmed();
+    const bool scriptlet = selector.startsWith("+js(") && selector.endsWith(')');
+    if (!scriptlet && !isPlainSelector(selector)) {
+        return true;
+    }
+
+    QVector<QByteArray> includes;
+    QVector<QByteArray> excludes;
+    bool skippedInclude = false;
+    for (const QString &entry : text.left(marker).split(',', Qt::SkipEmptyParts)) {
+        const bool negated = entry.startsWith('~');
+        const QByteArray domain = entry.mid(negated ? 1 : 0).trimmed().toLower().toUtf8();
+        if (!DomainTrie::isValidHost(domain.constData(), domain.size())) {
+            skippedInclude |= !negated;
+            continue;
+        }
+        (negated ? excludes : includes).append(domain);
+    }
+    // Only entity rules like google.*##.ad were listed; do not widen them
+    if (includes.isEmpty() && skippedInclude) {
+        return true;
+    }
+
+    if (scriptlet) {
+        addScriptlet(selector.mid(4, selector.size() - 5), includes, excludes, exception);
+        return true;
+    }
+
+    const quint32 id = intern(selector);
+    if (exception) {
+        if (includes.isEmpty() && excludes.isEmpty()) {
+            m_genericExceptions.insert(id);
+        }
+        for (const QByteArray &domain : includes) {
+            m_hosts[domain].unhide.append(id);
+        }
+        return true;
+    }
+
+    if (includes.isEmpty()) {
+        m_generic.insert(id);
+    }
+    for (const QByteArray &domain : includes) {
+        m_hosts[domain].hide.append(id);
+    }
+    for (const QByteArray &domain : excludes) {
+        m_hosts[domain].unhide.append(id);
+    }
+    return true;
+}
+
+void CosmeticFilterIndex::Builder::finish(AdBlockSnapshot::Builder &builder, quint32 firstSection) const
+{
+    QVector<quint32> generic = sortedIds(m_generic - m_genericExceptions);
+
+    DomainTrie::Builder trie;
+    QVector<HostEntry> entries;
+    QVector<quint32> hostSelectors;
+    QVector<quint32> hostScriptlets;
+    for (auto it = m_hosts.constBegin(); it != m_hosts.constEnd(); ++it) {
+        const QVector<quint32> hide = uniqueIds(it.value().hide);
+        const QVector<quint32> unhide = uniqueIds(it.value().unhide);
+        QVector<quint32> scriptlets;
+        if (!m_noScriptlets) {
+            for (quint32 id : uniqueIds(it.value().scriptlets)) {
+                if (!m_scriptletExceptions.contains(id)) {
+                    scriptlets.append(id);
+                }
+            }
+        }
+        const QVector<quint32> unscriptlets = uniqueIds(it.value().unscriptlets);
+        if (!trie.insert(it.key(), entries.size())) {
+            continue;
+        }
+
+        HostEntry entry;
+        entry.selectorOffset = quint32(hostSelectors.size());
+        entry.hideCount = quint16(qMin(hide.size(), 0xffff));
+        entry.unhideCount = quint16(qMin(unhide.size(), 0xffff));
+        entry.flags = it.value().flags;
+        entry.scriptletOffset = quint32(hostScriptlets.size());
+        entry.scriptletCount = quint16(qMin(scriptlets.size(), 0xffff));
+        entry.unscriptletCount = quint16(qMin(unscriptlets.size(), 0xffff));
+        hostSelectors += hide.mid(0, entry.hideCount);
+        hostSelectors += unhide.mid(0, entry.unhideCount);
+        hostScriptlets += scriptlets.mid(0, entry.scriptletCount);
+        hostScriptlets += unscriptlets.mid(0, entry.unscriptletCount);
+        entries.append(entry);
+    }
+
+    QVector<DomainTrie::Node> nodes;
+    QByteArray labels;
+    trie.finish(nodes, labels);
+
+    builder.addStringTable(firstSection + SelectorOffsetSection, firstSection + SelectorTextSection, m_selectors);
+    builder.addArray(firstSection + GenericSection, generic);
+    builder.addArray(firstSection + HostNodeSection, nodes);
+    builder.addSection(firstSection + HostLabelSection, labels.constData(), labels.size());
+    builder.addArray(firstSection + HostEntrySection, entries);
+    builder.addArray(firstSection + HostSelectorSection, hostSelectors);
+    builder.addStringTable(firstSection + ScriptletOffsetSection, firstSection + ScriptletTextSection, m_scriptlets);
+    builder.addArray(firstSection + HostScriptletSection, hostScriptlets);
+}
+
+quint32 CosmeticFilterIndex::Builder::intern(const QString &selector)
+{
+    auto it = m_selectorIds.constFind(selector);
+    if (it == m_selectorIds.constEnd()) {
+        it = m_selectorIds.insert(selector, quint32(m_selectors.size()));
+        m_selectors.append(selector.toUtf8());
+    }
+    return it.value();
+}
+
+void CosmeticFilterIndex::Builder::addScriptlet(const QString &call, const QVector<QByteArray> &includes,
+                                               const QVector<QByteArray> &excludes, bool exception)
+{
+    QStringList arguments = scriptletArguments(call);
+    if (arguments.isEmpty()) {
+        if (!exception) {
+            return;
+        }
+        if (includes.isEmpty() && excludes.isEmpty()) {
+            m_noScriptlets = true;
+        }
+        for (const QByteArray &domain : includes) {
+            m_hosts[domain].flags |= NoScriptlets;
+        }
+        return;
+    }
+
+    // Unknown scriptlets are dropped; aliases share one canonical call
+    arguments[0] = ScriptletLibrary::canonicalName(arguments[0]);
+    if (arguments[0].isEmpty()) {
+        return;
+    }
+    const QByteArray json = QJsonDocument(QJsonArray::fromStringList(arguments)).toJson(QJsonDocument::Compact);
+    auto it = m_scriptletIds.constFind(json);
+    if (it == m_scriptletIds.constEnd()) {
+        it = m_scriptletIds.insert(json, quint32(m_scriptlets.size()));
+        m_scriptlets.append(json);
+    }
+    const quint32 id = it.value();
+
+    if (exception) {
+        if (includes.isEmpty() && excludes.isEmpty()) {
+            m_scriptletExceptions.insert(id);
+        }
+        for (const QByteArray &domain : includes) {
+            m_hosts[domain].unscriptlets.append(id);
+        }
+        return;
+    }
+
+    // Page scripts run only where a list asked for them by name
+    if (includes.isEmpty()) {
+        return;
+    }
+    for (const QByteArray &domain : includes) {
+        m_hosts[domain].scriptlets.append(id);
+    }
+    for (const QByteArray &domain : excludes) {
+        m_hosts[domain].unscriptlets.append(id);
+    }
+}
+
+bool CosmeticFilterIndex::isCosmeticRule(const QString &line)
+{
+    // Empty Qt containers do not allocate, so a scratch builder is cheap
+    Builder scratch;
+    return scratch.addRule(line);
+}
+
+CosmeticFilterIndex::CosmeticFilterIndex()
+    : m_selectorOffsets(nullptr)
+    , m_selectorOffsetCount(0)
+    , m_selectorText(nullptr)
+    , m_selectorTextSize(0)
+    , m_generic(nullptr)
+    , m_genericCount(0)
+    , m_hostEntries(nullptr)
+    , m_hostEntryCount(0)
+    , m_hostSelectors(nullptr)
+    , m_hostSelectorCount(0)
+    , m_scriptletOffsets(nullptr)
+    , m_scriptletOffsetCount(0)
+    , m_scriptletText(nullptr)
+    , m_scriptletTextSize(0)
+    , m_hostScriptlets(nullptr)
+    , m_hostScriptletCount(0)
+{
+}
+
+bool CosmeticFilterIndex::attach(const AdBlockSnapshot &snapshot, quint32 firstSection)
+{
+    m_selectorOffsets = snapshot.array<quint32>(firstSection + SelectorOffsetSection, &m_selectorOffsetCount);
+    m_selectorText = snapshot.array<char>(firstSection + SelectorTextSection, &m_selectorTextSize);
+    m_generic = snapshot.array<quint32>(firstSection + GenericSection, &m_genericCount);
+    m_hostEntries = snapshot.array<HostEntry>(firstSection + HostEntrySection, &m_hostEntryCount);
+    m_hostSelectors = snapshot.array<quint32>(firstSection + HostSelectorSection, &m_hostSelectorCount);
+    m_scriptletOffsets = snapshot.array<quint32>(firstSection + ScriptletOffsetSection, &m_scriptletOffsetCount);
+    m_scriptletText = snapshot.array<char>(firstSection + ScriptletTextSection, &m_scriptletTextSize);
+    m_hostScriptlets = snapshot.array<quint32>(firstSection + HostScriptletSection, &m_hostScriptletCount);
+    if (!m_selectorOffsetCount || !m_scriptletOffsetCount) {
+        return false;
+    }
+
+    const quint32 selectorCount = m_selectorOffsetCount - 1;
+    for (quint32 i = 0; i < selectorCount; ++i) {
+        if (m_selectorOffsets[i] > m_selectorOffsets[i + 1] || m_selectorOffsets[i + 1] > m_selectorTextSize) {
+            return false;
+        }
+    }
+    for (quint32 i = 0; i < m_genericCount; ++i) {
+        if (m_generic[i] >= selectorCount) {
+            return false;
+        }
+    }
+    for (quint32 i = 0; i < m_hostSelectorCount; ++i) {
+        if (m_hostSelectors[i] >= selectorCount) {
+            return false;
+        }
+    }
+    const quint32 scriptletCount = m_scriptletOffsetCount - 1;
+    for (quint32 i = 0; i < scriptletCount; ++i) {
+        if (m_scriptletOffsets[i] > m_scriptletOffsets[i + 1] || m_scriptletOffsets[i + 1] > m_scriptletTextSize) {
+            return false;
+        }
+    }
+    for (quint32 i = 0; i < m_hostScriptletCount; ++i) {
+        if (m_hostScriptlets[i] >= scriptletCount) {
+            return false;
+        }
+    }
+    for (quint32 i = 0; i < m_hostEntryCount; ++i) {
+        const HostEntry &entry = m_hostEntries[i];
+        if (quint64(entry.selectorOffset) + entry.hideCount + entry.unhideCount > m_hostSelectorCount
+            || quint64(entry.scriptletOffset) + entry.scriptletCount + entry.unscriptletCount > m_hostScriptletCount) {
+            return false;
+        }
+    }
+
+    quint32 nodeCount = 0;
+    quint32 labelSize = 0;
+    const DomainTrie::Node *nodes = snapshot.array<DomainTrie::Node>(firstSection + HostNodeSection, &nodeCount);
+    const char *labels = snapshot.array<char>(firstSection + HostLabelSection, &labelSize);
+    for (quint32 i = 0; i < nodeCount; ++i) {
+        if (nodes[i].value >= 0 && quint32(nodes[i].value) >= m_hostEntryCount) {
+            return false;
+        }
+    }
+    return m_hosts.attach(nodes, nodeCount, labels, labelSize);
+}
+
+int CosmeticFilterIndex::selectorCount() const
+{
+    return m_selectorOffsetCount ? int(m_selectorOffsetCount - 1) : 0;
+}
+
+QString CosmeticFilterIndex::genericStyleSheet() const
+{
+    QString css;
+    for (quint32 i = 0; i < m_genericCount; ++i) {
+        appendRule(css, m_generic[i]);
+    }
+    return css;
+}
+
+bool CosmeticFilterIndex::hostStyleSheet(const char *host, int length, QString &css) const
+{
+    qint32 found[MaxHostEntries];
+    const int count = m_hosts.findAll(host, length, found, MaxHostEntries);
+    if (!count) {
+        return false;
+    }
+
+    // An exception on the host or any parent domain wins over every hide rule
+    QSet<quint32> hidden;
+    quint32 flags = 0;
+    for (int i = 0; i < count; ++i) {
+        const HostEntry &entry = m_hostEntries[found[i]];
+        const quint32 *unhide = m_hostSelectors + entry.selectorOffset + entry.hideCount;
+        for (quint32 j = 0; j < entry.unhideCount; ++j) {
+            hidden.insert(unhide[j]);
+        }
+        flags |= entry.flags;
+    }
+
+    css.clear();
+    if (flags & ElementHide) {
+        return true;
+    }
+    if (!(flags & GenericHide)) {
+        for (quint32 i = 0; i < m_genericCount; ++i) {
+            if (!hidden.contains(m_generic[i])) {
+                appendRule(css, m_generic[i]);
+            }
+        }
+    }
+    for (int i = 0; i < count; ++i) {
+        const HostEntry &entry = m_hostEntries[found[i]];
+        const quint32 *hide = m_hostSelectors + entry.selectorOffset;
+        for (quint32 j = 0; j < entry.hideCount; ++j) {
+            // Reusing the set also drops selectors listed for several parents
+            if (!hidden.contains(hide[j])) {
+                hidden.insert(hide[j]);
+                appendRule(css, hide[j]);
+            }
+        }
+    }
+    return true;
+}
+
+bool CosmeticFilterIndex::hostScriptlets(const char *host, int length, QString &script) const
+{
+    qint32 found[MaxHostEntries];
+    const int count = m_hosts.findAll(host, length, found, MaxHostEntries);
+
+    QSet<quint32> excluded;
+    for (int i = 0; i < count; ++i) {
+        const HostEntry &entry = m_hostEntries[found[i]];
+        if (entry.flags & NoScriptlets) {
+            return false;
+        }
+        const quint32 *unscriptlets = m_hostScriptlets + entry.scriptletOffset + entry.scriptletCount;
+        for (quint32 j = 0; j < entry.unscriptletCount; ++j) {
+            excluded.insert(unscriptlets[j]);
+        }
+    }
+
+    QVector<QByteArray> calls;
+    for (int i = 0; i < count; ++i) {
+        const HostEntry &entry = m_hostEntries[found[i]];
+        const quint32 *scriptlets = m_hostScriptlets + entry.scriptletOffset;
+        for (quint32 j = 0; j < entry.scriptletCount; ++j) {
+            if (!excluded.contains(scriptlets[j])) {
+                excluded.insert(scriptlets[j]);
+                const quint32 begin = m_scriptletOffsets[scriptlets[j]];
+                calls.append(QByteArray(m_scriptletText + begin, int(m_scriptletOffsets[scriptlets[j] + 1] - begin)));
+            }
+        }
+    }
+    if (calls.isEmpty()) {
+        return false;
+    }
+
+    script = ScriptletLibrary::bundle(QString::fromLatin1(host, length), calls);
+    return !script.isEmpty();
+}
+
+void CosmeticFilterIndex::appendRule(QString &css, quint32 selector) const
+{
+    // One rule per selector: a selector the engine rejects only drops itself
+    const quint32 begin = m_selectorOffsets[selector];
+    css += QString::fromUtf8(m_selectorText + begin, int(m_selectorOffsets[selector + 1] - begin));
+    css += QLatin1String(HideDeclaration);
+}
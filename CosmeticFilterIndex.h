@@ -0,0 +1,114 @@
+// CosmeticFilterIndex.h
+
+#ifndef COSMETICFILTERINDEX_H
+#define COSMETICFILTERINDEX_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QMap>
+#include <QSet>
+#include <QString>
+#include <QVector>
+
+#include "AdBlockSnapshot.h"
+#include "DomainTrie.h"
+
+// Element hiding (##selector) rules, indexed by hostname. Selectors are
+// interned once; generic ones apply everywhere unless a site opts out, and
+// site-specific ones are found through a DomainTrie walk of the host.
+// Scriptlet rules (example.com##+js(name, args)) are kept per host the
+// same way, as JSON calls for ScriptletLibrary.
+class CosmeticFilterIndex
+{
+public:
+    class Builder
+    {
+    public:
+        // Consumes cosmetic rules and $generichide/$elemhide exceptions.
+        // Returns false for lines that are network filters.
+        bool addRule(const QString &line);
+        void finish(AdBlockSnapshot::Builder &builder, quint32 firstSection) const;
+
+    private:
+        struct HostRules {
+            QVector<quint32> hide;
+            QVector<quint32> unhide;
+            QVector<quint32> scriptlets;
+            QVector<quint32> unscriptlets;
+            quint32 flags = 0;
+        };
+
+        quint32 intern(const QString &selector);
+        void addScriptlet(const QString &call, const QVector<QByteArray> &includes,
+                          const QVector<QByteArray> &excludes, bool exception);
+
+        QHash<QString, quint32> m_selectorIds;
+        QVector<QByteArray> m_selectors;
+        QSet<quint32> m_generic;
+        QSet<quint32> m_genericExceptions;
+        QMap<QByteArray, HostRules> m_hosts;
+        QHash<QByteArray, quint32> m_scriptletIds;
+        QVector<QByteArray> m_scriptlets;
+        QSet<quint32> m_scriptletExceptions;
+        bool m_noScriptlets = false;
+    };
+
+    static const quint32 SectionCount = 10;
+
+    // True for lines Builder::addRule() would consume
+    static bool isCosmeticRule(const QString &line);
+
+    CosmeticFilterIndex();
+
+    bool attach(const AdBlockSnapshot &snapshot, quint32 firstSection);
+
+    int selectorCount() const;
+    QString genericStyleSheet() const;
+
+    // Builds the complete stylesheet for |host|. Returns false when no rule
+    // mentions the host, in which case genericStyleSheet() applies as is.
+    bool hostStyleSheet(const char *host, int length, QString &css) const;
+    // Builds the script running the scriptlets rules give |host|. Returns
+    // false when there are none.
+    bool hostScriptlets(const char *host, int length, QString &script) const;
+
+private:
+    enum HostFlag : quint32 {
+        GenericHide = 1 << 0,
+        ElementHide = 1 << 1,
+        // #@#+js() with no scriptlet named
+        NoScriptlets = 1 << 2
+    };
+
+    struct HostEntry {
+        quint32 selectorOffset;
+        quint16 hideCount;
+        quint16 unhideCount;
+        quint32 flags;
+        quint32 scriptletOffset;
+        quint16 scriptletCount;
+        quint16 unscriptletCount;
+    };
+
+    void appendRule(QString &css, quint32 selector) const;
+
+    const quint32 *m_selectorOffsets;
+    quint32 m_selectorOffsetCount;
+    const char *m_selectorText;
+    quint32 m_selectorTextSize;
+    const quint32 *m_generic;
+    quint32 m_genericCount;
+    const HostEntry *m_hostEntries;
+    quint32 m_hostEntryCount;
+    const quint32 *m_hostSelectors;
+    quint32 m_hostSelectorCount;
+    const quint32 *m_scriptletOffsets;
+    quint32 m_scriptletOffsetCount;
+    const char *m_scriptletText;
+    quint32 m_scriptletTextSize;
+    const quint32 *m_hostScriptlets;
+    quint32 m_hostScriptletCount;
+    DomainTrie m_hosts;
+};
+
+#endif // COSMETICFILTERINDEX_H
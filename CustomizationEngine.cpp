@@ -216,13 +216,13 @@ void CustomizationEngine::setKeyboardShortcut(const QString& actionName, const Q
 
 void CustomizationEngine::setDoNotTrack(bool enable)
 {
-    m_webView->page()->profile()->setHttpAcceptLanguage(enable ? "DNT=1" : QString());
+    // PrivacyManager sends the headers; the browser forwards this signal
     emit doNotTrackChanged(enable);
 }
 
 void CustomizationEngine::setThirdPartyCookiesPolicy(QWebEngineProfile::ThirdPartyCookiesPolicy policy)
 {
-    m_webView->page()->profile()->setThirdPartyCookiePolicy(policy);
+    // PrivacyManager's cookie filter enforces it; the browser forwards this signal
     emit thirdPartyCookiesPolicyChanged(policy);
 }
 
@@ -0,0 +1,139 @@
+// DevToolsProtocol.cpp
+
+#include "DevToolsProtocol.h"
+#include <QJsonDocument>
+#include <QNetworkAccessManager>
+#include <QNetworkProxy>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QUrl>
+#include <QWebSocket>
+
+namespace {
+
+// Either "port" or "address:port"
+QString remoteDebugging()
+{
+    return QString::fromLocal8Bit(qgetenv("QTWEBENGINE_REMOTE_DEBUGGING"));
+}
+
+} // namespace
+
+DevToolsProtocol::DevToolsProtocol(QObject *parent)
+    : QObject(parent)
+    , m_network(new QNetworkAccessManager(this))
+    , m_socket(new QWebSocket(QString(), QWebSocketProtocol::VersionLatest, this))
+    , m_connecting(false)
+    , m_nextId(1)
+{
+    // The endpoint is local; a configured browsing proxy must not see it
+    m_network->setProxy(QNetworkProxy::NoProxy);
+    m_socket->setProxy(QNetworkProxy::NoProxy);
+
+    connect(m_socket, &QWebSocket::connected, this, [this]() {
+        m_connecting = false;
+        for (const QByteArray &message : m_queued) {
+            m_socket->sendTextMessage(QString::fromUtf8(message));
+        }
+        m_queued.clear();
+    });
+    connect(m_socket, &QWebSocket::disconnected, this, [this]() {
+        m_connecting = false;
+        failPending(tr("The DevTools connection closed"));
+    });
+    connect(m_socket, QOverload<QAbstractSocket::SocketError>::of(&QWebSocket::error), this, [this]() {
+        if (m_connecting) {
+            m_connecting = false;
+            failPending(m_socket->errorString());
+        }
+    });
+    connect(m_socket, &QWebSocket::textMessageReceived, this, &DevToolsProtocol::handleMessage);
+}
+
+QString DevToolsProtocol::host()
+{
+    const QString value = remoteDebugging();
+    const int colon = value.lastIndexOf(QLatin1Char(':'));
+    return colon > 0 ? value.left(colon) : QStringLiteral("127.0.0.1");
+}
+
+int DevToolsProtocol::port()
+{
+    const QString value = remoteDebugging();
+    return value.mid(value.lastIndexOf(QLatin1Char(':')) + 1).toInt();
+}
+
+void DevToolsProtocol::call(const QString &method, const QJsonObject &params, const Callback &callback)
+{
+    const int id = m_nextId++;
+    QJsonObject command;
+    command["id"] = id;
+    command["method"] = method;
+    command["params"] = params;
+    const QByteArray message = QJsonDocument(command).toJson(QJsonDocument::Compact);
+    m_pending.insert(id, callback);
+
+    if (m_socket->state() == QAbstractSocket::ConnectedState) {
+        m_socket->sendTextMessage(QString::fromUtf8(message));
+    } else {
+        m_queued.append(message);
+        connectToBrowser();
+    }
+}
+
+void DevToolsProtocol::connectToBrowser()
+{
+    if (m_connecting) {
+        return;
+    }
+    if (!port()) {
+        failPending(tr("Remote debugging is not enabled"));
+        return;
+    }
+
+    // The browser target's socket is only listed at /json/version
+    m_connecting = true;
+    QUrl versionUrl;
+    versionUrl.setScheme(QStringLiteral("http"));
+    versionUrl.setHost(host());
+    versionUrl.setPort(port());
+    versionUrl.setPath(QStringLiteral("/json/version"));
+    QNetworkReply *reply = m_network->get(QNetworkRequest(versionUrl));
+    connect(reply, &QNetworkReply::finished, this, [this, reply]() {
+        reply->deleteLater();
+        const QUrl socketUrl(QJsonDocument::fromJson(reply->readAll()).object()["webSocketDebuggerUrl"].toString());
+        if (reply->error() != QNetworkReply::NoError || !socketUrl.isValid()) {
+            m_connecting = false;
+            failPending(tr("DevTools endpoint unavailable: %1").arg(reply->errorString()));
+            return;
+        }
+        m_socket->open(socketUrl);
+    });
+}
+
+void DevToolsProtocol::handleMessage(const QString &message)
+{
+    // Events carry no id and are not subscribed to
+    const QJsonObject reply = QJsonDocument::fromJson(message.toUtf8()).object();
+    const Callback callback = m_pending.take(reply["id"].toInt());
+    if (!callback) {
+        return;
+    }
+    if (reply.contains("error")) {
+        const QString error = reply["error"].toObject()["message"].toString();
+        callback(QJsonObject(), error.isEmpty() ? tr("DevTools command failed") : error);
+    } else {
+        callback(reply["result"].toObject(), QString());
+    }
+}
+
+void DevToolsProtocol::failPending(const QString &error)
+{
+    // Callbacks may issue new calls; those start over
+    const QHash<int, Callback> pending = m_pending;
+    m_pending.clear();
+    m_queued.clear();
+    for (auto it = pending.constBegin(); it != pending.constEnd(); ++it) {
+        it.value()(QJsonObject(), error);
+    }
+}
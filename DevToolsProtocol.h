@@ -0,0 +1,50 @@
+// DevToolsProtocol.h
+
+#ifndef DEVTOOLSPROTOCOL_H
+#define DEVTOOLSPROTOCOL_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QJsonObject>
+#include <QObject>
+#include <QVector>
+#include <functional>
+
+class QNetworkAccessManager;
+class QWebSocket;
+
+// Client for the browser target of Chromium's DevTools protocol, served on
+// the local endpoint QTWEBENGINE_REMOTE_DEBUGGING names. Gives access to
+// what QtWebEngine has no API for, such as clearing one origin's storage.
+// Connects on the first call and keeps the connection open.
+class DevToolsProtocol : public QObject
+{
+    Q_OBJECT
+
+public:
+    // Gets the command's result, or a non-empty error
+    typedef std::function<void(const QJsonObject &result, const QString &error)> Callback;
+
+    explicit DevToolsProtocol(QObject *parent = nullptr);
+
+    // Endpoint from QTWEBENGINE_REMOTE_DEBUGGING; port 0 when not enabled
+    static QString host();
+    static int port();
+
+    void call(const QString &method, const QJsonObject &params, const Callback &callback);
+
+private:
+    void connectToBrowser();
+    void handleMessage(const QString &message);
+    void failPending(const QString &error);
+
+    QNetworkAccessManager *m_network;
+    QWebSocket *m_socket;
+    bool m_connecting;
+    int m_nextId;
+    QHash<int, Callback> m_pending;
+    // Commands waiting for the connection
+    QVector<QByteArray> m_queued;
+};
+
+#endif // DEVTOOLSPROTOCOL_H
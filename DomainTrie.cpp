@@ -0,0 +1,220 @@
+// DomainTrie.cpp
+
+#include "DomainTrie.h"
+#include <QHash>
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+const int MaxLabels = 128;
+
+int compareLabel(const char *a, int aLength, const char *b, int bLength)
+{
+    const int result = memcmp(a, b, size_t(qMin(aLength, bLength)));
+    return result ? result : aLength - bLength;
+}
+
+// |label| points at a length byte followed by the label
+int compareLabel(const char *label, const char *b, int bLength)
+{
+    return compareLabel(label + 1, quint8(label[0]), b, bLength);
+}
+
+} // namespace
+
+DomainTrie::Builder::Builder()
+{
+    m_nodes.append(PendingNode{ -1, QMap<QByteArray, int>() });
+}
+
+bool DomainTrie::Builder::insert(const QByteArray &domain, qint32 value)
+{
+    if (!isValidHost(domain.constData(), domain.size())) {
+        return false;
+    }
+
+    int node = 0;
+    int end = domain.size();
+    while (end > 0) {
+        int begin = end;
+        while (begin > 0 && domain[begin - 1] != '.') {
+            --begin;
+        }
+
+        const QByteArray label = domain.mid(begin, end - begin);
+        int child = m_nodes[node].children.value(label, -1);
+        if (child < 0) {
+            child = m_nodes.size();
+            m_nodes[node].children.insert(label, child);
+            m_nodes.append(PendingNode{ -1, QMap<QByteArray, int>() });
+        }
+        node = child;
+        end = begin - 1;
+    }
+
+    // The first rule for a domain keeps its slot
+    if (m_nodes[node].value < 0) {
+        m_nodes[node].value = value;
+    }
+    return true;
+}
+
+bool DomainTrie::Builder::isEmpty() const
+{
+    return m_nodes.size() == 1;
+}
+
+void DomainTrie::Builder::finish(QVector<Node> &nodes, QByteArray &labels) const
+{
+    nodes.clear();
+    labels.clear();
+    if (isEmpty()) {
+        return;
+    }
+
+    QHash<QByteArray, quint32> internedLabels;
+    QVector<int> order;
+    QVector<QByteArray> nodeLabels;
+    order.reserve(m_nodes.size());
+    nodeLabels.reserve(m_nodes.size());
+    order.append(0);
+    nodeLabels.append(QByteArray());
+
+    // Breadth-first numbering keeps every node's children adjacent
+    nodes.resize(m_nodes.size());
+    for (int i = 0; i < order.size(); ++i) {
+        const PendingNode &pending = m_nodes[order[i]];
+        const QByteArray &label = nodeLabels[i];
+
+        auto interned = internedLabels.constFind(label);
+        if (interned == internedLabels.constEnd()) {
+            // Labels are at most 63 bytes, checked by isValidHost()
+            interned = internedLabels.insert(label, quint32(labels.size()));
+            labels.append(char(label.size()));
+            labels.append(label);
+        }
+
+        Node &node = nodes[i];
+        node.labelOffset = interned.value();
+        node.value = pending.value;
+        node.firstChild = quint32(order.size());
+        node.childCount = quint32(pending.children.size());
+
+        for (auto it = pending.children.constBegin(); it != pending.children.constEnd(); ++it) {
+            order.append(it.value());
+            nodeLabels.append(it.key());
+        }
+    }
+}
+
+DomainTrie::DomainTrie()
+    : m_nodes(nullptr)
+    , m_nodeCount(0)
+    , m_labels(nullptr)
+    , m_labelSize(0)
+{
+}
+
+bool DomainTrie::attach(const Node *nodes, quint32 nodeCount, const char *labels, quint32 labelSize)
+{
+    for (quint32 i = 0; i < nodeCount; ++i) {
+        const Node &node = nodes[i];
+        if (node.labelOffset >= labelSize || quint64(node.labelOffset) + 1 + quint8(labels[node.labelOffset]) > labelSize) {
+            return false;
+        }
+        if (node.childCount && (node.firstChild <= i || quint64(node.firstChild) + node.childCount > nodeCount)) {
+            return false;
+        }
+    }
+
+    m_nodes = nodes;
+    m_nodeCount = nodeCount;
+    m_labels = labels;
+    m_labelSize = labelSize;
+    return true;
+}
+
+bool DomainTrie::isEmpty() const
+{
+    return m_nodeCount == 0;
+}
+
+qint32 DomainTrie::find(const char *host, int length) const
+{
+    qint32 value = -1;
+    findAll(host, length, &value, 1);
+    return value;
+}
+
+int DomainTrie::findAll(const char *host, int length, qint32 *values, int maxValues) const
+{
+    if (!m_nodeCount || maxValues <= 0) {
+        return 0;
+    }
+
+    // Walk from the top-level domain down, remembering every listed suffix
+    qint32 path[MaxLabels];
+    int found = 0;
+    const Node *node = m_nodes;
+    int end = length;
+    while (end > 0) {
+        int begin = end;
+        while (begin > 0 && host[begin - 1] != '.') {
+            --begin;
+        }
+
+        node = findChild(*node, host + begin, end - begin);
+        if (!node) {
+            break;
+        }
+        if (node->value >= 0 && found < MaxLabels) {
+            path[found++] = node->value;
+        }
+        end = begin - 1;
+    }
+
+    const int count = qMin(found, maxValues);
+    for (int i = 0; i < count; ++i) {
+        values[i] = path[found - 1 - i];
+    }
+    return count;
+}
+
+bool DomainTrie::isValidHost(const char *host, int length)
+{
+    if (length <= 0 || length > 253) {
+        return false;
+    }
+
+    int labelLength = 0;
+    for (int i = 0; i < length; ++i) {
+        const char c = host[i];
+        if (c == '.') {
+            if (labelLength == 0) {
+                return false;
+            }
+            labelLength = 0;
+        } else if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' || c == '_') {
+            if (++labelLength > 63) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+    }
+    return labelLength > 0;
+}
+
+const DomainTrie::Node *DomainTrie::findChild(const Node &parent, const char *label, int length) const
+{
+    const Node *first = m_nodes + parent.firstChild;
+    const Node *last = first + parent.childCount;
+    const Node *child = std::lower_bound(first, last, 0, [&](const Node &node, int) {
+        return compareLabel(m_labels + node.labelOffset, label, length) < 0;
+    });
+    if (child != last && compareLabel(m_labels + child->labelOffset, label, length) == 0) {
+        return child;
+    }
+    return nullptr;
+}
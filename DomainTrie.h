@@ -0,0 +1,71 @@
+// DomainTrie.h
+
+#ifndef DOMAINTRIE_H
+#define DOMAINTRIE_H
+
+#include <QByteArray>
+#include <QMap>
+#include <QVector>
+
+// Suffix trie over reversed hostname labels ("ads.example.com" is stored as
+// com -> example -> ads). Answers "is this host or one of its parent
+// domains listed" in one step per label. Nodes are flat 16-byte records
+// whose children are contiguous and sorted, and labels are interned in a
+// shared pool, each after a length byte, so the trie can be stored in and
+// read from a snapshot.
+class DomainTrie
+{
+public:
+    struct Node {
+        // Of the label's length byte
+        quint32 labelOffset;
+        quint32 firstChild;
+        qint32 value;
+        // A hosts list can put far more than 65535 domains under "com"
+        quint32 childCount;
+    };
+
+    class Builder
+    {
+    public:
+        Builder();
+
+        // Returns false for names that are not valid lowercase hostnames
+        bool insert(const QByteArray &domain, qint32 value);
+        bool isEmpty() const;
+        void finish(QVector<Node> &nodes, QByteArray &labels) const;
+
+    private:
+        struct PendingNode {
+            qint32 value;
+            QMap<QByteArray, int> children;
+        };
+
+        QVector<PendingNode> m_nodes;
+    };
+
+    DomainTrie();
+
+    bool attach(const Node *nodes, quint32 nodeCount, const char *labels, quint32 labelSize);
+    bool isEmpty() const;
+
+    // Value of the most specific listed domain that equals or contains
+    // |host|, or -1
+    qint32 find(const char *host, int length) const;
+
+    // Values of all listed domains containing |host|, most specific first.
+    // Returns the number written, at most |maxValues|.
+    int findAll(const char *host, int length, qint32 *values, int maxValues) const;
+
+    static bool isValidHost(const char *host, int length);
+
+private:
+    const Node *findChild(const Node &parent, const char *label, int length) const;
+
+    const Node *m_nodes;
+    quint32 m_nodeCount;
+    const char *m_labels;
+    quint32 m_labelSize;
+};
+
+#endif // DOMAINTRIE_H
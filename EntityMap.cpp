@@ -0,0 +1,260 @@
+// EntityMap.cpp
+
+#include "EntityMap.h"
+#include "PublicSuffixList.h"
+#include "UrlScanner.h"
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QUrl>
+#include <QVector>
+#include <cstring>
+
+namespace {
+
+const quint32 FormatRevision = 1;
+
+enum SectionId : quint32 {
+    SlotSection = 1,
+    DomainOffsetSection,
+    DomainTextSection,
+    NameOffsetSection,
+    NameTextSection
+};
+
+// The registrable domain of |host| as a range, or the host itself when it
+// has none; a trailing dot is left out
+void siteRange(const char *host, int length, int &begin, int &end)
+{
+    end = length > 0 && host[length - 1] == '.' ? length - 1 : length;
+    begin = qMax(0, PublicSuffixList::registrableDomain(host, length));
+}
+
+// Lowercase ACE registrable domain of a listed name such as
+// "*.cdn.example.com", or empty for public suffixes and invalid names
+QByteArray listedDomain(QString name)
+{
+    name = name.trimmed().toLower();
+    if (name.startsWith(QLatin1String("*."))) {
+        name.remove(0, 2);
+    }
+    while (name.startsWith(QLatin1Char('.'))) {
+        name.remove(0, 1);
+    }
+    const QByteArray host = QUrl::toAce(name);
+    if (host.isEmpty()) {
+        return QByteArray();
+    }
+    return PublicSuffixList::registrableDomain(host);
+}
+
+void appendStrings(QStringList &domains, const QJsonValue &value)
+{
+    for (const QJsonValue &domain : value.toArray()) {
+        domains.append(domain.toString());
+    }
+}
+
+} // namespace
+
+QSharedPointer<const EntityMap> EntityMap::compile(const QMap<QString, QStringList> &entities)
+{
+    QVector<QByteArray> names;
+    QVector<QByteArray> domains;
+    QVector<quint32> owners;
+    QHash<QByteArray, int> seen;
+    for (auto it = entities.constBegin(); it != entities.constEnd(); ++it) {
+        const quint32 entity = quint32(names.size());
+        names.append(it.key().toUtf8());
+        for (const QString &name : it.value()) {
+            const QByteArray domain = listedDomain(name);
+            if (domain.isEmpty() || seen.contains(domain)) {
+                continue;
+            }
+            seen.insert(domain, domains.size());
+            domains.append(domain);
+            owners.append(entity);
+        }
+    }
+
+    // At most half full, so a miss usually stops at the first empty slot
+    int slotCount = 2;
+    while (slotCount < 2 * domains.size()) {
+        slotCount *= 2;
+    }
+    QVector<Slot> table(slotCount, Slot{ 0, 0, 0 });
+    const quint32 mask = quint32(slotCount - 1);
+    for (int i = 0; i < domains.size(); ++i) {
+        const quint32 hash = UrlScanner::hashToken(domains[i].constData(), domains[i].size());
+        quint32 index = hash & mask;
+        while (table[int(index)].hash) {
+            index = (index + 1) & mask;
+        }
+        table[int(index)] = Slot{ hash, quint32(i), owners[i] };
+    }
+
+    AdBlockSnapshot::Builder builder;
+    builder.addArray(SlotSection, table);
+    builder.addStringTable(DomainOffsetSection, DomainTextSection, domains);
+    builder.addStringTable(NameOffsetSection, NameTextSection, names);
+
+    QSharedPointer<EntityMap> map(new EntityMap);
+    if (!map->m_snapshot.load(builder.finish(layout()), layout()) || !map->attach()) {
+        return QSharedPointer<const EntityMap>();
+    }
+    return map;
+}
+
+QSharedPointer<const EntityMap> EntityMap::fromJson(const QByteArray &json, QString *error)
+{
+    QJsonParseError parseError;
+    const QJsonDocument document = QJsonDocument::fromJson(json, &parseError);
+    const QJsonValue entitiesValue = document.object().value(QLatin1String("entities"));
+    if (parseError.error != QJsonParseError::NoError || !entitiesValue.isObject()) {
+        if (error) {
+            *error = parseError.error != QJsonParseError::NoError ? parseError.errorString()
+                                                                  : QStringLiteral("no \"entities\" object");
+        }
+        return QSharedPointer<const EntityMap>();
+    }
+
+    QMap<QString, QStringList> entities;
+    const QJsonObject object = entitiesValue.toObject();
+    for (auto it = object.constBegin(); it != object.constEnd(); ++it) {
+        const QJsonObject entity = it.value().toObject();
+        QStringList &domains = entities[it.key()];
+        appendStrings(domains, entity.value(QLatin1String("properties")));
+        appendStrings(domains, entity.value(QLatin1String("resources")));
+    }
+    return compile(entities);
+}
+
+QSharedPointer<const EntityMap> EntityMap::fromSnapshot(const QString &path, quint64 sourceStamp)
+{
+    QSharedPointer<EntityMap> map(new EntityMap);
+    if (!map->m_snapshot.open(path, layout()) || map->m_snapshot.sourceStamp() != sourceStamp || !map->attach()) {
+        return QSharedPointer<const EntityMap>();
+    }
+    return map;
+}
+
+bool EntityMap::writeSnapshot(const QString &path, quint64 sourceStamp) const
+{
+    return m_snapshot.save(path, sourceStamp);
+}
+
+int EntityMap::entityOf(const char *domain, int length) const
+{
+    if (length <= 0) {
+        return -1;
+    }
+    const quint32 hash = UrlScanner::hashToken(domain, length);
+    for (quint32 index = hash & m_mask;; index = (index + 1) & m_mask) {
+        const Slot &slot = m_slots[index];
+        if (!slot.hash) {
+            return -1;
+        }
+        if (slot.hash != hash) {
+            continue;
+        }
+        const quint32 begin = m_domainOffsets[slot.domain];
+        if (m_domainOffsets[slot.domain + 1] - begin == quint32(length)
+            && memcmp(m_domainText + begin, domain, size_t(length)) == 0) {
+            return int(slot.entity);
+        }
+    }
+}
+
+QString EntityMap::entityName(int entity) const
+{
+    if (entity < 0 || quint32(entity) >= m_entityCount) {
+        return QString();
+    }
+    const quint32 begin = m_nameOffsets[entity];
+    return QString::fromUtf8(m_nameText + begin, int(m_nameOffsets[entity + 1] - begin));
+}
+
+bool EntityMap::isSameParty(const char *host, int length, const char *otherHost, int otherLength) const
+{
+    int begin, end, otherBegin, otherEnd;
+    siteRange(host, length, begin, end);
+    siteRange(otherHost, otherLength, otherBegin, otherEnd);
+    if (end - begin == otherEnd - otherBegin && memcmp(host + begin, otherHost + otherBegin, size_t(end - begin)) == 0) {
+        return true;
+    }
+    const int entity = entityOf(host + begin, end - begin);
+    return entity >= 0 && entity == entityOf(otherHost + otherBegin, otherEnd - otherBegin);
+}
+
+int EntityMap::entityCount() const
+{
+    return int(m_entityCount);
+}
+
+int EntityMap::domainCount() const
+{
+    return int(m_domainCount);
+}
+
+qint64 EntityMap::memoryUsage() const
+{
+    return m_snapshot.size();
+}
+
+bool EntityMap::isMapped() const
+{
+    return m_snapshot.isMapped();
+}
+
+bool EntityMap::attach()
+{
+    quint32 slotCount = 0;
+    quint32 domainOffsetCount = 0;
+    quint32 domainTextSize = 0;
+    quint32 nameOffsetCount = 0;
+    quint32 nameTextSize = 0;
+    m_slots = m_snapshot.array<Slot>(SlotSection, &slotCount);
+    m_domainOffsets = m_snapshot.array<quint32>(DomainOffsetSection, &domainOffsetCount);
+    m_domainText = m_snapshot.array<char>(DomainTextSection, &domainTextSize);
+    m_nameOffsets = m_snapshot.array<quint32>(NameOffsetSection, &nameOffsetCount);
+    m_nameText = m_snapshot.array<char>(NameTextSection, &nameTextSize);
+
+    if (!slotCount || (slotCount & (slotCount - 1)) || !domainOffsetCount || !nameOffsetCount) {
+        return false;
+    }
+    m_mask = slotCount - 1;
+    m_domainCount = domainOffsetCount - 1;
+    m_entityCount = nameOffsetCount - 1;
+
+    for (quint32 i = 0; i < m_domainCount; ++i) {
+        if (m_domainOffsets[i] > m_domainOffsets[i + 1]) {
+            return false;
+        }
+    }
+    for (quint32 i = 0; i < m_entityCount; ++i) {
+        if (m_nameOffsets[i] > m_nameOffsets[i + 1]) {
+            return false;
+        }
+    }
+    if (m_domainOffsets[m_domainCount] > domainTextSize || m_nameOffsets[m_entityCount] > nameTextSize) {
+        return false;
+    }
+    quint32 used = 0;
+    for (quint32 i = 0; i < slotCount; ++i) {
+        if (!m_slots[i].hash) {
+            continue;
+        }
+        if (m_slots[i].domain >= m_domainCount || m_slots[i].entity >= m_entityCount) {
+            return false;
+        }
+        ++used;
+    }
+    // A full table would never end a miss
+    return used < slotCount;
+}
+
+quint32 EntityMap::layout()
+{
+    return FormatRevision << 24 | quint32(sizeof(Slot));
+}
@@ -0,0 +1,70 @@
+// EntityMap.h
+
+#ifndef ENTITYMAP_H
+#define ENTITYMAP_H
+
+#include <QByteArray>
+#include <QMap>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+
+#include "AdBlockSnapshot.h"
+
+// Organizations and the registrable domains they own, so that a company's
+// CDN or API domain counts as first-party on its own sites. Compiled into
+// an open-addressing table over domain hashes, which lives in an
+// AdBlockSnapshot and can be mapped from disk on later runs.
+class EntityMap
+{
+public:
+    // Domains by entity name. Each is reduced to its registrable domain;
+    // public suffixes are skipped, and a domain listed under two entities
+    // keeps the first.
+    static QSharedPointer<const EntityMap> compile(const QMap<QString, QStringList> &entities);
+    // An entities.json as published by Disconnect: {"entities": {"Name":
+    // {"properties": [...], "resources": [...]}}}
+    static QSharedPointer<const EntityMap> fromJson(const QByteArray &json, QString *error = nullptr);
+    // Null unless the snapshot at |path| was written for |sourceStamp|
+    static QSharedPointer<const EntityMap> fromSnapshot(const QString &path, quint64 sourceStamp);
+    bool writeSnapshot(const QString &path, quint64 sourceStamp) const;
+
+    // Entity owning the registrable domain |domain|, or -1. |domain| must
+    // be lowercase ACE.
+    int entityOf(const char *domain, int length) const;
+    QString entityName(int entity) const;
+
+    // True when both hosts have the same registrable domain, or their
+    // domains belong to one entity. Hosts must be lowercase ACE.
+    bool isSameParty(const char *host, int length, const char *otherHost, int otherLength) const;
+
+    int entityCount() const;
+    int domainCount() const;
+    qint64 memoryUsage() const;
+    bool isMapped() const;
+
+private:
+    // hash is zero in empty slots
+    struct Slot {
+        quint32 hash;
+        quint32 domain;
+        quint32 entity;
+    };
+
+    EntityMap() = default;
+
+    bool attach();
+    static quint32 layout();
+
+    AdBlockSnapshot m_snapshot;
+    const Slot *m_slots = nullptr;
+    quint32 m_mask = 0;
+    const quint32 *m_domainOffsets = nullptr;
+    const char *m_domainText = nullptr;
+    quint32 m_domainCount = 0;
+    const quint32 *m_nameOffsets = nullptr;
+    const char *m_nameText = nullptr;
+    quint32 m_entityCount = 0;
+};
+
+#endif // ENTITYMAP_H
@@ -0,0 +1,238 @@
+// FilterSubscriptionManager.cpp
+
+#include "FilterSubscriptionManager.h"
+#include <QDir>
+#include <QFile>
+#include <QFutureWatcher>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QSaveFile>
+#include <QSettings>
+#include <QtConcurrent>
+
+namespace {
+
+QStringList splitLines(const QByteArray &data)
+{
+    QStringList lines = QString::fromUtf8(data).split('\n');
+    for (QString &line : lines) {
+        if (line.endsWith('\r')) {
+            line.chop(1);
+        }
+    }
+    return lines;
+}
+
+// Comments and the [Adblock Plus] header never become rules
+bool isRuleLine(const QString &line)
+{
+    const QString text = line.trimmed();
+    return !text.isEmpty() && !text.startsWith('!') && !text.startsWith('[');
+}
+
+} // namespace
+
+FilterSubscriptionManager::FilterSubscriptionManager(const QString &storagePath, QObject *parent)
+    : QObject(parent)
+    , m_networkManager(new QNetworkAccessManager(this))
+    , m_storagePath(storagePath)
+{
+    QDir().mkpath(m_storagePath);
+    loadState();
+}
+
+void FilterSubscriptionManager::addSubscription(const QString &name, const QUrl &url)
+{
+    Subscription &subscription = m_subscriptions[name];
+    if (subscription.url != url) {
+        subscription.url = url;
+        subscription.etag.clear();
+        subscription.lastModified.clear();
+    }
+    saveState();
+}
+
+void FilterSubscriptionManager::removeSubscription(const QString &name)
+{
+    const Subscription subscription = m_subscriptions.take(name);
+    if (subscription.reply) {
+        subscription.reply->abort();
+    }
+    // A running store writes the list back; it is removed once that is done
+    QFile::remove(listPath(name));
+    saveState();
+}
+
+QStringList FilterSubscriptionManager::subscriptions() const
+{
+    return m_subscriptions.keys();
+}
+
+QUrl FilterSubscriptionManager::subscriptionUrl(const QString &name) const
+{
+    return m_subscriptions.value(name).url;
+}
+
+QString FilterSubscriptionManager::listPath(const QString &name) const
+{
+    return m_storagePath + "/" + name + ".txt";
+}
+
+void FilterSubscriptionManager::updateAll()
+{
+    for (const QString &name : m_subscriptions.keys()) {
+        update(name);
+    }
+}
+
+void FilterSubscriptionManager::update(const QString &name)
+{
+    auto it = m_subscriptions.find(name);
+    if (it == m_subscriptions.end() || it->reply || m_storing.contains(name)) {
+        return;
+    }
+
+    QNetworkRequest request(it->url);
+    request.setAttribute(QNetworkRequest::RedirectPolicyAttribute, QNetworkRequest::NoLessSafeRedirectPolicy);
+    // Only ask for a 304 while the local copy the validators describe exists
+    if (QFile::exists(listPath(name))) {
+        if (!it->etag.isEmpty()) {
+            request.setRawHeader("If-None-Match", it->etag);
+        }
+        if (!it->lastModified.isEmpty()) {
+            request.setRawHeader("If-Modified-Since", it->lastModified);
+        }
+    }
+
+    QNetworkReply *reply = m_networkManager->get(request);
+    it->reply = reply;
+    connect(reply, &QNetworkReply::finished, this, [this, name, reply]() {
+        handleReply(name, reply);
+    });
+}
+
+FilterSubscriptionManager::ListDiff FilterSubscriptionManager::storeList(const QString &path, const QByteArray &data)
+{
+    ListDiff diff;
+    diff.lines = splitLines(data);
+
+    QSet<QString> previous;
+    QFile file(path);
+    if (file.open(QIODevice::ReadOnly)) {
+        for (const QString &line : splitLines(file.readAll())) {
+            if (isRuleLine(line)) {
+                previous.insert(line.trimmed());
+            }
+        }
+        file.close();
+    }
+
+    QSet<QString> current;
+    for (const QString &line : diff.lines) {
+        if (!isRuleLine(line)) {
+            continue;
+        }
+        const QString text = line.trimmed();
+        if (current.contains(text)) {
+            continue;
+        }
+        current.insert(text);
+        if (!previous.remove(text)) {
+            diff.added.append(text);
+        }
+    }
+    diff.removed = previous.values();
+
+    QSaveFile output(path);
+    if (output.open(QIODevice::WriteOnly)) {
+        output.write(data);
+        diff.saved = output.commit();
+    }
+    return diff;
+}
+
+void FilterSubscriptionManager::handleReply(const QString &name, QNetworkReply *reply)
+{
+    reply->deleteLater();
+    auto it = m_subscriptions.find(name);
+    if (it == m_subscriptions.end() || it->reply != reply) {
+        return;
+    }
+    it->reply = nullptr;
+
+    if (reply->error() != QNetworkReply::NoError) {
+        emit subscriptionFailed(name, reply->errorString());
+        return;
+    }
+    if (reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 304) {
+        emit subscriptionUnchanged(name);
+        return;
+    }
+
+    const QByteArray etag = reply->rawHeader("ETag");
+    const QByteArray lastModified = reply->rawHeader("Last-Modified");
+    const QByteArray data = reply->readAll();
+    const QUrl url = it->url;
+
+    // Validators are only kept once the matching copy is on disk. The name
+    // stays busy until then, so no second update diffs against a list
+    // that is still being written.
+    m_storing.insert(name);
+    QFutureWatcher<ListDiff> *watcher = new QFutureWatcher<ListDiff>(this);
+    connect(watcher, &QFutureWatcher<ListDiff>::finished, this, [this, name, url, etag, lastModified, watcher]() {
+        const ListDiff diff = watcher->result();
+        watcher->deleteLater();
+        m_storing.remove(name);
+        // Removed, or added back for another list, while this one was stored
+        auto it = m_subscriptions.find(name);
+        if (it == m_subscriptions.end() || it->url != url) {
+            QFile::remove(listPath(name));
+            return;
+        }
+        if (!diff.saved) {
+            emit subscriptionFailed(name, tr("Could not write %1").arg(listPath(name)));
+            return;
+        }
+
+        it->etag = etag;
+        it->lastModified = lastModified;
+        saveState();
+        if (diff.added.isEmpty() && diff.removed.isEmpty()) {
+            emit subscriptionUnchanged(name);
+        } else {
+            emit subscriptionUpdated(name, diff.lines, diff.added, diff.removed);
+        }
+    });
+    watcher->setFuture(QtConcurrent::run(&FilterSubscriptionManager::storeList, listPath(name), data));
+}
+
+void FilterSubscriptionManager::loadState()
+{
+    QSettings settings;
+    settings.beginGroup("adblock/subscriptions");
+    for (const QString &name : settings.childGroups()) {
+        settings.beginGroup(name);
+        Subscription &subscription = m_subscriptions[name];
+        subscription.url = settings.value("url").toUrl();
+        subscription.etag = settings.value("etag").toByteArray();
+        subscription.lastModified = settings.value("lastModified").toByteArray();
+        settings.endGroup();
+    }
+    settings.endGroup();
+}
+
+void FilterSubscriptionManager::saveState() const
+{
+    QSettings settings;
+    settings.beginGroup("adblock/subscriptions");
+    settings.remove("");
+    for (auto it = m_subscriptions.constBegin(); it != m_subscriptions.constEnd(); ++it) {
+        settings.beginGroup(it.key());
+        settings.setValue("url", it.value().url);
+        settings.setValue("etag", it.value().etag);
+        settings.setValue("lastModified", it.value().lastModified);
+        settings.endGroup();
+    }
+    settings.endGroup();
+}
@@ -0,0 +1,76 @@
+// FilterSubscriptionManager.h
+
+#ifndef FILTERSUBSCRIPTIONMANAGER_H
+#define FILTERSUBSCRIPTIONMANAGER_H
+
+#include <QObject>
+#include <QByteArray>
+#include <QMap>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QUrl>
+
+class QNetworkAccessManager;
+class QNetworkReply;
+
+// Keeps local copies of remote filter lists. Updates are conditional
+// (ETag / If-Modified-Since), and a changed list is reported as the lines
+// added and removed since the previous copy so the compiled rules can be
+// patched instead of rebuilt. Diffing and writing happen off the GUI thread.
+class FilterSubscriptionManager : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit FilterSubscriptionManager(const QString &storagePath, QObject *parent = nullptr);
+
+    void addSubscription(const QString &name, const QUrl &url);
+    void removeSubscription(const QString &name);
+    QStringList subscriptions() const;
+    QUrl subscriptionUrl(const QString &name) const;
+
+    // Local copy of the last successfully fetched list
+    QString listPath(const QString &name) const;
+
+public slots:
+    void updateAll();
+    void update(const QString &name);
+
+signals:
+    // |lines| is the complete new list, |added| and |removed| its
+    // difference to the previous copy
+    void subscriptionUpdated(const QString &name, const QStringList &lines,
+                             const QStringList &added, const QStringList &removed);
+    void subscriptionUnchanged(const QString &name);
+    void subscriptionFailed(const QString &name, const QString &error);
+
+private:
+    struct Subscription {
+        QUrl url;
+        QByteArray etag;
+        QByteArray lastModified;
+        QNetworkReply *reply = nullptr;
+    };
+
+    struct ListDiff {
+        bool saved = false;
+        QStringList lines;
+        QStringList added;
+        QStringList removed;
+    };
+
+    static ListDiff storeList(const QString &path, const QByteArray &data);
+    void handleReply(const QString &name, QNetworkReply *reply);
+    void loadState();
+    void saveState() const;
+
+    QNetworkAccessManager *m_networkManager;
+    QString m_storagePath;
+    QMap<QString, Subscription> m_subscriptions;
+    // Lists being diffed and written; kept apart from m_subscriptions so a
+    // name stays busy even when removed and added back meanwhile
+    QSet<QString> m_storing;
+};
+
+#endif // FILTERSUBSCRIPTIONMANAGER_H
@@ -0,0 +1,230 @@
+// FingerprintBenchmark.cpp
+//
+// Page-load benchmark for the fingerprinting shield, not linked into the
+// browser. Build it together with FingerprintShield against
+// QtWebEngineWidgets.
+//
+//   FingerprintBenchmark [--frames 20] [--rounds 30]
+//
+// Loads a generated page with the given number of iframes, with and
+// without the shield, alternating so both see the same conditions. Every
+// frame takes a canvas fingerprint while it loads. Reports load time per
+// frame, the time the shield itself runs in each frame, and what the
+// wrapped canvas readback costs.
+
+#include "FingerprintShield.h"
+#include <QApplication>
+#include <QBuffer>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QTextStream>
+#include <QTimer>
+#include <QVariant>
+#include <QWebEnginePage>
+#include <QWebEngineProfile>
+#include <QWebEngineScript>
+#include <QWebEngineScriptCollection>
+#include <QWebEngineUrlRequestJob>
+#include <QWebEngineUrlScheme>
+#include <QWebEngineUrlSchemeHandler>
+#include <algorithm>
+
+namespace {
+
+const char Scheme[] = "bench";
+const int LoadTimeoutMs = 30 * 1000;
+
+// Each frame draws text and shapes and reads the canvas back, as
+// fingerprinting scripts do
+const char FramePage[] = R"HTML(<!DOCTYPE html>
+<html><body><script>
+var start = performance.now();
+var canvas = document.createElement('canvas');
+canvas.width = 240;
+canvas.height = 60;
+var context = canvas.getContext('2d');
+context.textBaseline = 'top';
+context.font = '14px Arial';
+context.fillStyle = '#f60';
+context.fillRect(125, 1, 62, 20);
+context.fillStyle = '#069';
+context.fillText('Cwm fjordbank glyphs vext quiz', 2, 15);
+window.fingerprint = canvas.toDataURL().length + context.getImageData(0, 0, 240, 60).data.length;
+window.fingerprintMs = performance.now() - start;
+</script></body></html>
+)HTML";
+
+// Serves the top-level page at / and the frames at /frame
+class BenchmarkSchemeHandler : public QWebEngineUrlSchemeHandler
+{
+public:
+    explicit BenchmarkSchemeHandler(int frames, QObject *parent = nullptr)
+        : QWebEngineUrlSchemeHandler(parent)
+        , m_frames(frames)
+    {
+    }
+
+    void requestStarted(QWebEngineUrlRequestJob *job) override
+    {
+        QByteArray page;
+        if (job->requestUrl().path() == QLatin1String("/frame")) {
+            page = FramePage;
+        } else {
+            page = "<!DOCTYPE html>\n<html><body>\n";
+            for (int i = 0; i < m_frames; ++i) {
+                page += "<iframe src=\"/frame?" + QByteArray::number(i) + "\" width=\"60\" height=\"20\"></iframe>\n";
+            }
+            page += "</body></html>\n";
+        }
+        QBuffer *buffer = new QBuffer(job);
+        buffer->setData(page);
+        job->reply("text/html", buffer);
+    }
+
+private:
+    int m_frames;
+};
+
+struct LoadResult {
+    double loadMs = 0;
+    // Summed over the top-level page and its frames
+    double shieldMs = 0;
+    double fingerprintMs = 0;
+    int frames = 0;
+};
+
+bool loadOnce(QWebEnginePage &page, const QUrl &url, LoadResult &result)
+{
+    QEventLoop loop;
+    bool ok = false;
+    QMetaObject::Connection finished = QObject::connect(&page, &QWebEnginePage::loadFinished, &loop, [&](bool success) {
+        ok = success;
+        loop.quit();
+    });
+    QTimer::singleShot(LoadTimeoutMs, &loop, &QEventLoop::quit);
+
+    QElapsedTimer timer;
+    timer.start();
+    page.load(url);
+    loop.exec();
+    result.loadMs = timer.nsecsElapsed() / 1e6;
+    QObject::disconnect(finished);
+    if (!ok) {
+        return false;
+    }
+
+    QVariantList totals;
+    page.runJavaScript(QStringLiteral("(function() {"
+                                      "    var shield = window.shieldMs || 0;"
+                                      "    var fingerprint = 0;"
+                                      "    for (var i = 0; i < frames.length; ++i) {"
+                                      "        shield += frames[i].shieldMs || 0;"
+                                      "        fingerprint += frames[i].fingerprintMs || 0;"
+                                      "    }"
+                                      "    return [shield, fingerprint, frames.length];"
+                                      "})()"),
+                       [&](const QVariant &value) {
+                           totals = value.toList();
+                           loop.quit();
+                       });
+    loop.exec();
+    if (totals.size() != 3) {
+        return false;
+    }
+    result.shieldMs = totals[0].toDouble();
+    result.fingerprintMs = totals[1].toDouble();
+    result.frames = totals[2].toInt();
+    return true;
+}
+
+double median(QVector<double> values)
+{
+    if (values.isEmpty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QWebEngineUrlScheme scheme(Scheme);
+    scheme.setFlags(QWebEngineUrlScheme::SecureScheme);
+    scheme.setSyntax(QWebEngineUrlScheme::Syntax::Host);
+    QWebEngineUrlScheme::registerScheme(scheme);
+
+    QApplication app(argc, argv);
+    QTextStream out(stdout);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Fingerprinting shield page-load benchmark");
+    parser.addHelpOption();
+    QCommandLineOption framesOption("frames", "Iframes on the page", "count", "20");
+    QCommandLineOption roundsOption("rounds", "Loads with and without the shield", "count", "30");
+    parser.addOptions({ framesOption, roundsOption });
+    parser.process(app);
+
+    const int frames = qMax(0, parser.value(framesOption).toInt());
+    const int rounds = qMax(1, parser.value(roundsOption).toInt());
+
+    QWebEngineProfile profile;
+    BenchmarkSchemeHandler handler(frames);
+    profile.installUrlSchemeHandler(Scheme, &handler);
+    QWebEnginePage page(&profile);
+
+    // The browser injects the shield the same way; the timing wrapper
+    // only exists here
+    QWebEngineScript shield;
+    shield.setName("FingerprintShield");
+    shield.setSourceCode(QStringLiteral("var shieldStart = performance.now();\n")
+                         + FingerprintShield::source(0x5eed)
+                         + QStringLiteral("window.shieldMs = performance.now() - shieldStart;\n"));
+    shield.setInjectionPoint(QWebEngineScript::DocumentCreation);
+    shield.setWorldId(QWebEngineScript::MainWorld);
+    shield.setRunsOnSubFrames(true);
+
+    const QUrl url(QStringLiteral("bench://site/"));
+    // One untimed load of each kind warms up the renderer
+    QVector<double> loadMs[2];
+    QVector<double> shieldMs;
+    QVector<double> fingerprintMs[2];
+    int frameCount = 0;
+    for (int round = -1; round < rounds; ++round) {
+        for (int shielded = 0; shielded < 2; ++shielded) {
+            if (shielded) {
+                page.scripts().insert(shield);
+            } else {
+                page.scripts().clear();
+            }
+            LoadResult result;
+            if (!loadOnce(page, url, result)) {
+                out << "load failed\n";
+                return 1;
+            }
+            if (round < 0) {
+                continue;
+            }
+            frameCount = result.frames + 1;
+            loadMs[shielded].append(result.loadMs);
+            fingerprintMs[shielded].append(result.fingerprintMs);
+            if (shielded) {
+                shieldMs.append(result.shieldMs);
+            }
+        }
+    }
+
+    const double plainLoad = median(loadMs[0]);
+    const double shieldedLoad = median(loadMs[1]);
+    out << "page         " << frames << " iframes, " << rounds << " rounds, medians\n";
+    out << "             load ms  per frame ms  fingerprint ms/frame\n";
+    out << "plain     " << qSetFieldWidth(10) << plainLoad << qSetFieldWidth(14) << plainLoad / frameCount
+        << qSetFieldWidth(22) << median(fingerprintMs[0]) / qMax(1, frameCount - 1) << qSetFieldWidth(0) << "\n";
+    out << "shielded  " << qSetFieldWidth(10) << shieldedLoad << qSetFieldWidth(14) << shieldedLoad / frameCount
+        << qSetFieldWidth(22) << median(fingerprintMs[1]) / qMax(1, frameCount - 1) << qSetFieldWidth(0) << "\n";
+    out << "overhead     " << (shieldedLoad - plainLoad) / frameCount << " ms per frame, shield runs "
+        << median(shieldMs) / frameCount << " ms per frame\n";
+    return 0;
+}
@@ -0,0 +1,197 @@
+// FingerprintShield.cpp
+
+#include "FingerprintShield.h"
+
+namespace {
+
+// Runs before any page script. Wrappers keep the originals' names and
+// report their source as native, and every readback of the same content
+// on the same site gets the same noise, so averaging repeated reads does
+// not strip it.
+const char Shield[] = R"JS(
+'use strict';
+function hash(text, value) {
+    for (var i = 0; i < text.length; ++i) {
+        value = Math.imul(value ^ text.charCodeAt(i), 16777619);
+    }
+    return value >>> 0;
+}
+function random(state) {
+    return function() {
+        state = (state + 0x6d2b79f5) | 0;
+        var t = Math.imul(state ^ (state >>> 15), state | 1);
+        t ^= t + Math.imul(t ^ (t >>> 7), t | 61);
+        return ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+    };
+}
+
+// Frames are keyed by the top-level site as well as their own, so an
+// embedded tracker sees different values on every site that embeds it
+var ancestors = location.ancestorOrigins;
+var site = (ancestors && ancestors.length ? ancestors[ancestors.length - 1] : location.origin) + ' ' + location.origin;
+var seed = hash(site, sessionSeed ^ 2166136261);
+
+var natives = new WeakMap();
+var nativeToString = Function.prototype.toString;
+function disguise(wrapper, original) {
+    natives.set(wrapper, original);
+    return wrapper;
+}
+function wrap(proto, name, make) {
+    var descriptor = proto && Object.getOwnPropertyDescriptor(proto, name);
+    if (!descriptor || typeof descriptor.value !== 'function') {
+        return;
+    }
+    var original = descriptor.value;
+    var call = make(original);
+    var methods = { [name]() { return call(this, arguments); } };
+    descriptor.value = disguise(methods[name], original);
+    Object.defineProperty(proto, name, descriptor);
+}
+function replaceGetter(proto, name, value) {
+    var descriptor = proto && Object.getOwnPropertyDescriptor(proto, name);
+    if (!descriptor || !descriptor.get) {
+        return;
+    }
+    var original = descriptor.get;
+    var getters = { get [name]() { return value; } };
+    descriptor.get = disguise(Object.getOwnPropertyDescriptor(getters, name).get, original);
+    Object.defineProperty(proto, name, descriptor);
+}
+wrap(Function.prototype, 'toString', function(original) {
+    return function(self, args) {
+        return original.apply(natives.get(self) || self, args);
+    };
+});
+
+// Flips the low bit of a few colour channels, at places fixed by the
+// site and the image size
+function noisePixels(data, width, height) {
+    var pixels = data.length >> 2;
+    if (!pixels) {
+        return;
+    }
+    var next = random(seed ^ Math.imul(width, 65599) ^ height);
+    var count = Math.min(pixels, 10 + (pixels >> 12));
+    for (var i = 0; i < count; ++i) {
+        data[(next() * pixels | 0) * 4 + (next() * 3 | 0)] ^= 1;
+    }
+}
+
+var createElement = Document.prototype.createElement;
+var getContext = HTMLCanvasElement.prototype.getContext;
+var drawImage = CanvasRenderingContext2D.prototype.drawImage;
+var getImageData = CanvasRenderingContext2D.prototype.getImageData;
+var putImageData = CanvasRenderingContext2D.prototype.putImageData;
+function noisedCopy(canvas) {
+    var width = canvas.width;
+    var height = canvas.height;
+    if (!width || !height || width * height > 16777216) {
+        return canvas;
+    }
+    var copy = createElement.call(document, 'canvas');
+    copy.width = width;
+    copy.height = height;
+    var context = getContext.call(copy, '2d');
+    drawImage.call(context, canvas, 0, 0);
+    var image = getImageData.call(context, 0, 0, width, height);
+    noisePixels(image.data, width, height);
+    putImageData.call(context, image, 0, 0);
+    return copy;
+}
+wrap(HTMLCanvasElement.prototype, 'toDataURL', function(original) {
+    return function(self, args) {
+        return original.apply(noisedCopy(self), args);
+    };
+});
+wrap(HTMLCanvasElement.prototype, 'toBlob', function(original) {
+    return function(self, args) {
+        return original.apply(noisedCopy(self), args);
+    };
+});
+wrap(CanvasRenderingContext2D.prototype, 'getImageData', function(original) {
+    return function(self, args) {
+        var image = original.apply(self, args);
+        noisePixels(image.data, image.width, image.height);
+        return image;
+    };
+});
+
+[window.WebGLRenderingContext, window.WebGL2RenderingContext].forEach(function(type) {
+    if (!type) {
+        return;
+    }
+    wrap(type.prototype, 'getParameter', function(original) {
+        return function(self, args) {
+            // UNMASKED_VENDOR_WEBGL and UNMASKED_RENDERER_WEBGL
+            if (args[0] === 0x9245) {
+                return 'Google Inc.';
+            }
+            if (args[0] === 0x9246) {
+                return 'ANGLE (Generic Renderer)';
+            }
+            return original.apply(self, args);
+        };
+    });
+    wrap(type.prototype, 'readPixels', function(original) {
+        return function(self, args) {
+            var result = original.apply(self, args);
+            if (args[6] instanceof Uint8Array) {
+                noisePixels(args[6], args[2], args[3]);
+            }
+            return result;
+        };
+    });
+});
+
+// Rendered audio is noised once per buffer, below what can be heard
+var noisedChannels = new WeakSet();
+function noiseSamples(data, scale) {
+    var next = random(seed ^ data.length);
+    for (var i = 0; i < data.length; i += 1 + (next() * 64 | 0)) {
+        data[i] += (next() - 0.5) * scale;
+    }
+}
+if (window.AudioBuffer) {
+    wrap(AudioBuffer.prototype, 'getChannelData', function(original) {
+        return function(self, args) {
+            var data = original.apply(self, args);
+            if (!noisedChannels.has(data)) {
+                noisedChannels.add(data);
+                noiseSamples(data, 1e-7);
+            }
+            return data;
+        };
+    });
+    wrap(AudioBuffer.prototype, 'copyFromChannel', function(original) {
+        return function(self, args) {
+            var result = original.apply(self, args);
+            noiseSamples(args[0], 1e-7);
+            return result;
+        };
+    });
+}
+if (window.AnalyserNode) {
+    wrap(AnalyserNode.prototype, 'getFloatFrequencyData', function(original) {
+        return function(self, args) {
+            var result = original.apply(self, args);
+            noiseSamples(args[0], 1e-4);
+            return result;
+        };
+    });
+}
+
+// Common values, so the hardware narrows nothing down
+replaceGetter(Navigator.prototype, 'hardwareConcurrency', [2, 4, 8][seed % 3]);
+replaceGetter(Navigator.prototype, 'deviceMemory', 8);
+)JS";
+
+} // namespace
+
+QString FingerprintShield::source(quint32 sessionSeed)
+{
+    QString script = QStringLiteral("(function(sessionSeed) {\n");
+    script += QLatin1String(Shield);
+    script += QStringLiteral("})(%1);\n").arg(sessionSeed);
+    return script;
+}
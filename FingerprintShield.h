@@ -0,0 +1,21 @@
+// FingerprintShield.h
+
+#ifndef FINGERPRINTSHIELD_H
+#define FINGERPRINTSHIELD_H
+
+#include <QString>
+
+// Page-world script that makes canvas, WebGL, audio and navigator
+// fingerprints useless for tracking. Readbacks get faint noise and the
+// hardware details are replaced, keyed to the session and to the
+// top-level site, so a site sees stable values while two sites cannot
+// match theirs. The source is the same for every page, so it is built
+// once per session.
+class FingerprintShield
+{
+public:
+    // Script for a session whose noise derives from |sessionSeed|
+    static QString source(quint32 sessionSeed);
+};
+
+#endif // FINGERPRINTSHIELD_H
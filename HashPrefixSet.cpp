@@ -0,0 +1,216 @@
+// HashPrefixSet.cpp
+
+#include "HashPrefixSet.h"
+#include <QtAlgorithms>
+#include <algorithm>
+
+namespace {
+
+// Each block's gaps start with their Rice parameter
+const int ParameterBits = 5;
+// The bucket table gets about one entry per block, up to 256 KB
+const int MaxBucketBits = 16;
+
+class BitWriter
+{
+public:
+    explicit BitWriter(QVector<quint64> &words)
+        : m_words(words)
+        , m_position(0)
+    {
+    }
+
+    quint64 position() const
+    {
+        return m_position;
+    }
+
+    // |count| is at most 32
+    void write(quint32 value, int count)
+    {
+        if (!count) {
+            return;
+        }
+        const int shift = int(m_position & 63);
+        if (!shift) {
+            m_words.append(0);
+        }
+        m_words.last() |= quint64(value) << shift;
+        if (shift + count > 64) {
+            m_words.append(quint64(value) >> (64 - shift));
+        }
+        m_position += quint64(count);
+    }
+
+    void writeUnary(quint32 value)
+    {
+        for (; value >= 32; value -= 32) {
+            write(0xffffffffu, 32);
+        }
+        write((1u << value) - 1, int(value) + 1);
+    }
+
+private:
+    QVector<quint64> &m_words;
+    quint64 m_position;
+};
+
+} // namespace
+
+quint32 HashPrefixSet::build(const QVector<quint32> &prefixes, QVector<Block> &blocks, QVector<quint64> &bits)
+{
+    QVector<quint32> unique;
+    unique.reserve(prefixes.size());
+    for (int i = 0; i < prefixes.size(); ++i) {
+        if (unique.isEmpty() || prefixes[i] != unique.last()) {
+            unique.append(prefixes[i]);
+        }
+    }
+
+    blocks.clear();
+    bits.clear();
+    blocks.reserve((unique.size() + BlockSize - 1) / BlockSize);
+    BitWriter writer(bits);
+    for (int begin = 0; begin < unique.size(); begin += BlockSize) {
+        const int end = qMin(begin + BlockSize, unique.size());
+        blocks.append(Block{ unique[begin], quint32(writer.position()) });
+
+        // Gaps are at least one; the parameter keeps every quotient below
+        // twice the block's gap count
+        const quint32 gaps = quint32(end - begin - 1);
+        const quint32 span = unique[end - 1] - unique[begin];
+        const quint32 mean = gaps ? span / gaps : 0;
+        const int parameter = mean > 1 ? 31 - int(qCountLeadingZeroBits(mean)) : 0;
+        writer.write(quint32(parameter), ParameterBits);
+        for (int i = begin + 1; i < end; ++i) {
+            const quint32 gap = unique[i] - unique[i - 1] - 1;
+            writer.writeUnary(gap >> parameter);
+            writer.write(gap & ((quint32(1) << parameter) - 1), parameter);
+        }
+    }
+    // peek() may read one word past the last bit
+    bits.append(0);
+    return quint32(unique.size());
+}
+
+HashPrefixSet::HashPrefixSet()
+    : m_blocks(nullptr)
+    , m_blockCount(0)
+    , m_bucketBits(0)
+    , m_bits(nullptr)
+    , m_wordCount(0)
+    , m_count(0)
+{
+}
+
+bool HashPrefixSet::attach(const Block *blocks, quint32 blockCount, const quint64 *bits, quint32 wordCount, quint32 count)
+{
+    if (blockCount != (quint64(count) + BlockSize - 1) / BlockSize || !wordCount) {
+        return false;
+    }
+    const quint64 bitLimit = (quint64(wordCount) - 1) * 64;
+    for (quint32 i = 0; i < blockCount; ++i) {
+        if (blocks[i].bitOffset >= bitLimit || (i && blocks[i].first <= blocks[i - 1].first)) {
+            return false;
+        }
+    }
+    m_blocks = blocks;
+    m_blockCount = blockCount;
+    m_bucketBits = 0;
+    while (m_bucketBits < MaxBucketBits && (quint32(1) << m_bucketBits) < blockCount) {
+        ++m_bucketBits;
+    }
+    const quint32 bucketCount = quint32(1) << m_bucketBits;
+    m_buckets.resize(int(bucketCount) + 1);
+    quint32 block = 0;
+    for (quint32 bucket = 0; bucket < bucketCount; ++bucket) {
+        const quint64 start = quint64(bucket) << (32 - m_bucketBits);
+        while (block < blockCount && blocks[block].first < start) {
+            ++block;
+        }
+        m_buckets[int(bucket)] = block;
+    }
+    m_buckets[int(bucketCount)] = blockCount;
+    m_bits = bits;
+    m_wordCount = wordCount;
+    m_count = count;
+    return true;
+}
+
+bool HashPrefixSet::contains(quint32 prefix) const
+{
+    if (!m_blockCount) {
+        return false;
+    }
+
+    // Last block starting at or before |prefix|; it is either in the
+    // prefix's bucket or the one before the bucket's first block
+    const quint32 bucket = m_bucketBits ? prefix >> (32 - m_bucketBits) : 0;
+    const quint32 low = m_buckets[int(bucket)];
+    const Block *block = std::upper_bound(m_blocks + (low ? low - 1 : 0), m_blocks + m_buckets[int(bucket) + 1], prefix,
+                                          [](quint32 value, const Block &block) { return value < block.first; });
+    if (block == m_blocks) {
+        return false;
+    }
+    --block;
+    if (block->first == prefix) {
+        return true;
+    }
+
+    const quint64 bitLimit = (quint64(m_wordCount) - 1) * 64;
+    const quint32 index = quint32(block - m_blocks);
+    const int gaps = int(qMin<quint64>(BlockSize, quint64(m_count) - quint64(index) * BlockSize)) - 1;
+    quint64 position = block->bitOffset;
+    const int parameter = int(peek(position) & ((1u << ParameterBits) - 1));
+    const quint64 remainderMask = (Q_UINT64_C(1) << parameter) - 1;
+    position += ParameterBits;
+
+    quint64 value = block->first;
+    for (int i = 0; i < gaps; ++i) {
+        if (position >= bitLimit) {
+            return false;
+        }
+        quint64 window = peek(position);
+        quint64 quotient = 0;
+        while (window == ~Q_UINT64_C(0)) {
+            quotient += 64;
+            position += 64;
+            if (position >= bitLimit) {
+                return false;
+            }
+            window = peek(position);
+        }
+        const unsigned run = qCountTrailingZeroBits(~window);
+        quotient += run;
+        position += run + 1;
+
+        // The remainder is usually in the same window
+        quint64 remainder;
+        if (run + 1 + unsigned(parameter) < 64) {
+            remainder = (window >> (run + 1)) & remainderMask;
+        } else if (!parameter) {
+            remainder = 0;
+        } else if (position + quint64(parameter) <= bitLimit) {
+            remainder = peek(position) & remainderMask;
+        } else {
+            return false;
+        }
+        position += quint64(parameter);
+
+        value += ((quotient << parameter) | remainder) + 1;
+        if (value >= prefix) {
+            return value == prefix;
+        }
+    }
+    return false;
+}
+
+quint32 HashPrefixSet::count() const
+{
+    return m_count;
+}
+
+qint64 HashPrefixSet::size() const
+{
+    return qint64(m_blockCount) * qint64(sizeof(Block)) + qint64(m_wordCount) * 8 + qint64(m_buckets.size()) * 4;
+}
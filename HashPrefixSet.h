@@ -0,0 +1,58 @@
+// HashPrefixSet.h
+
+#ifndef HASHPREFIXSET_H
+#define HASHPREFIXSET_H
+
+#include <QVector>
+
+// Sorted set of 32-bit hash prefixes, stored as Rice-coded gaps. Prefixes
+// are cut into blocks of BlockSize; each block records its first prefix
+// and where its gaps start, so a lookup is a binary search over the blocks
+// and decoding at most one block; a table over the top prefix bits narrows
+// the search to a block or two. Each block picks its own Rice parameter
+// from its mean gap, which bounds every unary part. Uniform prefixes cost
+// about log2(2^32 / count) + 4 bits each, index included.
+class HashPrefixSet
+{
+public:
+    static const int BlockSize = 32;
+
+    struct Block {
+        quint32 first;
+        quint32 bitOffset;
+    };
+
+    // |prefixes| must be sorted; duplicates are dropped. Returns the
+    // number of prefixes stored.
+    static quint32 build(const QVector<quint32> &prefixes, QVector<Block> &blocks, QVector<quint64> &bits);
+
+    HashPrefixSet();
+
+    bool attach(const Block *blocks, quint32 blockCount, const quint64 *bits, quint32 wordCount, quint32 count);
+
+    bool contains(quint32 prefix) const;
+    quint32 count() const;
+    qint64 size() const;
+
+private:
+    // Up to 64 bits starting at |position|; the last word is padding
+    quint64 peek(quint64 position) const
+    {
+        const quint64 word = position >> 6;
+        const int shift = int(position & 63);
+        // Shifted in two steps so a zero |shift| needs no branch
+        return (m_bits[word] >> shift) | ((m_bits[word + 1] << 1) << (63 - shift));
+    }
+
+    const Block *m_blocks;
+    quint32 m_blockCount;
+    // First block of each range of the top m_bucketBits prefix bits, and
+    // a closing m_blockCount
+    QVector<quint32> m_buckets;
+    int m_bucketBits;
+    const quint64 *m_bits;
+    quint32 m_wordCount;
+    quint32 m_count;
+};
+
+#endif // HASHPREFIXSET_H
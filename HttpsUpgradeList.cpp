@@ -0,0 +1,248 @@
+// HttpsUpgradeList.cpp
+
+#include "HttpsUpgradeList.h"
+#include "DomainTrie.h"
+#include <QMap>
+#include <QPair>
+#include <QtAlgorithms>
+#include <cstring>
+
+namespace {
+
+struct BuiltInHost {
+    const char *host;
+    bool includeSubdomains;
+};
+
+// Top-level domains whose registry requires HTTPS for every name, and
+// sites preloaded with their subdomains. Failing to reach one of these
+// over HTTPS is an error, never a reason to fall back to plain http.
+const BuiltInHost BuiltInHosts[] = {
+    { "android", true }, { "app", true }, { "bank", true }, { "boo", true }, { "chrome", true },
+    { "dad", true }, { "day", true }, { "dev", true }, { "eat", true }, { "esq", true },
+    { "fly", true }, { "foo", true }, { "gle", true }, { "gmail", true }, { "google", true },
+    { "hangout", true }, { "how", true }, { "ing", true }, { "insurance", true }, { "meet", true },
+    { "meme", true }, { "mov", true }, { "new", true }, { "nexus", true }, { "page", true },
+    { "phd", true }, { "prof", true }, { "rsvp", true }, { "search", true }, { "soy", true },
+    { "youtube", true }, { "zip", true },
+    { "accounts.google.com", true }, { "mail.google.com", true }, { "drive.google.com", true },
+    { "amazon.com", false }, { "apple.com", false }, { "bitbucket.org", true }, { "cloudflare.com", true },
+    { "dropbox.com", true }, { "duckduckgo.com", true }, { "eff.org", true }, { "facebook.com", true },
+    { "github.com", true }, { "githubusercontent.com", true }, { "gitlab.com", true },
+    { "instagram.com", true }, { "letsencrypt.org", true }, { "linkedin.com", false },
+    { "microsoft.com", false }, { "mozilla.org", true }, { "paypal.com", true }, { "proton.me", true },
+    { "protonmail.com", true }, { "reddit.com", false }, { "signal.org", true }, { "stackoverflow.com", true },
+    { "stripe.com", true }, { "torproject.org", true }, { "twitter.com", true }, { "wikimedia.org", true },
+    { "wikipedia.org", true }, { "wordpress.com", true }, { "x.com", true }, { "yahoo.com", false }
+};
+
+struct PendingNode {
+    bool listed = false;
+    bool includeSubdomains = false;
+    QMap<QByteArray, int> children;
+};
+
+void setBit(QVector<quint64> &bits, int bit)
+{
+    if (bit / 64 >= bits.size()) {
+        bits.resize(bit / 64 + 1);
+    }
+    bits[bit / 64] |= Q_UINT64_C(1) << (bit % 64);
+}
+
+} // namespace
+
+QSharedPointer<const HttpsUpgradeList> HttpsUpgradeList::build(const QVector<Entry> &entries)
+{
+    // Pointer trie first; the succinct one is written from it breadth-first
+    QVector<PendingNode> pending(1);
+    for (const Entry &entry : entries) {
+        QByteArray host = entry.host;
+        if (host.endsWith('.')) {
+            host.chop(1);
+        }
+        if (!DomainTrie::isValidHost(host.constData(), host.size())) {
+            continue;
+        }
+        int node = 0;
+        for (int end = host.size(); end > 0;) {
+            const int begin = host.lastIndexOf('.', end - 1) + 1;
+            const QByteArray label = host.mid(begin, end - begin);
+            int child = pending[node].children.value(label, -1);
+            if (child < 0) {
+                child = pending.size();
+                pending[node].children.insert(label, child);
+                pending.append(PendingNode());
+            }
+            node = child;
+            end = begin - 1;
+        }
+        pending[node].listed = true;
+        pending[node].includeSubdomains |= entry.includeSubdomains;
+    }
+
+    QSharedPointer<HttpsUpgradeList> list(new HttpsUpgradeList);
+    QVector<QPair<int, QByteArray>> queue;
+    queue.append(qMakePair(0, QByteArray()));
+    quint32 bit = 0;
+    setBit(list->m_shape, int(bit));
+    bit += 2;
+    for (int i = 0; i < queue.size(); ++i) {
+        const PendingNode &node = pending[queue[i].first];
+        const QByteArray &label = queue[i].second;
+        if (i % SampleInterval == 0) {
+            list->m_labelSamples.append(quint32(list->m_labels.size()));
+        }
+        list->m_labels.append(label);
+        list->m_labelLengths.append(quint8(label.size()));
+        if (node.listed) {
+            setBit(list->m_listed, i);
+            ++list->m_hostCount;
+        }
+        if (node.includeSubdomains) {
+            setBit(list->m_subdomains, i);
+        }
+        // QMap keeps the children sorted, as findChild() expects
+        for (auto it = node.children.constBegin(); it != node.children.constEnd(); ++it) {
+            queue.append(qMakePair(it.value(), it.key()));
+            setBit(list->m_shape, int(bit++));
+        }
+        ++bit;
+    }
+    list->m_shapeBits = bit;
+    list->m_nodeCount = queue.size();
+    list->m_shape.resize(int((bit + 63) / 64));
+    list->m_listed.resize(list->m_shape.size());
+    list->m_subdomains.resize(list->m_shape.size());
+
+    quint32 ones = 0;
+    for (quint64 word : list->m_shape) {
+        list->m_ranks.append(ones);
+        ones += quint32(qPopulationCount(word));
+    }
+
+    list->m_labels.squeeze();
+    return list;
+}
+
+QSharedPointer<const HttpsUpgradeList> HttpsUpgradeList::builtIn()
+{
+    QVector<Entry> entries;
+    for (const BuiltInHost &host : BuiltInHosts) {
+        entries.append(Entry{ QByteArray(host.host), host.includeSubdomains });
+    }
+    return build(entries);
+}
+
+bool HttpsUpgradeList::contains(const char *host, int length) const
+{
+    if (length > 0 && host[length - 1] == '.') {
+        --length;
+    }
+
+    int node = 0;
+    for (int end = length; end > 0;) {
+        int begin = end;
+        while (begin > 0 && host[begin - 1] != '.') {
+            --begin;
+        }
+        node = findChild(node, host + begin, end - begin);
+        if (node < 0) {
+            return false;
+        }
+        if (begin > 0 && testBit(m_listed, node) && testBit(m_subdomains, node)) {
+            return true;
+        }
+        end = begin - 1;
+    }
+    return node > 0 && testBit(m_listed, node);
+}
+
+int HttpsUpgradeList::hostCount() const
+{
+    return m_hostCount;
+}
+
+qint64 HttpsUpgradeList::memoryUsage() const
+{
+    return qint64(sizeof(HttpsUpgradeList))
+        + (m_shape.size() + m_listed.size() + m_subdomains.size()) * qint64(sizeof(quint64))
+        + (m_ranks.size() + m_labelSamples.size()) * qint64(sizeof(quint32))
+        + m_labels.size() + m_labelLengths.size();
+}
+
+quint32 HttpsUpgradeList::rank1(quint32 position) const
+{
+    const int word = int(position / 64);
+    if (word >= m_ranks.size()) {
+        return m_ranks.isEmpty() ? 0 : m_ranks.last() + quint32(qPopulationCount(m_shape.last()));
+    }
+    const quint64 below = position % 64 ? m_shape[word] & ((Q_UINT64_C(1) << (position % 64)) - 1) : 0;
+    return m_ranks[word] + quint32(qPopulationCount(below));
+}
+
+quint32 HttpsUpgradeList::select0(quint32 count) const
+{
+    // Last word with fewer than |count| zeros before it
+    int low = 0;
+    int high = m_ranks.size() - 1;
+    while (low < high) {
+        const int middle = (low + high + 1) / 2;
+        if (quint32(middle) * 64 - m_ranks[middle] < count) {
+            low = middle;
+        } else {
+            high = middle - 1;
+        }
+    }
+
+    quint32 remaining = count - (quint32(low) * 64 - m_ranks[low]);
+    quint64 zeros = ~m_shape[low];
+    while (--remaining) {
+        zeros &= zeros - 1;
+    }
+    return quint32(low) * 64 + quint32(qCountTrailingZeroBits(zeros));
+}
+
+int HttpsUpgradeList::findChild(int node, const char *label, int length) const
+{
+    // Node n's children follow the (n + 1)-th zero
+    const quint32 begin = select0(quint32(node) + 1) + 1;
+    if (begin >= m_shapeBits || !(m_shape[int(begin / 64)] & (Q_UINT64_C(1) << (begin % 64)))) {
+        return -1;
+    }
+    const int first = int(rank1(begin));
+    const int count = int(select0(quint32(node) + 2) - begin);
+
+    // Children are sorted by label, as QByteArray orders them
+    auto compare = [this, label, length](int child) {
+        const int sample = child / SampleInterval;
+        quint32 offset = m_labelSamples[sample];
+        for (int i = sample * SampleInterval; i < child; ++i) {
+            offset += m_labelLengths[i];
+        }
+        const int childLength = m_labelLengths[child];
+        const int common = memcmp(m_labels.constData() + offset, label, size_t(qMin(childLength, length)));
+        return common ? common : childLength - length;
+    };
+
+    int low = first;
+    int high = first + count - 1;
+    while (low <= high) {
+        const int middle = (low + high) / 2;
+        const int order = compare(middle);
+        if (order == 0) {
+            return middle;
+        }
+        if (order < 0) {
+            low = middle + 1;
+        } else {
+            high = middle - 1;
+        }
+    }
+    return -1;
+}
+
+bool HttpsUpgradeList::testBit(const QVector<quint64> &bits, int bit)
+{
+    return bits[bit / 64] & (Q_UINT64_C(1) << (bit % 64));
+}
@@ -0,0 +1,63 @@
+// HttpsUpgradeList.h
+
+#ifndef HTTPSUPGRADELIST_H
+#define HTTPSUPGRADELIST_H
+
+#include <QByteArray>
+#include <QSharedPointer>
+#include <QVector>
+
+// Hosts known to serve everything over HTTPS, such as HSTS preloaded
+// domains and whole HTTPS-only top-level domains. Stored as a LOUDS trie
+// over reversed hostname labels: the tree shape takes two bits per label
+// and the labels are packed back to back, so the list costs little more
+// than its text.
+class HttpsUpgradeList
+{
+public:
+    struct Entry {
+        QByteArray host;
+        bool includeSubdomains;
+    };
+
+    // Hosts that are not valid lowercase hostnames are skipped
+    static QSharedPointer<const HttpsUpgradeList> build(const QVector<Entry> &entries);
+    // The list compiled into the browser
+    static QSharedPointer<const HttpsUpgradeList> builtIn();
+
+    // True when |host| is listed, or one of its parents is listed together
+    // with its subdomains. |host| must be lowercase.
+    bool contains(const char *host, int length) const;
+
+    int hostCount() const;
+    qint64 memoryUsage() const;
+
+private:
+    // Every SampleInterval-th node records where its label starts
+    static const int SampleInterval = 32;
+
+    HttpsUpgradeList() = default;
+
+    // Ones in the shape bits before |position|
+    quint32 rank1(quint32 position) const;
+    // Position of the |count|-th zero, counting from one
+    quint32 select0(quint32 count) const;
+    int findChild(int node, const char *label, int length) const;
+    static bool testBit(const QVector<quint64> &bits, int bit);
+
+    // "10", then for each node in breadth-first order a one per child and
+    // a closing zero. Node n is the n-th one, the root being node zero.
+    QVector<quint64> m_shape;
+    // Ones before each word of m_shape
+    QVector<quint32> m_ranks;
+    quint32 m_shapeBits = 0;
+    QVector<quint64> m_listed;
+    QVector<quint64> m_subdomains;
+    QByteArray m_labels;
+    QVector<quint8> m_labelLengths;
+    QVector<quint32> m_labelSamples;
+    int m_nodeCount = 0;
+    int m_hostCount = 0;
+};
+
+#endif // HTTPSUPGRADELIST_H
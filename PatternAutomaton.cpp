@@ -0,0 +1,271 @@
+// PatternAutomaton.cpp
+
+#include "PatternAutomaton.h"
+#include <algorithm>
+
+namespace {
+
+// Rows are 4 bytes per symbol class; this bounds the cache at a few MB
+const quint32 MaxRows = 8192;
+
+enum SectionOffset : quint32 {
+    NodeSection,
+    EdgeSection,
+    OutputSection,
+    ClassSection
+};
+
+} // namespace
+
+PatternAutomaton::Builder::Builder()
+    : m_patternCount(0)
+{
+    m_nodes.append(PendingNode());
+}
+
+void PatternAutomaton::Builder::addPattern(const QByteArray &literal)
+{
+    int node = 0;
+    for (char c : literal) {
+        int child = m_nodes[node].children.value(quint8(c), -1);
+        if (child < 0) {
+            child = m_nodes.size();
+            m_nodes[node].children.insert(quint8(c), child);
+            m_nodes.append(PendingNode());
+        }
+        node = child;
+    }
+    m_nodes[node].outputs.append(quint32(m_patternCount++));
+}
+
+int PatternAutomaton::Builder::patternCount() const
+{
+    return m_patternCount;
+}
+
+void PatternAutomaton::Builder::finish(AdBlockSnapshot::Builder &builder, quint32 firstSection) const
+{
+    QVector<Node> nodes;
+    QVector<Edge> edges;
+    QVector<quint32> outputs;
+    QByteArray classes(256, '\0');
+
+    if (m_patternCount) {
+        // Bytes no literal uses share class 0, which always leads to the root.
+        // Only 255 other classes fit in a byte, so if every byte value is
+        // used the last ones share class 255; the filters behind a reported
+        // pattern are matched in full, so the extra candidates are harmless.
+        int classCount = 1;
+        QVector<bool> used(256, false);
+        for (const PendingNode &node : m_nodes) {
+            for (auto it = node.children.constBegin(); it != node.children.constEnd(); ++it) {
+                used[it.key()] = true;
+            }
+        }
+        for (int c = 0; c < 256; ++c) {
+            if (used[c]) {
+                classes[c] = char(qMin(classCount++, 255));
+            }
+        }
+
+        // Rebuild the trie over classes, merging the subtries of bytes that
+        // share one so that no node has two edges with the same symbol
+        QVector<PendingNode> trie(1);
+        QVector<QVector<int>> sources(1, QVector<int>(1, 0));
+        for (int i = 0; i < trie.size(); ++i) {
+            QMap<quint8, QVector<int>> groups;
+            for (int source : sources[i]) {
+                const PendingNode &node = m_nodes[source];
+                trie[i].outputs += node.outputs;
+                for (auto it = node.children.constBegin(); it != node.children.constEnd(); ++it) {
+                    groups[quint8(classes[it.key()])].append(it.value());
+                }
+            }
+            for (auto it = groups.constBegin(); it != groups.constEnd(); ++it) {
+                trie[i].children.insert(it.key(), trie.size());
+                trie.append(PendingNode());
+                sources.append(it.value());
+            }
+        }
+
+        // Breadth-first numbering puts every failure target before the
+        // nodes that use it
+        QVector<int> order;
+        QVector<int> number(trie.size(), -1);
+        QVector<int> fail(trie.size(), 0);
+        QVector<QVector<quint32>> merged(trie.size());
+        order.reserve(trie.size());
+        order.append(0);
+        number[0] = 0;
+        merged[0] = trie[0].outputs;
+        for (int i = 0; i < order.size(); ++i) {
+            const int parent = order[i];
+            const PendingNode &node = trie[parent];
+            for (auto it = node.children.constBegin(); it != node.children.constEnd(); ++it) {
+                const int child = it.value();
+                int target = 0;
+                if (parent) {
+                    int f = fail[parent];
+                    while (f && !trie[f].children.contains(it.key())) {
+                        f = fail[f];
+                    }
+                    target = trie[f].children.value(it.key(), 0);
+                }
+                fail[child] = target;
+
+                // Literals ending here include those ending at the failure
+                // target; the root's own outputs are reported once per scan
+                merged[child] = trie[child].outputs;
+                if (target) {
+                    merged[child] += merged[target];
+                }
+                number[child] = order.size();
+                order.append(child);
+            }
+        }
+
+        nodes.reserve(order.size());
+        for (int pending : order) {
+            const PendingNode &node = trie[pending];
+            Node record;
+            record.firstEdge = quint32(edges.size());
+            record.fail = quint32(number[fail[pending]]);
+            record.outputBegin = quint32(outputs.size());
+            record.outputCount = quint32(merged[pending].size());
+            record.edgeCount = quint16(node.children.size());
+            record.reserved = 0;
+            for (auto it = node.children.constBegin(); it != node.children.constEnd(); ++it) {
+                edges.append(Edge{ quint32(number[it.value()]), it.key() });
+            }
+            outputs += merged[pending];
+            nodes.append(record);
+        }
+    }
+
+    builder.addArray(firstSection + NodeSection, nodes);
+    builder.addArray(firstSection + EdgeSection, edges);
+    builder.addArray(firstSection + OutputSection, outputs);
+    builder.addSection(firstSection + ClassSection, classes.constData(), classes.size());
+}
+
+PatternAutomaton::PatternAutomaton()
+    : m_nodes(nullptr)
+    , m_nodeCount(0)
+    , m_edges(nullptr)
+    , m_edgeCount(0)
+    , m_outputs(nullptr)
+    , m_outputCount(0)
+    , m_classes(nullptr)
+    , m_classCount(0)
+    , m_rows(nullptr)
+    , m_rowCount(0)
+{
+}
+
+PatternAutomaton::~PatternAutomaton()
+{
+    releaseRows();
+}
+
+bool PatternAutomaton::attach(const AdBlockSnapshot &snapshot, quint32 firstSection, quint32 patternCount)
+{
+    releaseRows();
+
+    quint32 classSize = 0;
+    m_nodes = snapshot.array<Node>(firstSection + NodeSection, &m_nodeCount);
+    m_edges = snapshot.array<Edge>(firstSection + EdgeSection, &m_edgeCount);
+    m_outputs = snapshot.array<quint32>(firstSection + OutputSection, &m_outputCount);
+    m_classes = snapshot.array<quint8>(firstSection + ClassSection, &classSize);
+    if (classSize != 256) {
+        return false;
+    }
+    m_classCount = *std::max_element(m_classes, m_classes + classSize) + 1u;
+
+    // Failure links must point to earlier nodes, or scans could loop
+    for (quint32 i = 0; i < m_nodeCount; ++i) {
+        const Node &node = m_nodes[i];
+        if ((i ? node.fail >= i : node.fail != 0)
+            || quint64(node.firstEdge) + node.edgeCount > m_edgeCount
+            || quint64(node.outputBegin) + node.outputCount > m_outputCount) {
+            return false;
+        }
+    }
+    for (quint32 i = 0; i < m_edgeCount; ++i) {
+        if (m_edges[i].target >= m_nodeCount || !m_edges[i].symbol || m_edges[i].symbol >= m_classCount) {
+            return false;
+        }
+    }
+    for (quint32 i = 0; i < m_outputCount; ++i) {
+        if (m_outputs[i] >= patternCount) {
+            return false;
+        }
+    }
+
+    if (m_nodeCount) {
+        m_rows = new QAtomicPointer<quint32>[m_nodeCount];
+    }
+    return true;
+}
+
+bool PatternAutomaton::isEmpty() const
+{
+    return m_nodeCount == 0;
+}
+
+qint64 PatternAutomaton::memoryUsage() const
+{
+    return qint64(m_nodeCount) * qint64(sizeof(QAtomicPointer<quint32>))
+        + qint64(m_rowCount.loadRelaxed()) * m_classCount * qint64(sizeof(quint32));
+}
+
+quint32 PatternAutomaton::fillRow(quint32 state, quint8 symbol) const
+{
+    // Past the cap the remaining states keep walking failure links
+    if (m_rowCount.fetchAndAddRelaxed(1) >= MaxRows) {
+        m_rowCount.fetchAndAddRelaxed(quint32(-1));
+        return transition(state, symbol);
+    }
+
+    quint32 *row = new quint32[m_classCount];
+    for (quint32 c = 0; c < m_classCount; ++c) {
+        row[c] = transition(state, quint8(c));
+    }
+    if (!m_rows[state].testAndSetOrdered(nullptr, row)) {
+        // Another thread published the same row first
+        delete[] row;
+        m_rowCount.fetchAndAddRelaxed(quint32(-1));
+    }
+    return m_rows[state].loadAcquire()[symbol];
+}
+
+quint32 PatternAutomaton::transition(quint32 state, quint8 symbol) const
+{
+    if (!symbol) {
+        return 0;
+    }
+    for (;;) {
+        const Node &node = m_nodes[state];
+        const Edge *begin = m_edges + node.firstEdge;
+        const Edge *end = begin + node.edgeCount;
+        const Edge *edge = std::lower_bound(begin, end, quint32(symbol), [](const Edge &e, quint32 s) {
+            return e.symbol < s;
+        });
+        if (edge != end && edge->symbol == symbol) {
+            return edge->target;
+        }
+        if (!state) {
+            return 0;
+        }
+        state = node.fail;
+    }
+}
+
+void PatternAutomaton::releaseRows()
+{
+    for (quint32 i = 0; m_rows && i < m_nodeCount; ++i) {
+        delete[] m_rows[i].loadRelaxed();
+    }
+    delete[] m_rows;
+    m_rows = nullptr;
+    m_rowCount.storeRelaxed(0);
+}
@@ -0,0 +1,127 @@
+// PatternAutomaton.h
+
+#ifndef PATTERNAUTOMATON_H
+#define PATTERNAUTOMATON_H
+
+#include <QAtomicInteger>
+#include <QAtomicPointer>
+#include <QByteArray>
+#include <QMap>
+#include <QVector>
+
+#include "AdBlockSnapshot.h"
+
+// Aho-Corasick automaton over one required literal per pattern. A single
+// pass over a text reports every pattern whose literal occurs in it, so
+// rules that cannot be indexed by token are no longer tried one by one.
+// Patterns without a literal are reported for every text. The trie and its
+// failure links are stored in a snapshot; full DFA rows, which save the
+// failure walks, are only built for the states texts actually reach.
+class PatternAutomaton
+{
+public:
+    struct Node {
+        quint32 firstEdge;
+        quint32 fail;
+        quint32 outputBegin;
+        quint32 outputCount;
+        quint16 edgeCount;
+        quint16 reserved;
+    };
+
+    struct Edge {
+        quint32 target;
+        quint32 symbol;
+    };
+
+    class Builder
+    {
+    public:
+        Builder();
+
+        // Adds pattern number patternCount(). Literals are matched as is,
+        // so callers lowercase them along with the texts.
+        void addPattern(const QByteArray &literal);
+        int patternCount() const;
+        void finish(AdBlockSnapshot::Builder &builder, quint32 firstSection) const;
+
+    private:
+        struct PendingNode {
+            QMap<quint8, int> children;
+            QVector<quint32> outputs;
+        };
+
+        QVector<PendingNode> m_nodes;
+        int m_patternCount;
+    };
+
+    static const quint32 SectionCount = 4;
+
+    PatternAutomaton();
+    ~PatternAutomaton();
+
+    bool attach(const AdBlockSnapshot &snapshot, quint32 firstSection, quint32 patternCount);
+    bool isEmpty() const;
+    qint64 memoryUsage() const;
+
+    // Calls |found| with the number of every pattern whose literal occurs
+    // in |text|; a pattern may be reported more than once
+    template <typename Callback>
+    void scan(const char *text, int length, Callback found) const
+    {
+        if (!m_nodeCount) {
+            return;
+        }
+        report(m_nodes[0], found);
+        quint32 state = 0;
+        for (int i = 0; i < length; ++i) {
+            const quint8 symbol = m_classes[quint8(text[i])];
+            if (!symbol && !state) {
+                continue;
+            }
+            state = next(state, symbol);
+            if (state) {
+                report(m_nodes[state], found);
+            }
+        }
+    }
+
+private:
+    template <typename Callback>
+    void report(const Node &node, Callback &found) const
+    {
+        for (quint32 i = 0; i < node.outputCount; ++i) {
+            found(m_outputs[node.outputBegin + i]);
+        }
+    }
+
+    quint32 next(quint32 state, quint8 symbol) const
+    {
+        if (const quint32 *row = m_rows[state].loadAcquire()) {
+            return row[symbol];
+        }
+        return fillRow(state, symbol);
+    }
+
+    quint32 fillRow(quint32 state, quint8 symbol) const;
+    quint32 transition(quint32 state, quint8 symbol) const;
+    void releaseRows();
+
+    const Node *m_nodes;
+    quint32 m_nodeCount;
+    const Edge *m_edges;
+    quint32 m_edgeCount;
+    const quint32 *m_outputs;
+    quint32 m_outputCount;
+    const quint8 *m_classes;
+    quint32 m_classCount;
+
+    // Lazily built DFA rows, shared by all threads scanning with this
+    // automaton; a row is published once and never changes
+    QAtomicPointer<quint32> *m_rows;
+    mutable QAtomicInteger<quint32> m_rowCount;
+
+    Q_DISABLE_COPY(PatternAutomaton)
+};
+
+#endif // PATTERNAUTOMATON_H
@@ -1,29 +1,163 @@
 // PrivacyManager.cpp
 
 #include "PrivacyManager.h"
+#include "AdBlockInterceptor.h"
+#include "CookieManager.h"
+#include "DevToolsProtocol.h"
+#include "FilterSubscriptionManager.h"
+#include "FingerprintShield.h"
+#include "QueryParameterFilter.h"
+#include "RequestHeaderRules.h"
+#include "SafeBrowsingService.h"
+#include "HttpsUpgradeList.h"
+#include "SurrogateSchemeHandler.h"
+#include <QWebEngineCookieStore>
 #include <QWebEngineView>
 #include <QWebEnginePage>
 #include <QWebEngineProfile>
 #include <QWebEngineSettings>
 #include <QNetworkProxy>
 #include <QDateTime>
+#include <QCryptographicHash>
+#include <QDir>
 #include <QFile>
+#include <QFileInfo>
+#include <QStandardPaths>
+#include <QUrl>
 #include <QTextStream>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
+#include <QFutureWatcher>
+#include <QRandomGenerator>
+#include <QTimer>
+#include <QtConcurrent>
+#include <algorithm>
 
-PrivacyManager::PrivacyManager(QWebEngineView *webView, QObject *parent)
+namespace {
+
+const int StatisticsMergeInterval = 10 * 1000;
+// Long enough for the hit counts to settle between promotions
+const int HotTierInterval = 5 * 60 * 1000;
+// How long a host that failed over https is loaded over plain http
+const qint64 HttpsUpgradeFailureTtl = 24 * 60 * 60 * 1000;
+// Organizations and their domains, in Disconnect's entities.json format
+const char EntityListPath[] = ":/privacy/entities.json";
+
+QString countName(const QString &name)
+{
+    return name;
+}
+
+QString countName(const QByteArray &name)
+{
+    return QString::fromUtf8(name);
+}
+
+// The |limit| largest counts, largest first
+template <typename Key>
+QJsonArray topCounts(const QHash<Key, quint64> &counts, int limit)
+{
+    QVector<QPair<quint64, Key>> sorted;
+    sorted.reserve(counts.size());
+    for (auto it = counts.constBegin(); it != counts.constEnd(); ++it) {
+        sorted.append(qMakePair(it.value(), it.key()));
+    }
+    const int count = qMin(limit, sorted.size());
+    std::partial_sort(sorted.begin(), sorted.begin() + count, sorted.end(),
+                      [](const QPair<quint64, Key> &a, const QPair<quint64, Key> &b) { return a.first > b.first; });
+
+    QJsonArray array;
+    for (int i = 0; i < count; ++i) {
+        QJsonObject entry;
+        entry["name"] = countName(sorted[i].second);
+        entry["blocked"] = qint64(sorted[i].first);
+        array.append(entry);
+    }
+    return array;
+}
+
+QJsonObject statisticsWindow(const AdBlockStatistics::Totals &totals)
+{
+    QJsonObject window;
+    window["blocked"] = qint64(totals.blocked);
+    window["bytes_avoided_estimate"] = qint64(totals.bytesAvoided);
+    window["top_sites"] = topCounts(totals.sites, 10);
+    window["lists"] = topCounts(totals.lists, totals.lists.size());
+    window["top_rules"] = topCounts(totals.rules, 20);
+    window["rules_hit"] = totals.rules.size();
+    return window;
+}
+
+} // namespace
+
+PrivacyManager::PrivacyManager(QWebEngineView *webView, QWebEngineProfile *profile, QObject *parent)
     : QObject(parent)
     , m_webView(webView)
+    , m_profile(profile)
     , m_vpnActive(false)
     , m_adBlockingEnabled(false)
     , m_httpsOnlyMode(false)
+    , m_safeBrowsingEnabled(false)
+    , m_safeBrowsing(nullptr)
     , m_doNotTrack(false)
+    , m_stripTrackingParameters(false)
+    , m_trackingParameterNames(0)
     , m_fingerprintingProtection(false)
     , m_savePasswordsEnabled(true)
+    , m_adBlockInterceptor(new AdBlockInterceptor(this))
+    , m_prefilterFalsePositiveRate(AdBlockEngine::PrefilterOptions().falsePositiveRate)
+    , m_prefilterMaxBytes(AdBlockEngine::PrefilterOptions().maxBytes)
+    , m_surrogateHandler(new SurrogateSchemeHandler(this))
+    , m_subscriptions(nullptr)
+    , m_deltaRunning(false)
+    , m_hotTierRunning(false)
+    , m_acceptCookies(true)
+    , m_blockThirdPartyCookies(false)
+    , m_cookieFilter(new CookieFilter)
+    , m_devTools(new DevToolsProtocol(this))
+    , m_dataCleaner(new BrowsingDataCleaner(profile, &m_cookieIndex, m_devTools, this))
 {
     initializeAdBlockLists();
+
+    // Fold the interceptor's per-thread block counts into the report windows
+    QTimer *statisticsTimer = new QTimer(this);
+    connect(statisticsTimer, &QTimer::timeout, this, [this]() {
+        m_adBlockInterceptor->statistics().merge(QDateTime::currentMSecsSinceEpoch());
+    });
+    statisticsTimer->start(StatisticsMergeInterval);
+
+    // The store reports every cookie once loaded, then each change
+    QWebEngineCookieStore *cookieStore = m_profile->cookieStore();
+    connect(cookieStore, &QWebEngineCookieStore::cookieAdded, this, [this](const QNetworkCookie &cookie) {
+        // The session copy replaces it and comes back through here
+        if (keepCookieForSession(cookie)) {
+            return;
+        }
+        m_cookieIndex.insert(cookie);
+        emit cookiesChanged();
+    });
+    connect(cookieStore, &QWebEngineCookieStore::cookieRemoved, this, [this](const QNetworkCookie &cookie) {
+        if (m_cookieIndex.remove(cookie)) {
+            emit cookiesChanged();
+        }
+    });
+    cookieStore->loadAllCookies();
+    QSharedPointer<CookieFilter> cookieFilter = m_cookieFilter;
+    cookieStore->setCookieFilter([cookieFilter](const QWebEngineCookieStore::FilterRequest &request) {
+        return cookieFilter->accept(request);
+    });
+
+    connect(m_dataCleaner, &BrowsingDataCleaner::progress, this, &PrivacyManager::browsingDataClearProgress);
+    connect(m_dataCleaner, &BrowsingDataCleaner::finished, this, &PrivacyManager::browsingDataCleared);
+    connect(m_dataCleaner, &BrowsingDataCleaner::historyRemovalRequested, this, &PrivacyManager::historyRemovalRequested);
+    connect(m_dataCleaner, &BrowsingDataCleaner::storageUsageAvailable, this, &PrivacyManager::storageUsageAvailable);
+
+    QTimer *hotTierTimer = new QTimer(this);
+    connect(hotTierTimer, &QTimer::timeout, this, &PrivacyManager::promoteHotFilters);
+    hotTierTimer->start(HotTierInterval);
+
+    loadEntityMap();
 }
 
 void PrivacyManager::toggleVPN()
@@ -44,10 +178,10 @@ void PrivacyManager::enableAdBlocking(bool enable)
     m_adBlockingEnabled = enable;
     if (enable) {
         applyAdBlockRules();
-    } else {
-        // Remove ad blocking rules
-        m_webView->page()->profile()->setUrlRequestInterceptor(nullptr);
     }
+    // The interceptor stays installed; requests in flight keep the rule
+    // set they started with
+    m_adBlockInterceptor->setEnabled(enable);
     emit adBlockingStatusChanged(enable);
 }
 
@@ -58,40 +192,346 @@ bool PrivacyManager::isAdBlockingEnabled() const
 
 void PrivacyManager::updateAdBlockList(const QStringList &rules)
 {
-    m_adBlockLists["custom"] = rules;
+    loadAdBlockLists();
+    QSet<QString> previous;
+    for (const QString &rule : m_adBlockLists.value("custom")) {
+        previous.insert(rule.trimmed());
+    }
+
+    QStringList added;
+    for (const QString &rule : rules) {
+        const QString text = rule.trimmed();
+        if (!text.isEmpty() && !previous.remove(text)) {
+            added.append(text);
+        }
+    }
+    previous.remove(QString());
+    applyAdBlockDelta("custom", rules, added, previous.values());
+}
+
+void PrivacyManager::setAdBlockPrefilter(double falsePositiveRate, qint64 maxBytes)
+{
+    if (falsePositiveRate == m_prefilterFalsePositiveRate && maxBytes == m_prefilterMaxBytes) {
+        return;
+    }
+    m_prefilterFalsePositiveRate = falsePositiveRate;
+    m_prefilterMaxBytes = maxBytes;
+    m_adBlockEngine.clear();
     if (m_adBlockingEnabled) {
         applyAdBlockRules();
     }
 }
 
+double PrivacyManager::adBlockPrefilterFalsePositiveRate() const
+{
+    return m_prefilterFalsePositiveRate;
+}
+
+qint64 PrivacyManager::adBlockPrefilterMaxBytes() const
+{
+    return m_prefilterMaxBytes;
+}
+
+void PrivacyManager::setSiteAdBlockingEnabled(const QString &host, bool enabled)
+{
+    const QByteArray site = QUrl::toAce(host.toLower());
+    if (site.isEmpty() || enabled != m_adBlockAllowedSites.contains(site)) {
+        return;
+    }
+    if (enabled) {
+        m_adBlockAllowedSites.remove(site);
+    } else {
+        m_adBlockAllowedSites.insert(site);
+    }
+    m_adBlockInterceptor->setAllowedSites(m_adBlockAllowedSites);
+}
+
+bool PrivacyManager::isSiteAdBlockingEnabled(const QString &host) const
+{
+    return !AdBlockInterceptor::isAllowedSite(m_adBlockAllowedSites, QUrl::toAce(host.toLower()));
+}
+
+void PrivacyManager::addAdBlockSubscription(const QString &name, const QUrl &url)
+{
+    m_subscriptions->addSubscription(name, url);
+    m_adBlockSources["subscription:" + name] = m_subscriptions->listPath(name);
+    m_subscriptions->update(name);
+}
+
+void PrivacyManager::updateAdBlockSubscriptions()
+{
+    m_subscriptions->updateAll();
+}
+
+QString PrivacyManager::cosmeticStyleSheet(const QUrl &url)
+{
+    if (!m_adBlockingEnabled || !m_adBlockEngine || !isSiteAdBlockingEnabled(url.host())) {
+        return QString();
+    }
+
+    refreshCosmeticCaches();
+    const QString host = url.host();
+    auto it = m_cosmeticStyleSheets.constFind(host);
+    if (it != m_cosmeticStyleSheets.constEnd()) {
+        return it.value();
+    }
+
+    // Site-specific sheets embed their own copy of the generic rules
+    const int maxCachedStyleSheets = 32;
+    if (m_cosmeticStyleSheets.size() >= maxCachedStyleSheets) {
+        m_cosmeticStyleSheets.clear();
+    }
+
+    const QByteArray encodedHost = url.host(QUrl::FullyEncoded).toLower().toLatin1();
+    QString css;
+    if (!m_cosmeticEngine->cosmeticFilters().hostStyleSheet(encodedHost.constData(), encodedHost.size(), css)) {
+        css = m_genericStyleSheet;
+    }
+    m_cosmeticStyleSheets.insert(host, css);
+    return css;
+}
+
+QString PrivacyManager::scriptletBundle(const QUrl &url)
+{
+    if (!m_adBlockingEnabled || !m_adBlockEngine || !isSiteAdBlockingEnabled(url.host())) {
+        return QString();
+    }
+
+    refreshCosmeticCaches();
+    const QString host = url.host();
+    auto it = m_scriptletBundles.constFind(host);
+    if (it != m_scriptletBundles.constEnd()) {
+        return it.value();
+    }
+
+    const int maxCachedBundles = 32;
+    if (m_scriptletBundles.size() >= maxCachedBundles) {
+        m_scriptletBundles.clear();
+    }
+
+    const QByteArray encodedHost = url.host(QUrl::FullyEncoded).toLower().toLatin1();
+    QString bundle;
+    if (!m_cosmeticEngine->cosmeticFilters().hostScriptlets(encodedHost.constData(), encodedHost.size(), bundle)) {
+        bundle.clear();
+    }
+    m_scriptletBundles.insert(host, bundle);
+    return bundle;
+}
+
+void PrivacyManager::refreshCosmeticCaches()
+{
+    // Stylesheets and scriptlets are cached per host until the rules are
+    // recompiled
+    if (m_cosmeticEngine != m_adBlockEngine) {
+        m_cosmeticEngine = m_adBlockEngine;
+        m_genericStyleSheet = m_cosmeticEngine->cosmeticFilters().genericStyleSheet();
+        m_cosmeticStyleSheets.clear();
+        m_scriptletBundles.clear();
+    }
+}
+
 void PrivacyManager::clearCookies()
 {
-    m_webView->page()->profile()->cookieStore()->deleteAllCookies();
+    m_profile->cookieStore()->deleteAllCookies();
+    m_cookieIndex.clear();
+    emit cookiesChanged();
+}
+
+QVector<QNetworkCookie> PrivacyManager::siteCookies(const QString &host) const
+{
+    return m_cookieIndex.cookies(CookieIndex::siteOf(QUrl::toAce(host)));
+}
+
+int PrivacyManager::siteCookieCount(const QString &host) const
+{
+    return m_cookieIndex.count(CookieIndex::siteOf(QUrl::toAce(host)));
+}
+
+void PrivacyManager::clearSiteCookies(const QString &host)
+{
+    // Taken out of the index now; the store's removals then find nothing
+    const QVector<QNetworkCookie> cookies = m_cookieIndex.takeSite(CookieIndex::siteOf(QUrl::toAce(host)));
+    if (cookies.isEmpty()) {
+        return;
+    }
+    QWebEngineCookieStore *cookieStore = m_profile->cookieStore();
+    for (const QNetworkCookie &cookie : cookies) {
+        cookieStore->deleteCookie(cookie);
+    }
+    emit cookiesChanged();
+}
+
+const CookieIndex &PrivacyManager::cookieIndex() const
+{
+    return m_cookieIndex;
 }
 
 void PrivacyManager::setAcceptCookies(bool accept)
 {
-    m_webView->settings()->setAttribute(QWebEngineSettings::JavascriptCanAccessClipboard, accept);
-    emit cookiePolicyChanged();
+    m_acceptCookies = accept;
+    applyCookiePolicy();
+}
+
+bool PrivacyManager::isAcceptCookiesEnabled() const
+{
+    return m_acceptCookies;
 }
 
 void PrivacyManager::setThirdPartyCookiesPolicy(QWebEngineProfile::ThirdPartyCookiesPolicy policy)
 {
-    m_webView->page()->profile()->setThirdPartyCookiePolicy(policy);
+    m_blockThirdPartyCookies = policy != QWebEngineProfile::AllowThirdPartyCookies;
+    applyCookiePolicy();
+}
+
+bool PrivacyManager::isThirdPartyCookieBlockingEnabled() const
+{
+    return m_blockThirdPartyCookies;
+}
+
+void PrivacyManager::setSiteCookiePolicy(const QString &host, CookiePolicy::SiteRule rule)
+{
+    const QByteArray site = QUrl::toAce(host.toLower());
+    if (site.isEmpty()) {
+        return;
+    }
+    m_siteCookieRules.insert(site, rule);
+    applyCookiePolicy();
+
+    // Cookies the site already keeps lose their expiry now
+    if (rule == CookiePolicy::SessionOnlyCookies) {
+        const QVector<QNetworkCookie> cookies = m_cookieIndex.cookies(CookieIndex::siteOf(site));
+        for (const QNetworkCookie &cookie : cookies) {
+            keepCookieForSession(cookie);
+        }
+    }
+}
+
+void PrivacyManager::removeSiteCookiePolicy(const QString &host)
+{
+    if (m_siteCookieRules.remove(QUrl::toAce(host.toLower()))) {
+        applyCookiePolicy();
+    }
+}
+
+void PrivacyManager::applyCookiePolicy()
+{
+    CookiePolicy::Settings settings;
+    settings.acceptCookies = m_acceptCookies;
+    settings.blockThirdParty = m_blockThirdPartyCookies;
+    settings.sites = m_siteCookieRules;
+    settings.entities = m_entityMap;
+    m_cookieFilter->setPolicy(CookiePolicy::compile(settings));
     emit cookiePolicyChanged();
 }
 
-void PrivacyManager::clearBrowsingData()
+void PrivacyManager::loadEntityMap()
+{
+    // Mapped from the cache while the bundled list is unchanged; compiled
+    // from it on first run, off the GUI thread
+    const QString sourcePath = QString::fromLatin1(EntityListPath);
+    const QString cachePath = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    QDir().mkpath(cachePath);
+    const QString snapshotPath = cachePath + "/entities.snapshot";
+    const quint64 stamp = entityListStamp();
+
+    const QSharedPointer<const EntityMap> entities = EntityMap::fromSnapshot(snapshotPath, stamp);
+    if (entities) {
+        applyEntityMap(entities);
+        return;
+    }
+
+    QFutureWatcher<QSharedPointer<const EntityMap>> *watcher = new QFutureWatcher<QSharedPointer<const EntityMap>>(this);
+    connect(watcher, &QFutureWatcher<QSharedPointer<const EntityMap>>::finished, this, [this, watcher]() {
+        watcher->deleteLater();
+        if (const QSharedPointer<const EntityMap> compiled = watcher->result()) {
+            applyEntityMap(compiled);
+        }
+    });
+    watcher->setFuture(QtConcurrent::run([sourcePath, snapshotPath, stamp]() {
+        QFile file(sourcePath);
+        if (!file.open(QIODevice::ReadOnly)) {
+            return QSharedPointer<const EntityMap>();
+        }
+        QString error;
+        const QSharedPointer<const EntityMap> compiled = EntityMap::fromJson(file.readAll(), &error);
+        if (!compiled) {
+            qWarning() << "Cannot read entity list" << sourcePath << error;
+        } else if (!compiled->writeSnapshot(snapshotPath, stamp)) {
+            qWarning() << "Failed to write entity map to" << snapshotPath;
+        }
+        return compiled;
+    }));
+}
+
+quint64 PrivacyManager::entityListStamp() const
+{
+    QFileInfo info(QString::fromLatin1(EntityListPath));
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArray::number(info.exists() ? info.size() : -1));
+    hash.addData(QByteArray::number(info.lastModified().toMSecsSinceEpoch()));
+
+    const QByteArray digest = hash.result();
+    quint64 stamp = 0;
+    memcpy(&stamp, digest.constData(), sizeof(stamp));
+    return stamp;
+}
+
+void PrivacyManager::applyEntityMap(const QSharedPointer<const EntityMap> &entities)
 {
-    clearCache();
+    m_entityMap = entities;
+    m_adBlockInterceptor->setEntityMap(entities);
+    applyCookiePolicy();
+}
+
+bool PrivacyManager::keepCookieForSession(const QNetworkCookie &cookie)
+{
+    if (cookie.isSessionCookie()) {
+        return false;
+    }
+    QByteArray host = cookie.domain().toUtf8().toLower();
+    while (host.startsWith('.')) {
+        host.remove(0, 1);
+    }
+    if (m_cookieFilter->policy().siteRule(host.constData(), host.size()) != CookiePolicy::SessionOnlyCookies) {
+        return false;
+    }
+    QNetworkCookie sessionCookie(cookie);
+    sessionCookie.setExpirationDate(QDateTime());
+    m_profile->cookieStore()->setCookie(sessionCookie);
+    return true;
+}
+
+void PrivacyManager::clearBrowsingData(const QVector<QUrl> &knownOrigins)
+{
+    BrowsingDataCleaner::Request request;
+    request.knownOrigins = knownOrigins;
+    request.types |= BrowsingDataCleaner::Cache;
+    clearBrowsingData(request);
     clearHistory();
     clearDownloads();
-    clearCookies();
+}
+
+bool PrivacyManager::clearBrowsingData(const BrowsingDataCleaner::Request &request)
+{
+    if (!m_dataCleaner->start(request)) {
+        return false;
+    }
+    // The cleaner has taken the sites it needs from the index
+    if (request.origins.isEmpty() && (request.types & BrowsingDataCleaner::Cookies)) {
+        m_cookieIndex.clear();
+        emit cookiesChanged();
+    }
+    return true;
+}
+
+void PrivacyManager::requestStorageUsage(const QUrl &origin)
+{
+    m_dataCleaner->requestStorageUsage(origin);
 }
 
 void PrivacyManager::clearCache()
 {
-    m_webView->page()->profile()->clearHttpCache();
+    m_profile->clearHttpCache();
 }
 
 void PrivacyManager::clearHistory()
@@ -107,19 +547,96 @@ void PrivacyManager::clearDownloads()
 void PrivacyManager::setHttpsOnlyMode(bool enable)
 {
     m_httpsOnlyMode = enable;
-    // In a real implementation, this would involve intercepting and upgrading http requests to https
+    if (enable && !m_httpsKnownHosts) {
+        m_httpsKnownHosts = HttpsUpgradeList::builtIn();
+    }
+    // The interceptor upgrades http requests before they leave
+    m_adBlockInterceptor->setHttpsOnly(enable, m_httpsKnownHosts);
+    if (enable) {
+        installInterceptor();
+    }
     emit httpsOnlyModeChanged(enable);
 }
 
+bool PrivacyManager::handleHttpsUpgradeFailure(const QUrl &httpUrl)
+{
+    if (!m_httpsOnlyMode || httpUrl.scheme() != QLatin1String("http")) {
+        return false;
+    }
+    const QByteArray host = httpUrl.host(QUrl::FullyEncoded).toLatin1().toLower();
+    // Known HTTPS hosts never fall back; a failure there is a real error
+    if (host.isEmpty() || (m_httpsKnownHosts && m_httpsKnownHosts->contains(host.constData(), host.size()))) {
+        return false;
+    }
+
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    for (auto it = m_httpsUpgradeFailures.begin(); it != m_httpsUpgradeFailures.end();) {
+        if (it.value() <= now) {
+            it = m_httpsUpgradeFailures.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (m_httpsUpgradeFailures.contains(host)) {
+        // Already let through; the http load itself failed
+        return false;
+    }
+    m_httpsUpgradeFailures.insert(host, now + HttpsUpgradeFailureTtl);
+    m_adBlockInterceptor->setHttpsUpgradeFailures(m_httpsUpgradeFailures);
+    return true;
+}
+
 bool PrivacyManager::isHttpsOnlyModeEnabled() const
 {
     return m_httpsOnlyMode;
 }
 
+bool PrivacyManager::upgradesToHttps(const QUrl &url) const
+{
+    return m_httpsOnlyMode && m_adBlockInterceptor->upgradesToHttps(url);
+}
+
+void PrivacyManager::setSafeBrowsingEnabled(bool enable)
+{
+    m_safeBrowsingEnabled = enable;
+    if (enable && !m_safeBrowsing) {
+        m_safeBrowsing = new SafeBrowsingService(
+            QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/safebrowsing", this);
+        connect(m_safeBrowsing, &SafeBrowsingService::updated, this, &PrivacyManager::safeBrowsingListUpdated);
+        connect(m_safeBrowsing, &SafeBrowsingService::updateFailed, this, &PrivacyManager::safeBrowsingUpdateFailed);
+    }
+    if (m_safeBrowsing) {
+        // Updates stop while it is off; the list stays on disk
+        m_safeBrowsing->setUpdateUrl(enable ? m_safeBrowsingUpdateUrl : QUrl());
+    }
+    emit safeBrowsingChanged(enable);
+}
+
+bool PrivacyManager::isSafeBrowsingEnabled() const
+{
+    return m_safeBrowsingEnabled;
+}
+
+void PrivacyManager::setSafeBrowsingUpdateUrl(const QUrl &url)
+{
+    m_safeBrowsingUpdateUrl = url;
+    if (m_safeBrowsingEnabled) {
+        m_safeBrowsing->setUpdateUrl(url);
+    }
+}
+
+QString PrivacyManager::safeBrowsingMatch(const QUrl &url) const
+{
+    if (!m_safeBrowsingEnabled) {
+        return QString();
+    }
+    return QString::fromLatin1(m_safeBrowsing->match(url));
+}
+
 void PrivacyManager::setDoNotTrack(bool enable)
 {
     m_doNotTrack = enable;
-    m_webView->page()->profile()->setHttpAcceptLanguage(enable ? "DNT=1" : QString());
+    applyRequestHeaders();
     emit doNotTrackChanged(enable);
 }
 
@@ -128,10 +645,124 @@ bool PrivacyManager::isDoNotTrackEnabled() const
     return m_doNotTrack;
 }
 
+void PrivacyManager::setRequestHeaders(const QString &hostPattern, const QMap<QString, QString> &headers)
+{
+    const QByteArray pattern = hostPattern == QLatin1String("*") ? QByteArray("*") : QUrl::toAce(hostPattern.toLower());
+    if (pattern.isEmpty()) {
+        return;
+    }
+    QMap<QByteArray, QByteArray> encoded;
+    for (auto it = headers.constBegin(); it != headers.constEnd(); ++it) {
+        encoded.insert(it.key().toLatin1(), it.value().toUtf8());
+    }
+    if (encoded.isEmpty()) {
+        m_requestHeaders.remove(pattern);
+    } else {
+        m_requestHeaders.insert(pattern, encoded);
+    }
+    applyRequestHeaders();
+}
+
+QMap<QString, QString> PrivacyManager::requestHeaders(const QString &hostPattern) const
+{
+    const QByteArray pattern = hostPattern == QLatin1String("*") ? QByteArray("*") : QUrl::toAce(hostPattern.toLower());
+    const QMap<QByteArray, QByteArray> encoded = m_requestHeaders.value(pattern);
+    QMap<QString, QString> headers;
+    for (auto it = encoded.constBegin(); it != encoded.constEnd(); ++it) {
+        headers.insert(QString::fromLatin1(it.key()), QString::fromUtf8(it.value()));
+    }
+    return headers;
+}
+
+void PrivacyManager::setPageRequestHeaders(QObject *page, const QMap<QString, QString> &headers)
+{
+    QMap<QByteArray, QByteArray> encoded;
+    for (auto it = headers.constBegin(); it != headers.constEnd(); ++it) {
+        encoded.insert(it.key().toLatin1(), it.value().toUtf8());
+    }
+    if (encoded.isEmpty()) {
+        if (!m_pageRequestHeaders.remove(page)) {
+            return;
+        }
+    } else {
+        m_pageRequestHeaders.insert(page, encoded);
+        connect(page, &QObject::destroyed, this, &PrivacyManager::removePageRequestHeaders, Qt::UniqueConnection);
+    }
+    applyRequestHeaders();
+}
+
+void PrivacyManager::removePageRequestHeaders(QObject *page)
+{
+    if (m_pageRequestHeaders.remove(page)) {
+        applyRequestHeaders();
+    }
+}
+
+void PrivacyManager::setTrackingParameterStripping(bool enable)
+{
+    m_stripTrackingParameters = enable;
+    applyQueryParameterFilter();
+}
+
+bool PrivacyManager::isTrackingParameterStrippingEnabled() const
+{
+    return m_stripTrackingParameters;
+}
+
+void PrivacyManager::applyQueryParameterFilter()
+{
+    if (!m_stripTrackingParameters) {
+        m_trackingParameterNames = 0;
+        m_adBlockInterceptor->setQueryParameterFilter(QSharedPointer<const QueryParameterFilter>());
+        return;
+    }
+
+    // The engine drops $removeparam rules, so they are read from the lists
+    QueryParameterFilter::Builder builder;
+    builder.addBuiltIns();
+    loadAdBlockLists();
+    for (auto it = m_adBlockLists.constBegin(); it != m_adBlockLists.constEnd(); ++it) {
+        for (const QString &line : it.value()) {
+            if (line.contains(QLatin1String("$removeparam="))) {
+                builder.addRule(line);
+            }
+        }
+    }
+    QSharedPointer<const QueryParameterFilter> filter = builder.finish();
+    m_trackingParameterNames = filter->nameCount();
+    m_adBlockInterceptor->setQueryParameterFilter(filter);
+    installInterceptor();
+}
+
+void PrivacyManager::applyRequestHeaders()
+{
+    QMap<QByteArray, QMap<QByteArray, QByteArray>> rules = m_requestHeaders;
+    for (auto page = m_pageRequestHeaders.constBegin(); page != m_pageRequestHeaders.constEnd(); ++page) {
+        for (auto it = page.value().constBegin(); it != page.value().constEnd(); ++it) {
+            rules["*"].insert(it.key(), it.value());
+        }
+    }
+    if (m_doNotTrack) {
+        rules["*"].insert("DNT", "1");
+        rules["*"].insert("Sec-GPC", "1");
+    }
+    // Only requests to matching hosts carry them, rather than every
+    // request from the profile
+    QSharedPointer<const RequestHeaderRules> compiled = RequestHeaderRules::compile(rules);
+    m_adBlockInterceptor->setRequestHeaders(compiled);
+    if (!compiled->isEmpty()) {
+        installInterceptor();
+    }
+}
+
 void PrivacyManager::enableFingerprintingProtection(bool enable)
 {
     m_fingerprintingProtection = enable;
-    // In a real implementation, this would involve modifying or blocking certain JavaScript APIs
+    // One source for the whole session; pages pick it up on their next
+    // navigation
+    if (enable && m_fingerprintShield.isEmpty()) {
+        m_fingerprintShield = FingerprintShield::source(QRandomGenerator::system()->generate());
+    }
     emit fingerprintingProtectionChanged(enable);
 }
 
@@ -140,6 +771,32 @@ bool PrivacyManager::isFingerprintingProtectionEnabled() const
     return m_fingerprintingProtection;
 }
 
+void PrivacyManager::setSiteFingerprintingProtectionEnabled(const QString &host, bool enabled)
+{
+    const QByteArray site = QUrl::toAce(host.toLower());
+    if (site.isEmpty()) {
+        return;
+    }
+    if (enabled) {
+        m_fingerprintingExemptSites.remove(site);
+    } else {
+        m_fingerprintingExemptSites.insert(site);
+    }
+}
+
+bool PrivacyManager::isSiteFingerprintingProtectionEnabled(const QString &host) const
+{
+    return !AdBlockInterceptor::isAllowedSite(m_fingerprintingExemptSites, QUrl::toAce(host.toLower()));
+}
+
+QString PrivacyManager::fingerprintShield(const QUrl &url) const
+{
+    if (!m_fingerprintingProtection || !isSiteFingerprintingProtectionEnabled(url.host())) {
+        return QString();
+    }
+    return m_fingerprintShield;
+}
+
 void PrivacyManager::setJavaScriptEnabled(bool enable)
 {
     m_webView->settings()->setAttribute(QWebEngineSettings::JavascriptEnabled, enable);
@@ -201,36 +858,318 @@ QString PrivacyManager::generatePrivacyReport() const
     report["vpn_active"] = m_vpnActive;
     report["ad_blocking_enabled"] = m_adBlockingEnabled;
     report["https_only_mode"] = m_httpsOnlyMode;
+    report["https_upgrades"] = qint64(m_adBlockInterceptor->upgradedCount());
+    report["https_failed_hosts"] = m_httpsUpgradeFailures.size();
+    if (m_httpsKnownHosts) {
+        report["https_known_hosts"] = m_httpsKnownHosts->hostCount();
+        report["https_known_hosts_bytes"] = m_httpsKnownHosts->memoryUsage();
+    }
+    report["safe_browsing"] = m_safeBrowsingEnabled;
+    if (m_safeBrowsing) {
+        const QSharedPointer<const SafeBrowsingDatabase> database = m_safeBrowsing->database();
+        report["safe_browsing_list_version"] = qint64(database->version());
+        report["safe_browsing_hashes"] = database->hashCount();
+        report["safe_browsing_prefix_bytes"] = database->memoryUsage();
+    }
     report["do_not_track"] = m_doNotTrack;
+    report["request_header_patterns"] = m_requestHeaders.size();
+    report["tracking_parameter_stripping"] = m_stripTrackingParameters;
+    report["tracking_parameter_names"] = m_trackingParameterNames;
+    report["tracking_parameter_urls_stripped"] = qint64(m_adBlockInterceptor->strippedCount());
     report["fingerprinting_protection"] = m_fingerprintingProtection;
+    report["fingerprinting_exempt_sites"] = m_fingerprintingExemptSites.size();
     report["save_passwords_enabled"] = m_savePasswordsEnabled;
+    report["cookie_count"] = m_cookieIndex.count();
+    report["cookie_sites"] = m_cookieIndex.siteCount();
+    report["accept_cookies"] = m_acceptCookies;
+    report["block_third_party_cookies"] = m_blockThirdPartyCookies;
+    report["cookie_site_rules"] = m_siteCookieRules.size();
+    report["cookie_accesses_checked"] = qint64(m_cookieFilter->checkedCount());
+    report["cookie_accesses_blocked"] = qint64(m_cookieFilter->blockedCount());
+    if (m_entityMap) {
+        report["entity_map_entities"] = m_entityMap->entityCount();
+        report["entity_map_domains"] = m_entityMap->domainCount();
+        report["entity_map_bytes"] = m_entityMap->memoryUsage();
+        report["entity_map_mapped"] = m_entityMap->isMapped();
+    }
     report["javascript_enabled"] = m_webView->settings()->testAttribute(QWebEngineSettings::JavascriptEnabled);
     report["plugins_enabled"] = m_webView->settings()->testAttribute(QWebEngineSettings::PluginsEnabled);
     report["popups_allowed"] = m_webView->settings()->testAttribute(QWebEngineSettings::JavascriptCanOpenWindows);
 
+    if (QSharedPointer<const AdBlockEngine> engine = m_adBlockInterceptor->engine()) {
+        report["ad_block_filter_count"] = engine->filterCount();
+        report["ad_block_rule_set_generation"] = qint64(m_adBlockInterceptor->generation());
+        report["ad_block_allowed_sites"] = m_adBlockAllowedSites.size();
+        report["ad_block_layer_filter_count"] = engine->layerFilterCount();
+        report["ad_block_memory_bytes"] = engine->memoryUsage();
+        report["ad_block_snapshot_mapped"] = engine->isMapped();
+        report["ad_block_cosmetic_selectors"] = engine->cosmeticFilters().selectorCount();
+        report["ad_block_prefilter_bytes"] = engine->prefilter().size();
+        report["ad_block_prefilter_false_positive_rate"] = engine->prefilter().falsePositiveRate();
+        report["ad_block_requests"] = qint64(m_adBlockInterceptor->requestCount());
+        report["ad_block_prefilter_fast_path"] = qint64(m_adBlockInterceptor->prefilteredCount());
+        if (QSharedPointer<const AdBlockEngine::HotTier> hotTier = m_adBlockInterceptor->hotTier()) {
+            report["ad_block_hot_filters"] = hotTier->filterCount();
+            report["ad_block_hot_tier_bytes"] = hotTier->memoryUsage();
+        }
+
+        const AdBlockDecisionCache &cache = m_adBlockInterceptor->decisionCache();
+        const quint64 lookups = cache.lookupCount();
+        report["ad_block_cache_capacity"] = cache.capacity();
+        report["ad_block_cache_lookups"] = qint64(lookups);
+        report["ad_block_cache_hit_rate"] = lookups ? double(cache.hitCount()) / double(lookups) : 0.0;
+
+        AdBlockStatistics &statistics = m_adBlockInterceptor->statistics();
+        statistics.merge(QDateTime::currentMSecsSinceEpoch());
+        report["ad_block_last_hour"] = statisticsWindow(statistics.lastHour());
+        report["ad_block_last_day"] = statisticsWindow(statistics.lastDay());
+        // Rules that blocked nothing all day are candidates for pruning
+        report["ad_block_rules_without_blocks_last_day"] = engine->filterCount() - statistics.lastDay().rules.size();
+    }
+
     return QJsonDocument(report).toJson(QJsonDocument::Indented);
 }
 
 void PrivacyManager::showCookieManager()
 {
-    // In a real implementation, this would open a dialog to manage cookies
+    CookieManagerDialog *dialog = new CookieManagerDialog(this, m_webView->window());
+    dialog->setAttribute(Qt::WA_DeleteOnClose);
+    dialog->show();
 }
 
 void PrivacyManager::initializeAdBlockLists()
 {
-    // Load default ad block lists
-    QFile file(":/adblock/easylist.txt");
-    if (file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QTextStream in(&file);
-        m_adBlockLists["easylist"] = in.readAll().split('\n');
-        file.close();
+    m_adBlockSources["easylist"] = ":/adblock/easylist.txt";
+    m_adBlockSources["user"] = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/filters/adblock.txt";
+
+    m_subscriptions = new FilterSubscriptionManager(
+        QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/filters/subscriptions", this);
+    for (const QString &name : m_subscriptions->subscriptions()) {
+        m_adBlockSources["subscription:" + name] = m_subscriptions->listPath(name);
+    }
+    connect(m_subscriptions, &FilterSubscriptionManager::subscriptionUpdated, this,
+            [this](const QString &name, const QStringList &lines, const QStringList &added, const QStringList &removed) {
+        applyAdBlockDelta("subscription:" + name, lines, added, removed);
+    });
+
+    // Reuse the compiled rules from the last run while the lists are unchanged;
+    // after subscription updates that is the base plus its delta layer
+    const quint64 stamp = adBlockListsStamp();
+    m_adBlockEngine = AdBlockEngine::fromSnapshot(adBlockSnapshotPath(), stamp);
+    if (!m_adBlockEngine) {
+        m_adBlockEngine = AdBlockEngine::fromSnapshot(adBlockLayerPath(), stamp, adBlockSnapshotPath());
     }
 }
 
+void PrivacyManager::loadAdBlockLists()
+{
+    for (auto it = m_adBlockSources.constBegin(); it != m_adBlockSources.constEnd(); ++it) {
+        if (m_adBlockLists.contains(it.key())) {
+            continue;
+        }
+        QFile file(it.value());
+        if (file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            QTextStream in(&file);
+            m_adBlockLists[it.key()] = in.readAll().split('\n');
+            file.close();
+        }
+    }
+}
+
+quint64 PrivacyManager::adBlockListsStamp() const
+{
+    // Identifies the list contents without reading them: size and mtime of
+    // each source file, the prefilter sizing and the runtime-supplied rules
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    for (auto it = m_adBlockSources.constBegin(); it != m_adBlockSources.constEnd(); ++it) {
+        QFileInfo info(it.value());
+        hash.addData(it.key().toUtf8());
+        hash.addData(QByteArray::number(info.exists() ? info.size() : -1));
+        hash.addData(QByteArray::number(info.lastModified().toMSecsSinceEpoch()));
+    }
+    hash.addData(QByteArray::number(m_prefilterFalsePositiveRate));
+    hash.addData(QByteArray::number(m_prefilterMaxBytes));
+    for (const QString &rule : m_adBlockLists.value("custom")) {
+        hash.addData(rule.toUtf8());
+        hash.addData("\n", 1);
+    }
+
+    const QByteArray digest = hash.result();
+    quint64 stamp = 0;
+    memcpy(&stamp, digest.constData(), sizeof(stamp));
+    return stamp;
+}
+
+QString PrivacyManager::adBlockSnapshotPath() const
+{
+    const QString cachePath = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    QDir().mkpath(cachePath);
+    return cachePath + "/adblock.snapshot";
+}
+
+QString PrivacyManager::adBlockLayerPath() const
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/adblock.layer.snapshot";
+}
+
 void PrivacyManager::applyAdBlockRules()
 {
-    // In a real implementation, this would set up a request interceptor to block ads
-    // based on the rules in m_adBlockLists
+    if (!m_adBlockEngine) {
+        loadAdBlockLists();
+        AdBlockEngine::PrefilterOptions prefilter;
+        prefilter.falsePositiveRate = m_prefilterFalsePositiveRate;
+        prefilter.maxBytes = m_prefilterMaxBytes;
+        m_adBlockEngine = AdBlockEngine::compile(m_adBlockLists, prefilter);
+        if (m_adBlockEngine && !m_adBlockEngine->writeSnapshot(adBlockSnapshotPath(), adBlockListsStamp())) {
+            qWarning() << "Failed to write ad block snapshot to" << adBlockSnapshotPath();
+        }
+        QFile::remove(adBlockLayerPath());
+    }
+
+    m_adBlockInterceptor->setEngine(m_adBlockEngine);
+    installInterceptor();
+}
+
+void PrivacyManager::protectProfile(QWebEngineProfile *profile)
+{
+    // The interceptor passes everything through while its features are off
+    profile->setUrlRequestInterceptor(m_adBlockInterceptor);
+    if (!profile->urlSchemeHandler("browser")) {
+        profile->installUrlSchemeHandler("browser", m_surrogateHandler);
+    }
+    QSharedPointer<CookieFilter> cookieFilter = m_cookieFilter;
+    profile->cookieStore()->setCookieFilter([cookieFilter](const QWebEngineCookieStore::FilterRequest &request) {
+        return cookieFilter->accept(request);
+    });
+}
+
+void PrivacyManager::installInterceptor()
+{
+    m_profile->setUrlRequestInterceptor(m_adBlockInterceptor);
+    // $redirect rules send blocked requests to browser:surrogate/...
+    if (!m_profile->urlSchemeHandler("browser")) {
+        m_profile->installUrlSchemeHandler("browser", m_surrogateHandler);
+    }
+}
+
+void PrivacyManager::applyAdBlockDelta(const QString &list, const QStringList &lines,
+                                       const QStringList &added, const QStringList &removed)
+{
+    loadAdBlockLists();
+    m_adBlockLists[list] = lines;
+    if (m_stripTrackingParameters) {
+        applyQueryParameterFilter();
+    }
+
+    // Nothing compiled yet: the next full compile reads the new lists
+    if (!m_adBlockEngine) {
+        if (m_adBlockingEnabled) {
+            applyAdBlockRules();
+        }
+        return;
+    }
+
+    // Changes that arrive while a delta is compiling are batched into the next
+    for (const QString &rule : added) {
+        if (!m_pendingRemoved.remove(rule)) {
+            m_pendingAdded.insert(rule);
+        }
+    }
+    for (const QString &rule : removed) {
+        if (!m_pendingAdded.remove(rule)) {
+            m_pendingRemoved.insert(rule);
+        }
+    }
+    startAdBlockDelta();
+}
+
+void PrivacyManager::startAdBlockDelta()
+{
+    if (m_deltaRunning || !m_adBlockEngine || (m_pendingAdded.isEmpty() && m_pendingRemoved.isEmpty())) {
+        return;
+    }
+    m_deltaRunning = true;
+
+    const QSharedPointer<const AdBlockEngine> engine = m_adBlockEngine;
+    const QMap<QString, QStringList> lists = m_adBlockLists;
+    const QStringList added = m_pendingAdded.values();
+    const QStringList removed = m_pendingRemoved.values();
+    m_pendingAdded.clear();
+    m_pendingRemoved.clear();
+
+    AdBlockEngine::PrefilterOptions prefilter;
+    prefilter.falsePositiveRate = m_prefilterFalsePositiveRate;
+    prefilter.maxBytes = m_prefilterMaxBytes;
+    const quint64 stamp = adBlockListsStamp();
+    const QString snapshotPath = adBlockSnapshotPath();
+    const QString layerPath = adBlockLayerPath();
+
+    QFutureWatcher<QSharedPointer<const AdBlockEngine>> *watcher =
+        new QFutureWatcher<QSharedPointer<const AdBlockEngine>>(this);
+    connect(watcher, &QFutureWatcher<QSharedPointer<const AdBlockEngine>>::finished, this, [this, engine, watcher]() {
+        const QSharedPointer<const AdBlockEngine> updated = watcher->result();
+        watcher->deleteLater();
+        m_deltaRunning = false;
+
+        // A full recompile in the meantime already covers this change, and
+        // replaying later ones on top of it is harmless
+        if (updated && m_adBlockEngine == engine) {
+            m_adBlockEngine = updated;
+            if (m_adBlockingEnabled) {
+                m_adBlockInterceptor->setEngine(m_adBlockEngine);
+            }
+        }
+        startAdBlockDelta();
+    });
+
+    watcher->setFuture(QtConcurrent::run([=]() {
+        // Fold the layer back into a fresh base once it stops being small
+        if (engine->layerFilterCount() + added.size() > qMax(4096, engine->filterCount() / 10)) {
+            const QSharedPointer<const AdBlockEngine> compiled = AdBlockEngine::compile(lists, prefilter);
+            if (compiled && compiled->writeSnapshot(snapshotPath, stamp)) {
+                QFile::remove(layerPath);
+            }
+            return compiled;
+        }
+
+        const QSharedPointer<const AdBlockEngine> layered =
+            AdBlockEngine::compileDelta(engine, lists, added, removed, prefilter);
+        if (layered && !layered->writeSnapshot(layerPath, stamp)) {
+            qWarning() << "Failed to write ad block layer to" << layerPath;
+        }
+        return layered;
+    }));
+}
+
+void PrivacyManager::promoteHotFilters()
+{
+    const QSharedPointer<const AdBlockEngine> engine = m_adBlockInterceptor->engine();
+    if (m_hotTierRunning || !engine) {
+        return;
+    }
+
+    AdBlockStatistics &statistics = m_adBlockInterceptor->statistics();
+    statistics.merge(QDateTime::currentMSecsSinceEpoch());
+    const QVector<int> filters = statistics.hotFilters(engine.data(), AdBlockEngine::MaxHotFilters);
+    if (filters.isEmpty()) {
+        return;
+    }
+    m_hotTierRunning = true;
+
+    QFutureWatcher<QSharedPointer<const AdBlockEngine::HotTier>> *watcher =
+        new QFutureWatcher<QSharedPointer<const AdBlockEngine::HotTier>>(this);
+    connect(watcher, &QFutureWatcher<QSharedPointer<const AdBlockEngine::HotTier>>::finished, this,
+            [this, engine, watcher]() {
+        watcher->deleteLater();
+        m_hotTierRunning = false;
+        // A tier for a replaced engine would never be searched
+        if (m_adBlockInterceptor->engine() == engine) {
+            m_adBlockInterceptor->setHotTier(watcher->result());
+        }
+    });
+    watcher->setFuture(QtConcurrent::run([engine, filters]() {
+        return engine->buildHotTier(filters);
+    }));
 }
 
 void PrivacyManager::updateContentSettings()
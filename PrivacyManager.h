@@ -6,17 +6,34 @@
 #include <QObject>
 #include <QWebEngineProfile>
 #include <QNetworkProxy>
+#include <QHash>
 #include <QMap>
+#include <QSet>
+#include <QSharedPointer>
 #include <QStringList>
+#include <QUrl>
+
+#include "BrowsingDataCleaner.h"
+#include "CookieIndex.h"
+#include "CookiePolicy.h"
 
 class QWebEngineView;
+class AdBlockEngine;
+class AdBlockInterceptor;
+class DevToolsProtocol;
+class FilterSubscriptionManager;
+class HttpsUpgradeList;
+class SafeBrowsingService;
+class SurrogateSchemeHandler;
 
 class PrivacyManager : public QObject
 {
     Q_OBJECT
 
 public:
-    explicit PrivacyManager(QWebEngineView *webView, QObject *parent = nullptr);
+    // |profile| is the one the browser's tabs use; the request interceptor,
+    // cookie filter and cookie index are attached to it
+    PrivacyManager(QWebEngineView *webView, QWebEngineProfile *profile, QObject *parent = nullptr);
 
     // VPN
     void toggleVPN();
@@ -25,15 +42,52 @@ public:
     // Ad blocking
     void enableAdBlocking(bool enable);
     bool isAdBlockingEnabled() const;
+    // Accepts ABP filter syntax as well as hosts-file lines
     void updateAdBlockList(const QStringList &rules);
+    // Element hiding CSS for pages on the host of |url|; empty when ad
+    // blocking is off
+    QString cosmeticStyleSheet(const QUrl &url);
+    // Script running the +js() scriptlets the lists give the host of |url|;
+    // empty when there are none or ad blocking is off
+    QString scriptletBundle(const QUrl &url);
+    // Sizing of the Bloom prefilter that settles most unblocked requests
+    // without an index lookup; changing it recompiles the lists
+    void setAdBlockPrefilter(double falsePositiveRate, qint64 maxBytes);
+    double adBlockPrefilterFalsePositiveRate() const;
+    qint64 adBlockPrefilterMaxBytes() const;
+    // Pages on |host| and its subdomains are not filtered while disabled
+    void setSiteAdBlockingEnabled(const QString &host, bool enabled);
+    bool isSiteAdBlockingEnabled(const QString &host) const;
+    // Remote filter lists; updates are patched into the compiled rules
+    void addAdBlockSubscription(const QString &name, const QUrl &url);
+    void updateAdBlockSubscriptions();
 
     // Cookie management
     void clearCookies();
+    // Cookies of the site |host| belongs to, subdomains included
+    QVector<QNetworkCookie> siteCookies(const QString &host) const;
+    int siteCookieCount(const QString &host) const;
+    void clearSiteCookies(const QString &host);
+    // Mirror of the profile's cookie store, kept current from its signals
+    const CookieIndex &cookieIndex() const;
+    // Checked for every cookie read and write by a compiled filter; site
+    // rules cover subdomains and win over the global settings
     void setAcceptCookies(bool accept);
+    bool isAcceptCookiesEnabled() const;
     void setThirdPartyCookiesPolicy(QWebEngineProfile::ThirdPartyCookiesPolicy policy);
+    bool isThirdPartyCookieBlockingEnabled() const;
+    void setSiteCookiePolicy(const QString &host, CookiePolicy::SiteRule rule);
+    void removeSiteCookiePolicy(const QString &host);
 
     // Browsing data
-    void clearBrowsingData();
+    // Everything; |knownOrigins|, such as those in history, have their
+    // storage cleared besides the sites holding cookies
+    void clearBrowsingData(const QVector<QUrl> &knownOrigins = QVector<QUrl>());
+    // Clears what |request| names in the background, reporting through
+    // browsingDataClearProgress(); false while another clear runs
+    bool clearBrowsingData(const BrowsingDataCleaner::Request &request);
+    // Answered by storageUsageAvailable()
+    void requestStorageUsage(const QUrl &origin);
     void clearCache();
     void clearHistory();
     void clearDownloads();
@@ -41,14 +95,48 @@ public:
     // HTTPS
     void setHttpsOnlyMode(bool enable);
     bool isHttpsOnlyModeEnabled() const;
+    // Whether a navigation to |url| is sent over https instead
+    bool upgradesToHttps(const QUrl &url) const;
+    // Called when the upgraded https load of |httpUrl| failed. Returns true
+    // when the host may now be loaded over http, which it will be for a day.
+    bool handleHttpsUpgradeFailure(const QUrl &httpUrl);
+
+    // Safe Browsing; navigations to listed URLs are refused. The list is
+    // kept on disk and updated from |url| (a file:// diff or a server)
+    void setSafeBrowsingEnabled(bool enable);
+    bool isSafeBrowsingEnabled() const;
+    void setSafeBrowsingUpdateUrl(const QUrl &url);
+    // Listed expression |url| matched; empty when it is not listed or
+    // Safe Browsing is off
+    QString safeBrowsingMatch(const QUrl &url) const;
 
-    // Do Not Track
+    // Do Not Track; sends DNT and Sec-GPC with every request
     void setDoNotTrack(bool enable);
     bool isDoNotTrackEnabled() const;
 
+    // Request headers for |hostPattern|, a hostname that also covers its
+    // subdomains or "*" for every host. Empty |headers| removes the pattern.
+    void setRequestHeaders(const QString &hostPattern, const QMap<QString, QString> &headers);
+    QMap<QString, QString> requestHeaders(const QString &hostPattern) const;
+    // Headers a page asks for. Requests cannot be traced back to their
+    // page, so they go to every host, but apart from the "*" pattern; they
+    // are dropped with |page|. Empty |headers| removes them.
+    void setPageRequestHeaders(QObject *page, const QMap<QString, QString> &headers);
+
+    // Removes utm_* and click ids, and the lists' $removeparam names, from
+    // request URLs
+    void setTrackingParameterStripping(bool enable);
+    bool isTrackingParameterStrippingEnabled() const;
+
     // Fingerprinting protection
     void enableFingerprintingProtection(bool enable);
     bool isFingerprintingProtectionEnabled() const;
+    // Pages on |host| and its subdomains get no shield while disabled
+    void setSiteFingerprintingProtectionEnabled(const QString &host, bool enabled);
+    bool isSiteFingerprintingProtectionEnabled(const QString &host) const;
+    // Script to inject into pages of |url|; empty when it is exempt or
+    // protection is off
+    QString fingerprintShield(const QUrl &url) const;
 
     // Content settings
     void setJavaScriptEnabled(bool enable);
@@ -71,11 +159,26 @@ public:
 public slots:
     void showCookieManager();
 
+    // Applies the request interceptor and cookie filter to another
+    // profile, such as the private one. Its cookies stay out of the index.
+    void protectProfile(QWebEngineProfile *profile);
+
 signals:
     void vpnStatusChanged(bool active);
     void adBlockingStatusChanged(bool enabled);
     void cookiePolicyChanged();
+    // The cookie index changed; comes in bursts while the store loads
+    void cookiesChanged();
+    void browsingDataClearProgress(int done, int total);
+    void browsingDataCleared(const QStringList &errors);
+    // History is kept by the browser window, which removes the entries
+    void historyRemovalRequested(const QVector<QUrl> &origins, const QDateTime &from, const QDateTime &to);
+    // |usage| is -1 when it could not be read
+    void storageUsageAvailable(const QUrl &origin, qint64 usage, qint64 quota);
     void httpsOnlyModeChanged(bool enabled);
+    void safeBrowsingChanged(bool enabled);
+    void safeBrowsingListUpdated(quint64 version);
+    void safeBrowsingUpdateFailed(const QString &error);
     void doNotTrackChanged(bool enabled);
     void fingerprintingProtectionChanged(bool enabled);
     void contentSettingsChanged();
@@ -84,17 +187,73 @@ signals:
 
 private:
     QWebEngineView *m_webView;
+    QWebEngineProfile *m_profile;
     bool m_vpnActive;
     bool m_adBlockingEnabled;
     bool m_httpsOnlyMode;
+    QSharedPointer<const HttpsUpgradeList> m_httpsKnownHosts;
+    QHash<QByteArray, qint64> m_httpsUpgradeFailures;
+    bool m_safeBrowsingEnabled;
+    QUrl m_safeBrowsingUpdateUrl;
+    SafeBrowsingService *m_safeBrowsing;
     bool m_doNotTrack;
+    QMap<QByteArray, QMap<QByteArray, QByteArray>> m_requestHeaders;
+    QMap<QObject *, QMap<QByteArray, QByteArray>> m_pageRequestHeaders;
+    bool m_stripTrackingParameters;
+    int m_trackingParameterNames;
     bool m_fingerprintingProtection;
+    QString m_fingerprintShield;
+    QSet<QByteArray> m_fingerprintingExemptSites;
     bool m_savePasswordsEnabled;
     QNetworkProxy m_proxy;
+    QMap<QString, QString> m_adBlockSources;
     QMap<QString, QStringList> m_adBlockLists;
+    QSharedPointer<const AdBlockEngine> m_adBlockEngine;
+    AdBlockInterceptor *m_adBlockInterceptor;
+    QSet<QByteArray> m_adBlockAllowedSites;
+    double m_prefilterFalsePositiveRate;
+    qint64 m_prefilterMaxBytes;
+    QSharedPointer<const AdBlockEngine> m_cosmeticEngine;
+    QString m_genericStyleSheet;
+    QHash<QString, QString> m_cosmeticStyleSheets;
+    QHash<QString, QString> m_scriptletBundles;
+    SurrogateSchemeHandler *m_surrogateHandler;
+    FilterSubscriptionManager *m_subscriptions;
+    QSet<QString> m_pendingAdded;
+    QSet<QString> m_pendingRemoved;
+    bool m_deltaRunning;
+    bool m_hotTierRunning;
+    CookieIndex m_cookieIndex;
+    bool m_acceptCookies;
+    bool m_blockThirdPartyCookies;
+    QMap<QByteArray, CookiePolicy::SiteRule> m_siteCookieRules;
+    // Shared with the cookie store, which may call it after we are gone
+    QSharedPointer<CookieFilter> m_cookieFilter;
+    // Null until loaded; groups an organization's domains as first-party
+    QSharedPointer<const EntityMap> m_entityMap;
+    DevToolsProtocol *m_devTools;
+    BrowsingDataCleaner *m_dataCleaner;
 
     void initializeAdBlockLists();
+    void loadAdBlockLists();
+    quint64 adBlockListsStamp() const;
+    QString adBlockSnapshotPath() const;
+    QString adBlockLayerPath() const;
+    void installInterceptor();
+    void applyRequestHeaders();
+    void removePageRequestHeaders(QObject *page);
+    void applyCookiePolicy();
+    void loadEntityMap();
+    quint64 entityListStamp() const;
+    void applyEntityMap(const QSharedPointer<const EntityMap> &entities);
+    bool keepCookieForSession(const QNetworkCookie &cookie);
+    void applyQueryParameterFilter();
     void applyAdBlockRules();
+    void refreshCosmeticCaches();
+    void applyAdBlockDelta(const QString &list, const QStringList &lines,
+                           const QStringList &added, const QStringList &removed);
+    void startAdBlockDelta();
+    void promoteHotFilters();
     void updateContentSettings();
 };
 
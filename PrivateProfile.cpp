@@ -0,0 +1,83 @@
+// PrivateProfile.cpp
+
+#include "PrivateProfile.h"
+#include <QWebEngineCookieStore>
+#include <QWebEnginePage>
+#include <QWebEngineProfile>
+
+PrivateProfile::PrivateProfile(QObject *parent)
+    : QObject(parent)
+    , m_profile(nullptr)
+    , m_pageCount(0)
+    , m_httpCacheMaximumSize(DefaultHttpCacheMaximumSize)
+{
+}
+
+PrivateProfile::~PrivateProfile()
+{
+    // Pages still open hold the profile; it must outlive them
+    if (m_profile && m_pageCount > 0) {
+        m_profile->setParent(nullptr);
+        m_profile->deleteLater();
+    }
+}
+
+QWebEngineProfile *PrivateProfile::profile()
+{
+    if (!m_profile) {
+        // A profile without a storage name is off the record
+        m_profile = new QWebEngineProfile(this);
+        m_profile->setHttpCacheType(QWebEngineProfile::MemoryHttpCache);
+        m_profile->setHttpCacheMaximumSize(m_httpCacheMaximumSize);
+        m_profile->setPersistentCookiesPolicy(QWebEngineProfile::NoPersistentCookies);
+        emit profileCreated(m_profile);
+    }
+    return m_profile;
+}
+
+bool PrivateProfile::isActive() const
+{
+    return m_profile != nullptr;
+}
+
+int PrivateProfile::pageCount() const
+{
+    return m_pageCount;
+}
+
+void PrivateProfile::setHttpCacheMaximumSize(int bytes)
+{
+    m_httpCacheMaximumSize = qMax(0, bytes);
+    if (m_profile) {
+        m_profile->setHttpCacheMaximumSize(m_httpCacheMaximumSize);
+    }
+}
+
+int PrivateProfile::httpCacheMaximumSize() const
+{
+    return m_httpCacheMaximumSize;
+}
+
+void PrivateProfile::addPage(QWebEnginePage *page)
+{
+    ++m_pageCount;
+    connect(page, &QObject::destroyed, this, &PrivateProfile::pageDestroyed);
+}
+
+void PrivateProfile::pageDestroyed()
+{
+    if (--m_pageCount > 0 || !m_profile) {
+        return;
+    }
+
+    // The tab's popups, its children, are only destroyed after this signal,
+    // so the profile goes once control returns to the event loop. Clearing
+    // first drops the cache and cookies even if that is delayed.
+    QWebEngineProfile *profile = m_profile;
+    m_profile = nullptr;
+    profile->clearHttpCache();
+    profile->cookieStore()->deleteAllCookies();
+    profile->clearAllVisitedLinks();
+    profile->deleteLater();
+    emit sessionEnded();
+}
@@ -0,0 +1,52 @@
+// PrivateProfile.h
+
+#ifndef PRIVATEPROFILE_H
+#define PRIVATEPROFILE_H
+
+#include <QObject>
+
+class QWebEngineProfile;
+class QWebEnginePage;
+
+// The off-the-record profile behind private tabs. It is created with the
+// first private page and deleted once the last one is gone, which frees its
+// cookies, storage and HTTP cache, and lets the renderer processes of its
+// pages exit. The next private tab starts a new session. Nothing is written
+// to disk: the HTTP cache lives in memory, up to a configurable size.
+class PrivateProfile : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int DefaultHttpCacheMaximumSize = 32 * 1024 * 1024;
+
+    explicit PrivateProfile(QObject *parent = nullptr);
+    ~PrivateProfile();
+
+    // Creates the profile when no session is running
+    QWebEngineProfile *profile();
+    bool isActive() const;
+    int pageCount() const;
+
+    // Also applies to a running session
+    void setHttpCacheMaximumSize(int bytes);
+    int httpCacheMaximumSize() const;
+
+    // Keeps the session alive until |page| is destroyed. Pages it opens
+    // are its children and go with it, so only tabs need adding.
+    void addPage(QWebEnginePage *page);
+
+signals:
+    // Request interceptors and scheme handlers belong on it
+    void profileCreated(QWebEngineProfile *profile);
+    void sessionEnded();
+
+private:
+    void pageDestroyed();
+
+    QWebEngineProfile *m_profile;
+    int m_pageCount;
+    int m_httpCacheMaximumSize;
+};
+
+#endif // PRIVATEPROFILE_H
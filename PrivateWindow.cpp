@@ -0,0 +1,150 @@
+// PrivateWindow.cpp
+
+#include "PrivateWindow.h"
+#include "PrivacyManager.h"
+#include "PrivateProfile.h"
+#include "WebPage.h"
+#include <QAction>
+#include <QKeySequence>
+#include <QLineEdit>
+#include <QShortcut>
+#include <QStyle>
+#include <QTabWidget>
+#include <QToolBar>
+#include <QWebEngineHistory>
+#include <QWebEngineView>
+
+PrivateWindow::PrivateWindow(PrivateProfile *privateProfile, PrivacyManager *privacyManager, const QUrl &startUrl,
+                             QWidget *parent)
+    : QMainWindow(parent)
+    , m_privateProfile(privateProfile)
+    , m_privacyManager(privacyManager)
+    , m_startUrl(startUrl)
+    , m_tabWidget(new QTabWidget(this))
+    , m_urlBar(new QLineEdit(this))
+{
+    m_tabWidget->setTabsClosable(true);
+    m_tabWidget->setMovable(true);
+    m_tabWidget->setDocumentMode(true);
+    setCentralWidget(m_tabWidget);
+    createToolBar();
+
+    connect(m_tabWidget, &QTabWidget::currentChanged, this, &PrivateWindow::handleTabChanged);
+    connect(m_tabWidget, &QTabWidget::tabCloseRequested, this, &PrivateWindow::closeTab);
+    connect(m_urlBar, &QLineEdit::returnPressed, this, [this]() {
+        if (currentWebView()) {
+            currentWebView()->load(QUrl::fromUserInput(m_urlBar->text()));
+        }
+    });
+
+    QShortcut *newTabShortcut = new QShortcut(QKeySequence::AddTab, this);
+    connect(newTabShortcut, &QShortcut::activated, this, [this]() { newTab(); });
+    QShortcut *closeTabShortcut = new QShortcut(QKeySequence::Close, this);
+    connect(closeTabShortcut, &QShortcut::activated, this, [this]() { closeTab(m_tabWidget->currentIndex()); });
+
+    resize(1024, 768);
+}
+
+void PrivateWindow::newTab(const QUrl &url)
+{
+    QWebEngineView *webView = new QWebEngineView(this);
+    WebPage *page = new WebPage(m_privateProfile->profile(), webView);
+    m_privateProfile->addPage(page);
+    page->setPrivacyManager(m_privacyManager);
+    webView->setPage(page);
+
+    const int index = m_tabWidget->addTab(webView, tr("New Tab"));
+    m_tabWidget->setCurrentIndex(index);
+
+    connect(webView, &QWebEngineView::titleChanged, this, [this, webView](const QString &title) {
+        const int index = m_tabWidget->indexOf(webView);
+        if (index != -1) {
+            m_tabWidget->setTabText(index, title);
+        }
+        if (webView == currentWebView()) {
+            updateWindowTitle();
+        }
+    });
+    connect(webView, &QWebEngineView::urlChanged, this, [this, webView](const QUrl &url) {
+        if (webView == currentWebView()) {
+            m_urlBar->setText(url.toString());
+            handleTabChanged();
+        }
+    });
+    connect(webView, &QWebEngineView::loadStarted, this, &PrivateWindow::handleTabChanged);
+    connect(webView, &QWebEngineView::loadFinished, this, &PrivateWindow::handleTabChanged);
+
+    webView->load(url.isValid() ? url : m_startUrl);
+}
+
+void PrivateWindow::closeTab(int index)
+{
+    // Deleting the view deletes its page, which the session counts
+    QWidget *widget = m_tabWidget->widget(index);
+    m_tabWidget->removeTab(index);
+    delete widget;
+    if (m_tabWidget->count() == 0) {
+        close();
+    }
+}
+
+void PrivateWindow::createToolBar()
+{
+    m_backAction = new QAction(style()->standardIcon(QStyle::SP_ArrowBack), tr("Back"), this);
+    m_forwardAction = new QAction(style()->standardIcon(QStyle::SP_ArrowForward), tr("Forward"), this);
+    m_reloadAction = new QAction(style()->standardIcon(QStyle::SP_BrowserReload), tr("Reload"), this);
+    m_stopAction = new QAction(style()->standardIcon(QStyle::SP_BrowserStop), tr("Stop"), this);
+
+    connect(m_backAction, &QAction::triggered, this, [this]() {
+        if (currentWebView()) {
+            currentWebView()->back();
+        }
+    });
+    connect(m_forwardAction, &QAction::triggered, this, [this]() {
+        if (currentWebView()) {
+            currentWebView()->forward();
+        }
+    });
+    connect(m_reloadAction, &QAction::triggered, this, [this]() {
+        if (currentWebView()) {
+            currentWebView()->reload();
+        }
+    });
+    connect(m_stopAction, &QAction::triggered, this, [this]() {
+        if (currentWebView()) {
+            currentWebView()->stop();
+        }
+    });
+
+    QToolBar *navigationBar = addToolBar(tr("Navigation"));
+    navigationBar->addAction(m_backAction);
+    navigationBar->addAction(m_forwardAction);
+    navigationBar->addAction(m_reloadAction);
+    navigationBar->addAction(m_stopAction);
+    navigationBar->addWidget(m_urlBar);
+}
+
+void PrivateWindow::handleTabChanged()
+{
+    QWebEngineView *webView = currentWebView();
+    m_backAction->setEnabled(webView && webView->history()->canGoBack());
+    m_forwardAction->setEnabled(webView && webView->history()->canGoForward());
+    if (webView) {
+        m_urlBar->setText(webView->url().toString());
+    }
+    updateWindowTitle();
+}
+
+void PrivateWindow::updateWindowTitle()
+{
+    QString title = currentWebView() ? currentWebView()->title() : QString();
+    if (title.isEmpty()) {
+        title = currentWebView() ? currentWebView()->url().toString() : tr("New Tab");
+    }
+    setWindowTitle(title + " - Custom Browser (Private)");
+}
+
+QWebEngineView *PrivateWindow::currentWebView() const
+{
+    return qobject_cast<QWebEngineView *>(m_tabWidget->currentWidget());
+}
@@ -0,0 +1,49 @@
+// PrivateWindow.h
+
+#ifndef PRIVATEWINDOW_H
+#define PRIVATEWINDOW_H
+
+#include <QMainWindow>
+#include <QUrl>
+
+class QAction;
+class QLineEdit;
+class QTabWidget;
+class QWebEngineView;
+class PrivacyManager;
+class PrivateProfile;
+
+// A window of private tabs. It owns nothing but its tabs: the session
+// comes from |privateProfile| and blocking, HTTPS-only mode and the other
+// protections from the PrivacyManager of the window that opened it, so no
+// second set of engines, timers or profiles is built. Closing the last tab
+// closes the window.
+class PrivateWindow : public QMainWindow
+{
+    Q_OBJECT
+
+public:
+    PrivateWindow(PrivateProfile *privateProfile, PrivacyManager *privacyManager, const QUrl &startUrl,
+                  QWidget *parent = nullptr);
+
+    void newTab(const QUrl &url = QUrl());
+    void closeTab(int index);
+
+private:
+    void createToolBar();
+    void handleTabChanged();
+    void updateWindowTitle();
+    QWebEngineView *currentWebView() const;
+
+    PrivateProfile *m_privateProfile;
+    PrivacyManager *m_privacyManager;
+    QUrl m_startUrl;
+    QTabWidget *m_tabWidget;
+    QLineEdit *m_urlBar;
+    QAction *m_backAction;
+    QAction *m_forwardAction;
+    QAction *m_reloadAction;
+    QAction *m_stopAction;
+};
+
+#endif // PRIVATEWINDOW_H
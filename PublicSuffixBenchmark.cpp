@@ -0,0 +1,134 @@
+// PublicSuffixBenchmark.cpp
+//
+// Benchmark for the registrable domain lookup, not linked into the
+// browser. Build it together with PublicSuffixList against QtCore.
+//
+//   PublicSuffixBenchmark [--hosts hosts.txt] [--rounds 20]
+//
+// A hosts file holds one lowercase hostname per line. Without one, hosts
+// are generated under a mix of common, multi-label, wildcard and unknown
+// suffixes. Reports the time per lookup next to the last-two-labels split
+// the browser used before, and how often the two disagree.
+
+#include "PublicSuffixList.h"
+#include "PublicSuffixGraph.h"
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QRandomGenerator>
+#include <QTextStream>
+#include <QVector>
+
+namespace {
+
+const int SyntheticHostCount = 100000;
+
+const char *const Suffixes[] = {
+    "com", "org", "net", "de", "io", "co.uk", "com.au", "co.jp", "city.kawasaki.jp", "github.io",
+    "blogspot.com", "s3.amazonaws.com", "compute.amazonaws.com", "ck", "xn--p1ai", "internal"
+};
+const int SuffixCount = int(sizeof(Suffixes) / sizeof(Suffixes[0]));
+
+const char *const Labels[] = { "www", "cdn", "static", "api", "mail", "shop", "news", "img", "eu", "m" };
+const int LabelCount = int(sizeof(Labels) / sizeof(Labels[0]));
+
+QVector<QByteArray> syntheticHosts(QRandomGenerator &random)
+{
+    QVector<QByteArray> hosts;
+    hosts.reserve(SyntheticHostCount);
+    for (int i = 0; i < SyntheticHostCount; ++i) {
+        QByteArray host = "site" + QByteArray::number(random.bounded(5000)) + "." + Suffixes[random.bounded(SuffixCount)];
+        for (int labels = random.bounded(3); labels > 0; --labels) {
+            host.prepend(QByteArray(Labels[random.bounded(LabelCount)]) + ".");
+        }
+        hosts.append(host);
+    }
+    return hosts;
+}
+
+// What third-party checks and cookie sites used before the list
+int lastTwoLabels(const char *host, int length)
+{
+    int dots = 0;
+    int i = length;
+    while (i > 0) {
+        if (host[i - 1] == '.' && ++dots == 2) {
+            break;
+        }
+        --i;
+    }
+    return i;
+}
+
+template <typename Lookup>
+qint64 run(const QVector<QByteArray> &hosts, int rounds, Lookup lookup, qint64 &checksum)
+{
+    QElapsedTimer timer;
+    timer.start();
+    for (int round = 0; round < rounds; ++round) {
+        for (const QByteArray &host : hosts) {
+            checksum += lookup(host.constData(), host.size());
+        }
+    }
+    return timer.nsecsElapsed();
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QTextStream out(stdout);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Registrable domain lookup benchmark");
+    parser.addHelpOption();
+    QCommandLineOption hostsOption("hosts", "Hostnames to look up, one per line", "file");
+    QCommandLineOption roundsOption("rounds", "Passes over the hosts", "count", "20");
+    parser.addOptions({ hostsOption, roundsOption });
+    parser.process(app);
+    const int rounds = qMax(1, parser.value(roundsOption).toInt());
+
+    QVector<QByteArray> hosts;
+    if (parser.isSet(hostsOption)) {
+        QFile file(parser.value(hostsOption));
+        if (!file.open(QIODevice::ReadOnly)) {
+            out << "cannot read " << parser.value(hostsOption) << "\n";
+            return 1;
+        }
+        while (!file.atEnd()) {
+            const QByteArray host = file.readLine().trimmed().toLower();
+            if (!host.isEmpty()) {
+                hosts.append(host);
+            }
+        }
+    } else {
+        QRandomGenerator random(42);
+        hosts = syntheticHosts(random);
+    }
+    if (hosts.isEmpty()) {
+        out << "no hosts\n";
+        return 1;
+    }
+
+    int differ = 0;
+    for (const QByteArray &host : hosts) {
+        const int begin = PublicSuffixList::registrableDomain(host.constData(), host.size());
+        if (begin != lastTwoLabels(host.constData(), host.size())) {
+            ++differ;
+        }
+    }
+
+    qint64 checksum = 0;
+    const qint64 listNs = run(hosts, rounds, [](const char *host, int length) {
+        return PublicSuffixList::registrableDomain(host, length);
+    }, checksum);
+    const qint64 splitNs = run(hosts, rounds, &lastTwoLabels, checksum);
+    const double lookups = double(hosts.size()) * rounds;
+    out << "hosts " << hosts.size() << ", graph " << int(sizeof(PublicSuffixGraph)) << " bytes\n";
+    out << "public suffix list  " << qRound64(listNs / lookups) << " ns/host\n";
+    out << "last two labels     " << qRound64(splitNs / lookups) << " ns/host\n";
+    out << "registrable domain differs for " << differ << " hosts (checksum " << checksum << ")\n";
+    return 0;
+}
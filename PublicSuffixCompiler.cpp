@@ -0,0 +1,372 @@
+// PublicSuffixCompiler.cpp
+//
+// Build tool, not linked into the browser. Build it against QtCore and run
+// it whenever the Public Suffix List is updated:
+//
+//   PublicSuffixCompiler public_suffix_list.dat PublicSuffixGraph.h
+//
+// Turns the list's rules into the DAFSA PublicSuffixList walks: a trie of
+// the reversed rules, minimized so that shared endings such as ".co.jp"
+// are stored once, with runs of single-child nodes merged into one node.
+
+#include "PublicSuffixList.h"
+#include <QCoreApplication>
+#include <QFile>
+#include <QHash>
+#include <QMap>
+#include <QSaveFile>
+#include <QSet>
+#include <QTextStream>
+#include <QUrl>
+#include <QVector>
+#include <algorithm>
+
+namespace {
+
+// Offsets are stored in at most three bytes
+const int MaxGraphSize = 1 << 24;
+
+struct State {
+    quint8 flags = 0;
+    QMap<char, int> edges;
+};
+
+// A node of the written graph: a chain of label nodes
+struct Run {
+    QByteArray characters;
+    quint8 flags = 0;
+    QVector<int> children;
+    int width = 3;
+    int offset = 0;
+};
+
+// A character together with the state it leads to. The same state reached
+// by different characters becomes different graph nodes.
+quint64 labelNode(char c, int state)
+{
+    return (quint64(quint8(c)) << 32) | quint32(state);
+}
+
+char labelChar(quint64 node)
+{
+    return char(node >> 32);
+}
+
+int labelState(quint64 node)
+{
+    return int(quint32(node));
+}
+
+bool parseRules(const QString &path, QMap<QByteArray, quint8> &rules, QTextStream &err)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        err << "cannot read " << path << "\n";
+        return false;
+    }
+    int lineNumber = 0;
+    while (!file.atEnd()) {
+        ++lineNumber;
+        // A rule is the first word of its line
+        QString line = QString::fromUtf8(file.readLine()).trimmed();
+        const int space = line.indexOf(QLatin1Char(' '));
+        if (space >= 0) {
+            line.truncate(space);
+        }
+        if (line.isEmpty() || line.startsWith(QLatin1String("//"))) {
+            continue;
+        }
+
+        quint8 flag = PublicSuffixList::Normal;
+        if (line.startsWith(QLatin1Char('!'))) {
+            flag = PublicSuffixList::Exception;
+            line.remove(0, 1);
+        } else if (line.startsWith(QLatin1String("*."))) {
+            flag = PublicSuffixList::Wildcard;
+            line.remove(0, 2);
+        }
+        // Hosts are looked up in their ASCII form
+        QByteArray rule = QUrl::toAce(line);
+        if (rule.isEmpty() || rule.contains('*') || rule.startsWith('.') || rule.endsWith('.')) {
+            err << path << ":" << lineNumber << ": cannot use rule " << line << "\n";
+            return false;
+        }
+        std::reverse(rule.begin(), rule.end());
+        rules[rule] |= flag;
+    }
+    return true;
+}
+
+class GraphBuilder
+{
+public:
+    explicit GraphBuilder(const QMap<QByteArray, quint8> &rules)
+    {
+        QVector<State> trie(1);
+        for (auto it = rules.constBegin(); it != rules.constEnd(); ++it) {
+            int state = 0;
+            for (char c : it.key()) {
+                int next = trie[state].edges.value(c, -1);
+                if (next < 0) {
+                    next = trie.size();
+                    trie[state].edges.insert(c, next);
+                    trie.append(State());
+                }
+                state = next;
+            }
+            trie[state].flags |= it.value();
+        }
+        m_root = minimize(trie, 0);
+    }
+
+    QByteArray write()
+    {
+        // In-degrees decide which label nodes can be merged into their
+        // parent's run
+        QSet<quint64> seen;
+        QVector<quint64> stack = children(m_root);
+        for (quint64 node : stack) {
+            ++m_inDegree[node];
+        }
+        while (!stack.isEmpty()) {
+            const quint64 node = stack.takeLast();
+            if (seen.contains(node)) {
+                continue;
+            }
+            seen.insert(node);
+            for (quint64 child : children(labelState(node))) {
+                ++m_inDegree[child];
+                stack.append(child);
+            }
+        }
+
+        m_runs.append(Run());
+        const QVector<int> top = runsOf(children(m_root));
+        m_runs[0].children = top;
+
+        // Every run goes before its children, so all offsets point forward
+        // and stay small
+        QVector<int> order;
+        QVector<bool> visited(m_runs.size());
+        postOrder(0, visited, order);
+        std::reverse(order.begin(), order.end());
+
+        // Narrower offsets move the runs closer, which may narrow others
+        int size = 0;
+        for (bool changed = true; changed;) {
+            size = 0;
+            for (int run : order) {
+                m_runs[run].offset = size;
+                size += m_runs[run].characters.size() + headerSize(m_runs[run])
+                    + m_runs[run].width * m_runs[run].children.size();
+            }
+            changed = false;
+            for (Run &run : m_runs) {
+                int width = 1;
+                for (int child : run.children) {
+                    while (m_runs[child].offset - tableStart(run) >= (1 << (8 * width))) {
+                        ++width;
+                    }
+                }
+                if (width != run.width) {
+                    run.width = width;
+                    changed = true;
+                }
+            }
+        }
+        if (size >= MaxGraphSize) {
+            return QByteArray();
+        }
+
+        QByteArray graph;
+        graph.reserve(size);
+        for (int index : order) {
+            const Run &run = m_runs[index];
+            graph.append(run.characters);
+            const int count = run.children.size();
+            const int countBits = qMin(count, int(PublicSuffixList::ManyChildren));
+            graph.append(char(run.flags | ((run.width - 1) << 3) | (countBits << 5)));
+            if (count >= PublicSuffixList::ManyChildren) {
+                graph.append(char(count));
+            }
+            for (int child : run.children) {
+                const int distance = m_runs[child].offset - tableStart(run);
+                for (int i = 0; i < run.width; ++i) {
+                    graph.append(char((distance >> (8 * i)) & 0xff));
+                }
+            }
+        }
+        return graph;
+    }
+
+    int stateCount() const
+    {
+        return m_states.size();
+    }
+
+private:
+    // Bottom up; equal subtrees become one state
+    int minimize(const QVector<State> &trie, int index)
+    {
+        State state;
+        state.flags = trie[index].flags;
+        QByteArray key(1, char(state.flags));
+        for (auto it = trie[index].edges.constBegin(); it != trie[index].edges.constEnd(); ++it) {
+            const int child = minimize(trie, it.value());
+            state.edges.insert(it.key(), child);
+            key.append(it.key());
+            key.append(reinterpret_cast<const char *>(&child), sizeof(child));
+        }
+        auto existing = m_registry.constFind(key);
+        if (existing != m_registry.constEnd()) {
+            return existing.value();
+        }
+        m_states.append(state);
+        m_registry.insert(key, m_states.size() - 1);
+        return m_states.size() - 1;
+    }
+
+    QVector<quint64> children(int state) const
+    {
+        QVector<quint64> nodes;
+        for (auto it = m_states[state].edges.constBegin(); it != m_states[state].edges.constEnd(); ++it) {
+            nodes.append(labelNode(it.key(), it.value()));
+        }
+        return nodes;
+    }
+
+    // A run continues while its node ends no rule and its only child has
+    // no other parent
+    quint64 runEnd(quint64 node) const
+    {
+        for (;;) {
+            const State &state = m_states[labelState(node)];
+            if (state.flags || state.edges.size() != 1) {
+                return node;
+            }
+            const quint64 child = labelNode(state.edges.firstKey(), state.edges.first());
+            if (m_inDegree.value(child) != 1) {
+                return node;
+            }
+            node = child;
+        }
+    }
+
+    // The run starting at each of |nodes|, created on first use
+    QVector<int> runsOf(const QVector<quint64> &nodes)
+    {
+        QVector<int> runs;
+        for (quint64 node : nodes) {
+            auto it = m_runIndex.constFind(node);
+            if (it != m_runIndex.constEnd()) {
+                runs.append(it.value());
+                continue;
+            }
+            const int index = m_runs.size();
+            m_runIndex.insert(node, index);
+            m_runs.append(Run());
+            const quint64 end = runEnd(node);
+            QByteArray characters;
+            for (; node != end; node = children(labelState(node)).first()) {
+                characters.append(labelChar(node));
+            }
+            characters.append(char(quint8(labelChar(end)) | 0x80));
+            const QVector<int> next = runsOf(children(labelState(end)));
+            m_runs[index].characters = characters;
+            m_runs[index].flags = m_states[labelState(end)].flags;
+            m_runs[index].children = next;
+            runs.append(index);
+        }
+        return runs;
+    }
+
+    void postOrder(int run, QVector<bool> &visited, QVector<int> &order) const
+    {
+        visited[run] = true;
+        for (int child : m_runs[run].children) {
+            if (!visited[child]) {
+                postOrder(child, visited, order);
+            }
+        }
+        order.append(run);
+    }
+
+    static int headerSize(const Run &run)
+    {
+        return run.children.size() >= PublicSuffixList::ManyChildren ? 2 : 1;
+    }
+
+    static int tableStart(const Run &run)
+    {
+        return run.offset + run.characters.size() + headerSize(run);
+    }
+
+    QVector<State> m_states;
+    QHash<QByteArray, int> m_registry;
+    QHash<quint64, int> m_inDegree;
+    QVector<Run> m_runs;
+    QHash<quint64, int> m_runIndex;
+    int m_root;
+};
+
+bool writeHeader(const QString &path, const QByteArray &graph, int ruleCount)
+{
+    QByteArray text;
+    text += "// PublicSuffixGraph.h\n"
+            "//\n"
+            "// Generated by PublicSuffixCompiler from the Public Suffix List; do not\n"
+            "// edit. " + QByteArray::number(ruleCount) + " rules in " + QByteArray::number(graph.size()) + " bytes.\n"
+            "\n"
+            "#ifndef PUBLICSUFFIXGRAPH_H\n"
+            "#define PUBLICSUFFIXGRAPH_H\n"
+            "\n"
+            "namespace {\n"
+            "\n"
+            "const unsigned char PublicSuffixGraph[] = {";
+    for (int i = 0; i < graph.size(); ++i) {
+        text += i % 16 ? " " : "\n    ";
+        text += "0x" + QByteArray::number(quint8(graph.at(i)), 16).rightJustified(2, '0') + ",";
+    }
+    text += "\n};\n"
+            "\n"
+            "} // namespace\n"
+            "\n"
+            "#endif // PUBLICSUFFIXGRAPH_H\n";
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    file.write(text);
+    return file.commit();
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QTextStream err(stderr);
+    const QStringList arguments = app.arguments();
+    if (arguments.size() != 3) {
+        err << "usage: PublicSuffixCompiler public_suffix_list.dat PublicSuffixGraph.h\n";
+        return 2;
+    }
+
+    QMap<QByteArray, quint8> rules;
+    if (!parseRules(arguments.at(1), rules, err)) {
+        return 1;
+    }
+    GraphBuilder builder(rules);
+    const QByteArray graph = builder.write();
+    if (graph.isEmpty()) {
+        err << "the graph does not fit three-byte offsets\n";
+        return 1;
+    }
+    if (!writeHeader(arguments.at(2), graph, rules.size())) {
+        err << "cannot write " << arguments.at(2) << "\n";
+        return 1;
+    }
+    err << rules.size() << " rules, " << builder.stateCount() << " states, " << graph.size() << " bytes\n";
+    return 0;
+}
@@ -0,0 +1,3723 @@
+// PublicSuffixGraph.h
+//
+// Generated by PublicSuffixCompiler from the Public Suffix List; do not
+// edit. 9506 rules in 59299 bytes.
+
+#ifndef PUBLICSUFFIXGRAPH_H
+#define PUBLICSUFFIXGRAPH_H
+
+namespace {
+
+const unsigned char PublicSuffixGraph[] = {
+    0xe8, 0x1a, 0x33, 0xdf, 0xce, 0xdd, 0xba, 0xda, 0x0f, 0xd6, 0x04, 0xc9, 0xea, 0xc7, 0x2e, 0xbf,
+    0xd7, 0xbc, 0x17, 0xba, 0xf8, 0xb8, 0x06, 0xb5, 0xd6, 0xab, 0xce, 0x87, 0xed, 0x82, 0xbe, 0x62,
+    0xe1, 0x2d, 0xc8, 0x2d, 0x6d, 0x26, 0xcd, 0x1f, 0x1e, 0x0d, 0xcf, 0x07, 0x72, 0x06, 0x5a, 0x05,
+    0xbb, 0x04, 0x58, 0x02, 0x34, 0x00, 0xfa, 0xe8, 0x0e, 0x07, 0x02, 0xef, 0x01, 0xb0, 0x01, 0x94,
+    0x01, 0x28, 0x01, 0xfd, 0x00, 0xe3, 0x00, 0x93, 0x00, 0x8e, 0x00, 0x83, 0x00, 0x61, 0x00, 0x4f,
+    0x00, 0x20, 0x00, 0x1c, 0x00, 0xfa, 0x28, 0x2b, 0xd9, 0x79, 0xf8, 0x21, 0x01, 0xae, 0x80, 0x1a,
+    0x12, 0x0d, 0x04, 0x74, 0x69, 0x62, 0x65, 0x6c, 0xe5, 0x28, 0x27, 0xd5, 0x6f, 0xf4, 0x28, 0xfa,
+    0xe1, 0x67, 0x6e, 0x69, 0x74, 0xe6, 0x28, 0xfd, 0x91, 0xe5, 0x40, 0x07, 0x02, 0x74, 0xe9, 0x28,
+    0xf4, 0xe5, 0x6e, 0x6f, 0xfa, 0x28, 0x47, 0xce, 0xf5, 0x41, 0x06, 0x02, 0xf2, 0x28, 0x51, 0xc1,
+    0xae, 0x88, 0x0a, 0xe6, 0xfa, 0xe5, 0xfd, 0xe5, 0xca, 0xe3, 0xf4, 0x21, 0x01, 0xae, 0xe8, 0x07,
+    0x23, 0xcf, 0x1d, 0xcf, 0x74, 0xe3, 0x16, 0x00, 0x0e, 0x00, 0xff, 0xe5, 0x48, 0xe3, 0xef, 0x68,
+    0xe2, 0xe5, 0x10, 0xe4, 0xb0, 0xe5, 0xec, 0x48, 0x0b, 0xb7, 0xdf, 0xe5, 0xf3, 0x21, 0x01, 0xae,
+    0x68, 0xa9, 0xe3, 0xdb, 0xe5, 0xce, 0xe5, 0x72, 0xe1, 0x28, 0xab, 0x87, 0xee, 0x41, 0x0b, 0x02,
+    0xe1, 0x21, 0x01, 0x6e, 0x69, 0xe6, 0x28, 0xff, 0xc9, 0xae, 0xe8, 0x0a, 0x38, 0x00, 0x8e, 0xe3,
+    0xc0, 0xe5, 0xb4, 0xcb, 0x25, 0x00, 0x29, 0x99, 0xf7, 0xde, 0x3b, 0xc5, 0x1e, 0xd0, 0x14, 0x00,
+    0xf4, 0x68, 0x90, 0xe5, 0x06, 0x00, 0x68, 0xe5, 0x6e, 0x65, 0x6d, 0x61, 0x69, 0xec, 0x28, 0xae,
+    0xca, 0xe9, 0x40, 0x07, 0x02, 0x77, 0xe9, 0x29, 0x1d, 0xe1, 0xf2, 0x48, 0x86, 0xe5, 0x04, 0x00,
+    0xef, 0x28, 0x84, 0xd8, 0x61, 0x73, 0x71, 0x2d, 0xe9, 0x28, 0xfe, 0x75, 0xed, 0x21, 0x01, 0xae,
+    0xe8, 0x07, 0x48, 0xe3, 0x7a, 0xe5, 0x72, 0xe5, 0x6d, 0xe5, 0x3a, 0xe3, 0x40, 0xe5, 0x0e, 0x00,
+    0xf6, 0x48, 0xd1, 0xb4, 0x2b, 0xe5, 0xeb, 0x21, 0x01, 0xae, 0xe8, 0x07, 0xa9, 0x9f, 0x60, 0xe5,
+    0x58, 0xe5, 0x50, 0xe5, 0x0e, 0x00, 0x26, 0xe5, 0x1e, 0xe5, 0xf4, 0x48, 0x36, 0xe5, 0x04, 0x00,
+    0x72, 0x6f, 0x70, 0x65, 0x6c, 0x65, 0x74, 0x7a, 0x61, 0x6b, 0x2e, 0x73, 0x61, 0xe1, 0x28, 0xba,
+    0xac, 0x69, 0xe2, 0x49, 0x04, 0x00, 0xfc, 0xe4, 0xae, 0xe8, 0x09, 0x6d, 0xcd, 0x4c, 0x00, 0x47,
+    0x00, 0x3b, 0x00, 0x33, 0x00, 0x27, 0x00, 0x1e, 0x00, 0x16, 0x00, 0x12, 0x00, 0xf8, 0x28, 0x20,
+    0xe5, 0x73, 0x6e, 0xe4, 0x48, 0xdf, 0xd2, 0x85, 0xe3, 0x72, 0x65, 0x74, 0x74, 0x65, 0xe2, 0x28,
+    0xb9, 0x7e, 0xf0, 0x68, 0x0f, 0xc1, 0x06, 0xd4, 0x06, 0x00, 0xf4, 0x28, 0x3f, 0xd3, 0x6e, 0x61,
+    0x66, 0x61, 0xed, 0x28, 0xf6, 0xe4, 0x6c, 0x69, 0x61, 0x72, 0x74, 0x65, 0x76, 0x69, 0xf4, 0x28,
+    0xba, 0xe2, 0x69, 0xfa, 0x28, 0xac, 0xd5, 0xe5, 0x60, 0x0f, 0x09, 0x03, 0x72, 0x6f, 0xed, 0x28,
+    0x89, 0x7e, 0x6d, 0x6f, 0xf3, 0x28, 0x83, 0x7e, 0x68, 0xf4, 0x28, 0x7e, 0x7e, 0xe4, 0x21, 0x01,
+    0xae, 0xe8, 0x08, 0x25, 0x28, 0xc9, 0xe4, 0x65, 0xe0, 0x10, 0x00, 0x82, 0xd9, 0x25, 0x7f, 0x8f,
+    0xe4, 0x87, 0xe4, 0xed, 0x48, 0xaa, 0xe4, 0xc6, 0xe4, 0xe3, 0x21, 0x01, 0xae, 0xa8, 0x36, 0x00,
+    0x20, 0x00, 0x0a, 0x00, 0xa1, 0xe4, 0xdb, 0xdd, 0xed, 0x48, 0xe4, 0xc8, 0x04, 0x00, 0x75, 0x72,
+    0x74, 0x6e, 0x65, 0x63, 0x61, 0x74, 0x65, 0x6d, 0xae, 0x48, 0xbb, 0xc8, 0xb7, 0xd0, 0x69, 0x6e,
+    0x75, 0x6d, 0x2e, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0xae, 0x40, 0x06, 0x02, 0xf4, 0x28, 0xc0, 0xd7,
+    0xf2, 0x28, 0xb5, 0xd5, 0xb4, 0x28, 0x42, 0xe4, 0xe2, 0x21, 0x01, 0xae, 0xe8, 0x07, 0xe0, 0xe0,
+    0x6e, 0xe4, 0x0e, 0x00, 0x5e, 0xe4, 0x2e, 0xe2, 0x34, 0xe4, 0x2c, 0xe4, 0xea, 0x28, 0xca, 0x78,
+    0xe1, 0x21, 0x01, 0xae, 0xe8, 0x0a, 0xd5, 0xe1, 0x56, 0xe4, 0x4e, 0xe4, 0x46, 0xe4, 0xb2, 0xd9,
+    0x96, 0x29, 0x67, 0xe2, 0x1c, 0xe4, 0x14, 0xe4, 0x39, 0xdc, 0xf9, 0xe8, 0x16, 0x5a, 0x02, 0x53,
+    0x02, 0x1a, 0x02, 0xf9, 0x01, 0xb7, 0x01, 0xac, 0x01, 0x87, 0x01, 0x62, 0x01, 0xf8, 0x86, 0x85,
+    0xd5, 0x5c, 0x01, 0x2a, 0x01, 0x03, 0x01, 0xf2, 0x00, 0xec, 0x00, 0xd8, 0x00, 0xad, 0x00, 0xa3,
+    0x00, 0x52, 0x00, 0x35, 0x00, 0x2c, 0x00, 0xac, 0xaa, 0x76, 0x61, 0xee, 0x21, 0x01, 0xe4, 0x28,
+    0xbc, 0xac, 0xf5, 0x41, 0x09, 0x02, 0xe2, 0x21, 0x01, 0xf4, 0x28, 0x59, 0xaa, 0xae, 0xc8, 0x0c,
+    0x00, 0xfd, 0xe3, 0xf5, 0xe3, 0x58, 0xce, 0xbd, 0xe1, 0xc3, 0xe3, 0xe2, 0x28, 0x72, 0xce, 0xf4,
+    0xa8, 0x33, 0x61, 0x18, 0x00, 0x2d, 0xc8, 0x0a, 0x00, 0xc9, 0x88, 0xf2, 0x40, 0x07, 0x02, 0x65,
+    0xf0, 0x28, 0xba, 0xc6, 0x61, 0xf0, 0x29, 0xc1, 0xd1, 0xe9, 0xa8, 0xc7, 0xe3, 0x2f, 0x00, 0x10,
+    0x00, 0x0a, 0x00, 0xda, 0x85, 0xf2, 0x48, 0x5c, 0xb1, 0xd9, 0x9c, 0xee, 0x40, 0x18, 0x02, 0x75,
+    0x6d, 0x6d, 0x6f, 0xe3, 0x21, 0x01, 0xae, 0x68, 0xcc, 0x80, 0xd4, 0x59, 0x06, 0x00, 0x6d, 0x75,
+    0x72, 0xef, 0x28, 0xe8, 0xd1, 0x69, 0xe6, 0x28, 0xa9, 0xe4, 0x6c, 0x65, 0xe4, 0x28, 0x03, 0xd9,
+    0xf3, 0x49, 0x42, 0xc6, 0x04, 0x00, 0xf0, 0x28, 0x1b, 0xd7, 0xf2, 0xa8, 0x16, 0x00, 0xfc, 0x85,
+    0x12, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0xf5, 0x28, 0x3a, 0xc6, 0xf4, 0x28, 0x7f, 0x85, 0xef, 0x28,
+    0x8b, 0x83, 0xe5, 0x88, 0x0d, 0x00, 0x88, 0x8e, 0x0c, 0x2b, 0x08, 0x00, 0x76, 0xe9, 0x28, 0x5f,
+    0xdf, 0xe3, 0x28, 0x81, 0xdc, 0xf0, 0x21, 0x01, 0xae, 0xe8, 0x07, 0x61, 0xe3, 0x59, 0xe3, 0x51,
+    0xe3, 0x8b, 0xa7, 0x21, 0xe1, 0x27, 0xe3, 0x1f, 0xe3, 0xef, 0x48, 0xd9, 0xdc, 0xd3, 0xe2, 0xee,
+    0x48, 0x04, 0x00, 0xc9, 0xca, 0xe1, 0x48, 0x04, 0x00, 0x32, 0xc9, 0x66, 0xe6, 0x28, 0x4a, 0xe3,
+    0xed, 0x69, 0x12, 0x00, 0x06, 0x00, 0x45, 0xdb, 0x65, 0x64, 0x61, 0x63, 0xe1, 0x21, 0x01, 0x2e,
+    0xec, 0x28, 0x99, 0xd8, 0xae, 0xe8, 0x08, 0xa4, 0xe0, 0x25, 0xe3, 0x1d, 0xe3, 0x15, 0xe3, 0xf3,
+    0xe2, 0xeb, 0xe2, 0xe3, 0xe2, 0x08, 0xdb, 0xec, 0xa9, 0x17, 0x00, 0xa3, 0xe1, 0x10, 0x00, 0x0a,
+    0x00, 0x0e, 0x22, 0xec, 0x48, 0x18, 0xe3, 0x8e, 0xd6, 0x69, 0x6d, 0x61, 0xe6, 0x29, 0xd3, 0x88,
+    0xae, 0xe8, 0x08, 0x74, 0xa7, 0x10, 0x00, 0xf9, 0xe2, 0x6a, 0xe0, 0xe9, 0xe2, 0xb9, 0xe0, 0xbf,
+    0xe2, 0xb7, 0xe2, 0xe4, 0x48, 0xeb, 0xdf, 0xa2, 0xe1, 0xeb, 0x49, 0x9a, 0x02, 0x63, 0xe2, 0xe7,
+    0x61, 0x12, 0x07, 0x03, 0xf2, 0x28, 0xef, 0x6a, 0x6f, 0x6c, 0x6f, 0x6e, 0x68, 0x63, 0x65, 0xf4,
+    0x29, 0x22, 0xd1, 0xae, 0xe8, 0x07, 0x9b, 0xab, 0xc6, 0xe2, 0xb6, 0xe2, 0xb9, 0xe2, 0x86, 0xe0,
+    0x8c, 0xe2, 0x84, 0xe2, 0xe5, 0x80, 0x1e, 0x19, 0x0b, 0x04, 0x73, 0x6e, 0x69, 0xeb, 0x28, 0xc9,
+    0xca, 0xee, 0x68, 0xbe, 0x85, 0x8a, 0xe1, 0x06, 0x00, 0x72, 0x6f, 0xf4, 0x28, 0x9f, 0xde, 0x6c,
+    0xf4, 0x28, 0xb4, 0x0c, 0x6b, 0xe3, 0x28, 0x7e, 0xe1, 0xe4, 0x48, 0x04, 0x00, 0x35, 0xc0, 0x64,
+    0xe1, 0x28, 0x88, 0x2c, 0xe3, 0x69, 0x06, 0x00, 0x9d, 0xa6, 0x71, 0x60, 0xae, 0xe8, 0x0a, 0x4b,
+    0xe0, 0x0c, 0xc2, 0x7d, 0xe2, 0x75, 0xe2, 0x22, 0x00, 0x5d, 0xc5, 0x14, 0x00, 0x3d, 0xe0, 0x3b,
+    0xe2, 0x60, 0xda, 0xf3, 0x48, 0x04, 0x00, 0x2e, 0xe0, 0x65, 0x67, 0x6f, 0x6c, 0xeb, 0x28, 0x29,
+    0xe2, 0xed, 0x48, 0x04, 0x00, 0x68, 0xe2, 0x6f, 0xe3, 0x21, 0x01, 0xae, 0x48, 0x04, 0x00, 0x7c,
+    0xdb, 0x65, 0xe3, 0x28, 0x41, 0x19, 0xe2, 0x69, 0x0a, 0x00, 0x84, 0xe1, 0x06, 0x00, 0xe7, 0x28,
+    0xf7, 0x93, 0xae, 0xc8, 0x0c, 0x00, 0xb2, 0xd7, 0x11, 0x03, 0x30, 0xe2, 0x93, 0xcc, 0xf6, 0xe1,
+    0x64, 0x75, 0x6f, 0xec, 0x28, 0xd1, 0x07, 0xe1, 0xe8, 0x07, 0x16, 0x00, 0xe6, 0xe1, 0xef, 0xcb,
+    0x12, 0x00, 0x7d, 0x89, 0x23, 0x83, 0x0e, 0x00, 0xf7, 0x28, 0xff, 0x85, 0xf0, 0x29, 0xbc, 0xe1,
+    0xe4, 0x41, 0x13, 0x02, 0x6f, 0xf4, 0x21, 0x01, 0x2e, 0x65, 0x6d, 0x79, 0x66, 0x69, 0x6c, 0x61,
+    0x75, 0xf1, 0x28, 0xc3, 0xdf, 0xe9, 0x48, 0x11, 0x6e, 0x04, 0x00, 0x72, 0xe6, 0x28, 0x4d, 0x17,
+    0x37, 0x72, 0x72, 0xb0, 0x28, 0x9f, 0xd8, 0x34, 0x70, 0xf5, 0x28, 0xb3, 0x72, 0xf8, 0xe8, 0x0a,
+    0x7b, 0x00, 0x70, 0x00, 0x5b, 0x00, 0x55, 0x00, 0xc4, 0x6d, 0x39, 0x00, 0x29, 0x00, 0x25, 0x00,
+    0x21, 0x00, 0x14, 0x00, 0xf8, 0x48, 0x04, 0x00, 0xcb, 0xe2, 0x61, 0xed, 0x48, 0xa7, 0x6d, 0x00,
+    0x7d, 0xf3, 0x29, 0x73, 0xd5, 0xf2, 0x28, 0x9a, 0xe2, 0xef, 0x68, 0x0a, 0x00, 0x41, 0xe0, 0x06,
+    0x00, 0xf2, 0x28, 0x83, 0x9b, 0xe2, 0x29, 0xaa, 0xe2, 0xed, 0x69, 0x0e, 0x00, 0x65, 0xe1, 0x06,
+    0x00, 0x6d, 0x61, 0x32, 0x69, 0xe2, 0x28, 0x51, 0x77, 0xae, 0xa8, 0x99, 0xde, 0x91, 0xe1, 0x81,
+    0xe1, 0x5f, 0xe1, 0x57, 0xe1, 0x69, 0x6c, 0xe6, 0x28, 0x43, 0xdf, 0xe5, 0x88, 0x0d, 0x00, 0x08,
+    0x00, 0xd1, 0xd4, 0x01, 0xe1, 0x6d, 0xe1, 0x29, 0x96, 0xd6, 0xe4, 0x48, 0x50, 0xbf, 0x77, 0x57,
+    0xe3, 0x21, 0x01, 0xae, 0x68, 0x64, 0xdd, 0x88, 0xdf, 0x25, 0xe1, 0xe1, 0x49, 0x04, 0x00, 0x6e,
+    0xe1, 0xae, 0xe8, 0x07, 0x74, 0xc9, 0x2d, 0xaa, 0x8b, 0xcb, 0x12, 0x00, 0x6c, 0xd6, 0x3c, 0xd1,
+    0x0e, 0x00, 0xf9, 0x28, 0x4d, 0xe2, 0xf3, 0x48, 0x10, 0xe1, 0x9a, 0xde, 0xf7, 0xe8, 0x0c, 0x09,
+    0x01, 0x00, 0x01, 0xee, 0x00, 0xdf, 0x00, 0x01, 0xe1, 0xcb, 0x00, 0xb0, 0x00, 0xa2, 0x00, 0x83,
+    0x00, 0x6c, 0x00, 0x27, 0x00, 0x18, 0x00, 0xfa, 0x21, 0x01, 0xae, 0xa8, 0xee, 0xde, 0x20, 0xe1,
+    0x18, 0xe1, 0x13, 0xe1, 0xde, 0xe0, 0xf4, 0x21, 0x01, 0xae, 0xe8, 0x0a, 0x38, 0x00, 0x2c, 0x00,
+    0xec, 0xd6, 0x10, 0xe1, 0x26, 0x00, 0x18, 0x00, 0xde, 0xe0, 0xd6, 0xe0, 0x7f, 0xb2, 0x14, 0x00,
+    0xfa, 0x28, 0x0a, 0x47, 0x6d, 0x6f, 0xe3, 0x21, 0x01, 0x2e, 0x72, 0x65, 0x6c, 0x69, 0xe1, 0x28,
+    0x95, 0x18, 0xec, 0x48, 0xe3, 0xe0, 0xa5, 0xdd, 0xe2, 0x48, 0x04, 0x00, 0x82, 0xd4, 0x38, 0x32,
+    0xf7, 0x28, 0x08, 0xd9, 0x61, 0x34, 0x36, 0xef, 0x28, 0x3d, 0xb2, 0xf2, 0x49, 0x04, 0x00, 0xb8,
+    0xe0, 0xae, 0xe8, 0x07, 0x96, 0xde, 0xc8, 0xe0, 0xc0, 0xe0, 0xbb, 0xe0, 0xf2, 0xa4, 0x88, 0xde,
+    0x86, 0xe0, 0xf0, 0x21, 0x01, 0xae, 0xe8, 0x07, 0x13, 0x00, 0x7d, 0xe0, 0x9a, 0xe0, 0x9b, 0xb9,
+    0xb7, 0xe0, 0x19, 0xdf, 0x0e, 0x00, 0x75, 0xe1, 0x28, 0x6a, 0x8e, 0x33, 0x34, 0xb4, 0x28, 0xa2,
+    0xe1, 0xef, 0x88, 0x19, 0x84, 0x08, 0x00, 0x82, 0xe0, 0xed, 0xdd, 0xe8, 0x29, 0x11, 0xe0, 0xed,
+    0x49, 0x04, 0x00, 0x6f, 0xe0, 0xae, 0xe8, 0x09, 0x52, 0xde, 0x84, 0xe0, 0x53, 0xa4, 0x77, 0xe0,
+    0xae, 0xa4, 0x95, 0xde, 0x4a, 0xe0, 0x42, 0xe0, 0x67, 0xd8, 0xeb, 0x21, 0x01, 0xae, 0xe8, 0x07,
+    0xf3, 0x82, 0x41, 0xb0, 0x6c, 0xe0, 0x5c, 0xe0, 0x2c, 0xde, 0x32, 0xe0, 0x2a, 0xe0, 0xe5, 0x68,
+    0x06, 0x00, 0x45, 0xe0, 0xde, 0xdf, 0x69, 0x76, 0x65, 0xf2, 0x29, 0x3d, 0xce, 0xe3, 0x41, 0x06,
+    0x02, 0xe3, 0x28, 0xd3, 0xdf, 0xae, 0x88, 0x45, 0xe0, 0x35, 0xe0, 0x05, 0xde, 0x0b, 0xe0, 0xe2,
+    0x21, 0x01, 0xae, 0x48, 0x38, 0xe0, 0x2b, 0xe0, 0xe1, 0x69, 0x06, 0x00, 0xd7, 0xde, 0x0d, 0xdf,
+    0xae, 0x28, 0x1a, 0xe0, 0xf6, 0xe8, 0x0b, 0x09, 0xe0, 0x45, 0x01, 0x9e, 0x00, 0xfd, 0xb4, 0x86,
+    0x00, 0x66, 0x00, 0x60, 0x00, 0x1a, 0xd0, 0x51, 0x00, 0x1c, 0x00, 0x16, 0x00, 0x75, 0x71, 0xe8,
+    0x28, 0x8b, 0xd8, 0xf4, 0xa9, 0x0e, 0x00, 0x65, 0xdd, 0x0a, 0x00, 0xc2, 0xde, 0x4a, 0xbb, 0xe7,
+    0x28, 0xe7, 0xde, 0xae, 0x68, 0x19, 0x00, 0x06, 0x00, 0xb8, 0xcd, 0x6e, 0x61, 0x68, 0x74, 0xad,
+    0x40, 0x08, 0x02, 0x72, 0x65, 0xf4, 0x28, 0x78, 0x9d, 0x65, 0xf3, 0x28, 0xbc, 0xd2, 0x62, 0x65,
+    0x77, 0x2d, 0x65, 0x68, 0xf4, 0x28, 0x79, 0xa0, 0xf3, 0x21, 0x01, 0xae, 0xa8, 0xd7, 0xdc, 0xb1,
+    0xdd, 0xcf, 0xdf, 0xbf, 0xdf, 0x95, 0xdf, 0xef, 0x48, 0x87, 0xdf, 0xc1, 0xdf, 0xed, 0x21, 0x01,
+    0xae, 0xe8, 0x0a, 0x38, 0xdd, 0xb9, 0xdf, 0xb1, 0xdf, 0x88, 0xa3, 0x14, 0x00, 0xe3, 0xa3, 0xca,
+    0xdd, 0x7f, 0xdf, 0x77, 0xdf, 0x9c, 0xd7, 0xef, 0x48, 0xc7, 0xdd, 0xab, 0x06, 0xec, 0x21, 0x01,
+    0xae, 0xe8, 0x09, 0x10, 0xb1, 0x09, 0x5f, 0x99, 0xdf, 0x91, 0xdf, 0x89, 0xdf, 0xdd, 0x05, 0x59,
+    0xdd, 0x5f, 0xdf, 0x57, 0xdf, 0x65, 0xe4, 0x21, 0x01, 0xae, 0xe0, 0x0d, 0x9c, 0x98, 0x72, 0x61,
+    0x59, 0x53, 0x49, 0x43, 0x38, 0x2b, 0x24, 0x1a, 0x0d, 0xf9, 0x48, 0x04, 0x00, 0xb3, 0xd2, 0x61,
+    0x77, 0x65, 0x74, 0x61, 0xe7, 0x02, 0x77, 0x65, 0x69, 0x76, 0x65, 0x72, 0xf0, 0x28, 0x87, 0x94,
+    0x76, 0xf2, 0x48, 0xa2, 0xcc, 0x4a, 0xdd, 0x74, 0x72, 0x65, 0x63, 0x6c, 0x61, 0x63, 0x6f, 0x6c,
+    0xae, 0x28, 0xcf, 0xbd, 0xf3, 0x48, 0xe4, 0xcb, 0x04, 0x00, 0x72, 0xe5, 0x28, 0xa1, 0x9e, 0x70,
+    0x70, 0xe1, 0x28, 0xd5, 0x9a, 0xef, 0x48, 0x1c, 0xad, 0x04, 0x00, 0xf4, 0x28, 0x1b, 0x77, 0xec,
+    0x48, 0x39, 0x00, 0xaa, 0x0b, 0x68, 0x63, 0x65, 0x74, 0xe1, 0x28, 0x70, 0x85, 0xe7, 0x48, 0x04,
+    0x00, 0xfd, 0xcf, 0x6e, 0x69, 0x67, 0x61, 0x74, 0x73, 0x2d, 0xef, 0x28, 0xf7, 0xac, 0xe5, 0x88,
+    0x1e, 0x00, 0x0e, 0x00, 0x2a, 0xc3, 0x08, 0x00, 0x72, 0x61, 0xe8, 0x28, 0xd6, 0x14, 0x67, 0x61,
+    0x74, 0xf3, 0x48, 0x5c, 0xa0, 0x04, 0x00, 0xec, 0x20, 0x01, 0xe3, 0x28, 0x7f, 0x96, 0x64, 0x6f,
+    0xe3, 0x28, 0x9d, 0x8c, 0xe1, 0x28, 0x5e, 0x83, 0xb2, 0x28, 0xd0, 0xde, 0xe3, 0x21, 0x01, 0xae,
+    0xa8, 0xde, 0x06, 0xdb, 0xde, 0xcb, 0xde, 0x0a, 0x00, 0xa1, 0xde, 0xf4, 0x48, 0xf6, 0xdc, 0xa1,
+    0xde, 0xf5, 0xe8, 0x0f, 0x3e, 0x05, 0xa1, 0x04, 0x8d, 0x04, 0x76, 0x04, 0x40, 0x04, 0x26, 0x04,
+    0x6c, 0x03, 0x63, 0x03, 0x4f, 0x03, 0x21, 0x03, 0x14, 0x03, 0xc7, 0x01, 0x37, 0x00, 0x23, 0x00,
+    0x1e, 0x00, 0x79, 0xeb, 0x28, 0x3d, 0x57, 0xf6, 0x21, 0x01, 0xae, 0xe8, 0x07, 0xa3, 0xdb, 0x6f,
+    0xbe, 0x8f, 0xde, 0x08, 0x7f, 0x5f, 0xdc, 0x65, 0xde, 0x50, 0xd1, 0xf3, 0x41, 0x12, 0x02, 0xf4,
+    0x48, 0x98, 0x4c, 0x04, 0x00, 0xe9, 0x48, 0x27, 0x56, 0x04, 0x00, 0xed, 0x28, 0xb3, 0x54, 0xae,
+    0xe8, 0x0e, 0x17, 0x01, 0x9a, 0x02, 0x02, 0x01, 0xfd, 0x00, 0xe3, 0x00, 0x93, 0x00, 0x85, 0x00,
+    0x5f, 0x00, 0x5a, 0x00, 0x4b, 0x00, 0x34, 0x00, 0x27, 0x00, 0xba, 0x01, 0x1c, 0x00, 0xfa, 0x48,
+    0x95, 0x01, 0x04, 0x00, 0x65, 0xed, 0x28, 0x1e, 0xd9, 0x76, 0xef, 0x48, 0x04, 0x00, 0x39, 0xde,
+    0x68, 0x73, 0xe1, 0x28, 0x32, 0x97, 0xf4, 0x40, 0x10, 0x02, 0x6e, 0x65, 0xeb, 0x40, 0x06, 0x02,
+    0xed, 0x28, 0x40, 0xb4, 0xe8, 0x28, 0x76, 0x04, 0x65, 0xee, 0x28, 0xc3, 0xd1, 0xf2, 0x40, 0x06,
+    0x02, 0xe9, 0x28, 0xa4, 0x01, 0x61, 0x64, 0x6f, 0xee, 0x28, 0xa0, 0xa7, 0x6f, 0xf6, 0x28, 0x1c,
+    0xd9, 0x6e, 0xe1, 0x60, 0x1f, 0x16, 0x03, 0x74, 0xf3, 0x48, 0xd4, 0x01, 0x04, 0x00, 0x68, 0x6b,
+    0x61, 0x7a, 0x61, 0x6b, 0xad, 0x48, 0xdd, 0xab, 0x80, 0x90, 0x6a, 0x69, 0x61, 0x62, 0x72, 0xe5,
+    0x28, 0x85, 0xc3, 0xe7, 0x28, 0xcb, 0x53, 0xec, 0x40, 0x07, 0x02, 0x79, 0xe2, 0x28, 0x37, 0x86,
+    0x6f, 0xe3, 0x28, 0xd0, 0x71, 0xeb, 0x68, 0x45, 0x00, 0xcf, 0x01, 0x06, 0x00, 0xf3, 0xa8, 0x33,
+    0x00, 0xdb, 0xdd, 0x16, 0x00, 0x11, 0x00, 0x0a, 0x00, 0x76, 0x6f, 0x72, 0xeb, 0x28, 0x6d, 0xd9,
+    0x74, 0xe9, 0x28, 0xea, 0x80, 0xee, 0x40, 0x11, 0x02, 0xe9, 0x40, 0x06, 0x02, 0xee, 0x28, 0x53,
+    0x47, 0x62, 0x75, 0x79, 0xf4, 0x28, 0x60, 0x7d, 0xe1, 0x48, 0x04, 0x00, 0x12, 0x68, 0xed, 0x28,
+    0x8a, 0x47, 0x6c, 0x65, 0x67, 0x6e, 0x61, 0x68, 0xeb, 0x28, 0xad, 0xd5, 0x61, 0x6c, 0x68, 0x73,
+    0x79, 0xe7, 0x28, 0xb3, 0x86, 0xe9, 0x88, 0x89, 0x01, 0x14, 0x00, 0x10, 0x00, 0x08, 0x00, 0x74,
+    0x74, 0x61, 0x69, 0xec, 0x28, 0x78, 0x58, 0xef, 0x28, 0xda, 0x88, 0xe8, 0x28, 0xdb, 0x20, 0x67,
+    0xf5, 0x28, 0xce, 0x65, 0x64, 0xe1, 0x40, 0x0c, 0x02, 0x72, 0x67, 0x6f, 0x6e, 0x69, 0x6c, 0xe5,
+    0x28, 0xdc, 0x52, 0x62, 0x61, 0xe7, 0x28, 0x50, 0x53, 0xe1, 0xe8, 0x08, 0x50, 0x00, 0x4b, 0x00,
+    0x1f, 0x00, 0x2f, 0x95, 0x18, 0x00, 0x14, 0x00, 0x88, 0x01, 0x10, 0x00, 0xfa, 0x28, 0xda, 0x3d,
+    0xf6, 0x28, 0x10, 0xba, 0x72, 0x61, 0x68, 0xeb, 0x28, 0x29, 0xd0, 0xe9, 0xe8, 0x08, 0x26, 0x8f,
+    0x7f, 0x01, 0x24, 0x00, 0x1e, 0x00, 0x78, 0x01, 0x17, 0x00, 0x72, 0x01, 0x10, 0x00, 0x7a, 0x61,
+    0x68, 0xeb, 0x28, 0x12, 0xda, 0x73, 0x73, 0x61, 0xeb, 0x28, 0x41, 0xd7, 0x6e, 0x65, 0xed, 0x28,
+    0x27, 0xd5, 0x6c, 0xe5, 0x28, 0x2c, 0xa3, 0x67, 0xf5, 0x28, 0xef, 0xa2, 0xe4, 0x40, 0x08, 0x02,
+    0x6e, 0x61, 0xe7, 0x28, 0xef, 0x70, 0x67, 0xef, 0x28, 0x91, 0xd7, 0xf2, 0x89, 0x08, 0x00, 0x8d,
+    0x80, 0x89, 0xdc, 0x82, 0xc7, 0xae, 0xe8, 0x15, 0x3b, 0x01, 0x18, 0x01, 0x14, 0x01, 0xc2, 0xda,
+    0x0f, 0x01, 0x05, 0x01, 0xef, 0x00, 0xe5, 0x00, 0xcb, 0x00, 0xbb, 0x00, 0xe4, 0xdc, 0xb0, 0x00,
+    0x86, 0x00, 0x34, 0x22, 0x66, 0x00, 0x5c, 0x00, 0x4b, 0x00, 0x41, 0x00, 0x3a, 0x00, 0x34, 0x00,
+    0x2a, 0x00, 0xfa, 0x20, 0x01, 0x61, 0x6b, 0x76, 0x61, 0xeb, 0x20, 0x3f, 0x79, 0x6e, 0xfa, 0x28,
+    0xd4, 0xd5, 0x76, 0xef, 0x48, 0x7b, 0xdc, 0xa0, 0xdc, 0xf5, 0x48, 0x04, 0x00, 0x7a, 0xdc, 0xb4,
+    0x28, 0x30, 0xda, 0xf4, 0xa8, 0x8d, 0xdc, 0x0a, 0x00, 0xce, 0xda, 0x79, 0xdc, 0xcc, 0xc7, 0x69,
+    0xe1, 0x28, 0x29, 0x1f, 0xf3, 0x48, 0x5a, 0xce, 0x04, 0x00, 0xe9, 0x28, 0x9a, 0xa9, 0x72, 0xe9,
+    0x68, 0x6f, 0xdc, 0x0e, 0x00, 0x06, 0x00, 0xed, 0x20, 0x01, 0x69, 0xe4, 0x28, 0x29, 0x86, 0xe4,
+    0x48, 0x04, 0x00, 0x99, 0x7a, 0x63, 0xed, 0x21, 0x01, 0x2e, 0xf3, 0x28, 0x14, 0x59, 0x6f, 0x6e,
+    0x69, 0x6a, 0x79, 0xed, 0x21, 0x01, 0xae, 0x60, 0x12, 0x08, 0x03, 0x73, 0xf0, 0x28, 0xe4, 0x93,
+    0x6d, 0x75, 0x72, 0x74, 0x63, 0x65, 0xf0, 0x28, 0xe4, 0xcd, 0x67, 0x6e, 0xe9, 0x48, 0x04, 0x00,
+    0x2d, 0x12, 0x64, 0x6e, 0xe1, 0x28, 0xd5, 0x93, 0x6e, 0x61, 0x74, 0xf3, 0x20, 0x01, 0x65, 0xe7,
+    0x28, 0x3f, 0xd8, 0x6c, 0xe9, 0x48, 0x04, 0x00, 0x34, 0xdc, 0x61, 0x6d, 0x64, 0x6c, 0x63, 0xae,
+    0x28, 0xe3, 0x7c, 0xeb, 0x40, 0x11, 0x02, 0xf3, 0x48, 0x21, 0xdc, 0x04, 0x00, 0x72, 0x6f, 0x67,
+    0x69, 0x74, 0xe1, 0x28, 0x2b, 0xab, 0x69, 0x68, 0x63, 0xec, 0x28, 0x96, 0xd9, 0xe9, 0x20, 0x01,
+    0x61, 0x6e, 0x61, 0xf4, 0x28, 0x2e, 0x54, 0xe7, 0x68, 0xdf, 0xc1, 0x06, 0x00, 0x06, 0xdc, 0x6e,
+    0x69, 0x74, 0x73, 0x6f, 0x68, 0x75, 0x72, 0x67, 0x65, 0xf2, 0x28, 0x52, 0x0f, 0xe5, 0x48, 0x80,
+    0x22, 0x04, 0x00, 0xf2, 0x28, 0x00, 0xc4, 0x64, 0xf5, 0x28, 0x14, 0x17, 0xe2, 0x28, 0x36, 0xc7,
+    0xe1, 0x40, 0x09, 0x02, 0x79, 0x65, 0x67, 0xf9, 0x28, 0x3a, 0xab, 0xe9, 0x60, 0x10, 0x09, 0x03,
+    0x76, 0x6f, 0xe4, 0x28, 0xc2, 0xc5, 0x72, 0x69, 0x6b, 0xe8, 0x28, 0x42, 0xd1, 0x6b, 0x79, 0xed,
+    0x28, 0x98, 0xa1, 0x33, 0xeb, 0x28, 0x91, 0xda, 0xef, 0x40, 0x06, 0x02, 0xf9, 0x29, 0xa4, 0xdb,
+    0x67, 0xe7, 0x28, 0xda, 0x25, 0xee, 0x41, 0x07, 0x02, 0x65, 0xed, 0x29, 0x06, 0xd3, 0xae, 0x60,
+    0x18, 0x0b, 0x03, 0x74, 0x65, 0x6e, 0x6b, 0xe3, 0x28, 0x8e, 0xd9, 0x65, 0x6e, 0xe9, 0x48, 0x04,
+    0x00, 0x8b, 0xdb, 0x65, 0xf3, 0x28, 0xaa, 0xcd, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0x65, 0x73, 0xe9,
+    0x28, 0x1c, 0x1a, 0xed, 0x21, 0x01, 0xae, 0xe8, 0x07, 0x41, 0xd9, 0x73, 0xdb, 0x63, 0xdb, 0x66,
+    0xdb, 0x76, 0xdb, 0x33, 0xd9, 0x31, 0xdb, 0xec, 0x21, 0x01, 0xae, 0x48, 0x65, 0xca, 0x8d, 0xd4,
+    0xe8, 0x69, 0x06, 0x00, 0xd8, 0xc2, 0x64, 0x04, 0xae, 0xe8, 0x11, 0xaa, 0x00, 0x96, 0x00, 0x8f,
+    0x00, 0x51, 0xdb, 0x8a, 0x00, 0x75, 0xac, 0x7a, 0x00, 0x71, 0x00, 0x54, 0x00, 0x29, 0xc1, 0x4f,
+    0x00, 0x3d, 0x00, 0x30, 0x00, 0x7e, 0xcb, 0x29, 0x00, 0x6a, 0x17, 0x22, 0x00, 0x7a, 0x73, 0x61,
+    0xe7, 0x28, 0xef, 0xcb, 0x78, 0xe5, 0x48, 0xa7, 0xda, 0xad, 0xa6, 0xf4, 0x68, 0x72, 0xb8, 0xf1,
+    0xda, 0x06, 0x00, 0x72, 0xef, 0x28, 0x6e, 0xc6, 0xf3, 0x68, 0x06, 0x00, 0xee, 0xd0, 0x79, 0x89,
+    0xe1, 0x48, 0x04, 0x00, 0x41, 0x41, 0xeb, 0x28, 0x9c, 0xd9, 0x72, 0xe1, 0x28, 0x48, 0xd4, 0xef,
+    0xa8, 0xf1, 0xda, 0x16, 0x00, 0x1f, 0xd9, 0x0f, 0x00, 0x0a, 0x00, 0x6e, 0xe9, 0x28, 0x4b, 0x8d,
+    0x6c, 0x65, 0x76, 0xf9, 0x28, 0x5e, 0xa6, 0x65, 0xe4, 0x28, 0xef, 0xd6, 0x6e, 0x61, 0x6c, 0x74,
+    0x61, 0xe7, 0x28, 0x00, 0xd9, 0xed, 0x88, 0x08, 0x00, 0x2f, 0xc3, 0xe4, 0xda, 0x5f, 0x74, 0x61,
+    0x6c, 0xeb, 0x28, 0xae, 0xd8, 0x69, 0xec, 0x28, 0xa7, 0xd4, 0x65, 0x64, 0x73, 0xfa, 0x28, 0x64,
+    0xda, 0xe1, 0x68, 0x09, 0x00, 0x08, 0x81, 0x06, 0x00, 0xeb, 0x20, 0x04, 0xe3, 0x20, 0x01, 0x69,
+    0x74, 0xef, 0x28, 0xc2, 0xae, 0x30, 0xb0, 0x28, 0xf0, 0x73, 0xe7, 0x21, 0x01, 0xae, 0xe8, 0x07,
+    0xec, 0xd3, 0x9c, 0xda, 0x0e, 0x00, 0xbd, 0xd8, 0x5c, 0xd8, 0x62, 0xda, 0x5a, 0xda, 0xed, 0x48,
+    0x96, 0x7b, 0x7f, 0xda, 0xe5, 0x21, 0x01, 0xae, 0xe8, 0x07, 0x29, 0x00, 0x24, 0x00, 0x6c, 0xc9,
+    0x67, 0xc2, 0x1b, 0x00, 0x0e, 0x00, 0xb9, 0xd9, 0xf3, 0x48, 0x04, 0x00, 0xd2, 0x8e, 0x6e, 0xe4,
+    0x48, 0xc3, 0xc5, 0xd9, 0xd8, 0x6f, 0x64, 0x61, 0x67, 0x6f, 0xe4, 0x28, 0xc1, 0x0d, 0x65, 0xee,
+    0x28, 0xdf, 0xa9, 0xe4, 0x20, 0x01, 0xe3, 0x28, 0xbe, 0xd9, 0xe4, 0x48, 0x04, 0x00, 0xdd, 0x5d,
+    0xe5, 0x21, 0x01, 0x2e, 0x74, 0x69, 0x72, 0x2e, 0x73, 0x65, 0x67, 0x61, 0x70, 0xad, 0x28, 0x80,
+    0xc5, 0xe3, 0x49, 0x04, 0x00, 0xf4, 0xd8, 0xae, 0xc8, 0x57, 0xd8, 0x33, 0xda, 0x23, 0xda, 0xf3,
+    0xd7, 0xf9, 0xd9, 0xf1, 0xd9, 0xe1, 0x49, 0x04, 0x00, 0x2b, 0xcc, 0xae, 0xe8, 0x0e, 0x8e, 0x00,
+    0x8a, 0x00, 0x80, 0x00, 0x8e, 0x59, 0x1e, 0xda, 0x66, 0x00, 0x62, 0x00, 0x3f, 0xd8, 0x5e, 0x00,
+    0x56, 0x00, 0x2b, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x74, 0x3b, 0xf7, 0x28, 0x52, 0xd9, 0x76, 0x6f,
+    0xe7, 0x21, 0x01, 0xae, 0x80, 0x67, 0x63, 0x21, 0x37, 0x75, 0x64, 0xe5, 0x21, 0x01, 0xae, 0xc0,
+    0x5c, 0x19, 0x16, 0x2c, 0x10, 0x06, 0x77, 0x73, 0xee, 0x21, 0x01, 0x2e, 0xf3, 0x28, 0x46, 0xd7,
+    0xf4, 0x48, 0xa8, 0xd7, 0xc3, 0xd9, 0xe4, 0x20, 0x3c, 0x63, 0xe9, 0x48, 0x04, 0x00, 0x14, 0xd8,
+    0xec, 0x28, 0xda, 0xce, 0xf4, 0x68, 0x94, 0xd7, 0xac, 0xd9, 0xaf, 0xd9, 0xf3, 0x28, 0x56, 0xc5,
+    0xee, 0x28, 0x97, 0xd8, 0x6d, 0x6f, 0xe3, 0x21, 0x01, 0xae, 0x68, 0x85, 0xc8, 0x06, 0x00, 0xde,
+    0xd2, 0x73, 0x74, 0x65, 0x6c, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0xae, 0x28, 0xd4, 0xbf, 0xe4, 0x48,
+    0x57, 0xd8, 0x04, 0x00, 0xec, 0x28, 0x27, 0xd9, 0xe3, 0x28, 0x9f, 0xd5, 0xe1, 0x48, 0x10, 0xd9,
+    0xe2, 0xd6, 0xb2, 0x40, 0x06, 0x02, 0xf9, 0x28, 0xff, 0x2e, 0x35, 0x74, 0xe5, 0x28, 0x7b, 0xda,
+    0xf4, 0xe8, 0x18, 0xa7, 0x12, 0xf9, 0x11, 0xed, 0x11, 0xd5, 0x11, 0xcf, 0x11, 0xb4, 0x0b, 0xa9,
+    0x0b, 0x91, 0x0b, 0x4f, 0x0b, 0x2b, 0x02, 0x25, 0x02, 0xfb, 0x79, 0x1f, 0x02, 0x12, 0x02, 0xc3,
+    0x01, 0x8c, 0x01, 0x66, 0x01, 0x46, 0x01, 0x87, 0x00, 0x41, 0x00, 0x3c, 0x00, 0xe9, 0x11, 0x35,
+    0x00, 0x30, 0x00, 0x7a, 0xf4, 0x28, 0xca, 0xd0, 0xf9, 0x21, 0x01, 0xae, 0x28, 0x3f, 0xd9, 0x75,
+    0xef, 0x28, 0x6e, 0x58, 0xf4, 0x89, 0x17, 0x00, 0x13, 0x00, 0x1f, 0xd9, 0x08, 0x00, 0xef, 0x49,
+    0x71, 0xc2, 0x04, 0x00, 0x69, 0xf2, 0x28, 0x24, 0xb8, 0xe1, 0x28, 0x32, 0xaf, 0xae, 0xe8, 0x0c,
+    0x9b, 0xd6, 0x1c, 0xd9, 0x94, 0xd6, 0x25, 0xc7, 0xeb, 0x9c, 0x1c, 0x00, 0x46, 0x9d, 0x18, 0x00,
+    0x2d, 0xd7, 0xe2, 0xd8, 0xda, 0xd8, 0xff, 0xd0, 0xf3, 0x28, 0xfe, 0x38, 0xef, 0x68, 0xf4, 0xd8,
+    0x22, 0xd7, 0x06, 0x00, 0xf2, 0x48, 0x0c, 0xd6, 0x80, 0xd8, 0xf3, 0xc9, 0x7f, 0x00, 0x75, 0x00,
+    0x6d, 0x00, 0x63, 0x00, 0x0c, 0x00, 0x39, 0x88, 0xef, 0x40, 0x06, 0x02, 0xf0, 0x29, 0xa3, 0xa5,
+    0xe8, 0x21, 0x01, 0xae, 0xe8, 0x07, 0x3f, 0x00, 0x33, 0x00, 0x2f, 0x00, 0x22, 0x00, 0x14, 0x00,
+    0x10, 0xc7, 0x0e, 0x00, 0x76, 0x65, 0xe4, 0x28, 0x7c, 0x95, 0xf3, 0x48, 0x66, 0xbc, 0x04, 0x00,
+    0x73, 0x65, 0x63, 0x63, 0xe1, 0x28, 0x21, 0xd7, 0xec, 0x40, 0x07, 0x02, 0x72, 0xf5, 0x28, 0xe4,
+    0x90, 0xe5, 0x28, 0xc0, 0x20, 0xe6, 0x28, 0x61, 0x87, 0xe5, 0x48, 0x22, 0xd0, 0x04, 0x00, 0x74,
+    0x69, 0xf3, 0x28, 0x99, 0xb4, 0x64, 0x75, 0x6f, 0x6c, 0xe3, 0x48, 0x1b, 0xd8, 0xc8, 0x13, 0xe9,
+    0x49, 0xd4, 0x8a, 0x04, 0x00, 0xf4, 0x28, 0x6c, 0xa6, 0xe5, 0x68, 0x65, 0xd8, 0x6f, 0xd8, 0xbe,
+    0xcd, 0xe1, 0x48, 0x04, 0x00, 0x09, 0xd7, 0xe3, 0x28, 0x63, 0xd8, 0xae, 0xe8, 0x08, 0x32, 0x00,
+    0x1d, 0x00, 0x6e, 0xd8, 0x66, 0xd8, 0x5e, 0xd8, 0x10, 0x00, 0x2e, 0xd6, 0x34, 0xd8, 0xef, 0x68,
+    0x52, 0xd8, 0x06, 0x00, 0xcb, 0xbf, 0x64, 0xe1, 0x28, 0x3f, 0xb7, 0xe5, 0x68, 0x0d, 0x00, 0x06,
+    0x00, 0x45, 0xd0, 0x70, 0x69, 0x63, 0xee, 0x28, 0x74, 0xc8, 0x6d, 0x6f, 0xf4, 0x28, 0xe6, 0x1e,
+    0x61, 0x64, 0x61, 0x78, 0x69, 0xe1, 0x28, 0xbc, 0x7a, 0xf2, 0x68, 0x15, 0x00, 0x58, 0x1a, 0x06,
+    0x00, 0x6f, 0xf0, 0x68, 0x0d, 0xd6, 0x06, 0x00, 0xaa, 0xd7, 0x70, 0x75, 0xf3, 0x29, 0x84, 0xcf,
+    0xe1, 0x21, 0x01, 0xed, 0x48, 0xda, 0xa1, 0x99, 0xd7, 0xf0, 0x21, 0x01, 0xae, 0xe8, 0x08, 0x14,
+    0x00, 0x10, 0x00, 0x0d, 0xd8, 0xda, 0xa6, 0xfd, 0xd7, 0xb0, 0x74, 0xd3, 0xd7, 0xcb, 0xd7, 0xe5,
+    0x28, 0xa0, 0xcc, 0x62, 0x65, 0x77, 0x61, 0x6e, 0x69, 0x67, 0x61, 0xf0, 0x28, 0xff, 0xc6, 0xef,
+    0xe8, 0x08, 0xce, 0xd7, 0x21, 0x00, 0x48, 0xd5, 0xae, 0xd7, 0xd6, 0xd6, 0x72, 0xd1, 0x1b, 0x00,
+    0x10, 0x00, 0xf0, 0x48, 0x04, 0x00, 0x5a, 0xd7, 0x65, 0xe4, 0x28, 0x59, 0xbe, 0x6f, 0x66, 0xe5,
+    0x28, 0x08, 0xd7, 0x63, 0xf3, 0x21, 0x01, 0xae, 0x48, 0x89, 0xd7, 0x04, 0x00, 0x76, 0x6f, 0xe7,
+    0x21, 0x01, 0xae, 0x28, 0x47, 0xbe, 0xee, 0xa8, 0x3b, 0x00, 0x1d, 0x00, 0x0f, 0x00, 0x0a, 0x00,
+    0x91, 0x9c, 0x6f, 0xf0, 0x28, 0xe3, 0xb2, 0xe9, 0x69, 0x84, 0xc7, 0xa1, 0xd7, 0x06, 0x00, 0x6f,
+    0x70, 0xe4, 0x28, 0x2f, 0x12, 0xe5, 0x68, 0x59, 0xd7, 0x06, 0x00, 0x83, 0xd7, 0xed, 0x48, 0x04,
+    0x00, 0x1c, 0x55, 0x65, 0x67, 0x61, 0x6e, 0x61, 0xed, 0x21, 0x01, 0x2e, 0x72, 0x65, 0x74, 0xf5,
+    0x28, 0xf4, 0xd1, 0xe1, 0x68, 0x06, 0x00, 0x71, 0xaa, 0x6c, 0x13, 0x6d, 0x6f, 0x72, 0x6f, 0x63,
+    0x6b, 0xe9, 0x28, 0xa1, 0xa8, 0xed, 0x21, 0x01, 0xae, 0x88, 0x62, 0xd7, 0xbd, 0xc1, 0x22, 0xd5,
+    0x28, 0xd7, 0xec, 0x49, 0xed, 0x17, 0x51, 0x09, 0x6a, 0x65, 0xb3, 0x28, 0xaa, 0xd7, 0xe9, 0xc9,
+    0x10, 0x00, 0xc8, 0xc9, 0x31, 0xd5, 0xdc, 0xd5, 0x4a, 0xd7, 0x0c, 0x00, 0xf5, 0x28, 0xbb, 0xc2,
+    0xae, 0xe8, 0x15, 0xad, 0x05, 0xd1, 0x04, 0xc0, 0x04, 0xb1, 0x04, 0xd5, 0x03, 0xbc, 0x03, 0x7c,
+    0xd2, 0x22, 0x03, 0xb1, 0x02, 0x90, 0x02, 0x5f, 0x02, 0x0e, 0x01, 0x04, 0x01, 0xef, 0xbf, 0xdf,
+    0x00, 0x95, 0x00, 0x75, 0x00, 0x6b, 0x00, 0x5d, 0x00, 0x34, 0x00, 0x2a, 0x00, 0xfa, 0x88, 0xa5,
+    0xd5, 0xf1, 0xd6, 0x03, 0xd7, 0x97, 0xd6, 0xf9, 0x88, 0x77, 0x08, 0x16, 0x00, 0x11, 0x00, 0x08,
+    0x00, 0x6e, 0x61, 0xe3, 0x20, 0x01, 0xf3, 0x28, 0xba, 0xb3, 0x6c, 0xe9, 0x28, 0x4f, 0x08, 0x65,
+    0x6c, 0x6c, 0x61, 0xf6, 0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0x61, 0x74, 0xf3, 0x28, 0xaf, 0x2d,
+    0xf6, 0xc8, 0xeb, 0xd6, 0x9b, 0xd6, 0x64, 0xd6, 0x5c, 0xd6, 0xe9, 0xd6, 0x1e, 0xd5, 0xf5, 0x88,
+    0x95, 0xd6, 0xa7, 0xd5, 0xb5, 0xd6, 0x56, 0xd6, 0xf4, 0xe8, 0x09, 0xd2, 0xd6, 0xa5, 0xd6, 0xb7,
+    0xd6, 0x9c, 0xd5, 0xbf, 0xd6, 0x16, 0x00, 0x12, 0x00, 0x4b, 0xd6, 0x05, 0xd5, 0xef, 0x29, 0x82,
+    0xd6, 0x6e, 0x6f, 0x6d, 0xe4, 0x28, 0x8b, 0x03, 0xf3, 0xe8, 0x0a, 0x2d, 0x00, 0x85, 0xd6, 0x97,
+    0xd6, 0x28, 0x00, 0x5c, 0xd5, 0x9f, 0xd6, 0x14, 0x00, 0x23, 0xd6, 0xb0, 0xd6, 0xe5, 0xd4, 0xef,
+    0x48, 0x9a, 0xd6, 0x04, 0x00, 0xf8, 0x48, 0xbe, 0x63, 0x04, 0x00, 0x6f, 0x62, 0x64, 0x61, 0xe9,
+    0x28, 0x48, 0x7f, 0x65, 0xec, 0x28, 0xee, 0x02, 0xe1, 0x48, 0x56, 0xd6, 0x04, 0x00, 0x69, 0x73,
+    0x65, 0x6c, 0x67, 0xe9, 0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0x61, 0x69, 0x6e, 0x6f, 0xe2, 0x28,
+    0xb2, 0x8d, 0xf2, 0xe8, 0x0c, 0x1c, 0x00, 0x18, 0x00, 0x4d, 0xd6, 0xe7, 0xd4, 0x1b, 0xd6, 0xe0,
+    0xd1, 0x82, 0xa8, 0x5d, 0xd6, 0xe1, 0xd5, 0xd9, 0xd5, 0x66, 0xd6, 0x9b, 0xd4, 0xe2, 0x29, 0x4e,
+    0xd6, 0xe1, 0x49, 0x37, 0xd6, 0xbb, 0xd5, 0xf0, 0x88, 0x44, 0xd6, 0x8c, 0xd5, 0xb5, 0xd5, 0x42,
+    0xd6, 0xef, 0xe8, 0x0e, 0x4a, 0x01, 0x41, 0x01, 0x3d, 0x01, 0x38, 0x01, 0x31, 0x01, 0x02, 0x01,
+    0x03, 0xd5, 0xed, 0x00, 0x87, 0x00, 0xb2, 0xd5, 0x65, 0x00, 0x55, 0x00, 0x28, 0x00, 0x1c, 0x00,
+    0x7a, 0xfa, 0x48, 0x87, 0x5d, 0x04, 0x00, 0x75, 0xf2, 0x28, 0xeb, 0xd2, 0xf4, 0x69, 0x1b, 0xd5,
+    0x20, 0x00, 0x06, 0x00, 0xee, 0x48, 0xcb, 0x3a, 0x04, 0x00, 0xe5, 0x68, 0x0e, 0x00, 0xe5, 0xc5,
+    0x06, 0x00, 0x76, 0xe5, 0x20, 0x01, 0xee, 0x28, 0xb9, 0x9e, 0xe7, 0x28, 0x2a, 0x84, 0xe5, 0x48,
+    0x89, 0x69, 0x04, 0x00, 0x73, 0xf3, 0x28, 0xed, 0xce, 0xf3, 0x41, 0x09, 0x02, 0x73, 0x61, 0x62,
+    0xef, 0x28, 0xb3, 0xa4, 0x69, 0xf6, 0x28, 0x20, 0x03, 0xf2, 0x41, 0x06, 0x02, 0xef, 0x28, 0x08,
+    0xd5, 0xe1, 0x40, 0x08, 0x02, 0x7a, 0x6e, 0xe1, 0x28, 0xc7, 0xca, 0x73, 0x65, 0xf0, 0x40, 0x02,
+    0x05, 0xad, 0x20, 0x01, 0x6f, 0x6e, 0x69, 0xe2, 0x28, 0x60, 0xd2, 0xee, 0xa1, 0x45, 0x34, 0x15,
+    0x09, 0x05, 0xf5, 0x28, 0x5c, 0x83, 0xf2, 0x40, 0x06, 0x02, 0xef, 0x28, 0xe2, 0x82, 0xe5, 0x28,
+    0x79, 0x82, 0xe9, 0x88, 0x0e, 0x00, 0x08, 0x00, 0xe3, 0x7c, 0xdf, 0x02, 0x6c, 0x6c, 0xe5, 0x28,
+    0x7f, 0xd4, 0x62, 0x72, 0xf5, 0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0x6f, 0x72, 0xe1, 0x28, 0x37,
+    0x05, 0x65, 0x63, 0x69, 0xf0, 0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0x69, 0x6c, 0x6f, 0xe3, 0x28,
+    0x39, 0xd4, 0xe1, 0x88, 0x0d, 0x00, 0x50, 0xd5, 0x08, 0x00, 0x90, 0x02, 0x74, 0xf3, 0x28, 0xaf,
+    0x12, 0x64, 0x69, 0x70, 0x6d, 0x61, 0xe3, 0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0xef, 0x28, 0x8c,
+    0x7b, 0xed, 0x69, 0x0d, 0x00, 0x2c, 0xd5, 0x06, 0x00, 0x72, 0xe5, 0x48, 0xc0, 0xd3, 0xc8, 0x7c,
+    0xe1, 0x48, 0xcf, 0x78, 0xf3, 0xcf, 0xe9, 0x80, 0x1d, 0x0d, 0x08, 0x04, 0xfa, 0x28, 0xb6, 0xd3,
+    0x72, 0xe4, 0x28, 0xb5, 0x61, 0x70, 0x6d, 0x65, 0xf4, 0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0x61,
+    0x69, 0xe2, 0x28, 0xb9, 0x9d, 0x64, 0x65, 0xed, 0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0x6f, 0x6e,
+    0x61, 0xe4, 0x28, 0x03, 0x1b, 0xe7, 0x21, 0x01, 0xe9, 0x28, 0x68, 0xcf, 0x65, 0xee, 0x28, 0xde,
+    0xd2, 0xe3, 0x29, 0x7b, 0xc9, 0xe2, 0x21, 0x01, 0x72, 0x65, 0xf4, 0x28, 0xed, 0xd0, 0xe1, 0x29,
+    0x20, 0xd3, 0xee, 0xe8, 0x09, 0x28, 0x00, 0xbb, 0xd4, 0xcd, 0xd4, 0x1a, 0x00, 0x16, 0x00, 0x12,
+    0x00, 0x61, 0xd4, 0xc5, 0xd4, 0xe6, 0xd4, 0xed, 0x29, 0x4d, 0xd4, 0xe9, 0x28, 0x57, 0xa0, 0xe5,
+    0x69, 0x06, 0x00, 0xff, 0xd2, 0x72, 0x00, 0x65, 0x6e, 0xae, 0x28, 0x00, 0x8f, 0xe1, 0x49, 0xa5,
+    0xd4, 0x6b, 0x00, 0xed, 0xa8, 0x34, 0xd2, 0x37, 0xd3, 0x0a, 0x00, 0xe2, 0xc0, 0x95, 0xd4, 0xe9,
+    0x21, 0x01, 0x74, 0x2e, 0x6e, 0x65, 0x70, 0x6f, 0x2e, 0x63, 0x69, 0x74, 0x73, 0x61, 0x6c, 0x65,
+    0xea, 0x28, 0x5a, 0xc3, 0xec, 0x88, 0x6b, 0x00, 0x6a, 0xd4, 0x7c, 0xd4, 0x08, 0x00, 0xef, 0x48,
+    0x7a, 0xd4, 0x04, 0x00, 0x72, 0x69, 0xf4, 0x60, 0x39, 0x03, 0x3d, 0xe4, 0x40, 0x0b, 0x02, 0x75,
+    0xf3, 0x68, 0x10, 0x00, 0xbb, 0x01, 0xb8, 0x01, 0x65, 0x75, 0xf3, 0x69, 0x06, 0x00, 0xb1, 0x01,
+    0xae, 0x01, 0xad, 0x48, 0x04, 0x00, 0xa6, 0x01, 0xee, 0x68, 0x0d, 0x00, 0x06, 0x00, 0xa6, 0x01,
+    0xe5, 0x20, 0x01, 0xfa, 0x28, 0x11, 0xd3, 0xe1, 0x20, 0x01, 0x73, 0xec, 0x48, 0x7f, 0xd3, 0x25,
+    0xc7, 0xad, 0x40, 0x08, 0x02, 0xf3, 0x48, 0x80, 0x01, 0x83, 0x01, 0xe4, 0x40, 0x02, 0x05, 0xe5,
+    0x20, 0x01, 0x75, 0xf3, 0x68, 0x06, 0x00, 0x78, 0x01, 0x75, 0x01, 0xad, 0x48, 0x70, 0x01, 0x6d,
+    0x01, 0xe1, 0x29, 0x0f, 0xd4, 0xe9, 0xe8, 0x0c, 0xf8, 0xd3, 0x0a, 0xd4, 0x78, 0x59, 0xa4, 0xd2,
+    0x74, 0x00, 0x12, 0xd4, 0x43, 0x00, 0x9e, 0xd3, 0x2e, 0x00, 0x25, 0x00, 0x18, 0x00, 0x58, 0xd2,
+    0xf4, 0x48, 0x04, 0x00, 0xd7, 0xd2, 0x65, 0xe9, 0x48, 0x36, 0xcf, 0xe1, 0xd3, 0xf3, 0x21, 0x01,
+    0x69, 0x64, 0xee, 0x28, 0x51, 0xba, 0xf2, 0x21, 0x01, 0xe1, 0x68, 0xc5, 0xd3, 0x0a, 0x00, 0x06,
+    0x00, 0xf3, 0x28, 0xf8, 0x7d, 0x69, 0x6c, 0xe7, 0x28, 0x60, 0xd1, 0xee, 0x68, 0x0b, 0x00, 0x06,
+    0x00, 0x98, 0xce, 0x69, 0xed, 0x28, 0x28, 0xcf, 0xe1, 0x40, 0x1e, 0x02, 0x72, 0xf4, 0x40, 0x0d,
+    0x02, 0x61, 0x74, 0x74, 0x65, 0x6c, 0x72, 0x61, 0xe2, 0x28, 0xe1, 0x02, 0x2d, 0x61, 0x74, 0x74,
+    0x65, 0x6c, 0x72, 0x61, 0xe2, 0x28, 0xd2, 0x02, 0xf0, 0x28, 0x94, 0xc3, 0xec, 0x61, 0x1a, 0x13,
+    0x03, 0x72, 0x6f, 0xe6, 0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0x61, 0x6e, 0x65, 0xf3, 0x28, 0x3d,
+    0xaf, 0xef, 0x20, 0x01, 0xf0, 0x28, 0x0b, 0xd1, 0xec, 0x20, 0x01, 0xe5, 0x28, 0x9d, 0x1b, 0xe7,
+    0xe8, 0x09, 0x8b, 0xd3, 0x5e, 0xd3, 0x0a, 0xd2, 0x01, 0xc7, 0x80, 0xd3, 0x04, 0xd3, 0x68, 0xd3,
+    0xb2, 0xcf, 0x12, 0x00, 0xf6, 0x28, 0xf6, 0xd1, 0xe5, 0xe8, 0x0d, 0xc8, 0x00, 0xf1, 0xd1, 0x7e,
+    0x00, 0x79, 0x00, 0x3c, 0xd2, 0x75, 0x00, 0x56, 0x00, 0xeb, 0xd2, 0x4f, 0xd3, 0x4a, 0x00, 0x1f,
+    0x00, 0xa5, 0xd1, 0x1a, 0x00, 0x7a, 0xee, 0x28, 0x50, 0xbe, 0xf4, 0x41, 0x20, 0x02, 0xf3, 0x40,
+    0x17, 0x02, 0x6f, 0xe1, 0x61, 0x06, 0x03, 0x0e, 0xe4, 0x20, 0x09, 0xad, 0x40, 0x02, 0x06, 0x64,
+    0xad, 0x20, 0x01, 0xe5, 0x28, 0x7d, 0x02, 0x65, 0xe9, 0x28, 0x17, 0xc3, 0x6e, 0x6f, 0xed, 0x20,
+    0x01, 0xe5, 0x28, 0xfe, 0xcb, 0xf3, 0x40, 0x06, 0x02, 0xe9, 0x28, 0x16, 0x5e, 0xe5, 0x28, 0x2e,
+    0x57, 0xee, 0x40, 0x19, 0x02, 0xef, 0x40, 0x07, 0x02, 0x74, 0xef, 0x28, 0xd7, 0xce, 0xee, 0x40,
+    0x07, 0x02, 0x69, 0xf3, 0x28, 0x82, 0xb0, 0x65, 0xe4, 0x28, 0x0f, 0x83, 0xe9, 0x28, 0x02, 0x35,
+    0xed, 0x29, 0x63, 0xcd, 0x68, 0xe3, 0x28, 0xe4, 0xb1, 0xe7, 0x41, 0x40, 0x02, 0x69, 0x64, 0xe1,
+    0x60, 0x17, 0x22, 0x03, 0x6f, 0x74, 0x6c, 0xe1, 0x41, 0x02, 0x21, 0x2d, 0x6f, 0xee, 0x40, 0x02,
+    0x21, 0xe1, 0x20, 0x01, 0xfa, 0x28, 0x19, 0xb0, 0xad, 0x40, 0x09, 0x02, 0x6f, 0x74, 0x6c, 0xe1,
+    0x41, 0x06, 0x09, 0xe1, 0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0xef, 0x20, 0x01, 0xee, 0x20, 0x01,
+    0xe9, 0x20, 0x01, 0x74, 0xee, 0x20, 0x01, 0xe5, 0x28, 0x98, 0xc2, 0x61, 0x70, 0x65, 0x6d, 0xef,
+    0x28, 0xb2, 0xa4, 0xe3, 0x69, 0x29, 0xc7, 0x0b, 0x00, 0x06, 0x00, 0x6e, 0xe5, 0x28, 0xd7, 0x84,
+    0xe9, 0x28, 0x37, 0x66, 0xe4, 0x48, 0x10, 0xd2, 0x04, 0x00, 0xf5, 0x21, 0x01, 0x6f, 0x6c, 0xe3,
+    0x28, 0xfc, 0xbe, 0xe3, 0xe8, 0x07, 0x06, 0xd1, 0x99, 0xcf, 0x51, 0xd1, 0x74, 0xd2, 0x00, 0xd2,
+    0x64, 0xd2, 0xba, 0xd0, 0xe2, 0xe0, 0x0a, 0xc8, 0xad, 0x9a, 0x80, 0x74, 0x70, 0x5f, 0x42, 0x21,
+    0x0a, 0xfa, 0x40, 0x0b, 0x02, 0x73, 0x2d, 0x6c, 0x6f, 0x72, 0x69, 0xf4, 0x20, 0xa2, 0x72, 0x2d,
+    0x6c, 0x6f, 0x72, 0x69, 0x74, 0xad, 0x20, 0x0e, 0xf6, 0x41, 0x13, 0x02, 0x37, 0x2d, 0x6c, 0x6f,
+    0x72, 0x69, 0xf4, 0x20, 0x01, 0x64, 0xf3, 0x40, 0x02, 0x8c, 0xad, 0x20, 0x8b, 0x36, 0x2d, 0x6c,
+    0x6f, 0x72, 0x69, 0x74, 0x2d, 0x64, 0xf3, 0x20, 0x7f, 0x73, 0x6e, 0x2d, 0x6c, 0x6f, 0x72, 0x69,
+    0x74, 0x64, 0xf3, 0x40, 0x02, 0x73, 0x2d, 0x6e, 0x61, 0x73, 0xec, 0x40, 0x06, 0x02, 0xf5, 0x28,
+    0x07, 0xc9, 0xe1, 0x28, 0x03, 0xc9, 0x6f, 0x32, 0x2d, 0x6c, 0x6f, 0x72, 0x69, 0x74, 0x64, 0x73,
+    0x2d, 0x6e, 0x65, 0xfa, 0x28, 0x5f, 0x65, 0xed, 0x29, 0x49, 0xcf, 0x68, 0x65, 0x2d, 0x65, 0x74,
+    0x73, 0x6f, 0x61, 0x2d, 0xe4, 0x20, 0x2a, 0xe3, 0x41, 0x0c, 0x02, 0x6d, 0x2d, 0x6c, 0x72, 0x6f,
+    0x66, 0xad, 0x28, 0x7b, 0x03, 0x66, 0x2d, 0x61, 0x6e, 0x65, 0x73, 0x65, 0x63, 0xad, 0x28, 0x81,
+    0x03, 0x62, 0x65, 0x2d, 0x65, 0x74, 0x73, 0x6f, 0xe1, 0x40, 0x06, 0x02, 0xe4, 0x28, 0x82, 0x03,
+    0xad, 0x28, 0x7e, 0x03, 0x33, 0x63, 0x2d, 0x6c, 0x6f, 0x72, 0x69, 0x74, 0xad, 0x20, 0x01, 0x64,
+    0x73, 0xad, 0x20, 0x01, 0xef, 0x20, 0x01, 0x6e, 0x69, 0x74, 0x6e, 0xe5, 0x28, 0x04, 0x67, 0xad,
+    0x60, 0x0b, 0x07, 0x03, 0xb6, 0x28, 0xac, 0xc0, 0xb4, 0x28, 0x25, 0xb2, 0xb2, 0x28, 0x25, 0xb2,
+    0xe1, 0xe8, 0x13, 0x53, 0x03, 0x43, 0x03, 0x1f, 0x03, 0x21, 0xbd, 0x6d, 0xd1, 0x1b, 0x03, 0x17,
+    0x03, 0xce, 0x01, 0xbf, 0x01, 0xb9, 0x01, 0x5b, 0x01, 0x57, 0x01, 0x13, 0xd1, 0x1a, 0x01, 0xf7,
+    0x00, 0x7e, 0x00, 0x7a, 0x00, 0x6b, 0x00, 0x26, 0x00, 0x7a, 0xee, 0x68, 0x18, 0x00, 0x06, 0x00,
+    0x41, 0xd0, 0xe5, 0x68, 0x06, 0x00, 0x01, 0x80, 0x33, 0xad, 0xe3, 0x48, 0x04, 0x00, 0x5d, 0xcd,
+    0xe1, 0x28, 0x2f, 0xca, 0x61, 0x69, 0x72, 0xe2, 0x60, 0x10, 0x03, 0x0d, 0xe1, 0x40, 0x02, 0x1c,
+    0x6c, 0x6c, 0x65, 0xe4, 0x20, 0x01, 0xe5, 0x20, 0x0f, 0x2d, 0xe1, 0x40, 0x02, 0x0e, 0x6c, 0x6c,
+    0x65, 0x64, 0x2d, 0x65, 0xad, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xfa, 0x28, 0xf9, 0xa7, 0xf6, 0x21,
+    0x01, 0xef, 0x68, 0x12, 0x79, 0x94, 0xb0, 0x06, 0x00, 0xf4, 0x28, 0x2b, 0x7a, 0xf5, 0x28, 0x06,
+    0x79, 0xf4, 0x81, 0x69, 0x64, 0x46, 0x04, 0x74, 0xe5, 0x40, 0x0b, 0x02, 0x73, 0x73, 0x69, 0x6e,
+    0x61, 0xf4, 0x28, 0xc2, 0x82, 0x6c, 0x72, 0x61, 0xe2, 0x60, 0x13, 0x0a, 0x03, 0x69, 0x6e, 0x61,
+    0x72, 0xf4, 0x20, 0x18, 0x61, 0x69, 0x72, 0x64, 0x6e, 0xe1, 0x28, 0xbb, 0x01, 0xad, 0x40, 0x11,
+    0x02, 0x69, 0x6e, 0x61, 0x72, 0xf4, 0x20, 0x01, 0xad, 0x20, 0x01, 0x61, 0xe9, 0x28, 0xcf, 0xc3,
+    0x61, 0x69, 0x72, 0x64, 0x6e, 0xe1, 0x28, 0x9c, 0x01, 0x73, 0x6f, 0xe1, 0x61, 0x03, 0x07, 0x15,
+    0xad, 0x40, 0x02, 0x10, 0xe4, 0x68, 0x06, 0x00, 0x0c, 0x00, 0x6b, 0x5d, 0xad, 0x48, 0x04, 0x00,
+    0x63, 0x5d, 0x65, 0xec, 0x28, 0x5c, 0x5d, 0x72, 0xe5, 0x28, 0xff, 0x82, 0xe1, 0x40, 0x06, 0x02,
+    0xf2, 0x28, 0x07, 0x15, 0x63, 0x69, 0xec, 0x28, 0x21, 0x68, 0xf3, 0x69, 0x75, 0xc9, 0x12, 0x00,
+    0x06, 0x00, 0xf5, 0x48, 0x04, 0x00, 0x07, 0x8a, 0x63, 0x61, 0xf2, 0x28, 0xa3, 0xcd, 0x73, 0x61,
+    0xed, 0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0x61, 0x72, 0xe1, 0x28, 0x82, 0x77, 0xf2, 0x61, 0x18,
+    0x14, 0x03, 0x74, 0x73, 0x61, 0x69, 0x6c, 0x67, 0xef, 0x41, 0x02, 0x05, 0xad, 0x20, 0x01, 0xec,
+    0x28, 0x4d, 0xcc, 0xe5, 0x28, 0xc7, 0x9d, 0xe1, 0x68, 0x1a, 0x00, 0x06, 0x00, 0x65, 0xb4, 0x72,
+    0xf2, 0x48, 0x04, 0x00, 0x2a, 0xae, 0x61, 0xe3, 0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0x61, 0xf3,
+    0x28, 0x26, 0xa4, 0xe3, 0x20, 0x01, 0xf3, 0x28, 0xbb, 0xcf, 0xef, 0x28, 0xab, 0xaf, 0xee, 0xc1,
+    0x57, 0x41, 0x23, 0x1d, 0x18, 0x06, 0xef, 0x88, 0x0c, 0x00, 0x08, 0x00, 0xc6, 0xae, 0xf2, 0x88,
+    0xed, 0x28, 0x99, 0xc2, 0xe3, 0x28, 0x1d, 0xc3, 0x6e, 0xe5, 0x29, 0xd2, 0xc1, 0xe9, 0x48, 0x36,
+    0x88, 0xb2, 0xbe, 0xe7, 0x60, 0x0b, 0x07, 0x03, 0xef, 0x28, 0x55, 0xad, 0xe5, 0x28, 0x11, 0x01,
+    0x61, 0x6d, 0x6f, 0xf2, 0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0x61, 0x69, 0x6c, 0xe9, 0x28, 0x18,
+    0xa2, 0xe5, 0x68, 0xfa, 0x77, 0x0c, 0xcd, 0x06, 0x00, 0x73, 0x65, 0xe3, 0x40, 0x02, 0x05, 0xad,
+    0x20, 0x01, 0x69, 0xec, 0x28, 0x29, 0xc3, 0x61, 0xe3, 0x28, 0x76, 0xcf, 0xed, 0x48, 0x47, 0xca,
+    0xdf, 0xb4, 0xec, 0x40, 0x06, 0x02, 0xec, 0x28, 0xec, 0x9a, 0x69, 0x75, 0x71, 0xe1, 0x29, 0x98,
+    0xce, 0xe9, 0xe8, 0x0b, 0x38, 0x01, 0x33, 0x01, 0x2c, 0x01, 0x20, 0x01, 0xdd, 0x00, 0xa9, 0x00,
+    0xa3, 0x00, 0x44, 0x00, 0x33, 0x00, 0x2f, 0x00, 0x16, 0x00, 0xfa, 0x40, 0x06, 0x02, 0xe9, 0x28,
+    0x15, 0x9a, 0xe5, 0x48, 0x45, 0x63, 0x04, 0x00, 0x70, 0xf3, 0x48, 0x04, 0x00, 0x29, 0xce, 0xad,
+    0x28, 0x23, 0xce, 0xf6, 0x28, 0x87, 0xc4, 0x74, 0x6e, 0x65, 0x6c, 0x61, 0xf6, 0x40, 0x02, 0x05,
+    0xad, 0x20, 0x01, 0x6f, 0xe2, 0x28, 0x83, 0xcb, 0xf2, 0x88, 0x50, 0x00, 0x0c, 0x00, 0x25, 0x8c,
+    0x08, 0x00, 0xf5, 0x28, 0x5f, 0xae, 0x64, 0x6e, 0xe1, 0x80, 0x1b, 0x11, 0x0a, 0x04, 0x73, 0x73,
+    0xe5, 0x28, 0x0b, 0xcf, 0x69, 0x6e, 0x61, 0x72, 0xf4, 0x20, 0x17, 0x61, 0x74, 0x74, 0x65, 0x6c,
+    0x72, 0x61, 0xe2, 0x20, 0x22, 0xad, 0x40, 0x12, 0x02, 0x69, 0x6e, 0x61, 0x72, 0x74, 0xad, 0x20,
+    0x01, 0x61, 0x74, 0x74, 0x65, 0xec, 0x28, 0x72, 0xce, 0x61, 0x74, 0x74, 0x65, 0x6c, 0x72, 0x61,
+    0xe2, 0x20, 0x01, 0xad, 0x20, 0x01, 0xe9, 0x28, 0x0e, 0xb9, 0xe2, 0x48, 0x04, 0x00, 0xc8, 0x96,
+    0x61, 0x6c, 0x61, 0xe3, 0x41, 0x6e, 0x71, 0x6f, 0x74, 0xf3, 0x28, 0xf6, 0xc7, 0xee, 0x88, 0x24,
+    0x00, 0x1d, 0x00, 0x08, 0x00, 0x53, 0xbc, 0x6f, 0x62, 0x72, 0x61, 0xe3, 0x40, 0x02, 0x05, 0xad,
+    0x20, 0x01, 0x73, 0x61, 0x69, 0x73, 0x65, 0x6c, 0xe7, 0x28, 0xad, 0xcd, 0xe9, 0x20, 0x01, 0xe4,
+    0x28, 0x2a, 0x58, 0xe1, 0x88, 0x08, 0x00, 0x7b, 0x7d, 0xd0, 0x9d, 0xfb, 0xc3, 0xe2, 0x28, 0x7f,
+    0xad, 0xec, 0x60, 0x3d, 0x27, 0x03, 0x75, 0x69, 0xe7, 0x80, 0x04, 0x09, 0x10, 0x13, 0xad, 0x60,
+    0x03, 0x0a, 0x0d, 0x61, 0x69, 0x7a, 0x65, 0xee, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xf6, 0x40, 0x02,
+    0x05, 0xad, 0x20, 0x01, 0x69, 0x6c, 0xf5, 0x28, 0x8c, 0x7b, 0xe9, 0x40, 0x10, 0x02, 0x6d, 0xe5,
+    0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0x6f, 0x69, 0xe7, 0x28, 0xa3, 0xa0, 0xe3, 0x28, 0xc1, 0xcb,
+    0xe7, 0x28, 0xd2, 0xca, 0xe7, 0x40, 0x06, 0x02, 0xf5, 0x28, 0x78, 0xc0, 0xe7, 0x28, 0xe3, 0xc1,
+    0x64, 0x72, 0x61, 0xe2, 0x28, 0x7e, 0x99, 0x63, 0xf3, 0x28, 0xe5, 0x51, 0x62, 0x6c, 0xef, 0x40,
+    0x02, 0x05, 0xad, 0x20, 0x01, 0x6f, 0xe9, 0x28, 0xab, 0x86, 0xe4, 0x28, 0xb4, 0xcc, 0xe3, 0x29,
+    0x00, 0x7d, 0xb8, 0x40, 0x12, 0x02, 0x69, 0x2d, 0x6c, 0x72, 0x6f, 0xe6, 0x20, 0x01, 0x61, 0x6e,
+    0x65, 0x73, 0xe5, 0x28, 0xb8, 0xc6, 0x63, 0x2d, 0x61, 0x6e, 0x65, 0x73, 0x65, 0xe3, 0x20, 0x01,
+    0x6c, 0x72, 0xef, 0x28, 0x3c, 0xcf, 0x37, 0x65, 0x2d, 0x65, 0x74, 0x73, 0x6f, 0xe1, 0x20, 0x01,
+    0x65, 0x6c, 0xec, 0x28, 0xd0, 0x5f, 0x32, 0x6e, 0x2d, 0x6c, 0x6f, 0x72, 0x69, 0x74, 0xe4, 0x28,
+    0xf3, 0xc4, 0xe8, 0x21, 0x01, 0xae, 0xe8, 0x09, 0x56, 0xca, 0x24, 0xce, 0x36, 0x00, 0xe9, 0xaf,
+    0x28, 0x00, 0x21, 0x00, 0x12, 0x00, 0xea, 0xcd, 0xcd, 0xa3, 0xf4, 0x68, 0xf6, 0xcd, 0x06, 0x00,
+    0x1b, 0xc6, 0xec, 0x20, 0x01, 0xf5, 0x28, 0x6c, 0x9d, 0x70, 0xef, 0x48, 0xa5, 0xcc, 0xf3, 0xcd,
+    0xef, 0x68, 0x1e, 0xcc, 0x1a, 0xcd, 0x06, 0x00, 0xf3, 0x48, 0xd8, 0xbf, 0xcf, 0xcc, 0xec, 0x48,
+    0xd1, 0xcb, 0x8b, 0xc9, 0xe7, 0x21, 0x01, 0xae, 0xe8, 0x09, 0xea, 0xca, 0xb7, 0x9d, 0xd7, 0xc9,
+    0xb2, 0xad, 0xda, 0xcd, 0xd2, 0xcd, 0x89, 0xcd, 0xa2, 0xcb, 0xa8, 0xcd, 0xe6, 0x48, 0x14, 0xb9,
+    0x04, 0x00, 0x6f, 0xf3, 0x28, 0x8f, 0x4b, 0xe5, 0xe9, 0x0a, 0x05, 0x06, 0xa6, 0xcd, 0xc6, 0xca,
+    0x6b, 0x97, 0x08, 0xbf, 0xfb, 0x05, 0x19, 0x00, 0x4c, 0xcd, 0x14, 0x00, 0x06, 0xcc, 0x74, 0xe3,
+    0x28, 0x90, 0xc6, 0xee, 0x21, 0x01, 0xae, 0xe8, 0x1d, 0xd8, 0x05, 0xd4, 0x05, 0xd0, 0x05, 0xcc,
+    0x05, 0xc7, 0x05, 0xb9, 0x05, 0x99, 0x05, 0x7d, 0x05, 0x41, 0x05, 0xba, 0x04, 0xfe, 0x03, 0xe7,
+    0x03, 0x87, 0x03, 0x6c, 0x03, 0x3b, 0x05, 0x5c, 0x03, 0x38, 0x03, 0x26, 0x03, 0xed, 0x02, 0xd8,
+    0x02, 0x85, 0x02, 0x5b, 0x02, 0xa9, 0x01, 0x08, 0x01, 0xf1, 0x00, 0xdb, 0x00, 0xb1, 0x00, 0x48,
+    0x00, 0x3a, 0x00, 0xfa, 0x40, 0x08, 0x02, 0x74, 0x69, 0xf2, 0x28, 0xa0, 0xbb, 0xe1, 0x28, 0xe4,
+    0xaa, 0xf9, 0xc8, 0x63, 0x00, 0x77, 0x03, 0x46, 0x00, 0x17, 0x00, 0x0c, 0x00, 0x93, 0xcc, 0xee,
+    0x48, 0xd2, 0xaa, 0x04, 0x00, 0x6f, 0xe6, 0x28, 0xf9, 0xcb, 0x6c, 0x74, 0x73, 0x61, 0x66, 0xae,
+    0x88, 0x19, 0x00, 0x0e, 0x00, 0x29, 0x05, 0x08, 0x00, 0x73, 0x6c, 0xf4, 0x28, 0x2f, 0xa9, 0x6c,
+    0x73, 0x73, 0xae, 0x68, 0x39, 0xcd, 0x0c, 0xcd, 0x10, 0x00, 0x64, 0x6f, 0x72, 0x70, 0xae, 0x48,
+    0x2d, 0xcd, 0x04, 0x00, 0x6c, 0xe1, 0x28, 0x66, 0x9b, 0x66, 0x66, 0x69, 0x6a, 0x64, 0x75, 0x6f,
+    0x6c, 0xe3, 0x21, 0x01, 0xae, 0x40, 0x09, 0x02, 0x73, 0x75, 0x2d, 0xb1, 0x28, 0xc3, 0x76, 0x65,
+    0x64, 0x2d, 0xb1, 0x28, 0x82, 0xcb, 0xe1, 0x28, 0xa6, 0x80, 0xf8, 0x88, 0x67, 0xa6, 0x24, 0x00,
+    0x08, 0x00, 0x63, 0xa6, 0x74, 0x73, 0x61, 0x6c, 0x65, 0xae, 0x60, 0x09, 0x06, 0x03, 0xb3, 0x20,
+    0x07, 0xb2, 0x20, 0x04, 0xb1, 0x20, 0x01, 0x6f, 0x74, 0x73, 0x2d, 0x73, 0xec, 0x28, 0x56, 0xc6,
+    0xf3, 0x28, 0x97, 0xc2, 0x76, 0x65, 0x64, 0x2d, 0x6e, 0x61, 0x69, 0x73, 0x73, 0x61, 0x6c, 0x74,
+    0x61, 0x2e, 0x64, 0x6f, 0x72, 0x70, 0xae, 0x28, 0x5f, 0x02, 0xf5, 0x68, 0x9c, 0xcb, 0x78, 0xba,
+    0x06, 0x00, 0xf2, 0x21, 0x01, 0x65, 0x61, 0x6b, 0x75, 0x73, 0xf4, 0x20, 0x01, 0xae, 0x28, 0x84,
+    0x91, 0xf4, 0xe0, 0x08, 0x99, 0x7d, 0x6c, 0x62, 0x51, 0x41, 0x38, 0x08, 0xf3, 0x40, 0x27, 0x02,
+    0x6f, 0xe8, 0x40, 0x06, 0x02, 0xe7, 0x28, 0x54, 0xb5, 0x2d, 0x73, 0x70, 0xf6, 0x21, 0x01, 0x2e,
+    0x63, 0x69, 0x74, 0x73, 0x61, 0x6c, 0x65, 0x6a, 0xae, 0x68, 0xbe, 0xa3, 0x7e, 0x7d, 0x06, 0x00,
+    0x73, 0xea, 0x28, 0x52, 0xcc, 0x69, 0x78, 0x65, 0xf4, 0x28, 0x71, 0xc7, 0x72, 0x30, 0x70, 0x33,
+    0x6c, 0xb3, 0x28, 0x68, 0xcc, 0xee, 0x40, 0x07, 0x02, 0x6f, 0xf2, 0x28, 0xe8, 0x84, 0x65, 0x73,
+    0x73, 0xe9, 0x28, 0xdf, 0xb3, 0x69, 0xad, 0x40, 0x0a, 0x02, 0xf3, 0x68, 0xac, 0xa6, 0x02, 0xb2,
+    0xfb, 0x87, 0xe5, 0x28, 0x62, 0x4a, 0x66, 0x61, 0x72, 0x63, 0x65, 0x6e, 0xe9, 0x28, 0xdd, 0x8f,
+    0xe5, 0x40, 0x06, 0x02, 0xf3, 0x28, 0x58, 0x9a, 0x6e, 0x72, 0x65, 0x74, 0x6e, 0xe9, 0x28, 0xb2,
+    0xa6, 0x63, 0xe5, 0x60, 0x13, 0x09, 0x03, 0x6c, 0x65, 0xf3, 0x28, 0xe9, 0xb1, 0x6a, 0x6f, 0x72,
+    0x70, 0x72, 0x6f, 0xf4, 0x29, 0x9f, 0xb8, 0x66, 0x66, 0xe5, 0x28, 0x6b, 0xcb, 0x61, 0xe4, 0x28,
+    0x42, 0x34, 0xf3, 0xe8, 0x09, 0x83, 0xa7, 0x15, 0x85, 0xf8, 0x84, 0x8e, 0x00, 0x7e, 0x00, 0x65,
+    0x00, 0x25, 0x00, 0x12, 0x00, 0x06, 0xcc, 0xf3, 0x48, 0xe1, 0xa6, 0x04, 0x00, 0x65, 0x63, 0x63,
+    0xe1, 0x48, 0x04, 0x00, 0x45, 0xca, 0xad, 0x28, 0xef, 0x80, 0x70, 0x70, 0x61, 0x63, 0x69, 0x74,
+    0x61, 0x74, 0x73, 0x65, 0x72, 0x75, 0x7a, 0xe1, 0x21, 0x01, 0xae, 0xa8, 0xd6, 0xba, 0x22, 0x00,
+    0x1c, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x73, 0x75, 0x6c, 0x61, 0x72, 0xf4, 0x28, 0xaf, 0x0e, 0x65,
+    0x70, 0x6f, 0x72, 0x75, 0xe5, 0x28, 0x6a, 0x75, 0x61, 0x69, 0xf3, 0x28, 0x17, 0x7e, 0xb2, 0x21,
+    0x01, 0x73, 0x75, 0x74, 0xf3, 0x48, 0x16, 0x7e, 0xe9, 0xc4, 0xee, 0x40, 0x0b, 0x02, 0x6f, 0x69,
+    0x74, 0x63, 0x6e, 0xf5, 0x28, 0x1f, 0x84, 0xe4, 0xa8, 0xc3, 0xa6, 0x51, 0x3c, 0xe1, 0xc8, 0x5e,
+    0xcb, 0x24, 0x48, 0xeb, 0x40, 0x07, 0x02, 0x65, 0xeb, 0x28, 0x7c, 0x75, 0x63, 0x61, 0x74, 0xf3,
+    0x28, 0x15, 0xaf, 0xe5, 0x60, 0x19, 0x11, 0x03, 0xf4, 0x48, 0x04, 0x00, 0xe6, 0xb7, 0x69, 0x73,
+    0x62, 0x65, 0xf7, 0x28, 0x1e, 0x02, 0x73, 0x75, 0x6f, 0x68, 0xf3, 0x28, 0xfe, 0x16, 0x67, 0x64,
+    0x65, 0xad, 0x20, 0xf4, 0xf2, 0x40, 0x12, 0x02, 0x76, 0x64, 0x73, 0x6c, 0x65, 0x6e, 0x6e, 0x61,
+    0x68, 0xe3, 0x21, 0x01, 0xae, 0x28, 0x8c, 0xc8, 0xe5, 0x40, 0x0b, 0x02, 0x76, 0x72, 0x65, 0x73,
+    0x2d, 0xf8, 0x28, 0xf8, 0x64, 0x74, 0x73, 0x75, 0x6c, 0x63, 0xf9, 0x28, 0x8b, 0xc9, 0xf0, 0xe8,
+    0x07, 0x3a, 0x00, 0xa3, 0xc4, 0x2e, 0x00, 0x1a, 0x00, 0x13, 0x00, 0x0e, 0x00, 0x19, 0xb7, 0x74,
+    0xe6, 0x28, 0xf5, 0xa6, 0x70, 0xe1, 0x48, 0x70, 0xc9, 0xff, 0xb2, 0xef, 0x40, 0x08, 0x02, 0xe8,
+    0x48, 0x4b, 0xc4, 0x58, 0xca, 0x2d, 0x6f, 0x69, 0x64, 0x61, 0x72, 0xad, 0x28, 0x1a, 0xa4, 0x6d,
+    0x61, 0x63, 0x2d, 0x64, 0x6e, 0x61, 0x62, 0xad, 0x28, 0xe3, 0xc6, 0xe9, 0x88, 0x08, 0x00, 0x67,
+    0xb1, 0xec, 0xa6, 0xe4, 0x85, 0xad, 0x48, 0x04, 0x00, 0x48, 0xca, 0x65, 0x74, 0xf3, 0x28, 0xad,
+    0xa8, 0xef, 0xa8, 0x0f, 0x00, 0x0a, 0x00, 0xe5, 0xa6, 0x0f, 0xb7, 0xbf, 0x86, 0x64, 0xf5, 0x28,
+    0x5f, 0xb3, 0xe3, 0x28, 0x3f, 0xa8, 0xee, 0x88, 0x19, 0x00, 0x0b, 0x00, 0x08, 0x00, 0xdc, 0xa6,
+    0xe9, 0x21, 0xd1, 0x64, 0x63, 0x64, 0x75, 0x61, 0xe2, 0x20, 0x01, 0x6b, 0x63, 0xe1, 0x28, 0x7e,
+    0xca, 0xe1, 0x40, 0x10, 0x02, 0xe9, 0x40, 0x08, 0x02, 0x6c, 0x6c, 0xe5, 0x28, 0x34, 0xc5, 0xe2,
+    0x28, 0x80, 0xc6, 0xe6, 0x40, 0x06, 0x02, 0xec, 0x28, 0xcc, 0x99, 0xe1, 0x28, 0xc4, 0x89, 0xed,
+    0x40, 0x09, 0x02, 0x75, 0x72, 0x6f, 0xe6, 0x28, 0x27, 0xb6, 0x61, 0xe3, 0x48, 0xc9, 0x7c, 0x47,
+    0x9f, 0xec, 0x88, 0x1e, 0x00, 0x6a, 0xc0, 0x18, 0x00, 0x08, 0x00, 0xf3, 0x48, 0x52, 0xb7, 0x04,
+    0x00, 0x73, 0x2d, 0x37, 0xb7, 0x20, 0x01, 0xee, 0x28, 0x83, 0xa4, 0x6d, 0x65, 0xf4, 0x28, 0x4b,
+    0xb0, 0xe1, 0x28, 0x11, 0x88, 0xeb, 0x68, 0x06, 0x00, 0x0f, 0xa7, 0x9b, 0xc7, 0x63, 0x61, 0x74,
+    0x73, 0xf6, 0x28, 0xf1, 0x28, 0x68, 0x76, 0x6f, 0xae, 0x40, 0x0c, 0x02, 0x73, 0x61, 0x61, 0xf0,
+    0x20, 0x01, 0x62, 0x65, 0xf7, 0x02, 0x67, 0x6e, 0xe9, 0x20, 0x01, 0x74, 0x73, 0x6f, 0xe8, 0x02,
+    0xe7, 0x40, 0x07, 0x02, 0x6f, 0xec, 0x28, 0x97, 0xa5, 0x6e, 0xe9, 0x80, 0x1b, 0x14, 0x0e, 0x04,
+    0x74, 0x73, 0x6f, 0x68, 0x6e, 0x6e, 0xf9, 0x28, 0x46, 0xbd, 0x73, 0x69, 0xf2, 0x28, 0xbd, 0x8b,
+    0x72, 0x65, 0x65, 0xf3, 0x28, 0x21, 0x11, 0x67, 0x61, 0x74, 0x73, 0xad, 0xa8, 0x29, 0x00, 0x1d,
+    0x00, 0x87, 0x01, 0x12, 0x00, 0x0a, 0x00, 0xf9, 0x20, 0x01, 0x65, 0xeb, 0x28, 0xd9, 0xb1, 0x6e,
+    0xe9, 0x20, 0x01, 0x67, 0x69, 0x72, 0xef, 0x28, 0x6c, 0x01, 0xe5, 0x40, 0x06, 0x02, 0x74, 0xe9,
+    0x20, 0x40, 0x67, 0xe4, 0x20, 0xb9, 0xe4, 0x48, 0x04, 0x00, 0x50, 0x01, 0xe5, 0x28, 0x53, 0x01,
+    0xe6, 0x68, 0x0f, 0x00, 0x06, 0x00, 0x9f, 0xa6, 0x63, 0x72, 0x73, 0xae, 0x48, 0x0b, 0x0d, 0xe7,
+    0x2a, 0x61, 0x65, 0xec, 0x28, 0x5f, 0xbc, 0xe5, 0xe0, 0x0a, 0x97, 0x8a, 0x80, 0x5d, 0x3b, 0x2e,
+    0x26, 0x22, 0x12, 0x0a, 0x7a, 0x61, 0xed, 0x48, 0x34, 0x83, 0x50, 0x89, 0x74, 0xe9, 0x40, 0x06,
+    0x02, 0xf5, 0x28, 0x80, 0xb1, 0x73, 0x2d, 0x72, 0xe5, 0x28, 0x93, 0xbf, 0xf3, 0x29, 0x91, 0x68,
+    0x72, 0x65, 0x68, 0x75, 0xf2, 0x28, 0x27, 0xaf, 0xee, 0x48, 0x04, 0x00, 0xd8, 0xa6, 0x69, 0x6c,
+    0x6e, 0xef, 0x28, 0xd2, 0x89, 0xed, 0x80, 0x1a, 0x12, 0x0c, 0x04, 0x74, 0x63, 0x65, 0x72, 0xe9,
+    0x28, 0x3d, 0xc7, 0x6f, 0x68, 0xf4, 0x28, 0xe1, 0xb4, 0x69, 0x74, 0x6e, 0x75, 0xf2, 0x28, 0x06,
+    0x01, 0x65, 0x63, 0xee, 0x28, 0x8a, 0xac, 0xec, 0x40, 0x0e, 0x02, 0x69, 0x62, 0x6f, 0x6d, 0xad,
+    0x20, 0x01, 0x65, 0xf2, 0x28, 0x2a, 0x18, 0x61, 0x63, 0xf3, 0x40, 0x07, 0x02, 0x6e, 0xef, 0x28,
+    0x0d, 0xc8, 0x6c, 0x69, 0x61, 0x74, 0xae, 0x28, 0x17, 0x7d, 0x68, 0x74, 0x2d, 0x6e, 0x6f, 0x2d,
+    0xe5, 0x28, 0x8d, 0xbe, 0x67, 0xe4, 0x40, 0x07, 0x02, 0x69, 0xf2, 0x28, 0x2f, 0x60, 0xe5, 0x20,
+    0xa4, 0xe3, 0x40, 0x0d, 0x02, 0x72, 0x6f, 0x66, 0x65, 0x6c, 0x61, 0x63, 0xf3, 0x28, 0x5c, 0x98,
+    0x6e, 0x61, 0x72, 0x75, 0x73, 0x6e, 0x69, 0x68, 0x74, 0x6c, 0x61, 0x65, 0x68, 0x65, 0x7a, 0xe9,
+    0x28, 0x5d, 0x11, 0xe4, 0xa0, 0x76, 0x73, 0x4a, 0x40, 0x05, 0x75, 0x6f, 0x6c, 0xe3, 0x60, 0x31,
+    0x1a, 0x03, 0x78, 0x65, 0x64, 0x6e, 0x61, 0xf9, 0x21, 0x01, 0x2e, 0xe5, 0x40, 0x07, 0x02, 0x74,
+    0xe9, 0x28, 0xf2, 0x06, 0x67, 0xe1, 0x28, 0xbb, 0xc0, 0x6e, 0x69, 0x65, 0x76, 0x61, 0x73, 0x2e,
+    0xe3, 0x48, 0x04, 0x00, 0xa4, 0x8d, 0x64, 0x69, 0x2d, 0x65, 0x74, 0x73, 0xe5, 0x28, 0xc7, 0x59,
+    0x6d, 0x65, 0xe1, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x2d, 0x65, 0x68, 0xf4, 0x28, 0x52, 0xc5, 0x69,
+    0x72, 0x67, 0x65, 0x76, 0x69, 0x73, 0x73, 0x61, 0x6d, 0x2e, 0x73, 0x61, 0x61, 0x70, 0xae, 0x40,
+    0x09, 0x02, 0x32, 0xad, 0x48, 0x95, 0x96, 0xd2, 0xbc, 0x31, 0xad, 0x88, 0x08, 0x00, 0x8e, 0x96,
+    0x0d, 0xc7, 0xcb, 0xbc, 0xe7, 0x28, 0xf8, 0xc7, 0xe8, 0x20, 0x0a, 0xe5, 0x48, 0xda, 0xb5, 0x04,
+    0x00, 0xfa, 0x20, 0x01, 0x69, 0x61, 0xed, 0x28, 0x32, 0x39, 0xe3, 0x40, 0x0d, 0x02, 0x70, 0x61,
+    0x69, 0x64, 0xe5, 0x20, 0x01, 0xed, 0x28, 0xbf, 0xc7, 0xe9, 0x60, 0x20, 0x14, 0x03, 0x74, 0x61,
+    0x74, 0x73, 0xad, 0x20, 0x01, 0x6f, 0xe9, 0x20, 0x01, 0x65, 0x62, 0xef, 0x28, 0xa6, 0x97, 0x6e,
+    0x61, 0x67, 0x72, 0x6f, 0x2d, 0x67, 0x6e, 0xe9, 0x28, 0x2e, 0x03, 0x6d, 0x6f, 0x6e, 0x6f, 0x74,
+    0x70, 0x79, 0xf2, 0x28, 0x7e, 0xac, 0xe2, 0x68, 0x16, 0x00, 0xe8, 0xc7, 0x06, 0x00, 0x6c, 0x79,
+    0x6c, 0x74, 0x73, 0x61, 0xe6, 0x21, 0x01, 0xae, 0x20, 0x01, 0xf0, 0x28, 0x0a, 0xbb, 0xe2, 0x28,
+    0xda, 0xac, 0xe1, 0xa8, 0x14, 0x00, 0x48, 0x61, 0x42, 0xa6, 0x0a, 0x00, 0x7d, 0xc4, 0x74, 0x61,
+    0x64, 0x73, 0x79, 0x61, 0xf7, 0x28, 0xa7, 0xc7, 0xec, 0x48, 0x79, 0xa5, 0x04, 0x00, 0xed, 0x28,
+    0x83, 0x98, 0xb7, 0x48, 0x04, 0x00, 0x93, 0xb5, 0x37, 0x6e, 0x64, 0x63, 0xae, 0x28, 0xcc, 0xc7,
+    0x36, 0xf6, 0x28, 0xa1, 0xb5, 0xb5, 0x28, 0xbc, 0x9a, 0xb2, 0x28, 0x0e, 0xc7, 0xb1, 0x28, 0x0a,
+    0xc7, 0xb0, 0x28, 0x06, 0xc7, 0xeb, 0x48, 0x04, 0x00, 0xc4, 0xa6, 0xe3, 0x28, 0x93, 0xc3, 0xae,
+    0xe8, 0x08, 0x39, 0xc5, 0xba, 0xc7, 0xaa, 0xc7, 0xdb, 0xc5, 0x7a, 0xc5, 0x80, 0xc7, 0x78, 0xc7,
+    0x9d, 0xbf, 0x64, 0x69, 0xed, 0x28, 0x17, 0xc5, 0xe3, 0x48, 0x8b, 0x0c, 0x04, 0x00, 0xe5, 0x48,
+    0x61, 0xad, 0x04, 0x00, 0x72, 0x69, 0xe4, 0x21, 0x01, 0xf4, 0x20, 0x01, 0xf8, 0x28, 0x74, 0xc7,
+    0xe2, 0x69, 0x32, 0xbf, 0x6e, 0xc7, 0x06, 0x00, 0xe7, 0x28, 0x5d, 0xc6, 0xe1, 0xe9, 0x08, 0x21,
+    0x00, 0x73, 0xc7, 0x1d, 0x00, 0xc0, 0xc2, 0xe2, 0xbc, 0x14, 0x00, 0x10, 0x00, 0x94, 0x63, 0xed,
+    0x28, 0x5e, 0x77, 0xec, 0x21, 0x01, 0x61, 0x73, 0xe9, 0x28, 0x47, 0x6a, 0xe5, 0x29, 0xe0, 0xc6,
+    0xae, 0xe8, 0x0c, 0xf9, 0xb4, 0x7e, 0x00, 0x7a, 0x00, 0x62, 0x00, 0x43, 0x00, 0x5c, 0x9f, 0x30,
+    0x00, 0x1e, 0x00, 0x18, 0x00, 0x6c, 0xb2, 0x24, 0x9f, 0x3c, 0xbf, 0xf6, 0x48, 0x03, 0xc7, 0x6f,
+    0xb7, 0x73, 0x6d, 0x63, 0x65, 0x72, 0x75, 0x74, 0x75, 0xe6, 0x22, 0x01, 0xae, 0x40, 0x02, 0x2b,
+    0x6e, 0xe9, 0x02, 0xf2, 0x48, 0x04, 0x00, 0x2d, 0xc7, 0x65, 0x75, 0x65, 0x66, 0x6b, 0x6e, 0x75,
+    0x66, 0x2e, 0xee, 0x28, 0xd0, 0x8f, 0xef, 0x48, 0x3b, 0xc0, 0x04, 0x00, 0x66, 0x6e, 0xe9, 0x21,
+    0x01, 0x73, 0x74, 0x72, 0x6f, 0xae, 0x40, 0x06, 0x02, 0xf8, 0x28, 0xd6, 0x7c, 0x6e, 0x65, 0x64,
+    0x6e, 0xf5, 0x28, 0x4d, 0x9e, 0x67, 0x6e, 0xe9, 0x40, 0x08, 0x02, 0x74, 0x73, 0x6f, 0xe8, 0x20,
+    0x07, 0x6c, 0x69, 0x61, 0xed, 0x20, 0x01, 0x65, 0x72, 0xf5, 0x28, 0x07, 0x93, 0xe5, 0x28, 0xff,
+    0xb3, 0x63, 0xe1, 0x21, 0x01, 0x2e, 0xe8, 0x28, 0xc9, 0xc5, 0x30, 0xf3, 0x28, 0xfd, 0xbe, 0xf3,
+    0xe8, 0x17, 0x98, 0x06, 0x93, 0x06, 0x78, 0x06, 0x5e, 0x06, 0x35, 0x06, 0x0e, 0x06, 0x32, 0x05,
+    0x29, 0x05, 0x20, 0x05, 0xf6, 0x04, 0xc6, 0x04, 0x88, 0x04, 0x4e, 0x04, 0xfc, 0x03, 0xd7, 0x03,
+    0xaa, 0x03, 0x23, 0x03, 0xe7, 0x02, 0x89, 0x02, 0x7c, 0x00, 0x16, 0xc4, 0x36, 0x00, 0x2e, 0x00,
+    0xf9, 0x68, 0x0d, 0xb9, 0xdf, 0x13, 0x41, 0xc6, 0xf7, 0x89, 0x1e, 0x00, 0xa3, 0xc6, 0x0c, 0x00,
+    0x08, 0x00, 0xef, 0x28, 0x76, 0x71, 0xe5, 0x48, 0x47, 0x62, 0x04, 0x00, 0xee, 0x21, 0x01, 0x2e,
+    0x65, 0x6c, 0x62, 0x61, 0xe5, 0x28, 0xc0, 0x61, 0xae, 0xe8, 0x08, 0xc4, 0xac, 0x71, 0xc6, 0x61,
+    0xc6, 0x1a, 0x00, 0x10, 0x00, 0x31, 0xc4, 0x37, 0xc6, 0x2f, 0xc6, 0xf3, 0x48, 0x23, 0xb4, 0x04,
+    0x00, 0xf4, 0x28, 0x09, 0x97, 0x72, 0x6f, 0x73, 0x69, 0x76, 0xe4, 0x28, 0x99, 0xc5, 0xf5, 0xe9,
+    0x08, 0x33, 0x00, 0x2e, 0x00, 0x2a, 0x00, 0x80, 0xae, 0x1e, 0x00, 0x17, 0x00, 0x18, 0xb0, 0x10,
+    0x00, 0x78, 0xe5, 0x48, 0x13, 0xc5, 0x21, 0xc6, 0x69, 0x6e, 0x65, 0xf3, 0x28, 0x32, 0xa2, 0xe5,
+    0x21, 0x01, 0x2e, 0x79, 0x74, 0x72, 0x61, 0xf0, 0x28, 0x58, 0x27, 0xe2, 0x28, 0xfa, 0xb3, 0x61,
+    0xe8, 0x29, 0x27, 0x6e, 0xae, 0xe8, 0x15, 0x7e, 0x01, 0x70, 0x01, 0x39, 0x01, 0x28, 0x01, 0x21,
+    0x01, 0xc9, 0x00, 0xc6, 0x00, 0xbe, 0x00, 0xb2, 0x00, 0xaf, 0x00, 0x96, 0x00, 0x8a, 0x00, 0x80,
+    0x00, 0x78, 0x00, 0x62, 0x00, 0x54, 0x00, 0x50, 0x00, 0x43, 0x00, 0x3b, 0x00, 0x2d, 0x00, 0x2a,
+    0x00, 0xfa, 0x20, 0x96, 0xf9, 0x88, 0x08, 0x00, 0x41, 0x00, 0x49, 0x01, 0x64, 0x01, 0xe2, 0x28,
+    0xed, 0xa3, 0xf8, 0x40, 0x02, 0x65, 0xef, 0x28, 0x63, 0x05, 0xf6, 0x48, 0x33, 0x01, 0x04, 0x00,
+    0xf7, 0x21, 0x01, 0xae, 0x28, 0x50, 0xc3, 0xf5, 0x28, 0x74, 0x01, 0xf4, 0x88, 0x73, 0x01, 0x06,
+    0x01, 0x08, 0x00, 0x40, 0x01, 0xf5, 0x29, 0x6c, 0x01, 0xf3, 0xa0, 0x5e, 0x10, 0x0c, 0xf8, 0x05,
+    0x6e, 0xe4, 0x48, 0xa6, 0xa1, 0x17, 0xc4, 0xeb, 0x29, 0x5a, 0x01, 0xe4, 0x28, 0x25, 0xc1, 0xf2,
+    0x68, 0x48, 0x00, 0xab, 0x00, 0x1f, 0x01, 0xf0, 0x48, 0x04, 0x00, 0x32, 0x81, 0xe9, 0x28, 0x00,
+    0xc5, 0xef, 0x68, 0x3d, 0x01, 0xd0, 0x00, 0x06, 0x00, 0xf4, 0x28, 0x05, 0x7e, 0xee, 0xa8, 0x0e,
+    0x00, 0x2b, 0x01, 0xc4, 0x00, 0xcf, 0xc4, 0x0a, 0x00, 0xf4, 0x29, 0x28, 0x01, 0x61, 0x66, 0xe6,
+    0x20, 0x01, 0xec, 0x28, 0x29, 0xc5, 0xed, 0x20, 0xc7, 0xec, 0x68, 0x0e, 0x00, 0x06, 0x00, 0x0f,
+    0x01, 0xe6, 0x29, 0x10, 0x01, 0xeb, 0x40, 0x02, 0x65, 0xe1, 0x29, 0x08, 0x01, 0xea, 0x20, 0xb0,
+    0xe9, 0xc8, 0x53, 0x00, 0x0f, 0x00, 0x3c, 0xc0, 0x0c, 0x00, 0xcb, 0x00, 0xc8, 0x00, 0xf2, 0x21,
+    0x7d, 0xed, 0x21, 0x01, 0xae, 0xe8, 0x09, 0xba, 0xba, 0xa0, 0xaf, 0x38, 0x00, 0x34, 0x00, 0x27,
+    0x00, 0x1e, 0x00, 0x21, 0xba, 0x1a, 0x00, 0x12, 0x00, 0x77, 0x61, 0x6e, 0x65, 0xf4, 0x28, 0xec,
+    0x75, 0xf4, 0x28, 0x5c, 0xad, 0x72, 0x6f, 0x62, 0x72, 0x61, 0xad, 0x28, 0xf8, 0x70, 0xee, 0x48,
+    0xda, 0xc3, 0x04, 0x00, 0xef, 0x20, 0x01, 0xf4, 0x28, 0x83, 0x77, 0xe7, 0x28, 0xf2, 0xc4, 0xe3,
+    0x48, 0xf1, 0xc4, 0xc7, 0xbf, 0xe8, 0x21, 0x36, 0xe8, 0x40, 0x55, 0x02, 0xef, 0x21, 0xa5, 0xe5,
+    0x80, 0x51, 0x04, 0x32, 0x4e, 0x6c, 0x61, 0x73, 0x2d, 0x34, 0xad, 0x48, 0x3a, 0x6b, 0x80, 0xa2,
+    0xe4, 0xc0, 0x24, 0x88, 0x21, 0x18, 0x15, 0x06, 0xf5, 0x48, 0x04, 0x00, 0x71, 0xbb, 0x6f, 0x6c,
+    0xe3, 0x20, 0x01, 0xf2, 0x28, 0xc2, 0xc4, 0xf3, 0x21, 0x04, 0xee, 0x21, 0x01, 0xae, 0x48, 0x28,
+    0xaf, 0x46, 0xc2, 0xed, 0x21, 0x6e, 0xe5, 0x48, 0x44, 0xc3, 0x04, 0x00, 0x6c, 0x61, 0x63, 0x73,
+    0x6e, 0x65, 0x2e, 0xf8, 0x28, 0x1e, 0xab, 0xe3, 0x60, 0x09, 0x06, 0x03, 0xf3, 0x21, 0x55, 0xee,
+    0x21, 0x52, 0xe4, 0x21, 0x4f, 0xe1, 0xe8, 0x09, 0x48, 0x00, 0x45, 0x00, 0x42, 0x00, 0x3f, 0x00,
+    0x1b, 0x00, 0x18, 0x00, 0xe0, 0xb1, 0x15, 0x00, 0x12, 0x00, 0xf7, 0x21, 0x37, 0xf6, 0x21, 0x34,
+    0xf0, 0x21, 0x31, 0xed, 0x21, 0x01, 0xae, 0x68, 0x06, 0x00, 0xdf, 0xae, 0xfd, 0xc1, 0x32, 0x31,
+    0xeb, 0x21, 0x01, 0xae, 0x60, 0x0c, 0x07, 0x03, 0xf4, 0x28, 0x74, 0xae, 0x72, 0xf4, 0x28, 0xa0,
+    0xbf, 0x68, 0x63, 0xef, 0x28, 0x68, 0xa9, 0xec, 0x21, 0x0a, 0xe9, 0x21, 0x07, 0xe7, 0x21, 0x04,
+    0xe3, 0x21, 0x01, 0xae, 0x68, 0xcc, 0xb9, 0xb2, 0xae, 0xd0, 0xc1, 0xf4, 0xc8, 0x4c, 0x00, 0x45,
+    0x00, 0x1e, 0x0e, 0x3b, 0x00, 0x0c, 0x00, 0x50, 0xa9, 0xee, 0x40, 0x23, 0x02, 0xe5, 0x40, 0x12,
+    0x02, 0x76, 0xe5, 0x21, 0x01, 0xae, 0x48, 0x04, 0x00, 0x18, 0xc4, 0x6e, 0x69, 0xe2, 0x28, 0xc8,
+    0x30, 0x6d, 0xf4, 0x48, 0xb5, 0x0a, 0x04, 0x00, 0x73, 0x65, 0xf6, 0x28, 0x37, 0xc2, 0xe1, 0x20,
+    0x01, 0x74, 0x6e, 0x75, 0xef, 0x28, 0x9e, 0xa9, 0xe8, 0x48, 0x65, 0x3f, 0x04, 0x00, 0xe7, 0x28,
+    0x63, 0x0f, 0x65, 0xeb, 0x48, 0x2f, 0x5b, 0xf6, 0xa2, 0xe1, 0x48, 0x04, 0x00, 0xbb, 0xc2, 0xe5,
+    0x48, 0xcf, 0xc3, 0x04, 0x00, 0xf9, 0x28, 0xca, 0xb8, 0xf3, 0x89, 0x27, 0x00, 0xef, 0x68, 0x08,
+    0x00, 0xd2, 0x8f, 0xe5, 0x60, 0x10, 0x07, 0x03, 0xf8, 0x28, 0x67, 0xc2, 0x72, 0xf0, 0x21, 0x01,
+    0x78, 0xe5, 0x29, 0x9e, 0x69, 0xee, 0x48, 0x04, 0x00, 0x4a, 0x47, 0x69, 0x73, 0x75, 0xe2, 0x29,
+    0x13, 0xb2, 0xae, 0xe8, 0x08, 0xbb, 0xc0, 0xb7, 0xc3, 0x28, 0xc1, 0xa7, 0xc3, 0x77, 0xc1, 0x7d,
+    0xc3, 0x75, 0xc3, 0x9a, 0xbb, 0xf2, 0xe9, 0x07, 0x5e, 0x00, 0x51, 0x00, 0x9a, 0xc3, 0x1f, 0x00,
+    0x0e, 0x00, 0x74, 0xb6, 0xfc, 0x96, 0x6f, 0xf4, 0x40, 0x08, 0x02, 0x6f, 0x6d, 0xe1, 0x28, 0x84,
+    0x43, 0x63, 0x61, 0xf2, 0x28, 0xaf, 0x67, 0xe5, 0xe8, 0x07, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00,
+    0x8b, 0xb1, 0xde, 0x73, 0x12, 0x00, 0x0e, 0x00, 0xf7, 0x28, 0xbe, 0x75, 0xee, 0x48, 0x5f, 0x6e,
+    0x7c, 0xa8, 0xe7, 0x28, 0xe1, 0xbd, 0xe5, 0x28, 0xba, 0x7a, 0x64, 0x6c, 0x69, 0x75, 0xe2, 0x21,
+    0x01, 0x2e, 0x65, 0x74, 0x69, 0xf3, 0x28, 0xc0, 0xc1, 0xe1, 0x68, 0x47, 0xc3, 0xdb, 0xc2, 0x06,
+    0x00, 0x74, 0xe9, 0x28, 0xcb, 0xad, 0xae, 0xe8, 0x0a, 0x1f, 0x00, 0x11, 0xc1, 0x43, 0xc3, 0x6a,
+    0xc1, 0x36, 0xc3, 0x70, 0xbc, 0x09, 0xc3, 0x01, 0xc3, 0x1b, 0x73, 0x14, 0x00, 0x79, 0x6c, 0x64,
+    0x6e, 0x65, 0x72, 0x62, 0xae, 0x28, 0xfe, 0xa8, 0xe1, 0x28, 0x78, 0xc0, 0xf0, 0x69, 0x16, 0x00,
+    0x06, 0x00, 0x74, 0xc0, 0xe9, 0x68, 0x06, 0x00, 0x52, 0x75, 0x25, 0xc3, 0x68, 0x73, 0x72, 0x61,
+    0xec, 0x28, 0x78, 0xc0, 0xae, 0xe8, 0x07, 0xa9, 0xa8, 0x05, 0xc3, 0xf5, 0xc2, 0x0e, 0x00, 0xc5,
+    0xc0, 0xcb, 0xc2, 0xc3, 0xc2, 0xef, 0x28, 0xc2, 0xac, 0xef, 0xa0, 0x1f, 0x1b, 0x15, 0x11, 0x05,
+    0xf4, 0x48, 0x04, 0x00, 0xd8, 0xab, 0x6f, 0x68, 0xf0, 0x29, 0x62, 0xc1, 0xf0, 0x28, 0xab, 0xbe,
+    0x6c, 0x65, 0xf5, 0x28, 0x1c, 0xc1, 0xe7, 0x28, 0x2a, 0x69, 0xe4, 0x28, 0xf0, 0xa7, 0xee, 0x80,
+    0x44, 0x3e, 0x27, 0x04, 0xef, 0x40, 0x06, 0x02, 0xf0, 0x28, 0x24, 0x9e, 0x69, 0xf4, 0x68, 0x13,
+    0x00, 0x28, 0x41, 0x06, 0x00, 0x75, 0x6c, 0x6f, 0xf3, 0x21, 0x01, 0x2e, 0x72, 0x65, 0xe8, 0x28,
+    0xa9, 0x7b, 0x61, 0xe3, 0x28, 0xce, 0xbf, 0xe9, 0x40, 0x09, 0x02, 0xe7, 0x20, 0x01, 0xe9, 0x28,
+    0x9f, 0xc2, 0xe1, 0x40, 0x06, 0x02, 0xed, 0x28, 0xa6, 0xbd, 0xe7, 0x28, 0xcd, 0xc1, 0x65, 0x67,
+    0xe1, 0x28, 0x1f, 0x41, 0xe1, 0x68, 0x16, 0xc1, 0x06, 0x00, 0xc1, 0xae, 0xe7, 0x28, 0x09, 0xa0,
+    0xed, 0x89, 0x20, 0x00, 0x5e, 0xc2, 0x0c, 0x00, 0x08, 0x00, 0xe9, 0x28, 0x6e, 0x3e, 0x65, 0x74,
+    0x73, 0x79, 0xf3, 0x21, 0x01, 0x2e, 0x74, 0x6e, 0x69, 0x6f, 0x70, 0x74, 0x68, 0x67, 0xe9, 0x28,
+    0x2b, 0x5c, 0xae, 0xe8, 0x07, 0x07, 0x69, 0x0e, 0x00, 0x57, 0xc2, 0x47, 0xc2, 0x17, 0xc0, 0x1d,
+    0xc2, 0x15, 0xc2, 0x65, 0x74, 0x69, 0xf3, 0x28, 0x6f, 0x7c, 0xec, 0xc9, 0x29, 0x00, 0x1f, 0x00,
+    0x13, 0x00, 0x0c, 0x00, 0x3e, 0xc2, 0xf6, 0x9f, 0x6c, 0x61, 0x68, 0xf3, 0x28, 0x2e, 0xa1, 0xe5,
+    0x48, 0xa7, 0x67, 0x04, 0x00, 0x74, 0x6f, 0xe8, 0x29, 0xac, 0x01, 0xe1, 0x48, 0x14, 0xbe, 0x04,
+    0x00, 0xf4, 0x28, 0x66, 0x43, 0xae, 0xe8, 0x08, 0x3b, 0xab, 0x09, 0xbe, 0x14, 0xc2, 0x01, 0xba,
+    0xd4, 0xbf, 0xda, 0xc1, 0xd2, 0xc1, 0xf7, 0xb9, 0xeb, 0x68, 0x0c, 0x00, 0x06, 0x00, 0xde, 0xb4,
+    0x68, 0x78, 0xe4, 0x28, 0xb9, 0xc2, 0xe3, 0x48, 0x04, 0x00, 0xd7, 0xbb, 0x6f, 0xf2, 0x21, 0x01,
+    0xae, 0x68, 0x0c, 0x00, 0x06, 0x00, 0xb5, 0x99, 0x73, 0x6e, 0xe4, 0x28, 0x76, 0xa9, 0x65, 0x63,
+    0x61, 0xf0, 0x20, 0x01, 0xf3, 0x28, 0x26, 0xbb, 0xe9, 0xa9, 0x12, 0x00, 0x44, 0xb8, 0x0e, 0x00,
+    0xe3, 0xa6, 0x0a, 0x00, 0xf4, 0x28, 0x0a, 0x8a, 0xee, 0x28, 0x9b, 0x2e, 0xae, 0xc8, 0x0c, 0x00,
+    0xbe, 0xc1, 0xae, 0xc1, 0x61, 0x5e, 0x84, 0xc1, 0x7c, 0xc1, 0x65, 0x6b, 0x61, 0x63, 0xf0, 0x28,
+    0x9d, 0xbf, 0x68, 0x35, 0x63, 0x38, 0x32, 0xb2, 0x28, 0xd9, 0xb9, 0xe7, 0x21, 0x01, 0x6e, 0x69,
+    0xe4, 0x28, 0xb6, 0x4d, 0xe5, 0xe9, 0x0f, 0xbe, 0x00, 0xb1, 0x00, 0x9e, 0x00, 0x94, 0x00, 0x7a,
+    0x00, 0x75, 0x00, 0x60, 0x00, 0x58, 0x00, 0x58, 0x9e, 0x8a, 0xa8, 0x54, 0x00, 0x3b, 0x00, 0x28,
+    0x00, 0x22, 0x00, 0x1e, 0x00, 0xf6, 0x28, 0xbb, 0xac, 0x74, 0x61, 0xe9, 0x28, 0x6f, 0x6a, 0xf3,
+    0x40, 0x06, 0x02, 0xf2, 0x28, 0xc9, 0x9c, 0xe9, 0x48, 0x04, 0x00, 0xd9, 0xa5, 0x72, 0xf0, 0x28,
+    0x00, 0x3f, 0xf2, 0x48, 0x64, 0xc1, 0x04, 0x00, 0x75, 0xf4, 0x48, 0x04, 0x00, 0xfe, 0x54, 0x63,
+    0x69, 0xf0, 0x21, 0x01, 0x2e, 0x37, 0x33, 0xb3, 0x28, 0x59, 0xb0, 0xf0, 0x28, 0x3a, 0x07, 0xed,
+    0x68, 0x1d, 0xb7, 0x24, 0xc0, 0x92, 0x7e, 0xec, 0xa8, 0x8b, 0xa0, 0x14, 0x70, 0x5a, 0x92, 0x0e,
+    0x00, 0x0a, 0x00, 0xf0, 0x28, 0x19, 0xc0, 0x67, 0xee, 0x28, 0x45, 0xbe, 0x6a, 0xe1, 0x28, 0x2a,
+    0xbd, 0xe9, 0x60, 0x11, 0x0c, 0x03, 0x74, 0x72, 0x65, 0x70, 0x6f, 0x72, 0xf0, 0x21, 0x97, 0x72,
+    0xf4, 0x28, 0xfa, 0x5c, 0xec, 0x20, 0x01, 0xf0, 0x28, 0x1b, 0x60, 0xe8, 0x48, 0x1a, 0x6d, 0x04,
+    0x00, 0xe7, 0x28, 0x26, 0x67, 0xe4, 0x40, 0x0c, 0x02, 0x6f, 0xe3, 0x21, 0x01, 0x2e, 0x6f, 0xf7,
+    0x28, 0xfe, 0xb1, 0x64, 0xb2, 0x28, 0xbf, 0xc1, 0x63, 0x69, 0x76, 0x72, 0x65, 0xf3, 0x21, 0x01,
+    0x2e, 0xe5, 0x28, 0xf7, 0xa4, 0xae, 0xa8, 0x0e, 0x00, 0xd5, 0xc0, 0x0a, 0x00, 0xa9, 0xaf, 0x9b,
+    0xc0, 0xed, 0x28, 0xaf, 0x5b, 0xe2, 0x48, 0x04, 0x00, 0x86, 0xc0, 0x65, 0xf7, 0x28, 0x1f, 0xa6,
+    0xe4, 0xe8, 0x07, 0xca, 0xc0, 0x17, 0xbe, 0x3f, 0xbc, 0x94, 0xbf, 0x14, 0x00, 0x0e, 0x00, 0x0f,
+    0x78, 0x6f, 0x6f, 0xe7, 0x28, 0x2f, 0xa7, 0xee, 0x40, 0x07, 0x02, 0x6f, 0xed, 0x28, 0xe1, 0xb1,
+    0x69, 0x77, 0x72, 0xe9, 0x28, 0xbe, 0xb6, 0xe3, 0x48, 0x04, 0x00, 0xa5, 0xbb, 0xe9, 0x68, 0x1c,
+    0x00, 0x17, 0xc0, 0x06, 0x00, 0xf4, 0x40, 0x07, 0x02, 0x79, 0xec, 0x28, 0x7d, 0x25, 0x73, 0x69,
+    0x67, 0x6f, 0xec, 0x20, 0x01, 0x79, 0x72, 0xf2, 0x28, 0xa4, 0xad, 0x68, 0xf0, 0x28, 0xb2, 0x88,
+    0xe2, 0xa9, 0x0a, 0x00, 0x60, 0xc0, 0x2f, 0xb1, 0xec, 0xbf, 0xc0, 0xbd, 0xae, 0xc8, 0xb1, 0xb9,
+    0x5e, 0xc0, 0x4e, 0xc0, 0x1e, 0xbe, 0x24, 0xc0, 0x1c, 0xc0, 0xe1, 0xc9, 0x0a, 0xb4, 0x10, 0x00,
+    0x3e, 0x49, 0x7e, 0x6f, 0x0c, 0x00, 0xd2, 0xbf, 0xed, 0x28, 0x45, 0x6d, 0x62, 0x69, 0x72, 0x61,
+    0x70, 0xf0, 0x28, 0x56, 0xbe, 0x39, 0xfa, 0x28, 0x6a, 0xb8, 0x38, 0xf3, 0x28, 0x65, 0xb8, 0xf2,
+    0xe8, 0x12, 0xf1, 0x06, 0x9b, 0x03, 0x8a, 0x03, 0xc2, 0x02, 0xc3, 0x01, 0xb2, 0x01, 0x95, 0x01,
+    0x66, 0x01, 0xc9, 0x00, 0xc5, 0x00, 0xbc, 0x00, 0xb8, 0x00, 0x9f, 0x00, 0x79, 0x00, 0xac, 0xbf,
+    0x29, 0x00, 0x24, 0x00, 0xc7, 0xa0, 0x75, 0xe2, 0x28, 0x07, 0xbc, 0xf4, 0x69, 0x06, 0x00, 0x8f,
+    0xbe, 0xfd, 0xbf, 0xae, 0xe8, 0x11, 0x7b, 0xb5, 0x46, 0xb9, 0x40, 0x00, 0x75, 0xbd, 0xf6, 0xbf,
+    0x3c, 0x00, 0x2e, 0x00, 0x51, 0xaa, 0x71, 0x9f, 0x17, 0xbe, 0x66, 0x88, 0x95, 0xb6, 0x2a, 0x00,
+    0xb6, 0xbd, 0xbc, 0xbf, 0x22, 0x00, 0xd9, 0xb7, 0xf6, 0x68, 0xe3, 0xbf, 0x93, 0xbf, 0xe1, 0xbf,
+    0xf3, 0x28, 0x4b, 0xb9, 0xec, 0x68, 0x06, 0x00, 0xc1, 0xbf, 0x65, 0xbb, 0xe5, 0x48, 0xa2, 0xbf,
+    0xcd, 0xbf, 0xeb, 0x28, 0x29, 0x35, 0x63, 0xee, 0x29, 0x6d, 0xb3, 0xf0, 0x21, 0x01, 0xae, 0xe8,
+    0x0b, 0x1c, 0x00, 0x79, 0xbd, 0x2a, 0xbd, 0x2a, 0x5b, 0xab, 0xbf, 0x9b, 0xbf, 0x07, 0xb5, 0x16,
+    0x00, 0x71, 0xbf, 0x69, 0xbf, 0x8e, 0xb7, 0xf4, 0x48, 0x79, 0xbf, 0x68, 0xb0, 0xe1, 0x28, 0xb6,
+    0x69, 0xef, 0x68, 0x0c, 0x7f, 0x12, 0x00, 0x06, 0x00, 0xf4, 0x48, 0x04, 0x00, 0xc3, 0xa3, 0xe3,
+    0x48, 0x8c, 0xbf, 0x8d, 0xba, 0x6f, 0xe4, 0x28, 0x9a, 0x02, 0xee, 0x29, 0x0b, 0x94, 0xed, 0x21,
+    0x01, 0xae, 0x48, 0x96, 0xb8, 0x27, 0xbf, 0xec, 0x29, 0x0b, 0xb7, 0xeb, 0x41, 0x06, 0x02, 0xe3,
+    0x28, 0xc2, 0x0a, 0xae, 0xe8, 0x0d, 0x7d, 0xa8, 0x8a, 0x00, 0x86, 0x00, 0x7b, 0x00, 0x69, 0x00,
+    0x5e, 0x00, 0x58, 0x00, 0x37, 0x00, 0x3d, 0x98, 0x59, 0xbf, 0x2f, 0x00, 0x83, 0xb8, 0x1a, 0x00,
+    0xf5, 0x40, 0x0f, 0x02, 0xea, 0x48, 0xba, 0xb6, 0x04, 0x00, 0x67, 0x6e, 0x61, 0xf7, 0x28, 0xf1,
+    0xbe, 0xe7, 0x28, 0x2b, 0x9f, 0xf3, 0x68, 0xf1, 0xbe, 0x11, 0xbe, 0x23, 0xbf, 0xee, 0x40, 0x18,
+    0x02, 0xef, 0x40, 0x08, 0x02, 0x77, 0x67, 0xee, 0x28, 0xf5, 0xb4, 0xe5, 0x40, 0x06, 0x02, 0xea,
+    0x28, 0x0d, 0x9f, 0xe8, 0x28, 0xce, 0x90, 0x61, 0xf3, 0x48, 0x93, 0x48, 0xe8, 0xb1, 0x6d, 0x61,
+    0xee, 0x40, 0x18, 0x13, 0xec, 0x48, 0xf1, 0xbe, 0x04, 0x00, 0x75, 0xef, 0x28, 0xae, 0xb9, 0x6b,
+    0x75, 0xe2, 0x40, 0x07, 0x02, 0x6e, 0xef, 0x28, 0x68, 0xb6, 0x67, 0xee, 0x48, 0x0a, 0x00, 0x7a,
+    0x96, 0x69, 0x67, 0x67, 0xee, 0x20, 0x01, 0x6f, 0xe5, 0x28, 0x16, 0x0d, 0xe7, 0x28, 0x57, 0xba,
+    0xe5, 0x68, 0xb3, 0xbe, 0x54, 0xbe, 0xb8, 0xbe, 0xe9, 0x89, 0x0e, 0x00, 0x08, 0x00, 0x15, 0xb8,
+    0x04, 0xb2, 0xe1, 0x48, 0xa4, 0xbd, 0xdc, 0x5f, 0xae, 0xe8, 0x08, 0x10, 0x00, 0x7f, 0xbc, 0x28,
+    0x90, 0xb1, 0xbe, 0x22, 0xbc, 0xa4, 0xbe, 0x71, 0xbc, 0x6f, 0xbe, 0xe1, 0x40, 0x06, 0x02, 0xf2,
+    0x28, 0xf1, 0xbe, 0xb6, 0x28, 0xea, 0xbe, 0xe8, 0x49, 0x04, 0x00, 0x4e, 0x70, 0xae, 0x88, 0x0f,
+    0x00, 0x08, 0x00, 0xba, 0xb7, 0x96, 0x35, 0x6d, 0xef, 0x48, 0x78, 0xbe, 0x0f, 0xbd, 0xe5, 0x48,
+    0x7f, 0x9a, 0xfe, 0xbb, 0xe7, 0x21, 0x01, 0xae, 0xc8, 0x37, 0x03, 0x73, 0xbe, 0x63, 0xbe, 0x41,
+    0xbe, 0x39, 0xbe, 0x31, 0xbe, 0xe6, 0x69, 0x0b, 0x00, 0x06, 0x00, 0xe7, 0xbd, 0x61, 0xf6, 0x28,
+    0x9e, 0xb4, 0xae, 0xe8, 0x0e, 0xea, 0x00, 0xd9, 0x00, 0x09, 0x9e, 0x9a, 0x00, 0x95, 0x00, 0x88,
+    0x00, 0x03, 0x9e, 0x82, 0x00, 0x10, 0xb3, 0x2b, 0xad, 0x4d, 0x00, 0x23, 0x00, 0x00, 0x94, 0x1c,
+    0x00, 0x78, 0x6f, 0x62, 0xe9, 0x28, 0x3e, 0x56, 0xf4, 0x68, 0x39, 0x91, 0x1c, 0x00, 0x06, 0x00,
+    0xf2, 0x40, 0x07, 0x02, 0x6f, 0xf0, 0x29, 0xd5, 0x3d, 0x65, 0x70, 0x78, 0x65, 0x2d, 0x65, 0x72,
+    0x74, 0x65, 0xed, 0x28, 0x81, 0xa7, 0xef, 0x48, 0x04, 0x00, 0xe9, 0xbd, 0x6f, 0x72, 0xad, 0x28,
+    0x20, 0x9d, 0xf3, 0x40, 0x13, 0x02, 0xef, 0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0xf8, 0x48, 0x04,
+    0x00, 0xf8, 0x75, 0xe2, 0x28, 0x87, 0xbc, 0xe5, 0x88, 0x0c, 0x00, 0x14, 0x82, 0x54, 0x00, 0x08,
+    0x00, 0xf5, 0x28, 0xf4, 0x90, 0x6c, 0x62, 0x61, 0x74, 0x70, 0x6d, 0x6f, 0x63, 0x2d, 0x73, 0x74,
+    0xf2, 0x20, 0x01, 0xe5, 0x28, 0x66, 0xb1, 0xee, 0x48, 0xe3, 0x81, 0x04, 0x82, 0xe9, 0x48, 0x56,
+    0xbb, 0x04, 0x00, 0x72, 0x67, 0x61, 0xe2, 0x28, 0x0e, 0x3c, 0x68, 0xee, 0x28, 0x3f, 0xbd, 0xe5,
+    0x68, 0x0c, 0x00, 0x06, 0x00, 0xf8, 0x81, 0x6c, 0x69, 0xf0, 0x28, 0x5d, 0x93, 0xe3, 0x40, 0x20,
+    0x02, 0x6e, 0x61, 0x72, 0x66, 0x2d, 0x6e, 0x65, 0x2d, 0x73, 0xe5, 0x20, 0x01, 0x74, 0x73, 0x69,
+    0x74, 0x6e, 0x65, 0x64, 0x2d, 0x73, 0x6e, 0x65, 0x69, 0x67, 0x72, 0xf5, 0x28, 0x32, 0x6e, 0x69,
+    0x74, 0x73, 0x75, 0x6a, 0x2d, 0x72, 0x65, 0x69, 0x73, 0x73, 0xe9, 0x28, 0xad, 0x63, 0x62, 0x65,
+    0xf7, 0x48, 0x1d, 0x7e, 0x04, 0x00, 0x65, 0x74, 0xe9, 0x20, 0x01, 0xf3, 0x28, 0x7f, 0xac, 0x61,
+    0xf4, 0x28, 0x07, 0x5d, 0xe5, 0xea, 0x11, 0xb5, 0xb6, 0xbe, 0x00, 0x31, 0xa6, 0xac, 0x00, 0x9e,
+    0x00, 0x90, 0x00, 0x88, 0x00, 0x7c, 0x00, 0x6f, 0x00, 0x8f, 0x91, 0x8f, 0x04, 0x69, 0x00, 0x4a,
+    0x00, 0x36, 0x00, 0x2c, 0x00, 0x28, 0x00, 0x22, 0x00, 0x7a, 0x69, 0xe6, 0x28, 0xc9, 0xbc, 0xf9,
+    0x28, 0x3f, 0xb6, 0x77, 0x75, 0x6c, 0x6b, 0x73, 0x72, 0xe5, 0x28, 0x51, 0x79, 0xf6, 0x40, 0x08,
+    0x02, 0x72, 0x65, 0xf3, 0x28, 0xbd, 0x26, 0xef, 0x48, 0x06, 0x82, 0x04, 0x00, 0xf2, 0x28, 0x77,
+    0x63, 0xf4, 0xa8, 0xc4, 0xa2, 0xdc, 0x86, 0x19, 0x00, 0x0a, 0x00, 0xe6, 0x63, 0xf3, 0x68, 0x7f,
+    0x6b, 0xe6, 0x93, 0x06, 0x00, 0x75, 0x62, 0x6b, 0xe3, 0x28, 0xe0, 0xbc, 0xee, 0x28, 0xae, 0x98,
+    0x70, 0x69, 0xee, 0x28, 0x82, 0x6f, 0xec, 0x48, 0xe9, 0x3d, 0x04, 0x00, 0x66, 0x66, 0x65, 0xe1,
+    0x28, 0x5c, 0xba, 0xeb, 0x48, 0x1c, 0xa5, 0x04, 0x00, 0xef, 0x48, 0x6b, 0xbc, 0x4b, 0xa5, 0xe9,
+    0x20, 0x01, 0x74, 0xee, 0x28, 0x62, 0x9a, 0xe8, 0x68, 0x83, 0xa6, 0x5a, 0x35, 0x06, 0x00, 0xf4,
+    0x48, 0x54, 0x8a, 0xbc, 0x60, 0x67, 0x6e, 0xe9, 0x48, 0x07, 0x85, 0x04, 0x00, 0x72, 0x68, 0xe5,
+    0x28, 0x85, 0xbb, 0xe5, 0x68, 0x9b, 0xbc, 0x06, 0x00, 0x0d, 0x74, 0xee, 0x48, 0xbd, 0x9b, 0x04,
+    0x00, 0xef, 0x28, 0x8e, 0xb5, 0xe3, 0x20, 0x01, 0xe3, 0x28, 0x20, 0xa4, 0xe3, 0x21, 0x01, 0xae,
+    0xc8, 0xee, 0xb8, 0x69, 0xba, 0x64, 0xbc, 0x00, 0xb2, 0x82, 0x95, 0x9e, 0xbc, 0xe2, 0x21, 0x01,
+    0xae, 0xe8, 0x17, 0x4b, 0x03, 0xc5, 0x02, 0xbb, 0x02, 0xa7, 0x02, 0x97, 0x02, 0x64, 0x02, 0x50,
+    0x02, 0xbb, 0x01, 0xb7, 0x01, 0x8b, 0x01, 0x76, 0x01, 0x2e, 0x01, 0x2a, 0x01, 0xcf, 0x00, 0xbd,
+    0x00, 0xb9, 0x00, 0xa7, 0x00, 0x86, 0x00, 0x66, 0x00, 0x51, 0x00, 0x40, 0x00, 0x3c, 0x00, 0x2e,
+    0x00, 0xfa, 0x68, 0x30, 0x90, 0x59, 0xb9, 0x06, 0x00, 0xef, 0x48, 0x47, 0xbc, 0xe1, 0xba, 0xf8,
+    0x28, 0x58, 0xb8, 0xf6, 0xa8, 0xae, 0x8b, 0x3c, 0xb8, 0x0a, 0x00, 0xe6, 0x9f, 0x56, 0xbc, 0x6f,
+    0xe7, 0x29, 0x9e, 0x01, 0xf5, 0x88, 0x0c, 0x00, 0xff, 0xbb, 0x08, 0x00, 0x51, 0xb5, 0xea, 0x28,
+    0x3d, 0xbc, 0x63, 0x61, 0x75, 0xe7, 0x28, 0xb2, 0x9c, 0xf4, 0xc8, 0x1b, 0xaf, 0x16, 0x00, 0x8a,
+    0x5c, 0x10, 0x00, 0x2c, 0xb4, 0x0c, 0x00, 0xf3, 0x28, 0xa3, 0xba, 0xef, 0x48, 0x9f, 0xba, 0xf8,
+    0xbb, 0xe5, 0x68, 0x67, 0xb9, 0xf2, 0xbb, 0x4d, 0xba, 0xf3, 0x68, 0x12, 0x00, 0xf6, 0xb7, 0x06,
+    0x00, 0xf5, 0x68, 0x06, 0x00, 0x81, 0xb5, 0xf7, 0xbb, 0xe1, 0x28, 0x0b, 0x65, 0xe1, 0x68, 0x06,
+    0x00, 0xa0, 0x61, 0xf4, 0x01, 0x69, 0xf8, 0x28, 0x71, 0xb9, 0xf2, 0xa8, 0x07, 0xb2, 0x2c, 0xb5,
+    0x0a, 0x00, 0x94, 0x04, 0xa6, 0x98, 0xef, 0x48, 0x1c, 0x68, 0x5c, 0xb5, 0xf1, 0x28, 0xd9, 0xb3,
+    0xf0, 0xa8, 0xaf, 0xb9, 0x0a, 0x00, 0x5d, 0x89, 0x70, 0xa4, 0x9f, 0xac, 0xed, 0x49, 0x8a, 0xbb,
+    0xcd, 0xbb, 0xef, 0xe8, 0x07, 0x50, 0x00, 0x3d, 0x00, 0x2e, 0x00, 0x28, 0x00, 0x1a, 0x00, 0xd7,
+    0xba, 0x0e, 0x00, 0xf4, 0x48, 0xb8, 0xbb, 0x04, 0x00, 0x65, 0x72, 0xf0, 0x28, 0xeb, 0x62, 0xe9,
+    0x88, 0x7f, 0xbb, 0xb6, 0x84, 0x08, 0x00, 0x89, 0xbb, 0xe5, 0x28, 0xd6, 0x08, 0xe5, 0x48, 0x51,
+    0xbb, 0x9c, 0xbb, 0xe4, 0x48, 0x8d, 0xbb, 0x04, 0x00, 0x72, 0x61, 0x6e, 0x72, 0x65, 0xe2, 0x28,
+    0x24, 0x02, 0xe3, 0x68, 0x44, 0xbb, 0x0a, 0x00, 0x06, 0x00, 0xf3, 0x28, 0xb6, 0xb9, 0x6e, 0x61,
+    0x72, 0xe2, 0x28, 0xb5, 0x62, 0x61, 0x72, 0x69, 0x65, 0xe2, 0x28, 0xc3, 0xb6, 0xee, 0x28, 0xa0,
+    0x8e, 0xed, 0xc8, 0x6a, 0xbb, 0xc0, 0x8a, 0x39, 0x00, 0xe9, 0xb9, 0x41, 0xb0, 0x0c, 0x00, 0xef,
+    0x48, 0x04, 0x00, 0x94, 0x7c, 0xe3, 0x21, 0x01, 0xae, 0x68, 0x0b, 0x00, 0x06, 0x00, 0x6f, 0xb4,
+    0x65, 0xf4, 0x28, 0x3a, 0x85, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0x6c, 0x61, 0x75, 0x74, 0x72, 0x69,
+    0x76, 0x2e, 0x65, 0x6c, 0x61, 0x63, 0x73, 0x2e, 0xf3, 0x28, 0x5a, 0x1c, 0xe5, 0x48, 0x04, 0x00,
+    0xe5, 0x68, 0xe7, 0x20, 0x01, 0xe1, 0x28, 0x3d, 0x5f, 0xec, 0x88, 0x0c, 0x00, 0xa6, 0xaf, 0x0c,
+    0xbb, 0x08, 0x00, 0xf3, 0x28, 0x98, 0xba, 0x61, 0xf4, 0x48, 0x87, 0xb8, 0x54, 0xae, 0xe9, 0xe8,
+    0x08, 0x0f, 0x1d, 0x89, 0x56, 0x25, 0x00, 0x1f, 0x00, 0x14, 0x00, 0xaf, 0x82, 0xe0, 0x5d, 0x10,
+    0x00, 0xf8, 0x28, 0x81, 0xa6, 0xf2, 0x48, 0xdb, 0xba, 0x04, 0x00, 0x65, 0xf5, 0x28, 0x1b, 0xba,
+    0x6f, 0x72, 0xe5, 0x28, 0x98, 0x42, 0xee, 0x28, 0xd1, 0x1f, 0xe8, 0x28, 0xe2, 0xa4, 0xe7, 0xc8,
+    0x27, 0x00, 0x21, 0x00, 0x19, 0x00, 0x10, 0x00, 0x0c, 0x00, 0xcf, 0xba, 0xf0, 0x28, 0x48, 0xba,
+    0x6f, 0xec, 0x69, 0x9d, 0xba, 0x49, 0xb9, 0xfd, 0xb8, 0xee, 0x68, 0xa7, 0xba, 0x7d, 0xba, 0xb7,
+    0xba, 0xec, 0x48, 0x2b, 0xba, 0x1e, 0xb7, 0xe5, 0x48, 0x04, 0x00, 0x25, 0xba, 0xec, 0x21, 0x01,
+    0xae, 0xe8, 0x10, 0x58, 0x00, 0xdb, 0x56, 0xc0, 0xa3, 0x50, 0x00, 0x4c, 0x00, 0x48, 0x00, 0x7e,
+    0xb3, 0x44, 0x00, 0x4a, 0xba, 0xbc, 0xb9, 0x40, 0x00, 0x38, 0x00, 0x32, 0x00, 0x2c, 0x00, 0x24,
+    0x00, 0x20, 0x00, 0xf4, 0x28, 0x75, 0xba, 0xf3, 0x68, 0x3f, 0xba, 0x71, 0xba, 0x61, 0xba, 0xf2,
+    0x48, 0xf5, 0xb9, 0x59, 0xba, 0xf0, 0x48, 0x76, 0xba, 0xe7, 0xb9, 0xef, 0x68, 0x23, 0xba, 0x4d,
+    0xba, 0x6e, 0xba, 0xee, 0x28, 0x45, 0xba, 0xea, 0x28, 0x41, 0xba, 0xe7, 0x28, 0x4d, 0xba, 0xe6,
+    0x28, 0xa9, 0xb7, 0xe5, 0x68, 0x3d, 0xba, 0xd1, 0xb9, 0xc9, 0xb9, 0xe1, 0x68, 0x23, 0xba, 0x3d,
+    0xba, 0xc9, 0xb9, 0xe6, 0x88, 0x0e, 0x00, 0x2c, 0xb6, 0x6a, 0xa4, 0x08, 0x00, 0xee, 0x48, 0xf9,
+    0xb9, 0xe8, 0xb8, 0xe4, 0x28, 0xaf, 0xb3, 0xe5, 0xa8, 0x22, 0x00, 0x1b, 0x00, 0xd4, 0x9f, 0x12,
+    0x00, 0x0a, 0x00, 0x72, 0x64, 0x6e, 0x61, 0xef, 0x28, 0x38, 0x6b, 0x6c, 0x6c, 0x69, 0x76, 0x6e,
+    0xe9, 0x28, 0xcf, 0xaa, 0xe6, 0x20, 0x01, 0xe9, 0x28, 0xce, 0x9b, 0x64, 0x6e, 0x61, 0x72, 0x67,
+    0xe1, 0x20, 0x01, 0xee, 0x20, 0x01, 0xe9, 0x28, 0xdd, 0x88, 0xe4, 0x88, 0xf4, 0xb6, 0xe4, 0x94,
+    0x08, 0x00, 0xe5, 0xa9, 0xee, 0x48, 0x76, 0xb8, 0xa1, 0xb8, 0xe3, 0xa8, 0xc9, 0xb6, 0x03, 0x9d,
+    0x0e, 0x00, 0x94, 0x81, 0x0a, 0x00, 0xf4, 0x29, 0xa0, 0xb9, 0xea, 0x28, 0x52, 0xb9, 0xe2, 0x89,
+    0x51, 0xb3, 0x90, 0xb3, 0x84, 0xb1, 0x11, 0x59, 0xe1, 0xe8, 0x0a, 0x6d, 0x00, 0x63, 0x00, 0x58,
+    0x00, 0x51, 0x00, 0x41, 0x00, 0x34, 0x00, 0x60, 0xb5, 0x21, 0x00, 0x1c, 0x00, 0x14, 0x00, 0x74,
+    0x73, 0x69, 0x76, 0xe1, 0x28, 0x71, 0xb8, 0x72, 0xe9, 0x28, 0x82, 0x97, 0xf0, 0x68, 0x0d, 0x00,
+    0xe4, 0x6b, 0x06, 0x00, 0x6d, 0xe1, 0x48, 0x1d, 0xb3, 0x17, 0xb9, 0xe1, 0x28, 0xd4, 0x06, 0xee,
+    0x40, 0x07, 0x02, 0x69, 0xf2, 0x28, 0x91, 0x87, 0xe5, 0x28, 0x7c, 0xa3, 0xe9, 0x40, 0x08, 0x02,
+    0x72, 0x61, 0xed, 0x28, 0x9a, 0x6a, 0x6e, 0x61, 0xe9, 0x28, 0x33, 0xb9, 0xe7, 0x20, 0x01, 0xee,
+    0x28, 0x1c, 0x68, 0x64, 0x69, 0x63, 0xe5, 0x20, 0x01, 0x72, 0xe1, 0x28, 0x06, 0xa2, 0x63, 0x6e,
+    0x6f, 0xe7, 0x20, 0x01, 0xef, 0x28, 0xa9, 0xb5, 0xe2, 0x40, 0x09, 0x02, 0x69, 0x74, 0x69, 0xf2,
+    0x28, 0x3c, 0xb7, 0xe1, 0x48, 0x04, 0x00, 0x35, 0xb7, 0x63, 0xef, 0x28, 0x55, 0x4a, 0x32, 0xb1,
+    0x28, 0xff, 0xb8, 0xe1, 0xe9, 0x08, 0x28, 0x00, 0xef, 0x99, 0x1a, 0xb9, 0x2c, 0xb9, 0x22, 0x00,
+    0xd2, 0x67, 0x15, 0x00, 0x10, 0x00, 0x75, 0xe7, 0x28, 0xa8, 0xb2, 0xf4, 0x48, 0xb7, 0xa4, 0x04,
+    0x00, 0xf3, 0x21, 0x01, 0xf5, 0x28, 0xfc, 0xb8, 0x65, 0x79, 0xe4, 0x28, 0xd8, 0xa1, 0xae, 0xe8,
+    0x0a, 0x2b, 0x00, 0x13, 0xb6, 0x0b, 0xb9, 0x20, 0x00, 0x66, 0xa3, 0x35, 0x7d, 0xa3, 0x84, 0x14,
+    0x00, 0xd1, 0xb8, 0xc9, 0xb8, 0xf4, 0x48, 0x04, 0x00, 0x1c, 0xb7, 0xe5, 0x48, 0xd3, 0xb8, 0xd8,
+    0xb8, 0xec, 0x48, 0x04, 0x00, 0xe4, 0xb8, 0x61, 0xf5, 0x28, 0x18, 0x34, 0xe1, 0x48, 0x03, 0x51,
+    0x04, 0x00, 0x73, 0xe1, 0x20, 0x01, 0xee, 0x28, 0x93, 0xb3, 0xf1, 0xa8, 0x0e, 0x00, 0x94, 0xb8,
+    0x0a, 0x00, 0xce, 0xb8, 0xa5, 0xa9, 0xe9, 0x29, 0x6c, 0x9b, 0xe1, 0x21, 0x01, 0x33, 0x61, 0xb9,
+    0x28, 0x0a, 0x55, 0xf0, 0xe8, 0x0f, 0xd0, 0x34, 0xcc, 0x34, 0xb8, 0x34, 0xa5, 0x34, 0xb3, 0x01,
+    0xa2, 0x01, 0x9c, 0x01, 0x90, 0x01, 0x8c, 0x01, 0x4c, 0x01, 0x5a, 0x00, 0x53, 0x00, 0x2b, 0x00,
+    0x27, 0x00, 0x1e, 0x00, 0x78, 0x65, 0x63, 0x65, 0x34, 0xe9, 0x28, 0x6a, 0xb9, 0xf6, 0x28, 0x78,
+    0xb8, 0xf5, 0x60, 0x22, 0x1d, 0x03, 0x6f, 0x72, 0xe7, 0x81, 0x12, 0x0e, 0x09, 0x04, 0x6e, 0xe1,
+    0x28, 0x66, 0x59, 0x6b, 0xef, 0x28, 0x9b, 0xa9, 0xe3, 0x28, 0x67, 0xb7, 0xae, 0x28, 0x46, 0x7d,
+    0x6c, 0xec, 0x28, 0x4b, 0xae, 0xe5, 0x28, 0xed, 0x2c, 0x72, 0xe1, 0x48, 0x71, 0xb8, 0x05, 0xb7,
+    0x70, 0xe1, 0x21, 0x01, 0xae, 0xe0, 0x0d, 0xe3, 0xdd, 0xd7, 0x8c, 0x85, 0x77, 0x67, 0x5d, 0x43,
+    0x3e, 0x2b, 0x14, 0x0d, 0x79, 0x66, 0x69, 0xec, 0x28, 0x03, 0xb6, 0xf4, 0x60, 0x0f, 0x09, 0x03,
+    0x78, 0x65, 0xee, 0x28, 0x8c, 0xb5, 0xe9, 0x48, 0x41, 0x4f, 0x9c, 0x73, 0x65, 0x67, 0xe5, 0x28,
+    0x8c, 0xa9, 0xf2, 0x48, 0x0c, 0x77, 0x04, 0x00, 0xe5, 0x48, 0xa9, 0xb6, 0x04, 0x00, 0x70, 0x6f,
+    0x6c, 0xe5, 0x28, 0x13, 0x7a, 0x70, 0xef, 0x28, 0x87, 0xb7, 0xee, 0x40, 0x0a, 0x02, 0x75, 0xf2,
+    0x21, 0x01, 0xae, 0x28, 0x19, 0xb8, 0x61, 0x65, 0x63, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x67, 0x69,
+    0xe4, 0x28, 0x70, 0xb7, 0x6d, 0x61, 0x65, 0x72, 0x64, 0x65, 0xf0, 0x28, 0x3c, 0x7e, 0x6c, 0xe5,
+    0x40, 0x09, 0x02, 0x6e, 0x61, 0x70, 0xf9, 0x28, 0x61, 0x6a, 0xe3, 0x28, 0x82, 0x96, 0xeb, 0x40,
+    0x02, 0x5a, 0x6e, 0x61, 0x6c, 0x66, 0x68, 0x74, 0xf2, 0x28, 0x18, 0x79, 0x69, 0x6c, 0x72, 0xe5,
+    0x28, 0xf4, 0x6f, 0xe5, 0xa0, 0x3e, 0x27, 0x19, 0x10, 0x05, 0x76, 0x69, 0x72, 0x64, 0x68, 0x73,
+    0x61, 0xec, 0x28, 0x59, 0x7b, 0x74, 0x75, 0x70, 0x6d, 0x6f, 0xe3, 0x28, 0xaa, 0x9f, 0x6e, 0x69,
+    0x6c, 0xee, 0x48, 0x80, 0x9f, 0x04, 0x00, 0x6f, 0xeb, 0x28, 0x39, 0x88, 0x6b, 0x61, 0x6c, 0x66,
+    0x77, 0x6f, 0x6e, 0xf3, 0x21, 0x01, 0x2e, 0x6b, 0x6e, 0x69, 0x6c, 0xe5, 0x20, 0x01, 0x74, 0xe1,
+    0x28, 0xb8, 0xa7, 0x67, 0x61, 0x74, 0x73, 0xeb, 0x20, 0x01, 0xf2, 0x28, 0xa7, 0x96, 0x62, 0x65,
+    0xf7, 0x29, 0x86, 0xa2, 0xe1, 0x48, 0x4a, 0x4f, 0xee, 0x5b, 0x30, 0x6d, 0x72, 0x6f, 0xe6, 0x28,
+    0x10, 0x73, 0xef, 0xa8, 0x2c, 0xb7, 0x25, 0x00, 0x20, 0x00, 0x5b, 0xb7, 0x0a, 0x00, 0xf4, 0x21,
+    0x01, 0xae, 0x40, 0x08, 0x02, 0x73, 0x6e, 0xe4, 0x28, 0x93, 0x92, 0x6c, 0x6c, 0xe4, 0x20, 0x01,
+    0xf4, 0x28, 0x33, 0xb7, 0x6c, 0xee, 0x28, 0x81, 0x92, 0xe8, 0x40, 0x13, 0x02, 0xf3, 0x21, 0x01,
+    0xae, 0x68, 0xb8, 0xac, 0x06, 0x00, 0x71, 0xb6, 0x78, 0x69, 0xec, 0x28, 0x00, 0x9f, 0xf0, 0x28,
+    0x04, 0x8c, 0xee, 0x2a, 0x86, 0xb4, 0xed, 0x69, 0x06, 0x00, 0xb1, 0xb4, 0xac, 0xb0, 0xae, 0x28,
+    0xa6, 0x69, 0xec, 0x48, 0x16, 0x9d, 0xf3, 0xb5, 0xeb, 0x21, 0x01, 0xae, 0xc8, 0x01, 0xa7, 0x0f,
+    0xb7, 0xff, 0xb6, 0x33, 0x58, 0xd5, 0xb6, 0xcd, 0xb6, 0xea, 0x21, 0x01, 0xae, 0xe8, 0x16, 0x8a,
+    0x1a, 0x86, 0x1a, 0x4d, 0x1a, 0xd5, 0x19, 0x53, 0x16, 0x33, 0x16, 0x0c, 0x16, 0xd1, 0x0c, 0x7d,
+    0x0c, 0x59, 0x0c, 0x3a, 0x0c, 0xf1, 0x0b, 0xb8, 0x02, 0x83, 0x02, 0x28, 0x02, 0xef, 0x01, 0xaa,
+    0x01, 0x8a, 0x00, 0x80, 0x00, 0x7a, 0x00, 0x32, 0x00, 0x2c, 0x00, 0x7a, 0x37, 0xb2, 0x28, 0x0f,
+    0x1a, 0xf9, 0xe8, 0x09, 0x3e, 0x00, 0x3a, 0x00, 0x34, 0x00, 0x2f, 0x00, 0x92, 0xb5, 0x28, 0x00,
+    0x20, 0x00, 0x16, 0x00, 0x12, 0x00, 0xf6, 0x28, 0xaf, 0x9c, 0x75, 0x36, 0x64, 0x32, 0x37, 0x73,
+    0xf2, 0x28, 0x6d, 0x0c, 0x72, 0x67, 0xee, 0x48, 0xb5, 0xb6, 0xd1, 0x5c, 0x70, 0xf0, 0x48, 0x75,
+    0x8b, 0xe9, 0x68, 0x6d, 0xef, 0x28, 0xea, 0x84, 0xec, 0x48, 0x7b, 0xb5, 0x99, 0x19, 0xeb, 0x28,
+    0x61, 0x62, 0x61, 0x64, 0x79, 0xee, 0x28, 0xef, 0x3d, 0x78, 0x35, 0xf9, 0x28, 0x45, 0x32, 0x77,
+    0x6f, 0x6e, 0x73, 0x65, 0x74, 0xe9, 0x28, 0xcb, 0xa6, 0xf5, 0xc8, 0x17, 0x01, 0x2c, 0x00, 0x1c,
+    0x00, 0x18, 0x00, 0x11, 0x00, 0x0c, 0x00, 0x79, 0xee, 0x28, 0x9a, 0xb2, 0x73, 0x74, 0x6f, 0xeb,
+    0x28, 0xae, 0x3f, 0xf0, 0x28, 0x8f, 0xb2, 0xe8, 0x48, 0x49, 0xb6, 0x04, 0x00, 0x73, 0x75, 0x79,
+    0x6b, 0x61, 0x74, 0xe9, 0x28, 0x05, 0x19, 0x66, 0x69, 0xe7, 0x21, 0x01, 0xae, 0xc0, 0x8a, 0x7e,
+    0x45, 0x40, 0x21, 0x06, 0xf5, 0x40, 0x15, 0x02, 0xf3, 0x48, 0x19, 0x65, 0x04, 0x00, 0xf4, 0x40,
+    0x06, 0x02, 0xef, 0x28, 0xd1, 0xb1, 0x61, 0xed, 0x28, 0x1b, 0x27, 0xe6, 0x28, 0x65, 0xa1, 0xef,
+    0xc8, 0x19, 0x00, 0xc9, 0x54, 0x13, 0x00, 0x35, 0x9a, 0x89, 0x64, 0x0c, 0x00, 0x73, 0x69, 0x68,
+    0xe3, 0x28, 0xe2, 0x8a, 0x6d, 0x61, 0xeb, 0x28, 0x54, 0x2d, 0xe4, 0x28, 0xc1, 0xb5, 0x6e, 0xe1,
+    0x28, 0x96, 0x1a, 0xe9, 0xc8, 0x31, 0x00, 0x1f, 0x00, 0x17, 0x00, 0x0c, 0x00, 0x33, 0x2f, 0xe0,
+    0x24, 0xed, 0x48, 0x04, 0x00, 0xe7, 0x2c, 0x61, 0xee, 0x28, 0x5e, 0x2b, 0xeb, 0x68, 0xad, 0x14,
+    0x9d, 0xb0, 0x85, 0xb5, 0x68, 0xe3, 0x40, 0x0a, 0x02, 0x75, 0xef, 0x20, 0x01, 0xee, 0x28, 0x25,
+    0x95, 0x61, 0xf0, 0x28, 0xcf, 0xa8, 0x67, 0x6f, 0xe8, 0x28, 0xb7, 0x30, 0xe5, 0x40, 0x06, 0x02,
+    0xf5, 0x28, 0x88, 0x2c, 0xeb, 0x28, 0x88, 0x1d, 0xe1, 0xe8, 0x07, 0x51, 0x00, 0x4d, 0x00, 0x47,
+    0x00, 0xc5, 0x94, 0x32, 0x00, 0x29, 0x00, 0x0e, 0x00, 0x77, 0xe1, 0x40, 0x0b, 0x02, 0x6b, 0x61,
+    0x72, 0x69, 0x68, 0xf3, 0x29, 0x01, 0x2e, 0xe7, 0x40, 0x07, 0x02, 0x75, 0xf3, 0x28, 0x96, 0x07,
+    0xe9, 0x28, 0xc3, 0x42, 0x74, 0x61, 0x67, 0xe1, 0x48, 0x40, 0x52, 0x0e, 0x55, 0x72, 0x61, 0x68,
+    0xe1, 0x48, 0x04, 0x00, 0xe3, 0x7b, 0x67, 0xe9, 0x48, 0x34, 0x4d, 0x04, 0x00, 0x6d, 0xe1, 0x28,
+    0xdb, 0x29, 0xed, 0x48, 0x64, 0x21, 0x4d, 0x0c, 0xeb, 0x28, 0x86, 0x2f, 0xe4, 0x48, 0x57, 0x2d,
+    0x36, 0x8a, 0x34, 0x72, 0x76, 0xf0, 0x28, 0x1a, 0xb6, 0xf4, 0xc8, 0x32, 0x00, 0x25, 0x00, 0x1c,
+    0x00, 0x23, 0xb5, 0x17, 0x00, 0x0c, 0x00, 0xf5, 0x48, 0x27, 0xb5, 0x04, 0x00, 0x6f, 0xec, 0x28,
+    0x35, 0x5f, 0x73, 0xe9, 0x28, 0x9b, 0x1d, 0x6e, 0x65, 0x74, 0x6e, 0x6f, 0xe3, 0x28, 0x66, 0x16,
+    0xe5, 0x40, 0x07, 0x02, 0x76, 0xec, 0x28, 0xca, 0x93, 0xf2, 0x28, 0xc5, 0x9a, 0xe1, 0x40, 0x08,
+    0x02, 0x6f, 0x62, 0xe7, 0x28, 0xfc, 0xad, 0x63, 0x79, 0x73, 0xf3, 0x28, 0x48, 0xb1, 0xf3, 0xc8,
+    0x32, 0x00, 0x1d, 0x5d, 0x2c, 0x00, 0x23, 0x00, 0x12, 0x00, 0x0c, 0x00, 0x78, 0x76, 0xf0, 0x28,
+    0x16, 0xb5, 0xf5, 0x68, 0x0b, 0x00, 0x06, 0x00, 0x97, 0x93, 0x72, 0xf5, 0x28, 0x39, 0xab, 0xe2,
+    0x28, 0x53, 0xb2, 0x73, 0x69, 0x6b, 0x68, 0x63, 0xee, 0x28, 0xe5, 0x90, 0xf0, 0x48, 0xe4, 0x8a,
+    0x54, 0x68, 0x39, 0xee, 0x28, 0x08, 0x8d, 0xf2, 0xc8, 0x52, 0x00, 0x48, 0x00, 0x17, 0x00, 0x97,
+    0xb4, 0x13, 0x00, 0x0c, 0x00, 0x75, 0x66, 0x65, 0xeb, 0x28, 0xe9, 0xaa, 0xef, 0x29, 0x31, 0xb4,
+    0xe5, 0xa8, 0x25, 0x00, 0xa6, 0xb3, 0x21, 0x00, 0x14, 0x00, 0x0a, 0x00, 0xf4, 0x48, 0x04, 0x00,
+    0xd0, 0x4b, 0xe1, 0x28, 0x45, 0x54, 0x70, 0xf0, 0x68, 0x2a, 0xb4, 0x06, 0x00, 0xf9, 0xb1, 0xe9,
+    0x28, 0x8c, 0x79, 0xe9, 0x28, 0xd9, 0xa7, 0xe4, 0x48, 0x7d, 0x87, 0x04, 0x00, 0xf7, 0x28, 0x8f,
+    0x62, 0x61, 0x74, 0x73, 0x65, 0x6c, 0x74, 0xf4, 0x28, 0x0a, 0xa8, 0x32, 0x78, 0x72, 0xef, 0x28,
+    0xc3, 0x95, 0xf0, 0x40, 0x2f, 0x02, 0xef, 0x60, 0x19, 0x0e, 0x03, 0x72, 0xe4, 0x48, 0x39, 0x4c,
+    0x04, 0x00, 0xee, 0x28, 0xbb, 0x64, 0xf0, 0x48, 0x08, 0x0a, 0x04, 0x00, 0x79, 0xe4, 0x28, 0x4a,
+    0x6c, 0x68, 0xf3, 0x68, 0x06, 0x9a, 0x0a, 0x00, 0x06, 0x00, 0xf9, 0x28, 0x36, 0xa7, 0x69, 0xe9,
+    0x28, 0x19, 0x2b, 0xe1, 0x28, 0x87, 0xaf, 0xef, 0xe8, 0x10, 0x2e, 0x09, 0x27, 0x09, 0x23, 0x09,
+    0x38, 0xb4, 0xc6, 0x05, 0xad, 0x04, 0xa9, 0x04, 0xa3, 0x04, 0xbe, 0x70, 0x39, 0x7f, 0xe7, 0x02,
+    0xdf, 0x02, 0xd7, 0x02, 0x90, 0x01, 0x8b, 0x01, 0x20, 0x00, 0x79, 0x6b, 0x6f, 0xf4, 0x21, 0x01,
+    0xae, 0xa0, 0xb6, 0x9d, 0x62, 0x16, 0x05, 0xf5, 0x68, 0x0b, 0x00, 0xb7, 0x23, 0x06, 0x00, 0x6b,
+    0xf5, 0x28, 0x6f, 0x24, 0xe6, 0x28, 0x08, 0x62, 0xef, 0xe8, 0x07, 0x45, 0x00, 0x41, 0x00, 0x2c,
+    0x00, 0x26, 0x00, 0x13, 0x00, 0x9c, 0x8b, 0x0e, 0x00, 0x79, 0xeb, 0x28, 0x33, 0x1b, 0xf4, 0x68,
+    0x06, 0x00, 0x81, 0x9f, 0x3a, 0x99, 0xe1, 0x48, 0x04, 0x00, 0xfe, 0x97, 0x6d, 0xe1, 0x28, 0x56,
+    0x2b, 0x72, 0x75, 0xe7, 0x28, 0xdb, 0xb0, 0xee, 0x68, 0xde, 0x23, 0x0a, 0x00, 0x06, 0x00, 0x75,
+    0xf2, 0x20, 0xd6, 0x69, 0xe8, 0x21, 0x01, 0x73, 0xe1, 0x28, 0xae, 0xa8, 0xea, 0x28, 0xc0, 0x1b,
+    0xe8, 0x28, 0x36, 0x29, 0xe9, 0xa0, 0x33, 0x2f, 0x1a, 0x0b, 0x05, 0x6d, 0x61, 0xee, 0x28, 0xc7,
+    0x25, 0xea, 0x40, 0x06, 0x02, 0xef, 0x28, 0xa7, 0x1b, 0x6e, 0x75, 0x62, 0xf5, 0x28, 0x7d, 0x2c,
+    0xe8, 0x40, 0x08, 0x02, 0x73, 0x61, 0xe2, 0x28, 0x37, 0x21, 0x63, 0xe1, 0x48, 0xf6, 0x82, 0x04,
+    0x00, 0xf4, 0x28, 0x3b, 0x20, 0xe7, 0x28, 0xec, 0x28, 0x65, 0x6e, 0xe1, 0x28, 0x5c, 0x0d, 0xe5,
+    0x88, 0x88, 0x21, 0x14, 0x00, 0x08, 0x00, 0xe7, 0x05, 0xed, 0x48, 0x77, 0xb3, 0x04, 0x00, 0x75,
+    0x72, 0xf5, 0x28, 0x0b, 0x1a, 0xe4, 0x20, 0x53, 0xe1, 0xe0, 0x08, 0x97, 0x8b, 0x53, 0x33, 0x2f,
+    0x29, 0x14, 0x08, 0xf9, 0x48, 0x04, 0x00, 0x00, 0x1f, 0x61, 0x67, 0xe1, 0x28, 0x79, 0x58, 0x77,
+    0xe1, 0x40, 0x08, 0x02, 0xeb, 0x48, 0xc8, 0x4d, 0xf9, 0x28, 0xe7, 0x48, 0xba, 0x02, 0x04, 0x00,
+    0xef, 0x28, 0x03, 0xb3, 0xf4, 0x48, 0xbc, 0xae, 0x3c, 0xb3, 0xf3, 0x28, 0x5f, 0x0f, 0xf2, 0x60,
+    0x0d, 0x07, 0x03, 0xf5, 0x28, 0x52, 0x8c, 0x69, 0x61, 0xe4, 0x28, 0x6f, 0x98, 0xe1, 0x40, 0x08,
+    0x02, 0x77, 0x61, 0xf3, 0x28, 0xe6, 0x11, 0xe8, 0x20, 0x01, 0xef, 0x28, 0x80, 0x09, 0xed, 0x40,
+    0x20, 0x02, 0xe9, 0x48, 0x04, 0x00, 0x77, 0x89, 0x68, 0xf3, 0x88, 0x11, 0x00, 0x0d, 0x00, 0x33,
+    0x02, 0x08, 0x00, 0x75, 0xfa, 0x28, 0xfc, 0x2b, 0xe9, 0x28, 0x9c, 0x52, 0xe1, 0x28, 0xf4, 0x03,
+    0xe1, 0x40, 0x10, 0x02, 0x79, 0x61, 0x72, 0x75, 0x6d, 0x69, 0x68, 0x73, 0xe1, 0x48, 0x54, 0x2b,
+    0xca, 0xa7, 0xf4, 0x29, 0x3c, 0x20, 0xeb, 0x48, 0xa6, 0x1a, 0x04, 0x00, 0x69, 0x68, 0xf3, 0x28,
+    0x50, 0x2e, 0xe4, 0x48, 0x04, 0x00, 0xdd, 0x1e, 0xe9, 0x48, 0x04, 0x00, 0xa2, 0xac, 0xe8, 0x20,
+    0x01, 0xe3, 0x28, 0xb3, 0xa5, 0x77, 0xf4, 0x28, 0x2a, 0xab, 0x74, 0xef, 0x40, 0xc0, 0x02, 0x79,
+    0xeb, 0x21, 0x01, 0xae, 0xc0, 0x72, 0x5d, 0x4d, 0x48, 0x16, 0x06, 0xf5, 0x40, 0x08, 0x02, 0xfa,
+    0x48, 0xe3, 0x28, 0x21, 0xae, 0x72, 0x75, 0xfa, 0x28, 0x68, 0x94, 0xef, 0xa8, 0x2c, 0x00, 0x28,
+    0x00, 0xd3, 0x2d, 0x1d, 0x00, 0x0a, 0x00, 0xf9, 0x68, 0x79, 0x20, 0x06, 0x00, 0x48, 0xa3, 0x6b,
+    0xe1, 0x48, 0x04, 0x00, 0xfc, 0xb1, 0xeb, 0x28, 0x78, 0x1b, 0x72, 0x69, 0x68, 0x73, 0x61, 0x6d,
+    0x61, 0xf9, 0x28, 0xa6, 0x2c, 0xeb, 0x28, 0x54, 0xa7, 0x67, 0xee, 0x20, 0x6c, 0x6e, 0xe1, 0x28,
+    0x08, 0x22, 0xe9, 0x68, 0xf0, 0x0f, 0x06, 0x00, 0x98, 0x2c, 0x6b, 0x61, 0x7a, 0x61, 0xed, 0x28,
+    0xf8, 0x2e, 0xe5, 0x68, 0x06, 0x00, 0xbf, 0x83, 0x6f, 0xb0, 0x62, 0xe1, 0x48, 0x04, 0x00, 0xdd,
+    0x18, 0x6e, 0x61, 0xf4, 0x29, 0x23, 0x1a, 0xe1, 0xc0, 0x3b, 0x2a, 0x1b, 0x14, 0x0c, 0x06, 0xf4,
+    0x48, 0x01, 0x14, 0xb1, 0xad, 0x72, 0x61, 0x77, 0x61, 0xf4, 0x28, 0xb6, 0x0f, 0x6e, 0x69, 0x68,
+    0xf3, 0x28, 0xd4, 0x4e, 0x6d, 0x61, 0x79, 0xe9, 0x48, 0x04, 0x00, 0x0d, 0x29, 0xe8, 0x48, 0xae,
+    0x27, 0x7d, 0x2a, 0xeb, 0x68, 0x4d, 0x1a, 0x0b, 0x00, 0x06, 0x00, 0x75, 0xfa, 0x28, 0x56, 0x91,
+    0xef, 0x28, 0x90, 0x14, 0x62, 0xed, 0x20, 0x01, 0x61, 0xf4, 0x28, 0xdd, 0x19, 0x6d, 0x61, 0x6d,
+    0x75, 0xeb, 0x21, 0x01, 0xae, 0xa0, 0x5e, 0x57, 0x3c, 0x0b, 0x05, 0xf5, 0x48, 0x49, 0x0a, 0x35,
+    0x13, 0xef, 0xa8, 0x5b, 0x4c, 0x28, 0x00, 0xb6, 0xb0, 0x0e, 0x00, 0x0a, 0x00, 0xf9, 0x28, 0xcf,
+    0x5f, 0xf4, 0x68, 0x83, 0x4e, 0x11, 0x00, 0x06, 0x00, 0xf5, 0x21, 0x01, 0x6b, 0xef, 0x20, 0x01,
+    0xf9, 0x28, 0x7e, 0xb1, 0x6f, 0xed, 0x48, 0xac, 0x28, 0x98, 0xab, 0x72, 0x69, 0x68, 0xf3, 0x28,
+    0xc0, 0x12, 0xe9, 0x80, 0x14, 0x0e, 0x07, 0x04, 0xf2, 0x20, 0xc3, 0x6e, 0x75, 0x67, 0xef, 0x29,
+    0xd9, 0x2b, 0xeb, 0x48, 0xfd, 0x0e, 0xee, 0xae, 0x68, 0xe3, 0x28, 0xf6, 0x25, 0x65, 0x6e, 0x75,
+    0xe6, 0x28, 0x85, 0xb1, 0xe1, 0x88, 0x74, 0x01, 0x16, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x74, 0xe1,
+    0x28, 0xbb, 0x2b, 0x73, 0x75, 0x6b, 0x61, 0x6d, 0xe1, 0x29, 0xdb, 0x2a, 0x72, 0xe1, 0x28, 0x24,
+    0x16, 0x72, 0x6f, 0x70, 0x70, 0xe1, 0x28, 0x69, 0x10, 0xef, 0x68, 0x45, 0xb1, 0x5f, 0xb1, 0xd4,
+    0x97, 0x6e, 0x61, 0x67, 0x61, 0xee, 0x21, 0x01, 0xae, 0xc0, 0xe7, 0xd4, 0x64, 0x53, 0x1c, 0x06,
+    0xf5, 0x40, 0x09, 0x02, 0x73, 0x74, 0x61, 0xed, 0x28, 0x31, 0x2f, 0xeb, 0x48, 0x92, 0xad, 0x04,
+    0x00, 0x6f, 0xe8, 0x28, 0x45, 0x26, 0xef, 0xa8, 0x31, 0x00, 0x16, 0x00, 0x11, 0x00, 0x0a, 0x00,
+    0x29, 0x20, 0x73, 0xe9, 0x48, 0x82, 0xaa, 0xb0, 0xac, 0x72, 0xef, 0x28, 0x6b, 0x96, 0xee, 0x68,
+    0x13, 0x00, 0x06, 0x00, 0xc5, 0x01, 0xe9, 0x48, 0x57, 0xac, 0x04, 0x00, 0xed, 0x20, 0x01, 0xf5,
+    0x28, 0x95, 0x96, 0xe1, 0x48, 0x62, 0xaa, 0x83, 0x79, 0xe8, 0x28, 0x95, 0x1b, 0xee, 0x48, 0xfa,
+    0x15, 0x04, 0x00, 0x65, 0x73, 0x6e, 0x6f, 0x61, 0x77, 0x61, 0xfa, 0x28, 0x63, 0xb0, 0xe9, 0xa0,
+    0x6a, 0x46, 0x22, 0x16, 0x05, 0xf2, 0x68, 0x77, 0x23, 0x0a, 0x00, 0x06, 0x00, 0xef, 0x28, 0x24,
+    0x17, 0x69, 0xea, 0x28, 0xc9, 0x0f, 0xed, 0x68, 0x39, 0x1b, 0x73, 0x28, 0x06, 0x00, 0xef, 0x29,
+    0xdb, 0xb0, 0xeb, 0x88, 0x16, 0x00, 0x0f, 0x00, 0x99, 0x07, 0x08, 0x00, 0x75, 0x7a, 0x69, 0xe8,
+    0x28, 0xd8, 0x48, 0x69, 0xe1, 0x48, 0x4f, 0x2a, 0xf3, 0x2a, 0xe1, 0x68, 0x00, 0xad, 0x06, 0x00,
+    0xe6, 0xae, 0xed, 0x28, 0xe5, 0x2a, 0xe8, 0x68, 0x7d, 0x2b, 0x0c, 0x00, 0x06, 0x00, 0x73, 0x75,
+    0xeb, 0x28, 0x88, 0x2b, 0xe3, 0x40, 0x06, 0x02, 0xf5, 0x28, 0xf3, 0x19, 0xe1, 0x21, 0x01, 0x6d,
+    0xef, 0x21, 0x01, 0xee, 0x20, 0x01, 0xe1, 0x28, 0xd8, 0x25, 0xe7, 0x28, 0x49, 0x29, 0xe5, 0x68,
+    0x71, 0x2b, 0x0b, 0x00, 0x06, 0x00, 0x73, 0xf5, 0x28, 0x09, 0x1a, 0x6e, 0x61, 0xe7, 0x28, 0x7a,
+    0x1e, 0xe1, 0xe8, 0x0a, 0xc5, 0x00, 0xb1, 0x00, 0x92, 0x00, 0x72, 0x00, 0x64, 0x00, 0x5a, 0x00,
+    0x97, 0x7b, 0x4d, 0x00, 0x1b, 0x00, 0x14, 0x00, 0x79, 0xe1, 0x48, 0xc4, 0xa9, 0xe3, 0x27, 0xf7,
+    0x60, 0x16, 0x0f, 0x03, 0xf5, 0x40, 0x06, 0x02, 0xf3, 0x29, 0xb3, 0x2b, 0xeb, 0x28, 0xb4, 0x63,
+    0x6f, 0x6e, 0x69, 0xed, 0x29, 0x74, 0x2a, 0xe1, 0x60, 0x0c, 0x08, 0x03, 0x7a, 0xe9, 0x28, 0x4c,
+    0x10, 0xeb, 0x28, 0x94, 0x2a, 0xe7, 0x48, 0x04, 0x00, 0x2b, 0xb0, 0xe1, 0x48, 0x9b, 0x78, 0x08,
+    0xb0, 0xf4, 0x48, 0x04, 0x00, 0xbf, 0x22, 0xe1, 0x20, 0x01, 0xe7, 0x28, 0xca, 0x4c, 0xf2, 0x48,
+    0x3a, 0x89, 0x04, 0x00, 0xf5, 0x28, 0xf7, 0x2a, 0xee, 0x48, 0x04, 0x00, 0x3e, 0x26, 0xe9, 0x21,
+    0x01, 0x68, 0xf3, 0x28, 0x19, 0x20, 0xed, 0x68, 0x17, 0x00, 0x06, 0x00, 0x01, 0x25, 0xe9, 0x40,
+    0x06, 0x02, 0xea, 0x28, 0x28, 0x26, 0x68, 0x73, 0x75, 0x6b, 0x75, 0xe6, 0x28, 0x20, 0x12, 0x61,
+    0xf9, 0x48, 0xa3, 0x28, 0x1a, 0x26, 0xeb, 0x60, 0x0d, 0x07, 0x03, 0xef, 0x28, 0xb4, 0x10, 0x69,
+    0x68, 0xf3, 0x28, 0x3f, 0x63, 0xe1, 0x48, 0x04, 0x00, 0x4b, 0x84, 0xf3, 0x48, 0x68, 0xab, 0x04,
+    0x00, 0xf5, 0x28, 0x09, 0x85, 0xe4, 0x68, 0x0c, 0x00, 0x06, 0x00, 0xf5, 0x25, 0xe5, 0x48, 0xfd,
+    0x84, 0x03, 0xad, 0xe1, 0x48, 0xfb, 0xac, 0xf2, 0x25, 0xe2, 0x28, 0xbf, 0x14, 0x6b, 0x6f, 0xee,
+    0x28, 0x80, 0xa8, 0xe8, 0x28, 0x6f, 0x84, 0xe7, 0x49, 0x13, 0x01, 0x04, 0x00, 0x6f, 0x79, 0xe8,
+    0x21, 0x01, 0xae, 0xa0, 0xab, 0x4d, 0x3d, 0x0b, 0x05, 0xf5, 0x48, 0x3e, 0x1c, 0x54, 0x24, 0xef,
+    0xe8, 0x07, 0x28, 0x00, 0x24, 0x4f, 0x1b, 0x00, 0x17, 0x00, 0x0a, 0x2a, 0x12, 0x00, 0x0e, 0x00,
+    0xf9, 0x28, 0xbd, 0xab, 0x74, 0xef, 0x28, 0x45, 0xa9, 0xf2, 0x28, 0xaf, 0x21, 0xee, 0x68, 0x20,
+    0x03, 0x63, 0xaf, 0x06, 0x00, 0x75, 0xf3, 0x28, 0x4b, 0x2f, 0x67, 0x61, 0x73, 0xe1, 0x29, 0x19,
+    0x28, 0xee, 0x40, 0x09, 0x02, 0x65, 0x73, 0x6e, 0xef, 0x28, 0x96, 0x24, 0x61, 0xee, 0x28, 0x35,
+    0x84, 0xe9, 0xe8, 0x07, 0x30, 0x20, 0x4e, 0x00, 0x42, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x14, 0x00,
+    0x0e, 0x00, 0x72, 0x6f, 0xe7, 0x28, 0x8f, 0x28, 0xef, 0x28, 0x00, 0x9d, 0xed, 0x28, 0xc1, 0x1c,
+    0xeb, 0x40, 0x0c, 0x02, 0xe9, 0x48, 0x04, 0x00, 0x14, 0xaf, 0xe8, 0x28, 0x91, 0x7f, 0xe1, 0x60,
+    0x12, 0x07, 0x03, 0xf7, 0x28, 0x8f, 0x28, 0xf3, 0x48, 0x04, 0x00, 0x33, 0x28, 0x61, 0xe7, 0x28,
+    0xc2, 0x4c, 0xe7, 0x28, 0xc9, 0x05, 0xea, 0x48, 0x04, 0x00, 0x23, 0x16, 0x61, 0x77, 0xe1, 0x29,
+    0x29, 0x29, 0x68, 0xf3, 0x48, 0xb5, 0x1f, 0x04, 0x00, 0xe9, 0x48, 0x79, 0x9a, 0xe0, 0x22, 0xe1,
+    0xe8, 0x07, 0x56, 0x00, 0x15, 0x80, 0x81, 0x0b, 0x41, 0x00, 0x34, 0x00, 0x19, 0x00, 0x0e, 0x00,
+    0x79, 0xe9, 0x48, 0xb4, 0x24, 0x04, 0x00, 0xed, 0x28, 0x00, 0x1e, 0x77, 0xe1, 0x40, 0x0e, 0x02,
+    0xeb, 0x48, 0x04, 0x00, 0x67, 0xad, 0xe9, 0x48, 0x52, 0x2a, 0xf8, 0x29, 0xe7, 0x48, 0x15, 0x24,
+    0x04, 0x00, 0xef, 0x28, 0x17, 0x23, 0xed, 0x40, 0x06, 0x02, 0xe9, 0x28, 0x81, 0x57, 0x61, 0xf9,
+    0x28, 0xd6, 0x23, 0xeb, 0x68, 0x2f, 0x9a, 0x0d, 0x00, 0x06, 0x00, 0x75, 0x7a, 0x61, 0xf2, 0x28,
+    0x55, 0x27, 0xef, 0x48, 0x73, 0xaa, 0x08, 0xae, 0xe2, 0x28, 0xe3, 0x1e, 0xe9, 0x28, 0x84, 0xa0,
+    0x64, 0x69, 0x61, 0x6b, 0x6b, 0x6f, 0xe8, 0x21, 0x01, 0xae, 0xc8, 0x85, 0x02, 0x23, 0x02, 0x59,
+    0x01, 0x36, 0x01, 0xc0, 0x00, 0x0c, 0x00, 0xf5, 0xe0, 0x08, 0xad, 0xa8, 0x9d, 0x84, 0x80, 0x17,
+    0x11, 0x08, 0x7a, 0x69, 0x6d, 0x69, 0x68, 0xf3, 0x29, 0xa1, 0x93, 0x79, 0x72, 0xf5, 0x29, 0x1c,
+    0x3a, 0xf3, 0x68, 0x12, 0x27, 0x0a, 0x00, 0x06, 0x00, 0xf5, 0x28, 0x3e, 0x28, 0xf4, 0x60, 0x0e,
+    0x09, 0x03, 0x75, 0x66, 0xf5, 0x28, 0x75, 0x37, 0x6f, 0xee, 0x28, 0x67, 0x0a, 0x65, 0xe2, 0xc8,
+    0xf8, 0xad, 0x38, 0x00, 0x28, 0x00, 0x21, 0x00, 0x19, 0x00, 0x0c, 0x00, 0xf5, 0x68, 0x82, 0x0e,
+    0x06, 0x00, 0x8f, 0x23, 0x70, 0xf0, 0x28, 0x1b, 0x84, 0xef, 0x68, 0x06, 0x28, 0x93, 0xad, 0x20,
+    0xae, 0x6e, 0xef, 0x48, 0xf4, 0xac, 0xb3, 0x27, 0xed, 0x48, 0xce, 0xad, 0x04, 0x00, 0xef, 0x48,
+    0xfa, 0xad, 0x04, 0x00, 0xf4, 0x28, 0x01, 0x1e, 0xe9, 0x68, 0x03, 0xae, 0x0b, 0x00, 0x06, 0x00,
+    0x72, 0xef, 0x28, 0xd9, 0x07, 0x68, 0xf3, 0x29, 0xf5, 0xad, 0xf2, 0x28, 0x72, 0x20, 0x70, 0xf0,
+    0x68, 0x11, 0x00, 0x06, 0x00, 0xc0, 0xa6, 0x65, 0xee, 0x48, 0x04, 0x00, 0x0f, 0x5b, 0xe9, 0x28,
+    0xb7, 0x01, 0x61, 0xeb, 0x28, 0xae, 0x20, 0xed, 0x48, 0x04, 0x00, 0x91, 0x6f, 0x61, 0xf3, 0x28,
+    0x8e, 0x5e, 0x6b, 0xef, 0x28, 0xf3, 0x18, 0xe2, 0x28, 0x9e, 0x56, 0xef, 0xc8, 0x6f, 0x00, 0x65,
+    0x00, 0x56, 0x00, 0x2d, 0x1f, 0x1f, 0x00, 0x0c, 0x00, 0xf4, 0x68, 0x0a, 0x00, 0x06, 0x00, 0xcf,
+    0x07, 0xe5, 0x28, 0x0c, 0xa7, 0xe1, 0x20, 0x01, 0xf3, 0x28, 0x64, 0x13, 0xf2, 0x60, 0x2a, 0x08,
+    0x03, 0x75, 0xed, 0x28, 0x6e, 0xad, 0xef, 0x88, 0x6b, 0x30, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00,
+    0xf9, 0x28, 0xff, 0xaa, 0xf0, 0x28, 0xa1, 0x3a, 0xe8, 0x48, 0x04, 0x00, 0x4f, 0xac, 0xe9, 0x48,
+    0x50, 0xad, 0x04, 0x00, 0xe8, 0x28, 0x23, 0x06, 0x69, 0xe8, 0x48, 0x04, 0x00, 0x88, 0x25, 0xe9,
+    0x28, 0xf1, 0x16, 0x6e, 0x61, 0x72, 0x75, 0xe6, 0x21, 0x01, 0x69, 0x6d, 0xe1, 0x48, 0xd7, 0xa8,
+    0x68, 0x91, 0xed, 0x48, 0x24, 0x4b, 0x04, 0x00, 0xf5, 0x28, 0xfe, 0x1d, 0x6b, 0xe1, 0x28, 0x2b,
+    0xa9, 0xee, 0x40, 0x07, 0x02, 0x75, 0xe2, 0x28, 0x19, 0xab, 0xe1, 0x88, 0x12, 0x00, 0x0e, 0x00,
+    0x05, 0x9e, 0x08, 0x00, 0x74, 0x6f, 0xeb, 0x28, 0x1f, 0xab, 0xf2, 0x28, 0x85, 0x08, 0x68, 0x63,
+    0xf4, 0x28, 0x3f, 0x9e, 0xe9, 0xe8, 0x08, 0x88, 0x00, 0x3d, 0x78, 0x58, 0x00, 0x4e, 0x00, 0x40,
+    0x00, 0x36, 0x00, 0x2f, 0x00, 0x10, 0x00, 0xf2, 0x60, 0x15, 0x09, 0x03, 0x6f, 0x74, 0xe1, 0x28,
+    0xc1, 0x5c, 0x69, 0x68, 0xf3, 0x48, 0x04, 0x00, 0x58, 0xa8, 0xe1, 0x28, 0xd9, 0xa9, 0xe1, 0x68,
+    0x91, 0xab, 0x98, 0x11, 0x13, 0x27, 0x6f, 0xe1, 0x48, 0x82, 0xab, 0x9a, 0x27, 0xed, 0x48, 0x76,
+    0x26, 0x04, 0x00, 0xef, 0x28, 0xa6, 0x21, 0xeb, 0x40, 0x08, 0x02, 0xe9, 0x48, 0x67, 0x98, 0xb8,
+    0xac, 0xe1, 0x28, 0x62, 0x23, 0x6a, 0x75, 0x66, 0x69, 0x72, 0x69, 0xe8, 0x28, 0xb8, 0x3d, 0xe8,
+    0x40, 0x1b, 0x02, 0xf3, 0x80, 0x13, 0x0e, 0x09, 0x04, 0x75, 0xe5, 0x28, 0x33, 0x50, 0x6f, 0xeb,
+    0x28, 0x10, 0x36, 0x65, 0xeb, 0x28, 0x50, 0x4c, 0xe1, 0x28, 0x77, 0x9d, 0xe3, 0x48, 0x88, 0x15,
+    0x04, 0x00, 0xf5, 0x40, 0x06, 0x02, 0xe9, 0x28, 0x4b, 0x27, 0x62, 0xed, 0x28, 0xc0, 0x99, 0xe1,
+    0x68, 0x79, 0x5b, 0x36, 0x00, 0x06, 0x00, 0xee, 0xa0, 0x22, 0x1e, 0x18, 0x14, 0x05, 0x75, 0x73,
+    0x74, 0xe1, 0x40, 0x06, 0x02, 0xf3, 0x28, 0x80, 0x1c, 0xed, 0x28, 0x19, 0x22, 0xef, 0x28, 0xd5,
+    0x20, 0x69, 0x68, 0xf3, 0x28, 0x1e, 0x59, 0xe5, 0x28, 0xa4, 0x27, 0xe1, 0x48, 0x04, 0x00, 0xd8,
+    0x20, 0xeb, 0x48, 0x12, 0x1e, 0x59, 0x00, 0x6d, 0x6f, 0x6b, 0xe1, 0x28, 0x77, 0x26, 0xe5, 0xe0,
+    0x09, 0x59, 0x3e, 0x3a, 0x2c, 0x26, 0x1e, 0x18, 0x12, 0x09, 0x75, 0x6f, 0xee, 0x20, 0x01, 0xe9,
+    0x28, 0x07, 0x25, 0x74, 0x61, 0xe4, 0x29, 0xd9, 0x11, 0x73, 0x6f, 0xf4, 0x28, 0x35, 0x82, 0x70,
+    0x70, 0x6f, 0x6b, 0xef, 0x29, 0xaf, 0x25, 0x6e, 0x61, 0xeb, 0x28, 0x14, 0x5c, 0xeb, 0x48, 0x82,
+    0x09, 0x04, 0x00, 0x75, 0xe6, 0x20, 0x01, 0xef, 0x28, 0x49, 0xaa, 0xe9, 0x28, 0x94, 0xa9, 0xe2,
+    0x40, 0x0f, 0x02, 0xef, 0x48, 0x04, 0x00, 0x3d, 0xaa, 0xee, 0x20, 0x01, 0xef, 0x28, 0x62, 0x90,
+    0xe1, 0x48, 0x99, 0xaa, 0x04, 0x00, 0xf9, 0x28, 0xe5, 0x8b, 0xe1, 0x48, 0xe9, 0x1a, 0x1b, 0x39,
+    0xe1, 0xe8, 0x0a, 0x1f, 0x02, 0xc2, 0x00, 0xbc, 0x00, 0xaa, 0x00, 0x86, 0x00, 0x65, 0x00, 0x5f,
+    0x00, 0x54, 0x00, 0x14, 0x00, 0xd7, 0xa7, 0xf7, 0x68, 0x0a, 0x00, 0x06, 0x00, 0xbf, 0x13, 0xe9,
+    0x28, 0xdf, 0x8a, 0xe1, 0x60, 0x21, 0x09, 0x03, 0x7a, 0x69, 0xed, 0x28, 0x36, 0x20, 0xeb, 0x88,
+    0xb9, 0x25, 0x08, 0x00, 0x2d, 0x27, 0xab, 0xa0, 0xe9, 0x68, 0x06, 0x00, 0x7e, 0x24, 0xf6, 0x26,
+    0xe8, 0x48, 0x83, 0x26, 0x1a, 0x24, 0x67, 0xe1, 0x40, 0x08, 0x02, 0x6e, 0x75, 0xf3, 0x29, 0x06,
+    0x25, 0xeb, 0x48, 0x1e, 0xa9, 0x2a, 0x9e, 0x74, 0xe1, 0x48, 0x04, 0x00, 0x72, 0x1f, 0xe7, 0x28,
+    0xd4, 0x16, 0x73, 0x61, 0xeb, 0x28, 0x81, 0xab, 0xf2, 0x60, 0x12, 0x0e, 0x03, 0xf5, 0x48, 0x04,
+    0x00, 0x68, 0xa7, 0x67, 0xe1, 0x28, 0x18, 0x12, 0xef, 0x28, 0xc8, 0x0c, 0x69, 0xe2, 0x68, 0x06,
+    0x00, 0x73, 0xab, 0xe9, 0x17, 0xe1, 0x29, 0x0f, 0x4b, 0xed, 0xa8, 0x1c, 0x00, 0xc4, 0x25, 0x0e,
+    0x00, 0x0a, 0x00, 0xf0, 0x10, 0xef, 0x28, 0x94, 0x34, 0x69, 0x68, 0xf3, 0x48, 0x04, 0x00, 0x7f,
+    0x24, 0x6f, 0x72, 0xe9, 0x28, 0xda, 0x24, 0x61, 0x79, 0xe9, 0x28, 0x15, 0x21, 0xeb, 0x48, 0x03,
+    0x1d, 0x04, 0x00, 0xf5, 0x40, 0x06, 0x02, 0xee, 0x28, 0xb7, 0x1e, 0xe6, 0x28, 0xf3, 0xa4, 0x68,
+    0x63, 0xe5, 0x28, 0xd5, 0x16, 0x67, 0x61, 0x6b, 0x69, 0xe8, 0x28, 0x46, 0x96, 0xe1, 0x28, 0x05,
+    0xa0, 0x37, 0x71, 0x72, 0xe2, 0x28, 0x7f, 0xab, 0x31, 0x33, 0x31, 0x72, 0xef, 0x28, 0x58, 0xab,
+    0xee, 0xc8, 0x42, 0x00, 0x3a, 0x00, 0x21, 0x00, 0xdf, 0x8c, 0x16, 0x00, 0x0c, 0x00, 0xef, 0x48,
+    0xd0, 0x20, 0x04, 0x00, 0xf3, 0x28, 0x14, 0x57, 0x6e, 0x37, 0x70, 0x37, 0x71, 0x72, 0x74, 0xb0,
+    0x28, 0xeb, 0xab, 0xe1, 0x40, 0x10, 0x02, 0xe9, 0x40, 0x06, 0x02, 0xf6, 0x28, 0xec, 0xa6, 0x6c,
+    0x6f, 0xe7, 0x28, 0xb2, 0x81, 0x65, 0x62, 0x79, 0xec, 0x28, 0x53, 0xa2, 0x36, 0x35, 0x7a, 0x71,
+    0xe8, 0x28, 0xd4, 0xa1, 0x33, 0xb0, 0x28, 0x0f, 0x0e, 0xed, 0x88, 0x15, 0x00, 0x0e, 0x00, 0xa1,
+    0x88, 0x08, 0x00, 0x73, 0x69, 0xef, 0x28, 0xed, 0x54, 0x34, 0x31, 0x73, 0xb3, 0x28, 0x0e, 0xa3,
+    0x31, 0x31, 0x74, 0x71, 0xf1, 0x28, 0xe7, 0xaa, 0xec, 0xa8, 0x18, 0x00, 0x12, 0x00, 0x1e, 0x67,
+    0xdc, 0x7a, 0x0a, 0x00, 0x72, 0x69, 0x67, 0x65, 0xf4, 0x28, 0x83, 0xa8, 0x65, 0x6c, 0xec, 0x28,
+    0xc4, 0x29, 0x33, 0x33, 0xf5, 0x20, 0x01, 0x73, 0xf3, 0x28, 0xfa, 0x81, 0xeb, 0xe0, 0x07, 0x49,
+    0x38, 0x30, 0x2a, 0x15, 0x0f, 0x07, 0x6e, 0x75, 0x70, 0x61, 0xf4, 0x28, 0x4f, 0x42, 0x6c, 0x69,
+    0xed, 0x28, 0xe4, 0x09, 0x63, 0xe9, 0x68, 0x0e, 0x00, 0x16, 0x90, 0x06, 0x00, 0xf3, 0x20, 0x01,
+    0x65, 0xf6, 0x28, 0x94, 0x96, 0xe7, 0x28, 0x9b, 0x9b, 0x37, 0x39, 0xb7, 0x28, 0x6a, 0x0d, 0x35,
+    0x32, 0x32, 0x74, 0xe9, 0x28, 0x30, 0xab, 0xb4, 0x40, 0x0a, 0x02, 0x79, 0xf4, 0x20, 0x01, 0xea,
+    0x28, 0x8f, 0xa2, 0x33, 0xf1, 0x28, 0x9e, 0x0d, 0x32, 0x36, 0x72, 0x74, 0xec, 0x28, 0xf3, 0xaa,
+    0xe9, 0xe8, 0x08, 0x31, 0x09, 0x27, 0x09, 0x23, 0x09, 0x5f, 0x07, 0x0e, 0x04, 0x66, 0x01, 0x63,
+    0x00, 0x10, 0x00, 0x75, 0x6b, 0x75, 0xe6, 0x21, 0x01, 0xae, 0xa8, 0x2b, 0x00, 0x25, 0x00, 0x14,
+    0x00, 0x0a, 0x00, 0x0f, 0x1f, 0x6e, 0x65, 0x7a, 0x69, 0x68, 0x63, 0xe5, 0x29, 0x3c, 0x24, 0xe9,
+    0x88, 0xf0, 0x24, 0xc0, 0x13, 0x08, 0x00, 0x2b, 0x23, 0x6a, 0x69, 0x65, 0xe8, 0x28, 0x55, 0x53,
+    0x65, 0x61, 0xe2, 0x28, 0x3b, 0xa6, 0xe1, 0x88, 0x1a, 0x00, 0x36, 0x1d, 0x0d, 0x00, 0x08, 0x00,
+    0x73, 0xe1, 0x28, 0x92, 0x1b, 0x6d, 0xe1, 0x68, 0x6a, 0x13, 0x04, 0x07, 0x06, 0x00, 0xf9, 0x28,
+    0x50, 0x25, 0xe4, 0x28, 0xc1, 0x21, 0x72, 0xef, 0x60, 0xfc, 0x5f, 0x03, 0x74, 0x74, 0x6f, 0xf4,
+    0x21, 0x01, 0xae, 0xc8, 0x3c, 0x00, 0x38, 0x00, 0x30, 0x00, 0x2c, 0x01, 0x1a, 0x00, 0x0c, 0x00,
+    0xf5, 0x40, 0x08, 0x02, 0xfa, 0x48, 0x4f, 0xa5, 0xac, 0x7f, 0xe2, 0x28, 0xcb, 0x36, 0xef, 0x60,
+    0x10, 0x0c, 0x03, 0x74, 0x61, 0x6e, 0x69, 0x6d, 0xe9, 0x28, 0x87, 0x24, 0xee, 0x28, 0x66, 0x7e,
+    0xe7, 0x28, 0x6d, 0x0d, 0x69, 0x72, 0x6f, 0x74, 0xf4, 0x28, 0x29, 0xa9, 0xe5, 0x28, 0x5b, 0x03,
+    0xe1, 0x40, 0x09, 0x02, 0x73, 0xe1, 0x48, 0x2e, 0x1b, 0x77, 0x87, 0xf2, 0x40, 0x06, 0x02, 0xf5,
+    0x28, 0x16, 0x10, 0x61, 0xe8, 0x28, 0x34, 0x20, 0x6d, 0x6f, 0xe1, 0x21, 0x01, 0xae, 0xa0, 0x84,
+    0x62, 0x1b, 0x11, 0x05, 0xf5, 0x48, 0x04, 0x00, 0x89, 0x24, 0x72, 0x61, 0xe7, 0x28, 0xbc, 0x1e,
+    0xef, 0x48, 0x1d, 0x1e, 0x04, 0x00, 0xeb, 0x28, 0x10, 0x22, 0xe9, 0xe0, 0x08, 0x3f, 0x37, 0x33,
+    0x2e, 0x28, 0x1f, 0x1b, 0x08, 0xf2, 0x40, 0x0a, 0x02, 0x6f, 0xed, 0x20, 0x01, 0xef, 0x28, 0x3e,
+    0xa9, 0x61, 0x6d, 0x6f, 0xe4, 0x28, 0x31, 0x19, 0xee, 0x28, 0xb9, 0x05, 0x6d, 0x61, 0xeb, 0x20,
+    0x01, 0xe9, 0x28, 0x45, 0x80, 0x6b, 0x61, 0xf3, 0x28, 0x91, 0x1a, 0x6a, 0xe5, 0x28, 0x7d, 0x90,
+    0xe8, 0x28, 0x64, 0x06, 0x67, 0x61, 0x6e, 0x61, 0xf9, 0x28, 0xa5, 0x16, 0x61, 0xee, 0x28, 0x8c,
+    0x20, 0xe5, 0x40, 0x07, 0x02, 0x73, 0xe1, 0x28, 0x82, 0x70, 0x68, 0x6f, 0xee, 0x88, 0x0d, 0x00,
+    0xe6, 0x7d, 0xaf, 0xa8, 0x08, 0x00, 0x75, 0xeb, 0x28, 0x5c, 0xa3, 0x69, 0x68, 0xe3, 0x48, 0x0b,
+    0x82, 0x7f, 0xa7, 0xe1, 0x60, 0x0b, 0x07, 0x03, 0xf7, 0x28, 0xf8, 0x19, 0xf4, 0x28, 0x23, 0x1c,
+    0x64, 0xe1, 0x28, 0x42, 0x68, 0xe3, 0x28, 0x4c, 0xa8, 0x6b, 0xe1, 0x68, 0x6b, 0x01, 0xc4, 0x00,
+    0x06, 0x00, 0x7a, 0x61, 0x79, 0x69, 0xed, 0x21, 0x01, 0xae, 0xc0, 0x63, 0x55, 0x2e, 0x25, 0x0b,
+    0x06, 0x75, 0xf2, 0x28, 0x46, 0x19, 0xef, 0x68, 0x0c, 0x00, 0x06, 0x00, 0x1a, 0x1c, 0xee, 0x48,
+    0xac, 0x0e, 0x0a, 0x1e, 0xea, 0x48, 0x1c, 0xa4, 0x04, 0x00, 0x6f, 0x6e, 0xef, 0x28, 0x84, 0x1d,
+    0x6e, 0x61, 0x6e, 0x69, 0x68, 0xe3, 0x28, 0xd8, 0xa6, 0xe9, 0x60, 0x1d, 0x14, 0x03, 0xed, 0x40,
+    0x09, 0x02, 0x6f, 0xf4, 0x48, 0x29, 0x15, 0xcb, 0x1d, 0x61, 0x6e, 0xe9, 0x28, 0xaf, 0x15, 0x6b,
+    0x61, 0x7a, 0xe1, 0x48, 0x34, 0x21, 0xb3, 0x1e, 0x68, 0x73, 0x61, 0x79, 0xe1, 0x28, 0xaf, 0x72,
+    0xe5, 0x40, 0x07, 0x02, 0x73, 0xe1, 0x28, 0xe8, 0x78, 0x62, 0xe1, 0x28, 0x0d, 0x06, 0xe1, 0xe8,
+    0x08, 0x4a, 0x00, 0x46, 0x00, 0x36, 0x00, 0x30, 0x00, 0x23, 0x00, 0x18, 0x00, 0x10, 0x00, 0xe9,
+    0x0e, 0x77, 0x61, 0xe7, 0x48, 0xd0, 0x21, 0xed, 0x1f, 0x74, 0xe1, 0x48, 0x74, 0x15, 0x04, 0x00,
+    0xed, 0x28, 0x25, 0xa8, 0xf2, 0x40, 0x06, 0x02, 0xf5, 0x28, 0xbb, 0x21, 0x65, 0xed, 0x28, 0xa5,
+    0x21, 0x6d, 0x69, 0xe8, 0x28, 0x3e, 0x20, 0xeb, 0x40, 0x09, 0x02, 0x75, 0x73, 0x74, 0xef, 0x28,
+    0x06, 0x92, 0x6f, 0xe5, 0x28, 0xf7, 0x01, 0xe7, 0x28, 0x11, 0x7e, 0x62, 0xe9, 0x28, 0xa0, 0xa6,
+    0x73, 0xe1, 0x40, 0x07, 0x02, 0x77, 0xe1, 0x28, 0xb2, 0x0a, 0x67, 0x61, 0xee, 0x21, 0x01, 0xae,
+    0xa0, 0x62, 0x42, 0x3c, 0x1b, 0x05, 0x75, 0x73, 0xf4, 0x68, 0x0e, 0x00, 0x06, 0x00, 0x73, 0x9a,
+    0x6f, 0x6e, 0x69, 0x68, 0xe3, 0x28, 0xfb, 0x98, 0xe9, 0x28, 0xc3, 0x22, 0xef, 0x60, 0x1a, 0x16,
+    0x03, 0xf4, 0x40, 0x0d, 0x02, 0x6f, 0xe7, 0x21, 0x01, 0x69, 0x6d, 0x61, 0xeb, 0x28, 0x12, 0x1d,
+    0xe5, 0x28, 0x03, 0xa6, 0xe4, 0x28, 0x45, 0x1f, 0x62, 0xe5, 0x28, 0xd0, 0x51, 0x6e, 0x65, 0xfa,
+    0x28, 0x95, 0x7a, 0xe9, 0x80, 0x19, 0x15, 0x08, 0x04, 0xed, 0x28, 0xd5, 0x0e, 0xeb, 0x48, 0x04,
+    0x00, 0x58, 0xa6, 0xe1, 0x20, 0x01, 0xf3, 0x28, 0x45, 0x23, 0xe8, 0x28, 0xd6, 0x0f, 0x61, 0xeb,
+    0x28, 0x20, 0x4d, 0xe1, 0xa0, 0x26, 0x20, 0x11, 0x0b, 0x05, 0x79, 0x61, 0xe8, 0x28, 0x0e, 0x5c,
+    0x77, 0x69, 0xea, 0x28, 0x7e, 0x7d, 0xf2, 0x40, 0x08, 0x02, 0xf5, 0x48, 0x30, 0xa6, 0xdb, 0x21,
+    0x61, 0xe2, 0x28, 0x05, 0x1e, 0x6e, 0x61, 0xf4, 0x28, 0x31, 0x1e, 0xed, 0x48, 0xf2, 0x10, 0x04,
+    0x00, 0x69, 0x68, 0xf3, 0x28, 0xc5, 0x1c, 0x72, 0x61, 0x62, 0xe9, 0x21, 0x01, 0xae, 0xa0, 0xac,
+    0x93, 0x43, 0x17, 0x05, 0xf5, 0x60, 0x0c, 0x07, 0x03, 0xf3, 0x28, 0xaa, 0x20, 0x6b, 0xe9, 0x28,
+    0x3d, 0x59, 0xe6, 0x28, 0x50, 0x55, 0xef, 0xe8, 0x08, 0x13, 0x14, 0x25, 0x00, 0xe8, 0x22, 0x08,
+    0x13, 0x1f, 0x00, 0x1b, 0x00, 0x10, 0x00, 0x4d, 0x21, 0xf4, 0x48, 0x04, 0x00, 0x1c, 0xa7, 0x61,
+    0xf3, 0x28, 0xce, 0x21, 0xf3, 0x28, 0xdb, 0x97, 0x72, 0x69, 0xe8, 0x28, 0xd2, 0x0c, 0xe7, 0x28,
+    0xac, 0x1d, 0xe9, 0xe8, 0x07, 0x3f, 0x00, 0x3b, 0x00, 0x37, 0x00, 0x31, 0x00, 0x17, 0x00, 0x2a,
+    0xa6, 0x0e, 0x00, 0x72, 0x75, 0x6b, 0x75, 0x73, 0xf4, 0x28, 0x50, 0x17, 0xeb, 0x68, 0x0c, 0x00,
+    0x06, 0x00, 0x8b, 0x1c, 0x69, 0x68, 0xf3, 0x28, 0x4b, 0x1c, 0xe1, 0x48, 0xf9, 0x1d, 0x04, 0x00,
+    0x73, 0x61, 0xe7, 0x28, 0x6e, 0x1f, 0xe8, 0x48, 0xad, 0x21, 0xad, 0x00, 0xe7, 0x28, 0x6c, 0x17,
+    0xe5, 0x28, 0xbd, 0x1b, 0xe1, 0x40, 0x06, 0x02, 0xf2, 0x28, 0xf6, 0x20, 0xeb, 0x48, 0x11, 0xa3,
+    0x65, 0xa6, 0xe5, 0x88, 0x12, 0x00, 0x0e, 0x00, 0x0b, 0x30, 0x08, 0x00, 0x74, 0x61, 0xe4, 0x28,
+    0x1d, 0x22, 0xe4, 0x28, 0x00, 0x4e, 0x62, 0xef, 0x28, 0xca, 0x20, 0xe1, 0xe8, 0x09, 0x7f, 0x00,
+    0x7b, 0x00, 0x6e, 0x00, 0x5a, 0x00, 0xc5, 0xa4, 0x3b, 0x00, 0x2d, 0x00, 0x1c, 0x00, 0x12, 0x00,
+    0x79, 0xe9, 0x48, 0x04, 0x00, 0x83, 0x90, 0xed, 0x20, 0x16, 0xf7, 0x48, 0x04, 0x00, 0xfe, 0x8d,
+    0x61, 0xe7, 0x48, 0x04, 0x00, 0x7f, 0xa6, 0xe1, 0x28, 0x04, 0x11, 0xf4, 0x40, 0x05, 0x02, 0xef,
+    0x20, 0x40, 0x61, 0xe7, 0x48, 0x21, 0x43, 0xe6, 0xa3, 0xf2, 0x40, 0x13, 0x02, 0xf5, 0x40, 0x08,
+    0x02, 0x69, 0x68, 0xe3, 0x28, 0xc5, 0x1b, 0x61, 0x67, 0x69, 0xed, 0x28, 0xac, 0x1c, 0xe1, 0x48,
+    0x04, 0x00, 0x25, 0x08, 0xe8, 0x28, 0xb3, 0x0c, 0xed, 0x68, 0x06, 0x00, 0x67, 0x21, 0xce, 0x03,
+    0xe1, 0x68, 0xa3, 0x6c, 0x06, 0x00, 0xb3, 0x1a, 0xf4, 0x28, 0x8c, 0x1e, 0x6b, 0x61, 0xee, 0x21,
+    0x01, 0x69, 0xe8, 0x20, 0x01, 0xe3, 0x28, 0xf7, 0x7a, 0xe7, 0x28, 0x6f, 0x8b, 0xe2, 0x28, 0x09,
+    0x0d, 0xe8, 0x40, 0xdb, 0x02, 0xf3, 0x40, 0x09, 0x02, 0xf5, 0x20, 0x01, 0xe2, 0x28, 0x81, 0xa5,
+    0x61, 0x6e, 0x61, 0x6d, 0x61, 0xf9, 0x21, 0x01, 0xae, 0xc0, 0x89, 0x83, 0x53, 0x22, 0x1a, 0x06,
+    0xf5, 0x88, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x19, 0x52, 0x19, 0xe6, 0x28, 0x3e, 0x8b, 0xe2, 0x48,
+    0x17, 0x33, 0x3c, 0x1d, 0x73, 0x70, 0x6c, 0x61, 0xad, 0x28, 0x1f, 0x20, 0xef, 0x88, 0x1c, 0x00,
+    0x19, 0x00, 0x08, 0x00, 0x79, 0x7d, 0xf4, 0x40, 0x06, 0x02, 0xf5, 0x28, 0x9f, 0x31, 0x61, 0x73,
+    0x69, 0x6d, 0x61, 0xf7, 0x28, 0x41, 0x03, 0xee, 0x20, 0xf1, 0xeb, 0x40, 0x0d, 0x02, 0x69, 0x68,
+    0x63, 0x75, 0x67, 0x61, 0x77, 0xe1, 0x28, 0x12, 0x1a, 0x61, 0xeb, 0x20, 0x28, 0xe9, 0x68, 0x9e,
+    0x85, 0x1b, 0x00, 0x06, 0x00, 0xeb, 0x40, 0x0c, 0x02, 0xf5, 0x48, 0x04, 0x00, 0xd4, 0xa3, 0xe6,
+    0x28, 0x6c, 0x90, 0x61, 0x73, 0x61, 0xf2, 0x28, 0xe7, 0xa3, 0xe8, 0x40, 0x0c, 0x02, 0xf3, 0x48,
+    0x04, 0x00, 0x9e, 0xa0, 0xe1, 0x28, 0xea, 0x0e, 0x63, 0xe9, 0x28, 0x5d, 0x01, 0x65, 0x67, 0xf5,
+    0x28, 0x02, 0x1e, 0xe1, 0x80, 0x30, 0x29, 0x18, 0x04, 0xf7, 0x48, 0x04, 0x00, 0x66, 0x8c, 0xe1,
+    0x40, 0x06, 0x02, 0xf3, 0x28, 0x03, 0x13, 0xeb, 0x48, 0x4b, 0x16, 0x02, 0x1d, 0xf2, 0x40, 0x08,
+    0x02, 0x75, 0x73, 0xf4, 0x28, 0x24, 0x03, 0x61, 0x68, 0x6f, 0xee, 0x28, 0x9f, 0x10, 0x6d, 0x61,
+    0x79, 0xe1, 0x28, 0x60, 0x72, 0x64, 0x69, 0x68, 0x73, 0x6f, 0xf9, 0x28, 0xdf, 0x1c, 0xe3, 0x68,
+    0x2d, 0x01, 0x74, 0x00, 0x06, 0x00, 0x75, 0x67, 0x61, 0x6d, 0x61, 0xf9, 0x21, 0x01, 0xae, 0xc8,
+    0x50, 0x00, 0x45, 0x00, 0x2b, 0x00, 0x24, 0x00, 0x56, 0x17, 0x0c, 0x00, 0xf5, 0xa8, 0x07, 0xa2,
+    0x12, 0x00, 0x71, 0x0b, 0x0a, 0x00, 0xbb, 0x1a, 0x73, 0x74, 0x61, 0x6d, 0xe1, 0x28, 0xbd, 0x16,
+    0xe6, 0x28, 0xf3, 0xa3, 0x6e, 0x61, 0x6e, 0xf5, 0x28, 0xa8, 0xa3, 0xe9, 0x88, 0x03, 0x32, 0x11,
+    0x00, 0x0c, 0x00, 0x08, 0x00, 0xf2, 0x28, 0xf1, 0x05, 0x6e, 0xf5, 0x28, 0xf7, 0x01, 0x6b, 0x65,
+    0x73, 0xef, 0x28, 0xa4, 0x10, 0xe5, 0x48, 0x2c, 0x93, 0x04, 0x00, 0x73, 0xf5, 0x28, 0xf5, 0x71,
+    0xe1, 0x48, 0x04, 0x00, 0xa9, 0x19, 0xed, 0x40, 0x06, 0x02, 0xe9, 0x28, 0x73, 0x04, 0x61, 0x79,
+    0xf5, 0x28, 0x1e, 0x21, 0x6f, 0xeb, 0x21, 0x01, 0xae, 0x80, 0x6b, 0x3c, 0x18, 0x04, 0xf5, 0x40,
+    0x0c, 0x02, 0x7a, 0x69, 0x6d, 0x69, 0x68, 0x73, 0xe1, 0x28, 0x56, 0xa4, 0x6b, 0x6f, 0xeb, 0x28,
+    0xd7, 0x31, 0xef, 0x80, 0x1d, 0x11, 0x0a, 0x04, 0x79, 0x6f, 0xf4, 0x29, 0xa6, 0xa4, 0xf4, 0x20,
+    0x01, 0xef, 0x28, 0x77, 0x0e, 0xee, 0x48, 0x50, 0xa3, 0x04, 0x00, 0x75, 0x73, 0xf4, 0x29, 0xf7,
+    0x1c, 0x6d, 0xf5, 0x28, 0xbb, 0x11, 0xe9, 0xc0, 0x27, 0x21, 0x1c, 0x12, 0x0b, 0x06, 0x72, 0xe1,
+    0x28, 0x54, 0x09, 0x6d, 0xe1, 0x48, 0xd0, 0x14, 0xff, 0x9f, 0xeb, 0x48, 0x04, 0x00, 0xa0, 0xa2,
+    0xe1, 0x29, 0x5f, 0x18, 0x6a, 0xe1, 0x28, 0x0d, 0x6c, 0x68, 0x63, 0xef, 0x29, 0xe8, 0x9f, 0x65,
+    0x73, 0xe9, 0x28, 0x27, 0xa3, 0xe1, 0xc8, 0x42, 0x00, 0x18, 0x16, 0x3c, 0x00, 0x2a, 0x00, 0x24,
+    0x00, 0x0c, 0x00, 0x77, 0xe1, 0x40, 0x08, 0x02, 0xeb, 0x48, 0x95, 0xa0, 0x48, 0xa4, 0xe7, 0x48,
+    0xd5, 0x1d, 0x04, 0x00, 0x6f, 0x64, 0x6f, 0xf9, 0x28, 0x86, 0xa2, 0x73, 0x6f, 0xf4, 0x29, 0xb5,
+    0x1d, 0xf2, 0x40, 0x09, 0x02, 0xf5, 0x20, 0x01, 0xed, 0x28, 0x2d, 0x14, 0x61, 0xe8, 0x48, 0x18,
+    0xa4, 0x28, 0x13, 0x6d, 0x61, 0xf9, 0x28, 0xfc, 0x52, 0xe4, 0x28, 0xf6, 0x04, 0x69, 0xe1, 0x21,
+    0x01, 0xae, 0xc0, 0xd4, 0xb4, 0x5e, 0x49, 0x2a, 0x06, 0xf5, 0xa8, 0x97, 0x0d, 0x1d, 0x00, 0x12,
+    0x00, 0x0e, 0x00, 0x0a, 0x00, 0xfa, 0x28, 0x23, 0x7d, 0xf9, 0x28, 0x94, 0x54, 0xf3, 0x48, 0xbf,
+    0x09, 0x04, 0x00, 0x74, 0xe1, 0x28, 0x85, 0xa2, 0x72, 0xe1, 0x28, 0xa6, 0x0d, 0xef, 0xc8, 0xce,
+    0x1e, 0x65, 0x1d, 0x19, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x07, 0x49, 0xf3, 0x28, 0x60, 0x96, 0xf2,
+    0x20, 0x01, 0x69, 0x68, 0xf3, 0x28, 0x1a, 0x19, 0xea, 0x28, 0xc9, 0x96, 0xee, 0x40, 0x07, 0x02,
+    0x69, 0xe8, 0x28, 0xba, 0x44, 0x61, 0xee, 0x48, 0x04, 0x00, 0x02, 0x89, 0x69, 0xeb, 0x28, 0xab,
+    0x89, 0xe9, 0xc0, 0x48, 0x44, 0x25, 0x12, 0x0d, 0x06, 0x72, 0x6f, 0x67, 0xe1, 0x28, 0x7d, 0x99,
+    0x6d, 0xef, 0x28, 0xb1, 0x04, 0xeb, 0x40, 0x07, 0x02, 0x69, 0xe8, 0x28, 0xe7, 0x57, 0xe1, 0x48,
+    0xd7, 0x88, 0x04, 0x00, 0xfa, 0x28, 0x0a, 0x19, 0xe8, 0x60, 0x12, 0x0e, 0x03, 0xf3, 0x48, 0x04,
+    0x00, 0x23, 0x16, 0x61, 0xe8, 0x28, 0x61, 0x9f, 0xe3, 0x28, 0xac, 0x0c, 0x61, 0x73, 0x61, 0x69,
+    0xf2, 0x20, 0x01, 0xe1, 0x28, 0x6f, 0x5e, 0xe5, 0x28, 0x0a, 0xa3, 0xe1, 0x68, 0x06, 0x00, 0xb3,
+    0x1f, 0xa6, 0x1b, 0xe7, 0x28, 0xb3, 0x19, 0xe5, 0x88, 0x1a, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x44,
+    0x1b, 0x6d, 0x61, 0xee, 0x28, 0x61, 0x16, 0xeb, 0x40, 0x06, 0x02, 0xf5, 0x28, 0x1c, 0xa2, 0xe1,
+    0x28, 0x26, 0x9f, 0xe9, 0x28, 0x73, 0x1c, 0xe1, 0xc8, 0x80, 0x4b, 0x4a, 0x00, 0x2c, 0x00, 0x20,
+    0x00, 0x13, 0x00, 0x0c, 0x00, 0x79, 0xe9, 0x48, 0x37, 0x1e, 0x39, 0x69, 0x77, 0xe1, 0x40, 0x06,
+    0x02, 0xfa, 0x28, 0x80, 0x18, 0xeb, 0x28, 0x00, 0x9f, 0xf4, 0x48, 0x17, 0x79, 0x04, 0x00, 0xef,
+    0x48, 0x94, 0x9e, 0xf9, 0x9e, 0xf2, 0x68, 0x10, 0x00, 0x8b, 0x9e, 0x06, 0x00, 0xf5, 0x48, 0x67,
+    0x1b, 0x04, 0x00, 0xeb, 0x28, 0x6d, 0x17, 0xe1, 0x40, 0x06, 0x02, 0xf4, 0x28, 0x91, 0xa1, 0xe8,
+    0x28, 0x83, 0x8e, 0xed, 0x40, 0x0e, 0x02, 0x69, 0x68, 0xf3, 0x48, 0x04, 0x00, 0x4f, 0x18, 0xe9,
+    0x28, 0x7f, 0x05, 0xe1, 0x41, 0x07, 0x02, 0x79, 0xf5, 0x28, 0xf9, 0xa0, 0xe8, 0x48, 0x97, 0x1b,
+    0xc9, 0xa2, 0xe7, 0x40, 0xdf, 0x02, 0x69, 0x68, 0x63, 0x6f, 0xf4, 0x21, 0x01, 0xae, 0xa0, 0x59,
+    0x3b, 0x27, 0x0d, 0x05, 0xf5, 0x40, 0x02, 0xa2, 0xe2, 0x28, 0xad, 0xa2, 0xef, 0x88, 0x0d, 0x00,
+    0xa6, 0x77, 0x08, 0x00, 0x55, 0x48, 0x73, 0xe9, 0x28, 0x4b, 0x18, 0xeb, 0x48, 0x04, 0x00, 0xd8,
+    0x9c, 0x69, 0xe8, 0x28, 0x83, 0x76, 0xe9, 0x40, 0x0e, 0x02, 0xe7, 0x68, 0x06, 0x00, 0xee, 0x0a,
+    0x03, 0xa2, 0xe5, 0x28, 0x72, 0x51, 0xe1, 0x28, 0xbe, 0x1d, 0xe5, 0x60, 0x12, 0x09, 0x03, 0x6e,
+    0x75, 0xe6, 0x28, 0xef, 0x16, 0xeb, 0x20, 0x01, 0x75, 0x73, 0xf4, 0x28, 0xe1, 0x1d, 0xe9, 0x20,
+    0x01, 0xe9, 0x20, 0x01, 0xea, 0x28, 0xbc, 0x9f, 0xe1, 0xe0, 0x07, 0x68, 0x64, 0x51, 0x33, 0x26,
+    0x15, 0x07, 0xf9, 0x48, 0x04, 0x00, 0x49, 0x01, 0x69, 0x6d, 0x6f, 0x6e, 0xf5, 0x28, 0xee, 0x33,
+    0x77, 0xe1, 0x40, 0x0a, 0x02, 0x7a, 0xe5, 0x20, 0x01, 0xee, 0x28, 0x0a, 0x1b, 0xeb, 0x28, 0x10,
+    0x0c, 0xf4, 0x40, 0x06, 0x02, 0xe9, 0x28, 0xde, 0x9d, 0x61, 0xeb, 0x28, 0xb8, 0x1b, 0xf2, 0x68,
+    0x06, 0x00, 0xf3, 0x00, 0xc0, 0x0c, 0xe1, 0x40, 0x08, 0x02, 0x77, 0x61, 0xf4, 0x28, 0xe3, 0x0b,
+    0x62, 0x6f, 0x69, 0x68, 0x73, 0xf5, 0x20, 0x01, 0xf3, 0x28, 0x97, 0x9f, 0xed, 0x40, 0x06, 0x02,
+    0xf5, 0x28, 0x46, 0x1b, 0x61, 0xf9, 0x48, 0x0b, 0xa2, 0x04, 0x00, 0xf5, 0x28, 0xe3, 0x35, 0xeb,
+    0x28, 0xdc, 0xa0, 0xe7, 0x48, 0x04, 0x00, 0x65, 0x17, 0xe1, 0x48, 0xdd, 0xa0, 0x04, 0x00, 0xeb,
+    0x28, 0xd3, 0x17, 0x61, 0x79, 0x69, 0xed, 0x21, 0x01, 0xae, 0xa0, 0x76, 0x6b, 0x3c, 0x24, 0x05,
+    0xf5, 0x40, 0x19, 0x02, 0xeb, 0x40, 0x0d, 0x02, 0x75, 0x68, 0x73, 0x61, 0x6b, 0x69, 0x68, 0xe3,
+    0x28, 0x6d, 0xa0, 0x69, 0x72, 0x6e, 0x61, 0xf3, 0x28, 0x00, 0x1c, 0xe6, 0x28, 0x21, 0x9d, 0xef,
+    0x68, 0x2d, 0x9e, 0x11, 0x00, 0x06, 0x00, 0xf4, 0x48, 0xd9, 0x12, 0x04, 0x00, 0x6f, 0xed, 0x28,
+    0x66, 0x3e, 0x6a, 0xe1, 0x28, 0x31, 0x0a, 0xe9, 0x88, 0x29, 0x00, 0x18, 0x00, 0xe7, 0x1c, 0x08,
+    0x00, 0xf2, 0x48, 0xf4, 0x03, 0x04, 0x00, 0xef, 0x48, 0x04, 0x00, 0xdf, 0x9d, 0xed, 0x28, 0x1b,
+    0x08, 0x6b, 0xe1, 0x40, 0x08, 0x02, 0xf3, 0x48, 0x52, 0x18, 0x8a, 0xa1, 0x6d, 0x6f, 0xee, 0x28,
+    0x93, 0x0e, 0xe8, 0x28, 0xbc, 0x1a, 0xe5, 0x48, 0x9b, 0x1b, 0x04, 0x00, 0x6e, 0xe9, 0x28, 0xd3,
+    0x08, 0xe1, 0xc0, 0x5e, 0x3c, 0x2c, 0x25, 0x10, 0x06, 0xf9, 0x48, 0x85, 0x1b, 0x04, 0x00, 0xf5,
+    0x28, 0x14, 0x13, 0xf7, 0x48, 0x04, 0x00, 0xec, 0x8c, 0xe1, 0x40, 0x06, 0x02, 0xeb, 0x28, 0xc9,
+    0x0d, 0xe7, 0x20, 0x01, 0xe1, 0x28, 0xbc, 0xa0, 0x74, 0xe1, 0x48, 0xed, 0x0c, 0x1f, 0x0b, 0xf2,
+    0x40, 0x06, 0x02, 0xe9, 0x28, 0xfc, 0x0a, 0x61, 0xf7, 0x20, 0x01, 0xe1, 0x28, 0x6d, 0x3d, 0xed,
+    0x60, 0x13, 0x08, 0x03, 0x75, 0xee, 0x28, 0x9b, 0x15, 0x69, 0x68, 0x73, 0x75, 0x73, 0x74, 0x61,
+    0xed, 0x29, 0x84, 0x19, 0xe1, 0x48, 0x04, 0x00, 0xb5, 0x9f, 0xe7, 0x20, 0x01, 0xef, 0x28, 0xaf,
+    0x9f, 0x64, 0xf5, 0x28, 0x77, 0x15, 0xe3, 0x28, 0xf9, 0x9c, 0x61, 0x64, 0x6e, 0xe5, 0x20, 0x01,
+    0xf3, 0x2a, 0x97, 0x14, 0x35, 0x34, 0x75, 0xf2, 0x28, 0x07, 0x98, 0xe8, 0xa0, 0x1d, 0x16, 0x11,
+    0x09, 0x05, 0xf3, 0x28, 0x90, 0x39, 0x36, 0x31, 0x71, 0x71, 0xec, 0x28, 0xea, 0x97, 0x32, 0x32,
+    0xf4, 0x20, 0x2b, 0x31, 0x33, 0x79, 0xee, 0x28, 0xf6, 0x98, 0x30, 0x33, 0x70, 0x76, 0xb2, 0x28,
+    0x84, 0x97, 0xe7, 0x88, 0x15, 0x00, 0x0f, 0x00, 0xa3, 0x9f, 0x08, 0x00, 0x6f, 0x6c, 0x62, 0xec,
+    0x28, 0x4e, 0x6e, 0x37, 0x31, 0xf1, 0x28, 0x99, 0x1c, 0x33, 0xfa, 0x20, 0x01, 0x73, 0xe9, 0x28,
+    0xac, 0x81, 0xe5, 0xe8, 0x0e, 0x7b, 0x03, 0x69, 0x03, 0x61, 0x03, 0x5a, 0x03, 0x54, 0x03, 0x92,
+    0x02, 0x8c, 0x02, 0x84, 0x02, 0xeb, 0x01, 0x2e, 0x01, 0x24, 0x01, 0x46, 0x7f, 0x25, 0x00, 0x1c,
+    0x00, 0x75, 0x6c, 0xe2, 0x20, 0x01, 0xf9, 0x28, 0xcf, 0x6b, 0xf4, 0x80, 0x14, 0x0f, 0x0a, 0x04,
+    0x74, 0x6f, 0xe3, 0x28, 0x6b, 0xa0, 0x73, 0xe1, 0x28, 0xf5, 0x9d, 0x69, 0xf3, 0x28, 0xa6, 0x1f,
+    0x61, 0x77, 0xe9, 0x21, 0x01, 0xae, 0xa0, 0xa0, 0x8c, 0x22, 0x0c, 0x05, 0xf5, 0x20, 0x01, 0xe8,
+    0x28, 0xa4, 0x9e, 0xef, 0x68, 0x4d, 0x15, 0x0d, 0x00, 0x06, 0x00, 0x74, 0x61, 0x6e, 0xf5, 0x28,
+    0xc6, 0x95, 0x6e, 0xef, 0x48, 0xd9, 0x17, 0x56, 0xa0, 0xe9, 0xa0, 0x55, 0x41, 0x34, 0x16, 0x05,
+    0xed, 0x40, 0x0b, 0x02, 0x75, 0x7a, 0x69, 0xe1, 0x48, 0xc5, 0x17, 0xac, 0x14, 0xe1, 0x28, 0x71,
+    0x0d, 0xeb, 0x40, 0x07, 0x02, 0x65, 0xf3, 0x28, 0x3a, 0x1b, 0xe1, 0x40, 0x08, 0x02, 0x73, 0x61,
+    0xe7, 0x28, 0x9b, 0x0d, 0xed, 0x48, 0x65, 0x1b, 0x04, 0x00, 0x75, 0xfa, 0x28, 0x34, 0x91, 0xea,
+    0x48, 0x04, 0x00, 0x30, 0x91, 0xef, 0x20, 0x01, 0xe2, 0x28, 0xc7, 0x90, 0xe8, 0x40, 0x0e, 0x02,
+    0x73, 0xe9, 0x48, 0x17, 0x1b, 0x04, 0x00, 0x75, 0xeb, 0x28, 0x8d, 0x14, 0xe3, 0x28, 0x1e, 0x9e,
+    0xe1, 0x68, 0x0d, 0x00, 0x06, 0x00, 0xbb, 0x16, 0xed, 0x20, 0x01, 0xf5, 0x28, 0xf4, 0x65, 0xe4,
+    0x28, 0x6c, 0x92, 0xe5, 0x48, 0x04, 0x00, 0x4a, 0x14, 0x68, 0x6f, 0xee, 0x48, 0x04, 0x00, 0xf4,
+    0x90, 0xe9, 0x48, 0x67, 0x1b, 0xb2, 0x9f, 0xe1, 0xa0, 0x3b, 0x35, 0x30, 0x12, 0x05, 0xf7, 0x48,
+    0x04, 0x00, 0x5e, 0x9e, 0x61, 0xf3, 0x48, 0x54, 0x17, 0x31, 0x15, 0xf4, 0x40, 0x06, 0x02, 0xe9,
+    0x28, 0x8b, 0x99, 0xe1, 0x40, 0x0f, 0x02, 0x6b, 0x61, 0x74, 0x6e, 0x65, 0x7a, 0xf5, 0x20, 0x01,
+    0xeb, 0x28, 0xfc, 0x9a, 0x68, 0xef, 0x28, 0xea, 0x10, 0x6b, 0xef, 0x28, 0x67, 0x18, 0xe4, 0x48,
+    0x46, 0x3c, 0xff, 0x9e, 0x62, 0xe1, 0x28, 0x80, 0x1f, 0x72, 0x6f, 0x74, 0x73, 0x6e, 0x6f, 0xe9,
+    0x28, 0xa8, 0x3d, 0xee, 0x61, 0x9f, 0x07, 0x03, 0xee, 0x28, 0xf9, 0x9e, 0x61, 0x6d, 0x69, 0x68,
+    0xf3, 0x21, 0x01, 0xae, 0xc0, 0x5a, 0x50, 0x35, 0x2f, 0x12, 0x06, 0xf5, 0x40, 0x06, 0x02, 0xf9,
+    0x28, 0xb9, 0x0f, 0xf3, 0x28, 0x77, 0x7a, 0xef, 0x60, 0x0d, 0x07, 0x03, 0xf4, 0x28, 0x74, 0x10,
+    0x6e, 0x61, 0xf7, 0x28, 0xb6, 0x14, 0x6d, 0xf5, 0x48, 0xff, 0x0f, 0x04, 0x00, 0x7a, 0xe9, 0x49,
+    0xa6, 0x17, 0xa0, 0x0c, 0x6e, 0x61, 0xee, 0x28, 0x1e, 0x72, 0xe9, 0x60, 0x0f, 0x08, 0x03, 0x6d,
+    0xe9, 0x28, 0xcc, 0x17, 0x6b, 0x6f, 0x6e, 0xe9, 0x28, 0x92, 0x13, 0xe7, 0x48, 0xed, 0x0f, 0x04,
+    0x00, 0xf5, 0x28, 0x6b, 0x11, 0xe5, 0x48, 0x04, 0x00, 0x80, 0x19, 0xee, 0x28, 0xab, 0x15, 0xe1,
+    0x80, 0x27, 0x1c, 0x0b, 0x04, 0xf7, 0x20, 0x01, 0xe1, 0x28, 0xa4, 0x17, 0xed, 0x48, 0x0f, 0x9f,
+    0x04, 0x00, 0x69, 0x68, 0x73, 0x6f, 0x6e, 0xe9, 0x48, 0x7e, 0x18, 0x66, 0x98, 0xeb, 0x20, 0x01,
+    0x75, 0xf3, 0x20, 0x01, 0xf4, 0x28, 0x8f, 0x9a, 0xe4, 0x68, 0x90, 0x18, 0xa7, 0x08, 0x06, 0x00,
+    0xf5, 0x28, 0xc5, 0x72, 0xae, 0x40, 0x13, 0x02, 0x74, 0x65, 0x6e, 0x69, 0x65, 0x73, 0xe1, 0x20,
+    0x01, 0xae, 0x20, 0x01, 0x72, 0xe5, 0x28, 0x00, 0x90, 0x6e, 0x72, 0x69, 0xe8, 0x28, 0x8c, 0x9d,
+    0x6d, 0x69, 0x68, 0xe5, 0x21, 0x01, 0xae, 0xc0, 0x5e, 0x5b, 0x47, 0x33, 0x12, 0x06, 0xf5, 0x40,
+    0x06, 0x02, 0xfa, 0x28, 0xae, 0x9e, 0x6b, 0xef, 0x20, 0xc2, 0xef, 0xa0, 0x1b, 0x17, 0x13, 0x0a,
+    0x05, 0x79, 0xe9, 0x29, 0x57, 0x99, 0x75, 0x68, 0x63, 0x75, 0x6b, 0xef, 0x28, 0x2e, 0x9d, 0xee,
+    0x28, 0xf6, 0x18, 0xeb, 0x28, 0xf4, 0x04, 0xea, 0x28, 0x18, 0x44, 0xee, 0x68, 0x0d, 0x00, 0x06,
+    0x00, 0x35, 0x7c, 0x65, 0x67, 0x6f, 0xeb, 0x28, 0x6b, 0x15, 0x61, 0xee, 0x28, 0x4d, 0x8c, 0xe9,
+    0x60, 0x0e, 0x09, 0x03, 0x72, 0x61, 0xe2, 0x28, 0x57, 0x4e, 0x6b, 0xe1, 0x28, 0x4a, 0x72, 0xe1,
+    0x28, 0x86, 0x20, 0xe5, 0x20, 0xfb, 0xe1, 0x40, 0x09, 0x02, 0x74, 0x61, 0x6b, 0xe9, 0x29, 0xcf,
+    0x9b, 0xed, 0x40, 0x0d, 0x02, 0x69, 0xea, 0x48, 0x04, 0x00, 0xad, 0x17, 0xe1, 0x28, 0x6a, 0x74,
+    0xe1, 0x40, 0x06, 0x02, 0xf9, 0x28, 0xa1, 0x18, 0xe8, 0x48, 0x04, 0x00, 0x19, 0x11, 0x61, 0xf4,
+    0x20, 0x01, 0xe1, 0x20, 0x01, 0xf7, 0x28, 0xce, 0x99, 0x6c, 0x61, 0x73, 0x72, 0xe5, 0x28, 0x35,
+    0x3d, 0x6b, 0x69, 0xec, 0x28, 0x67, 0x97, 0xe9, 0x40, 0xbb, 0x02, 0xed, 0x21, 0x01, 0xae, 0xa8,
+    0x7c, 0x00, 0x6b, 0x00, 0x2f, 0x00, 0x0a, 0x00, 0x7a, 0x13, 0xef, 0x68, 0xdb, 0x15, 0x1f, 0x00,
+    0x06, 0x00, 0xee, 0x68, 0xef, 0x14, 0x10, 0x00, 0x06, 0x00, 0xef, 0x48, 0x04, 0x00, 0x3b, 0x83,
+    0xe4, 0x28, 0x40, 0x9b, 0x69, 0x68, 0x73, 0xe5, 0x28, 0xa0, 0x9a, 0xe8, 0x28, 0x65, 0x99, 0xe9,
+    0xa0, 0x32, 0x2d, 0x20, 0x0b, 0x05, 0x72, 0x61, 0xe2, 0x28, 0x57, 0x9b, 0xeb, 0x48, 0x04, 0x00,
+    0x63, 0x89, 0xe1, 0x68, 0x29, 0x0e, 0x06, 0x00, 0xd7, 0x9d, 0xf3, 0x20, 0x01, 0xef, 0x28, 0xa1,
+    0x17, 0xe8, 0x48, 0x92, 0x18, 0x04, 0x00, 0x63, 0x69, 0x61, 0xeb, 0x28, 0x5f, 0x9b, 0x67, 0xf5,
+    0x28, 0xad, 0x7b, 0x61, 0xf2, 0x20, 0x01, 0xe1, 0x28, 0xc1, 0x49, 0xe5, 0x68, 0x0b, 0x00, 0x65,
+    0x10, 0x06, 0x00, 0x73, 0xe9, 0x29, 0xd3, 0x17, 0xe2, 0x28, 0xf9, 0x12, 0xe1, 0xa0, 0x32, 0x28,
+    0x12, 0x0c, 0x05, 0x77, 0xe9, 0x48, 0x8a, 0x9a, 0x0f, 0x99, 0x6e, 0x61, 0xf7, 0x28, 0xa3, 0x8e,
+    0xed, 0x48, 0x04, 0x00, 0x1c, 0x9c, 0xe1, 0x48, 0x29, 0x19, 0x04, 0x00, 0xf9, 0x48, 0x04, 0x00,
+    0x69, 0x9d, 0xe5, 0x28, 0xac, 0x18, 0xeb, 0x48, 0x04, 0x00, 0xe7, 0x71, 0xe1, 0x28, 0x47, 0x0b,
+    0xe2, 0x28, 0x01, 0x9d, 0x62, 0xed, 0x28, 0xf0, 0x48, 0x65, 0x77, 0xe5, 0x28, 0xd6, 0x9c, 0x64,
+    0x61, 0x6d, 0xf9, 0x28, 0x26, 0x7a, 0x62, 0xef, 0x20, 0x01, 0xeb, 0x2a, 0xdd, 0x10, 0xb5, 0x40,
+    0x09, 0x02, 0x39, 0x6e, 0x79, 0xb7, 0x28, 0x9e, 0x9d, 0x31, 0x61, 0x34, 0xed, 0x28, 0xdf, 0x93,
+    0x31, 0xb6, 0x20, 0x6b, 0xe4, 0xe8, 0x09, 0x6b, 0x00, 0x64, 0x00, 0x52, 0x00, 0x45, 0x00, 0x3b,
+    0x00, 0x36, 0x9d, 0x30, 0x00, 0x18, 0x00, 0x12, 0x00, 0x6f, 0x6f, 0xe6, 0x28, 0x23, 0x92, 0xee,
+    0x48, 0x04, 0x00, 0xec, 0x9b, 0x65, 0x69, 0x72, 0xe6, 0x40, 0x06, 0x02, 0xf9, 0x28, 0xc8, 0x9b,
+    0xec, 0x20, 0x01, 0xf2, 0x28, 0x3d, 0x88, 0xe5, 0x21, 0x01, 0x74, 0x66, 0x61, 0x72, 0xe3, 0x28,
+    0x39, 0x45, 0x38, 0x36, 0xb1, 0x20, 0x01, 0x74, 0xe9, 0x28, 0xfc, 0x9c, 0xb7, 0x40, 0x06, 0x02,
+    0xf0, 0x28, 0xa0, 0x18, 0x38, 0xb7, 0x28, 0x9b, 0x18, 0xb5, 0x40, 0x09, 0x02, 0x34, 0x30, 0x73,
+    0xea, 0x28, 0x6a, 0x92, 0x32, 0x30, 0x78, 0xe2, 0x28, 0x07, 0x95, 0xb3, 0x20, 0x01, 0xf4, 0x28,
+    0x86, 0x7d, 0x31, 0xb7, 0x20, 0x01, 0x73, 0x71, 0xec, 0x28, 0x2f, 0x9d, 0xe3, 0xc8, 0x30, 0x00,
+    0x26, 0x00, 0x1b, 0x00, 0x11, 0x00, 0xbf, 0x9c, 0x0c, 0x00, 0x6d, 0xf0, 0x28, 0x7a, 0x34, 0x39,
+    0x34, 0xf0, 0x20, 0x01, 0x74, 0xf2, 0x28, 0x35, 0x92, 0x36, 0x37, 0x38, 0x7a, 0x37, 0x76, 0x71,
+    0xb5, 0x28, 0xde, 0x94, 0x34, 0x36, 0x32, 0x61, 0x30, 0x74, 0xb7, 0x28, 0x80, 0x9d, 0x32, 0x30,
+    0x34, 0xf5, 0x28, 0x36, 0x2f, 0xe2, 0x28, 0x58, 0x96, 0xe1, 0xe8, 0x10, 0x49, 0x18, 0x42, 0x18,
+    0x3a, 0x18, 0x32, 0x18, 0x74, 0x98, 0x30, 0x16, 0x26, 0x16, 0x74, 0x14, 0x13, 0x10, 0x7e, 0x07,
+    0x74, 0x07, 0x6e, 0x07, 0x68, 0x06, 0x28, 0x03, 0x2d, 0x00, 0x20, 0x00, 0xf9, 0x48, 0x04, 0x00,
+    0xd8, 0x9b, 0x6f, 0x67, 0x61, 0xee, 0x2a, 0xe2, 0x0f, 0x77, 0xe1, 0x68, 0x91, 0x01, 0x1d, 0x01,
+    0x06, 0x00, 0x6e, 0x69, 0x6b, 0xef, 0x21, 0x01, 0xae, 0xc0, 0xbd, 0xaf, 0x63, 0x43, 0x2e, 0x06,
+    0xf5, 0x60, 0x22, 0x11, 0x03, 0x72, 0x61, 0xe2, 0x40, 0x06, 0x02, 0xe5, 0x28, 0x4d, 0x75, 0xe1,
+    0x28, 0xa6, 0x05, 0x6b, 0x75, 0x73, 0x75, 0xe7, 0x48, 0x04, 0x00, 0x37, 0x16, 0x61, 0x6b, 0x61,
+    0xee, 0x29, 0xa3, 0x15, 0xe2, 0x28, 0xed, 0x4a, 0xef, 0x68, 0x5d, 0x95, 0x0f, 0x00, 0x06, 0x00,
+    0x74, 0x69, 0x61, 0xe4, 0x48, 0x90, 0x15, 0x34, 0x16, 0xea, 0x28, 0x1c, 0x29, 0xee, 0x40, 0x0d,
+    0x02, 0xe9, 0x48, 0x04, 0x00, 0x72, 0x97, 0x6a, 0xe9, 0x28, 0x5e, 0x64, 0xe1, 0x60, 0x0b, 0x06,
+    0x03, 0xf7, 0x20, 0x71, 0x74, 0xe9, 0x28, 0xb6, 0x83, 0xed, 0x28, 0xb3, 0x04, 0xe9, 0xa8, 0x3a,
+    0x14, 0x46, 0x00, 0x32, 0x00, 0x11, 0x00, 0x0a, 0x00, 0x6e, 0x75, 0x67, 0xe1, 0x29, 0x49, 0x05,
+    0xed, 0x60, 0x0c, 0x08, 0x03, 0x6f, 0xf4, 0x28, 0x55, 0x0a, 0xe9, 0x28, 0xee, 0x37, 0xe1, 0x68,
+    0x0d, 0x00, 0x06, 0x00, 0xc1, 0x01, 0x6b, 0x69, 0x68, 0xf3, 0x28, 0x24, 0x86, 0xe7, 0x28, 0x4f,
+    0x08, 0xeb, 0x40, 0x08, 0x02, 0x69, 0x68, 0xf3, 0x28, 0x35, 0x04, 0xe1, 0x48, 0x04, 0x00, 0xe2,
+    0x24, 0xe7, 0x28, 0xa0, 0x08, 0xea, 0x28, 0xf6, 0x16, 0xe5, 0x40, 0x07, 0x02, 0x73, 0xe5, 0x28,
+    0x25, 0x97, 0x6f, 0xf3, 0x28, 0x74, 0x15, 0xe1, 0xe0, 0x07, 0x4b, 0x39, 0x2d, 0x22, 0x17, 0x11,
+    0x07, 0xfa, 0x20, 0x01, 0xef, 0x20, 0x01, 0xee, 0x28, 0xa9, 0x86, 0x79, 0x65, 0xe8, 0x28, 0x18,
+    0x9a, 0x77, 0xe1, 0x48, 0x04, 0x00, 0xc7, 0x94, 0xeb, 0x28, 0x69, 0x08, 0x72, 0xe1, 0x48, 0x04,
+    0x00, 0xdf, 0x12, 0xe8, 0x28, 0xcf, 0x14, 0xee, 0x48, 0x04, 0x00, 0xb9, 0x9a, 0xe5, 0x48, 0xf6,
+    0x12, 0x46, 0x12, 0xed, 0x60, 0x0c, 0x07, 0x03, 0xf5, 0x28, 0xef, 0x97, 0x69, 0xea, 0x28, 0xa8,
+    0x0b, 0xe1, 0x28, 0x03, 0x65, 0xe8, 0x28, 0xaa, 0x98, 0x6b, 0x69, 0x68, 0x73, 0xe9, 0x21, 0x01,
+    0xae, 0xa0, 0x43, 0x2e, 0x29, 0x1b, 0x05, 0xf5, 0x68, 0x2f, 0x04, 0x1c, 0x09, 0x06, 0x00, 0xfa,
+    0x48, 0x04, 0x00, 0xee, 0x94, 0x69, 0xed, 0x20, 0x01, 0xe1, 0x28, 0x08, 0x8e, 0xef, 0x40, 0x08,
+    0x02, 0x74, 0x6f, 0xee, 0x29, 0x02, 0x0b, 0xe1, 0x28, 0x1e, 0x28, 0x6e, 0x61, 0xf3, 0x20, 0x0b,
+    0xe9, 0x88, 0x3c, 0x0e, 0x0b, 0x00, 0x8f, 0x8f, 0x08, 0x00, 0xf5, 0x20, 0x87, 0x68, 0x63, 0x69,
+    0x6f, 0xee, 0x28, 0x4c, 0x9a, 0xe1, 0xc8, 0x21, 0x00, 0x2f, 0x0b, 0x74, 0x99, 0x1d, 0x00, 0x13,
+    0x00, 0x0c, 0x00, 0x77, 0x61, 0x7a, 0xe1, 0x28, 0x00, 0x14, 0xf4, 0x48, 0x72, 0x03, 0x04, 0x00,
+    0xe9, 0x28, 0x22, 0x05, 0xed, 0x28, 0x81, 0x08, 0x64, 0xe1, 0x28, 0x1b, 0x01, 0x67, 0xe1, 0x40,
+    0xd5, 0x02, 0x6e, 0x61, 0xeb, 0x21, 0x01, 0xae, 0x80, 0x4e, 0x3c, 0x11, 0x04, 0xef, 0x68, 0x06,
+    0x00, 0x91, 0x04, 0x44, 0x07, 0x6e, 0xe1, 0x28, 0x1c, 0x21, 0xe9, 0xe8, 0x07, 0x9a, 0x0a, 0x23,
+    0x00, 0x1b, 0x00, 0x16, 0x00, 0x0e, 0x00, 0x95, 0x9a, 0x7b, 0x01, 0x6b, 0x61, 0x73, 0x61, 0xe7,
+    0x28, 0x81, 0x70, 0x68, 0xf3, 0x28, 0x20, 0x72, 0xe7, 0x20, 0x01, 0x75, 0xf3, 0x28, 0x6e, 0x96,
+    0x65, 0xf3, 0x28, 0x3c, 0x12, 0xe5, 0x40, 0x06, 0x02, 0x73, 0xe1, 0x20, 0xfe, 0xee, 0x20, 0x01,
+    0xef, 0x20, 0x01, 0xeb, 0x28, 0x85, 0x73, 0xe1, 0xe0, 0x08, 0x77, 0x6b, 0x67, 0x5f, 0x2e, 0x28,
+    0x0f, 0x08, 0x79, 0x69, 0x6d, 0xef, 0x28, 0x95, 0x98, 0x77, 0xe1, 0x40, 0x06, 0x02, 0xf3, 0x28,
+    0xdb, 0x11, 0xeb, 0x68, 0x16, 0x88, 0x0a, 0x00, 0x06, 0x00, 0xf5, 0x28, 0xa2, 0x91, 0xef, 0x28,
+    0xd3, 0x13, 0x74, 0x69, 0xeb, 0x28, 0xe0, 0x36, 0xf2, 0x40, 0x0c, 0x02, 0xf5, 0x48, 0x19, 0x9a,
+    0x04, 0x00, 0xeb, 0x28, 0x36, 0x15, 0xe1, 0x60, 0x19, 0x0e, 0x03, 0x77, 0xe1, 0x48, 0xc5, 0x95,
+    0x04, 0x00, 0xe7, 0x28, 0xa5, 0x0f, 0xe8, 0x48, 0x4d, 0x87, 0x04, 0x00, 0x69, 0xed, 0x28, 0x65,
+    0x03, 0x67, 0x69, 0x68, 0x73, 0xe1, 0x28, 0x32, 0x14, 0xee, 0x20, 0x01, 0x69, 0xe2, 0x28, 0xb9,
+    0x99, 0xed, 0x28, 0x5b, 0x96, 0x6b, 0x75, 0xf3, 0x48, 0x8f, 0x97, 0x04, 0x00, 0xf4, 0x28, 0x6c,
+    0x11, 0xe4, 0x28, 0x44, 0x14, 0xeb, 0x21, 0x01, 0xae, 0xa0, 0x64, 0x5a, 0x33, 0x1d, 0x05, 0xf5,
+    0x40, 0x06, 0x02, 0xfa, 0x28, 0x7e, 0x46, 0x73, 0xf4, 0x40, 0x06, 0x02, 0xef, 0x28, 0x99, 0x11,
+    0xe1, 0x20, 0x01, 0xed, 0x28, 0x80, 0x12, 0xef, 0x60, 0x0e, 0x0a, 0x03, 0xf9, 0x20, 0x01, 0xef,
+    0x28, 0x6c, 0x6e, 0xee, 0x28, 0xc1, 0x42, 0x68, 0x73, 0xef, 0x28, 0xf4, 0x22, 0xe9, 0x60, 0x15,
+    0x10, 0x03, 0x6d, 0xef, 0x20, 0x01, 0xee, 0x20, 0x01, 0x69, 0x68, 0xe3, 0x28, 0xe5, 0x96, 0x6b,
+    0xf5, 0x28, 0x82, 0x6e, 0xea, 0x40, 0x0a, 0x02, 0x75, 0x73, 0x74, 0x6e, 0xe5, 0x28, 0xf3, 0x95,
+    0xee, 0x28, 0xdb, 0x08, 0x65, 0x6d, 0x61, 0xe7, 0x20, 0x01, 0xf5, 0x28, 0x6f, 0x78, 0xe1, 0x60,
+    0x1c, 0x12, 0x03, 0x77, 0x61, 0x67, 0xe1, 0x40, 0x06, 0x02, 0xf9, 0x28, 0x71, 0x99, 0xeb, 0x28,
+    0xc6, 0x11, 0x72, 0x69, 0xe8, 0x20, 0x01, 0x6f, 0xf4, 0x28, 0xa0, 0x7e, 0x6d, 0x69, 0x68, 0x73,
+    0xef, 0x28, 0xcf, 0x96, 0xf4, 0x48, 0x59, 0x01, 0x04, 0x00, 0xe9, 0x40, 0x87, 0x02, 0xef, 0x21,
+    0x01, 0xae, 0xa0, 0x49, 0x3a, 0x1d, 0x18, 0x05, 0xf5, 0x88, 0x0d, 0x00, 0xd0, 0x13, 0x08, 0x00,
+    0x59, 0x11, 0x70, 0xf0, 0x28, 0xfc, 0x61, 0xe6, 0x28, 0xc0, 0x0e, 0x6f, 0x6e, 0xef, 0x20, 0x5c,
+    0xe9, 0x60, 0x17, 0x0a, 0x03, 0xed, 0x20, 0x01, 0xf5, 0x28, 0x5d, 0x04, 0xeb, 0x68, 0x06, 0x00,
+    0xa3, 0x3e, 0x3d, 0x0e, 0x61, 0xf3, 0x28, 0xb7, 0x05, 0xea, 0x28, 0xd9, 0x6d, 0xe5, 0x40, 0x07,
+    0x02, 0x75, 0xf3, 0x28, 0xcc, 0x0a, 0x6f, 0x6e, 0xef, 0x28, 0xd1, 0x11, 0xe1, 0x88, 0x26, 0x00,
+    0x14, 0x00, 0x29, 0x8a, 0x08, 0x00, 0xf4, 0x48, 0x85, 0x07, 0x04, 0x00, 0xe9, 0x48, 0xca, 0x97,
+    0xe4, 0x98, 0xed, 0x40, 0x0c, 0x02, 0x69, 0x68, 0xf3, 0x20, 0x01, 0x65, 0xed, 0x28, 0xa6, 0x6d,
+    0xe1, 0x28, 0xf9, 0x6f, 0x64, 0x61, 0x6b, 0x61, 0xf4, 0x20, 0x01, 0x6f, 0xe7, 0x20, 0x01, 0xee,
+    0x28, 0xa1, 0x8b, 0xeb, 0x48, 0x04, 0x00, 0x0a, 0x97, 0xe1, 0x21, 0x01, 0xae, 0xc0, 0x8a, 0x66,
+    0x4e, 0x48, 0x18, 0x06, 0xf5, 0x40, 0x07, 0x02, 0x6f, 0xf0, 0x28, 0x56, 0x1b, 0x6b, 0x6f, 0xe2,
+    0x20, 0x01, 0xed, 0x28, 0x57, 0x93, 0xef, 0xc0, 0x29, 0x1e, 0x19, 0x13, 0x0a, 0x06, 0xf9, 0x28,
+    0xd6, 0x0a, 0x74, 0x61, 0x73, 0xe9, 0x48, 0x27, 0x10, 0x83, 0x98, 0x72, 0x69, 0xe8, 0x28, 0xdf,
+    0x0f, 0x6e, 0xf5, 0x28, 0xb8, 0x5e, 0x6a, 0x6e, 0x6f, 0xe8, 0x21, 0x01, 0x69, 0xf2, 0x28, 0x0a,
+    0x0e, 0x68, 0xe1, 0x28, 0xa1, 0x92, 0x6e, 0x65, 0xf3, 0x28, 0x02, 0x0f, 0xe9, 0x60, 0x10, 0x0a,
+    0x03, 0x6e, 0x61, 0x6f, 0xeb, 0x28, 0xbf, 0x11, 0x6d, 0x61, 0xe7, 0x28, 0x3b, 0x04, 0x68, 0x73,
+    0xef, 0x28, 0x1e, 0x11, 0xe5, 0x80, 0x1c, 0x15, 0x0e, 0x04, 0xf4, 0x48, 0x04, 0x00, 0xec, 0x95,
+    0xe1, 0x28, 0xf1, 0x93, 0x73, 0x75, 0x72, 0xe1, 0x28, 0x89, 0x01, 0xee, 0x20, 0x01, 0xe1, 0x28,
+    0xed, 0x6c, 0x6d, 0x6f, 0xea, 0x28, 0xe7, 0x97, 0xe1, 0x88, 0x60, 0x34, 0x29, 0x00, 0x12, 0x00,
+    0x08, 0x00, 0xf7, 0x48, 0x27, 0x18, 0x04, 0x00, 0xef, 0x28, 0x25, 0x92, 0xf4, 0x40, 0x08, 0x02,
+    0x69, 0x6b, 0xe1, 0x29, 0xa1, 0x11, 0x61, 0x67, 0xef, 0x21, 0x01, 0xf2, 0x20, 0x01, 0x69, 0xe8,
+    0x28, 0xb7, 0x11, 0xeb, 0x40, 0x06, 0x02, 0xef, 0x28, 0x5c, 0x11, 0xe1, 0x28, 0x76, 0x10, 0x61,
+    0xe7, 0x40, 0xf6, 0x02, 0x69, 0x69, 0xee, 0x21, 0x01, 0xae, 0xc0, 0x9c, 0x8c, 0x56, 0x49, 0x13,
+    0x06, 0xf5, 0x40, 0x08, 0x02, 0x73, 0x74, 0xe5, 0x28, 0x98, 0x88, 0xef, 0x20, 0x12, 0xef, 0xe8,
+    0x07, 0x2f, 0x00, 0x29, 0x00, 0x25, 0x00, 0x19, 0x00, 0x0f, 0x13, 0x15, 0x00, 0x0e, 0x00, 0xf2,
+    0x20, 0x01, 0xe9, 0x28, 0x77, 0x92, 0xee, 0x28, 0xc6, 0x38, 0xeb, 0x40, 0x06, 0x02, 0xef, 0x28,
+    0x16, 0x97, 0xe9, 0x28, 0xa3, 0x17, 0xea, 0x28, 0x9c, 0x6c, 0x69, 0x68, 0xe3, 0x28, 0x45, 0x97,
+    0xe4, 0x28, 0xed, 0x93, 0xee, 0x40, 0x06, 0x02, 0xe5, 0x28, 0x13, 0x68, 0x61, 0xee, 0x28, 0xfb,
+    0x0c, 0xe9, 0x80, 0x2f, 0x25, 0x17, 0x04, 0xed, 0x48, 0x04, 0x00, 0x89, 0x97, 0xe1, 0x40, 0x07,
+    0x02, 0x6b, 0xe1, 0x28, 0x56, 0x01, 0xe7, 0x28, 0x0c, 0x83, 0x6b, 0x61, 0xfa, 0x40, 0x06, 0x02,
+    0xef, 0x28, 0x6d, 0x0e, 0xe1, 0x28, 0x10, 0x0f, 0x68, 0x63, 0x61, 0xed, 0x20, 0x01, 0xe1, 0x28,
+    0xb0, 0x13, 0x61, 0xee, 0x28, 0xec, 0x82, 0xe5, 0x40, 0x0a, 0x02, 0xed, 0x20, 0x01, 0x61, 0xe2,
+    0x28, 0xb9, 0x0c, 0xeb, 0x28, 0x04, 0x6c, 0xe1, 0xc8, 0x8f, 0x90, 0x43, 0x00, 0x3b, 0x00, 0x29,
+    0x00, 0x11, 0x00, 0x0c, 0x00, 0x79, 0xe9, 0x28, 0xad, 0x01, 0xf7, 0x48, 0x04, 0x00, 0xd2, 0x3d,
+    0xe1, 0x60, 0x08, 0x03, 0xa0, 0x6b, 0xe9, 0x28, 0xe5, 0x2e, 0x67, 0xe9, 0x20, 0x01, 0xef, 0x28,
+    0x22, 0x89, 0xf4, 0x40, 0x06, 0x02, 0xe9, 0x28, 0xc1, 0x95, 0xe1, 0x48, 0xbc, 0x02, 0x04, 0x00,
+    0xe7, 0x28, 0xf1, 0x09, 0x6d, 0x75, 0x6e, 0x6f, 0xf5, 0x29, 0x3f, 0x11, 0xeb, 0x40, 0x06, 0x02,
+    0xef, 0x28, 0xab, 0x12, 0xe9, 0x28, 0xe5, 0x8b, 0x61, 0x6d, 0x61, 0xf9, 0x21, 0x01, 0xae, 0xa0,
+    0x58, 0x36, 0x1e, 0x0e, 0x05, 0xf5, 0x20, 0x01, 0x6b, 0x6f, 0xe8, 0x28, 0xd1, 0x76, 0xef, 0x68,
+    0x0a, 0x00, 0x41, 0x07, 0x06, 0x00, 0xf9, 0x28, 0xff, 0x23, 0xe4, 0x28, 0xa9, 0x03, 0xe9, 0x60,
+    0x10, 0x0a, 0x03, 0xee, 0x20, 0x01, 0xf5, 0x28, 0x02, 0x33, 0xe8, 0x48, 0x99, 0x11, 0x41, 0x01,
+    0xe1, 0x48, 0x15, 0x90, 0x73, 0x0c, 0xe5, 0xa8, 0x1c, 0x00, 0x12, 0x00, 0x0e, 0x00, 0x0a, 0x00,
+    0xba, 0x96, 0xee, 0x28, 0x12, 0x0f, 0xe4, 0x28, 0xe4, 0x0c, 0xe2, 0x20, 0x01, 0xef, 0x20, 0x01,
+    0xee, 0x28, 0x54, 0x33, 0xe1, 0x28, 0x48, 0x10, 0xe1, 0xe0, 0x07, 0x80, 0x73, 0x5a, 0x51, 0x41,
+    0x0b, 0x07, 0xfa, 0x28, 0x25, 0x0c, 0x77, 0xe1, 0x60, 0x24, 0x1d, 0x03, 0xfa, 0x68, 0x0d, 0x00,
+    0x06, 0x00, 0x25, 0x96, 0xe5, 0x20, 0x01, 0xee, 0x28, 0x20, 0x95, 0x61, 0xee, 0x20, 0x01, 0xe1,
+    0x20, 0x01, 0xe2, 0x28, 0x6e, 0x96, 0x6b, 0xe9, 0x48, 0xee, 0x0f, 0x61, 0x96, 0xe7, 0x40, 0x09,
+    0x02, 0x6f, 0x72, 0x75, 0xed, 0x28, 0x50, 0x89, 0xe5, 0x28, 0xa2, 0x92, 0x74, 0xe1, 0x68, 0x06,
+    0x00, 0xee, 0x06, 0x9d, 0x92, 0x67, 0xe1, 0x48, 0x01, 0x33, 0xb8, 0x86, 0x72, 0x75, 0xeb, 0x20,
+    0x01, 0xe8, 0x28, 0x3f, 0x96, 0x6d, 0x61, 0xf9, 0x68, 0x0b, 0x00, 0xb4, 0x03, 0x06, 0x00, 0x6f,
+    0xee, 0x28, 0x93, 0x0f, 0xe1, 0x48, 0xa2, 0x5e, 0x04, 0x00, 0xf2, 0x28, 0x0f, 0x8b, 0xeb, 0x40,
+    0x06, 0x02, 0xef, 0x28, 0x6d, 0x09, 0x61, 0xf4, 0x28, 0x97, 0x09, 0x64, 0x69, 0xe8, 0x20, 0x01,
+    0xf3, 0x28, 0x9b, 0x5d, 0x72, 0xe1, 0x40, 0x07, 0x02, 0x72, 0xe9, 0x28, 0x68, 0x0a, 0xee, 0x21,
+    0x01, 0xae, 0x80, 0xa0, 0x91, 0x37, 0x04, 0xef, 0xc8, 0x27, 0x00, 0x23, 0x00, 0x58, 0x06, 0x1a,
+    0x00, 0x10, 0x00, 0x0c, 0x00, 0xf9, 0x28, 0x62, 0x03, 0x74, 0x6f, 0x6d, 0x61, 0x72, 0x61, 0xf7,
+    0x28, 0x73, 0x81, 0x6e, 0x69, 0x68, 0x73, 0x6f, 0xf9, 0x29, 0x3c, 0x0e, 0xe7, 0x28, 0xc6, 0x6a,
+    0xe4, 0x48, 0xd1, 0x88, 0x04, 0x00, 0xef, 0x28, 0x9f, 0x8a, 0xe9, 0xe8, 0x08, 0x4a, 0x00, 0x00,
+    0x07, 0x3c, 0x00, 0x38, 0x00, 0x2b, 0x00, 0x21, 0x00, 0x5b, 0x22, 0x10, 0x00, 0xf2, 0x68, 0x86,
+    0x02, 0x0b, 0x00, 0x06, 0x00, 0x75, 0xe7, 0x28, 0xa2, 0x7b, 0xef, 0x28, 0x21, 0x0e, 0xed, 0x20,
+    0x01, 0xe1, 0x20, 0x01, 0xeb, 0x28, 0x64, 0x0c, 0x6b, 0xe1, 0x40, 0x06, 0x02, 0xf4, 0x28, 0x35,
+    0x0b, 0xed, 0x28, 0xc5, 0x0e, 0xea, 0x28, 0x8b, 0x95, 0xe8, 0x40, 0x07, 0x02, 0x73, 0xe9, 0x28,
+    0x7b, 0x09, 0x63, 0xe9, 0x28, 0xe8, 0x10, 0xe1, 0x48, 0x04, 0x00, 0x44, 0x0c, 0xf2, 0x20, 0x01,
+    0xf5, 0x28, 0xba, 0x91, 0xe5, 0x88, 0x5c, 0x0a, 0x08, 0x00, 0xe7, 0x65, 0x23, 0x6a, 0x6f, 0xfa,
+    0x28, 0x15, 0x32, 0xe1, 0xc0, 0x51, 0x41, 0x3b, 0x1f, 0x14, 0x06, 0x77, 0xe1, 0x40, 0x06, 0x02,
+    0xeb, 0x28, 0x23, 0x02, 0x67, 0xe5, 0x28, 0xa7, 0x0c, 0x72, 0xe1, 0x48, 0x04, 0x00, 0x29, 0x95,
+    0xe8, 0x28, 0x5f, 0x10, 0xed, 0x40, 0x06, 0x02, 0xef, 0x28, 0x82, 0x6a, 0x61, 0xf9, 0x40, 0x08,
+    0x02, 0x69, 0x72, 0x6f, 0xeb, 0x20, 0x1c, 0x61, 0x74, 0x69, 0xeb, 0x48, 0x89, 0x0e, 0x91, 0x10,
+    0x67, 0x75, 0xf2, 0x28, 0x27, 0x15, 0xe4, 0x48, 0x04, 0x00, 0x9e, 0x5c, 0x61, 0x6b, 0x61, 0xf4,
+    0x20, 0x01, 0xef, 0x28, 0xaf, 0x01, 0xe2, 0x28, 0x29, 0x10, 0x70, 0x70, 0xe1, 0x28, 0x8f, 0x3c,
+    0xee, 0x48, 0x04, 0x00, 0x83, 0x65, 0xe9, 0x28, 0x84, 0x1f, 0xed, 0x88, 0x64, 0x04, 0x0e, 0x01,
+    0x08, 0x00, 0xd6, 0x86, 0x6e, 0x75, 0xe7, 0x21, 0x01, 0xae, 0x80, 0x73, 0x39, 0x18, 0x04, 0xf5,
+    0x60, 0x0c, 0x07, 0x03, 0xf9, 0x28, 0x59, 0x90, 0x73, 0xf4, 0x28, 0xf5, 0x0c, 0x6b, 0x6f, 0xed,
+    0x28, 0xf6, 0x21, 0xef, 0x60, 0x1a, 0x07, 0x03, 0xf4, 0x28, 0x16, 0x0a, 0xee, 0x40, 0x0d, 0x02,
+    0x6f, 0xf9, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xeb, 0x28, 0x21, 0x0a, 0xe5, 0x28, 0x05, 0x92, 0x6a,
+    0xef, 0x28, 0xb2, 0x04, 0xe9, 0xa0, 0x27, 0x1f, 0x11, 0x0a, 0x05, 0x72, 0xef, 0x28, 0x32, 0x45,
+    0x6f, 0x67, 0x61, 0xed, 0x28, 0x05, 0x0a, 0xed, 0x40, 0x07, 0x02, 0x75, 0xfa, 0x28, 0x1f, 0x5c,
+    0x61, 0xeb, 0x28, 0xcc, 0x0e, 0x6b, 0x61, 0xf3, 0x48, 0x4c, 0x0d, 0xcc, 0x81, 0x68, 0x73, 0xe1,
+    0x40, 0x08, 0x02, 0x79, 0x61, 0xe2, 0x28, 0x96, 0x04, 0x62, 0xe5, 0x28, 0x6a, 0x87, 0xe1, 0xe0,
+    0x08, 0x85, 0x7d, 0x6c, 0x5a, 0x4b, 0x2e, 0x1b, 0x08, 0xf7, 0x68, 0x06, 0x00, 0x17, 0x80, 0x56,
+    0x7b, 0x61, 0xeb, 0x20, 0x01, 0xf5, 0x20, 0x01, 0xe2, 0x28, 0xf4, 0x92, 0xf4, 0x68, 0x0d, 0x00,
+    0x06, 0x00, 0x54, 0x94, 0xe9, 0x20, 0x01, 0xee, 0x28, 0xb4, 0x0f, 0xe1, 0x28, 0x1f, 0x08, 0xf2,
+    0x88, 0x14, 0x00, 0x77, 0x0d, 0x41, 0x94, 0x08, 0x00, 0xf5, 0x40, 0x06, 0x02, 0xed, 0x28, 0x8b,
+    0x04, 0xeb, 0x28, 0xcc, 0x01, 0x61, 0x68, 0x6f, 0xee, 0x28, 0xd3, 0x0f, 0xee, 0x48, 0x04, 0x00,
+    0x5a, 0x0d, 0x69, 0x68, 0xf3, 0x20, 0x01, 0xe1, 0x28, 0x77, 0x5e, 0xed, 0x40, 0x0b, 0x02, 0x75,
+    0x73, 0x74, 0x61, 0x67, 0xe1, 0x28, 0x70, 0x0c, 0x61, 0xf9, 0x28, 0xca, 0x0c, 0xeb, 0x40, 0x0b,
+    0x02, 0x6f, 0xe9, 0x68, 0x1f, 0x0d, 0x9a, 0x0b, 0x1f, 0x0e, 0xe1, 0x28, 0xd8, 0x3f, 0xe4, 0x20,
+    0x01, 0x6f, 0xf9, 0x28, 0xee, 0x69, 0xe2, 0x28, 0xb2, 0x0a, 0x69, 0x68, 0xf3, 0x48, 0xf3, 0x01,
+    0x04, 0x00, 0x75, 0xeb, 0x48, 0x61, 0x01, 0x04, 0x00, 0x75, 0xe6, 0x21, 0x01, 0xae, 0xc0, 0xcb,
+    0xb1, 0x64, 0x5d, 0x23, 0x06, 0xf5, 0x60, 0x16, 0x0b, 0x03, 0x7a, 0x69, 0xe1, 0x48, 0x46, 0x0d,
+    0xc5, 0x09, 0x73, 0x74, 0x61, 0x6d, 0x61, 0x6b, 0x61, 0xf7, 0x28, 0x74, 0x01, 0x72, 0xe1, 0x28,
+    0x61, 0x0f, 0xef, 0x80, 0x28, 0x1a, 0x11, 0x04, 0x74, 0xe1, 0x48, 0x5e, 0x30, 0x04, 0x00, 0x73,
+    0x69, 0xed, 0x28, 0x5c, 0x01, 0x72, 0x69, 0x68, 0x73, 0x61, 0xf7, 0x28, 0xf7, 0x08, 0x6e, 0xef,
+    0x49, 0x04, 0x00, 0x1d, 0x0b, 0xe4, 0x20, 0x01, 0xf5, 0x28, 0x22, 0x79, 0xe7, 0x88, 0x08, 0x00,
+    0x06, 0x0d, 0xa9, 0x20, 0xef, 0x0e, 0x65, 0x74, 0xef, 0x28, 0x32, 0x92, 0x6e, 0x69, 0x68, 0xf3,
+    0x28, 0x00, 0x7f, 0xe9, 0xc0, 0x44, 0x3d, 0x32, 0x1d, 0x16, 0x06, 0xf2, 0x40, 0x0a, 0x02, 0x75,
+    0xf3, 0x20, 0x01, 0xf4, 0x28, 0x11, 0x30, 0xef, 0x28, 0xa1, 0x78, 0xed, 0x20, 0x01, 0xe9, 0x28,
+    0x89, 0x40, 0xeb, 0x40, 0x09, 0x02, 0xf5, 0x20, 0x01, 0xe2, 0x28, 0xea, 0x8e, 0xe1, 0x48, 0xb6,
+    0x07, 0x04, 0x00, 0xfa, 0x28, 0xfa, 0x09, 0x68, 0xf3, 0x48, 0xa5, 0x0b, 0x04, 0x00, 0xe9, 0x28,
+    0x81, 0x03, 0xe5, 0x20, 0x01, 0xee, 0x28, 0xf1, 0x8d, 0xe1, 0x20, 0x01, 0xe4, 0x28, 0x40, 0x88,
+    0xe5, 0x60, 0x12, 0x0e, 0x03, 0x74, 0xe1, 0x48, 0x72, 0x90, 0x04, 0x00, 0xf4, 0x28, 0x4e, 0x09,
+    0xe9, 0x28, 0x8c, 0x90, 0x67, 0x6e, 0x61, 0xe2, 0x20, 0xc6, 0xe1, 0xa0, 0x85, 0x5a, 0x48, 0x37,
+    0x05, 0xf7, 0x48, 0x04, 0x00, 0xee, 0x79, 0xe1, 0x68, 0x17, 0x00, 0x06, 0x00, 0x43, 0x3b, 0xeb,
+    0x40, 0x07, 0x02, 0x69, 0xe8, 0x28, 0x32, 0x80, 0xe1, 0x68, 0x43, 0x03, 0x99, 0x0d, 0xbf, 0x91,
+    0xe7, 0x68, 0x0a, 0x00, 0x06, 0x00, 0x77, 0x08, 0xe5, 0x28, 0x44, 0x8a, 0xe1, 0x20, 0x01, 0xeb,
+    0x28, 0xae, 0x8c, 0x74, 0xe1, 0x68, 0x0a, 0x00, 0x06, 0x00, 0x58, 0x0a, 0xed, 0x28, 0x8c, 0x09,
+    0xeb, 0x28, 0x53, 0x0c, 0xf2, 0x40, 0x07, 0x02, 0x75, 0xe7, 0x28, 0x03, 0x04, 0x61, 0x62, 0x6f,
+    0x69, 0x68, 0xf3, 0x28, 0x41, 0x0c, 0xed, 0x88, 0x14, 0x00, 0x0c, 0x00, 0x22, 0x7a, 0x08, 0x00,
+    0xf5, 0x28, 0x0d, 0x8c, 0x69, 0x68, 0xf3, 0x48, 0x8f, 0x92, 0xc4, 0x0b, 0xe1, 0x48, 0xc4, 0x90,
+    0x04, 0x00, 0xf9, 0x40, 0x09, 0x02, 0xe9, 0x20, 0x01, 0xf2, 0x28, 0xcf, 0x77, 0xe5, 0x28, 0xb9,
+    0x0b, 0x62, 0xe1, 0x28, 0x9e, 0x5e, 0x6f, 0xf4, 0x21, 0x01, 0xae, 0xa0, 0x5d, 0x53, 0x1f, 0x17,
+    0x05, 0xef, 0x40, 0x09, 0x02, 0xf4, 0x20, 0x01, 0xf5, 0x28, 0x32, 0x26, 0xee, 0x20, 0x01, 0xe1,
+    0x28, 0x61, 0x84, 0x6e, 0x61, 0xee, 0x48, 0x66, 0x92, 0x28, 0x0a, 0xe9, 0xa0, 0x2e, 0x1f, 0x17,
+    0x0c, 0x05, 0x75, 0x6b, 0x69, 0xe8, 0x28, 0xd5, 0x0c, 0xed, 0x48, 0x84, 0x0c, 0x04, 0x00, 0x75,
+    0xfa, 0x28, 0x18, 0x80, 0xeb, 0x20, 0x01, 0x69, 0xea, 0x28, 0x8a, 0x71, 0xe8, 0x40, 0x06, 0x02,
+    0xf3, 0x28, 0xd0, 0x04, 0x63, 0x6f, 0x67, 0xe1, 0x28, 0x1b, 0x67, 0xe7, 0x28, 0x0e, 0x87, 0x65,
+    0x67, 0x69, 0xe8, 0x20, 0x01, 0xf3, 0x28, 0x80, 0x0c, 0xe1, 0x60, 0x22, 0x0b, 0x03, 0x77, 0xe1,
+    0x20, 0x01, 0xe7, 0x28, 0x13, 0x02, 0x6d, 0xe9, 0x48, 0x04, 0x00, 0x01, 0x92, 0x68, 0x73, 0xf5,
+    0x48, 0x4f, 0x0e, 0x04, 0x00, 0x73, 0xf4, 0x20, 0x01, 0xe1, 0x28, 0x3c, 0x77, 0xe2, 0x28, 0x88,
+    0x0d, 0xef, 0x40, 0xbf, 0x02, 0x72, 0x69, 0xe8, 0x21, 0x01, 0xae, 0xc0, 0x62, 0x58, 0x24, 0x16,
+    0x0a, 0x06, 0xf5, 0x28, 0x7c, 0x01, 0xef, 0x40, 0x06, 0x02, 0xee, 0x28, 0xc7, 0x08, 0xe7, 0x28,
+    0xf7, 0x13, 0x6e, 0x65, 0x67, 0x6f, 0x6b, 0x69, 0x6b, 0x65, 0x73, 0x6e, 0xe9, 0x28, 0x46, 0x8b,
+    0xe9, 0x68, 0x0e, 0x00, 0x06, 0x00, 0xdf, 0x82, 0x6d, 0x61, 0x6e, 0x69, 0xed, 0x28, 0x87, 0x0c,
+    0xe8, 0x40, 0x0e, 0x02, 0xf3, 0x48, 0x04, 0x00, 0x4c, 0x04, 0x69, 0x6e, 0xe1, 0x28, 0x37, 0x78,
+    0x63, 0xe9, 0x68, 0x0a, 0x00, 0x06, 0x00, 0xed, 0x06, 0xed, 0x28, 0x8f, 0x06, 0x61, 0x6b, 0x75,
+    0xf3, 0x28, 0x2f, 0x19, 0xe5, 0x48, 0x04, 0x00, 0x5a, 0x07, 0xeb, 0x28, 0x12, 0x04, 0xe1, 0xa0,
+    0x4b, 0x25, 0x0d, 0x09, 0x05, 0xf7, 0x28, 0x15, 0x08, 0xf4, 0x28, 0x44, 0x09, 0xf2, 0x48, 0x04,
+    0x00, 0x2c, 0x8c, 0xe1, 0x40, 0x0c, 0x02, 0xe8, 0x48, 0x04, 0x00, 0x5e, 0x91, 0xe5, 0x28, 0x29,
+    0x0a, 0xe2, 0x28, 0x4e, 0x78, 0xed, 0x40, 0x1f, 0x02, 0xe9, 0x40, 0x12, 0x02, 0xea, 0x40, 0x0a,
+    0x02, 0x69, 0x6d, 0x61, 0x6b, 0xe9, 0x28, 0x0b, 0x09, 0xe1, 0x28, 0x26, 0x34, 0x68, 0x73, 0x6f,
+    0x72, 0x69, 0xe8, 0x28, 0xa2, 0x09, 0x61, 0xf9, 0x28, 0x63, 0x0a, 0x6b, 0xe1, 0x48, 0x17, 0x91,
+    0xb0, 0x90, 0x67, 0x61, 0xeb, 0x21, 0x01, 0xae, 0xc0, 0x79, 0x55, 0x28, 0x24, 0x10, 0x06, 0x75,
+    0x7a, 0x69, 0xed, 0x20, 0x01, 0xf5, 0x28, 0xef, 0x5a, 0xef, 0x68, 0x0e, 0x00, 0x8f, 0x78, 0x06,
+    0x00, 0x74, 0xef, 0x20, 0x01, 0xed, 0x28, 0x70, 0x0b, 0xeb, 0x28, 0xd0, 0x79, 0xee, 0x28, 0x46,
+    0x7e, 0xe9, 0x80, 0x1f, 0x0f, 0x09, 0x04, 0x75, 0xf3, 0x28, 0x8f, 0x06, 0xed, 0x48, 0xb4, 0x2e,
+    0xf4, 0x07, 0xeb, 0x40, 0x06, 0x02, 0xef, 0x28, 0xbc, 0x65, 0x61, 0x7a, 0x61, 0x72, 0xf5, 0x28,
+    0x64, 0x05, 0x61, 0x64, 0x6e, 0x65, 0x73, 0x61, 0x6d, 0x75, 0xf3, 0x28, 0x33, 0x34, 0xe5, 0x60,
+    0x1d, 0x0e, 0x03, 0x74, 0x6f, 0x6d, 0xef, 0x20, 0x01, 0x6f, 0xee, 0x28, 0x48, 0x0a, 0xee, 0x40,
+    0x06, 0x02, 0xf5, 0x28, 0x62, 0x30, 0x61, 0xf4, 0x48, 0xbe, 0x00, 0xf0, 0x0a, 0x62, 0xe1, 0x28,
+    0xab, 0x04, 0xe1, 0x68, 0x0d, 0x00, 0xf4, 0x7d, 0x06, 0x00, 0xf9, 0x20, 0x01, 0xef, 0x28, 0xd9,
+    0x09, 0xed, 0x40, 0x08, 0x02, 0x69, 0x68, 0x73, 0xef, 0x20, 0xec, 0x61, 0xf9, 0x28, 0x94, 0x09,
+    0xe1, 0x68, 0x20, 0x04, 0x62, 0x02, 0x06, 0x00, 0xf9, 0x40, 0xb0, 0x02, 0x6f, 0xf4, 0x21, 0x01,
+    0xae, 0xc0, 0x63, 0x5c, 0x31, 0x2a, 0x23, 0x06, 0xf5, 0x60, 0x16, 0x0f, 0x03, 0xfa, 0x40, 0x06,
+    0x02, 0xef, 0x28, 0xbf, 0x8d, 0xe9, 0x28, 0x1d, 0x88, 0x73, 0x74, 0x69, 0xed, 0x28, 0x8e, 0x09,
+    0x68, 0xe3, 0x28, 0xea, 0x82, 0xef, 0x20, 0x01, 0xf4, 0x28, 0x7d, 0x1d, 0x6e, 0x65, 0x7a, 0xf5,
+    0x28, 0x96, 0x84, 0xe9, 0x60, 0x17, 0x10, 0x03, 0xed, 0x48, 0x04, 0x00, 0x1a, 0x65, 0x61, 0xee,
+    0x48, 0xf6, 0x8e, 0xe2, 0x8f, 0x6b, 0x75, 0x7a, 0xe1, 0x28, 0x1c, 0x63, 0xe8, 0x68, 0x07, 0x0b,
+    0x0c, 0x00, 0x06, 0x00, 0x73, 0x61, 0xe8, 0x28, 0xf9, 0x0a, 0xe3, 0x28, 0x90, 0x02, 0x65, 0xe2,
+    0x48, 0xc7, 0x0c, 0xc3, 0x05, 0xe1, 0xe8, 0x07, 0x3e, 0x00, 0x05, 0x0b, 0x39, 0x00, 0x2d, 0x00,
+    0x27, 0x00, 0x23, 0x00, 0x0e, 0x00, 0x77, 0x61, 0x6b, 0xe9, 0x40, 0x06, 0x02, 0xf2, 0x28, 0x7c,
+    0x8d, 0xe9, 0x20, 0x01, 0xee, 0x20, 0x01, 0xe1, 0x28, 0x6f, 0x58, 0xf2, 0x28, 0x84, 0x7b, 0x6e,
+    0x61, 0xe8, 0x28, 0xae, 0x80, 0x6d, 0x61, 0xf9, 0x48, 0x04, 0x00, 0x8a, 0x8f, 0xe5, 0x28, 0xd4,
+    0x0f, 0x6b, 0xef, 0x28, 0xa1, 0x08, 0xe4, 0x28, 0x8e, 0x2c, 0x61, 0xeb, 0x40, 0xcf, 0x02, 0xef,
+    0x21, 0x01, 0xae, 0xa0, 0x88, 0x7a, 0x47, 0x37, 0x05, 0xef, 0xa8, 0x2a, 0x00, 0x26, 0x00, 0x12,
+    0x00, 0xb6, 0x76, 0x0a, 0x00, 0x75, 0x68, 0x63, 0x69, 0xe2, 0x28, 0x37, 0x8b, 0xee, 0x40, 0x0b,
+    0x02, 0x69, 0x6d, 0xe1, 0x20, 0x01, 0xe7, 0x28, 0x95, 0x6f, 0xe1, 0x20, 0x01, 0xed, 0x28, 0x35,
+    0x7b, 0xea, 0x28, 0xed, 0x04, 0x68, 0x73, 0xef, 0x28, 0xf6, 0x32, 0xee, 0x40, 0x06, 0x02, 0xe5,
+    0x28, 0x6e, 0x87, 0x61, 0xee, 0x20, 0x01, 0xe5, 0x28, 0x7d, 0x06, 0xe9, 0x88, 0xda, 0x88, 0x16,
+    0x00, 0x0c, 0x00, 0x08, 0x00, 0xed, 0x28, 0x5c, 0x02, 0xeb, 0x40, 0x97, 0x02, 0x69, 0x68, 0xf3,
+    0x28, 0x33, 0x05, 0xe8, 0x40, 0x0c, 0x02, 0xf3, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xe8, 0x28, 0x26,
+    0x08, 0x63, 0xf5, 0x40, 0x06, 0x02, 0xef, 0x28, 0x7e, 0x34, 0xeb, 0x28, 0x29, 0x0a, 0xe5, 0x48,
+    0x04, 0x00, 0x05, 0x01, 0x67, 0xe1, 0x20, 0x01, 0xeb, 0x28, 0xeb, 0x8a, 0xe1, 0xa0, 0x3a, 0x32,
+    0x1d, 0x10, 0x05, 0x77, 0xe9, 0x48, 0x04, 0x00, 0x50, 0x38, 0xe1, 0x28, 0xda, 0x2e, 0xf2, 0x48,
+    0x48, 0x06, 0x04, 0x00, 0x75, 0x6b, 0x61, 0xf7, 0x28, 0xb2, 0x07, 0xed, 0x40, 0x0c, 0x02, 0x69,
+    0x68, 0xf3, 0x20, 0x01, 0x61, 0xf9, 0x28, 0x43, 0x68, 0x61, 0xf9, 0x48, 0x94, 0x04, 0x7e, 0x04,
+    0x6b, 0xef, 0x20, 0x01, 0xe1, 0x28, 0x6f, 0x55, 0xea, 0x28, 0x80, 0x76, 0x61, 0xf7, 0x21, 0x01,
+    0xae, 0xc0, 0x53, 0x41, 0x2e, 0x28, 0x0a, 0x06, 0xf5, 0x28, 0xc5, 0x03, 0xef, 0x68, 0xf6, 0x8b,
+    0x18, 0x00, 0x06, 0x00, 0xf4, 0x40, 0x0c, 0x02, 0x6f, 0x6d, 0x69, 0x68, 0xf3, 0x48, 0x0c, 0x68,
+    0x03, 0x80, 0xe1, 0x28, 0xda, 0x6c, 0xee, 0x28, 0xc6, 0x08, 0x6e, 0x61, 0xee, 0x28, 0xa1, 0x06,
+    0xe9, 0x60, 0x0b, 0x07, 0x03, 0xed, 0x28, 0x2c, 0x04, 0xea, 0x28, 0x56, 0x7a, 0x67, 0x61, 0xf2,
+    0x28, 0x3f, 0x0a, 0xe5, 0x40, 0x06, 0x02, 0xe4, 0x28, 0x29, 0x03, 0xe2, 0x20, 0x01, 0xe1, 0x20,
+    0x01, 0xee, 0x28, 0x41, 0x7a, 0xe1, 0xe8, 0x08, 0x6e, 0x00, 0x67, 0x00, 0x47, 0x00, 0x35, 0x00,
+    0x30, 0x00, 0x14, 0x00, 0x10, 0x00, 0xba, 0x42, 0xf9, 0x28, 0xe0, 0x73, 0x77, 0xe1, 0x40, 0x07,
+    0x02, 0x6b, 0xef, 0x28, 0x57, 0x77, 0xe7, 0x40, 0x06, 0x02, 0xef, 0x28, 0x12, 0x06, 0xe1, 0x48,
+    0x04, 0x00, 0x92, 0x42, 0xe4, 0x28, 0xe7, 0x07, 0x73, 0xe1, 0x28, 0x0e, 0x04, 0x72, 0xf5, 0x48,
+    0x04, 0x00, 0xec, 0x8d, 0x75, 0x73, 0x74, 0x61, 0x6b, 0x69, 0x68, 0xe3, 0x28, 0xe4, 0x8b, 0x6d,
+    0xe1, 0x40, 0x17, 0x02, 0xf9, 0x40, 0x09, 0x02, 0xef, 0x20, 0x01, 0xe4, 0x28, 0x74, 0x7f, 0xe1,
+    0x48, 0x04, 0x00, 0xd6, 0x2d, 0xeb, 0x28, 0x9d, 0x6d, 0xe8, 0x48, 0xc5, 0x01, 0x3c, 0x8e, 0xeb,
+    0x20, 0x01, 0xe1, 0x28, 0x94, 0x51, 0xe4, 0x48, 0xa5, 0x07, 0x04, 0x00, 0x6e, 0xef, 0x20, 0x01,
+    0xf4, 0x28, 0x93, 0x07, 0x74, 0x69, 0x61, 0xf3, 0x21, 0x01, 0xae, 0xc0, 0xf3, 0xd3, 0x80, 0x7a,
+    0x1f, 0x06, 0xf5, 0x60, 0x0d, 0x07, 0x03, 0xf9, 0x28, 0x63, 0x36, 0x73, 0x6f, 0xee, 0x28, 0x13,
+    0x07, 0x62, 0x69, 0x68, 0x63, 0x69, 0x68, 0xe3, 0x29, 0x6d, 0x06, 0xef, 0xe8, 0x07, 0x54, 0x00,
+    0x4c, 0x00, 0x48, 0x00, 0x33, 0x00, 0x24, 0x00, 0x0e, 0x00, 0x3e, 0x54, 0xf4, 0x60, 0x0d, 0x08,
+    0x03, 0x6f, 0xed, 0x28, 0x81, 0x07, 0x69, 0xe7, 0x28, 0xc6, 0x87, 0x61, 0x73, 0x69, 0xed, 0x29,
+    0xcd, 0x6d, 0xf2, 0x40, 0x07, 0x02, 0x6f, 0xf4, 0x28, 0x84, 0x09, 0x69, 0x68, 0xf3, 0x28, 0x15,
+    0x04, 0xee, 0x88, 0x0d, 0x00, 0x08, 0x00, 0x19, 0x36, 0x76, 0x8c, 0x69, 0xed, 0x28, 0x5d, 0x05,
+    0xe1, 0x48, 0xf8, 0x29, 0xd4, 0x71, 0xea, 0x28, 0xdf, 0x0f, 0x69, 0xe8, 0x20, 0x01, 0xf3, 0x28,
+    0x55, 0x89, 0xe4, 0x28, 0x9d, 0x08, 0x6e, 0x61, 0xfa, 0x28, 0x07, 0x17, 0xe9, 0xa0, 0x4c, 0x38,
+    0x34, 0x1e, 0x05, 0xed, 0x60, 0x11, 0x0b, 0x03, 0x75, 0xfa, 0x20, 0x01, 0xe9, 0x28, 0xf7, 0x06,
+    0xe9, 0x48, 0xb1, 0x06, 0x2c, 0x05, 0x61, 0x6b, 0xef, 0x28, 0x0a, 0x57, 0xeb, 0x68, 0x10, 0x00,
+    0x20, 0x8c, 0x06, 0x00, 0xf5, 0x48, 0xff, 0x88, 0x04, 0x00, 0xf3, 0x28, 0xe3, 0x01, 0xe1, 0x28,
+    0xa2, 0x8b, 0xe9, 0x28, 0xd6, 0x3b, 0xe8, 0x40, 0x0e, 0x02, 0xf3, 0x40, 0x06, 0x02, 0xf5, 0x28,
+    0x0a, 0x05, 0xef, 0x28, 0xa3, 0x03, 0x63, 0xf5, 0x20, 0x1c, 0x62, 0xe1, 0x28, 0x19, 0x59, 0xe5,
+    0xa0, 0x18, 0x11, 0x0d, 0x09, 0x05, 0xfa, 0x28, 0xf0, 0x8a, 0xf4, 0x28, 0xa3, 0x30, 0xf3, 0x28,
+    0x7b, 0x02, 0xef, 0x20, 0x01, 0xe7, 0x28, 0x03, 0x04, 0x62, 0x61, 0xeb, 0x28, 0x8b, 0x03, 0xe1,
+    0xe8, 0x07, 0xb8, 0x00, 0xa4, 0x00, 0x66, 0x00, 0x51, 0x8b, 0x34, 0x00, 0x15, 0x00, 0x0e, 0x00,
+    0xfa, 0x20, 0x01, 0xe9, 0x28, 0x6a, 0x8b, 0xf9, 0x48, 0x04, 0x00, 0x6d, 0x05, 0xe1, 0x48, 0x04,
+    0x00, 0x40, 0x06, 0xe7, 0x68, 0xfe, 0x03, 0x0a, 0x00, 0x06, 0x00, 0xef, 0x28, 0xa4, 0x14, 0xe9,
+    0x20, 0x01, 0xe8, 0x28, 0x7f, 0x05, 0x77, 0xe1, 0x88, 0x1d, 0x00, 0x11, 0x00, 0xb0, 0x89, 0x08,
+    0x00, 0x7a, 0x6f, 0xf2, 0x20, 0x01, 0xef, 0x28, 0x38, 0x09, 0xeb, 0x48, 0x62, 0x27, 0x04, 0x00,
+    0xe9, 0x48, 0x01, 0x06, 0x1e, 0x08, 0xe7, 0x68, 0x0a, 0x00, 0x06, 0x00, 0xda, 0x8c, 0xe9, 0x28,
+    0x20, 0x09, 0xe5, 0x48, 0x3b, 0x86, 0x4a, 0x8a, 0xed, 0x60, 0x1e, 0x07, 0x03, 0xf5, 0x28, 0x66,
+    0x89, 0xe9, 0x40, 0x06, 0x02, 0xea, 0x28, 0x83, 0x03, 0x68, 0x73, 0xe1, 0x20, 0x01, 0xe7, 0x20,
+    0x01, 0xf5, 0x20, 0x01, 0xf2, 0x28, 0x14, 0x02, 0xe1, 0x40, 0x18, 0x02, 0xf9, 0x68, 0xf1, 0x88,
+    0x0e, 0x00, 0x06, 0x00, 0x75, 0x73, 0x74, 0x61, 0xed, 0x28, 0xfc, 0x04, 0xef, 0x48, 0x88, 0x76,
+    0x33, 0x14, 0xf4, 0x28, 0x1d, 0x32, 0xeb, 0x40, 0x0c, 0x02, 0xef, 0x48, 0x04, 0x00, 0x02, 0x8c,
+    0xe1, 0x28, 0x31, 0x07, 0xe1, 0x48, 0xd2, 0x4f, 0x53, 0x8b, 0xe4, 0x68, 0x94, 0x05, 0x17, 0x8c,
+    0x47, 0x24, 0x68, 0x6f, 0x6b, 0x6f, 0xf9, 0x22, 0x01, 0x2e, 0x79, 0x74, 0x69, 0xe3, 0x04, 0xeb,
+    0x48, 0xc5, 0x02, 0x04, 0x00, 0x6f, 0xf5, 0x48, 0x08, 0x01, 0x04, 0x00, 0x7a, 0x69, 0x68, 0xf3,
+    0x21, 0x01, 0xae, 0xa0, 0x8d, 0x4b, 0x41, 0x33, 0x05, 0xf5, 0x40, 0x25, 0x02, 0xfa, 0x40, 0x17,
+    0x02, 0xe9, 0x69, 0xe2, 0x87, 0x06, 0x00, 0xad, 0x07, 0xe9, 0x48, 0x04, 0x00, 0x71, 0x06, 0x68,
+    0xf3, 0x48, 0x9d, 0x04, 0x7d, 0x8a, 0xe1, 0x48, 0x04, 0x00, 0xf5, 0x02, 0xed, 0x28, 0x69, 0x8b,
+    0x73, 0x74, 0x61, 0xed, 0x28, 0xc5, 0x05, 0xef, 0x48, 0x04, 0x00, 0x19, 0x7e, 0x6e, 0xef, 0x20,
+    0x01, 0xf3, 0x28, 0xec, 0x85, 0x6e, 0x6f, 0x68, 0xe5, 0x20, 0x01, 0xee, 0x28, 0xcd, 0x02, 0xe9,
+    0xe8, 0x07, 0x39, 0x00, 0x32, 0x00, 0x9c, 0x03, 0x26, 0x00, 0x1b, 0x00, 0x13, 0x00, 0x0e, 0x00,
+    0x6f, 0xf2, 0x28, 0x19, 0x05, 0x6e, 0x75, 0x6b, 0x6f, 0xee, 0x28, 0xe7, 0x02, 0x6d, 0xe1, 0x48,
+    0x04, 0x00, 0xdc, 0x87, 0xee, 0x28, 0x12, 0x05, 0x6b, 0x61, 0xfa, 0x48, 0x04, 0x00, 0x3b, 0x06,
+    0xe5, 0x28, 0xd2, 0x3d, 0x68, 0x63, 0x61, 0xed, 0x28, 0x9a, 0x04, 0xe1, 0x48, 0xca, 0x83, 0x46,
+    0x04, 0xe1, 0xe0, 0x08, 0x66, 0x58, 0x4f, 0x49, 0x35, 0x2b, 0x10, 0x08, 0x79, 0x69, 0x6d, 0x6f,
+    0xee, 0x28, 0x49, 0x03, 0x77, 0xe1, 0x40, 0x06, 0x02, 0xeb, 0x28, 0x40, 0x03, 0xe7, 0x40, 0x09,
+    0x02, 0xf5, 0x20, 0x01, 0xeb, 0x28, 0x1c, 0x87, 0xe5, 0x20, 0x01, 0xeb, 0x28, 0x80, 0x6b, 0xf4,
+    0x20, 0x01, 0xe1, 0x20, 0x01, 0xf7, 0x28, 0x40, 0x8a, 0x72, 0xe1, 0x40, 0x0c, 0x02, 0x68, 0x6f,
+    0x6e, 0xe9, 0x20, 0x01, 0xeb, 0x28, 0x70, 0x7e, 0x62, 0xe9, 0x28, 0x9f, 0x64, 0x6d, 0x69, 0xe8,
+    0x28, 0x6d, 0x69, 0x6b, 0xef, 0x20, 0x01, 0x75, 0xfa, 0x28, 0x04, 0x8a, 0xe4, 0x88, 0xfa, 0x01,
+    0x08, 0x00, 0x82, 0x04, 0xcf, 0x06, 0xe5, 0x28, 0xf3, 0x02, 0x62, 0x6d, 0xe5, 0x28, 0x6e, 0x66,
+    0x6b, 0x75, 0xe6, 0x21, 0x01, 0xae, 0xc8, 0x1d, 0x01, 0x02, 0x01, 0x6a, 0x00, 0x55, 0x00, 0x22,
+    0x00, 0x0c, 0x00, 0xf5, 0x60, 0x0d, 0x0a, 0x03, 0xf3, 0x20, 0x01, 0xf4, 0x28, 0x1a, 0x87, 0xe7,
+    0x20, 0x7f, 0x66, 0x69, 0x61, 0xfa, 0x28, 0x29, 0x87, 0xef, 0xe8, 0x07, 0x2a, 0x00, 0x22, 0x00,
+    0x1a, 0x00, 0x16, 0x00, 0x0e, 0x00, 0x56, 0x89, 0xbb, 0x62, 0x6e, 0x69, 0xe8, 0x20, 0x01, 0xf3,
+    0x20, 0x18, 0xeb, 0x28, 0x50, 0x01, 0xea, 0x40, 0x02, 0x11, 0xef, 0x28, 0x76, 0x8a, 0xe8, 0x68,
+    0xed, 0x6a, 0xa3, 0x8a, 0x09, 0x00, 0xe7, 0x20, 0x01, 0xf5, 0x20, 0x0d, 0x6e, 0xe5, 0x40, 0x0d,
+    0x02, 0x7a, 0xf5, 0x48, 0xcc, 0x8a, 0x04, 0x00, 0xeb, 0x28, 0xe8, 0x60, 0x73, 0xe9, 0x28, 0x0e,
+    0x78, 0xe9, 0xe0, 0x07, 0x83, 0x7d, 0x60, 0x30, 0x1b, 0x0b, 0x07, 0xf5, 0x28, 0x0a, 0x7c, 0xf2,
+    0x40, 0x0a, 0x02, 0x75, 0xe7, 0x20, 0x01, 0xe1, 0x28, 0xe2, 0x34, 0xef, 0x28, 0xfd, 0x26, 0xed,
+    0x68, 0xfe, 0x04, 0x06, 0x00, 0x11, 0x88, 0x6f, 0x74, 0x69, 0x68, 0x73, 0x6f, 0xf9, 0x20, 0x01,
+    0xee, 0x28, 0x4c, 0x89, 0xeb, 0x88, 0x1b, 0x00, 0x11, 0x00, 0xac, 0x8a, 0x08, 0x00, 0x75, 0x73,
+    0xf4, 0x20, 0x01, 0xe1, 0x28, 0xbe, 0x88, 0xe9, 0x20, 0x01, 0xf5, 0x20, 0x01, 0xf3, 0x28, 0x9c,
+    0x8a, 0xe1, 0x40, 0x0a, 0x02, 0xed, 0x20, 0x01, 0x75, 0xfa, 0x28, 0x7c, 0x8a, 0xe7, 0x20, 0x01,
+    0xe1, 0x28, 0xed, 0x83, 0xe8, 0x40, 0x17, 0x02, 0xf3, 0x48, 0x04, 0x00, 0xc5, 0x88, 0xe1, 0x48,
+    0xe2, 0x02, 0x04, 0x00, 0x68, 0x75, 0xeb, 0x20, 0x01, 0xf5, 0x28, 0xe1, 0x89, 0xe3, 0x28, 0x8d,
+    0x03, 0xe7, 0x20, 0x01, 0xef, 0x20, 0x2a, 0xe1, 0x40, 0x0c, 0x02, 0x72, 0xe1, 0x20, 0x01, 0x69,
+    0x68, 0xe3, 0x28, 0xe1, 0x75, 0xee, 0x28, 0x3a, 0x71, 0xe5, 0x68, 0x0c, 0x00, 0x06, 0x00, 0x24,
+    0x84, 0xf4, 0x20, 0x01, 0xe1, 0x20, 0x0a, 0xed, 0x48, 0xdc, 0x85, 0x04, 0x00, 0xf5, 0x20, 0x01,
+    0xf2, 0x28, 0x4f, 0x7b, 0xe1, 0xe0, 0x09, 0x85, 0x79, 0x74, 0x5d, 0x4c, 0x49, 0x30, 0x14, 0x09,
+    0xf9, 0x40, 0x02, 0x76, 0xe9, 0x20, 0x01, 0xe8, 0x28, 0xf0, 0x88, 0x77, 0xe1, 0x40, 0x07, 0x02,
+    0x6b, 0xef, 0x29, 0x9b, 0x01, 0xe7, 0x48, 0x04, 0x00, 0x9a, 0x2f, 0xe1, 0x68, 0x7b, 0x52, 0x06,
+    0x00, 0x0e, 0x8a, 0xee, 0x28, 0xa0, 0x85, 0xf4, 0x40, 0x06, 0x02, 0xf5, 0x28, 0xaf, 0x88, 0xe1,
+    0x40, 0x0b, 0x02, 0x6b, 0xe1, 0x68, 0xd2, 0x88, 0x0b, 0x57, 0xf5, 0x89, 0xe7, 0x28, 0x51, 0x89,
+    0xf2, 0x20, 0xa8, 0x6d, 0xe1, 0x48, 0x52, 0x52, 0x04, 0x00, 0xf9, 0x48, 0x04, 0x00, 0xcb, 0x89,
+    0xe1, 0x28, 0x55, 0x39, 0xeb, 0x40, 0x0a, 0x02, 0x75, 0xfa, 0x20, 0x01, 0xe9, 0x28, 0x79, 0x88,
+    0x61, 0xf7, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xf9, 0x28, 0xae, 0x89, 0x68, 0xe9, 0x28, 0x87, 0x7b,
+    0xe7, 0x68, 0x20, 0x89, 0xf8, 0x6e, 0x06, 0x00, 0xf5, 0x28, 0x0b, 0x50, 0xe4, 0x48, 0x58, 0x26,
+    0x04, 0x00, 0xe5, 0x28, 0x16, 0x71, 0x61, 0x73, 0xef, 0x21, 0x01, 0xae, 0xe0, 0x07, 0xf4, 0xe2,
+    0xdb, 0x71, 0x63, 0x12, 0x07, 0x75, 0x73, 0xf4, 0x48, 0x04, 0x00, 0xad, 0x2e, 0xef, 0x20, 0x40,
+    0xef, 0x88, 0x23, 0x85, 0x1e, 0x00, 0x08, 0x00, 0x15, 0x61, 0xf4, 0x68, 0xb3, 0x03, 0x10, 0x00,
+    0x06, 0x00, 0xef, 0x20, 0x01, 0xed, 0x20, 0x01, 0xe1, 0x28, 0xd6, 0x04, 0xe9, 0x28, 0x62, 0x85,
+    0xee, 0x88, 0x12, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x45, 0x85, 0x69, 0x6b, 0xe9, 0x28, 0x35, 0x0c,
+    0xe5, 0x28, 0x33, 0x86, 0xe1, 0x68, 0x0c, 0x00, 0x06, 0x00, 0xaa, 0x53, 0xf3, 0x20, 0x01, 0xe9,
+    0x20, 0x3e, 0x67, 0x61, 0x6e, 0x69, 0x68, 0xe3, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xf7, 0x28, 0x1e,
+    0x69, 0x6e, 0x61, 0xee, 0x48, 0x18, 0x69, 0x04, 0x00, 0xee, 0x48, 0x4f, 0x62, 0xe0, 0x83, 0xe9,
+    0xa8, 0x10, 0x04, 0x3b, 0x00, 0x28, 0x00, 0x1e, 0x00, 0x0a, 0x00, 0xf2, 0x40, 0x0d, 0x02, 0x6f,
+    0xf4, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xed, 0x28, 0x29, 0x7a, 0x69, 0xea, 0x28, 0x97, 0x74, 0xed,
+    0x20, 0x01, 0xf5, 0x20, 0x01, 0xfa, 0x28, 0xb0, 0x87, 0xeb, 0x48, 0x04, 0x00, 0x6e, 0x01, 0xe1,
+    0x48, 0x04, 0x00, 0xed, 0x66, 0xf2, 0x20, 0x01, 0xe1, 0x28, 0x1b, 0x16, 0xe8, 0x40, 0x25, 0x02,
+    0xf3, 0x60, 0x18, 0x0c, 0x03, 0x6f, 0x79, 0x69, 0x6d, 0x75, 0xf3, 0x28, 0x3a, 0x01, 0xe9, 0x48,
+    0x04, 0x00, 0xb5, 0x88, 0xe1, 0x48, 0x92, 0x01, 0xd5, 0x88, 0x61, 0x79, 0x61, 0x62, 0x61, 0xe4,
+    0x28, 0x0e, 0x12, 0x63, 0x75, 0xe7, 0x28, 0x8c, 0x01, 0xe8, 0x20, 0x01, 0xef, 0x28, 0xc8, 0x6c,
+    0xe5, 0x40, 0x0c, 0x02, 0x74, 0x61, 0x77, 0x61, 0x6e, 0x6f, 0xea, 0x28, 0x42, 0x87, 0xf3, 0x28,
+    0x0f, 0x88, 0xe1, 0xc0, 0x8d, 0x62, 0x4a, 0x2e, 0x19, 0x06, 0x77, 0x61, 0xe7, 0x40, 0x0a, 0x02,
+    0x6f, 0x64, 0xef, 0x20, 0x01, 0xf9, 0x20, 0xef, 0x61, 0xf9, 0x28, 0x67, 0x88, 0xf4, 0x40, 0x08,
+    0x02, 0xe9, 0x48, 0x02, 0x84, 0x5c, 0x82, 0x61, 0xeb, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xf2, 0x28,
+    0x44, 0x5d, 0xf2, 0x40, 0x0e, 0x02, 0x65, 0x64, 0xe9, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xea, 0x28,
+    0xed, 0x7a, 0xe1, 0x40, 0x06, 0x02, 0xf7, 0x28, 0x79, 0x03, 0xe2, 0x28, 0xbb, 0x02, 0xed, 0x40,
+    0x09, 0x02, 0xef, 0x20, 0x01, 0xe4, 0x28, 0x36, 0x68, 0x61, 0x79, 0x61, 0xf3, 0x21, 0x01, 0xe1,
+    0x20, 0x01, 0xeb, 0x28, 0x7e, 0x86, 0xeb, 0x60, 0x13, 0x0b, 0x03, 0x75, 0xfa, 0x20, 0x01, 0xe9,
+    0x28, 0x1c, 0x68, 0x6f, 0xe1, 0x20, 0x01, 0xe4, 0x28, 0xbb, 0x73, 0xe1, 0x40, 0x10, 0x02, 0xf3,
+    0x40, 0x02, 0x82, 0x61, 0x6b, 0x61, 0x61, 0x79, 0x61, 0xe8, 0x28, 0x17, 0x5e, 0xee, 0x28, 0xf8,
+    0x83, 0xe4, 0x40, 0x06, 0x02, 0xe5, 0x28, 0x55, 0x5d, 0x61, 0x77, 0x69, 0xe8, 0x28, 0xe2, 0x01,
+    0xe7, 0x40, 0xdd, 0x02, 0x69, 0x68, 0xf3, 0x21, 0x01, 0xae, 0xe0, 0x07, 0x9d, 0x8a, 0x82, 0x4e,
+    0x3b, 0x1b, 0x07, 0x75, 0xf3, 0x48, 0x8f, 0x83, 0x04, 0x00, 0xf4, 0x48, 0x04, 0x00, 0xe6, 0x87,
+    0xe1, 0x20, 0x01, 0xf3, 0x28, 0xfc, 0x78, 0xef, 0x68, 0x17, 0x00, 0xb2, 0x7d, 0x06, 0x00, 0xf4,
+    0x68, 0x0a, 0x00, 0x19, 0x6d, 0x06, 0x00, 0xf4, 0x28, 0x25, 0x83, 0x61, 0xf3, 0x28, 0xa9, 0x83,
+    0xe8, 0x20, 0x01, 0xf3, 0x28, 0x95, 0x75, 0x6e, 0xe1, 0x48, 0x04, 0x00, 0x29, 0x53, 0x6d, 0x69,
+    0x68, 0x63, 0x61, 0xe8, 0x20, 0x01, 0xe9, 0x28, 0x64, 0x86, 0xe9, 0x80, 0x2b, 0x24, 0x1a, 0x04,
+    0xed, 0x20, 0x01, 0xef, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xe8, 0x20, 0x01, 0xf3, 0x20, 0x01, 0xe1,
+    0x20, 0x01, 0xe7, 0x28, 0x60, 0x5c, 0xeb, 0x20, 0x01, 0x75, 0xf3, 0x20, 0x01, 0xf4, 0x20, 0x46,
+    0xe5, 0x20, 0x01, 0xf3, 0x28, 0xc5, 0x6c, 0x61, 0xfa, 0x20, 0x01, 0xe1, 0x20, 0xf7, 0x68, 0xef,
+    0x20, 0x01, 0xf5, 0x28, 0xf0, 0x50, 0xe5, 0x40, 0x0a, 0x02, 0x6e, 0xef, 0x20, 0x01, 0xeb, 0x28,
+    0x34, 0x5c, 0x6d, 0x69, 0x68, 0xe1, 0x28, 0xb0, 0x2e, 0xe1, 0x80, 0x30, 0x11, 0x0b, 0x04, 0x77,
+    0x61, 0x67, 0xef, 0x28, 0x6e, 0x4b, 0x72, 0x61, 0xe2, 0x28, 0x17, 0x69, 0xed, 0x40, 0x0e, 0x02,
+    0x69, 0x68, 0xf3, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xeb, 0x28, 0xca, 0x72, 0xe1, 0x40, 0x09, 0x02,
+    0xf9, 0x20, 0x01, 0xe9, 0x28, 0x21, 0x71, 0xe8, 0x28, 0xd4, 0x02, 0xeb, 0x28, 0x6d, 0x6c, 0x61,
+    0xf3, 0x21, 0x01, 0xae, 0xa0, 0x8c, 0x77, 0x27, 0x21, 0x05, 0xf5, 0x40, 0x0c, 0x02, 0xf3, 0x48,
+    0xb3, 0x86, 0x04, 0x00, 0xf4, 0x28, 0xed, 0x1a, 0xeb, 0x48, 0x9a, 0x72, 0x04, 0x00, 0x6f, 0xe8,
+    0x20, 0x01, 0xf5, 0x28, 0x46, 0x6c, 0x6e, 0x65, 0xfa, 0x28, 0xca, 0x5b, 0xe9, 0xc0, 0x49, 0x3d,
+    0x2e, 0x25, 0x19, 0x06, 0x72, 0xe1, 0x48, 0x04, 0x00, 0x9d, 0x7e, 0x67, 0x6f, 0xee, 0x20, 0x01,
+    0xe9, 0x20, 0x01, 0xe8, 0x28, 0xb7, 0x34, 0x6d, 0x6f, 0xe4, 0x20, 0x01, 0xf5, 0x20, 0x01, 0xeb,
+    0x28, 0x5c, 0x79, 0x6b, 0x61, 0xfa, 0x20, 0x01, 0xee, 0x28, 0xb3, 0x66, 0xe8, 0x40, 0x07, 0x02,
+    0x73, 0xe9, 0x28, 0x6d, 0x01, 0xe3, 0x48, 0xbd, 0x38, 0x83, 0x48, 0xe7, 0x48, 0x04, 0x00, 0xb5,
+    0x86, 0x61, 0x72, 0xf5, 0x28, 0xba, 0x80, 0x61, 0xeb, 0x28, 0x1d, 0x66, 0xe5, 0x40, 0x0b, 0x02,
+    0x6e, 0x69, 0xed, 0x20, 0x01, 0xe9, 0x28, 0xd9, 0x01, 0x6b, 0xe1, 0x20, 0x01, 0xe9, 0x28, 0x98,
+    0x7e, 0xe1, 0x88, 0x3b, 0x00, 0x26, 0x00, 0x63, 0x50, 0x08, 0x00, 0xf4, 0x40, 0x0e, 0x02, 0x69,
+    0x72, 0xe1, 0x21, 0x01, 0xe9, 0x20, 0x01, 0xe8, 0x28, 0x81, 0x7f, 0xe1, 0x40, 0x05, 0x02, 0xe8,
+    0x20, 0x04, 0xe7, 0x20, 0x01, 0xe1, 0x28, 0xf0, 0x25, 0xed, 0x48, 0x04, 0x00, 0x86, 0x01, 0xe1,
+    0x40, 0x06, 0x02, 0xf9, 0x28, 0xdd, 0x81, 0xf4, 0x20, 0x01, 0xe1, 0x28, 0x7b, 0x5f, 0xe7, 0x28,
+    0x9f, 0x82, 0xe3, 0x48, 0x04, 0x00, 0x3d, 0x82, 0xe3, 0x28, 0x70, 0x5f, 0xe2, 0x48, 0x30, 0x85,
+    0x04, 0x00, 0x69, 0x68, 0xe3, 0x21, 0x01, 0xae, 0xc8, 0x2c, 0x01, 0x1a, 0x01, 0xb5, 0x00, 0xac,
+    0x00, 0x3a, 0x00, 0x0c, 0x00, 0xf5, 0x60, 0x26, 0x0d, 0x03, 0x7a, 0x61, 0x72, 0xe1, 0x20, 0x01,
+    0xf3, 0x28, 0xa0, 0x81, 0xf3, 0x40, 0x0f, 0x02, 0xf4, 0x48, 0x04, 0x00, 0x38, 0x52, 0xe9, 0x20,
+    0x01, 0xed, 0x28, 0x8f, 0x81, 0x61, 0xf9, 0x20, 0x01, 0xe1, 0x28, 0xbe, 0x82, 0x6b, 0x75, 0xea,
+    0x28, 0x71, 0x85, 0xef, 0xe8, 0x08, 0x5d, 0x00, 0x53, 0x00, 0x45, 0x00, 0x3d, 0x00, 0x2e, 0x00,
+    0x14, 0x00, 0x91, 0x5d, 0x10, 0x00, 0xf9, 0x28, 0x43, 0x01, 0x74, 0x61, 0xf3, 0x40, 0x09, 0x02,
+    0xe9, 0x20, 0x01, 0xed, 0x28, 0x7e, 0x85, 0x61, 0x72, 0x69, 0x68, 0x73, 0x69, 0xed, 0x20, 0x01,
+    0xe1, 0x28, 0xd0, 0x85, 0x73, 0x6f, 0xe2, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xed, 0x20, 0x01, 0xe1,
+    0x28, 0xd5, 0x69, 0x6e, 0x69, 0x68, 0x73, 0xe1, 0x28, 0x83, 0x19, 0xeb, 0x40, 0x06, 0x02, 0xe9,
+    0x28, 0x94, 0x82, 0xe1, 0x48, 0x5e, 0x00, 0xb6, 0x85, 0x68, 0x73, 0x6f, 0xee, 0x20, 0x01, 0xe8,
+    0x28, 0x42, 0x85, 0xe4, 0x40, 0x07, 0x02, 0x75, 0xf3, 0x28, 0x02, 0x53, 0x69, 0x61, 0x6b, 0x75,
+    0x73, 0xf4, 0x28, 0x36, 0x84, 0x6e, 0x61, 0x6e, 0xef, 0x48, 0xc5, 0x80, 0x95, 0x7f, 0xe9, 0xe0,
+    0x08, 0x5d, 0x58, 0x42, 0x3b, 0x36, 0x2f, 0x0f, 0x08, 0xf5, 0x20, 0x01, 0xf3, 0x28, 0x10, 0x84,
+    0xf2, 0x60, 0x12, 0x0c, 0x03, 0x75, 0x6b, 0xf5, 0x20, 0x01, 0xea, 0x28, 0x85, 0x76, 0xef, 0x48,
+    0xf0, 0x35, 0xc0, 0x4f, 0x61, 0x6b, 0x69, 0x68, 0x61, 0x62, 0x69, 0x68, 0xf3, 0x28, 0xfa, 0x82,
+    0xef, 0x20, 0x01, 0xf2, 0x28, 0xe9, 0x83, 0x6d, 0xf5, 0x28, 0x8e, 0x72, 0x6b, 0xe1, 0x48, 0x73,
+    0x83, 0x53, 0x39, 0xe8, 0x40, 0x10, 0x02, 0xf3, 0x48, 0x04, 0x00, 0x35, 0x33, 0x61, 0xe2, 0x20,
+    0x01, 0xe1, 0x28, 0x9d, 0x75, 0xe1, 0x28, 0x02, 0x84, 0x65, 0xf3, 0x28, 0x22, 0x33, 0x61, 0xfa,
+    0x28, 0x42, 0x83, 0xe5, 0x40, 0x0c, 0x02, 0xee, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xe7, 0x28, 0xb4,
+    0x84, 0xe1, 0x28, 0x59, 0x81, 0xe1, 0xe8, 0x08, 0xbd, 0x00, 0x53, 0x75, 0xa6, 0x00, 0x7c, 0x00,
+    0x6b, 0x00, 0x57, 0x00, 0x25, 0x00, 0x10, 0x00, 0xf9, 0x40, 0x0c, 0x02, 0xe9, 0x20, 0x01, 0xed,
+    0x20, 0x01, 0x6f, 0xee, 0x20, 0x82, 0x61, 0xe7, 0x20, 0x01, 0xe1, 0x20, 0x24, 0xf7, 0x40, 0x07,
+    0x02, 0x69, 0xe8, 0x28, 0x41, 0x4b, 0xe1, 0x60, 0x11, 0x0e, 0x03, 0x7a, 0xf5, 0x20, 0x01, 0xf3,
+    0x20, 0x01, 0xf4, 0x28, 0xb7, 0x79, 0xeb, 0x20, 0x5f, 0xe7, 0x40, 0x09, 0x02, 0xef, 0x20, 0x01,
+    0xed, 0x28, 0xab, 0x64, 0x69, 0xed, 0x48, 0x04, 0x00, 0xbb, 0x84, 0xe1, 0x28, 0xff, 0x2c, 0xf4,
+    0x40, 0x06, 0x02, 0xe9, 0x28, 0x77, 0x18, 0x61, 0xed, 0x20, 0x01, 0x69, 0xe8, 0x20, 0x01, 0xe3,
+    0x28, 0x44, 0x80, 0xf3, 0x48, 0x15, 0x6c, 0x04, 0x00, 0x75, 0xe6, 0x20, 0x01, 0xef, 0x20, 0x01,
+    0xed, 0x28, 0x2c, 0x83, 0xf2, 0x40, 0x16, 0x02, 0xf5, 0x68, 0x0b, 0x00, 0xd2, 0x80, 0x06, 0x00,
+    0x75, 0xf3, 0x28, 0xdd, 0x4e, 0x61, 0x67, 0x65, 0xe4, 0x28, 0xf0, 0x6b, 0xe1, 0x68, 0xe9, 0x81,
+    0xc9, 0x7d, 0x06, 0x00, 0xe8, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xe8, 0x28, 0xaa, 0x7a, 0x6d, 0xe1,
+    0x40, 0x10, 0x02, 0x79, 0xe5, 0x48, 0x04, 0x00, 0x4d, 0x04, 0xf2, 0x20, 0x01, 0xe1, 0x28, 0xa8,
+    0x7d, 0xe8, 0x28, 0x44, 0x84, 0x62, 0x69, 0x68, 0x63, 0x69, 0xe1, 0x28, 0xef, 0x81, 0x39, 0xf8,
+    0x20, 0x01, 0xf4, 0x28, 0xcd, 0x16, 0x38, 0x35, 0x75, 0x77, 0xf5, 0x28, 0x30, 0x65, 0x35, 0x77,
+    0x74, 0xe2, 0x28, 0x70, 0x65, 0xb3, 0x40, 0x0d, 0x02, 0x78, 0x71, 0x69, 0x30, 0xef, 0x20, 0x01,
+    0xf3, 0x28, 0x2d, 0x0f, 0x35, 0x78, 0x71, 0xb6, 0x28, 0x07, 0x85, 0xe9, 0x68, 0x06, 0x00, 0x53,
+    0x82, 0x84, 0x80, 0xf2, 0x21, 0x01, 0x2e, 0xee, 0x20, 0x01, 0xe1, 0x28, 0x74, 0x82, 0xe7, 0x21,
+    0x01, 0xae, 0xe8, 0x07, 0xf8, 0x83, 0x70, 0x81, 0xe8, 0x83, 0xb1, 0x78, 0x9b, 0x6c, 0xb8, 0x81,
+    0xbe, 0x83, 0xe5, 0x28, 0x6c, 0x7b, 0xe1, 0x88, 0x24, 0x7f, 0xa8, 0x83, 0xe2, 0x83, 0x66, 0x83,
+    0xef, 0xe8, 0x15, 0x1f, 0x20, 0xfc, 0x1f, 0xe3, 0x1e, 0x3f, 0x1e, 0x0c, 0x1e, 0xf6, 0x1d, 0x41,
+    0x1d, 0x35, 0x1d, 0x2e, 0x1d, 0xff, 0x19, 0xe9, 0x19, 0xe2, 0x19, 0xd6, 0x19, 0xd8, 0x03, 0xbf,
+    0x03, 0xa2, 0x00, 0x8e, 0x00, 0x3b, 0x00, 0x35, 0x00, 0x31, 0x00, 0x2a, 0x00, 0xf9, 0x20, 0x01,
+    0xeb, 0x28, 0x51, 0x83, 0xf8, 0x28, 0xf9, 0x7f, 0xf6, 0x48, 0xaf, 0x7f, 0x30, 0x7e, 0xf4, 0x89,
+    0x16, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x8a, 0x6c, 0xf4, 0x28, 0xcd, 0x6f, 0xef, 0x88, 0x05, 0x6a,
+    0x8c, 0x83, 0xd2, 0x81, 0xa1, 0x7d, 0xae, 0xe8, 0x0a, 0x33, 0x00, 0x2f, 0x00, 0x83, 0x83, 0x7b,
+    0x83, 0x73, 0x83, 0x2b, 0x00, 0x1e, 0x00, 0x7e, 0x23, 0x49, 0x83, 0x14, 0x00, 0xf6, 0x48, 0x04,
+    0x00, 0x2e, 0x83, 0xe4, 0x28, 0x55, 0x83, 0x73, 0x75, 0x6c, 0xf0, 0x20, 0x01, 0xee, 0x20, 0x01,
+    0xf0, 0x28, 0x9e, 0x81, 0xee, 0x28, 0x7e, 0x48, 0xe1, 0x28, 0x2d, 0x78, 0x31, 0xb1, 0x28, 0xe0,
+    0x63, 0xf3, 0x21, 0x01, 0xae, 0xe8, 0x07, 0x49, 0x80, 0x45, 0x83, 0xb6, 0x80, 0x35, 0x83, 0x05,
+    0x81, 0x0b, 0x83, 0x03, 0x83, 0xf2, 0x69, 0xf7, 0x02, 0x49, 0x00, 0x06, 0x00, 0xf0, 0x21, 0x01,
+    0xae, 0xe8, 0x09, 0x31, 0x00, 0x5b, 0x7f, 0x24, 0x00, 0x3a, 0x62, 0x1e, 0x00, 0x8e, 0x81, 0x12,
+    0x00, 0x2d, 0x7c, 0x60, 0x82, 0xf4, 0x68, 0x1c, 0x56, 0xad, 0x68, 0x06, 0x00, 0xe8, 0x28, 0xd8,
+    0x64, 0xf2, 0x48, 0x49, 0x82, 0x93, 0x35, 0x65, 0x63, 0x61, 0x72, 0x74, 0x73, 0x6e, 0x64, 0x2e,
+    0xe9, 0x28, 0x0d, 0x5a, 0xe1, 0x68, 0x21, 0x0d, 0xc4, 0x80, 0x06, 0x00, 0xf0, 0x28, 0xe4, 0x82,
+    0xe5, 0x68, 0x06, 0x00, 0xf8, 0x56, 0x5f, 0x7f, 0xe1, 0x21, 0x01, 0xae, 0xe8, 0x0f, 0x93, 0x02,
+    0x88, 0x02, 0x76, 0x02, 0x1a, 0x02, 0xc6, 0x01, 0xc1, 0x01, 0xa0, 0x01, 0x31, 0x01, 0x2c, 0x01,
+    0x10, 0x01, 0xe4, 0x00, 0xba, 0x00, 0x3e, 0x00, 0x38, 0x00, 0x1e, 0x00, 0xf9, 0x60, 0x11, 0x0b,
+    0x03, 0xf4, 0x20, 0x01, 0x65, 0xe6, 0x28, 0x08, 0x7f, 0x64, 0x6f, 0xe2, 0x28, 0xd3, 0x23, 0x63,
+    0x6e, 0x65, 0xe7, 0x28, 0xcf, 0x54, 0xf7, 0x48, 0x23, 0x75, 0x99, 0x69, 0xf4, 0xe8, 0x07, 0x6a,
+    0x00, 0x5c, 0x00, 0x55, 0x00, 0x1f, 0x00, 0x94, 0x27, 0x19, 0x00, 0x0e, 0x00, 0x73, 0xe9, 0x48,
+    0x24, 0x2d, 0x04, 0x00, 0xf4, 0x28, 0xf9, 0x2a, 0x72, 0x6f, 0xf0, 0x28, 0x5b, 0x70, 0xee, 0x40,
+    0x2f, 0x02, 0xe5, 0x40, 0x27, 0x02, 0xed, 0x60, 0x1d, 0x0a, 0x03, 0x70, 0x69, 0x75, 0xf1, 0x28,
+    0x38, 0x82, 0xee, 0x40, 0x07, 0x02, 0x72, 0xe5, 0x28, 0x21, 0x82, 0x69, 0x61, 0xf4, 0x20, 0x01,
+    0x72, 0xe5, 0x28, 0x68, 0x59, 0x65, 0x73, 0xf5, 0x28, 0x76, 0x81, 0xe4, 0x28, 0xf3, 0x5f, 0x61,
+    0xf4, 0x28, 0x36, 0x61, 0x6c, 0x69, 0x75, 0xe2, 0x28, 0xcb, 0x68, 0x68, 0x67, 0x69, 0xec, 0x48,
+    0xcc, 0x80, 0x04, 0x00, 0x6f, 0xf2, 0x28, 0x76, 0x2c, 0x66, 0x61, 0x72, 0x63, 0xf2, 0x48, 0x0b,
+    0x70, 0x04, 0x00, 0x6f, 0xf4, 0x28, 0x9f, 0x7c, 0xf3, 0xa8, 0x21, 0x00, 0x1b, 0x00, 0x84, 0x41,
+    0x14, 0x00, 0x0a, 0x00, 0xf4, 0x20, 0x01, 0xee, 0x20, 0x01, 0xe5, 0x28, 0x5c, 0x7b, 0x73, 0x65,
+    0x72, 0xf0, 0x29, 0x9b, 0x75, 0xe5, 0x48, 0x97, 0x68, 0xf3, 0x81, 0x63, 0x69, 0x74, 0xf3, 0x28,
+    0xd3, 0x69, 0xf2, 0x40, 0x0d, 0x02, 0xef, 0x48, 0x77, 0x41, 0x04, 0x00, 0x74, 0xe1, 0x28, 0x5d,
+    0x2d, 0xe5, 0xa8, 0x17, 0x00, 0xf3, 0x60, 0x13, 0x00, 0x0f, 0x00, 0x0a, 0x00, 0x74, 0xf2, 0x28,
+    0x73, 0x4f, 0xee, 0x28, 0xf8, 0x60, 0xeb, 0x28, 0xc5, 0x25, 0xe4, 0x28, 0xc2, 0x71, 0xf0, 0x40,
+    0x0d, 0x02, 0x75, 0x6f, 0x72, 0xe7, 0x21, 0x01, 0x67, 0xee, 0x28, 0x20, 0x41, 0x69, 0x68, 0x73,
+    0x6e, 0x6f, 0x69, 0xf0, 0x20, 0x01, 0xed, 0x28, 0x4b, 0x4f, 0x6f, 0xe7, 0x28, 0x05, 0x39, 0xee,
+    0x40, 0x68, 0x02, 0x6f, 0xe9, 0x48, 0x90, 0x54, 0x04, 0x00, 0xf4, 0x60, 0x11, 0x0b, 0x03, 0x6e,
+    0x65, 0x76, 0x65, 0x72, 0xf0, 0x20, 0x3e, 0x63, 0x75, 0xe4, 0x28, 0x71, 0x64, 0xe1, 0xa0, 0x43,
+    0x3e, 0x26, 0x0a, 0x05, 0x72, 0xe5, 0x28, 0x62, 0x5f, 0xe9, 0x40, 0x07, 0x02, 0x76, 0xe1, 0x28,
+    0x38, 0x2a, 0x63, 0x6f, 0x73, 0x73, 0xe1, 0x21, 0x01, 0x2d, 0x72, 0x65, 0x67, 0x6e, 0xe5, 0x20,
+    0x01, 0xf3, 0x28, 0xae, 0x32, 0x67, 0xe9, 0x48, 0x04, 0x00, 0xbb, 0x2c, 0x74, 0x73, 0x65, 0x76,
+    0x6e, 0xe9, 0x20, 0x01, 0x2d, 0x74, 0x6e, 0x65, 0x64, 0xe9, 0x28, 0xe9, 0x66, 0x65, 0xf2, 0x28,
+    0x17, 0x63, 0x63, 0x69, 0x66, 0xe9, 0x28, 0xf1, 0x5c, 0x67, 0xe9, 0x28, 0x9c, 0x74, 0xec, 0x88,
+    0xd7, 0x2b, 0x0d, 0x6c, 0x1a, 0x00, 0x08, 0x00, 0x6f, 0x72, 0x74, 0x6e, 0x6f, 0xe3, 0x21, 0x01,
+    0x2d, 0x63, 0x69, 0x66, 0x66, 0x61, 0x72, 0xf4, 0x20, 0xb7, 0x69, 0xe3, 0x28, 0x1e, 0x23, 0x68,
+    0xe3, 0x28, 0xcc, 0x2d, 0x67, 0x6e, 0xe9, 0xe0, 0x07, 0x3b, 0x28, 0x21, 0x1c, 0x18, 0x0d, 0x07,
+    0x76, 0x69, 0xe4, 0x28, 0x17, 0x67, 0xf4, 0x48, 0xf0, 0x5f, 0x04, 0x00, 0x75, 0x68, 0xe3, 0x20,
+    0x34, 0xf3, 0x28, 0xcf, 0x1b, 0x72, 0xe5, 0x28, 0x08, 0x76, 0x6e, 0x6f, 0x6f, 0xec, 0x28, 0xd7,
+    0x39, 0xec, 0x40, 0x07, 0x02, 0x6c, 0xe5, 0x28, 0xf5, 0x28, 0x64, 0x6e, 0x61, 0x68, 0x64, 0x6e,
+    0xf5, 0x28, 0xf2, 0x79, 0xe4, 0x48, 0xc8, 0x70, 0x04, 0x00, 0x69, 0x6c, 0xe7, 0x41, 0x06, 0x02,
+    0xe7, 0x28, 0x1a, 0x29, 0xe1, 0x28, 0xd7, 0x65, 0xe5, 0xa0, 0x28, 0x22, 0x1c, 0x0a, 0x05, 0x72,
+    0xe1, 0x28, 0x9f, 0x66, 0x6e, 0xe9, 0x68, 0xc6, 0x5f, 0x0b, 0x00, 0x06, 0x00, 0x7a, 0xe1, 0x28,
+    0x6a, 0x6a, 0xec, 0x28, 0x83, 0x6e, 0x6d, 0x6f, 0x72, 0xe4, 0x20, 0x51, 0x67, 0x6e, 0xe1, 0x28,
+    0x1a, 0x6a, 0x63, 0xee, 0x40, 0x0b, 0x02, 0x65, 0x72, 0xe5, 0x20, 0x01, 0xe6, 0x28, 0xae, 0x65,
+    0xe1, 0x60, 0x0f, 0x08, 0x03, 0x72, 0xf5, 0x28, 0x7e, 0x76, 0x6e, 0x65, 0x74, 0xee, 0x28, 0x52,
+    0x62, 0xec, 0x48, 0x04, 0x00, 0x28, 0x30, 0x6c, 0x69, 0x65, 0x76, 0x72, 0x75, 0xf3, 0x20, 0x01,
+    0xad, 0x28, 0x45, 0x6e, 0x63, 0xe9, 0x40, 0x07, 0x02, 0x74, 0x61, 0xe2, 0x20, 0x0f, 0x66, 0x66,
+    0x61, 0x72, 0xf4, 0x28, 0x33, 0x6e, 0x62, 0x75, 0x6c, 0xe3, 0x21, 0x01, 0x6f, 0xf2, 0x28, 0x63,
+    0x7d, 0xe1, 0x68, 0xd6, 0x7d, 0x06, 0x00, 0x98, 0x26, 0x63, 0xe7, 0x28, 0x9e, 0x7d, 0xae, 0xe8,
+    0x0a, 0x06, 0x62, 0x2e, 0x78, 0x3b, 0x80, 0x19, 0x00, 0x28, 0x78, 0x13, 0x66, 0x4a, 0x63, 0x89,
+    0x7f, 0x14, 0x00, 0x72, 0x7f, 0x77, 0xf7, 0x28, 0x78, 0x7d, 0xed, 0x68, 0x10, 0x7d, 0x2f, 0x6b,
+    0x2f, 0x80, 0xef, 0xc8, 0xfc, 0x7f, 0xa8, 0x7e, 0xdc, 0x7f, 0x13, 0x00, 0x1e, 0x80, 0x0c, 0x00,
+    0xf4, 0x20, 0x01, 0xf4, 0x28, 0x9f, 0x6b, 0xe8, 0x28, 0xac, 0x7b, 0xee, 0x89, 0x12, 0x00, 0x0e,
+    0x00, 0x08, 0x00, 0x55, 0x7d, 0xe9, 0x48, 0x52, 0x32, 0x9a, 0x6e, 0xe1, 0x28, 0x3f, 0x55, 0xae,
+    0xe8, 0x16, 0x72, 0x0e, 0x98, 0x0d, 0x4c, 0x0d, 0x01, 0x0b, 0xe4, 0x09, 0x9f, 0x09, 0x10, 0x09,
+    0xdc, 0x08, 0x87, 0x08, 0x6a, 0x08, 0xce, 0x07, 0x1f, 0x06, 0xbc, 0x05, 0x1c, 0x04, 0x95, 0x03,
+    0x80, 0x03, 0x85, 0x02, 0xe6, 0x01, 0x3f, 0x01, 0xd0, 0x00, 0xc4, 0x00, 0x2c, 0x00, 0xf9, 0x40,
+    0x82, 0x02, 0xef, 0xe8, 0x09, 0x70, 0x00, 0x6a, 0x00, 0x5f, 0x00, 0xeb, 0x65, 0x5b, 0x00, 0x4f,
+    0x00, 0x2f, 0x00, 0x18, 0x00, 0x12, 0x00, 0x76, 0x72, 0xe5, 0x28, 0x18, 0x08, 0xf3, 0xa8, 0x97,
+    0x72, 0x12, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x70, 0x0c, 0xec, 0x28, 0xa6, 0x45, 0xe7, 0x28, 0xb4,
+    0x7c, 0xe5, 0x20, 0xd3, 0xf2, 0x88, 0x16, 0x00, 0x08, 0x00, 0xa3, 0x7a, 0x51, 0x6d, 0xe5, 0x68,
+    0x51, 0x4f, 0x06, 0x00, 0x7f, 0x7e, 0xf4, 0x48, 0xbd, 0x7d, 0x9a, 0x43, 0xe1, 0x68, 0x99, 0x58,
+    0x57, 0x7f, 0xb2, 0x7d, 0xee, 0x48, 0x58, 0x6f, 0x04, 0x00, 0xee, 0x48, 0xc5, 0x74, 0x51, 0x23,
+    0xed, 0x28, 0x6f, 0x45, 0xeb, 0x48, 0x04, 0x00, 0x33, 0x7e, 0x72, 0xe1, 0x28, 0x64, 0x05, 0x67,
+    0x61, 0xf6, 0x28, 0x9c, 0x01, 0xe4, 0x68, 0x09, 0x71, 0x06, 0x00, 0xbe, 0x79, 0x6e, 0xe1, 0x29,
+    0xbe, 0x7e, 0xe2, 0x88, 0x0d, 0x00, 0x22, 0x69, 0x08, 0x00, 0x8b, 0x01, 0x73, 0xe5, 0x28, 0x07,
+    0x6a, 0x65, 0xf3, 0x28, 0x50, 0x12, 0xf6, 0x48, 0x54, 0x6f, 0x04, 0x00, 0x6c, 0x65, 0xf3, 0x28,
+    0xc3, 0x4a, 0xf5, 0xc0, 0x50, 0x48, 0x3d, 0x23, 0x1d, 0x06, 0xee, 0x40, 0x09, 0x02, 0xf4, 0x20,
+    0x01, 0xe1, 0x28, 0xfe, 0x7a, 0x64, 0x69, 0x61, 0x65, 0x67, 0x61, 0x64, 0x76, 0xef, 0x28, 0x80,
+    0x69, 0x6b, 0x73, 0xe9, 0x28, 0x0a, 0x03, 0xea, 0x60, 0x11, 0x0b, 0x03, 0x76, 0x61, 0x72, 0x65,
+    0x6b, 0xeb, 0x20, 0x70, 0x6a, 0x65, 0xe4, 0x28, 0xca, 0x71, 0x64, 0x61, 0x65, 0xe8, 0x28, 0x35,
+    0x54, 0xe7, 0x48, 0x04, 0x00, 0xdd, 0x79, 0x6e, 0xe1, 0x28, 0x4d, 0x03, 0x64, 0x72, 0xe1, 0x48,
+    0xb0, 0x7e, 0xa1, 0x47, 0xe2, 0x89, 0x2f, 0x13, 0x17, 0x00, 0x08, 0x00, 0x8b, 0x64, 0xe5, 0x68,
+    0xc0, 0x71, 0x6d, 0x09, 0x06, 0x00, 0xee, 0x20, 0x01, 0xee, 0x28, 0x96, 0x7c, 0xe1, 0x28, 0x36,
+    0x47, 0xf4, 0xe8, 0x08, 0x61, 0x00, 0x37, 0x00, 0x33, 0x00, 0x2b, 0x00, 0xf7, 0x04, 0x25, 0x00,
+    0x16, 0x00, 0x10, 0x00, 0x74, 0x65, 0xf2, 0x28, 0x0b, 0x50, 0xf3, 0x69, 0xf9, 0x12, 0x06, 0x00,
+    0x09, 0x79, 0x65, 0x66, 0x72, 0xe5, 0x28, 0x4b, 0x0f, 0xef, 0x48, 0xa4, 0x7d, 0x56, 0x7e, 0x6c,
+    0xef, 0x20, 0x01, 0xe8, 0x28, 0x3b, 0x70, 0xe9, 0x28, 0xbe, 0x0a, 0xe5, 0x88, 0x21, 0x00, 0xff,
+    0x7c, 0x0e, 0x00, 0x08, 0x00, 0x76, 0x74, 0xf0, 0x28, 0x3f, 0x0e, 0xf3, 0x68, 0x0d, 0x00, 0x06,
+    0x00, 0x87, 0x11, 0x72, 0x6f, 0x6b, 0xef, 0x28, 0x3d, 0x02, 0xee, 0x28, 0x9c, 0x44, 0x64, 0x6e,
+    0x61, 0xec, 0x28, 0x8e, 0x01, 0xe1, 0xe8, 0x07, 0x3b, 0x00, 0x2f, 0x00, 0x24, 0x00, 0x1d, 0x00,
+    0x18, 0x00, 0x39, 0x7d, 0x0e, 0x00, 0xf6, 0x48, 0x5c, 0x49, 0x04, 0x00, 0xef, 0x28, 0xe9, 0x2f,
+    0x73, 0xef, 0x28, 0x18, 0x73, 0x6c, 0xe1, 0x48, 0x08, 0x7e, 0xa6, 0x7d, 0x6a, 0x6a, 0x72, 0x61,
+    0x76, 0x2d, 0x61, 0xf4, 0x28, 0x87, 0x4b, 0xe7, 0x40, 0x06, 0x02, 0xe7, 0x28, 0x30, 0x02, 0xe1,
+    0x28, 0x4c, 0x7c, 0x62, 0xe1, 0x28, 0x41, 0x6a, 0xf3, 0xe8, 0x08, 0x95, 0x00, 0x45, 0x00, 0x41,
+    0x00, 0x08, 0x63, 0x3a, 0x00, 0x30, 0x00, 0x1f, 0x00, 0x10, 0x00, 0x75, 0xe8, 0x48, 0x22, 0x64,
+    0x04, 0x00, 0x73, 0x72, 0x65, 0x6b, 0xe1, 0x28, 0x15, 0x09, 0x73, 0xef, 0x68, 0x06, 0x00, 0xdd,
+    0x7d, 0x23, 0x7c, 0x66, 0xe5, 0x20, 0x01, 0xee, 0x28, 0xbc, 0x7c, 0xef, 0x48, 0x04, 0x00, 0x9d,
+    0x03, 0xf2, 0x28, 0x42, 0x78, 0x69, 0x67, 0x61, 0xf6, 0x28, 0x5a, 0x7c, 0xe7, 0x28, 0x02, 0x7c,
+    0x65, 0xee, 0xc8, 0xf4, 0x4e, 0x34, 0x00, 0x2d, 0x00, 0x20, 0x00, 0x11, 0x00, 0x0c, 0x00, 0x74,
+    0xf3, 0x28, 0x4f, 0x5c, 0xf3, 0xa8, 0xb7, 0x7d, 0x0a, 0x00, 0x19, 0x77, 0xfb, 0x70, 0xf2, 0x43,
+    0xe5, 0x20, 0x31, 0x6e, 0x72, 0x6f, 0x68, 0x2d, 0x67, 0x6f, 0x2d, 0x65, 0xea, 0x28, 0x3c, 0x06,
+    0x6d, 0xe5, 0x48, 0x75, 0x7c, 0x84, 0x0a, 0xe5, 0x68, 0x13, 0x00, 0x06, 0x00, 0x31, 0x06, 0xeb,
+    0x48, 0x04, 0x00, 0xfe, 0x20, 0x72, 0xe9, 0x48, 0x58, 0x7d, 0xfd, 0x78, 0xe4, 0x28, 0xba, 0x76,
+    0xe1, 0x20, 0x01, 0xe4, 0x28, 0x00, 0x6f, 0xf2, 0xc8, 0xd0, 0x00, 0x1c, 0x00, 0x14, 0x00, 0x10,
+    0x00, 0x0c, 0x00, 0x66, 0x03, 0xef, 0x28, 0x4e, 0x0e, 0xed, 0x29, 0xba, 0x11, 0x69, 0xed, 0x20,
+    0x01, 0xf0, 0x28, 0x77, 0x56, 0xe5, 0xe8, 0x09, 0x6b, 0x00, 0xcb, 0x70, 0x65, 0x00, 0x3a, 0x00,
+    0x2f, 0x00, 0x21, 0x00, 0x1d, 0x00, 0x12, 0x00, 0x1f, 0x72, 0x74, 0xf3, 0x48, 0x04, 0x00, 0x4c,
+    0x78, 0xec, 0x28, 0xee, 0x6d, 0xee, 0x28, 0x59, 0x4f, 0xed, 0x40, 0x08, 0x02, 0x6d, 0x61, 0xe8,
+    0x28, 0x21, 0x09, 0xe2, 0x28, 0x45, 0x56, 0x6c, 0xe1, 0x48, 0x84, 0x03, 0x04, 0x00, 0xf6, 0x28,
+    0xf8, 0x7b, 0xeb, 0x88, 0x16, 0x00, 0x08, 0x00, 0x07, 0x5c, 0xe5, 0x7b, 0x69, 0x65, 0x2d, 0x65,
+    0xf2, 0x48, 0x04, 0x00, 0xb8, 0x10, 0xe4, 0x28, 0xda, 0x7c, 0xe1, 0x68, 0x0c, 0x00, 0x14, 0x6f,
+    0x06, 0x00, 0xf3, 0x48, 0x99, 0x07, 0x74, 0x06, 0x6e, 0xf6, 0x28, 0x65, 0x74, 0x6a, 0x6b, 0xee,
+    0x28, 0xa3, 0x28, 0x67, 0xee, 0x40, 0x08, 0x02, 0x69, 0x76, 0xf3, 0x28, 0x27, 0x06, 0xe1, 0xe8,
+    0x08, 0x32, 0x00, 0x2b, 0x00, 0x25, 0x00, 0x1e, 0x00, 0x46, 0x01, 0x1a, 0x00, 0x14, 0x00, 0x10,
+    0x00, 0xf9, 0x28, 0xa2, 0x7b, 0xf6, 0x48, 0xa7, 0x7b, 0x4a, 0x71, 0xf4, 0x28, 0xee, 0x6f, 0x72,
+    0x61, 0x76, 0xad, 0x28, 0xbd, 0x0d, 0xee, 0x48, 0x3c, 0x68, 0x16, 0x74, 0xed, 0x20, 0x01, 0xe5,
+    0x28, 0x05, 0x65, 0xeb, 0x48, 0x57, 0x69, 0x9a, 0x7c, 0xe1, 0xa8, 0x1a, 0x00, 0x13, 0x00, 0x0f,
+    0x00, 0xbc, 0x55, 0x0a, 0x00, 0x76, 0xf3, 0x28, 0xd0, 0x42, 0xec, 0x28, 0x7e, 0x03, 0xea, 0x20,
+    0x01, 0xf4, 0x28, 0xde, 0x71, 0xe4, 0x40, 0x06, 0x02, 0xe9, 0x28, 0xb1, 0x7b, 0x64, 0xea, 0x28,
+    0xac, 0x7b, 0xf0, 0x68, 0x5d, 0x78, 0xc1, 0x7b, 0x06, 0x00, 0xf0, 0x40, 0x06, 0x02, 0xe5, 0x28,
+    0xe5, 0x44, 0x61, 0xeb, 0x28, 0x70, 0x0d, 0xef, 0xe8, 0x0a, 0x77, 0x00, 0x48, 0x7c, 0x6d, 0x00,
+    0x69, 0x00, 0x60, 0x00, 0x42, 0x00, 0x3b, 0x00, 0x32, 0x00, 0x20, 0x00, 0x14, 0x00, 0xf3, 0x40,
+    0x06, 0x02, 0xed, 0x28, 0x59, 0x1f, 0xe4, 0x28, 0x5b, 0x79, 0xf2, 0x68, 0x0b, 0x00, 0x7c, 0x2e,
+    0x06, 0x00, 0x79, 0xef, 0x28, 0x70, 0x7a, 0x65, 0xe7, 0x28, 0xa3, 0x45, 0x6e, 0x69, 0x65, 0x6b,
+    0x6f, 0xf4, 0x28, 0xb2, 0x1b, 0x6d, 0x73, 0x64, 0xe5, 0x28, 0x24, 0x62, 0xec, 0x60, 0x18, 0x08,
+    0x03, 0x73, 0xef, 0x29, 0x71, 0x10, 0x6f, 0x75, 0xf3, 0x40, 0x08, 0x02, 0x65, 0x63, 0xe8, 0x28,
+    0x89, 0x79, 0xe1, 0x28, 0xfc, 0x6e, 0xed, 0x28, 0xbe, 0x7a, 0x6b, 0x73, 0xf3, 0x20, 0x01, 0xef,
+    0x28, 0x7c, 0x6e, 0xe9, 0x28, 0x47, 0x04, 0xe4, 0x48, 0xad, 0x7a, 0x04, 0x00, 0xf2, 0x28, 0x04,
+    0x79, 0x36, 0x61, 0x78, 0x69, 0x2d, 0x79, 0x67, 0x76, 0x74, 0xf3, 0x28, 0x6c, 0x73, 0xee, 0xe8,
+    0x0d, 0x79, 0x01, 0x76, 0x00, 0x6c, 0x00, 0x5e, 0x00, 0x5a, 0x00, 0x52, 0x00, 0x4a, 0x00, 0x3b,
+    0x00, 0x35, 0x00, 0x27, 0x00, 0x22, 0x00, 0x1e, 0x00, 0x1a, 0x00, 0xf9, 0x28, 0xa0, 0x40, 0xf5,
+    0x28, 0xf9, 0x07, 0x73, 0xe6, 0x28, 0x4b, 0x5a, 0xf2, 0x40, 0x07, 0x02, 0x65, 0xf6, 0x28, 0x8f,
+    0x7a, 0x61, 0xe9, 0x28, 0x6d, 0x44, 0x6f, 0x72, 0xe6, 0x28, 0xe5, 0x02, 0xee, 0x48, 0x9a, 0x7b,
+    0x04, 0x00, 0x75, 0x72, 0xe7, 0x20, 0x01, 0xf3, 0x28, 0xa0, 0x2b, 0x6d, 0x61, 0x68, 0x65, 0xf2,
+    0x28, 0x25, 0x1b, 0x6c, 0x61, 0x64, 0x65, 0xee, 0x28, 0x5e, 0x64, 0xeb, 0x28, 0x39, 0x7a, 0xe9,
+    0x40, 0x06, 0x02, 0xf6, 0x28, 0xdb, 0x21, 0x64, 0x6e, 0xe1, 0x28, 0x82, 0x1e, 0xe7, 0x48, 0xe8,
+    0x58, 0x04, 0x00, 0xf5, 0x28, 0x6c, 0x01, 0xe5, 0xe8, 0x0c, 0xe2, 0x00, 0x9e, 0x00, 0x2e, 0x0b,
+    0x94, 0x00, 0x6f, 0x00, 0x6a, 0x00, 0x5c, 0x00, 0x57, 0x00, 0x46, 0x00, 0x2f, 0x00, 0x22, 0x00,
+    0x18, 0x00, 0x79, 0x61, 0x6d, 0x2d, 0x6e, 0x61, 0xea, 0x29, 0x9b, 0x0f, 0x76, 0x6c, 0xf9, 0x48,
+    0x04, 0x00, 0x94, 0x6d, 0x6b, 0xeb, 0x28, 0xa9, 0x67, 0xf4, 0x48, 0x04, 0x00, 0x85, 0x5f, 0xef,
+    0x48, 0xf6, 0x79, 0x04, 0x00, 0x74, 0x2d, 0x65, 0x72, 0x74, 0xf3, 0x48, 0xb5, 0x59, 0x16, 0x7b,
+    0xf3, 0x48, 0x04, 0x00, 0x10, 0x7b, 0x6c, 0x61, 0x68, 0x73, 0x6c, 0x61, 0x64, 0xf2, 0x28, 0x54,
+    0x24, 0x70, 0xf0, 0x28, 0x4c, 0x49, 0x6f, 0x6a, 0xf3, 0x48, 0xd3, 0x79, 0x04, 0x00, 0x73, 0x65,
+    0xee, 0x28, 0x25, 0x4c, 0x6d, 0xed, 0x28, 0x51, 0x66, 0xec, 0x48, 0x04, 0x00, 0x64, 0x65, 0xe1,
+    0x40, 0x06, 0x02, 0xf4, 0x28, 0xf3, 0x06, 0xe4, 0x68, 0x11, 0x00, 0x06, 0x00, 0xb4, 0x79, 0xee,
+    0x48, 0xb0, 0x78, 0x04, 0x00, 0x6f, 0xea, 0x28, 0xc2, 0x7a, 0xe7, 0x28, 0x5c, 0x07, 0xeb, 0x48,
+    0x04, 0x00, 0x79, 0x4a, 0xf3, 0x28, 0x11, 0x22, 0xe7, 0x68, 0x7a, 0x26, 0x06, 0x00, 0x01, 0x24,
+    0xee, 0x68, 0x12, 0x00, 0x06, 0x00, 0xd3, 0x31, 0xe9, 0x40, 0x06, 0x02, 0xec, 0x28, 0x62, 0x6c,
+    0xe4, 0x28, 0xd5, 0x66, 0xe1, 0x80, 0x20, 0x1c, 0x10, 0x04, 0xf6, 0x48, 0x28, 0x79, 0x04, 0x00,
+    0x65, 0x73, 0xf3, 0x28, 0xc9, 0x78, 0xf4, 0x48, 0xc8, 0x42, 0x04, 0x00, 0x64, 0x64, 0xef, 0x28,
+    0xa4, 0x0d, 0xee, 0x28, 0x40, 0x06, 0xec, 0x48, 0xc7, 0x76, 0x5e, 0x33, 0xe4, 0x68, 0x15, 0x00,
+    0x2a, 0x29, 0x06, 0x00, 0xf2, 0x40, 0x08, 0x02, 0x6f, 0x6a, 0xe6, 0x28, 0x4b, 0x4e, 0x61, 0xe7,
+    0x28, 0x36, 0x6f, 0x64, 0xef, 0x48, 0x7e, 0x0d, 0x7c, 0x3e, 0xe1, 0x88, 0x13, 0x00, 0x0e, 0x00,
+    0xc9, 0x74, 0x08, 0x00, 0xf2, 0x48, 0x0a, 0x7a, 0xe8, 0x58, 0x6a, 0xec, 0x28, 0x62, 0x77, 0xe7,
+    0x48, 0x62, 0x77, 0x04, 0x00, 0x6f, 0x6b, 0xf3, 0x20, 0x01, 0xf3, 0x28, 0xb2, 0x77, 0xed, 0xe8,
+    0x07, 0x5a, 0x00, 0x56, 0x00, 0xab, 0x00, 0x32, 0x00, 0x66, 0x66, 0x2e, 0x00, 0x0e, 0x00, 0xf5,
+    0x88, 0x2c, 0x22, 0xf3, 0x3d, 0x0d, 0x00, 0x08, 0x00, 0x74, 0xf4, 0x28, 0x6d, 0x43, 0xf2, 0xa8,
+    0x4c, 0x79, 0x0a, 0x00, 0x0c, 0x25, 0x8a, 0x61, 0x39, 0x20, 0x64, 0xf2, 0x28, 0xf7, 0x06, 0xf4,
+    0x29, 0x64, 0x0e, 0xe9, 0x40, 0x02, 0x59, 0xe5, 0x40, 0x0c, 0x02, 0x72, 0x6b, 0x72, 0xe5, 0x20,
+    0x01, 0xea, 0x28, 0xcd, 0x79, 0xe8, 0x68, 0x0b, 0x00, 0xc6, 0x2b, 0x06, 0x00, 0x73, 0xf3, 0x28,
+    0x60, 0x71, 0x64, 0xee, 0x28, 0xf8, 0x1c, 0xe6, 0x29, 0x3c, 0x0e, 0xe1, 0x48, 0xb0, 0x22, 0x24,
+    0x07, 0xec, 0xe0, 0x09, 0x66, 0x54, 0x4c, 0x48, 0x3e, 0x1b, 0x17, 0x0d, 0x09, 0xf2, 0x29, 0x26,
+    0x0e, 0xef, 0x89, 0x22, 0x0e, 0xc5, 0x56, 0x7d, 0x79, 0xa5, 0x78, 0xee, 0x29, 0x18, 0x0e, 0xec,
+    0x40, 0x1a, 0x02, 0x6f, 0xf6, 0x80, 0x11, 0x0c, 0x08, 0x04, 0xf3, 0x28, 0x0f, 0x05, 0xeb, 0x28,
+    0x79, 0x78, 0x67, 0xee, 0x28, 0xa3, 0x79, 0xe5, 0x28, 0x77, 0x2b, 0xe5, 0x20, 0x01, 0xea, 0x28,
+    0x1c, 0x78, 0xe9, 0x48, 0x86, 0x79, 0x04, 0x00, 0xf3, 0x28, 0xd1, 0x39, 0xe8, 0x29, 0xe7, 0x0d,
+    0x65, 0xf3, 0x21, 0x01, 0xe4, 0x28, 0xa4, 0x52, 0x62, 0x69, 0xe2, 0x40, 0x09, 0x02, 0x73, 0x65,
+    0x6b, 0xec, 0x28, 0x19, 0x4d, 0x65, 0xeb, 0x28, 0x4c, 0x5d, 0xe1, 0x61, 0x10, 0x08, 0x03, 0x72,
+    0xe5, 0x28, 0x37, 0x78, 0x6b, 0x73, 0x65, 0x64, 0xec, 0x28, 0x98, 0x64, 0xe4, 0xe8, 0x0e, 0x2c,
+    0x01, 0x20, 0x01, 0x04, 0x01, 0xfa, 0x00, 0xf6, 0x00, 0xcf, 0x00, 0xa6, 0x00, 0x9d, 0x00, 0xd9,
+    0x04, 0x70, 0x00, 0x45, 0x00, 0x34, 0x00, 0x1c, 0x00, 0x99, 0x3f, 0xf6, 0x40, 0x0b, 0x02, 0x75,
+    0x2d, 0x67, 0x6f, 0x2d, 0xe5, 0x28, 0x01, 0x47, 0xec, 0x48, 0x33, 0x79, 0x04, 0x00, 0x65, 0xad,
+    0x28, 0x11, 0x71, 0xf4, 0x68, 0x04, 0x26, 0x0a, 0x00, 0x06, 0x00, 0xf3, 0x28, 0x2e, 0x26, 0x72,
+    0xe1, 0x28, 0x74, 0x05, 0xf3, 0x80, 0x1d, 0x19, 0x08, 0x04, 0xf5, 0x28, 0xe2, 0x6e, 0x6d, 0x6f,
+    0x72, 0x2d, 0x67, 0x6f, 0x2d, 0x65, 0x72, 0x6f, 0x6d, 0xae, 0x48, 0xd2, 0x06, 0x6b, 0x05, 0xeb,
+    0x28, 0x12, 0x76, 0xe5, 0x68, 0xe2, 0x05, 0x36, 0x06, 0x06, 0x00, 0xf2, 0x28, 0x8f, 0x4c, 0xf2,
+    0xa8, 0x21, 0x00, 0x19, 0x00, 0xfe, 0x75, 0x13, 0x00, 0x0a, 0x00, 0xf5, 0x48, 0x04, 0x00, 0xbb,
+    0x77, 0xe1, 0x20, 0x1c, 0xef, 0x48, 0x20, 0x22, 0xbb, 0x77, 0xe5, 0x68, 0xd1, 0x57, 0x9b, 0x77,
+    0x04, 0x77, 0xe1, 0x49, 0x93, 0x77, 0x04, 0x00, 0xee, 0x28, 0xb1, 0x57, 0xef, 0x20, 0x01, 0xad,
+    0x48, 0xc4, 0x09, 0xc0, 0x09, 0xee, 0xe8, 0x07, 0x9e, 0x6b, 0x22, 0x00, 0x0d, 0x03, 0x16, 0x00,
+    0x12, 0x00, 0x0e, 0x00, 0x69, 0x69, 0xee, 0x28, 0x77, 0x72, 0xeb, 0x28, 0x0e, 0x60, 0xe9, 0x68,
+    0x70, 0x78, 0x06, 0x00, 0x7a, 0x78, 0xee, 0x28, 0xe8, 0x5c, 0xe5, 0x28, 0x8b, 0x70, 0xec, 0x68,
+    0x80, 0x75, 0x15, 0x00, 0x06, 0x00, 0xf5, 0x48, 0x04, 0x00, 0xf6, 0x77, 0x61, 0x67, 0x2d, 0x65,
+    0x72, 0xf4, 0x28, 0xfd, 0x28, 0xec, 0x48, 0x04, 0x00, 0xba, 0x6b, 0x65, 0x6a, 0x66, 0xf4, 0x20,
+    0x01, 0xf4, 0x28, 0x87, 0x51, 0xeb, 0x28, 0x58, 0x78, 0xe7, 0x48, 0x74, 0x75, 0x04, 0x00, 0xee,
+    0x28, 0x74, 0x2f, 0xe5, 0x80, 0x15, 0x11, 0x0b, 0x04, 0xf4, 0x20, 0x01, 0xf4, 0x28, 0x91, 0x76,
+    0xf3, 0x48, 0x3c, 0x28, 0x48, 0x71, 0xee, 0x28, 0x19, 0x1b, 0x67, 0xee, 0x28, 0x9b, 0x63, 0xe4,
+    0x48, 0x04, 0x00, 0x06, 0x46, 0x6e, 0x75, 0xed, 0x28, 0x61, 0x23, 0x61, 0xee, 0x28, 0xb3, 0x59,
+    0xeb, 0xa8, 0x86, 0x00, 0x37, 0x00, 0x2e, 0x00, 0xfa, 0x0b, 0x0a, 0x00, 0x72, 0x61, 0xed, 0x40,
+    0x15, 0x02, 0xe5, 0x48, 0x04, 0x00, 0x13, 0x70, 0x6c, 0x65, 0x74, 0xae, 0x48, 0x04, 0x00, 0xc9,
+    0x76, 0xe1, 0x28, 0x7d, 0x04, 0x64, 0x65, 0x68, 0xae, 0x68, 0xac, 0x07, 0xa3, 0x04, 0x3b, 0x76,
+    0x6b, 0x61, 0xe2, 0x20, 0x01, 0xe5, 0x28, 0xf9, 0x56, 0x69, 0xf6, 0xe9, 0x07, 0x43, 0x00, 0x37,
+    0x00, 0xbe, 0x6d, 0x33, 0x00, 0x2f, 0x00, 0x1a, 0x00, 0x0e, 0x00, 0xf3, 0x68, 0xfd, 0x50, 0x06,
+    0x00, 0xb0, 0x76, 0xeb, 0x28, 0x5c, 0x6c, 0xf2, 0x88, 0x0d, 0x00, 0x08, 0x00, 0x83, 0x64, 0x80,
+    0x47, 0x65, 0xf0, 0x28, 0x06, 0x5d, 0xe1, 0x48, 0x8f, 0x76, 0x9d, 0x77, 0xef, 0x28, 0xa9, 0x04,
+    0xee, 0x28, 0x3f, 0x6c, 0xec, 0x68, 0xa0, 0x6a, 0x06, 0x00, 0xfc, 0x74, 0xe5, 0x28, 0xeb, 0x62,
+    0x61, 0x6b, 0x6c, 0x65, 0xea, 0x28, 0xee, 0x62, 0xe1, 0x60, 0x0d, 0x09, 0x03, 0x6c, 0x6c, 0xe5,
+    0x28, 0xae, 0x74, 0xea, 0x28, 0x99, 0x5d, 0x62, 0xef, 0x28, 0x21, 0x6e, 0xea, 0x40, 0x11, 0x02,
+    0x39, 0x34, 0x62, 0x61, 0x77, 0x68, 0x2d, 0x61, 0x6b, 0x68, 0x6f, 0xea, 0x28, 0x68, 0x0d, 0x30,
+    0x61, 0x6f, 0x71, 0x2d, 0x79, 0xf3, 0x28, 0x22, 0x0a, 0xe9, 0xe0, 0x07, 0x42, 0x33, 0x2f, 0x25,
+    0x1f, 0x12, 0x07, 0x73, 0x73, 0x61, 0x6e, 0xe5, 0x20, 0x01, 0xf6, 0x28, 0x1c, 0x77, 0x72, 0x72,
+    0x6f, 0x75, 0x6e, 0x61, 0x64, 0x64, 0x6c, 0xe5, 0x28, 0x89, 0x68, 0x70, 0x70, 0xe8, 0x28, 0xd5,
+    0x75, 0x6d, 0x70, 0x6f, 0x75, 0x76, 0x74, 0xe1, 0x28, 0xda, 0x42, 0xec, 0x28, 0x52, 0x76, 0xeb,
+    0x48, 0x04, 0x00, 0xad, 0x76, 0x68, 0x61, 0x76, 0x6c, 0x61, 0xf2, 0x28, 0x01, 0x1c, 0xe5, 0x48,
+    0x04, 0x00, 0xa9, 0x75, 0x68, 0x73, 0x72, 0xe1, 0x20, 0x01, 0xe7, 0x28, 0xb5, 0x55, 0xe8, 0x68,
+    0x28, 0x00, 0x06, 0x00, 0x72, 0x0b, 0xb7, 0x40, 0x11, 0x02, 0x35, 0x61, 0x79, 0x37, 0x2d, 0x61,
+    0x74, 0x6b, 0x6f, 0x75, 0x6c, 0xef, 0x28, 0x5e, 0x77, 0x34, 0x61, 0x79, 0x38, 0x2d, 0x61, 0x6b,
+    0x69, 0x69, 0x76, 0x61, 0xe7, 0x28, 0xcb, 0x6d, 0x30, 0x61, 0x6c, 0x75, 0x2d, 0x79, 0xf3, 0x28,
+    0xb9, 0x77, 0xe7, 0xc0, 0x81, 0x6d, 0x57, 0x41, 0x0d, 0x06, 0x75, 0x61, 0x68, 0xe1, 0x28, 0xbb,
+    0x29, 0xf2, 0x40, 0x0c, 0x02, 0x6f, 0x62, 0x73, 0xf0, 0x20, 0x01, 0xf2, 0x28, 0x12, 0x73, 0x65,
+    0xe2, 0x61, 0x1b, 0x15, 0x03, 0xf3, 0x88, 0x24, 0x02, 0x20, 0x02, 0x0c, 0x00, 0x08, 0x00, 0xee,
+    0x28, 0x52, 0x76, 0xe7, 0x28, 0x1e, 0x42, 0x65, 0x64, 0xf9, 0x28, 0xf9, 0x61, 0x61, 0xe4, 0x20,
+    0x01, 0xee, 0x28, 0x5d, 0x68, 0x6f, 0x6b, 0xf3, 0x88, 0x02, 0x02, 0x0e, 0x00, 0x08, 0x00, 0x96,
+    0x76, 0x6e, 0x65, 0xf2, 0x28, 0xc2, 0x62, 0xed, 0x28, 0xfc, 0x70, 0xee, 0x48, 0x04, 0x00, 0x97,
+    0x6f, 0x61, 0xf6, 0x21, 0x01, 0xf3, 0x20, 0x01, 0x6e, 0x65, 0xec, 0x20, 0x01, 0xec, 0x28, 0xc3,
+    0x73, 0xe1, 0x40, 0x0d, 0x02, 0x76, 0xe5, 0x48, 0x04, 0x00, 0xb0, 0x1f, 0xe7, 0x28, 0xf3, 0x74,
+    0x6c, 0xec, 0x28, 0xd2, 0x70, 0x35, 0x61, 0x6c, 0x79, 0x2d, 0x79, 0xf2, 0x48, 0x38, 0x77, 0xcf,
+    0x6e, 0xe6, 0xa8, 0x35, 0x00, 0x14, 0x00, 0x0e, 0x00, 0xdf, 0x01, 0x0a, 0x00, 0xf6, 0x29, 0xa6,
+    0x0a, 0xef, 0x49, 0xa2, 0x0a, 0x25, 0x75, 0xe1, 0x40, 0x12, 0x02, 0x37, 0x6b, 0x2d, 0x74, 0x61,
+    0x6a, 0x6a, 0x72, 0x76, 0x2d, 0x61, 0x74, 0xf4, 0x28, 0x00, 0x77, 0x31, 0x30, 0x2d, 0x75, 0x6a,
+    0x76, 0x72, 0x65, 0x6b, 0xeb, 0x28, 0xe0, 0x56, 0x36, 0x32, 0x61, 0x74, 0x73, 0x2d, 0x75, 0x67,
+    0x73, 0x72, 0xef, 0x28, 0x80, 0x4d, 0xe5, 0xe8, 0x0d, 0x0c, 0x01, 0xfe, 0x00, 0xf2, 0x00, 0xd2,
+    0x00, 0xc6, 0x00, 0x98, 0x00, 0x7a, 0x00, 0x70, 0x00, 0x52, 0x00, 0x38, 0x00, 0x32, 0x00, 0x1e,
+    0x00, 0x1a, 0x00, 0xf5, 0x28, 0x02, 0x6f, 0xf4, 0x40, 0x08, 0x02, 0x73, 0x70, 0xe1, 0x28, 0x04,
+    0x73, 0x72, 0x6f, 0x62, 0xf2, 0x20, 0x01, 0xe1, 0x28, 0xe4, 0x75, 0x73, 0x61, 0xe1, 0x28, 0xae,
+    0x57, 0xf2, 0x68, 0x0a, 0x00, 0xb7, 0x5e, 0x06, 0x00, 0xf6, 0x28, 0xd3, 0x70, 0x64, 0x69, 0x6c,
+    0x73, 0x2d, 0x65, 0x72, 0x74, 0xf3, 0x48, 0x5a, 0x54, 0x90, 0x6a, 0xee, 0xe8, 0x07, 0xf2, 0x3d,
+    0x17, 0x00, 0xb0, 0x25, 0x12, 0x00, 0x93, 0x18, 0xe8, 0x5a, 0x0e, 0x00, 0xf9, 0x28, 0x08, 0x5e,
+    0x72, 0xe5, 0x28, 0x20, 0x69, 0xe7, 0x28, 0x13, 0x5d, 0xed, 0x48, 0x9d, 0x75, 0x04, 0x00, 0xef,
+    0x28, 0x73, 0x01, 0xec, 0x88, 0x17, 0x00, 0x13, 0x00, 0x08, 0x00, 0x70, 0x74, 0xec, 0x48, 0xa4,
+    0x72, 0x04, 0x00, 0x65, 0xe8, 0x28, 0x4b, 0x46, 0xeb, 0x28, 0x31, 0x59, 0x62, 0xed, 0x28, 0xad,
+    0x74, 0xeb, 0xa0, 0x26, 0x1f, 0x15, 0x0f, 0x05, 0xf3, 0x48, 0xa8, 0x60, 0x04, 0x00, 0xf5, 0x28,
+    0x83, 0x6b, 0x6b, 0x6f, 0xf4, 0x29, 0xd8, 0x74, 0x69, 0x72, 0xe5, 0x20, 0x01, 0x67, 0xee, 0x28,
+    0xae, 0x70, 0x68, 0x67, 0x6e, 0xe1, 0x28, 0xc6, 0x3e, 0x65, 0x72, 0xe1, 0x28, 0x20, 0x74, 0xea,
+    0x48, 0x04, 0x00, 0x00, 0x5b, 0xe4, 0x48, 0x15, 0x53, 0xbc, 0x3b, 0xe9, 0x40, 0x07, 0x02, 0x72,
+    0xea, 0x28, 0x40, 0x72, 0x6d, 0x65, 0x75, 0xf6, 0x40, 0x09, 0x02, 0x73, 0x65, 0x6b, 0xe1, 0x28,
+    0xb4, 0x73, 0x65, 0x6a, 0x73, 0x65, 0x6d, 0xe1, 0x28, 0x98, 0x72, 0xe7, 0x40, 0x06, 0x02, 0xee,
+    0x28, 0xfd, 0x73, 0xe7, 0x28, 0x8f, 0x3e, 0xe4, 0x88, 0xc7, 0x66, 0x11, 0x47, 0x08, 0x00, 0x55,
+    0x68, 0xec, 0x28, 0xda, 0x73, 0x61, 0x79, 0x62, 0x2d, 0x79, 0x72, 0x65, 0xf4, 0x20, 0x01, 0xf4,
+    0x28, 0xd4, 0x75, 0xe4, 0xe8, 0x07, 0xc8, 0x01, 0xbc, 0x01, 0xa5, 0x01, 0x86, 0x01, 0x80, 0x00,
+    0x1b, 0x00, 0x0e, 0x00, 0x75, 0x72, 0x65, 0x6b, 0x73, 0x75, 0xe2, 0x20, 0x01, 0xae, 0x28, 0xf5,
+    0x07, 0xf2, 0x40, 0x48, 0x02, 0xef, 0x48, 0x04, 0x00, 0xba, 0x73, 0xea, 0x48, 0x04, 0x00, 0x84,
+    0x5a, 0xe6, 0xc0, 0x2c, 0x28, 0x1a, 0x14, 0x0e, 0x06, 0xf3, 0x68, 0x9b, 0x2d, 0x58, 0x1a, 0xfd,
+    0x3a, 0xf2, 0x48, 0x69, 0x61, 0xa2, 0x6c, 0x6c, 0x6c, 0xe9, 0x28, 0x82, 0x56, 0xe5, 0x48, 0xd8,
+    0x45, 0x04, 0x00, 0x6b, 0xeb, 0x20, 0x01, 0xe5, 0x28, 0xd5, 0x67, 0xe4, 0x28, 0xf6, 0x1d, 0xe1,
+    0x69, 0x06, 0x00, 0x14, 0x70, 0xe0, 0x01, 0xe4, 0x28, 0x65, 0x70, 0xe1, 0x40, 0x0f, 0x02, 0xe7,
+    0x48, 0x04, 0x00, 0x2c, 0x74, 0xe5, 0x20, 0x01, 0xf0, 0x28, 0x43, 0x58, 0x62, 0x6c, 0x61, 0xf6,
+    0x20, 0x01, 0xf3, 0x29, 0xd1, 0x08, 0xee, 0x40, 0x54, 0x02, 0xf5, 0x40, 0x4c, 0x02, 0xf3, 0xe1,
+    0x08, 0x39, 0x2e, 0x27, 0x20, 0x58, 0x13, 0x0f, 0x08, 0x79, 0x6f, 0x6e, 0xee, 0x28, 0x3f, 0x18,
+    0xf4, 0x28, 0x2a, 0x52, 0xf2, 0x48, 0x6d, 0x6a, 0x04, 0x00, 0x65, 0xe7, 0x48, 0x0b, 0x74, 0xa6,
+    0x1d, 0xec, 0x20, 0x01, 0xe1, 0x28, 0x8b, 0x01, 0xeb, 0x20, 0x01, 0xeb, 0x28, 0x18, 0x73, 0xe5,
+    0x48, 0x04, 0x00, 0xdc, 0x73, 0x67, 0xf5, 0x28, 0x52, 0x4d, 0xe4, 0x48, 0x1b, 0x74, 0x04, 0x00,
+    0x6c, 0xe5, 0x20, 0x01, 0xea, 0x28, 0x25, 0x74, 0xec, 0x29, 0x90, 0x5b, 0xe1, 0x60, 0x33, 0x1a,
+    0x03, 0xf3, 0x68, 0x0f, 0x00, 0x06, 0x00, 0x5b, 0x67, 0x6e, 0x61, 0x69, 0x74, 0x73, 0xe9, 0x28,
+    0xa1, 0x6e, 0x65, 0x6c, 0xec, 0x28, 0x7d, 0x67, 0x72, 0x74, 0xf3, 0x21, 0x01, 0xe5, 0x68, 0x0d,
+    0x00, 0xd7, 0x2c, 0x06, 0x00, 0xed, 0x20, 0x01, 0xec, 0x28, 0xcb, 0x72, 0x64, 0xe5, 0x28, 0x29,
+    0x71, 0xec, 0xe0, 0x09, 0x6b, 0x62, 0x46, 0x2e, 0x2a, 0x23, 0x13, 0x0d, 0x09, 0xf4, 0x28, 0xe2,
+    0x04, 0xf2, 0x48, 0xcf, 0x73, 0xb7, 0x5c, 0xef, 0x48, 0x04, 0x00, 0x50, 0x72, 0x68, 0x2d, 0x67,
+    0x6f, 0x6b, 0x73, 0xf2, 0x28, 0xa5, 0x5c, 0xee, 0x20, 0x01, 0xe1, 0x28, 0xc2, 0x59, 0xe7, 0x28,
+    0x6b, 0x57, 0xe5, 0x68, 0x0b, 0x00, 0x06, 0x00, 0xac, 0x6e, 0x70, 0xf2, 0x28, 0x64, 0x64, 0xed,
+    0x21, 0x01, 0x6c, 0xe5, 0x20, 0x01, 0xea, 0x28, 0x80, 0x72, 0x64, 0x72, 0x6f, 0x6e, 0xae, 0x68,
+    0x0a, 0x00, 0x56, 0x72, 0x06, 0x00, 0xf9, 0x28, 0xd8, 0x30, 0xe1, 0x48, 0x04, 0x00, 0x68, 0x01,
+    0x67, 0x35, 0xad, 0x28, 0x73, 0x6a, 0x61, 0x64, 0x72, 0x6f, 0x68, 0xae, 0x28, 0xb8, 0x71, 0x2d,
+    0x65, 0x72, 0xe4, 0x48, 0x04, 0x00, 0x43, 0x41, 0xee, 0x28, 0xe0, 0x5a, 0x6c, 0x6f, 0xe6, 0x48,
+    0x71, 0x04, 0x04, 0x00, 0x74, 0xf3, 0x40, 0x0e, 0x02, 0x6f, 0xae, 0x20, 0x01, 0x72, 0xe5, 0x20,
+    0x01, 0xec, 0x28, 0x70, 0x70, 0x65, 0x76, 0xae, 0x28, 0x24, 0x01, 0x69, 0xe5, 0x49, 0x1f, 0x1c,
+    0x04, 0x00, 0xf3, 0x40, 0x08, 0x02, 0x6c, 0x61, 0xe4, 0x28, 0xb4, 0x70, 0xe5, 0x20, 0x01, 0xf4,
+    0x20, 0x7d, 0x62, 0x61, 0x72, 0x6d, 0x2d, 0x6a, 0x64, 0x64, 0xe4, 0x28, 0x1b, 0x6a, 0xe1, 0x60,
+    0x75, 0x59, 0x03, 0x74, 0xf3, 0xe0, 0x07, 0x37, 0x33, 0x27, 0x21, 0x1d, 0x14, 0x07, 0xf2, 0x48,
+    0x3a, 0x4c, 0x04, 0x00, 0xe5, 0x20, 0x01, 0xea, 0x28, 0xc7, 0x72, 0x6f, 0x62, 0xe5, 0x20, 0x01,
+    0xe7, 0x28, 0x28, 0x4c, 0xed, 0x28, 0x0c, 0x59, 0x6c, 0x65, 0xf6, 0x28, 0x95, 0x51, 0xeb, 0x48,
+    0x2b, 0x66, 0x04, 0x00, 0x69, 0x72, 0xe4, 0x28, 0xe7, 0x4e, 0xe7, 0x28, 0x01, 0x16, 0xe5, 0x80,
+    0x15, 0x10, 0x0b, 0x04, 0xee, 0x20, 0x01, 0xee, 0x28, 0x58, 0x70, 0x6c, 0xec, 0x28, 0xdf, 0x48,
+    0x6b, 0xeb, 0x28, 0x8d, 0x64, 0xe2, 0x28, 0x80, 0x71, 0x72, 0x65, 0xe8, 0x69, 0x0b, 0x00, 0x06,
+    0x00, 0xff, 0x06, 0x73, 0xe4, 0x28, 0x9f, 0x02, 0xee, 0x20, 0x01, 0xee, 0x20, 0x01, 0xe9, 0x20,
+    0x01, 0xf6, 0x28, 0x32, 0x6e, 0x71, 0x78, 0x2d, 0x74, 0x67, 0xe7, 0x28, 0x37, 0x07, 0x63, 0xe1,
+    0xe0, 0x07, 0x39, 0x2a, 0x24, 0x1c, 0x14, 0x0c, 0x07, 0x75, 0x77, 0xad, 0x20, 0x28, 0x6f, 0x70,
+    0x2d, 0x64, 0xf2, 0x28, 0xf9, 0x45, 0x6e, 0x35, 0x2d, 0x72, 0xe4, 0x28, 0xef, 0x04, 0x6c, 0x65,
+    0x2d, 0x73, 0xec, 0x28, 0x5d, 0x69, 0x69, 0x6c, 0xad, 0x28, 0x7f, 0x04, 0x38, 0x6d, 0x2d, 0x64,
+    0x6e, 0x75, 0xf3, 0x20, 0x01, 0x79, 0x6e, 0xee, 0x28, 0x0a, 0x05, 0x34, 0x73, 0x2d, 0x61, 0x74,
+    0x73, 0x61, 0x65, 0x66, 0x72, 0x6d, 0xed, 0x28, 0x2f, 0x69, 0xe2, 0xe0, 0x08, 0xc9, 0xb9, 0x9d,
+    0x7f, 0x62, 0x51, 0x3f, 0x08, 0xf1, 0x40, 0x0e, 0x02, 0x73, 0x2d, 0x6e, 0x65, 0x73, 0x6c, 0x61,
+    0x68, 0xf3, 0x28, 0x8a, 0x07, 0x71, 0x2d, 0x6c, 0x61, 0x64, 0x73, 0x6d, 0x6f, 0x72, 0x2d, 0x67,
+    0x6f, 0x2d, 0x65, 0x72, 0x6d, 0x2d, 0x2d, 0x6e, 0x78, 0xae, 0x40, 0x06, 0x02, 0xe5, 0x28, 0x58,
+    0x43, 0xe1, 0x20, 0x01, 0x72, 0x69, 0x2d, 0x79, 0xf2, 0x28, 0x9a, 0x60, 0x6e, 0x6a, 0x2d, 0x64,
+    0x6e, 0x61, 0x6c, 0x68, 0x2d, 0x67, 0x6f, 0x6b, 0x73, 0x72, 0xf5, 0x28, 0xce, 0x47, 0x6a, 0x75,
+    0x2d, 0x65, 0x72, 0x64, 0x69, 0x6c, 0x73, 0x2d, 0x65, 0x72, 0x74, 0xf3, 0x28, 0x3e, 0x0e, 0xe7,
+    0x40, 0x0e, 0x02, 0x6f, 0x2d, 0x6e, 0x65, 0x6a, 0x73, 0x73, 0x65, 0xee, 0x28, 0x00, 0x02, 0x67,
+    0x2d, 0x72, 0x65, 0x67, 0x6e, 0x61, 0x72, 0x61, 0xf6, 0x28, 0x6f, 0x07, 0xe3, 0x40, 0x0f, 0x02,
+    0x7a, 0x2d, 0x6e, 0x65, 0x74, 0x6f, 0x74, 0x2d, 0x65, 0xf2, 0x28, 0x19, 0x07, 0x30, 0x2d, 0x64,
+    0x6e, 0x61, 0x6c, 0x2d, 0x65, 0x72, 0xe4, 0x28, 0x7e, 0x04, 0xe1, 0x60, 0x14, 0x0a, 0x03, 0x6e,
+    0x30, 0x2d, 0xf9, 0x28, 0x3c, 0x05, 0x6c, 0x65, 0x2d, 0x74, 0xec, 0x48, 0x9b, 0x68, 0x67, 0x68,
+    0x69, 0x79, 0xad, 0x28, 0x55, 0x04, 0x35, 0x33, 0x61, 0x79, 0x37, 0x2d, 0x6f, 0x6c, 0x6f, 0x75,
+    0x73, 0x65, 0xe3, 0x28, 0x63, 0x68, 0x32, 0x35, 0x2d, 0x61, 0x6b, 0x69, 0x69, 0x76, 0x61, 0x67,
+    0xe1, 0x28, 0x16, 0x02, 0xe1, 0xe8, 0x1e, 0x35, 0x07, 0xa1, 0x06, 0x93, 0x06, 0x1d, 0x06, 0x10,
+    0x06, 0xe5, 0x05, 0xdb, 0x05, 0xc9, 0x05, 0xa9, 0x05, 0x99, 0x05, 0x73, 0x05, 0x61, 0x70, 0x6d,
+    0x05, 0x60, 0x05, 0x37, 0x05, 0xf1, 0x04, 0xec, 0x04, 0x47, 0x04, 0xf9, 0x03, 0xf4, 0x03, 0xae,
+    0x03, 0x9c, 0x02, 0x60, 0x02, 0x15, 0x02, 0x62, 0x01, 0x45, 0x01, 0x39, 0x01, 0xc5, 0x00, 0x49,
+    0x00, 0x3c, 0x00, 0x7a, 0x39, 0x2d, 0x64, 0x72, 0x6f, 0x6a, 0x66, 0x73, 0xf4, 0x28, 0x29, 0x68,
+    0xf9, 0xe8, 0x07, 0x6f, 0x00, 0x64, 0x00, 0x40, 0x00, 0x37, 0x00, 0x16, 0x00, 0x0e, 0x00, 0xb4,
+    0x4e, 0x67, 0x2d, 0x72, 0x65, 0xe7, 0x28, 0x0b, 0x07, 0x66, 0x2d, 0xf9, 0x60, 0x17, 0x09, 0x03,
+    0x73, 0x74, 0xe9, 0x28, 0xd8, 0x06, 0x72, 0xe5, 0x40, 0x06, 0x02, 0xf4, 0x28, 0x30, 0x01, 0x64,
+    0xee, 0x28, 0x50, 0x60, 0x6b, 0x72, 0xe1, 0x28, 0xd2, 0x01, 0x65, 0x2d, 0x6e, 0x65, 0x6a, 0xf3,
+    0x28, 0x8b, 0x04, 0x62, 0xad, 0x80, 0x1a, 0x12, 0x0b, 0x04, 0x72, 0x65, 0x74, 0xf3, 0x28, 0x41,
+    0x4f, 0x6b, 0x69, 0x76, 0xf2, 0x28, 0x22, 0x01, 0x67, 0x6f, 0x6b, 0x73, 0xed, 0x28, 0xf0, 0x68,
+    0x64, 0x6c, 0x6f, 0xe6, 0x28, 0x76, 0x06, 0x38, 0x2d, 0x61, 0x6e, 0x74, 0x6f, 0x75, 0xf6, 0x28,
+    0x9a, 0x06, 0x37, 0x2d, 0x75, 0x6a, 0x64, 0x61, 0x65, 0xe8, 0x20, 0x30, 0xf8, 0xe0, 0x08, 0x58,
+    0x4e, 0x45, 0x3b, 0x30, 0x1b, 0x12, 0x08, 0x6e, 0x2d, 0x64, 0x72, 0x6f, 0x6a, 0xe6, 0x28, 0x6d,
+    0x06, 0x6d, 0x2d, 0x6e, 0x65, 0x67, 0x6e, 0xe9, 0x20, 0xfb, 0x6a, 0x2d, 0x67, 0x76, 0xe5, 0x40,
+    0x07, 0x02, 0x6c, 0xf2, 0x28, 0x44, 0x05, 0x67, 0xee, 0x20, 0x01, 0xe1, 0x28, 0x12, 0x66, 0x69,
+    0x2d, 0x64, 0x72, 0x67, 0x65, 0x70, 0xf0, 0x28, 0xfb, 0x66, 0x68, 0x2d, 0x6e, 0x65, 0x6c, 0x74,
+    0xec, 0x28, 0x45, 0x02, 0x66, 0x2d, 0x64, 0x6e, 0x61, 0xec, 0x28, 0xa5, 0x02, 0x64, 0x2d, 0x6e,
+    0x6d, 0x61, 0x68, 0xe5, 0x28, 0x50, 0x06, 0x39, 0x2d, 0x64, 0x6c, 0x6f, 0x66, 0x74, 0x73, 0x2d,
+    0x2d, 0x6e, 0x78, 0xae, 0x20, 0x01, 0x61, 0x6f, 0x71, 0x2d, 0x72, 0x65, 0xec, 0x28, 0xbe, 0x68,
+    0x77, 0x68, 0x2d, 0x61, 0x6e, 0x74, 0x6f, 0x75, 0xf6, 0x28, 0x1b, 0x71, 0xf6, 0x69, 0x97, 0x04,
+    0x0e, 0x00, 0x06, 0x00, 0x72, 0xe5, 0x20, 0x01, 0xe9, 0x28, 0x34, 0x56, 0x6c, 0x65, 0x64, 0x61,
+    0x74, 0x73, 0xeb, 0x20, 0x01, 0xef, 0x28, 0xba, 0x6a, 0xf5, 0xe0, 0x09, 0xa4, 0x90, 0x85, 0x7c,
+    0x60, 0x55, 0x37, 0x11, 0x09, 0x7a, 0x2d, 0x73, 0x6d, 0xef, 0x28, 0x66, 0x05, 0x79, 0x2d, 0xf9,
+    0x80, 0x1c, 0x16, 0x0a, 0x04, 0x72, 0x65, 0xf6, 0x28, 0xc1, 0x45, 0xee, 0x40, 0x06, 0x02, 0xee,
+    0x28, 0x24, 0x68, 0xe1, 0x28, 0x4c, 0x05, 0x6d, 0x72, 0xe1, 0x28, 0x4a, 0x70, 0x64, 0x6e, 0xe1,
+    0x28, 0xa2, 0x66, 0x77, 0xad, 0x40, 0x0b, 0x02, 0x6f, 0x72, 0xf9, 0x20, 0x01, 0xf3, 0x28, 0x54,
+    0x66, 0xeb, 0x40, 0x08, 0x02, 0x69, 0x76, 0xea, 0x28, 0xa8, 0x66, 0x61, 0x62, 0xf2, 0x28, 0x11,
+    0x68, 0x76, 0x2d, 0x6e, 0x65, 0xeb, 0x20, 0x01, 0xf9, 0x28, 0xd4, 0x67, 0x75, 0xad, 0x60, 0x10,
+    0x0a, 0x03, 0x73, 0x65, 0x6e, 0xf3, 0x28, 0x0e, 0x70, 0x67, 0x6f, 0xeb, 0x28, 0x12, 0x03, 0x64,
+    0x6e, 0xe1, 0x20, 0x01, 0xec, 0x28, 0xb8, 0x67, 0x6b, 0x2d, 0x72, 0x65, 0x6b, 0xf2, 0x28, 0x4b,
+    0x01, 0x6a, 0x2d, 0x65, 0x6b, 0xe5, 0x20, 0x01, 0xf2, 0x28, 0x22, 0x03, 0x69, 0xad, 0x40, 0x09,
+    0x02, 0x76, 0x6c, 0x65, 0xf3, 0x28, 0x52, 0x04, 0x64, 0x72, 0x6f, 0x6a, 0xe6, 0x28, 0xd7, 0x6f,
+    0x68, 0x2d, 0x64, 0x6e, 0x75, 0xf3, 0x20, 0x01, 0xe5, 0x28, 0xf5, 0x64, 0xf4, 0xc8, 0x40, 0x00,
+    0x0f, 0x6f, 0x34, 0x00, 0x28, 0x00, 0x15, 0x00, 0x0c, 0x00, 0x75, 0x2d, 0x76, 0x72, 0x65, 0xe9,
+    0x28, 0x8c, 0x04, 0xf3, 0x68, 0x06, 0x00, 0xd2, 0x4c, 0x4a, 0x6f, 0x61, 0x65, 0x66, 0x72, 0xe1,
+    0x20, 0x01, 0xed, 0x28, 0x63, 0x48, 0x72, 0x2d, 0x61, 0x67, 0x72, 0xea, 0x20, 0x01, 0xee, 0x28,
+    0x2c, 0x50, 0x70, 0x2d, 0x72, 0x61, 0x64, 0xe4, 0x20, 0x01, 0xea, 0x28, 0x1b, 0x66, 0x6b, 0x6f,
+    0x75, 0x6c, 0x6f, 0xee, 0x28, 0xc1, 0x0e, 0xf3, 0xc8, 0x30, 0x00, 0x1d, 0x00, 0x16, 0x00, 0x10,
+    0x00, 0x0c, 0x00, 0xa4, 0x61, 0xf3, 0x28, 0x67, 0x6a, 0x6d, 0x6f, 0xf2, 0x29, 0x0e, 0x6f, 0x6c,
+    0xe1, 0x48, 0xbe, 0x6e, 0xe6, 0x6d, 0xe9, 0x48, 0xb8, 0x60, 0x04, 0x00, 0x65, 0xf2, 0x40, 0x06,
+    0x02, 0xf2, 0x28, 0x67, 0x56, 0xe4, 0x28, 0xc0, 0x3c, 0xe1, 0x48, 0xc2, 0x50, 0x04, 0x00, 0xef,
+    0x28, 0xbc, 0x50, 0xf2, 0xe8, 0x0e, 0x09, 0x01, 0xca, 0x00, 0xb5, 0x00, 0x72, 0x00, 0x5b, 0x00,
+    0x57, 0x00, 0x46, 0x00, 0x3e, 0x00, 0x36, 0x00, 0x22, 0x21, 0x2d, 0x00, 0x25, 0x00, 0xab, 0x43,
+    0x1c, 0x00, 0x76, 0x2d, 0x72, 0x76, 0x73, 0xf9, 0x28, 0xfd, 0x6e, 0x73, 0x2d, 0x6c, 0x61, 0xe4,
+    0x28, 0xbb, 0x03, 0x70, 0x2d, 0x73, 0x64, 0x6e, 0xe9, 0x28, 0x35, 0x64, 0x6e, 0x2d, 0x65, 0x73,
+    0xe1, 0x28, 0x64, 0x01, 0x6d, 0x2d, 0x74, 0x6c, 0xef, 0x28, 0x5c, 0x4f, 0x6c, 0xad, 0x40, 0x08,
+    0x02, 0x6c, 0x61, 0xf2, 0x28, 0x62, 0x4f, 0x64, 0x72, 0xef, 0x28, 0x72, 0x6f, 0xeb, 0x28, 0x6b,
+    0x57, 0x6a, 0xad, 0x60, 0x0c, 0x07, 0x03, 0x73, 0xe4, 0x20, 0x0a, 0x72, 0xef, 0x28, 0xdf, 0x5d,
+    0x64, 0xf2, 0x20, 0x01, 0xe1, 0x28, 0xe6, 0x66, 0xe9, 0x40, 0x06, 0x02, 0xf3, 0x28, 0x18, 0x1b,
+    0xad, 0x60, 0x31, 0x2d, 0x03, 0xf9, 0x80, 0x1c, 0x17, 0x10, 0x04, 0xf2, 0x40, 0x06, 0x02, 0xf9,
+    0x28, 0x9f, 0x66, 0xf5, 0x28, 0xda, 0x63, 0xec, 0x20, 0x01, 0xe5, 0x28, 0x1d, 0x6f, 0x6b, 0xf3,
+    0x28, 0x09, 0x44, 0xe4, 0x40, 0x06, 0x02, 0xee, 0x28, 0x01, 0x44, 0xe1, 0x28, 0x51, 0x66, 0xf2,
+    0x28, 0x89, 0x01, 0x6c, 0xe2, 0x20, 0x01, 0xef, 0x28, 0xfe, 0x64, 0x68, 0xad, 0x40, 0x08, 0x02,
+    0x65, 0x6d, 0xea, 0x28, 0x62, 0x6e, 0xe1, 0x40, 0x05, 0x02, 0xf9, 0x20, 0x32, 0xec, 0x20, 0x3c,
+    0x67, 0xad, 0xc0, 0x2f, 0x1f, 0x1a, 0x12, 0x0c, 0x06, 0x73, 0x6f, 0xf2, 0x28, 0x21, 0x66, 0x6f,
+    0x6c, 0xed, 0x28, 0xf4, 0x64, 0x6e, 0xe5, 0x20, 0x01, 0xf4, 0x28, 0x84, 0x63, 0x6d, 0xf5, 0x28,
+    0x9b, 0x03, 0xe5, 0x40, 0x07, 0x02, 0x6e, 0xe7, 0x28, 0xaa, 0x64, 0xe4, 0x20, 0x01, 0xf2, 0x28,
+    0xd0, 0x6e, 0x61, 0xee, 0x40, 0x06, 0x02, 0xee, 0x28, 0x27, 0x66, 0xed, 0x28, 0x96, 0x64, 0x66,
+    0x2d, 0xe1, 0x28, 0x39, 0x01, 0xf1, 0x60, 0x29, 0x0d, 0x03, 0x79, 0x2d, 0x74, 0xe9, 0x20, 0x01,
+    0xee, 0x28, 0xfb, 0x02, 0x78, 0xad, 0x40, 0x12, 0x02, 0xf2, 0x40, 0x08, 0x02, 0x69, 0x6d, 0xf0,
+    0x28, 0x86, 0x64, 0x65, 0x6d, 0xe2, 0x28, 0x80, 0x64, 0x69, 0x70, 0x70, 0xe8, 0x28, 0x31, 0x63,
+    0x30, 0x2d, 0xf4, 0x60, 0x11, 0x0b, 0x03, 0x76, 0xe5, 0x20, 0x01, 0xe9, 0x28, 0x8a, 0x64, 0x73,
+    0x6f, 0xf5, 0x28, 0x66, 0x6e, 0x62, 0x61, 0xef, 0x28, 0x16, 0x63, 0x70, 0xf0, 0x28, 0xb9, 0x59,
+    0xef, 0xc0, 0x3b, 0x31, 0x2b, 0x25, 0x1b, 0x06, 0x77, 0xad, 0x40, 0x0a, 0x02, 0x75, 0xe2, 0x20,
+    0x01, 0xec, 0x28, 0xd2, 0x6d, 0x61, 0x6e, 0xf2, 0x48, 0x57, 0x6e, 0xad, 0x6d, 0x76, 0x2d, 0x6d,
+    0xf5, 0x20, 0x01, 0xf2, 0x28, 0x52, 0x64, 0x73, 0x2d, 0xeb, 0x28, 0x8f, 0x02, 0x72, 0x2d, 0x61,
+    0xf3, 0x20, 0x14, 0x71, 0x2d, 0x6e, 0xe1, 0x20, 0x01, 0xe7, 0x28, 0xc1, 0x65, 0x70, 0xad, 0x40,
+    0x0a, 0x02, 0x73, 0xe5, 0x20, 0x01, 0xee, 0x28, 0xfb, 0x63, 0x6c, 0xe1, 0x20, 0xc3, 0xee, 0xe8,
+    0x0c, 0x97, 0x00, 0x8e, 0x00, 0x7b, 0x00, 0x68, 0x00, 0x5b, 0x00, 0x8f, 0x1a, 0x57, 0x00, 0x3a,
+    0x68, 0x36, 0x65, 0x53, 0x00, 0x1f, 0x00, 0x18, 0x00, 0x7a, 0x2d, 0x72, 0xe5, 0x28, 0x5d, 0x09,
+    0xf4, 0x40, 0x28, 0x02, 0x6f, 0x75, 0xf6, 0x60, 0x11, 0x0d, 0x03, 0x73, 0xe1, 0x48, 0xbe, 0x6b,
+    0x04, 0x00, 0xf4, 0x20, 0x30, 0xe9, 0x28, 0xd7, 0x62, 0xe1, 0x48, 0x04, 0x00, 0xda, 0x6c, 0xe3,
+    0x40, 0x02, 0x05, 0xe3, 0x20, 0x01, 0xe8, 0x28, 0x24, 0x6c, 0x61, 0x6f, 0x75, 0x76, 0x61, 0x74,
+    0xe8, 0x28, 0x67, 0x16, 0xf3, 0x28, 0xbc, 0x6c, 0xed, 0x28, 0x50, 0x54, 0x64, 0x6f, 0x75, 0x76,
+    0x73, 0xe1, 0x20, 0x01, 0x74, 0xf6, 0x28, 0x0b, 0x5e, 0xe1, 0x48, 0x04, 0x00, 0xd0, 0x6c, 0xf2,
+    0x69, 0x06, 0x00, 0x4b, 0x6b, 0xca, 0x6c, 0x2d, 0xe9, 0x28, 0x0a, 0x04, 0x35, 0xad, 0x40, 0x08,
+    0x02, 0x74, 0x61, 0xec, 0x28, 0x6e, 0x63, 0xe1, 0x20, 0x01, 0x73, 0xe9, 0x28, 0xc1, 0x64, 0x32,
+    0x2d, 0xe4, 0x20, 0x01, 0xef, 0x28, 0x91, 0x63, 0x30, 0xad, 0x20, 0x01, 0xf4, 0x20, 0x01, 0xf3,
+    0x28, 0xad, 0x64, 0x6d, 0xf5, 0x28, 0x4a, 0x5e, 0xec, 0xc8, 0x12, 0x6b, 0x39, 0x00, 0x33, 0x00,
+    0x2a, 0x00, 0x1a, 0x00, 0x0c, 0x00, 0xf5, 0x48, 0x04, 0x00, 0xf6, 0x6b, 0x2d, 0xe5, 0x20, 0x01,
+    0xe4, 0x28, 0x8c, 0x64, 0x74, 0xad, 0x40, 0x09, 0x02, 0xf4, 0x20, 0x01, 0xef, 0x28, 0x3b, 0x6d,
+    0xe9, 0x28, 0x36, 0x01, 0x73, 0x65, 0xee, 0x20, 0x01, 0xee, 0x28, 0xf6, 0x4a, 0xef, 0x48, 0x06,
+    0x5d, 0xcf, 0x6b, 0x6c, 0x61, 0x68, 0x72, 0xe5, 0x20, 0x01, 0xf6, 0x28, 0x46, 0x6c, 0xeb, 0x68,
+    0xd1, 0x60, 0x19, 0x00, 0x06, 0x00, 0x69, 0x69, 0xf6, 0x40, 0x06, 0x02, 0xf2, 0x28, 0xb3, 0x69,
+    0x61, 0x67, 0x6e, 0xe1, 0x48, 0xbc, 0x60, 0xeb, 0x6b, 0xe8, 0x20, 0x01, 0x6f, 0xea, 0x20, 0x01,
+    0xf3, 0x20, 0x01, 0xe1, 0x28, 0x2c, 0x32, 0xea, 0x40, 0x06, 0x02, 0xf3, 0x28, 0xa4, 0x60, 0x64,
+    0xe4, 0x28, 0xda, 0x0d, 0x69, 0x7a, 0xad, 0x28, 0x75, 0x5b, 0xe7, 0xa8, 0x17, 0x00, 0x27, 0x69,
+    0xa5, 0x4a, 0x13, 0x00, 0x0a, 0x00, 0x72, 0x61, 0x6a, 0xee, 0x48, 0x3f, 0x00, 0x47, 0x69, 0xec,
+    0x28, 0x92, 0x6b, 0x31, 0x30, 0x61, 0x71, 0x30, 0x2d, 0x69, 0x6e, 0x65, 0xf6, 0x28, 0xe8, 0x62,
+    0xe6, 0x40, 0x07, 0x02, 0x32, 0xad, 0x28, 0xb0, 0x62, 0x31, 0xad, 0x48, 0x63, 0x61, 0x97, 0x62,
+    0xe4, 0xa8, 0x81, 0x67, 0x13, 0x00, 0x58, 0x66, 0x0e, 0x00, 0x0a, 0x00, 0xf5, 0x28, 0x11, 0x68,
+    0x6e, 0xe1, 0x28, 0xaa, 0x30, 0x69, 0x69, 0xf3, 0x20, 0x01, 0x65, 0x76, 0xf6, 0x28, 0xb2, 0x67,
+    0x62, 0x63, 0x74, 0x2d, 0x65, 0x69, 0x6d, 0x65, 0x75, 0x76, 0x65, 0x6a, 0x73, 0x65, 0xed, 0x28,
+    0x85, 0x6c, 0xe1, 0x21, 0x01, 0xae, 0x20, 0x01, 0xf3, 0x28, 0x56, 0x6b, 0xb8, 0x60, 0x1a, 0x0f,
+    0x03, 0x6d, 0x2d, 0x64, 0x61, 0x72, 0x65, 0x68, 0x73, 0xe4, 0x28, 0x7a, 0x01, 0x6c, 0x2d, 0x6c,
+    0x61, 0x64, 0x72, 0x75, 0xe1, 0x28, 0x13, 0x01, 0x6b, 0x2d, 0x72, 0x65, 0x6b, 0x69, 0x65, 0x2d,
+    0xe5, 0x20, 0x01, 0xf2, 0x28, 0xe7, 0x63, 0x37, 0x6b, 0x2d, 0x61, 0x6e, 0x74, 0x6f, 0x75, 0x76,
+    0x61, 0xe3, 0x20, 0x42, 0xb4, 0x80, 0x50, 0x44, 0x23, 0x04, 0x79, 0xad, 0x40, 0x10, 0x02, 0x69,
+    0x6b, 0x68, 0x76, 0x6c, 0x61, 0x72, 0xe1, 0x20, 0x01, 0xe5, 0x28, 0x3c, 0x62, 0x61, 0x67, 0x72,
+    0x6a, 0x6e, 0x65, 0x76, 0x76, 0xe1, 0x28, 0x89, 0x63, 0x73, 0xad, 0x40, 0x10, 0x02, 0x69, 0x6d,
+    0x70, 0x6f, 0x75, 0x76, 0x74, 0xe1, 0x20, 0x01, 0xec, 0x28, 0xff, 0x6b, 0x61, 0x6e, 0x74, 0x6f,
+    0x75, 0x76, 0xe1, 0x20, 0x01, 0x63, 0xe8, 0x28, 0x0f, 0x62, 0x36, 0x2d, 0x6e, 0x65, 0x6c, 0x61,
+    0x64, 0x6e, 0xea, 0x28, 0xe5, 0x6b, 0x35, 0xad, 0x60, 0x17, 0x0b, 0x03, 0x74, 0x65, 0x64, 0x6e,
+    0x61, 0xec, 0x20, 0x7b, 0x67, 0x6f, 0x6b, 0x73, 0x6e, 0xe5, 0x20, 0x01, 0xf2, 0x28, 0x81, 0x60,
+    0x64, 0x6e, 0x61, 0x6c, 0x65, 0x70, 0xf2, 0x28, 0x1d, 0x4d, 0x33, 0x67, 0x2d, 0x64, 0x61, 0x74,
+    0x73, 0x6f, 0x62, 0x65, 0xe7, 0x28, 0xb1, 0x61, 0xb1, 0xa0, 0x85, 0x3b, 0x2e, 0x1f, 0x05, 0x76,
+    0x2d, 0xf9, 0x40, 0x0e, 0x02, 0x76, 0x72, 0xe5, 0x20, 0x01, 0xea, 0x20, 0x01, 0xeb, 0x28, 0x84,
+    0x61, 0x73, 0x65, 0x6e, 0x6e, 0xe5, 0x28, 0xd7, 0x62, 0x73, 0xad, 0x20, 0x01, 0x6c, 0x61, 0x64,
+    0x72, 0xea, 0x20, 0x01, 0xf4, 0x28, 0x6d, 0x61, 0x72, 0x2d, 0x64, 0x61, 0x74, 0x73, 0xe7, 0x20,
+    0x01, 0xf2, 0x28, 0xe3, 0x6a, 0x71, 0xad, 0xc0, 0x3c, 0x34, 0x2b, 0x1a, 0x0f, 0x06, 0x73, 0x73,
+    0x6f, 0x66, 0x65, 0xee, 0x28, 0x62, 0x61, 0x72, 0x65, 0x67, 0x6e, 0xe1, 0x20, 0x01, 0xf9, 0x28,
+    0x57, 0x61, 0xee, 0x40, 0x07, 0x02, 0x6f, 0x72, 0xe6, 0x20, 0x0f, 0x65, 0x67, 0x6e, 0x69, 0xe4,
+    0x28, 0xfe, 0x5f, 0x6c, 0x61, 0x64, 0xef, 0x20, 0x01, 0xad, 0x20, 0x10, 0x67, 0x72, 0x65, 0x62,
+    0xf3, 0x28, 0x08, 0x3c, 0x61, 0x73, 0x69, 0x65, 0xf2, 0x20, 0x01, 0xf2, 0x28, 0x16, 0x61, 0x70,
+    0x2d, 0x6e, 0x65, 0x64, 0x72, 0xe1, 0x20, 0x01, 0xe7, 0x28, 0x91, 0x06, 0xb0, 0x80, 0x2b, 0x20,
+    0x12, 0x04, 0x6b, 0x2d, 0x6e, 0x65, 0x67, 0x6e, 0x61, 0xee, 0x20, 0x01, 0xf6, 0x28, 0x97, 0x6a,
+    0x67, 0x2d, 0x6c, 0x6b, 0x73, 0x65, 0x64, 0xec, 0x20, 0x01, 0xe9, 0x28, 0x05, 0x61, 0x63, 0x2d,
+    0x69, 0x65, 0x68, 0x73, 0x72, 0xe7, 0x28, 0xb1, 0x61, 0x62, 0x2d, 0x65, 0x6b, 0x68, 0x67, 0xee,
+    0x20, 0x01, 0xe1, 0x20, 0x01, 0xf2, 0x28, 0x6e, 0x6a, 0xed, 0xa9, 0xa9, 0x61, 0xc5, 0x69, 0x88,
+    0x5d, 0xb9, 0x61, 0xe1, 0x4c, 0x6c, 0xec, 0x48, 0xd6, 0x5f, 0xfa, 0x69, 0xea, 0x21, 0x01, 0xae,
+    0xe8, 0x08, 0x69, 0x67, 0xea, 0x69, 0x5b, 0x67, 0xe2, 0x69, 0xda, 0x69, 0xaa, 0x67, 0xb0, 0x69,
+    0xa8, 0x69, 0xe9, 0xc9, 0x1d, 0x00, 0xbc, 0x69, 0x11, 0x00, 0x60, 0x63, 0xc6, 0x69, 0x0c, 0x00,
+    0x73, 0xf9, 0x28, 0x40, 0x50, 0xe4, 0x48, 0x89, 0x5b, 0x04, 0x00, 0xf5, 0x48, 0xd0, 0x69, 0xb4,
+    0x68, 0xae, 0xe8, 0x15, 0x08, 0x03, 0x00, 0x03, 0xed, 0x02, 0xe2, 0x02, 0xdd, 0x02, 0xa4, 0x02,
+    0x2b, 0x02, 0x0c, 0x02, 0x07, 0x02, 0xe2, 0x01, 0xa8, 0x69, 0xb7, 0x01, 0x9c, 0x01, 0x61, 0x01,
+    0x2a, 0x01, 0xde, 0x00, 0x64, 0x00, 0x5b, 0x00, 0x57, 0x00, 0x36, 0x00, 0x2a, 0x00, 0xf9, 0x68,
+    0x06, 0x00, 0xd5, 0x50, 0xc6, 0x68, 0xb5, 0x28, 0x14, 0x5b, 0xf8, 0x60, 0x14, 0x0a, 0x03, 0x72,
+    0x6f, 0x74, 0xe9, 0x28, 0x41, 0x69, 0x63, 0xf1, 0x21, 0x01, 0x2e, 0x73, 0xf9, 0x28, 0xfe, 0x5a,
+    0x62, 0x73, 0x6c, 0x70, 0x72, 0x62, 0x76, 0xae, 0x28, 0x27, 0x69, 0xf7, 0x28, 0x04, 0x68, 0x76,
+    0x67, 0x69, 0x62, 0x2e, 0xb0, 0x28, 0x2f, 0x5b, 0xf4, 0x80, 0x63, 0x4d, 0x42, 0x04, 0xf3, 0x40,
+    0x37, 0x02, 0x75, 0x64, 0x67, 0x6e, 0x69, 0x68, 0x74, 0xae, 0x80, 0x18, 0x11, 0x08, 0x04, 0x76,
+    0xe5, 0x20, 0x18, 0x67, 0x6e, 0x69, 0x74, 0x73, 0x65, 0xf4, 0x20, 0x12, 0x64, 0x6f, 0x72, 0xf0,
+    0x28, 0xcd, 0x38, 0x63, 0x65, 0x72, 0x73, 0xe9, 0x20, 0x01, 0xe4, 0x20, 0x01, 0xae, 0x48, 0x04,
+    0x00, 0x46, 0x55, 0xe4, 0x28, 0xaf, 0x2a, 0x6f, 0xe8, 0x28, 0xd6, 0x68, 0x72, 0x61, 0x65, 0x64,
+    0x6f, 0x6e, 0x2e, 0xe5, 0x28, 0xb1, 0x4f, 0xe9, 0x80, 0x10, 0x0c, 0x08, 0x04, 0xeb, 0x28, 0x35,
+    0x1e, 0xe7, 0x28, 0xbf, 0x68, 0x64, 0xe5, 0x20, 0xe6, 0xe2, 0x28, 0x52, 0x46, 0xe5, 0x40, 0x07,
+    0x02, 0x6e, 0xef, 0x28, 0xee, 0x06, 0x6b, 0x63, 0xf5, 0x20, 0x01, 0xe2, 0x20, 0x01, 0xf4, 0x28,
+    0xa0, 0x62, 0xf3, 0xe0, 0x07, 0x44, 0x3b, 0x33, 0x27, 0x21, 0x18, 0x07, 0xf4, 0x40, 0x0a, 0x02,
+    0x65, 0xeb, 0x20, 0x01, 0xe3, 0x28, 0xd2, 0x68, 0x61, 0xe3, 0x28, 0xfc, 0x39, 0x70, 0x70, 0x61,
+    0x72, 0x65, 0xf6, 0x28, 0xdf, 0x47, 0x6f, 0x6c, 0xef, 0x28, 0x92, 0x59, 0x6e, 0x65, 0x6d, 0x65,
+    0x69, 0xf3, 0x20, 0x01, 0xad, 0x28, 0x87, 0x67, 0x67, 0x6e, 0x69, 0x68, 0xf4, 0x28, 0xee, 0x61,
+    0x63, 0x6f, 0x64, 0x65, 0x68, 0xf4, 0x28, 0x73, 0x45, 0x33, 0xeb, 0x28, 0x9f, 0x59, 0xf2, 0x40,
+    0x08, 0x02, 0x69, 0x61, 0xec, 0x28, 0x89, 0x1c, 0xe5, 0x60, 0x1d, 0x13, 0x03, 0x76, 0x72, 0x65,
+    0xf3, 0x48, 0x04, 0x00, 0x84, 0x54, 0xe3, 0x20, 0x01, 0xe9, 0x28, 0xf2, 0x5d, 0x74, 0x73, 0x6e,
+    0x65, 0x75, 0x6d, 0xad, 0x28, 0x6e, 0x4d, 0x6e, 0x69, 0x61, 0x74, 0x6e, 0x6f, 0x63, 0x65, 0x72,
+    0x75, 0xfa, 0x28, 0xa2, 0x67, 0xf0, 0x40, 0x30, 0x02, 0x70, 0xe1, 0x40, 0x20, 0x02, 0xe5, 0x40,
+    0x11, 0x02, 0x74, 0x79, 0x62, 0x65, 0x65, 0x62, 0x2e, 0x31, 0xe4, 0x20, 0x01, 0xeb, 0x28, 0xfc,
+    0x62, 0x6e, 0x61, 0x6c, 0xf0, 0x20, 0x01, 0x6b, 0xe3, 0x28, 0x72, 0x67, 0x2d, 0xe1, 0x20, 0x01,
+    0xf2, 0x20, 0x01, 0xf5, 0x28, 0x56, 0x3f, 0x6f, 0xf0, 0x20, 0x01, 0x69, 0xec, 0x28, 0x59, 0x54,
+    0xef, 0x40, 0x15, 0x02, 0xf4, 0x40, 0x0d, 0x02, 0x70, 0x79, 0x72, 0xe3, 0x20, 0x01, 0x74, 0xe6,
+    0x28, 0xad, 0x66, 0xef, 0x28, 0x98, 0x67, 0xe9, 0x28, 0x0f, 0x59, 0xee, 0x80, 0x20, 0x12, 0x0b,
+    0x04, 0xf9, 0x20, 0x01, 0xe4, 0x28, 0xeb, 0x63, 0x72, 0x6f, 0x63, 0xe1, 0x28, 0xfe, 0x58, 0x6d,
+    0x74, 0x73, 0xf0, 0x21, 0x01, 0x2e, 0xeb, 0x20, 0x01, 0xe3, 0x28, 0xc2, 0x66, 0x61, 0xe9, 0x20,
+    0x01, 0x63, 0xe9, 0x28, 0xc4, 0x5c, 0xeb, 0x60, 0x18, 0x13, 0x03, 0x72, 0x61, 0x6d, 0x79, 0x74,
+    0x65, 0x66, 0x61, 0x73, 0x72, 0x65, 0x73, 0xf7, 0x28, 0xb4, 0x0b, 0x6f, 0xf2, 0x28, 0xe1, 0x60,
+    0x63, 0x6f, 0x72, 0x65, 0x67, 0x72, 0x6f, 0xe6, 0x28, 0xaa, 0x02, 0x69, 0xec, 0x28, 0x2b, 0x2f,
+    0x67, 0x6e, 0xe9, 0x40, 0x0a, 0x02, 0x74, 0x73, 0x6f, 0x68, 0xf9, 0x28, 0xf9, 0x33, 0x67, 0x61,
+    0x74, 0x73, 0x6e, 0x69, 0x73, 0x65, 0x72, 0x2e, 0x73, 0x65, 0x63, 0xe9, 0x28, 0x40, 0x5a, 0xe5,
+    0xe8, 0x07, 0x5c, 0x00, 0x51, 0x00, 0x4c, 0x00, 0x3d, 0x00, 0xa8, 0x4b, 0x36, 0x00, 0x0e, 0x00,
+    0xf4, 0x60, 0x11, 0x0b, 0x03, 0x79, 0x62, 0x65, 0x65, 0xe2, 0x28, 0xbe, 0x29, 0x6e, 0x65, 0xf7,
+    0x28, 0x25, 0x14, 0xe9, 0x40, 0x0b, 0x02, 0x73, 0x6e, 0x6f, 0x65, 0x68, 0xf4, 0x28, 0x5b, 0x5c,
+    0x62, 0xe5, 0x20, 0x01, 0xf5, 0x28, 0x37, 0x67, 0x73, 0x75, 0x66, 0xf8, 0x28, 0x19, 0x66, 0xec,
+    0x48, 0x04, 0x00, 0xcf, 0x5e, 0x61, 0x63, 0x73, 0x6e, 0x6f, 0xef, 0x28, 0xc8, 0x58, 0x65, 0xe7,
+    0x28, 0x28, 0x36, 0x64, 0x6f, 0x6e, 0x70, 0x70, 0x61, 0x64, 0xae, 0x28, 0xf1, 0x54, 0xe3, 0x40,
+    0x0a, 0x02, 0x69, 0x76, 0x65, 0x64, 0xee, 0x28, 0xcc, 0x16, 0x61, 0x70, 0x73, 0x69, 0x6e, 0x75,
+    0x2e, 0x31, 0x72, 0x66, 0xad, 0x28, 0x81, 0x65, 0xe4, 0x68, 0x65, 0x65, 0x2d, 0x00, 0x06, 0x00,
+    0xf5, 0x48, 0x04, 0x00, 0xa9, 0x5d, 0x6f, 0x6c, 0xe3, 0x40, 0x07, 0x02, 0x72, 0xef, 0x28, 0xf3,
+    0x57, 0x69, 0x61, 0x7a, 0x6e, 0x61, 0x62, 0xae, 0x48, 0x96, 0x4f, 0x04, 0x00, 0x73, 0x64, 0x72,
+    0x61, 0x79, 0x6b, 0xe3, 0x28, 0x44, 0x58, 0x72, 0x61, 0x6f, 0x62, 0x65, 0x6c, 0xe7, 0x28, 0xbe,
+    0x0b, 0x63, 0xfa, 0x28, 0xc4, 0x65, 0xe2, 0x48, 0x04, 0x00, 0x00, 0x1c, 0x61, 0xec, 0x28, 0x10,
+    0x52, 0xe1, 0x40, 0x09, 0x02, 0x74, 0x61, 0x64, 0xad, 0x28, 0xa6, 0x66, 0x6d, 0x69, 0x6e, 0x69,
+    0xe6, 0x28, 0xaf, 0x62, 0x38, 0xb3, 0x20, 0x01, 0xb0, 0x28, 0xc9, 0x51, 0x33, 0xb5, 0x28, 0x75,
+    0x54, 0x68, 0x77, 0x73, 0xef, 0x28, 0xfc, 0x56, 0xe7, 0x48, 0x37, 0x5b, 0x04, 0x00, 0xee, 0x49,
+    0x96, 0x59, 0x60, 0x60, 0xe6, 0x21, 0x01, 0x6e, 0xe9, 0x21, 0x01, 0xae, 0xe8, 0x0a, 0x61, 0x00,
+    0x53, 0x00, 0x4d, 0x00, 0x45, 0x00, 0x3f, 0x00, 0x36, 0x00, 0x21, 0x00, 0x1c, 0x00, 0xc5, 0x65,
+    0x14, 0x00, 0x7a, 0xed, 0x20, 0x01, 0xf5, 0x28, 0xc6, 0x59, 0x74, 0xf3, 0x28, 0xb9, 0x40, 0xf3,
+    0x40, 0x10, 0x02, 0x6e, 0xe4, 0x68, 0x06, 0x00, 0x2e, 0x54, 0xd4, 0x64, 0x2d, 0xe3, 0x28, 0xe5,
+    0x51, 0xe9, 0x20, 0x48, 0x72, 0x75, 0xef, 0x20, 0x01, 0xad, 0x28, 0xa3, 0x59, 0xf0, 0x48, 0x54,
+    0x42, 0x4b, 0x55, 0x6f, 0x66, 0x6e, 0x69, 0xad, 0x28, 0x87, 0x64, 0x6d, 0x61, 0xe3, 0x28, 0x61,
+    0x41, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x73, 0x77, 0xef, 0x20, 0x01, 0xee, 0x28, 0xb8, 0x61, 0xe5,
+    0x80, 0x22, 0x1a, 0x0e, 0x04, 0x74, 0x61, 0x64, 0x70, 0x75, 0x73, 0xee, 0x29, 0x7d, 0x63, 0x72,
+    0x6f, 0x6d, 0x2d, 0x72, 0x6f, 0x66, 0x2d, 0xe5, 0x28, 0x6a, 0x23, 0x68, 0x74, 0x2d, 0x73, 0xeb,
+    0x28, 0x23, 0x5f, 0xe7, 0x40, 0x0d, 0x02, 0x65, 0x6c, 0x6c, 0x6f, 0x63, 0x65, 0x76, 0xef, 0x28,
+    0xc9, 0x0e, 0x64, 0x65, 0x6c, 0x77, 0x6f, 0x6e, 0x6b, 0x2d, 0x66, 0x6f, 0x2d, 0xec, 0x40, 0x05,
+    0x02, 0xec, 0x20, 0x01, 0x65, 0xf2, 0x28, 0x22, 0x65, 0xe5, 0x68, 0xd7, 0x65, 0x0e, 0x00, 0x06,
+    0x00, 0x6d, 0x6f, 0x72, 0x61, 0xe6, 0x28, 0x86, 0x65, 0xe4, 0x48, 0xde, 0x61, 0x4a, 0x60, 0xe4,
+    0x89, 0x14, 0x00, 0x0f, 0x00, 0x30, 0x5b, 0x08, 0x00, 0x7a, 0x64, 0x37, 0xe1, 0x28, 0x78, 0x66,
+    0x61, 0xe7, 0x28, 0x9f, 0x62, 0xae, 0xe8, 0x08, 0x00, 0x3a, 0x16, 0x00, 0xb4, 0x65, 0xac, 0x65,
+    0xa4, 0x65, 0x10, 0x00, 0x7a, 0x65, 0x72, 0x65, 0xf4, 0x48, 0x88, 0x65, 0xad, 0x5d, 0xe4, 0x28,
+    0x9c, 0x62, 0xe3, 0xc9, 0x1e, 0x00, 0xa9, 0x65, 0x64, 0x65, 0xeb, 0x63, 0x17, 0x00, 0x0c, 0x00,
+    0xf3, 0x48, 0x04, 0x00, 0x72, 0x5a, 0x65, 0xe4, 0x28, 0xea, 0x4d, 0xed, 0x20, 0x01, 0xe1, 0x28,
+    0x87, 0x5d, 0xae, 0xe8, 0x0e, 0xc7, 0x5e, 0x42, 0x47, 0x7a, 0x00, 0x76, 0x00, 0x77, 0x65, 0x72,
+    0x00, 0x63, 0x00, 0x57, 0x00, 0x98, 0x63, 0x51, 0x00, 0x3b, 0x00, 0x1c, 0x00, 0x3d, 0x65, 0x35,
+    0x65, 0xf4, 0x88, 0x19, 0x00, 0x3f, 0x65, 0x08, 0x00, 0x80, 0x63, 0x69, 0x6c, 0x70, 0x65, 0x72,
+    0x64, 0x65, 0x6c, 0x6c, 0x61, 0x77, 0x65, 0x72, 0x69, 0xe6, 0x21, 0x38, 0xb4, 0x28, 0x27, 0x65,
+    0xf3, 0x48, 0x04, 0x00, 0x4c, 0x48, 0x65, 0x67, 0x61, 0xf0, 0x48, 0x04, 0x00, 0x0c, 0x64, 0xe4,
+    0x20, 0x01, 0xe1, 0x28, 0xbd, 0x59, 0x70, 0x61, 0xf4, 0x28, 0x35, 0x56, 0xed, 0x48, 0x04, 0x00,
+    0x2d, 0x50, 0xef, 0x48, 0x3f, 0x5e, 0x01, 0x65, 0xec, 0x48, 0x0d, 0x65, 0x04, 0x00, 0x70, 0x65,
+    0xf2, 0x21, 0x01, 0xae, 0x28, 0x7e, 0x36, 0xe9, 0x28, 0xd0, 0x5a, 0xe5, 0x28, 0x0f, 0x04, 0x64,
+    0xf2, 0x48, 0xf0, 0x64, 0x50, 0x1c, 0xe2, 0x89, 0x0c, 0x00, 0xe0, 0x63, 0x08, 0x00, 0x48, 0x33,
+    0xe9, 0x28, 0x3d, 0x5e, 0xae, 0xe8, 0x0d, 0x93, 0x00, 0x31, 0x39, 0x8e, 0x00, 0x77, 0x00, 0xb5,
+    0x44, 0x70, 0x00, 0x4e, 0x00, 0xd5, 0x64, 0x34, 0x00, 0x2a, 0x00, 0x1a, 0x00, 0xab, 0x64, 0x31,
+    0x62, 0xf4, 0x68, 0x06, 0x00, 0xaf, 0x64, 0xf0, 0x62, 0x61, 0xf3, 0x20, 0x01, 0xeb, 0x28, 0xcc,
+    0x64, 0x73, 0x61, 0xe9, 0x20, 0x01, 0x63, 0xe9, 0x28, 0xd9, 0x28, 0xef, 0x88, 0xd3, 0x62, 0x12,
+    0x00, 0xf8, 0x5d, 0x08, 0x00, 0x74, 0x6e, 0x65, 0x69, 0x6d, 0x69, 0xf6, 0x28, 0x80, 0x63, 0x6c,
+    0x62, 0xe5, 0x28, 0xd1, 0x60, 0xec, 0x48, 0x04, 0x00, 0x90, 0x64, 0xe1, 0x48, 0x04, 0x00, 0x83,
+    0x49, 0x6e, 0x6f, 0xe9, 0x40, 0x0a, 0x02, 0x73, 0xe5, 0x20, 0x01, 0xe6, 0x28, 0x5f, 0x47, 0x63,
+    0x61, 0x6e, 0x69, 0xf2, 0x28, 0xcb, 0x43, 0xe9, 0x20, 0x01, 0xeb, 0x28, 0x08, 0x31, 0xe5, 0x40,
+    0x10, 0x02, 0x74, 0xf2, 0x48, 0x78, 0x64, 0x04, 0x00, 0x6f, 0xf0, 0x48, 0x55, 0x60, 0x47, 0x4e,
+    0x72, 0xe2, 0x28, 0xfe, 0x58, 0x64, 0xf5, 0x28, 0x41, 0x11, 0xe1, 0xc0, 0x6c, 0x2d, 0x1f, 0x18,
+    0x0f, 0x06, 0x76, 0x69, 0x74, 0x61, 0x72, 0xe5, 0x28, 0x6d, 0x28, 0x74, 0xf3, 0x20, 0x01, 0x69,
+    0xf6, 0x28, 0x1f, 0x62, 0x73, 0x65, 0x72, 0xf0, 0x28, 0x5e, 0x36, 0xee, 0x40, 0x07, 0x02, 0x69,
+    0xe3, 0x28, 0x79, 0x0a, 0x65, 0xe7, 0x28, 0x72, 0x15, 0xe9, 0xa0, 0x2d, 0x20, 0x16, 0x0a, 0x05,
+    0x76, 0xe9, 0x28, 0x6c, 0x41, 0x72, 0xf4, 0x48, 0x14, 0x59, 0x04, 0x00, 0x73, 0xf5, 0x28, 0xe2,
+    0x33, 0xed, 0x48, 0xb1, 0x06, 0x04, 0x00, 0xef, 0x28, 0x40, 0x37, 0x67, 0x6f, 0x6c, 0xef, 0x48,
+    0x3f, 0x37, 0x04, 0x00, 0xee, 0x28, 0x70, 0x4d, 0xe3, 0x40, 0x06, 0x02, 0xee, 0x28, 0x90, 0x2c,
+    0xe1, 0x20, 0x01, 0x72, 0xe3, 0x28, 0x15, 0x39, 0x63, 0xe9, 0x48, 0xcd, 0x58, 0x2a, 0x4d, 0xe1,
+    0x41, 0x07, 0x02, 0x62, 0xef, 0x28, 0x6e, 0x4f, 0xae, 0xc8, 0x14, 0x00, 0x9b, 0x63, 0x10, 0x00,
+    0xc5, 0x63, 0xd8, 0x55, 0x0c, 0x00, 0xf6, 0x28, 0x88, 0x63, 0xe7, 0x28, 0xc6, 0x63, 0xe2, 0x28,
+    0x46, 0x63, 0x37, 0x36, 0x69, 0x34, 0x6f, 0x72, 0xe6, 0x20, 0x01, 0xf9, 0x28, 0xaf, 0x64, 0xee,
+    0xe8, 0x14, 0xd6, 0x04, 0x7a, 0x04, 0x66, 0x04, 0x60, 0x03, 0x50, 0x03, 0x01, 0x03, 0xda, 0x02,
+    0xc6, 0x02, 0xf9, 0x01, 0xec, 0x01, 0xe3, 0x0c, 0xdb, 0x01, 0x56, 0x01, 0x44, 0x01, 0x2d, 0x01,
+    0x0c, 0x01, 0xc6, 0x00, 0x55, 0x00, 0x33, 0x00, 0x28, 0x00, 0x77, 0xef, 0x48, 0x56, 0x5f, 0x04,
+    0x00, 0xf4, 0x29, 0xa9, 0x0b, 0xf6, 0x21, 0x01, 0xae, 0xe8, 0x0a, 0x3f, 0x61, 0xf0, 0x60, 0x71,
+    0x63, 0x65, 0x49, 0x61, 0x63, 0xcd, 0x58, 0x14, 0x00, 0x37, 0x63, 0x2f, 0x63, 0x54, 0x5b, 0xf4,
+    0x68, 0x41, 0x63, 0x82, 0x61, 0x2d, 0x63, 0xf5, 0xa8, 0xe3, 0x61, 0x18, 0x00, 0x14, 0x00, 0x0a,
+    0x00, 0xd3, 0x62, 0xf8, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xed, 0x28, 0xea, 0x5e, 0xf3, 0x28, 0x52,
+    0x26, 0xf2, 0x21, 0x01, 0xae, 0xe0, 0x08, 0x4d, 0x46, 0x35, 0x31, 0x26, 0x1d, 0x13, 0x08, 0x74,
+    0x6e, 0x65, 0x6d, 0x70, 0x6f, 0x6c, 0xe5, 0x28, 0xd5, 0x55, 0xf3, 0x48, 0x0c, 0x62, 0x04, 0x00,
+    0xf2, 0x28, 0x9d, 0x40, 0x72, 0x65, 0x74, 0x72, 0x6f, 0xf0, 0x28, 0x87, 0x62, 0x6e, 0x6f, 0x69,
+    0x74, 0x61, 0x72, 0x67, 0xe9, 0x28, 0x8e, 0x54, 0xec, 0x28, 0x26, 0x04, 0xe5, 0x40, 0x0b, 0x02,
+    0x73, 0x61, 0x62, 0x61, 0x74, 0xe1, 0x28, 0xb2, 0x33, 0xe4, 0x28, 0x44, 0x47, 0x64, 0x6c, 0x69,
+    0xf5, 0x28, 0x4a, 0x54, 0xe2, 0x28, 0xa2, 0x54, 0xf4, 0x49, 0x04, 0x00, 0xe0, 0x62, 0xae, 0xe8,
+    0x09, 0x2d, 0x00, 0xdb, 0x62, 0x29, 0x00, 0x1e, 0x00, 0x3d, 0x58, 0x18, 0x00, 0xf1, 0x3b, 0x12,
+    0x00, 0x99, 0x62, 0xf4, 0x48, 0x4c, 0x60, 0xad, 0x62, 0xef, 0x48, 0xe5, 0x60, 0xa4, 0x54, 0xed,
+    0x48, 0x04, 0x00, 0x0c, 0x36, 0x6f, 0xe3, 0x29, 0xce, 0x46, 0xec, 0x28, 0x2d, 0x4e, 0xe4, 0x48,
+    0xd3, 0x60, 0x04, 0x00, 0x75, 0x6f, 0x6c, 0x63, 0x65, 0x67, 0xee, 0x28, 0x7b, 0x4b, 0xf3, 0x21,
+    0x01, 0xae, 0xc8, 0x99, 0x62, 0x89, 0x62, 0x18, 0x00, 0x12, 0x00, 0x5f, 0x62, 0x0c, 0x00, 0xf6,
+    0x48, 0x72, 0x35, 0x37, 0x38, 0xf4, 0x48, 0x57, 0x62, 0x90, 0x5a, 0xef, 0x28, 0x62, 0x54, 0xf2,
+    0x40, 0x0b, 0x02, 0x6f, 0xf0, 0x21, 0x01, 0x2e, 0xe5, 0x28, 0xbf, 0x13, 0xe5, 0x48, 0x64, 0x62,
+    0x04, 0x00, 0xf9, 0x28, 0xa8, 0x61, 0xf0, 0x49, 0x04, 0x00, 0xed, 0x5d, 0xae, 0xa8, 0x5e, 0x62,
+    0x51, 0x62, 0x1e, 0x60, 0x24, 0x62, 0x1c, 0x62, 0xef, 0xe8, 0x0a, 0x5c, 0x30, 0x3b, 0x00, 0x8a,
+    0x5c, 0x3e, 0x0f, 0x37, 0x00, 0x3e, 0x1a, 0x31, 0x00, 0x21, 0x00, 0x1b, 0x00, 0x14, 0x00, 0xfa,
+    0x20, 0x01, 0xe1, 0x28, 0x5b, 0x61, 0xf4, 0x48, 0x0f, 0x30, 0xc7, 0x39, 0xf3, 0x68, 0x03, 0x44,
+    0x50, 0x04, 0x06, 0x00, 0x73, 0xe3, 0x20, 0x01, 0xe9, 0x28, 0x3b, 0x36, 0xf0, 0x48, 0xaf, 0x61,
+    0x80, 0x3d, 0xed, 0x28, 0x12, 0x4c, 0xe9, 0x80, 0x41, 0x37, 0x2d, 0x04, 0xf4, 0x40, 0x18, 0x02,
+    0xe3, 0x40, 0x0d, 0x02, 0xf5, 0x48, 0x17, 0x62, 0x04, 0x00, 0x72, 0xf4, 0x28, 0xef, 0x40, 0xe5,
+    0x20, 0x01, 0xf4, 0x28, 0xd8, 0x44, 0xe1, 0x68, 0x06, 0x00, 0xf8, 0x0a, 0x10, 0x24, 0x63, 0x75,
+    0x64, 0xe5, 0x29, 0x40, 0x50, 0x73, 0x69, 0xf6, 0x21, 0x01, 0x6f, 0xf2, 0x28, 0xc3, 0x51, 0xee,
+    0x48, 0xe1, 0x61, 0x04, 0x00, 0xf5, 0x28, 0x4d, 0x54, 0xe8, 0x28, 0x7e, 0x45, 0xed, 0x21, 0x01,
+    0xae, 0x88, 0x08, 0x00, 0xca, 0x61, 0x90, 0x61, 0x88, 0x61, 0xe3, 0x28, 0x0b, 0x56, 0xeb, 0x21,
+    0x01, 0xae, 0x88, 0xb9, 0x61, 0x79, 0x5f, 0x7f, 0x61, 0x77, 0x61, 0xe9, 0xe9, 0x09, 0x1b, 0x00,
+    0x12, 0x00, 0x7e, 0x13, 0xc0, 0x47, 0xfa, 0x0a, 0x38, 0x61, 0xf2, 0x5f, 0x02, 0x5f, 0xb3, 0x62,
+    0x65, 0x6c, 0x6b, 0x6e, 0x69, 0xf6, 0x28, 0x5e, 0x13, 0xae, 0xe8, 0x14, 0x1d, 0x5f, 0xe0, 0x5a,
+    0x31, 0x34, 0x65, 0x31, 0x9a, 0x00, 0x90, 0x00, 0x86, 0x00, 0x69, 0x53, 0x80, 0x00, 0x78, 0x00,
+    0x72, 0x00, 0x68, 0x00, 0x62, 0x00, 0x55, 0x00, 0x42, 0x00, 0x28, 0x00, 0x56, 0x61, 0x77, 0x59,
+    0xc7, 0x60, 0x73, 0x59, 0xf4, 0xa8, 0x0f, 0x00, 0x0a, 0x00, 0x8d, 0x5f, 0x38, 0x61, 0x96, 0x1d,
+    0x65, 0xee, 0x29, 0xd0, 0x4c, 0x61, 0x72, 0xe1, 0x20, 0x01, 0xea, 0x28, 0xd3, 0x4b, 0xf3, 0xa8,
+    0x42, 0x61, 0x31, 0x5f, 0xb4, 0x5f, 0x0a, 0x00, 0xa2, 0x5e, 0x73, 0x65, 0x6e, 0xe9, 0x28, 0x78,
+    0x04, 0xf2, 0x68, 0x06, 0x00, 0x97, 0x5e, 0x05, 0x61, 0x61, 0xe8, 0x28, 0xf4, 0x5a, 0xf0, 0x48,
+    0xbf, 0x2e, 0x82, 0x5e, 0xef, 0x88, 0x1c, 0x61, 0x4a, 0x5f, 0xe1, 0x5f, 0x46, 0x60, 0xee, 0x48,
+    0x12, 0x61, 0xea, 0x5f, 0xed, 0x68, 0x27, 0x61, 0x09, 0x61, 0x25, 0x4c, 0xec, 0x48, 0x1a, 0x4f,
+    0x09, 0x61, 0xe9, 0x48, 0x19, 0x61, 0x04, 0x00, 0xe8, 0x28, 0xf4, 0x5c, 0xe7, 0x88, 0x93, 0x41,
+    0x91, 0x41, 0x88, 0x60, 0x01, 0x61, 0xe5, 0x48, 0xf2, 0x60, 0x04, 0x00, 0xf3, 0x20, 0x01, 0x61,
+    0x62, 0xe1, 0x20, 0x01, 0xf0, 0x28, 0xc9, 0x5a, 0xe8, 0x21, 0x01, 0xae, 0xe8, 0x07, 0xe6, 0x5d,
+    0x67, 0x5e, 0xde, 0x60, 0xd6, 0x60, 0xce, 0x60, 0x9e, 0x5e, 0xa4, 0x60, 0xe7, 0x41, 0x17, 0x02,
+    0x69, 0xf3, 0x40, 0x06, 0x02, 0xe9, 0x28, 0x67, 0x3f, 0x65, 0xe4, 0x21, 0x01, 0x2e, 0xf3, 0x20,
+    0x01, 0xf3, 0x28, 0x9d, 0x60, 0xae, 0xc8, 0x83, 0x5e, 0xb5, 0x60, 0xa5, 0x60, 0x75, 0x5e, 0x7b,
+    0x60, 0x73, 0x60, 0xe5, 0xe8, 0x0b, 0x47, 0x00, 0x43, 0x00, 0x3c, 0x00, 0x35, 0x00, 0x2d, 0x00,
+    0x1f, 0x00, 0xa4, 0x60, 0x77, 0x44, 0x1b, 0x00, 0x16, 0x00, 0x5f, 0x5b, 0x73, 0xe9, 0x28, 0x72,
+    0x5e, 0xf2, 0x29, 0x2d, 0x0a, 0xe9, 0x48, 0x04, 0x00, 0xd9, 0x5d, 0x6c, 0x69, 0x62, 0x6f, 0xed,
+    0x28, 0x33, 0x58, 0x68, 0xe3, 0x20, 0x01, 0xf4, 0x28, 0xf9, 0x5b, 0x67, 0x61, 0x77, 0xf3, 0x28,
+    0xcb, 0x0f, 0xe6, 0x20, 0x01, 0xf5, 0x28, 0x56, 0x40, 0xe5, 0x28, 0x7c, 0x59, 0x64, 0xf2, 0x28,
+    0x3e, 0x56, 0xe4, 0x40, 0x06, 0x02, 0xeb, 0x28, 0x65, 0x60, 0xe7, 0x21, 0x01, 0x2e, 0x79, 0xf0,
+    0x20, 0xb4, 0xe3, 0x49, 0x04, 0x00, 0x2c, 0x60, 0xae, 0xe8, 0x16, 0x6f, 0x39, 0xf9, 0x00, 0x68,
+    0x49, 0xe7, 0x00, 0x3f, 0x46, 0xe1, 0x00, 0xd9, 0x00, 0xd3, 0x00, 0xc7, 0x00, 0xc3, 0x00, 0xbb,
+    0x00, 0x73, 0x00, 0x69, 0x00, 0x22, 0x5f, 0x65, 0x00, 0x57, 0x00, 0x3c, 0x00, 0x07, 0x60, 0xff,
+    0x5f, 0x49, 0x56, 0x32, 0x00, 0x2c, 0x00, 0xfa, 0x48, 0xd7, 0x5f, 0x18, 0x61, 0xf8, 0x88, 0xd1,
+    0x5f, 0x95, 0x59, 0xf6, 0x5f, 0x8f, 0x5f, 0xf4, 0x48, 0x04, 0x00, 0xe9, 0x5f, 0x63, 0x65, 0x6e,
+    0x6e, 0x6f, 0x63, 0x6b, 0x63, 0x69, 0x75, 0x71, 0xae, 0x20, 0x01, 0x74, 0x63, 0x65, 0xf2, 0x28,
+    0x32, 0x51, 0xf3, 0x68, 0xac, 0x5f, 0x70, 0x59, 0x06, 0x00, 0x70, 0x70, 0xe1, 0x28, 0xc6, 0x17,
+    0xf1, 0x28, 0xd0, 0x5f, 0xee, 0x88, 0xc2, 0x5e, 0xb1, 0x5e, 0x58, 0x5f, 0x56, 0x5f, 0xed, 0x48,
+    0xb5, 0x5f, 0x04, 0x00, 0x6f, 0xe3, 0x21, 0x01, 0x2e, 0x73, 0x77, 0x61, 0x6e, 0x6f, 0x7a, 0x61,
+    0x6d, 0x61, 0xae, 0x68, 0x25, 0x00, 0x06, 0x00, 0x04, 0x44, 0xe2, 0x48, 0x04, 0x00, 0x82, 0x15,
+    0x65, 0x2e, 0x31, 0xad, 0x40, 0x08, 0x02, 0x74, 0x73, 0x65, 0xf7, 0x20, 0x01, 0x68, 0x74, 0x72,
+    0x6f, 0x6e, 0xad, 0x20, 0x01, 0xee, 0x28, 0x8b, 0x5f, 0x31, 0x2d, 0x68, 0x74, 0x72, 0x6f, 0x6e,
+    0x2d, 0x6e, 0xe3, 0x28, 0x02, 0x3b, 0xec, 0x68, 0x70, 0x5e, 0x7f, 0x5f, 0x0c, 0x59, 0xeb, 0x28,
+    0x68, 0x5e, 0xea, 0xa8, 0x5c, 0x5f, 0x08, 0x5e, 0x87, 0x5f, 0x7d, 0x60, 0xed, 0x5b, 0xe9, 0x48,
+    0x9c, 0x35, 0x58, 0x5e, 0xe8, 0x68, 0x77, 0x5f, 0xf7, 0x5e, 0xe8, 0x5e, 0xe7, 0x48, 0x6f, 0x40,
+    0x61, 0x5f, 0xe4, 0x88, 0x49, 0x53, 0x1c, 0x5f, 0xda, 0x5e, 0x08, 0x00, 0x75, 0x6f, 0x6c, 0x63,
+    0xf4, 0x28, 0x3d, 0x55, 0xe2, 0x28, 0x32, 0x5e, 0xe2, 0x49, 0x04, 0x00, 0x38, 0x5f, 0xae, 0xc8,
+    0x3c, 0x5f, 0x2c, 0x5f, 0x2f, 0x5f, 0xfc, 0x5c, 0x02, 0x5f, 0xfa, 0x5e, 0xe1, 0xe8, 0x0c, 0x55,
+    0x00, 0x4a, 0x00, 0xbd, 0x5d, 0x43, 0x00, 0x3b, 0x00, 0x32, 0x00, 0x2b, 0x5f, 0x68, 0x4b, 0x2e,
+    0x00, 0x21, 0x00, 0x1d, 0x00, 0x18, 0x00, 0x79, 0xe1, 0x28, 0xc2, 0x27, 0xf6, 0x28, 0x61, 0x16,
+    0xf5, 0x40, 0x06, 0x02, 0xf1, 0x28, 0x0d, 0x52, 0x68, 0xe9, 0x28, 0x06, 0x60, 0xf3, 0x28, 0x0b,
+    0x58, 0x69, 0x64, 0xf2, 0x20, 0x01, 0xe1, 0x28, 0x77, 0x49, 0x68, 0xeb, 0x20, 0x01, 0xe1, 0x28,
+    0x38, 0x58, 0x67, 0x72, 0x6f, 0xed, 0x28, 0xb5, 0x51, 0x63, 0x69, 0x6c, 0x62, 0xf5, 0x20, 0x01,
+    0xf0, 0x28, 0xbf, 0x5c, 0xe2, 0x28, 0x97, 0x09, 0x33, 0x31, 0x35, 0x72, 0xed, 0x28, 0x24, 0x4e,
+    0xed, 0xe8, 0x16, 0xfd, 0x23, 0xd0, 0x3f, 0xf5, 0x23, 0x84, 0x23, 0x7e, 0x23, 0x71, 0x23, 0x6d,
+    0x23, 0x56, 0x23, 0x48, 0x23, 0xb5, 0x5d, 0x13, 0x23, 0x11, 0x23, 0xb2, 0x22, 0xa5, 0x22, 0x51,
+    0x50, 0xa9, 0x11, 0xa0, 0x11, 0x93, 0x11, 0x4b, 0x5e, 0x7f, 0x11, 0x46, 0x00, 0x2c, 0x00, 0xfa,
+    0x21, 0x01, 0xae, 0xe8, 0x0a, 0x65, 0x5c, 0x97, 0x5e, 0x08, 0x5c, 0x8f, 0x5e, 0x87, 0x5e, 0x84,
+    0x56, 0x57, 0x5c, 0x5d, 0x5e, 0x55, 0x5e, 0x7a, 0x56, 0xf5, 0x48, 0x04, 0x00, 0xd3, 0x51, 0x65,
+    0x73, 0x75, 0xed, 0x21, 0x01, 0xae, 0xe8, 0x17, 0x4a, 0x0f, 0xdd, 0x0e, 0x3d, 0x0e, 0xfc, 0x0b,
+    0xed, 0x0b, 0x32, 0x0b, 0xd6, 0x0a, 0x9d, 0x0a, 0x1e, 0x0a, 0x40, 0x09, 0xc8, 0x08, 0x41, 0x06,
+    0xa6, 0x05, 0x9f, 0x05, 0x9a, 0x05, 0xfe, 0x04, 0x0f, 0x03, 0x1d, 0x02, 0xfb, 0x01, 0xe9, 0x01,
+    0xcd, 0x01, 0x51, 0x00, 0x2e, 0x00, 0xfa, 0xa8, 0x88, 0x26, 0x19, 0x00, 0xdd, 0x4f, 0x10, 0x00,
+    0x0a, 0x00, 0x75, 0x72, 0xe3, 0x28, 0x58, 0x0f, 0x6f, 0xea, 0x20, 0x01, 0x61, 0xe4, 0x28, 0x6d,
+    0x5d, 0x69, 0xe5, 0x20, 0x01, 0xf7, 0x28, 0x96, 0x5b, 0xf9, 0xe8, 0x0d, 0x5f, 0x01, 0x34, 0x22,
+    0xfa, 0x47, 0x14, 0x01, 0xe2, 0x00, 0xd9, 0x00, 0xce, 0x00, 0xbc, 0x00, 0xb6, 0x00, 0x78, 0x49,
+    0x46, 0x00, 0x3b, 0x00, 0x1a, 0x00, 0xf4, 0x60, 0x13, 0x07, 0x03, 0xee, 0x28, 0x61, 0x39, 0xe9,
+    0x48, 0x4b, 0x4a, 0x04, 0x00, 0x73, 0x72, 0xe5, 0x28, 0xd7, 0x30, 0x65, 0x69, 0x63, 0x6f, 0xf3,
+    0x21, 0x01, 0x6c, 0xe1, 0x28, 0xce, 0x03, 0x73, 0x70, 0x65, 0x6c, 0xe9, 0x20, 0x01, 0xf0, 0x28,
+    0xa8, 0x5d, 0xf2, 0xc0, 0x63, 0x49, 0x44, 0x3c, 0x0e, 0x06, 0x74, 0x73, 0x75, 0x64, 0x6e, 0xe9,
+    0x20, 0x29, 0x6f, 0x74, 0x73, 0x69, 0xe8, 0xc9, 0x22, 0x00, 0x33, 0x06, 0x19, 0x00, 0x12, 0x00,
+    0x0c, 0x00, 0xff, 0x4e, 0x72, 0x65, 0xf4, 0x28, 0x81, 0x04, 0x6c, 0xe1, 0x48, 0xe4, 0x45, 0xa3,
+    0x42, 0x67, 0x6e, 0x69, 0x76, 0x69, 0xec, 0x29, 0xdf, 0x4e, 0x64, 0x6e, 0xe1, 0x28, 0x0d, 0x06,
+    0x6e, 0x6f, 0x73, 0x61, 0xed, 0x28, 0x96, 0x39, 0x6c, 0xe5, 0x28, 0x1f, 0x0a, 0xe5, 0x60, 0x0e,
+    0x07, 0x03, 0xf6, 0x28, 0x68, 0x22, 0x6c, 0x6c, 0x61, 0xe7, 0x29, 0x93, 0x40, 0x64, 0x69, 0x6f,
+    0xf2, 0x20, 0x01, 0xe2, 0x28, 0xa2, 0x2f, 0xe1, 0x48, 0x94, 0x01, 0x04, 0x00, 0x74, 0xe9, 0x28,
+    0x64, 0x5d, 0xee, 0x48, 0xf6, 0x08, 0xb3, 0x51, 0xed, 0x40, 0x0a, 0x02, 0x6f, 0x6e, 0x6f, 0x72,
+    0xf4, 0x28, 0x37, 0x5c, 0x65, 0x64, 0xe1, 0x28, 0x22, 0x5b, 0xec, 0x48, 0x04, 0x00, 0xbe, 0x38,
+    0x65, 0xf4, 0x28, 0x82, 0x0f, 0x68, 0x70, 0x61, 0x72, 0x67, 0x6f, 0xf4, 0x20, 0xab, 0x67, 0x6f,
+    0x6c, 0xef, 0xc8, 0x27, 0x00, 0x22, 0x00, 0x17, 0x00, 0xd4, 0x08, 0x0c, 0x00, 0x9d, 0x41, 0x70,
+    0xef, 0x48, 0x04, 0x00, 0x39, 0x5d, 0xf2, 0x28, 0x74, 0x04, 0x6e, 0xe8, 0x48, 0x99, 0x46, 0x04,
+    0x00, 0xf4, 0x28, 0xe5, 0x5c, 0x6d, 0xef, 0x28, 0x23, 0x34, 0xe5, 0x48, 0xb6, 0x08, 0xd4, 0x5c,
+    0xe5, 0xa0, 0x42, 0x23, 0x19, 0x15, 0x05, 0xf3, 0x40, 0x08, 0x02, 0x72, 0x65, 0xea, 0x28, 0x64,
+    0x0b, 0x6e, 0x72, 0xe5, 0x28, 0x7a, 0x47, 0xf2, 0x28, 0x88, 0x3e, 0xee, 0x48, 0x04, 0x00, 0xd0,
+    0x5b, 0xe4, 0x28, 0x6d, 0x49, 0xec, 0x40, 0x18, 0x02, 0xec, 0x40, 0x06, 0x02, 0xef, 0x28, 0xd2,
+    0x4c, 0x61, 0xf6, 0x21, 0x01, 0x65, 0x6e, 0x69, 0x77, 0x79, 0x64, 0xee, 0x28, 0x36, 0x45, 0x65,
+    0xeb, 0x28, 0x19, 0x06, 0xe8, 0x20, 0x01, 0xf3, 0x28, 0xa9, 0x4f, 0xe1, 0x40, 0x0d, 0x02, 0xf7,
+    0x48, 0x04, 0x00, 0x0b, 0x0d, 0x65, 0xf4, 0x28, 0x96, 0x52, 0x62, 0x65, 0x6b, 0x61, 0x65, 0x70,
+    0x61, 0xf3, 0x28, 0xe9, 0x57, 0xf8, 0x88, 0x15, 0x00, 0x0c, 0x00, 0xbf, 0x05, 0x08, 0x00, 0xf4,
+    0x28, 0xee, 0x58, 0x69, 0x6e, 0xe5, 0x20, 0x01, 0xef, 0x28, 0x09, 0x43, 0x65, 0xf3, 0x28, 0x62,
+    0x4d, 0xf7, 0x40, 0x06, 0x02, 0xf2, 0x28, 0x6e, 0x5c, 0xef, 0x20, 0x01, 0xe3, 0x20, 0x01, 0xf3,
+    0x28, 0x5c, 0x5b, 0xf5, 0x40, 0x09, 0x02, 0xf2, 0x20, 0x01, 0xed, 0x28, 0x28, 0x40, 0xe1, 0x40,
+    0x0e, 0x02, 0x65, 0x74, 0x61, 0x6c, 0x70, 0x6f, 0x64, 0x61, 0xf2, 0x28, 0x32, 0x43, 0xe2, 0x20,
+    0x01, 0xe7, 0x28, 0xa8, 0x05, 0xf4, 0xe0, 0x09, 0xe7, 0xe1, 0xdd, 0xd0, 0xc7, 0xab, 0xa6, 0x49,
+    0x09, 0xf3, 0xc8, 0x2a, 0x00, 0x25, 0x00, 0x1e, 0x00, 0x86, 0x09, 0x0c, 0x00, 0x92, 0x0b, 0xf2,
+    0x40, 0x08, 0x02, 0x75, 0x68, 0xec, 0x28, 0x4a, 0x0c, 0x6f, 0x68, 0x6e, 0x65, 0xed, 0x28, 0x1f,
+    0x58, 0x69, 0x6c, 0x61, 0xf9, 0x28, 0x61, 0x48, 0x65, 0xf7, 0x28, 0x5c, 0x0d, 0xe1, 0x40, 0x07,
+    0x02, 0x6f, 0xe3, 0x28, 0x92, 0x0e, 0xe3, 0x20, 0x01, 0x64, 0xe1, 0x20, 0x01, 0xef, 0x28, 0x77,
+    0x44, 0xf2, 0x60, 0x12, 0x09, 0x03, 0x75, 0x66, 0xeb, 0x28, 0x23, 0x0a, 0x6f, 0xf0, 0x68, 0x9c,
+    0x33, 0xe4, 0x45, 0x64, 0x0a, 0xe1, 0xe9, 0x08, 0x42, 0x00, 0x3e, 0x00, 0x38, 0x00, 0x32, 0x00,
+    0xa1, 0x45, 0x26, 0x00, 0x20, 0x00, 0x10, 0x00, 0x79, 0x72, 0xe1, 0x20, 0x01, 0x72, 0x6f, 0x70,
+    0x6d, 0xe5, 0x20, 0x01, 0xf4, 0x28, 0xf6, 0x40, 0x74, 0x61, 0xed, 0x28, 0xad, 0x5a, 0xee, 0x48,
+    0xa4, 0x01, 0x04, 0x00, 0x6f, 0x6f, 0xf4, 0x28, 0x1a, 0x13, 0x68, 0x73, 0xe9, 0x28, 0x4c, 0x08,
+    0x67, 0x74, 0xf4, 0x28, 0x5c, 0x39, 0xe5, 0x28, 0x16, 0x51, 0xe4, 0x28, 0x75, 0x0b, 0x6f, 0xf0,
+    0x28, 0xa0, 0x57, 0x6e, 0xe5, 0x40, 0x06, 0x02, 0xf6, 0x28, 0xc2, 0x40, 0xed, 0x68, 0x0e, 0x00,
+    0x46, 0x04, 0x06, 0x00, 0x70, 0x69, 0x75, 0x71, 0xe5, 0x28, 0xee, 0x0b, 0xe5, 0x20, 0xb4, 0x69,
+    0x6f, 0xf2, 0x20, 0x01, 0xf4, 0x28, 0x7b, 0x57, 0xe5, 0x48, 0x5a, 0x1f, 0x04, 0x00, 0x6b, 0x72,
+    0x61, 0xed, 0x28, 0x18, 0x01, 0xe4, 0x28, 0x67, 0x5a, 0x63, 0x65, 0xea, 0x28, 0x4f, 0x3e, 0x61,
+    0x67, 0x69, 0x6c, 0xec, 0x28, 0xc2, 0x06, 0xf3, 0xe8, 0x0d, 0xda, 0x01, 0xc9, 0x01, 0x19, 0x01,
+    0x0d, 0x01, 0x06, 0x01, 0xe2, 0x00, 0xd3, 0x00, 0xc9, 0x00, 0x95, 0x00, 0x74, 0x00, 0x6a, 0x00,
+    0x2a, 0x00, 0x1a, 0x00, 0xf5, 0x40, 0x06, 0x02, 0xe3, 0x28, 0x19, 0x44, 0xe2, 0x21, 0x01, 0x6d,
+    0xf5, 0x28, 0xc1, 0x44, 0xf4, 0x88, 0x32, 0x00, 0xb4, 0x05, 0x2d, 0x00, 0x08, 0x00, 0x72, 0xe1,
+    0x69, 0x10, 0x00, 0x66, 0x4c, 0x06, 0x00, 0xf8, 0x20, 0x01, 0xf5, 0x20, 0x01, 0xe1, 0x28, 0xf2,
+    0x23, 0xe5, 0x48, 0x7b, 0x50, 0x04, 0x00, 0x76, 0x69, 0x74, 0x61, 0x72, 0x6f, 0x63, 0x65, 0xe4,
+    0x29, 0x46, 0x4c, 0x6f, 0xec, 0x28, 0xeb, 0x53, 0x66, 0x61, 0x72, 0xe3, 0x21, 0x01, 0x64, 0x6e,
+    0xe1, 0x28, 0x09, 0x3e, 0xf3, 0x48, 0x04, 0x00, 0xc0, 0x58, 0xe1, 0x28, 0xf7, 0x42, 0x72, 0xe5,
+    0xa8, 0x19, 0x00, 0x11, 0x00, 0x47, 0x0b, 0x05, 0x3f, 0x0a, 0x00, 0x74, 0x6e, 0x65, 0xe3, 0x28,
+    0x4b, 0x03, 0x6c, 0xf4, 0x20, 0x01, 0xf4, 0x28, 0x93, 0x55, 0x64, 0xee, 0x28, 0x0e, 0x4e, 0xee,
+    0x68, 0x28, 0x00, 0xbd, 0x04, 0x06, 0x00, 0x6f, 0xe9, 0x40, 0x1b, 0x02, 0x74, 0x61, 0x63, 0x69,
+    0x6e, 0x75, 0x6d, 0x6d, 0x6f, 0xe3, 0x21, 0x01, 0x65, 0x6c, 0x65, 0x74, 0x2d, 0x64, 0x6e, 0x61,
+    0x2d, 0xf3, 0x28, 0xd6, 0x16, 0xf3, 0x28, 0xbf, 0x03, 0xe1, 0x48, 0x04, 0x00, 0x7c, 0x59, 0xe2,
+    0x28, 0x1c, 0x26, 0x6d, 0x72, 0x61, 0x65, 0x72, 0x69, 0xe6, 0x28, 0xb5, 0x09, 0xec, 0x40, 0x06,
+    0x02, 0xec, 0x28, 0x9b, 0x55, 0xe5, 0x20, 0x01, 0xf3, 0x28, 0xba, 0x05, 0xe9, 0x88, 0x17, 0x00,
+    0x8f, 0x3f, 0x0c, 0x00, 0x08, 0x00, 0xf8, 0x28, 0x85, 0x5a, 0x75, 0x6f, 0x6c, 0x74, 0xee, 0x20,
+    0x01, 0xe9, 0x28, 0xbc, 0x56, 0x6c, 0x6f, 0x70, 0xe1, 0x20, 0x01, 0x6e, 0xe1, 0x28, 0xab, 0x0b,
+    0xe8, 0x20, 0x01, 0xf4, 0x28, 0x97, 0x59, 0x67, 0x6e, 0x69, 0x72, 0x70, 0xf3, 0x20, 0x01, 0xed,
+    0x28, 0xe3, 0x01, 0xe5, 0xe0, 0x08, 0xa4, 0xa0, 0x77, 0x6b, 0x42, 0x31, 0x27, 0x08, 0xf5, 0x48,
+    0x22, 0x5a, 0x04, 0x00, 0xf1, 0x40, 0x12, 0x02, 0x69, 0x74, 0x6e, 0xe1, 0x49, 0x04, 0x00, 0x6a,
+    0x4b, 0xee, 0x20, 0x01, 0xe1, 0x28, 0x77, 0x0b, 0x61, 0xe4, 0x28, 0xae, 0x57, 0x73, 0x75, 0x6f,
+    0xe8, 0x20, 0x01, 0xe3, 0x28, 0xc5, 0x06, 0xf2, 0x48, 0x04, 0x00, 0xe1, 0x08, 0xe5, 0x48, 0x11,
+    0x57, 0x04, 0x00, 0x75, 0xe7, 0x28, 0x6b, 0x4f, 0xec, 0x68, 0x5a, 0x39, 0x20, 0x00, 0x06, 0x00,
+    0xec, 0x40, 0x07, 0x02, 0x69, 0xe1, 0x28, 0x94, 0x38, 0xe5, 0x40, 0x06, 0x02, 0xf8, 0x28, 0x2b,
+    0x05, 0x72, 0x75, 0x74, 0x61, 0x6e, 0xf3, 0x28, 0x53, 0x02, 0x65, 0x67, 0x6e, 0xe1, 0x28, 0xac,
+    0x15, 0x69, 0x74, 0x69, 0x6e, 0x61, 0xed, 0x20, 0x01, 0xf5, 0x28, 0xbd, 0x58, 0x68, 0x63, 0x73,
+    0xe9, 0x60, 0x1d, 0x09, 0x03, 0x73, 0x65, 0xec, 0x28, 0x34, 0x57, 0x72, 0x6f, 0x74, 0x73, 0x69,
+    0xe8, 0x49, 0x04, 0x00, 0xae, 0x3e, 0x6e, 0x69, 0xfa, 0x20, 0x01, 0xe9, 0x28, 0xe1, 0x55, 0xe4,
+    0x20, 0x01, 0xe5, 0x28, 0x32, 0x0c, 0xe4, 0x28, 0x39, 0x58, 0x63, 0x6e, 0x65, 0x69, 0x63, 0xf3,
+    0x29, 0x2a, 0x04, 0x64, 0xe9, 0x48, 0x1f, 0x55, 0x04, 0x00, 0x70, 0x61, 0x72, 0xe4, 0x20, 0x01,
+    0xee, 0x28, 0xce, 0x21, 0xe1, 0x48, 0x04, 0x00, 0x5f, 0x08, 0xec, 0x48, 0x44, 0x59, 0x04, 0x00,
+    0xec, 0x48, 0x7e, 0x55, 0x78, 0x3f, 0xf2, 0xc8, 0x8f, 0x00, 0x10, 0x45, 0x2d, 0x00, 0x28, 0x00,
+    0x21, 0x00, 0x0c, 0x00, 0xf5, 0x60, 0x0c, 0x13, 0x03, 0x74, 0x61, 0xeb, 0x20, 0x01, 0xe9, 0x28,
+    0x71, 0x1f, 0x61, 0x73, 0x6f, 0xee, 0x28, 0x9b, 0x4a, 0xef, 0x20, 0x01, 0xe2, 0x28, 0xe6, 0x57,
+    0x69, 0xe1, 0x29, 0x14, 0x3d, 0xe5, 0xc0, 0x5a, 0x53, 0x49, 0x40, 0x39, 0x06, 0xf4, 0xa8, 0xe8,
+    0x3e, 0x2d, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0xf5, 0x28, 0x1e, 0x3f, 0xf3, 0x48, 0x04,
+    0x00, 0xfa, 0x02, 0x65, 0x68, 0xe3, 0x48, 0x3f, 0x02, 0x9e, 0x53, 0x6e, 0x65, 0xe3, 0x89, 0x8c,
+    0x01, 0x08, 0x00, 0x8e, 0x06, 0x2f, 0x3c, 0x6c, 0xe1, 0x28, 0x71, 0x04, 0xe5, 0x28, 0xa0, 0x4c,
+    0x70, 0x61, 0x70, 0xf3, 0x28, 0x6e, 0x07, 0x6e, 0x61, 0x6b, 0x73, 0x69, 0xfa, 0x28, 0x1f, 0x07,
+    0x6c, 0x6c, 0x69, 0x6d, 0x73, 0x69, 0xf7, 0x28, 0x89, 0x4d, 0xe9, 0x20, 0x01, 0xf2, 0x28, 0x43,
+    0x10, 0xe2, 0x48, 0x0c, 0x58, 0xa1, 0x3c, 0x61, 0xf7, 0x49, 0x04, 0x00, 0x9e, 0x01, 0xe4, 0x28,
+    0x63, 0x42, 0x71, 0xe1, 0x28, 0x80, 0x55, 0x70, 0x6f, 0x68, 0xf3, 0x28, 0x32, 0x18, 0xef, 0xe0,
+    0x0a, 0x88, 0x82, 0x67, 0x60, 0x4d, 0x38, 0x30, 0x2a, 0x20, 0x0a, 0xf2, 0x40, 0x0f, 0x02, 0x69,
+    0x65, 0x6e, 0x61, 0x6a, 0x65, 0xe4, 0x20, 0x01, 0xef, 0x28, 0x14, 0x54, 0x68, 0xf4, 0x28, 0xb4,
+    0x4b, 0xee, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xf2, 0x28, 0x4a, 0x58, 0x6d, 0x69, 0xf4, 0x28, 0x4e,
+    0x07, 0x6c, 0x6c, 0x65, 0x63, 0xe9, 0x28, 0x11, 0x04, 0xe9, 0x60, 0x0d, 0x08, 0x03, 0x72, 0xe1,
+    0x28, 0x84, 0x17, 0x64, 0xe9, 0x28, 0x4d, 0x56, 0x63, 0x61, 0xe4, 0x28, 0xf4, 0x48, 0xe7, 0x40,
+    0x07, 0x02, 0x65, 0xe9, 0x28, 0xb2, 0x29, 0xe1, 0x48, 0x04, 0x00, 0xa9, 0x56, 0xe3, 0x28, 0x73,
+    0x2e, 0xe5, 0x20, 0x01, 0xec, 0x28, 0x66, 0x4d, 0xe3, 0x60, 0x14, 0x0d, 0x03, 0x73, 0x69, 0x63,
+    0x6e, 0x61, 0x72, 0xe6, 0x28, 0x4f, 0x2d, 0x69, 0x78, 0x65, 0xed, 0x28, 0xb7, 0x06, 0x65, 0xe4,
+    0x28, 0x5d, 0x3b, 0x61, 0x62, 0xec, 0x28, 0x09, 0x52, 0x32, 0x61, 0x36, 0x76, 0x2d, 0x73, 0x65,
+    0x61, 0x63, 0x69, 0x6e, 0x75, 0xed, 0x28, 0xe7, 0x0a, 0xee, 0xe8, 0x0b, 0x3f, 0x02, 0xaf, 0x01,
+    0x9b, 0x01, 0x83, 0x01, 0x76, 0x01, 0x69, 0x01, 0x5b, 0x01, 0x45, 0x00, 0x1f, 0x00, 0x16, 0x00,
+    0xa9, 0x17, 0x76, 0x61, 0x68, 0x6e, 0x65, 0xe2, 0x28, 0x55, 0x01, 0xf2, 0x40, 0x0c, 0x02, 0x6f,
+    0x62, 0x72, 0xe5, 0x20, 0x01, 0xe4, 0x28, 0x05, 0x4d, 0xe5, 0xa8, 0xe5, 0x57, 0x12, 0x00, 0xc5,
+    0x01, 0x0e, 0x00, 0x0a, 0x00, 0xfa, 0x28, 0x12, 0x53, 0xf5, 0x28, 0x31, 0x57, 0xe4, 0x28, 0xce,
+    0x56, 0xef, 0xc8, 0xf4, 0x25, 0x0e, 0x03, 0x3d, 0x00, 0x92, 0x54, 0x1d, 0x00, 0x0c, 0x00, 0xf4,
+    0x68, 0x06, 0x00, 0x22, 0x3b, 0x6e, 0x2f, 0x65, 0x72, 0xe2, 0x20, 0x01, 0xe5, 0x28, 0x41, 0x3e,
+    0xf3, 0x80, 0x17, 0x10, 0x09, 0x04, 0x73, 0xf2, 0x28, 0x5b, 0x56, 0x72, 0x65, 0x66, 0xe6, 0x28,
+    0x40, 0x4f, 0xe9, 0x20, 0x01, 0xed, 0x28, 0x3a, 0x51, 0xe4, 0x20, 0x01, 0xee, 0x28, 0xdc, 0x30,
+    0xe9, 0x40, 0xc0, 0x02, 0xf4, 0x60, 0x1e, 0x0a, 0x03, 0x69, 0x62, 0x69, 0xe8, 0x28, 0x30, 0x4b,
+    0xe3, 0x48, 0x1d, 0x41, 0x04, 0x00, 0x69, 0x66, 0xad, 0x20, 0x01, 0x65, 0xe3, 0x20, 0x01, 0x6e,
+    0xe5, 0x28, 0xb3, 0x37, 0xe1, 0xe8, 0x0b, 0x8f, 0x00, 0x89, 0x00, 0x04, 0x4a, 0x7f, 0x00, 0x74,
+    0x00, 0x6a, 0x00, 0x47, 0x00, 0x3b, 0x00, 0x35, 0x00, 0x19, 0x00, 0x16, 0x00, 0xfa, 0x20, 0x26,
+    0x76, 0x72, 0x65, 0xf3, 0x48, 0x31, 0x55, 0x04, 0x00, 0x6e, 0x6f, 0x63, 0x6c, 0x61, 0x74, 0x6e,
+    0x65, 0xed, 0x20, 0x01, 0x6e, 0x6f, 0x72, 0x69, 0xf6, 0x28, 0x66, 0x36, 0xf4, 0x48, 0xcc, 0x01,
+    0xd0, 0x56, 0xf3, 0x20, 0x01, 0xe9, 0x20, 0x01, 0x6c, 0x69, 0xf6, 0x28, 0x28, 0x4c, 0xf2, 0x60,
+    0x12, 0x0d, 0x03, 0x74, 0x73, 0x75, 0xec, 0x20, 0x01, 0xec, 0x28, 0xec, 0x55, 0x6f, 0xf0, 0x28,
+    0x3b, 0x56, 0x62, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x73, 0x65, 0xf6, 0x20, 0x01, 0xf2, 0x28, 0x4b,
+    0x30, 0x6e, 0x69, 0x73, 0xf3, 0x20, 0x01, 0xe1, 0x28, 0xcf, 0x4b, 0x6b, 0x69, 0x6e, 0x75, 0x6d,
+    0x6d, 0x6f, 0xeb, 0x28, 0x69, 0x34, 0xe9, 0x48, 0x04, 0x00, 0x07, 0x56, 0xe3, 0x28, 0xb7, 0x4b,
+    0x64, 0x6e, 0xf5, 0x28, 0x4d, 0x4a, 0xe3, 0x48, 0x41, 0x43, 0x04, 0x00, 0x75, 0x64, 0xe5, 0x29,
+    0xfe, 0x39, 0xf3, 0x40, 0x06, 0x02, 0xee, 0x28, 0xde, 0x49, 0x69, 0xf6, 0x48, 0x04, 0x00, 0x40,
+    0x34, 0x64, 0x6e, 0xe1, 0x28, 0x4e, 0x3e, 0xee, 0x48, 0x9d, 0x55, 0x04, 0x00, 0x75, 0x72, 0x62,
+    0x6e, 0xe5, 0x28, 0x37, 0x54, 0xec, 0x40, 0x07, 0x02, 0x6f, 0xe3, 0x28, 0x59, 0x48, 0xe5, 0x28,
+    0x0a, 0x3c, 0xe9, 0x48, 0x04, 0x00, 0x9c, 0x08, 0xec, 0x20, 0x01, 0xf2, 0x28, 0x84, 0x1f, 0xe8,
+    0x40, 0x09, 0x02, 0xef, 0x20, 0x01, 0xea, 0x28, 0x99, 0x55, 0x61, 0xe2, 0x21, 0x01, 0x6e, 0x65,
+    0xf3, 0x20, 0x01, 0xe9, 0x28, 0x63, 0x56, 0x67, 0x69, 0x73, 0x65, 0xe4, 0x21, 0x01, 0x64, 0xee,
+    0x40, 0x06, 0x02, 0xf5, 0x28, 0xc0, 0x03, 0xe1, 0x28, 0x95, 0x39, 0xe5, 0xe0, 0x07, 0x58, 0x50,
+    0x47, 0x3d, 0x2d, 0x0f, 0x07, 0x73, 0xf3, 0x20, 0x01, 0xe5, 0x28, 0xb7, 0x41, 0xf2, 0x60, 0x63,
+    0x11, 0x03, 0x68, 0xf5, 0x21, 0x01, 0x64, 0x6e, 0x75, 0x74, 0x61, 0x6d, 0xe9, 0x28, 0x5c, 0x3c,
+    0x65, 0x64, 0x6e, 0xe1, 0x20, 0x01, 0x61, 0xec, 0x28, 0x97, 0x54, 0x70, 0x70, 0x61, 0x68, 0x63,
+    0x73, 0x6e, 0x65, 0x74, 0x65, 0x77, 0x72, 0xf5, 0x28, 0x3a, 0x3b, 0x6c, 0x61, 0xe6, 0x20, 0x01,
+    0x74, 0xf3, 0x28, 0x8c, 0x4f, 0x68, 0xe3, 0x20, 0x01, 0x6e, 0xe5, 0x28, 0x1f, 0x4b, 0x67, 0x61,
+    0x68, 0x6e, 0xe5, 0x28, 0x50, 0x25, 0xe4, 0x68, 0x2a, 0x00, 0xf4, 0x31, 0x06, 0x00, 0x72, 0x61,
+    0xe7, 0x61, 0x1b, 0x17, 0x03, 0xf3, 0x48, 0x04, 0x00, 0x6b, 0x53, 0xee, 0x20, 0x01, 0x65, 0xf2,
+    0x20, 0x01, 0xe4, 0x20, 0x01, 0xec, 0x28, 0x0b, 0x2c, 0x6c, 0xe1, 0x20, 0x01, 0x63, 0xe9, 0x28,
+    0x87, 0x01, 0x61, 0xec, 0x20, 0x01, 0x6f, 0xeb, 0x28, 0x61, 0x53, 0xe1, 0xa0, 0x34, 0x2b, 0x1c,
+    0x12, 0x05, 0x77, 0x65, 0x68, 0x63, 0x74, 0x61, 0xeb, 0x20, 0x01, 0xf3, 0x28, 0x32, 0x52, 0x6d,
+    0x66, 0x6f, 0xe5, 0x20, 0x01, 0xec, 0x28, 0x21, 0x43, 0xe9, 0x48, 0xa6, 0x25, 0x04, 0x00, 0x74,
+    0x70, 0xf9, 0x20, 0x01, 0xe7, 0x28, 0x92, 0x55, 0x67, 0x69, 0xe8, 0x20, 0x01, 0xe3, 0x28, 0xb8,
+    0x55, 0xe3, 0x21, 0x01, 0x69, 0x72, 0x65, 0x6d, 0xe1, 0x21, 0x01, 0x65, 0xf6, 0x28, 0xd8, 0x04,
+    0xed, 0xe8, 0x07, 0x5e, 0x00, 0x26, 0x3e, 0x53, 0x00, 0x4b, 0x00, 0x08, 0x06, 0x3d, 0x00, 0x0e,
+    0x00, 0xf5, 0x60, 0x1b, 0x0b, 0x03, 0x74, 0x65, 0x72, 0x6f, 0xe2, 0x28, 0x9b, 0x4d, 0x69, 0x72,
+    0xe1, 0x48, 0x04, 0x00, 0x3d, 0x3e, 0x74, 0xe5, 0x20, 0x01, 0xee, 0x28, 0xa1, 0x17, 0x65, 0x73,
+    0x75, 0x6d, 0x79, 0x72, 0x6f, 0x74, 0x73, 0x69, 0xe8, 0x20, 0x01, 0x6c, 0xe1, 0x28, 0x62, 0x3a,
+    0x73, 0xe9, 0x20, 0x01, 0xec, 0x20, 0x01, 0x61, 0x6e, 0x72, 0xf5, 0x28, 0x25, 0x46, 0xec, 0x68,
+    0xc1, 0x4a, 0x3e, 0x19, 0xb2, 0x52, 0x65, 0x6c, 0x61, 0xf3, 0x21, 0x01, 0x75, 0xf2, 0x28, 0xd1,
+    0x4c, 0xe1, 0x68, 0x3e, 0x1a, 0x14, 0x01, 0x06, 0x00, 0xe8, 0x40, 0x06, 0x02, 0xf2, 0x28, 0x79,
+    0x30, 0x6e, 0x65, 0x74, 0xec, 0x28, 0x76, 0x50, 0xec, 0xa0, 0x74, 0x5c, 0x4a, 0x12, 0x05, 0xef,
+    0x68, 0x60, 0x51, 0x99, 0x52, 0x06, 0x00, 0x74, 0xf3, 0x28, 0x8b, 0x3b, 0xec, 0x60, 0x23, 0x13,
+    0x03, 0xe9, 0x48, 0xfd, 0x54, 0x04, 0x00, 0xed, 0x21, 0x01, 0xe4, 0x20, 0x01, 0xee, 0x28, 0xa5,
+    0x21, 0xe5, 0x48, 0xae, 0x53, 0x04, 0x00, 0x72, 0x64, 0xee, 0x20, 0x01, 0x65, 0xf6, 0x28, 0xef,
+    0x45, 0xe1, 0x40, 0x0d, 0x02, 0x68, 0x73, 0x6e, 0x6f, 0xe5, 0x20, 0x01, 0xe7, 0x28, 0x83, 0x36,
+    0xe2, 0x28, 0x68, 0x4a, 0xe9, 0x48, 0x04, 0x00, 0x4a, 0x3d, 0x61, 0x72, 0x74, 0x6e, 0xef, 0x20,
+    0x01, 0x67, 0xe5, 0x28, 0xdb, 0x54, 0xe5, 0x68, 0x0f, 0x00, 0x06, 0x00, 0xe2, 0x40, 0xf3, 0x48,
+    0x0c, 0x54, 0x04, 0x00, 0xf3, 0x20, 0x04, 0xee, 0x20, 0x01, 0xf5, 0x28, 0x2a, 0x3d, 0xe1, 0xe8,
+    0x09, 0x3b, 0x00, 0x33, 0x00, 0x2f, 0x00, 0x21, 0x00, 0xae, 0x54, 0x1a, 0x00, 0x16, 0x00, 0xc9,
+    0x40, 0x12, 0x00, 0xf6, 0x28, 0x2c, 0x52, 0xf4, 0x28, 0xc0, 0x04, 0x72, 0x75, 0x74, 0xec, 0x28,
+    0x8d, 0x52, 0x6e, 0x6f, 0x69, 0x74, 0xe1, 0x48, 0x04, 0x00, 0x7d, 0x54, 0xe3, 0x28, 0x54, 0x54,
+    0xe9, 0x28, 0xb8, 0x22, 0x65, 0xf2, 0x20, 0x01, 0xf4, 0x28, 0x5b, 0x2b, 0x63, 0xe9, 0x88, 0xaf,
+    0x50, 0x10, 0x00, 0x08, 0x00, 0x01, 0x04, 0xee, 0x20, 0x01, 0x61, 0xf4, 0x28, 0x39, 0x53, 0x67,
+    0x6f, 0x6c, 0xef, 0x60, 0x0b, 0x07, 0x03, 0xef, 0x28, 0xd8, 0x50, 0xed, 0x28, 0x2d, 0x53, 0xe5,
+    0x20, 0x01, 0xe1, 0x28, 0x78, 0x27, 0xeb, 0xe0, 0x07, 0x55, 0x51, 0x4a, 0x3f, 0x2f, 0x22, 0x07,
+    0xf2, 0x40, 0x07, 0x02, 0x6f, 0xf9, 0x29, 0xac, 0x02, 0x61, 0xed, 0x48, 0x27, 0x22, 0x04, 0x00,
+    0x72, 0xe5, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xe5, 0x28, 0x28, 0x53, 0x6f, 0x6f, 0x72, 0xe2, 0x20,
+    0x01, 0xee, 0x20, 0x01, 0xe1, 0x28, 0xfd, 0x4f, 0x6e, 0xe1, 0x48, 0x04, 0x00, 0x30, 0x54, 0x72,
+    0x66, 0xe5, 0x20, 0x01, 0xee, 0x28, 0x1d, 0x47, 0xec, 0x48, 0x35, 0x51, 0x04, 0x00, 0x6f, 0xe6,
+    0x28, 0xe6, 0x21, 0x69, 0x6e, 0x65, 0xe2, 0x28, 0x27, 0x51, 0xe6, 0x28, 0x88, 0x4d, 0xe3, 0x40,
+    0x1e, 0x02, 0x6f, 0x6c, 0xe3, 0x41, 0x07, 0x02, 0x64, 0x6e, 0xe1, 0x20, 0x08, 0x2d, 0x64, 0x6e,
+    0x61, 0xad, 0x20, 0x01, 0xe8, 0x20, 0x01, 0xe3, 0x20, 0x01, 0xf4, 0x28, 0x38, 0x33, 0x6e, 0x69,
+    0x76, 0xec, 0x28, 0x45, 0x07, 0xe9, 0xc0, 0x2e, 0x28, 0x22, 0x14, 0x0f, 0x06, 0x74, 0x61, 0x6e,
+    0x6e, 0x69, 0xe3, 0x28, 0x2e, 0x05, 0x73, 0xe9, 0x28, 0x7f, 0x48, 0x6c, 0x61, 0xe4, 0x21, 0x01,
+    0x72, 0xef, 0x20, 0x01, 0x64, 0x61, 0xf6, 0x20, 0xa1, 0xeb, 0x48, 0x3b, 0x28, 0x33, 0x53, 0x69,
+    0x61, 0xf7, 0x28, 0xd7, 0x2c, 0x64, 0x36, 0x67, 0x6c, 0x62, 0xe8, 0x28, 0x28, 0x54, 0xe8, 0xa0,
+    0x53, 0x3f, 0x2e, 0x23, 0x05, 0xf4, 0x68, 0x8d, 0x39, 0x11, 0x00, 0x06, 0x00, 0x75, 0xef, 0x48,
+    0x04, 0x00, 0x0c, 0x53, 0xed, 0x28, 0x5f, 0x2a, 0x72, 0xef, 0x48, 0x6a, 0x53, 0x04, 0x00, 0xf7,
+    0x28, 0xca, 0x46, 0x73, 0xe9, 0x48, 0x6f, 0x05, 0x04, 0x00, 0xf7, 0x28, 0xf4, 0x4a, 0xe7, 0x40,
+    0x0b, 0x02, 0x72, 0x75, 0x62, 0x73, 0x74, 0xf4, 0x28, 0x48, 0x4c, 0xe5, 0x28, 0x6d, 0x35, 0xe3,
+    0x68, 0x0d, 0x00, 0x06, 0x00, 0xb3, 0x26, 0xf3, 0x20, 0x01, 0xe9, 0x28, 0xd4, 0x02, 0x72, 0xe1,
+    0x28, 0xe7, 0x14, 0xe1, 0x20, 0x01, 0xf4, 0x28, 0x9a, 0x50, 0xe7, 0x68, 0x6d, 0x00, 0xcb, 0x30,
+    0x06, 0x00, 0xf2, 0x40, 0x5f, 0x02, 0xf5, 0x40, 0x10, 0x02, 0x6f, 0xe2, 0x40, 0x07, 0x02, 0x6d,
+    0xe5, 0x28, 0xe0, 0x35, 0xe9, 0x28, 0xb3, 0x51, 0xe2, 0xc8, 0x45, 0x00, 0x14, 0x44, 0x3b, 0x00,
+    0x21, 0x32, 0x13, 0x00, 0x0c, 0x00, 0xfa, 0x20, 0x01, 0xec, 0x28, 0x64, 0x4f, 0xf3, 0x60, 0x16,
+    0x0b, 0x03, 0x72, 0x65, 0x74, 0x65, 0xf0, 0x28, 0xf9, 0x51, 0x6e, 0x61, 0xe9, 0x20, 0x01, 0x74,
+    0x73, 0xe9, 0x28, 0xe0, 0x39, 0x6d, 0x61, 0x69, 0x6c, 0x6c, 0x69, 0xf7, 0x21, 0x01, 0x6c, 0x61,
+    0x69, 0xee, 0x28, 0xbb, 0x39, 0xed, 0x48, 0x13, 0x2c, 0x04, 0x00, 0xf5, 0x28, 0x64, 0x50, 0xe9,
+    0x28, 0xde, 0x2e, 0x65, 0x62, 0xee, 0x28, 0x71, 0x1d, 0xee, 0x40, 0x12, 0x02, 0x75, 0x6c, 0x6d,
+    0x6d, 0x61, 0xf3, 0x20, 0x01, 0x74, 0xf3, 0x20, 0x01, 0xee, 0x28, 0xe6, 0x43, 0xe9, 0xe8, 0x07,
+    0x31, 0x00, 0x24, 0x00, 0x20, 0x00, 0x1b, 0x00, 0xd6, 0x36, 0x12, 0x00, 0x0e, 0x00, 0xf6, 0x28,
+    0x33, 0x46, 0x70, 0x65, 0x65, 0x6b, 0x65, 0xed, 0x28, 0xaf, 0x52, 0x6c, 0xe1, 0x28, 0xf4, 0x42,
+    0xeb, 0x28, 0xa7, 0x4e, 0x67, 0x69, 0x6e, 0x65, 0x72, 0x65, 0xf6, 0x20, 0x01, 0xed, 0x28, 0x62,
+    0x16, 0xe4, 0x28, 0x8b, 0x10, 0xe6, 0x40, 0x09, 0x02, 0x6f, 0x68, 0x67, 0xf2, 0x28, 0x64, 0x45,
+    0xe9, 0x28, 0x04, 0x05, 0xe5, 0xe8, 0x0f, 0xd8, 0x01, 0xc2, 0x01, 0xb4, 0x01, 0xa8, 0x01, 0x7f,
+    0x01, 0x71, 0x01, 0x67, 0x01, 0x35, 0x01, 0x15, 0x01, 0xfd, 0x00, 0xa0, 0x00, 0x7b, 0x00, 0x45,
+    0x00, 0x31, 0x00, 0x1e, 0x00, 0x76, 0x69, 0xf4, 0x40, 0x0a, 0x02, 0x6f, 0xed, 0x20, 0x01, 0xef,
+    0x28, 0x93, 0x1a, 0x63, 0xe1, 0x28, 0xbd, 0x3d, 0xf5, 0x40, 0x0d, 0x02, 0x76, 0xe5, 0x20, 0x01,
+    0xec, 0x20, 0x01, 0xec, 0x28, 0x0c, 0x1b, 0x71, 0xe9, 0x28, 0xd9, 0x02, 0xf4, 0x60, 0x12, 0x09,
+    0x03, 0x74, 0x65, 0xf6, 0x28, 0x36, 0x51, 0x69, 0x6d, 0xe5, 0x20, 0x01, 0xf3, 0x28, 0xcb, 0x50,
+    0xe1, 0x68, 0x17, 0x00, 0x2f, 0x18, 0x06, 0x00, 0x74, 0xf3, 0x21, 0x01, 0xe5, 0x21, 0x01, 0x79,
+    0x72, 0x74, 0x6e, 0x75, 0x6f, 0xe3, 0x29, 0x40, 0x43, 0x6c, 0x6f, 0xe3, 0x20, 0x01, 0xef, 0x28,
+    0x3f, 0x4d, 0xf3, 0x80, 0x1d, 0x14, 0x0d, 0x04, 0x75, 0x6f, 0xe8, 0x21, 0x01, 0xec, 0x28, 0xdc,
+    0x46, 0xf3, 0x20, 0x01, 0xe9, 0x28, 0xc9, 0x4b, 0x69, 0x61, 0xe3, 0x20, 0x01, 0xee, 0x28, 0x67,
+    0x50, 0x61, 0x62, 0xe1, 0x28, 0xec, 0x14, 0xf2, 0xa0, 0x49, 0x28, 0x21, 0x0a, 0x05, 0x76, 0xf5,
+    0x28, 0x06, 0x3e, 0x75, 0xf4, 0x88, 0x4b, 0x4f, 0xe0, 0x24, 0x62, 0x37, 0x08, 0x00, 0x6c, 0x75,
+    0xe3, 0x49, 0x04, 0x00, 0xf5, 0x42, 0xe9, 0x28, 0xfd, 0x4a, 0x6f, 0x6d, 0x69, 0xf4, 0x28, 0x97,
+    0x0a, 0xe9, 0x48, 0x04, 0x00, 0x30, 0x01, 0x68, 0xf3, 0x60, 0x14, 0x0d, 0x03, 0x70, 0x6d, 0x61,
+    0xe8, 0x20, 0x01, 0xf7, 0x28, 0x7d, 0x51, 0xeb, 0x20, 0x01, 0xf2, 0x28, 0x3d, 0x50, 0xe1, 0x28,
+    0x1e, 0x50, 0xe1, 0x48, 0x38, 0x3f, 0x04, 0x00, 0x77, 0x61, 0x6c, 0x65, 0xe4, 0x21, 0x01, 0x66,
+    0xef, 0x28, 0x4c, 0x22, 0xee, 0x68, 0x0e, 0x00, 0x37, 0x28, 0x06, 0x00, 0x72, 0xe5, 0x20, 0x01,
+    0xe3, 0x28, 0x87, 0x4c, 0x67, 0xef, 0x20, 0x01, 0xec, 0x28, 0xe0, 0x38, 0xed, 0x60, 0x13, 0x0b,
+    0x03, 0x75, 0xf4, 0x20, 0x01, 0xf3, 0x28, 0x48, 0x51, 0x69, 0xf4, 0x21, 0x01, 0xe9, 0x28, 0x4c,
+    0x30, 0x61, 0x66, 0x66, 0x6f, 0xec, 0x20, 0x01, 0xec, 0x28, 0x70, 0x2a, 0xec, 0xc8, 0x7e, 0x50,
+    0x2c, 0x00, 0x1f, 0x00, 0x10, 0x00, 0xc5, 0x17, 0x0c, 0x00, 0xf4, 0x28, 0x8d, 0x03, 0xe9, 0x40,
+    0x09, 0x02, 0xf4, 0x20, 0x01, 0xf8, 0x28, 0xf1, 0x4b, 0xf3, 0x28, 0x23, 0x2f, 0x63, 0x79, 0x63,
+    0xf2, 0x20, 0x01, 0xef, 0x20, 0x01, 0xf4, 0x28, 0xf5, 0x4f, 0xe2, 0x28, 0xd4, 0x4a, 0x6b, 0x6f,
+    0x6f, 0x72, 0x62, 0x72, 0xe5, 0x28, 0xab, 0x4f, 0xe9, 0x40, 0x08, 0x02, 0x6e, 0x6f, 0xec, 0x28,
+    0xbf, 0x1a, 0xe3, 0x28, 0x1d, 0x1e, 0xe7, 0x68, 0x0d, 0x00, 0x06, 0x00, 0x6d, 0x1b, 0x64, 0x69,
+    0x72, 0xe2, 0x28, 0x57, 0x4d, 0xe1, 0x40, 0x13, 0x02, 0x74, 0x69, 0x72, 0x65, 0xe8, 0x21, 0x01,
+    0x6c, 0x61, 0x6e, 0xef, 0x20, 0x01, 0xe9, 0x28, 0x20, 0x4d, 0x6c, 0xec, 0x28, 0xdc, 0x4c, 0xe6,
+    0x48, 0xed, 0x01, 0x04, 0x00, 0x69, 0x6c, 0xe4, 0x28, 0x58, 0x1d, 0xe5, 0x48, 0xb4, 0x40, 0x04,
+    0x00, 0x74, 0xf3, 0x20, 0x01, 0xf5, 0x28, 0xaa, 0x40, 0xe4, 0x40, 0x09, 0x02, 0x72, 0x65, 0x76,
+    0xe1, 0x28, 0xd6, 0x08, 0x6e, 0x75, 0x6b, 0x6e, 0xe5, 0x20, 0x01, 0xeb, 0x28, 0x2d, 0x4b, 0xe3,
+    0x88, 0x4f, 0x00, 0x0c, 0x00, 0x08, 0x00, 0xed, 0x43, 0xf0, 0x28, 0x48, 0x1a, 0xee, 0x40, 0x2d,
+    0x02, 0xe5, 0x60, 0x1f, 0x18, 0x03, 0x69, 0x63, 0xf3, 0x21, 0x01, 0x66, 0x6f, 0xf9, 0x20, 0x01,
+    0xf2, 0x20, 0x01, 0x6f, 0xf4, 0x20, 0x01, 0xf3, 0x28, 0x4b, 0x25, 0x67, 0x69, 0x6c, 0xec, 0x28,
+    0xe6, 0x3b, 0x66, 0x65, 0x64, 0x6c, 0x61, 0x74, 0xf3, 0x28, 0x10, 0x28, 0xe1, 0x40, 0x0a, 0x02,
+    0x74, 0xf3, 0x20, 0x01, 0xe9, 0x28, 0x8f, 0x23, 0xec, 0x20, 0x01, 0x75, 0xe2, 0x28, 0x71, 0x4f,
+    0xe1, 0x48, 0x04, 0x00, 0xa2, 0x3b, 0xec, 0x48, 0x44, 0x45, 0x04, 0x00, 0x70, 0x68, 0xf4, 0x20,
+    0x01, 0xf2, 0x28, 0xfd, 0x49, 0xe4, 0xa0, 0x77, 0x65, 0x61, 0x17, 0x05, 0xf2, 0x40, 0x0a, 0x02,
+    0x6f, 0xe6, 0x20, 0x01, 0xf8, 0x28, 0x2c, 0x50, 0x61, 0x75, 0xe7, 0x28, 0xfb, 0x3d, 0xee, 0x40,
+    0x22, 0x02, 0xf5, 0x40, 0x0f, 0x02, 0x6f, 0x73, 0x64, 0x6e, 0x61, 0x65, 0xe7, 0x20, 0x01, 0xe1,
+    0x28, 0xc3, 0x47, 0x62, 0x72, 0x6f, 0x66, 0x73, 0x64, 0x67, 0x79, 0xe2, 0x20, 0x01, 0xed, 0x28,
+    0xfa, 0x35, 0xe1, 0x21, 0x01, 0xec, 0xa8, 0x06, 0x2f, 0x57, 0x45, 0x1a, 0x00, 0x0e, 0x00, 0x0a,
+    0x00, 0xf9, 0x28, 0xe8, 0x2e, 0xf4, 0x40, 0x06, 0x02, 0xf2, 0x28, 0x80, 0x4b, 0xef, 0x28, 0x51,
+    0x4d, 0x72, 0x61, 0x67, 0xf9, 0x28, 0x5d, 0x02, 0xec, 0x28, 0x39, 0x3a, 0xe9, 0x48, 0xc4, 0x42,
+    0x04, 0x00, 0x75, 0x6c, 0x65, 0x67, 0x6e, 0x65, 0x64, 0x6c, 0xe5, 0x28, 0x95, 0x18, 0xe1, 0x88,
+    0x1f, 0x00, 0x13, 0x00, 0xba, 0x4f, 0x08, 0x00, 0x6f, 0xf2, 0x20, 0x01, 0xec, 0x20, 0x01, 0xe9,
+    0x28, 0x6f, 0x41, 0x65, 0x74, 0xf3, 0x20, 0x01, 0xed, 0x20, 0x01, 0xf2, 0x28, 0xc6, 0x45, 0x64,
+    0x68, 0xe7, 0x28, 0xd9, 0x4e, 0xe3, 0x88, 0x5b, 0x00, 0x57, 0x00, 0x08, 0x00, 0xe0, 0x43, 0xe9,
+    0xe8, 0x07, 0x42, 0x00, 0x3c, 0x00, 0x31, 0x00, 0x57, 0x1e, 0x76, 0x44, 0x12, 0x00, 0x0e, 0x00,
+    0xf6, 0x28, 0xd0, 0x4c, 0xf4, 0x60, 0x12, 0x0e, 0x03, 0x6e, 0x61, 0x6c, 0x74, 0xe1, 0x20, 0x01,
+    0xe4, 0x28, 0x65, 0x4f, 0xec, 0x28, 0x16, 0x2b, 0x63, 0x61, 0x72, 0x70, 0xef, 0x20, 0x01, 0xf2,
+    0x28, 0x61, 0x25, 0x68, 0x70, 0x61, 0x72, 0x67, 0x6f, 0x6e, 0xe1, 0x28, 0x87, 0x06, 0x66, 0x69,
+    0xe3, 0x28, 0x4a, 0x44, 0x64, 0x65, 0x70, 0x6f, 0x6c, 0x63, 0xf9, 0x28, 0x24, 0x0e, 0xe5, 0x28,
+    0x75, 0x44, 0x64, 0x6e, 0x6f, 0x74, 0x67, 0x6e, 0xe9, 0x20, 0x01, 0xe8, 0x20, 0x01, 0xf3, 0x28,
+    0x84, 0x2e, 0xe1, 0xe8, 0x10, 0xba, 0x01, 0xb5, 0x01, 0x8c, 0x01, 0x68, 0x01, 0x48, 0x01, 0x33,
+    0x01, 0x2c, 0x01, 0xc3, 0x00, 0xb6, 0x00, 0x9b, 0x00, 0x7f, 0x00, 0x50, 0x00, 0x37, 0x00, 0x62,
+    0x40, 0x24, 0x00, 0x20, 0x00, 0xfa, 0x28, 0x26, 0x11, 0xf4, 0x40, 0x09, 0x02, 0x6f, 0x73, 0x65,
+    0xee, 0x28, 0x14, 0x33, 0x6e, 0xe1, 0x20, 0x01, 0xec, 0x28, 0xf2, 0x4a, 0xf2, 0x40, 0x09, 0x02,
+    0x65, 0x7a, 0x7a, 0xe9, 0x28, 0x34, 0x3a, 0x61, 0x62, 0x72, 0x61, 0xe2, 0x20, 0x01, 0xe1, 0x20,
+    0x01, 0xf4, 0x28, 0xd1, 0x23, 0xee, 0x88, 0x1e, 0x00, 0x15, 0x00, 0x08, 0x00, 0xef, 0x4b, 0x69,
+    0x6c, 0x6f, 0x72, 0x61, 0xe3, 0x20, 0x01, 0x68, 0xf4, 0x28, 0x3d, 0x36, 0x65, 0x64, 0xe1, 0x20,
+    0x01, 0xf3, 0x28, 0xb9, 0x43, 0xe1, 0x40, 0x06, 0x02, 0xe9, 0x28, 0x86, 0x1e, 0x63, 0x69, 0x72,
+    0xe5, 0x28, 0xcd, 0x4d, 0xed, 0x60, 0x10, 0x09, 0x03, 0xef, 0x48, 0x9f, 0x4e, 0x8f, 0x4e, 0xe5,
+    0x20, 0x01, 0xee, 0x28, 0x80, 0x43, 0xe1, 0x48, 0x04, 0x00, 0x91, 0x43, 0xe2, 0x28, 0xe6, 0x23,
+    0xec, 0x60, 0x13, 0x0c, 0x03, 0x75, 0x6f, 0x73, 0x73, 0x69, 0xed, 0x29, 0xcf, 0x41, 0x71, 0x2d,
+    0x73, 0xee, 0x28, 0x0c, 0x44, 0x6c, 0x6f, 0xea, 0x28, 0x0b, 0x4d, 0x6b, 0x73, 0xe1, 0x48, 0x1e,
+    0x4e, 0x04, 0x00, 0x72, 0xe2, 0x28, 0x4c, 0x4e, 0xe9, 0xe8, 0x09, 0x5e, 0x00, 0x4d, 0x00, 0x93,
+    0x4a, 0x49, 0x00, 0x93, 0x00, 0x35, 0x00, 0x20, 0x00, 0x18, 0x00, 0x12, 0x00, 0x74, 0x73, 0xef,
+    0x28, 0x5a, 0x49, 0x73, 0xf3, 0x20, 0x01, 0xf5, 0x28, 0x31, 0x4e, 0xee, 0x40, 0x0c, 0x02, 0x72,
+    0x6f, 0x66, 0xe9, 0x20, 0x01, 0xec, 0x28, 0xc2, 0x4b, 0xe9, 0x20, 0x01, 0xe7, 0x28, 0x40, 0x3a,
+    0xec, 0x40, 0x08, 0x02, 0x65, 0x74, 0xe1, 0x28, 0x7e, 0x36, 0xe1, 0x20, 0x01, 0xf2, 0x20, 0x01,
+    0xf4, 0x28, 0xdf, 0x1a, 0xe7, 0x28, 0x7c, 0x37, 0x62, 0x6d, 0x75, 0x6c, 0x6f, 0xe3, 0x21, 0x01,
+    0x68, 0x73, 0xe9, 0x20, 0x01, 0xf4, 0x28, 0x6e, 0x34, 0x61, 0xf5, 0x20, 0x01, 0xe8, 0x28, 0x38,
+    0x3f, 0xe8, 0x20, 0x01, 0xe1, 0x28, 0xb6, 0x4c, 0xe7, 0x40, 0x0b, 0x02, 0x6f, 0x6f, 0x6e, 0x61,
+    0x74, 0xf4, 0x28, 0x80, 0x1b, 0x68, 0x61, 0x6e, 0x6e, 0xe1, 0x28, 0xaf, 0x06, 0xe5, 0x40, 0x09,
+    0x02, 0x73, 0x72, 0x65, 0xe4, 0x28, 0xc0, 0x20, 0x72, 0x61, 0x61, 0xe9, 0x20, 0x01, 0x68, 0x70,
+    0x6c, 0x65, 0xe4, 0x20, 0x01, 0xe1, 0x20, 0x01, 0x6c, 0xe9, 0x28, 0x38, 0x34, 0xe4, 0x60, 0x1e,
+    0x0d, 0x03, 0xe9, 0x20, 0x01, 0xf2, 0x20, 0x01, 0xef, 0x28, 0xf4, 0x40, 0x65, 0x6e, 0x6f, 0x6d,
+    0x61, 0x6c, 0x65, 0xe4, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xf3, 0x28, 0x2e, 0x4b, 0xe1, 0x28, 0x8a,
+    0x05, 0xe3, 0x40, 0x08, 0x02, 0x72, 0x6f, 0xec, 0x28, 0x3a, 0x19, 0xe9, 0x40, 0x13, 0x02, 0x72,
+    0xe6, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xf4, 0x20, 0x01, 0xf3, 0x20, 0x01, 0xe1, 0x28, 0x4a, 0x4d,
+    0xe1, 0x20, 0x01, 0xe4, 0x20, 0x01, 0xf5, 0x28, 0xfc, 0x46, 0x61, 0xf4, 0x28, 0xd7, 0x3f, 0x39,
+    0x32, 0x63, 0x68, 0x67, 0x2d, 0x73, 0x65, 0x61, 0x63, 0x69, 0x6e, 0x75, 0x6d, 0x6f, 0x63, 0x65,
+    0x6c, 0x65, 0x74, 0x2d, 0x65, 0x2d, 0x73, 0x6f, 0x69, 0x65, 0x72, 0xf2, 0x20, 0x01, 0xef, 0x28,
+    0xac, 0x45, 0xf4, 0x21, 0x01, 0xae, 0xe8, 0x07, 0x44, 0x4d, 0x3c, 0x4d, 0x31, 0x4a, 0x37, 0x4d,
+    0x04, 0x4b, 0x0a, 0x4d, 0x02, 0x4d, 0x72, 0x61, 0xe6, 0x49, 0x04, 0x00, 0x04, 0x1e, 0x2e, 0xea,
+    0x28, 0x21, 0x45, 0xf0, 0x21, 0x01, 0xae, 0x48, 0xa3, 0x4a, 0x29, 0x08, 0xef, 0xc9, 0xd6, 0x10,
+    0x02, 0x4d, 0x10, 0x00, 0x1c, 0x4d, 0x97, 0x47, 0x0c, 0x00, 0xf4, 0x28, 0x36, 0x3b, 0xe3, 0x49,
+    0x04, 0x00, 0xf3, 0x1f, 0xae, 0xe8, 0x1c, 0xb8, 0x10, 0xb0, 0x10, 0xa9, 0x10, 0x2a, 0x10, 0x03,
+    0x10, 0xae, 0x0f, 0x80, 0x0e, 0x8c, 0x0c, 0xe7, 0x29, 0x2d, 0x0c, 0x21, 0x0c, 0xb1, 0x0b, 0xae,
+    0x0b, 0xd3, 0x0a, 0x42, 0x0a, 0xff, 0x09, 0x3f, 0x09, 0xe8, 0x08, 0x2f, 0x08, 0x3d, 0x06, 0x8d,
+    0x02, 0x6c, 0x01, 0x36, 0x01, 0x29, 0x01, 0x0c, 0x01, 0xe3, 0x00, 0x3d, 0x00, 0x38, 0x00, 0x7a,
+    0xe5, 0x28, 0x7f, 0x02, 0xf9, 0xe8, 0x08, 0x72, 0x00, 0x6b, 0x00, 0x66, 0x00, 0x58, 0x00, 0x3f,
+    0x00, 0x35, 0x00, 0x03, 0x10, 0x10, 0x00, 0xf8, 0x40, 0x16, 0x02, 0x6f, 0x72, 0xf0, 0x40, 0x0b,
+    0x02, 0x6d, 0x61, 0x70, 0x73, 0x6f, 0xee, 0x28, 0x74, 0x3b, 0x68, 0xf3, 0x28, 0x69, 0x1b, 0x61,
+    0x6c, 0x61, 0xe7, 0x20, 0x01, 0xeb, 0x20, 0x01, 0xe5, 0x28, 0x60, 0x4b, 0xf5, 0x21, 0x01, 0xe7,
+    0x20, 0x01, 0xef, 0x28, 0x8e, 0x4c, 0x72, 0x6f, 0xf4, 0x40, 0x08, 0x02, 0x73, 0x69, 0xf4, 0x28,
+    0x05, 0x48, 0x63, 0x65, 0x72, 0x69, 0x64, 0x65, 0x76, 0x69, 0x74, 0xe3, 0x28, 0x0f, 0x06, 0xeb,
+    0x48, 0xf2, 0x29, 0x04, 0x00, 0x6e, 0x69, 0x6b, 0x73, 0xe9, 0x28, 0x9b, 0x39, 0x66, 0xe9, 0x28,
+    0xb1, 0x04, 0x64, 0x6e, 0x61, 0xe3, 0x28, 0x1c, 0x0d, 0xe1, 0x60, 0x1a, 0x0c, 0x03, 0x77, 0x65,
+    0x74, 0x61, 0x67, 0xad, 0x28, 0x4d, 0x37, 0xec, 0x40, 0x07, 0x02, 0x70, 0xe5, 0x28, 0x37, 0x16,
+    0x65, 0xf2, 0x28, 0x4a, 0x0f, 0x62, 0x6e, 0xf8, 0x21, 0x01, 0xae, 0x40, 0x0a, 0x02, 0x6c, 0x61,
+    0x63, 0x6f, 0x6c, 0xad, 0x20, 0x01, 0xb2, 0x28, 0x7a, 0x49, 0xf8, 0xc8, 0x1d, 0x00, 0x24, 0x49,
+    0x17, 0x00, 0x0c, 0x00, 0x6f, 0x08, 0x93, 0x25, 0x6f, 0x62, 0x61, 0x6e, 0xe9, 0x20, 0x01, 0xe1,
+    0x28, 0x9e, 0x09, 0xe9, 0x48, 0x81, 0x25, 0xb5, 0x08, 0x62, 0x73, 0x62, 0xe6, 0x20, 0x01, 0xae,
+    0x28, 0x64, 0x0e, 0xf7, 0x40, 0x09, 0x02, 0x77, 0x77, 0x31, 0xb0, 0x28, 0x67, 0x40, 0xef, 0x40,
+    0x06, 0x02, 0xfa, 0x28, 0x36, 0x31, 0x6c, 0x70, 0x77, 0x6f, 0x6e, 0x73, 0xad, 0x28, 0x2d, 0x0c,
+    0xf6, 0x68, 0xfe, 0x0a, 0x06, 0x00, 0x18, 0x0f, 0x72, 0xe4, 0x28, 0x13, 0x3f, 0xf5, 0xe8, 0x07,
+    0x76, 0x03, 0x72, 0x39, 0x27, 0x00, 0x98, 0x4b, 0xb8, 0x4a, 0x15, 0x00, 0x0e, 0x00, 0xf2, 0x21,
+    0x01, 0xf5, 0x28, 0x59, 0x08, 0x6f, 0x79, 0x6e, 0x61, 0x68, 0x74, 0x72, 0x65, 0x74, 0x72, 0x61,
+    0xed, 0x20, 0x01, 0xf3, 0x28, 0xf3, 0x38, 0x61, 0x2d, 0xf3, 0x20, 0x01, 0x70, 0x70, 0x61, 0xf4,
+    0x28, 0x7e, 0x03, 0xf4, 0xe8, 0x0b, 0x16, 0x01, 0x02, 0x01, 0xf3, 0x00, 0xe7, 0x00, 0xe3, 0x00,
+    0xce, 0x0d, 0x7b, 0x00, 0x68, 0x00, 0x2a, 0x00, 0x16, 0x00, 0xd8, 0x0e, 0xf5, 0x48, 0x05, 0x29,
+    0x04, 0x00, 0x6e, 0x79, 0x65, 0x6b, 0x63, 0x6f, 0x68, 0xad, 0x20, 0x01, 0xe1, 0x28, 0xba, 0x38,
+    0xf3, 0x40, 0x10, 0x02, 0x6f, 0xe8, 0x40, 0x06, 0x02, 0xf3, 0x28, 0xe5, 0x4a, 0x70, 0xe9, 0x28,
+    0xc6, 0x4a, 0xe9, 0xa8, 0x1e, 0x00, 0x17, 0x00, 0x0f, 0x00, 0x0a, 0x00, 0xb8, 0x25, 0x74, 0xf2,
+    0x28, 0xf7, 0x04, 0x70, 0x61, 0x72, 0x65, 0xe8, 0x28, 0x17, 0x0c, 0x6c, 0x61, 0x69, 0xe3, 0x28,
+    0x8b, 0x27, 0x68, 0x63, 0x72, 0x61, 0x6e, 0x61, 0xad, 0x48, 0x52, 0x28, 0x1d, 0x06, 0x6f, 0x70,
+    0xf3, 0x68, 0x01, 0x35, 0x05, 0x4b, 0x06, 0x00, 0x70, 0x70, 0xe1, 0x21, 0x01, 0xae, 0x28, 0x4e,
+    0x3e, 0xee, 0x40, 0x5d, 0x02, 0xe5, 0x80, 0x53, 0x46, 0x0d, 0x04, 0x79, 0x6f, 0x6a, 0x2e, 0x73,
+    0xee, 0x28, 0x60, 0x2f, 0x74, 0x6e, 0x6f, 0x63, 0x72, 0x65, 0x73, 0xf5, 0x68, 0x28, 0x00, 0x06,
+    0x00, 0x48, 0x19, 0xe5, 0x68, 0x5b, 0x0d, 0x17, 0x00, 0x06, 0x00, 0x6c, 0x62, 0x61, 0x76, 0x72,
+    0x65, 0x73, 0x62, 0x6f, 0xae, 0x20, 0x01, 0x63, 0xe9, 0x28, 0xb7, 0x1b, 0x64, 0x6f, 0x6e, 0x69,
+    0x6c, 0xae, 0x28, 0x91, 0x49, 0xe2, 0x20, 0x01, 0x75, 0xe8, 0x28, 0x14, 0x36, 0x72, 0x2d, 0x6f,
+    0x74, 0xad, 0x20, 0x01, 0x65, 0x63, 0xe1, 0x28, 0x1c, 0x36, 0x64, 0x75, 0xf4, 0x28, 0x10, 0x27,
+    0x61, 0x74, 0x6e, 0x75, 0x6f, 0xe3, 0x28, 0x58, 0x02, 0xe9, 0x29, 0xb7, 0x17, 0x68, 0x67, 0x69,
+    0x6c, 0x66, 0x68, 0x74, 0x69, 0xf7, 0x28, 0xc9, 0x1b, 0x65, 0x65, 0xec, 0x48, 0xb0, 0x28, 0x04,
+    0x00, 0x72, 0x65, 0x62, 0xf5, 0x28, 0xa7, 0x28, 0xe3, 0x48, 0x19, 0x28, 0x04, 0x00, 0x65, 0x74,
+    0x65, 0x64, 0x61, 0x74, 0x61, 0x64, 0xae, 0x48, 0x73, 0x40, 0xb3, 0x1f, 0x61, 0x72, 0x63, 0x6f,
+    0xed, 0x28, 0x23, 0x05, 0xf3, 0xe8, 0x13, 0x97, 0x03, 0x93, 0x03, 0x7a, 0x03, 0x76, 0x03, 0x11,
+    0x03, 0xfe, 0x02, 0xe1, 0x02, 0xdc, 0x02, 0xbb, 0x02, 0xb0, 0x02, 0x75, 0x02, 0x66, 0x02, 0x48,
+    0x02, 0x27, 0x02, 0x06, 0x02, 0x7d, 0x01, 0xcb, 0x47, 0x30, 0x00, 0x26, 0x00, 0x79, 0xe1, 0x20,
+    0x01, 0x73, 0x64, 0xf2, 0x28, 0x27, 0x0f, 0x77, 0x61, 0x6e, 0x6f, 0x7a, 0x61, 0x6d, 0x61, 0xae,
+    0xa8, 0x52, 0x00, 0x2d, 0x00, 0x12, 0x00, 0x0a, 0x00, 0x87, 0x2e, 0xe2, 0x20, 0x01, 0xec, 0x20,
+    0x01, 0xe5, 0x02, 0xb3, 0x48, 0x04, 0x00, 0xa9, 0x49, 0x2d, 0x74, 0xf3, 0x40, 0x07, 0x02, 0x65,
+    0x77, 0xad, 0x20, 0xac, 0x61, 0x65, 0x68, 0x74, 0x72, 0x6f, 0x6e, 0xad, 0x20, 0x82, 0x32, 0x2d,
+    0x74, 0xf3, 0x40, 0x08, 0x02, 0x65, 0x77, 0xad, 0x40, 0x49, 0x96, 0x61, 0xe5, 0x40, 0x0d, 0x02,
+    0x68, 0xf4, 0x40, 0x02, 0x4e, 0x72, 0x6f, 0x6e, 0xad, 0x20, 0xaa, 0x2d, 0x73, 0xf5, 0x48, 0x50,
+    0x3a, 0xac, 0x00, 0x31, 0xad, 0x88, 0x32, 0x2e, 0x90, 0x00, 0x6b, 0x00, 0x08, 0x00, 0x74, 0xf3,
+    0x40, 0x26, 0x02, 0x65, 0x77, 0xad, 0x60, 0x1b, 0x16, 0x03, 0x76, 0x6f, 0x67, 0x2d, 0x73, 0x75,
+    0xad, 0x48, 0x42, 0x3a, 0x04, 0x00, 0x73, 0x70, 0x69, 0xe6, 0x28, 0x24, 0x3a, 0x75, 0xe5, 0x40,
+    0x3b, 0x37, 0x73, 0xf5, 0x40, 0x36, 0xa0, 0x61, 0xe5, 0x40, 0x17, 0x02, 0x68, 0xf4, 0x40, 0x07,
+    0x02, 0x75, 0x6f, 0xf3, 0x20, 0x06, 0x72, 0x6f, 0xee, 0x20, 0x01, 0x2d, 0x70, 0xe1, 0x40, 0x1c,
+    0x18, 0xad, 0x60, 0x0f, 0x0c, 0x03, 0x73, 0xf5, 0x41, 0x02, 0x0e, 0xad, 0x28, 0xe9, 0x39, 0xf0,
+    0x20, 0x63, 0x61, 0xf3, 0x40, 0x06, 0x02, 0xae, 0x40, 0x6f, 0x4c, 0xad, 0x48, 0xf7, 0x39, 0xd9,
+    0x39, 0x6c, 0xe1, 0x40, 0x19, 0x02, 0x72, 0x74, 0x6e, 0x65, 0x63, 0xad, 0x40, 0x09, 0x02, 0x75,
+    0xe5, 0x48, 0xcd, 0x39, 0x29, 0x00, 0x61, 0xe3, 0x48, 0xc6, 0x39, 0x22, 0x00, 0x6e, 0x72, 0x65,
+    0x74, 0x78, 0xe5, 0x28, 0xbb, 0x39, 0x68, 0xf4, 0x40, 0x32, 0x02, 0x75, 0x6f, 0x73, 0xad, 0x80,
+    0x27, 0x21, 0x04, 0x31, 0x70, 0xe1, 0x48, 0xa8, 0x39, 0x04, 0x00, 0xae, 0x88, 0xb7, 0x39, 0x2b,
+    0x00, 0x99, 0x39, 0x08, 0x00, 0x6b, 0x63, 0x61, 0x74, 0x73, 0x6c, 0x61, 0x75, 0xe4, 0x28, 0xa7,
+    0x24, 0xe6, 0x20, 0x01, 0xe1, 0x20, 0x0f, 0x65, 0xed, 0x20, 0x0b, 0x72, 0x6f, 0x6e, 0xad, 0x20,
+    0x01, 0x75, 0xe5, 0x20, 0x01, 0xae, 0x20, 0x01, 0x39, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0x2e, 0xf3,
+    0x40, 0x0f, 0x02, 0x74, 0x65, 0x73, 0x73, 0x61, 0x2d, 0x77, 0x65, 0x69, 0xf6, 0x28, 0x4e, 0x42,
+    0xe6, 0x28, 0x3e, 0x47, 0xf4, 0x60, 0x6e, 0x63, 0x03, 0x73, 0x61, 0x65, 0x62, 0x2d, 0x63, 0x69,
+    0x68, 0x74, 0x79, 0x6d, 0xae, 0xe0, 0x07, 0x43, 0x3f, 0x33, 0x25, 0x21, 0x17, 0x07, 0xf8, 0x21,
+    0x01, 0xee, 0x40, 0x06, 0x02, 0xf9, 0x28, 0xb0, 0x47, 0x69, 0xe8, 0x28, 0x28, 0x34, 0x74, 0x6f,
+    0xec, 0x20, 0x01, 0x65, 0xe3, 0x28, 0xcc, 0x48, 0xf3, 0x28, 0x06, 0x47, 0x72, 0xe5, 0x48, 0x04,
+    0x00, 0xe2, 0x34, 0x67, 0x69, 0x74, 0xee, 0x28, 0x94, 0x26, 0x6c, 0x61, 0xe3, 0x20, 0x01, 0xe1,
+    0x20, 0x01, 0xf2, 0x28, 0x35, 0x46, 0xe9, 0x28, 0x4a, 0x44, 0xe1, 0x40, 0x06, 0x02, 0xfa, 0x28,
+    0x12, 0x48, 0x6c, 0x6c, 0x69, 0xe3, 0x28, 0x0b, 0x48, 0x6e, 0x65, 0x6d, 0x65, 0x6c, 0x65, 0x70,
+    0x69, 0x75, 0xf1, 0x02, 0x63, 0x65, 0x6a, 0x62, 0xef, 0x40, 0x0a, 0x02, 0x72, 0x74, 0x6c, 0xf5,
+    0x20, 0x01, 0xf6, 0x02, 0x65, 0x64, 0x6f, 0x6e, 0xe9, 0x20, 0x01, 0xec, 0x02, 0xf3, 0x40, 0x08,
+    0x02, 0x69, 0x62, 0xef, 0x28, 0xfd, 0x2f, 0xe5, 0x40, 0x0a, 0x02, 0x72, 0xf4, 0x20, 0x01, 0xe3,
+    0x28, 0x07, 0x02, 0xec, 0x20, 0x01, 0x2d, 0x72, 0x6f, 0x66, 0xad, 0x28, 0xcb, 0x25, 0xf2, 0x40,
+    0x5c, 0x02, 0xe5, 0x40, 0x0c, 0x02, 0x74, 0x73, 0x6f, 0x68, 0x6d, 0x61, 0xe5, 0x28, 0xdd, 0x3e,
+    0x6e, 0x74, 0x72, 0x61, 0x70, 0x2d, 0x70, 0x61, 0xe5, 0x20, 0x01, 0xec, 0x28, 0xf5, 0x24, 0x70,
+    0x70, 0xe1, 0x68, 0x11, 0x00, 0xa6, 0x07, 0x06, 0x00, 0xf4, 0x48, 0x04, 0x00, 0x9c, 0x27, 0x69,
+    0xeb, 0x28, 0xf5, 0x35, 0x2d, 0x61, 0xf6, 0x20, 0x01, 0xee, 0x28, 0x9e, 0x45, 0xef, 0x40, 0x02,
+    0x05, 0xad, 0x20, 0x01, 0xf8, 0x20, 0x01, 0x6f, 0xe2, 0x28, 0x02, 0x24, 0xee, 0x88, 0x13, 0x00,
+    0xc6, 0x31, 0xc6, 0x35, 0x08, 0x00, 0x6f, 0x6f, 0x74, 0xf2, 0x20, 0x01, 0x61, 0xe3, 0x28, 0x77,
+    0x08, 0xe4, 0xc8, 0x1d, 0x00, 0x19, 0x00, 0xc4, 0x47, 0x0c, 0x00, 0x1c, 0x23, 0x09, 0x23, 0x68,
+    0x74, 0x69, 0xf7, 0x20, 0x01, 0xf3, 0x20, 0x01, 0xf3, 0x28, 0xd6, 0x44, 0xe4, 0x28, 0x37, 0x33,
+    0xad, 0x20, 0x01, 0xf0, 0x28, 0xad, 0x19, 0xed, 0x48, 0x4a, 0x25, 0x04, 0x00, 0x63, 0xf8, 0x28,
+    0x9a, 0x47, 0xeb, 0x68, 0x3f, 0x25, 0x17, 0x00, 0x06, 0x00, 0x63, 0x6f, 0x6c, 0xe2, 0x40, 0x08,
+    0x02, 0x70, 0x6f, 0xe8, 0x28, 0x0e, 0x47, 0xe5, 0x28, 0xb7, 0x2e, 0x61, 0x65, 0x72, 0x66, 0xad,
+    0x28, 0x5b, 0x45, 0x6a, 0xe6, 0x28, 0x23, 0x45, 0xe9, 0x40, 0x11, 0x02, 0x70, 0xe1, 0x48, 0xdc,
+    0x08, 0x04, 0x00, 0x74, 0x6e, 0x65, 0x6c, 0xf4, 0x28, 0xfe, 0x26, 0x68, 0x74, 0xb2, 0x20, 0x01,
+    0x74, 0xee, 0x28, 0xb0, 0x23, 0x66, 0x70, 0x69, 0xad, 0x48, 0x04, 0x00, 0xe8, 0x3a, 0x65, 0x72,
+    0x61, 0xec, 0x20, 0x01, 0xe6, 0x28, 0xd1, 0x45, 0xe5, 0xa0, 0x3e, 0x34, 0x23, 0x1d, 0x05, 0xf4,
+    0x40, 0x0a, 0x02, 0x79, 0x73, 0x6b, 0x63, 0xe9, 0x28, 0x90, 0x3c, 0xe9, 0x40, 0x06, 0x02, 0xf3,
+    0x28, 0x4e, 0x47, 0xe9, 0x28, 0x6a, 0x44, 0x6d, 0x61, 0xe7, 0x28, 0xcb, 0x07, 0x6c, 0x61, 0x68,
+    0x77, 0x2d, 0x65, 0x68, 0x74, 0x2d, 0x73, 0xe5, 0x20, 0x01, 0xf6, 0x28, 0x83, 0x43, 0x69, 0x74,
+    0x69, 0x6c, 0x69, 0x74, 0xf5, 0x28, 0xbd, 0x27, 0xe3, 0x40, 0x10, 0x02, 0x69, 0x76, 0x65, 0x64,
+    0x2d, 0x61, 0x6e, 0xe5, 0x20, 0x01, 0xec, 0x28, 0x54, 0x46, 0x61, 0x70, 0x73, 0x6e, 0x61, 0x65,
+    0x63, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0xe7, 0x20, 0x01, 0xe9, 0x28, 0xbe, 0x17, 0xe4, 0x28, 0x67,
+    0x22, 0x63, 0xe9, 0x40, 0x10, 0x02, 0x74, 0x63, 0x61, 0x74, 0x79, 0x74, 0x69, 0xf2, 0x20, 0x01,
+    0xf5, 0x28, 0x8e, 0x2c, 0xf0, 0x48, 0x07, 0x0a, 0x69, 0x24, 0xe2, 0x28, 0x62, 0x22, 0xe1, 0x88,
+    0x0f, 0x00, 0x72, 0x22, 0x6c, 0x22, 0x08, 0x00, 0x76, 0x6e, 0x61, 0xe3, 0x28, 0x52, 0x45, 0x61,
+    0xf0, 0x28, 0xdc, 0x41, 0xf2, 0xe8, 0x0a, 0xe1, 0x01, 0xa9, 0x46, 0xa7, 0x00, 0x89, 0x46, 0xa3,
+    0x00, 0x4e, 0x42, 0x97, 0x00, 0x53, 0x00, 0x4f, 0x00, 0x14, 0x00, 0xf5, 0x60, 0x32, 0x09, 0x03,
+    0x6f, 0x6d, 0xf5, 0x28, 0x9f, 0x07, 0xe5, 0x40, 0x0e, 0x02, 0x75, 0x67, 0x6f, 0x6c, 0x62, 0x2d,
+    0x6e, 0x6f, 0xed, 0x28, 0x25, 0x03, 0x74, 0x73, 0x6f, 0x68, 0xae, 0x40, 0x07, 0x02, 0x68, 0x63,
+    0xad, 0x20, 0x01, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0xad, 0x20, 0x01, 0xe7, 0x28, 0x43, 0x38, 0x61,
+    0x73, 0x2d, 0xef, 0x28, 0x33, 0x34, 0xf0, 0x28, 0xfb, 0x23, 0xef, 0x68, 0xf7, 0x23, 0x31, 0x00,
+    0x06, 0x00, 0xf4, 0x60, 0x18, 0x0c, 0x03, 0x73, 0x75, 0xf3, 0x20, 0x01, 0xe1, 0x28, 0xc8, 0x45,
+    0xe3, 0x40, 0x06, 0x02, 0xef, 0x28, 0x02, 0x01, 0xe1, 0x28, 0x3a, 0x01, 0x61, 0x72, 0x65, 0x6c,
+    0x65, 0x63, 0x63, 0x61, 0x6c, 0x61, 0x62, 0x6f, 0x6c, 0xe7, 0x28, 0xb9, 0x03, 0x73, 0x69, 0x76,
+    0x64, 0x61, 0x6c, 0x61, 0x69, 0x63, 0x6e, 0x61, 0x6e, 0x69, 0xe6, 0x28, 0x4d, 0x23, 0x6d, 0x67,
+    0x72, 0x70, 0x2e, 0xee, 0x20, 0x01, 0xe5, 0x28, 0x29, 0x47, 0xe9, 0x28, 0x60, 0x29, 0xe5, 0xe8,
+    0x0d, 0x0a, 0x01, 0xf4, 0x00, 0xed, 0x00, 0xd9, 0x00, 0xcb, 0x00, 0xa4, 0x00, 0x8c, 0x00, 0x86,
+    0x00, 0x80, 0x00, 0x6e, 0x00, 0x34, 0x00, 0x28, 0x00, 0x1a, 0x00, 0x7a, 0x69, 0x6c, 0x69, 0x62,
+    0x6f, 0x6d, 0x64, 0x65, 0x65, 0xf0, 0x28, 0x90, 0x32, 0xf9, 0x40, 0x05, 0x02, 0xf7, 0x20, 0x72,
+    0x61, 0xec, 0x28, 0x49, 0x22, 0x76, 0x72, 0x65, 0xf3, 0x88, 0x11, 0x00, 0x0d, 0x00, 0x08, 0x00,
+    0x4b, 0x0c, 0x6e, 0xed, 0x28, 0xdb, 0x41, 0xe9, 0x28, 0xed, 0x29, 0xad, 0x40, 0x08, 0x02, 0xf3,
+    0x48, 0x8f, 0x33, 0x71, 0x29, 0x6b, 0x69, 0xae, 0x40, 0x02, 0x0c, 0x63, 0x70, 0x6a, 0x2d, 0x72,
+    0x65, 0x76, 0xad, 0x20, 0x01, 0x64, 0x75, 0x6f, 0xec, 0x20, 0x01, 0xe3, 0x28, 0x37, 0x3f, 0x74,
+    0xee, 0x60, 0x0a, 0x06, 0x03, 0xf5, 0x20, 0x5f, 0xe9, 0x28, 0xff, 0x21, 0x65, 0xe3, 0x28, 0xd4,
+    0x44, 0x73, 0x75, 0xe2, 0x28, 0x28, 0x45, 0x72, 0x65, 0xf4, 0x28, 0xa8, 0x22, 0xf0, 0x40, 0x0b,
+    0x02, 0x65, 0x65, 0x6b, 0x6b, 0x6f, 0xef, 0x28, 0xed, 0x21, 0x61, 0x63, 0x73, 0x64, 0xee, 0x20,
+    0x01, 0xe1, 0x28, 0x3d, 0x21, 0xee, 0x40, 0x19, 0x02, 0x69, 0xe1, 0x40, 0x08, 0x02, 0x74, 0x72,
+    0x65, 0xf4, 0x20, 0x4d, 0x72, 0x74, 0x6c, 0x61, 0x6e, 0x6f, 0x73, 0x72, 0xe5, 0x28, 0xbe, 0x21,
+    0x67, 0x69, 0xf3, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xe4, 0x28, 0x6f, 0x22, 0x6b, 0x72, 0x6f, 0x77,
+    0x2d, 0x64, 0x72, 0xe1, 0x20, 0x01, 0xe8, 0x28, 0x61, 0x22, 0xe8, 0x40, 0x0d, 0x02, 0x70, 0x61,
+    0x72, 0x67, 0x6f, 0x74, 0x6f, 0xe8, 0x28, 0x95, 0x21, 0x63, 0xe1, 0x28, 0x01, 0x06, 0x67, 0x67,
+    0x6f, 0xec, 0x28, 0x92, 0x21, 0xe5, 0x48, 0xa7, 0x20, 0x04, 0x00, 0x6e, 0x69, 0xe7, 0x20, 0x01,
+    0x6e, 0xe5, 0x20, 0x01, 0xad, 0x20, 0x01, 0xee, 0x28, 0x33, 0x22, 0xe4, 0x40, 0x0a, 0x02, 0x6e,
+    0x65, 0xf2, 0x48, 0xd3, 0x1f, 0x7f, 0x44, 0x69, 0xf6, 0x40, 0x0e, 0x02, 0x6f, 0x72, 0xf0, 0x20,
+    0x01, 0xee, 0x20, 0x01, 0xf7, 0x28, 0xfc, 0x44, 0x65, 0x72, 0x70, 0x2d, 0x79, 0x62, 0x2d, 0x64,
+    0x65, 0x74, 0x73, 0x6f, 0xe8, 0x28, 0x33, 0x07, 0xe1, 0x49, 0x69, 0x22, 0x04, 0x00, 0x74, 0x73,
+    0x6b, 0x63, 0xef, 0x28, 0xce, 0x01, 0xf0, 0xc8, 0xb2, 0x00, 0xab, 0x00, 0x7c, 0x00, 0x2d, 0x44,
+    0x18, 0x00, 0x0c, 0x00, 0xf4, 0x40, 0x06, 0x02, 0xf4, 0x28, 0xb9, 0x05, 0xe6, 0x28, 0x41, 0x22,
+    0x70, 0xe1, 0xe8, 0x09, 0x54, 0x00, 0x4d, 0x00, 0x46, 0x00, 0x42, 0x00, 0x3c, 0x07, 0x39, 0x00,
+    0x27, 0x00, 0x12, 0x00, 0x08, 0x02, 0xf4, 0x40, 0x09, 0x02, 0x6e, 0x6f, 0x72, 0xe6, 0x28, 0x3b,
+    0x31, 0xe9, 0x20, 0x01, 0x6c, 0x6d, 0x61, 0xe5, 0x28, 0x84, 0x09, 0xf2, 0x40, 0x0a, 0x02, 0x6f,
+    0x65, 0x74, 0x65, 0xed, 0x29, 0x68, 0x34, 0x61, 0x65, 0xe7, 0x28, 0x90, 0x2a, 0x6f, 0x69, 0x66,
+    0x69, 0x6c, 0xe1, 0x28, 0xb5, 0x39, 0xeb, 0x28, 0x8a, 0x33, 0x65, 0x73, 0x61, 0xe2, 0x28, 0x79,
+    0x2f, 0x61, 0x6e, 0x69, 0xf3, 0x29, 0x0e, 0x36, 0xad, 0x20, 0x01, 0x72, 0x65, 0xf4, 0x20, 0x01,
+    0xf4, 0x28, 0x7b, 0x06, 0xe9, 0xa8, 0x77, 0x07, 0x63, 0x20, 0x29, 0x00, 0x15, 0x00, 0x0a, 0x00,
+    0x79, 0xed, 0x48, 0x49, 0x20, 0x04, 0x00, 0xf4, 0x28, 0x11, 0x43, 0x72, 0x75, 0x6f, 0xf9, 0x40,
+    0x08, 0x02, 0x68, 0x63, 0xf4, 0x28, 0x7c, 0x35, 0xe5, 0x20, 0x01, 0xf3, 0x28, 0x6a, 0x30, 0xef,
+    0x28, 0x05, 0x2c, 0x61, 0x65, 0x6c, 0xf5, 0x28, 0x2e, 0x11, 0x32, 0xf0, 0x28, 0xa2, 0x21, 0xef,
+    0xe8, 0x08, 0x4e, 0x00, 0x10, 0x44, 0x3e, 0x00, 0x36, 0x20, 0x2c, 0x00, 0x22, 0x00, 0x16, 0x00,
+    0x10, 0x00, 0x74, 0x74, 0xe1, 0x28, 0x9c, 0x2b, 0x73, 0x73, 0x65, 0x63, 0x63, 0x61, 0x6e, 0x64,
+    0xe3, 0x28, 0xf4, 0x05, 0xee, 0x21, 0x01, 0x69, 0x6c, 0x6f, 0xf8, 0x28, 0xd5, 0x3c, 0xed, 0x48,
+    0x73, 0x21, 0x04, 0x00, 0x65, 0x64, 0x2d, 0x62, 0x61, 0xec, 0x20, 0x01, 0xf4, 0x28, 0xbb, 0x0c,
+    0x68, 0x63, 0x65, 0x2d, 0x6e, 0x61, 0xed, 0x20, 0x01, 0xf4, 0x20, 0x01, 0xf3, 0x28, 0x6d, 0x3f,
+    0x62, 0x6f, 0xf2, 0x28, 0x5e, 0x2b, 0xee, 0xe8, 0x09, 0x86, 0x00, 0xb9, 0x43, 0x67, 0x00, 0x5e,
+    0x00, 0x3d, 0x07, 0xfb, 0x05, 0x16, 0x00, 0x93, 0x36, 0x12, 0x00, 0xf4, 0x28, 0x36, 0x21, 0xef,
+    0x80, 0x3d, 0x2b, 0x16, 0x04, 0xf3, 0x40, 0x0d, 0x02, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x75, 0x73,
+    0xf5, 0x28, 0x84, 0x16, 0xe9, 0x20, 0x1a, 0xf2, 0x40, 0x0a, 0x02, 0x74, 0x61, 0x70, 0x2d, 0x65,
+    0xec, 0x20, 0x17, 0x69, 0x74, 0xe1, 0x20, 0x01, 0xec, 0x28, 0x08, 0x3f, 0x69, 0xf3, 0x20, 0x01,
+    0x61, 0x6d, 0x2d, 0x61, 0x6c, 0x2d, 0xe1, 0x20, 0x01, 0x2d, 0xf4, 0x28, 0x45, 0x34, 0x65, 0x68,
+    0x74, 0x6e, 0x61, 0xf0, 0x28, 0x87, 0x1e, 0x65, 0x65, 0xf2, 0x20, 0x01, 0xe7, 0x28, 0x7b, 0x20,
+    0x64, 0xe3, 0x60, 0x16, 0x11, 0x03, 0x78, 0xe9, 0x20, 0x01, 0x72, 0x74, 0xf2, 0x20, 0x01, 0x65,
+    0xf0, 0x28, 0x02, 0x3b, 0x75, 0xed, 0x28, 0xfc, 0x04, 0x68, 0x73, 0xf5, 0x28, 0xf8, 0x33, 0xe1,
+    0x60, 0x28, 0x14, 0x03, 0xe9, 0x40, 0x07, 0x02, 0x72, 0x61, 0xf4, 0x20, 0xf2, 0x63, 0x69, 0x73,
+    0x75, 0xed, 0x28, 0x46, 0x20, 0xe6, 0x40, 0x0a, 0x02, 0x72, 0x61, 0x63, 0x73, 0xe1, 0x28, 0x44,
+    0x03, 0x2d, 0x73, 0x6c, 0x6c, 0xf5, 0x28, 0x7e, 0x1f, 0x63, 0x69, 0x6c, 0x62, 0x75, 0x70, 0xe5,
+    0x20, 0x01, 0xf2, 0x28, 0x25, 0x20, 0xed, 0xc8, 0x3d, 0x00, 0x28, 0x02, 0x37, 0x00, 0x20, 0x00,
+    0x17, 0x00, 0x0c, 0x00, 0x75, 0x69, 0x72, 0x61, 0x72, 0x72, 0x65, 0xf4, 0x28, 0xd8, 0x03, 0x73,
+    0x61, 0x63, 0x72, 0x61, 0xf3, 0x28, 0x69, 0x20, 0x72, 0x6f, 0x66, 0xe5, 0x40, 0x0b, 0x02, 0x72,
+    0x65, 0x72, 0x61, 0x63, 0xad, 0x28, 0xca, 0x28, 0x70, 0x79, 0x74, 0xae, 0x28, 0xaf, 0x25, 0x70,
+    0x6d, 0xec, 0x28, 0x93, 0x1d, 0x6d, 0x65, 0xb0, 0x02, 0xec, 0xe0, 0x08, 0x7a, 0x76, 0x60, 0x3d,
+    0x33, 0x1b, 0x0c, 0x08, 0xf8, 0x28, 0x54, 0x2f, 0x73, 0xf3, 0x20, 0x01, 0x75, 0xeb, 0x20, 0x01,
+    0xef, 0x20, 0x01, 0xf2, 0x28, 0xa5, 0x28, 0xf2, 0x40, 0x0e, 0x02, 0x75, 0xad, 0x48, 0xa3, 0x0c,
+    0x04, 0x00, 0x74, 0xe1, 0x28, 0x7d, 0x42, 0x69, 0x68, 0x77, 0x79, 0xe1, 0x28, 0x86, 0x26, 0x70,
+    0x70, 0xed, 0x20, 0x01, 0x73, 0xf7, 0x28, 0x96, 0x42, 0xec, 0x40, 0x18, 0x02, 0x75, 0x66, 0x2d,
+    0x79, 0x74, 0x6e, 0x75, 0x6f, 0xe2, 0x21, 0x01, 0x2e, 0xe1, 0x48, 0x54, 0x04, 0x04, 0x00, 0xf4,
+    0x28, 0x40, 0x0b, 0x65, 0x63, 0x65, 0x6c, 0x66, 0xe6, 0x28, 0xba, 0x21, 0xe9, 0x48, 0xe5, 0x1f,
+    0x04, 0x00, 0x61, 0xed, 0x48, 0x78, 0x05, 0x04, 0x00, 0x64, 0x65, 0x74, 0x73, 0x6f, 0xe8, 0x28,
+    0x03, 0x04, 0xe6, 0x28, 0xcf, 0x1f, 0xe1, 0x68, 0xcb, 0x1f, 0x0c, 0x00, 0x06, 0x00, 0x72, 0x65,
+    0xe2, 0x28, 0xfb, 0x1d, 0x63, 0x6f, 0xec, 0x28, 0x45, 0x05, 0xeb, 0xe8, 0x08, 0xca, 0x00, 0xc4,
+    0x00, 0xbc, 0x00, 0x1b, 0x41, 0x35, 0x00, 0x4f, 0x01, 0x10, 0x00, 0x85, 0x3f, 0xf2, 0x40, 0x16,
+    0x02, 0x6f, 0xf7, 0x48, 0x92, 0x02, 0x04, 0x00, 0x74, 0x65, 0x6e, 0x2d, 0x6f, 0x72, 0x65, 0x68,
+    0x6b, 0xe3, 0x28, 0xfb, 0x40, 0x61, 0x64, 0x68, 0x74, 0x69, 0x77, 0xf4, 0x20, 0x01, 0xec, 0x28,
+    0xdf, 0x34, 0x6c, 0x61, 0x74, 0x73, 0x6e, 0x61, 0x65, 0x62, 0x63, 0x69, 0x74, 0x73, 0x61, 0x6c,
+    0xe5, 0x21, 0x01, 0xae, 0x60, 0x27, 0x16, 0x03, 0x33, 0x2d, 0x74, 0xf3, 0x40, 0x08, 0x02, 0x65,
+    0x77, 0xad, 0x28, 0xbd, 0x31, 0x61, 0x65, 0x68, 0xf4, 0x20, 0x3a, 0x32, 0x2d, 0x74, 0xf3, 0x40,
+    0x07, 0x02, 0x65, 0xf7, 0x28, 0xee, 0x02, 0x61, 0xe5, 0x40, 0x1c, 0x25, 0x31, 0xad, 0x60, 0x3d,
+    0x30, 0x03, 0x74, 0xf3, 0x40, 0x15, 0x02, 0x65, 0x77, 0xad, 0x68, 0xec, 0x32, 0x95, 0x31, 0x06,
+    0x00, 0x76, 0x6f, 0xe7, 0x20, 0x01, 0xad, 0x28, 0xdf, 0x32, 0x61, 0xe5, 0x40, 0x0c, 0x02, 0x68,
+    0xf4, 0x40, 0x02, 0x1e, 0x72, 0x6f, 0xee, 0x20, 0x1d, 0xad, 0x48, 0xe4, 0x3d, 0xcc, 0x32, 0x6c,
+    0x61, 0x72, 0x74, 0x6e, 0x65, 0x63, 0xad, 0x48, 0x11, 0x3f, 0x68, 0x31, 0x68, 0xf4, 0x20, 0x01,
+    0x75, 0x6f, 0xf3, 0x20, 0x01, 0xad, 0x28, 0x1b, 0x2a, 0x65, 0x65, 0xe7, 0x48, 0x3e, 0x1e, 0x16,
+    0x05, 0x63, 0x69, 0xec, 0x28, 0x5e, 0x1f, 0xe1, 0x48, 0xea, 0x1e, 0x04, 0x00, 0x65, 0x72, 0x66,
+    0x6f, 0xe3, 0x28, 0xc1, 0x0d, 0xea, 0x20, 0x79, 0xe9, 0xe8, 0x09, 0x4e, 0x00, 0x43, 0x00, 0x3f,
+    0x00, 0x39, 0x00, 0x89, 0x03, 0x26, 0x00, 0x22, 0x00, 0x8f, 0x04, 0x12, 0x00, 0xfa, 0x40, 0x08,
+    0x02, 0x6e, 0x69, 0xec, 0x28, 0xda, 0x29, 0x69, 0x68, 0xe3, 0x28, 0xd4, 0x29, 0xf2, 0x28, 0xb4,
+    0x1e, 0xf0, 0x40, 0x07, 0x02, 0x64, 0xe5, 0x28, 0x7d, 0x0d, 0x61, 0x65, 0x72, 0xef, 0x20, 0x01,
+    0xe3, 0x28, 0x2e, 0x20, 0x6b, 0x69, 0xf7, 0x28, 0x35, 0x04, 0xe8, 0x28, 0x97, 0x1e, 0x66, 0x69,
+    0x77, 0x65, 0xe8, 0x20, 0x01, 0xf4, 0x28, 0x7b, 0x40, 0x63, 0x6f, 0x2d, 0x72, 0x65, 0x6d, 0x6f,
+    0x74, 0x73, 0x75, 0xe3, 0x22, 0x01, 0xae, 0x60, 0x09, 0x06, 0x03, 0xf3, 0x20, 0x07, 0xf0, 0x20,
+    0x04, 0xe9, 0x20, 0x01, 0xe3, 0x28, 0xf9, 0x31, 0xe8, 0x40, 0x06, 0x02, 0xef, 0x28, 0x65, 0x1e,
+    0xee, 0x28, 0x61, 0x1e, 0xe7, 0x40, 0x1f, 0x02, 0xef, 0x40, 0x14, 0x02, 0x6c, 0xe2, 0x48, 0xee,
+    0x03, 0x04, 0x00, 0x73, 0x69, 0x68, 0x74, 0x73, 0x65, 0x74, 0xe9, 0x28, 0x6b, 0x0b, 0xe6, 0x20,
+    0x01, 0xe7, 0x28, 0x43, 0x40, 0x6e, 0xe9, 0x80, 0x1e, 0x1a, 0x0d, 0x04, 0x74, 0x73, 0x6f, 0x68,
+    0x2d, 0xe2, 0x28, 0x68, 0x28, 0x72, 0x6f, 0x62, 0xf3, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xeb, 0x28,
+    0x78, 0x33, 0xeb, 0x28, 0x3f, 0x04, 0x67, 0x61, 0x74, 0x73, 0xad, 0x40, 0x0d, 0x02, 0x73, 0x77,
+    0x65, 0x6e, 0xee, 0x20, 0x01, 0xf7, 0x28, 0x2c, 0x40, 0x72, 0x61, 0x65, 0xe7, 0x20, 0x01, 0xe8,
+    0x28, 0xc3, 0x08, 0xe5, 0xe8, 0x10, 0xe5, 0x01, 0xdd, 0x01, 0x79, 0x01, 0x71, 0x01, 0x65, 0x01,
+    0x4e, 0x01, 0x35, 0x01, 0x1d, 0x01, 0x08, 0x01, 0xe4, 0x00, 0xc9, 0x00, 0xa1, 0x00, 0x98, 0x00,
+    0x5a, 0x00, 0x36, 0x00, 0x20, 0x00, 0xfa, 0x60, 0x0c, 0x07, 0x03, 0xe9, 0x28, 0x95, 0x2b, 0x65,
+    0xe5, 0x28, 0x51, 0x28, 0x61, 0xed, 0x20, 0x01, 0xeb, 0x28, 0x8c, 0x1f, 0xf6, 0x40, 0x15, 0x02,
+    0xe9, 0x40, 0x0d, 0x02, 0x74, 0x61, 0x76, 0x72, 0x65, 0x73, 0x6e, 0xef, 0x28, 0x49, 0x1d, 0xec,
+    0x28, 0xd2, 0x03, 0x61, 0x6c, 0x73, 0x2d, 0x65, 0x6c, 0x63, 0x69, 0x62, 0xf5, 0x28, 0x38, 0x1d,
+    0xf4, 0x80, 0x17, 0x10, 0x08, 0x04, 0xf9, 0x28, 0xec, 0x3f, 0x75, 0x70, 0x6d, 0x6f, 0xe3, 0x28,
+    0x07, 0x05, 0x6f, 0x6d, 0x65, 0xf2, 0x28, 0x26, 0x03, 0xe9, 0x40, 0x1c, 0x02, 0xf3, 0xa8, 0x04,
+    0x1d, 0x13, 0x00, 0x02, 0x0a, 0x0e, 0x00, 0x0a, 0x00, 0xf8, 0x28, 0x89, 0x0c, 0x74, 0xe9, 0x28,
+    0xc4, 0x25, 0x61, 0xec, 0x28, 0x94, 0x3e, 0x6e, 0x75, 0x61, 0xf2, 0x28, 0xae, 0x23, 0x73, 0x72,
+    0xf5, 0x20, 0x01, 0xee, 0x28, 0xf4, 0x1c, 0xf2, 0x60, 0x18, 0x09, 0x03, 0x69, 0x68, 0xe3, 0x28,
+    0x7c, 0x1b, 0x65, 0x68, 0x77, 0x79, 0x6e, 0x61, 0x6e, 0x6f, 0x68, 0x74, 0x79, 0xf0, 0x29, 0x9e,
+    0x2f, 0x61, 0x6c, 0x66, 0x64, 0x75, 0x6f, 0x6c, 0xe3, 0x20, 0x01, 0xf9, 0x28, 0xa4, 0x2f, 0xee,
+    0x68, 0x32, 0x1d, 0x0b, 0x00, 0x06, 0x00, 0x6f, 0xe7, 0x28, 0xb3, 0x1d, 0x69, 0x6c, 0x6e, 0xef,
+    0x48, 0x04, 0x00, 0xd2, 0x3e, 0x2d, 0xe5, 0x28, 0x2c, 0x01, 0xed, 0x68, 0x0f, 0x1d, 0x15, 0x00,
+    0x06, 0x00, 0x6f, 0xe8, 0x20, 0x01, 0xad, 0x48, 0x45, 0x2d, 0x04, 0x00, 0x74, 0xe1, 0x28, 0x9e,
+    0x02, 0x69, 0x6e, 0xe1, 0x20, 0x01, 0x2d, 0x6f, 0x74, 0x6e, 0xe9, 0x28, 0x81, 0x1d, 0xec, 0x40,
+    0x08, 0x02, 0x67, 0x6f, 0x6f, 0xe7, 0x20, 0xdc, 0x62, 0x69, 0x74, 0x70, 0xe1, 0x20, 0x01, 0xad,
+    0x28, 0xd1, 0x3e, 0xeb, 0x40, 0x10, 0x02, 0x69, 0x72, 0x74, 0x73, 0x72, 0x65, 0x74, 0x6e, 0x75,
+    0x6f, 0xe3, 0x28, 0xcc, 0x1c, 0x61, 0x75, 0xf1, 0x28, 0xc6, 0x1c, 0xe9, 0x40, 0x0c, 0x02, 0x70,
+    0xad, 0x20, 0x01, 0x73, 0x65, 0xeb, 0x28, 0xbc, 0x32, 0x68, 0xe3, 0x20, 0x01, 0xe5, 0x20, 0x01,
+    0xf4, 0x28, 0x47, 0x1c, 0xe7, 0x40, 0x0b, 0x02, 0x6e, 0x61, 0x68, 0x63, 0x78, 0xe5, 0x28, 0xa0,
+    0x1c, 0x64, 0xe5, 0x20, 0x01, 0x2d, 0x79, 0xec, 0x28, 0xbd, 0x22, 0x66, 0x69, 0x6c, 0x66, 0x6c,
+    0xe1, 0x20, 0x01, 0xe8, 0x28, 0x8a, 0x1c, 0x65, 0x72, 0xe6, 0x48, 0x22, 0x02, 0xa8, 0x02, 0xe4,
+    0x49, 0x82, 0x1c, 0x04, 0x00, 0xef, 0x40, 0x40, 0x02, 0xee, 0x40, 0x1e, 0x02, 0x6e, 0x65, 0x76,
+    0x65, 0xae, 0x80, 0x0d, 0x0a, 0x07, 0x04, 0xb4, 0x20, 0x0a, 0xb3, 0x20, 0x07, 0xb2, 0x20, 0x04,
+    0xb1, 0x20, 0x01, 0xad, 0x48, 0x12, 0x30, 0xbb, 0x2e, 0x69, 0x6c, 0xae, 0x40, 0x09, 0x02, 0x73,
+    0x72, 0x65, 0xe2, 0x28, 0xfa, 0x0c, 0x72, 0x65, 0x63, 0x6e, 0x61, 0x6c, 0x61, 0x62, 0x65, 0xe4,
+    0x20, 0x01, 0xef, 0x20, 0x01, 0xee, 0x02, 0xe3, 0x40, 0x08, 0x02, 0x65, 0x6c, 0xe7, 0x28, 0x75,
+    0x27, 0x2e, 0x72, 0x65, 0x64, 0x6c, 0x69, 0x75, 0xe2, 0x22, 0x01, 0xad, 0x40, 0x02, 0x99, 0xe7,
+    0x28, 0x7b, 0x2f, 0x63, 0x69, 0x66, 0x66, 0xef, 0x28, 0xb4, 0x01, 0x62, 0x75, 0x74, 0x75, 0x6f,
+    0xf9, 0x20, 0x01, 0xe8, 0x28, 0x42, 0x06, 0xe4, 0xe8, 0x09, 0x23, 0x01, 0xd3, 0x00, 0xbe, 0x00,
+    0xba, 0x00, 0xa7, 0x00, 0x40, 0x01, 0x22, 0x00, 0x1a, 0x00, 0x12, 0x00, 0x77, 0x65, 0x74, 0x6f,
+    0xed, 0x28, 0x4f, 0x3c, 0x76, 0xf2, 0x20, 0x01, 0xe5, 0x28, 0x9b, 0x11, 0x75, 0x6f, 0x6c, 0xe3,
+    0xe0, 0x09, 0x6e, 0x6a, 0x59, 0x47, 0x41, 0x2c, 0x1e, 0x15, 0x09, 0x76, 0x65, 0xe4, 0x48, 0xd5,
+    0x37, 0x04, 0x00, 0xf0, 0x28, 0x9b, 0x3b, 0x74, 0xe5, 0x20, 0x01, 0x6b, 0xe3, 0x28, 0x42, 0x33,
+    0x73, 0x6d, 0x65, 0x74, 0x73, 0x79, 0x73, 0xf4, 0x20, 0x01, 0xf5, 0x28, 0x36, 0x3e, 0x70, 0x61,
+    0x6e, 0x71, 0x79, 0xed, 0x21, 0x01, 0xad, 0x48, 0x04, 0x00, 0xd5, 0x30, 0xe1, 0x20, 0x01, 0xe8,
+    0x28, 0x00, 0x16, 0x6e, 0x65, 0xf6, 0x28, 0xf3, 0x2b, 0x6d, 0x65, 0x61, 0x65, 0x62, 0x6f, 0x64,
+    0xe1, 0x21, 0x01, 0xae, 0x20, 0x01, 0x76, 0xe5, 0x28, 0xc0, 0x0e, 0x69, 0x61, 0x66, 0x61, 0x77,
+    0xae, 0x48, 0x04, 0x00, 0x08, 0x0c, 0xe4, 0x48, 0x78, 0x35, 0x7c, 0x07, 0xe8, 0x28, 0xdc, 0x3d,
+    0x2d, 0x6e, 0x6f, 0x69, 0x74, 0xe1, 0x20, 0x01, 0x74, 0x73, 0xf9, 0x20, 0x01, 0xe1, 0x28, 0xaa,
+    0x27, 0xee, 0x48, 0x60, 0x1b, 0x04, 0x00, 0x61, 0x62, 0x65, 0x68, 0x74, 0x2d, 0x68, 0x74, 0x69,
+    0xf7, 0x28, 0xdb, 0x1b, 0xed, 0x28, 0x4d, 0x1b, 0xe9, 0x48, 0x49, 0x1b, 0x04, 0x00, 0x72, 0x67,
+    0x65, 0x76, 0x69, 0x73, 0x73, 0x61, 0xed, 0x20, 0x01, 0xae, 0x28, 0xdb, 0x12, 0xe5, 0xa8, 0x18,
+    0x2b, 0x3b, 0x00, 0x2e, 0x00, 0x1a, 0x00, 0x0a, 0x00, 0x74, 0x73, 0x6f, 0x68, 0xe5, 0x20, 0x01,
+    0x63, 0x61, 0xf0, 0x20, 0x01, 0xf3, 0x28, 0x38, 0x26, 0x72, 0x65, 0x77, 0x6f, 0x70, 0x65, 0x6e,
+    0x69, 0x67, 0x6e, 0x65, 0x70, 0xf7, 0x21, 0x01, 0x2e, 0xf3, 0x28, 0x09, 0x37, 0xec, 0x20, 0x01,
+    0x6c, 0x6f, 0x72, 0x74, 0x6e, 0x6f, 0xe3, 0x28, 0xdf, 0x3b, 0x69, 0x66, 0x69, 0x74, 0x72, 0x65,
+    0x63, 0xad, 0x48, 0xb5, 0x2a, 0x04, 0x00, 0x74, 0x6f, 0xee, 0x28, 0x72, 0x1b, 0x61, 0x65, 0x72,
+    0x6f, 0xf4, 0x28, 0xf9, 0x1a, 0xe3, 0xe8, 0x09, 0x45, 0x00, 0x41, 0x00, 0x3b, 0x00, 0x30, 0x00,
+    0x26, 0x00, 0x1b, 0x00, 0xe5, 0x3c, 0x16, 0x00, 0x12, 0x00, 0xf3, 0x28, 0xc7, 0x1a, 0x72, 0xe9,
+    0x28, 0xbe, 0x1a, 0xf0, 0x40, 0x02, 0x2c, 0x6b, 0x72, 0x6f, 0xf7, 0x28, 0xde, 0x22, 0xee, 0x48,
+    0xb3, 0x1a, 0x04, 0x00, 0xf6, 0x28, 0x90, 0x3c, 0x69, 0x74, 0x73, 0x61, 0x6c, 0x65, 0x6a, 0xae,
+    0x28, 0x4a, 0x12, 0x65, 0x73, 0xf9, 0x28, 0x2b, 0x33, 0xe4, 0x28, 0x98, 0x1a, 0x61, 0xed, 0x20,
+    0x01, 0x79, 0x74, 0x69, 0x72, 0x75, 0xe3, 0x28, 0x6f, 0x21, 0xe2, 0x40, 0x0b, 0x02, 0x69, 0x6c,
+    0x64, 0x74, 0x73, 0xae, 0x28, 0xe4, 0x0b, 0x65, 0xf7, 0x60, 0x13, 0x0b, 0x03, 0x6f, 0xf4, 0x20,
+    0x01, 0xf4, 0x28, 0xed, 0x38, 0x64, 0x72, 0x61, 0x69, 0xf7, 0x28, 0x79, 0x29, 0xad, 0x28, 0x9e,
+    0x2a, 0xe1, 0xe8, 0x0b, 0x67, 0x00, 0x56, 0x00, 0x52, 0x00, 0x3e, 0x00, 0x38, 0x00, 0x2b, 0x00,
+    0x5a, 0x3c, 0x1e, 0x00, 0x1a, 0x00, 0x16, 0x00, 0x4d, 0x39, 0xf7, 0x28, 0x47, 0x1a, 0xf6, 0x28,
+    0x43, 0x1a, 0x74, 0x61, 0x64, 0x74, 0x73, 0x75, 0x64, 0x67, 0x6e, 0xe9, 0x28, 0x60, 0x22, 0xf2,
+    0x48, 0xe8, 0x1a, 0x04, 0x00, 0xef, 0x20, 0x01, 0xe4, 0x28, 0x7a, 0x11, 0xf0, 0x48, 0x25, 0x1a,
+    0xb8, 0x19, 0xed, 0x48, 0x1f, 0x1a, 0x04, 0x00, 0x61, 0x6c, 0xec, 0x48, 0xad, 0x19, 0x04, 0x00,
+    0x61, 0x6d, 0xe1, 0x28, 0x43, 0x3b, 0xe9, 0x28, 0x0b, 0x1a, 0xe7, 0x48, 0x07, 0x1a, 0x04, 0x00,
+    0x6f, 0x79, 0x2d, 0x73, 0x65, 0x68, 0x63, 0xe1, 0x28, 0x3f, 0x37, 0xe3, 0x48, 0xf6, 0x19, 0x04,
+    0x00, 0x69, 0xf2, 0x48, 0x04, 0x00, 0x7e, 0x3b, 0x62, 0xe1, 0x20, 0x01, 0xe6, 0x28, 0xd4, 0x3b,
+    0xb5, 0x20, 0x01, 0xf3, 0x28, 0xe9, 0x23, 0x33, 0xf0, 0x20, 0x01, 0xed, 0x28, 0xd2, 0x19, 0x32,
+    0xe1, 0x28, 0xdb, 0x3b, 0xae, 0xe8, 0x07, 0x77, 0x38, 0x45, 0x3c, 0x14, 0x00, 0x0e, 0x00, 0x05,
+    0x3a, 0x0b, 0x3c, 0x03, 0x3c, 0xef, 0x48, 0x2b, 0x3c, 0x55, 0x3b, 0xed, 0x48, 0x22, 0x3c, 0x04,
+    0x00, 0xf5, 0x20, 0x01, 0xe5, 0x28, 0x12, 0x31, 0xec, 0x48, 0x87, 0x31, 0x04, 0x00, 0x6f, 0x68,
+    0x6b, 0xe3, 0x28, 0x12, 0x34, 0xeb, 0x21, 0x01, 0xae, 0xe8, 0x0b, 0xc3, 0x1b, 0x48, 0x00, 0x11,
+    0x3c, 0x09, 0x3c, 0xbd, 0x1b, 0x3f, 0x00, 0xca, 0x30, 0x3b, 0x00, 0x16, 0x00, 0xd7, 0x3b, 0x8e,
+    0x08, 0xf3, 0x68, 0x17, 0x00, 0x06, 0x00, 0xd6, 0x3a, 0xee, 0x20, 0x01, 0x65, 0xe9, 0x20, 0x01,
+    0xe3, 0x20, 0x01, 0x61, 0x6d, 0x72, 0xe1, 0x28, 0x5b, 0x22, 0xe5, 0x20, 0x01, 0x72, 0x69, 0xe1,
+    0x20, 0x01, 0xf4, 0x28, 0x4b, 0x3b, 0xf0, 0x28, 0x67, 0x09, 0xee, 0x20, 0x01, 0x69, 0x63, 0xe5,
+    0x28, 0xfd, 0x37, 0xe5, 0x48, 0x04, 0x00, 0x8b, 0x39, 0x72, 0x69, 0x61, 0x6e, 0x69, 0x72, 0x65,
+    0xf4, 0x28, 0x5f, 0x1a, 0xea, 0x02, 0xe9, 0x69, 0x0c, 0x00, 0x3d, 0x37, 0x06, 0x00, 0x72, 0x62,
+    0xe7, 0x28, 0xc4, 0x3b, 0xae, 0xc8, 0x74, 0x39, 0xa6, 0x3b, 0x96, 0x3b, 0x12, 0x00, 0x0c, 0x00,
+    0xf2, 0x38, 0xf4, 0x48, 0x7e, 0x3b, 0xa7, 0x3b, 0xef, 0x48, 0x04, 0x00, 0x80, 0x3b, 0xe3, 0x21,
+    0x01, 0xae, 0x48, 0x04, 0x00, 0x18, 0x1b, 0xe3, 0x28, 0x50, 0x25, 0xe7, 0x21, 0x01, 0x76, 0x75,
+    0x39, 0x36, 0x64, 0x38, 0x73, 0xf9, 0x28, 0x95, 0x32, 0xe6, 0x49, 0x04, 0x00, 0x2c, 0x3a, 0xae,
+    0xc8, 0x6b, 0x3b, 0x5b, 0x3b, 0x0c, 0x00, 0xf0, 0x19, 0x2b, 0x39, 0x31, 0x3b, 0xef, 0x20, 0x7a,
+    0xe4, 0x29, 0x02, 0x33, 0xe3, 0x21, 0x01, 0xae, 0x88, 0x43, 0x3b, 0x46, 0x3b, 0x13, 0x39, 0x11,
+    0x3b, 0xe2, 0x49, 0xf1, 0x32, 0x04, 0x3a, 0xe1, 0xc9, 0x46, 0x00, 0x42, 0x00, 0x38, 0x00, 0x10,
+    0x00, 0x0c, 0x00, 0x81, 0x3b, 0xe6, 0x28, 0x58, 0x3a, 0xe5, 0x40, 0x22, 0x02, 0xf4, 0x21, 0x01,
+    0xae, 0x40, 0x11, 0x02, 0x65, 0x73, 0xf2, 0x20, 0x01, 0xf5, 0x20, 0x01, 0xef, 0x20, 0x01, 0xe3,
+    0x28, 0x31, 0x28, 0xe3, 0x20, 0x01, 0x69, 0x74, 0x73, 0xe1, 0x28, 0x92, 0x32, 0xf2, 0x28, 0x02,
+    0x3a, 0x64, 0x72, 0x65, 0xf4, 0x20, 0x01, 0xf3, 0x28, 0x26, 0x3a, 0xe3, 0x29, 0x4f, 0x34, 0xae,
+    0xc8, 0x20, 0x00, 0x1c, 0x00, 0xfb, 0x3a, 0xeb, 0x3a, 0x0c, 0x00, 0xc9, 0x3a, 0xef, 0x68, 0xe3,
+    0x3a, 0x0a, 0x00, 0x06, 0x00, 0xeb, 0x28, 0xcb, 0x3a, 0xe9, 0x28, 0xfc, 0x03, 0xe5, 0x28, 0x2d,
+    0x27, 0xe1, 0x20, 0x01, 0xe1, 0x28, 0x21, 0x2f, 0x39, 0x38, 0x31, 0x72, 0xf6, 0x28, 0x07, 0x1d,
+    0x30, 0x30, 0x74, 0x73, 0xe2, 0x28, 0x7e, 0x31, 0xec, 0xe8, 0x14, 0x27, 0x09, 0x74, 0x08, 0x65,
+    0x08, 0x61, 0x08, 0x21, 0x08, 0x0c, 0x08, 0xf4, 0x07, 0xee, 0x07, 0x8a, 0x07, 0x44, 0x07, 0x2d,
+    0x07, 0xeb, 0x06, 0xb6, 0x06, 0x4e, 0x00, 0x46, 0x00, 0x60, 0x32, 0x42, 0x00, 0x3b, 0x00, 0x30,
+    0x00, 0x28, 0x00, 0x79, 0x63, 0x35, 0x72, 0xe2, 0x28, 0xc3, 0x31, 0x78, 0x33, 0x62, 0x36, 0x38,
+    0x39, 0x71, 0xf1, 0x28, 0xcf, 0x1b, 0x75, 0x62, 0x6e, 0xe1, 0x28, 0x81, 0x27, 0xf4, 0x29, 0x37,
+    0x2e, 0xf2, 0x68, 0xcc, 0x36, 0x09, 0x39, 0xfb, 0x39, 0xf0, 0x49, 0x04, 0x00, 0x4c, 0x39, 0xae,
+    0xe8, 0x16, 0x44, 0x05, 0x0a, 0x05, 0xe7, 0x04, 0x52, 0x04, 0x31, 0x04, 0x25, 0x04, 0x07, 0x04,
+    0x9a, 0x03, 0x89, 0x03, 0x68, 0x03, 0xfb, 0x02, 0x8c, 0x02, 0x64, 0x02, 0x5a, 0x02, 0x39, 0x05,
+    0x3b, 0x02, 0x30, 0x3a, 0x34, 0x01, 0xdb, 0x00, 0xd7, 0x00, 0x6f, 0x00, 0x2c, 0x00, 0xfa, 0xa8,
+    0x39, 0x00, 0x23, 0x00, 0x1d, 0x00, 0x00, 0x34, 0x0a, 0x00, 0xf3, 0x40, 0x07, 0x02, 0x75, 0xeb,
+    0x28, 0xdb, 0x02, 0xe9, 0x48, 0x04, 0x00, 0xb1, 0x39, 0xec, 0x28, 0x12, 0x1a, 0x64, 0x61, 0xec,
+    0x28, 0xfb, 0x01, 0xe3, 0x60, 0x10, 0x0b, 0x03, 0x7a, 0x73, 0x6f, 0x67, 0xe4, 0x28, 0xcd, 0x1d,
+    0x69, 0xf7, 0x28, 0x44, 0x26, 0x61, 0xf0, 0x20, 0x19, 0x61, 0x6d, 0x2d, 0x61, 0xf7, 0x28, 0xc1,
+    0x2b, 0xf9, 0xe0, 0x08, 0x5c, 0x48, 0x40, 0x28, 0x24, 0x17, 0x11, 0x08, 0x7a, 0x75, 0xf4, 0x20,
+    0x01, 0xf2, 0x28, 0xda, 0x19, 0x77, 0x61, 0xec, 0x28, 0x1b, 0x36, 0xf2, 0x40, 0x06, 0x02, 0xf5,
+    0x28, 0xd4, 0x03, 0x6f, 0xe7, 0x28, 0xe5, 0x39, 0xf0, 0x28, 0x6a, 0x38, 0xee, 0x40, 0x12, 0x02,
+    0x6c, 0x6f, 0x64, 0x2d, 0x7a, 0x72, 0x65, 0x69, 0x6d, 0xe9, 0x20, 0x01, 0xfa, 0x28, 0xaf, 0x19,
+    0xea, 0x28, 0x79, 0x34, 0x68, 0xe3, 0x20, 0x01, 0xf9, 0x28, 0xc1, 0x39, 0xe4, 0x40, 0x0a, 0x02,
+    0x69, 0xeb, 0x20, 0x01, 0xf3, 0x28, 0x7b, 0x02, 0x61, 0x7a, 0x63, 0x7a, 0xf3, 0x28, 0xc6, 0x04,
+    0x62, 0x75, 0xfa, 0x20, 0x01, 0xf3, 0x28, 0x86, 0x19, 0xf8, 0x28, 0x50, 0x34, 0xf7, 0x40, 0x42,
+    0x02, 0xef, 0xa0, 0x3a, 0x2d, 0x23, 0x14, 0x05, 0xfa, 0x40, 0x06, 0x02, 0x73, 0xe5, 0x20, 0x9f,
+    0xe3, 0x20, 0x01, 0xef, 0x28, 0x89, 0x1f, 0xf4, 0x40, 0x08, 0x02, 0x73, 0x75, 0xe7, 0x28, 0x5b,
+    0x22, 0x72, 0xe1, 0x28, 0x55, 0x02, 0xf2, 0x48, 0xd6, 0x35, 0x04, 0x00, 0xe7, 0x28, 0xb1, 0x32,
+    0xeb, 0x68, 0xdb, 0x02, 0x77, 0x34, 0x06, 0x00, 0x7a, 0xf3, 0x28, 0x7b, 0x07, 0xe7, 0x28, 0xa1,
+    0x07, 0xe1, 0x48, 0x04, 0x00, 0x9d, 0x36, 0xec, 0x40, 0x09, 0x02, 0x73, 0x69, 0x7a, 0xe4, 0x28,
+    0x1b, 0x2c, 0xe3, 0x28, 0xe0, 0x03, 0xf6, 0x48, 0x64, 0x29, 0x04, 0x00, 0x6f, 0xe7, 0x21, 0x01,
+    0xae, 0xe8, 0x11, 0xf0, 0x00, 0xe8, 0x00, 0x73, 0x2f, 0xe1, 0x00, 0xd9, 0x00, 0xd5, 0x00, 0xc8,
+    0x00, 0xc3, 0x00, 0xae, 0x00, 0xaa, 0x00, 0x92, 0x00, 0x6f, 0x00, 0x64, 0x00, 0x56, 0x00, 0x4f,
+    0x00, 0x28, 0x00, 0x22, 0x00, 0x7a, 0x6f, 0xf5, 0x28, 0x57, 0x36, 0xf7, 0xa8, 0x1e, 0x00, 0x16,
+    0x00, 0xfd, 0x38, 0x13, 0x00, 0x0a, 0x00, 0xf5, 0x21, 0x01, 0x69, 0x6d, 0xfa, 0x28, 0x42, 0x36,
+    0xef, 0x20, 0x67, 0xe9, 0x68, 0x71, 0x38, 0x02, 0x32, 0x3b, 0x36, 0xe7, 0x20, 0x01, 0xfa, 0x28,
+    0xca, 0x38, 0x74, 0x61, 0x6c, 0xf5, 0x28, 0x49, 0x04, 0xf3, 0x88, 0x8c, 0x37, 0x08, 0x00, 0x27,
+    0x36, 0x48, 0x34, 0xef, 0x28, 0x5f, 0x05, 0xf2, 0x48, 0x04, 0x00, 0x45, 0x38, 0x6b, 0xf3, 0x28,
+    0x10, 0x36, 0xf0, 0xa8, 0xc9, 0x38, 0x10, 0x00, 0x0a, 0x00, 0x19, 0x00, 0x2d, 0x35, 0xf5, 0x48,
+    0xaa, 0x38, 0x36, 0x38, 0x73, 0xf0, 0x69, 0x0a, 0x00, 0x3c, 0x18, 0x06, 0x00, 0xf7, 0x28, 0x26,
+    0x34, 0xed, 0x28, 0x22, 0x34, 0xef, 0x88, 0xa7, 0x1e, 0x0f, 0x00, 0x17, 0x38, 0x08, 0x00, 0x77,
+    0x74, 0x73, 0xef, 0x28, 0x24, 0x03, 0xf0, 0x21, 0x01, 0xf0, 0x28, 0xd7, 0x35, 0xee, 0x28, 0x10,
+    0x03, 0xed, 0x60, 0x0e, 0x07, 0x03, 0xf5, 0x29, 0x7a, 0x38, 0xf2, 0x20, 0x01, 0xe9, 0x28, 0x73,
+    0x38, 0x69, 0xe7, 0x28, 0xbe, 0x35, 0x68, 0xe9, 0x28, 0xfb, 0x04, 0xe7, 0x48, 0x04, 0x00, 0xb5,
+    0x35, 0xe9, 0x20, 0x01, 0xed, 0x28, 0xac, 0x35, 0xe6, 0x28, 0xea, 0x04, 0x65, 0xf3, 0x20, 0x01,
+    0xf3, 0x28, 0xd4, 0x37, 0xe4, 0x20, 0x01, 0xf4, 0x28, 0xdb, 0x04, 0x62, 0x6e, 0xe9, 0x48, 0xc7,
+    0x37, 0x91, 0x35, 0xe1, 0x48, 0xc1, 0x37, 0x04, 0x00, 0xf3, 0x29, 0x85, 0x35, 0xf4, 0xa8, 0x17,
+    0x00, 0x13, 0x38, 0x12, 0x00, 0x38, 0x30, 0x0a, 0x00, 0xf3, 0x20, 0x01, 0x65, 0xfa, 0x28, 0x13,
+    0x38, 0x6f, 0xf0, 0x28, 0x96, 0x1f, 0x61, 0x69, 0xf7, 0x28, 0xb1, 0x33, 0x72, 0x6f, 0x6d, 0x6f,
+    0x70, 0x68, 0xe3, 0x28, 0x7a, 0x34, 0xf0, 0x60, 0x1c, 0x15, 0x03, 0x6f, 0x68, 0xf3, 0x49, 0x04,
+    0x00, 0x5d, 0x37, 0x2d, 0x65, 0x63, 0x72, 0x65, 0x6d, 0xed, 0x28, 0x31, 0x0b, 0x6b, 0x6c, 0x77,
+    0xf7, 0x28, 0xc6, 0x03, 0xe5, 0x40, 0xbb, 0x02, 0x6c, 0x6b, 0xf3, 0x29, 0x68, 0x1e, 0xef, 0xe8,
+    0x08, 0xd1, 0x37, 0xff, 0x35, 0x5b, 0x00, 0x54, 0x00, 0x27, 0x00, 0x24, 0x31, 0x23, 0x00, 0x10,
+    0x00, 0xf7, 0x40, 0x09, 0x02, 0x6f, 0x67, 0x61, 0xf2, 0x28, 0xc0, 0x37, 0x65, 0xea, 0x20, 0x01,
+    0xe1, 0x28, 0xd5, 0x30, 0xf4, 0x28, 0xa4, 0x20, 0xee, 0x80, 0x26, 0x22, 0x19, 0x04, 0xfa, 0x60,
+    0x0f, 0x09, 0x03, 0x72, 0x6f, 0xf7, 0x28, 0x2a, 0x31, 0x65, 0x69, 0xee, 0x28, 0x63, 0x37, 0xe3,
+    0x28, 0xba, 0x01, 0xf4, 0x48, 0xbc, 0x28, 0x04, 0x00, 0xf9, 0x20, 0x79, 0xf0, 0x28, 0xbf, 0x24,
+    0x6c, 0xe5, 0x28, 0x84, 0x37, 0xec, 0x20, 0x01, 0xeb, 0x28, 0x07, 0x35, 0xeb, 0x40, 0x0b, 0x02,
+    0x7a, 0x64, 0xef, 0x20, 0x01, 0xec, 0x28, 0xfe, 0x32, 0x63, 0xe5, 0x20, 0x20, 0xee, 0x80, 0x5e,
+    0x29, 0x21, 0x04, 0xf9, 0x40, 0x12, 0x02, 0xfa, 0x40, 0x09, 0x02, 0xf3, 0x20, 0x01, 0xe5, 0x28,
+    0x44, 0x2c, 0x72, 0xf4, 0x28, 0x88, 0x24, 0x74, 0x7a, 0xf3, 0x20, 0x01, 0xec, 0x28, 0x54, 0x37,
+    0x75, 0xec, 0x20, 0x01, 0xe5, 0x28, 0xde, 0x03, 0xe9, 0xc8, 0x2f, 0x00, 0x26, 0x00, 0x23, 0x00,
+    0x1b, 0x00, 0xb9, 0x02, 0x0c, 0x00, 0x7a, 0xe4, 0x40, 0x08, 0x02, 0x6f, 0x62, 0xe5, 0x28, 0x1e,
+    0x03, 0xe5, 0x28, 0x0d, 0x37, 0x6d, 0xef, 0x20, 0x01, 0xec, 0x28, 0x00, 0x2a, 0xec, 0x20, 0x0a,
+    0x63, 0xe5, 0x20, 0x01, 0x7a, 0xe3, 0x28, 0x9d, 0x02, 0xe2, 0x28, 0x2e, 0x32, 0xe1, 0x40, 0x07,
+    0x02, 0x6e, 0xfa, 0x28, 0xa7, 0x32, 0xe7, 0x28, 0x76, 0x33, 0xed, 0x60, 0x0d, 0x07, 0x03, 0xf4,
+    0x29, 0x0c, 0x37, 0xf3, 0x48, 0xbb, 0x36, 0x4b, 0x0a, 0xef, 0x88, 0xe7, 0x36, 0x0c, 0x00, 0xda,
+    0x36, 0x08, 0x00, 0xf4, 0x28, 0xa6, 0x1a, 0xe4, 0x28, 0xa7, 0x28, 0xec, 0x60, 0x76, 0x09, 0x03,
+    0xe9, 0x48, 0xd4, 0x29, 0xd8, 0x36, 0xe5, 0x48, 0xc2, 0x36, 0xe3, 0x24, 0xeb, 0xc8, 0x5a, 0x00,
+    0x43, 0x00, 0xc0, 0x27, 0x37, 0x00, 0x2f, 0x00, 0x0c, 0x00, 0xf3, 0xa0, 0x1d, 0x17, 0x12, 0x0d,
+    0x05, 0x72, 0x6f, 0x77, 0x65, 0xfa, 0x28, 0xd5, 0x35, 0x70, 0xf5, 0x28, 0xb0, 0x33, 0x6e, 0xe1,
+    0x28, 0x6e, 0x02, 0x6a, 0x61, 0xfa, 0x28, 0x3a, 0x2b, 0xe1, 0x28, 0xa1, 0x33, 0x72, 0x6f, 0xe2,
+    0x48, 0x30, 0x2b, 0x42, 0x02, 0xef, 0x48, 0x8d, 0x0b, 0x04, 0x00, 0x74, 0x73, 0xf9, 0x28, 0x8e,
+    0x01, 0x69, 0xee, 0x68, 0x0d, 0x00, 0x76, 0x02, 0x06, 0x00, 0xf3, 0x20, 0x01, 0xe1, 0x28, 0x22,
+    0x31, 0xe2, 0x20, 0x01, 0xf9, 0x28, 0x64, 0x36, 0xe5, 0x48, 0x0a, 0x02, 0x04, 0x00, 0x77, 0x61,
+    0xec, 0x20, 0x01, 0x63, 0x6f, 0xec, 0x28, 0xb9, 0x33, 0xe9, 0x60, 0x0d, 0x0a, 0x03, 0x6b, 0x6c,
+    0x61, 0xf7, 0x28, 0x3c, 0x30, 0xe7, 0x20, 0x2f, 0x63, 0x73, 0x6f, 0x6d, 0x6f, 0x68, 0x63, 0x75,
+    0xf2, 0x20, 0x01, 0xe5, 0x28, 0x9a, 0x34, 0x68, 0x63, 0x79, 0x7a, 0x72, 0xe2, 0x20, 0x01, 0xec,
+    0x28, 0x93, 0x15, 0xe7, 0x68, 0x19, 0x00, 0x06, 0x00, 0x3a, 0x36, 0x65, 0x7a, 0x72, 0x62, 0xef,
+    0x40, 0x09, 0x02, 0xee, 0x20, 0x01, 0xf2, 0x28, 0xbc, 0x21, 0xec, 0x28, 0x6e, 0x1b, 0x61, 0x6c,
+    0xe2, 0x28, 0x0c, 0x27, 0xe5, 0xc0, 0x5c, 0x3e, 0x31, 0x29, 0x13, 0x06, 0xfa, 0x40, 0x45, 0x02,
+    0x73, 0x77, 0xef, 0x20, 0x01, 0xfa, 0x28, 0xff, 0x28, 0xf4, 0x40, 0x0d, 0x02, 0x69, 0xf3, 0x20,
+    0x01, 0x65, 0x6c, 0x70, 0xed, 0x28, 0x19, 0x33, 0x61, 0x74, 0x73, 0xe5, 0x28, 0x31, 0x1a, 0x6e,
+    0x61, 0x70, 0x6f, 0xeb, 0x28, 0x59, 0x32, 0xec, 0x40, 0x06, 0x02, 0xef, 0x28, 0xb0, 0x19, 0x61,
+    0xe8, 0x28, 0x44, 0x13, 0xe9, 0x60, 0x13, 0x09, 0x03, 0x73, 0x61, 0xec, 0x28, 0x39, 0x13, 0x6b,
+    0xf3, 0x20, 0x01, 0x72, 0x6f, 0xed, 0x28, 0x64, 0x31, 0x63, 0x73, 0x6a, 0x75, 0x6f, 0xee, 0x28,
+    0xad, 0x01, 0xe3, 0x40, 0x0d, 0x02, 0x79, 0x7a, 0x72, 0x65, 0xe9, 0x20, 0x01, 0xe2, 0x28, 0xfb,
+    0x1a, 0xe9, 0x40, 0x1f, 0x02, 0xf7, 0x48, 0xa9, 0x1d, 0x04, 0x00, 0xef, 0x60, 0x0b, 0x07, 0x03,
+    0xf4, 0x28, 0x8b, 0x15, 0xeb, 0x28, 0x32, 0x31, 0x68, 0xe3, 0x48, 0x04, 0x00, 0x71, 0x18, 0xe1,
+    0x20, 0x27, 0xec, 0x20, 0x01, 0xf2, 0x28, 0x46, 0x35, 0xe4, 0x88, 0x85, 0x32, 0x5f, 0x23, 0x18,
+    0x00, 0x08, 0x00, 0x75, 0x6f, 0x6c, 0xe3, 0x48, 0x5b, 0x08, 0x04, 0x00, 0xf3, 0x20, 0x01, 0xe4,
+    0x28, 0xed, 0x34, 0x72, 0x61, 0xe7, 0x20, 0x01, 0xf2, 0x28, 0x54, 0x34, 0xe3, 0x68, 0x0d, 0x00,
+    0x06, 0x00, 0xe8, 0x34, 0xef, 0x20, 0x01, 0xf2, 0x28, 0xa7, 0x32, 0xe5, 0x40, 0x10, 0x02, 0x6c,
+    0xe5, 0x48, 0x45, 0x35, 0x04, 0x00, 0x7a, 0x72, 0x6f, 0xe7, 0x28, 0xb6, 0x31, 0x69, 0xf7, 0x40,
+    0x0f, 0x02, 0xef, 0x48, 0x04, 0x00, 0x17, 0x01, 0xee, 0x20, 0x01, 0xf3, 0x28, 0xad, 0x1c, 0x61,
+    0x6c, 0x73, 0xe5, 0x28, 0x7b, 0x12, 0xe1, 0xe8, 0x0b, 0x07, 0x01, 0xf1, 0x00, 0xda, 0x00, 0xaf,
+    0x00, 0x85, 0x00, 0x72, 0x00, 0x5a, 0x00, 0x56, 0x00, 0x4f, 0x00, 0x29, 0x00, 0x16, 0x00, 0xfa,
+    0x40, 0x06, 0x02, 0xed, 0x28, 0x42, 0x21, 0x65, 0x69, 0x77, 0xef, 0x20, 0x01, 0x6c, 0xe1, 0x28,
+    0xc0, 0x2e, 0xf7, 0x40, 0x10, 0x02, 0xef, 0x40, 0x08, 0x02, 0x74, 0x61, 0xe9, 0x28, 0x26, 0x28,
+    0xee, 0x28, 0xd8, 0x1f, 0xe1, 0x40, 0x06, 0x02, 0x7a, 0xf3, 0x20, 0xab, 0xec, 0x68, 0x06, 0x00,
+    0x99, 0x33, 0xe4, 0x34, 0xe5, 0x28, 0x9a, 0x2e, 0xf4, 0x20, 0x01, 0xf3, 0x28, 0x24, 0x09, 0xf3,
+    0x28, 0x16, 0x29, 0x72, 0x6f, 0xe7, 0x68, 0x06, 0x00, 0x4d, 0x2e, 0x3a, 0x31, 0x2d, 0x61, 0xe9,
+    0x40, 0x06, 0x02, 0xee, 0x28, 0x35, 0x2c, 0xe2, 0x28, 0xf3, 0x33, 0xee, 0x60, 0x0b, 0x07, 0x03,
+    0xfa, 0x28, 0x3c, 0x29, 0xe9, 0x28, 0xc5, 0x0c, 0x65, 0x72, 0xe1, 0x28, 0x78, 0x1a, 0xec, 0x48,
+    0x81, 0x2d, 0x04, 0x00, 0xef, 0x40, 0x1b, 0x02, 0xf7, 0x40, 0x0d, 0x02, 0x6f, 0xeb, 0x20, 0x01,
+    0xf3, 0x20, 0x01, 0xee, 0x28, 0xd5, 0x19, 0x2d, 0x61, 0x77, 0xef, 0x20, 0x01, 0xec, 0x28, 0x6f,
+    0x33, 0xeb, 0x20, 0x01, 0xfa, 0x28, 0xf8, 0x33, 0xeb, 0x80, 0x1d, 0x12, 0x0e, 0x04, 0x79, 0x74,
+    0x73, 0xf9, 0x20, 0x01, 0xf2, 0x28, 0x2c, 0x11, 0xf4, 0x28, 0x9d, 0x25, 0x73, 0x6c, 0x6f, 0x70,
+    0xef, 0x20, 0x01, 0xec, 0x28, 0x51, 0x27, 0x65, 0x6c, 0xef, 0x40, 0x02, 0x30, 0x67, 0x75, 0xec,
+    0x28, 0xa9, 0x31, 0xe9, 0x68, 0x79, 0x30, 0x0e, 0x00, 0x06, 0x00, 0x6e, 0xf9, 0x20, 0x01, 0xe4,
+    0x28, 0xff, 0x33, 0xed, 0x20, 0x01, 0xf2, 0x28, 0x8c, 0x13, 0xe4, 0x68, 0xf4, 0x33, 0x0c, 0x00,
+    0x06, 0x00, 0x75, 0x72, 0xe1, 0x28, 0x69, 0x0f, 0xef, 0x20, 0x01, 0x72, 0xf4, 0x28, 0x67, 0x32,
+    0x63, 0x69, 0xee, 0x40, 0x06, 0x02, 0xe7, 0x28, 0xa9, 0x28, 0xe4, 0x20, 0x01, 0xe9, 0x28, 0xe0,
+    0x0f, 0xef, 0xc8, 0x1a, 0x34, 0x2c, 0x00, 0x24, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x5f, 0x31, 0xf2,
+    0x28, 0x07, 0x34, 0xef, 0x48, 0x04, 0x00, 0x68, 0x31, 0xe3, 0x21, 0x01, 0xae, 0x48, 0xe3, 0x2f,
+    0x04, 0x00, 0x72, 0xef, 0x28, 0xd2, 0x24, 0xec, 0x21, 0x01, 0x2e, 0xe7, 0x28, 0x9f, 0x32, 0xe2,
+    0x20, 0x01, 0xf4, 0x28, 0x69, 0x26, 0xee, 0x49, 0x04, 0x00, 0xda, 0x33, 0xae, 0xe8, 0x09, 0xd2,
+    0x22, 0xb7, 0x22, 0x2a, 0x00, 0xc0, 0x33, 0xa1, 0x22, 0x19, 0x00, 0xfa, 0x2c, 0x8b, 0x33, 0x12,
+    0x00, 0x79, 0x61, 0x6c, 0xf0, 0x28, 0xfd, 0x2e, 0x72, 0x65, 0x74, 0x73, 0x75, 0x6c, 0x63, 0x2d,
+    0x67, 0x6e, 0xe9, 0x20, 0x01, 0xf4, 0x28, 0xc2, 0x02, 0x6e, 0xef, 0x48, 0xd2, 0x08, 0x04, 0x00,
+    0x72, 0xf4, 0x20, 0x01, 0xf3, 0x28, 0x7e, 0x28, 0xed, 0x21, 0x01, 0xae, 0xc8, 0x47, 0x09, 0x8f,
+    0x33, 0x7f, 0x33, 0x4f, 0x31, 0x55, 0x33, 0x0c, 0x00, 0xf6, 0x48, 0x42, 0x33, 0x2d, 0x09, 0xec,
+    0x88, 0x1d, 0x00, 0x17, 0x00, 0x08, 0x00, 0x03, 0x2d, 0x69, 0x68, 0x6d, 0x61, 0x69, 0xec, 0x20,
+    0x01, 0xec, 0x20, 0x01, 0xe9, 0x28, 0xba, 0x30, 0xe5, 0x48, 0xc0, 0x30, 0x07, 0x32, 0xe1, 0x68,
+    0x06, 0x00, 0x52, 0x33, 0x1c, 0x28, 0xe2, 0x48, 0xd2, 0x28, 0x04, 0x00, 0xf4, 0x48, 0x04, 0x00,
+    0x88, 0x03, 0x65, 0x6b, 0x73, 0x61, 0xe2, 0x21, 0x01, 0xae, 0x40, 0x06, 0x02, 0xfa, 0x28, 0x26,
+    0x33, 0xf3, 0x28, 0x27, 0x1c, 0xe9, 0x89, 0x16, 0x00, 0x08, 0x00, 0x33, 0x33, 0x23, 0x33, 0xe1,
+    0x48, 0xbb, 0x31, 0x04, 0x00, 0xed, 0x68, 0xf1, 0x32, 0xe9, 0x32, 0x4f, 0x04, 0xae, 0xe8, 0x08,
+    0xa1, 0x28, 0xea, 0x30, 0x45, 0x00, 0x1c, 0x33, 0x3e, 0x00, 0x10, 0x00, 0xdc, 0x30, 0xda, 0x32,
+    0x6f, 0xe3, 0x21, 0x01, 0xae, 0x60, 0x21, 0x14, 0x03, 0xf4, 0x48, 0x04, 0x00, 0xd3, 0x32, 0xe9,
+    0x20, 0x01, 0x62, 0xe1, 0x20, 0x01, 0xf4, 0x28, 0x5e, 0x32, 0x72, 0x65, 0x64, 0x72, 0x6f, 0x74,
+    0xe9, 0x20, 0x01, 0xe2, 0x28, 0x7f, 0x1e, 0x65, 0x67, 0x61, 0xf0, 0x28, 0xa1, 0x24, 0xe9, 0x20,
+    0x01, 0xee, 0x28, 0xc8, 0x27, 0xe6, 0x28, 0x4c, 0x04, 0xe8, 0x48, 0x2f, 0x30, 0x70, 0x2e, 0xe7,
+    0x21, 0x01, 0xae, 0xe8, 0x07, 0xc7, 0x32, 0xb7, 0x32, 0xba, 0x32, 0x87, 0x30, 0x8d, 0x32, 0x0e,
+    0x00, 0xaa, 0x2a, 0xf8, 0x28, 0xbc, 0x33, 0xe6, 0x68, 0x06, 0x00, 0xc4, 0x32, 0x9c, 0x32, 0x38,
+    0xe6, 0x48, 0x04, 0x00, 0x12, 0x2b, 0x70, 0x62, 0xe7, 0x28, 0x29, 0x29, 0xe5, 0x88, 0x39, 0x00,
+    0x12, 0x00, 0x08, 0x00, 0xad, 0x20, 0xf4, 0x49, 0x6f, 0x20, 0x04, 0x00, 0xf4, 0x28, 0x88, 0x25,
+    0xee, 0x40, 0x21, 0x02, 0x6e, 0x61, 0x68, 0xe3, 0x69, 0x10, 0x00, 0x8c, 0x20, 0x06, 0x00, 0x72,
+    0x65, 0x68, 0xf4, 0x20, 0x01, 0xe1, 0x28, 0xc8, 0x2b, 0x67, 0x6e, 0x69, 0xeb, 0x20, 0x01, 0xef,
+    0x28, 0x5e, 0x32, 0xe1, 0x28, 0xaa, 0x2d, 0x64, 0xe1, 0x28, 0x47, 0x27, 0xe4, 0x28, 0xe5, 0x25,
+    0xe3, 0x21, 0x01, 0xae, 0xa8, 0x5f, 0x2f, 0x4f, 0x32, 0x4a, 0x32, 0x84, 0x2b, 0x15, 0x32, 0xe1,
+    0xe9, 0x09, 0xa2, 0x00, 0x9b, 0x00, 0x40, 0x32, 0x3f, 0x2e, 0x97, 0x00, 0x69, 0x00, 0x5c, 0x00,
+    0x29, 0x00, 0x12, 0x00, 0x75, 0x74, 0x75, 0xed, 0x21, 0x01, 0x6e, 0x72, 0x65, 0x74, 0x73, 0x65,
+    0xf7, 0x20, 0x01, 0x68, 0xf4, 0x20, 0x01, 0xf2, 0x28, 0x96, 0x31, 0xf4, 0x68, 0x0a, 0x00, 0x06,
+    0x00, 0xc6, 0x31, 0xee, 0x28, 0x0c, 0x2e, 0xe9, 0x40, 0x08, 0x02, 0xf0, 0x48, 0x9c, 0x2f, 0x2c,
+    0x01, 0x67, 0x69, 0xe4, 0x21, 0x01, 0x2e, 0x73, 0x70, 0x70, 0x61, 0x64, 0x75, 0x6f, 0x6c, 0xe3,
+    0x21, 0x01, 0x2e, 0x6e, 0xef, 0x20, 0x01, 0xe4, 0x20, 0x01, 0xee, 0x28, 0x2b, 0x1e, 0xee, 0x48,
+    0x51, 0x27, 0x04, 0x00, 0x6f, 0x69, 0x74, 0xe1, 0x28, 0x57, 0x1d, 0xe9, 0x60, 0x15, 0x0d, 0x03,
+    0x74, 0x6e, 0x65, 0xe4, 0x20, 0x01, 0xf5, 0x28, 0xf4, 0x30, 0x72, 0xef, 0x20, 0x01, 0xed, 0x28,
+    0xd0, 0x2e, 0xe3, 0x48, 0x04, 0x00, 0x46, 0x19, 0x6e, 0x61, 0x6e, 0x69, 0xe6, 0x49, 0x15, 0x20,
+    0x04, 0x00, 0xec, 0x20, 0x01, 0xf0, 0x28, 0x90, 0x30, 0xe7, 0x29, 0x46, 0x26, 0xe2, 0x20, 0x01,
+    0xef, 0x28, 0xb1, 0x19, 0xae, 0xc8, 0xa6, 0x31, 0x9e, 0x31, 0x96, 0x31, 0x74, 0x31, 0x6c, 0x31,
+    0x64, 0x31, 0x30, 0x34, 0xf3, 0x28, 0xfc, 0x2d, 0xeb, 0xe8, 0x12, 0xe8, 0x03, 0xe0, 0x03, 0xda,
+    0x03, 0xac, 0x03, 0x7b, 0x03, 0x6d, 0x03, 0x89, 0x1c, 0xd4, 0x02, 0xc5, 0x02, 0x82, 0x02, 0x6e,
+    0x02, 0x2c, 0x02, 0x28, 0x02, 0xf4, 0x01, 0xbd, 0x01, 0xb9, 0x01, 0xa0, 0x31, 0x24, 0x00, 0xf5,
+    0x21, 0x01, 0xae, 0xe8, 0x0e, 0x89, 0x01, 0xf6, 0x10, 0x7f, 0x01, 0x45, 0x01, 0x40, 0x01, 0x28,
+    0x01, 0x0d, 0x01, 0x88, 0x00, 0x81, 0x00, 0x7e, 0x00, 0x66, 0x00, 0x40, 0x00, 0x38, 0x00, 0x1c,
+    0x00, 0xf9, 0x48, 0x04, 0x00, 0x83, 0x30, 0x72, 0x69, 0x75, 0x71, 0x6e, 0x69, 0xad, 0x48, 0x04,
+    0x00, 0x08, 0x01, 0xe3, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xec, 0x28, 0x66, 0x2d, 0x77, 0x65, 0x69,
+    0x76, 0x65, 0xf2, 0x20, 0xf0, 0x76, 0x6f, 0xe7, 0x21, 0x01, 0xae, 0x60, 0x11, 0x0d, 0x03, 0x6e,
+    0x67, 0x69, 0xe1, 0x20, 0x01, 0xf0, 0x28, 0x83, 0x2d, 0xe9, 0x28, 0xb7, 0x19, 0x65, 0x63, 0xe9,
+    0x48, 0x04, 0x00, 0xa1, 0x17, 0x66, 0x66, 0xef, 0x28, 0x8b, 0x17, 0xf4, 0x68, 0xe5, 0x30, 0x0e,
+    0x00, 0x06, 0x00, 0x73, 0x65, 0x75, 0x71, 0x6e, 0xe9, 0x20, 0xba, 0x6e, 0xed, 0x20, 0x01, 0xf9,
+    0x28, 0x75, 0x30, 0xf3, 0x20, 0x30, 0xf0, 0x20, 0x01, 0xf3, 0x28, 0xca, 0x2f, 0xef, 0x40, 0x09,
+    0x02, 0xf2, 0x20, 0x01, 0xf0, 0x28, 0xc9, 0x30, 0xe3, 0x21, 0x01, 0xae, 0xe8, 0x08, 0x65, 0x00,
+    0x4d, 0x00, 0x39, 0x00, 0x30, 0x00, 0x23, 0x30, 0x1b, 0x00, 0x10, 0x00, 0x05, 0x30, 0x76, 0x72,
+    0x65, 0x73, 0xad, 0x20, 0x01, 0xe8, 0x28, 0x9e, 0x30, 0xf4, 0x48, 0x04, 0x00, 0x83, 0x30, 0x66,
+    0x69, 0x68, 0x73, 0x72, 0x65, 0x79, 0x61, 0xec, 0x20, 0x01, 0xae, 0x28, 0x28, 0x2a, 0x6f, 0x6d,
+    0xe9, 0x20, 0x01, 0xe4, 0x28, 0xa8, 0x30, 0x6b, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x79, 0x62, 0xae,
+    0x40, 0x06, 0x02, 0xed, 0x28, 0xcb, 0x2e, 0xe8, 0x28, 0xe1, 0x2d, 0x65, 0xee, 0x40, 0x0e, 0x02,
+    0x6f, 0x7a, 0x67, 0x6e, 0x69, 0x65, 0x62, 0x6c, 0xec, 0x28, 0xc5, 0x29, 0x69, 0x6c, 0x6e, 0xef,
+    0x28, 0xa2, 0x2f, 0x62, 0x75, 0x6e, 0x73, 0x6f, 0x72, 0x74, 0x65, 0xf2, 0x20, 0x01, 0xae, 0x28,
+    0x85, 0x1c, 0xee, 0x48, 0x78, 0x15, 0x04, 0x00, 0x6f, 0x69, 0x73, 0x73, 0x69, 0x6d, 0x6d, 0x6f,
+    0x63, 0xad, 0x40, 0x02, 0x14, 0x6c, 0xe1, 0x20, 0x01, 0xf9, 0x28, 0xba, 0x2a, 0x6c, 0x65, 0x6e,
+    0x61, 0xf0, 0x20, 0x01, 0xad, 0x20, 0x01, 0x74, 0x6e, 0x65, 0x64, 0x6e, 0x65, 0x70, 0xe5, 0x20,
+    0x01, 0xe4, 0x28, 0x50, 0x2e, 0x68, 0xe3, 0x28, 0xb4, 0x21, 0x67, 0x72, 0xef, 0x21, 0x01, 0xae,
+    0x60, 0x2d, 0x29, 0x03, 0x79, 0xf2, 0x40, 0x0c, 0x02, 0x74, 0x6e, 0x65, 0x65, 0x6c, 0x66, 0xe6,
+    0x28, 0xcf, 0x21, 0x65, 0x74, 0x74, 0x6f, 0x6c, 0xf9, 0x40, 0x0a, 0x02, 0x74, 0x69, 0x6e, 0x69,
+    0xe6, 0x28, 0x10, 0x2f, 0x6c, 0x6b, 0xe5, 0x28, 0x47, 0x29, 0xf3, 0x28, 0x0a, 0x2b, 0x67, 0x75,
+    0xec, 0x29, 0xae, 0x2f, 0xe5, 0x48, 0x04, 0x00, 0xe4, 0x2f, 0xe3, 0x28, 0x2c, 0x19, 0xe3, 0x48,
+    0xed, 0x2f, 0xa9, 0x19, 0xf3, 0x29, 0x00, 0x29, 0x72, 0x6f, 0xf7, 0x21, 0x01, 0x74, 0x65, 0xee,
+    0x41, 0x09, 0x02, 0xe4, 0x20, 0x01, 0xef, 0x28, 0x19, 0x23, 0xae, 0x80, 0x1b, 0x15, 0x0b, 0x04,
+    0x73, 0x65, 0x63, 0xec, 0x28, 0x00, 0x2f, 0xef, 0x48, 0xa9, 0x2f, 0x04, 0x00, 0xf6, 0x28, 0xb8,
+    0x27, 0x6e, 0x6f, 0xec, 0x28, 0xb6, 0x2f, 0x68, 0x74, 0x75, 0x6d, 0xe9, 0x28, 0x29, 0x15, 0xf0,
+    0x21, 0x01, 0xae, 0xe8, 0x0c, 0xe3, 0x03, 0x97, 0x2f, 0x2a, 0x00, 0x24, 0x00, 0x20, 0x00, 0xb8,
+    0x2d, 0x1c, 0x00, 0x18, 0x00, 0x57, 0x2d, 0x5d, 0x2f, 0x55, 0x2f, 0x7a, 0x27, 0xf3, 0x28, 0x3e,
+    0x2f, 0xf0, 0x28, 0x3a, 0x2f, 0xee, 0x28, 0x36, 0x2f, 0xed, 0x48, 0x98, 0x25, 0x64, 0x2f, 0xeb,
+    0x28, 0x2c, 0x2f, 0xef, 0x28, 0x31, 0x2e, 0xee, 0x40, 0x22, 0x02, 0xe9, 0x49, 0x04, 0x00, 0xe9,
+    0x2e, 0xec, 0x21, 0x01, 0xae, 0x60, 0x0e, 0x0a, 0x03, 0xf0, 0x20, 0x01, 0xe5, 0x28, 0x1b, 0x25,
+    0xee, 0x28, 0xff, 0x12, 0x62, 0x65, 0xf7, 0x20, 0x01, 0xe4, 0x02, 0x61, 0xe2, 0xa9, 0x17, 0x00,
+    0x10, 0x00, 0x92, 0x1b, 0x0a, 0x00, 0x94, 0x2c, 0xf4, 0x48, 0x18, 0x2f, 0x1b, 0x15, 0xe5, 0x20,
+    0x01, 0xf4, 0x28, 0x1b, 0x2e, 0xe3, 0x28, 0x4b, 0x24, 0xed, 0x21, 0x01, 0xae, 0xe8, 0x07, 0x9c,
+    0x2c, 0x41, 0x2d, 0x1d, 0x2f, 0x0d, 0x2f, 0xeb, 0x2e, 0xe3, 0x2e, 0xdb, 0x2e, 0xec, 0x89, 0x0c,
+    0x00, 0xa5, 0x1a, 0x08, 0x00, 0x30, 0x2c, 0xe3, 0x28, 0x61, 0x2c, 0xae, 0xe8, 0x0d, 0x4e, 0x28,
+    0x2c, 0x00, 0x8d, 0x0e, 0xfe, 0x2e, 0x6f, 0x2c, 0x22, 0x00, 0xee, 0x2e, 0x1e, 0x00, 0x75, 0x0e,
+    0x1a, 0x00, 0x0f, 0x2d, 0xc4, 0x2e, 0xbc, 0x2e, 0xf0, 0x28, 0xfd, 0x27, 0xee, 0x28, 0x9a, 0x23,
+    0xec, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xf4, 0x28, 0xbd, 0x2d, 0xe3, 0x48, 0xe1, 0x2e, 0x4e, 0x16,
+    0xe9, 0x40, 0x09, 0x02, 0xf6, 0x20, 0x01, 0xe4, 0x28, 0xbb, 0x03, 0xf4, 0x28, 0x52, 0x06, 0xe8,
+    0x49, 0x04, 0x00, 0xa4, 0x2e, 0xae, 0xe8, 0x0d, 0x85, 0x00, 0x7f, 0x00, 0x7b, 0x00, 0x66, 0x00,
+    0x56, 0x00, 0x42, 0x00, 0x3c, 0x00, 0x35, 0x00, 0x2f, 0x00, 0x82, 0x2e, 0x7a, 0x2e, 0x23, 0x00,
+    0x1a, 0x00, 0x78, 0xf6, 0x20, 0x01, 0x61, 0xb0, 0x28, 0xd4, 0x26, 0xf6, 0x68, 0x06, 0x00, 0x50,
+    0x2e, 0x87, 0x0f, 0xe4, 0x28, 0x42, 0x2d, 0x73, 0x61, 0xe1, 0x28, 0x25, 0x14, 0x6e, 0x70, 0x71,
+    0xe9, 0x28, 0xda, 0x26, 0xed, 0x48, 0x7d, 0x0f, 0x69, 0x2e, 0xe9, 0x68, 0x0c, 0x00, 0xa0, 0x04,
+    0x06, 0x00, 0x78, 0x61, 0xb0, 0x28, 0x7a, 0x25, 0x30, 0x35, 0xb0, 0x28, 0x91, 0x0f, 0xe7, 0x68,
+    0x06, 0x00, 0x6d, 0x0f, 0x5f, 0x2e, 0x61, 0xb0, 0x20, 0x01, 0xee, 0x28, 0x9a, 0x2e, 0xe4, 0x68,
+    0x06, 0x00, 0x3d, 0x22, 0x24, 0x2d, 0xb2, 0x48, 0x67, 0x0f, 0x04, 0x00, 0x33, 0x72, 0x76, 0xe3,
+    0x28, 0xce, 0x23, 0xe3, 0x28, 0x5e, 0x2c, 0x62, 0x33, 0xf1, 0x28, 0x45, 0x0f, 0xe1, 0x48, 0x04,
+    0x00, 0x5a, 0x0f, 0x34, 0xf9, 0x28, 0x21, 0x0f, 0xe5, 0x48, 0xe1, 0x28, 0x04, 0x00, 0x73, 0xe1,
+    0x20, 0x01, 0xed, 0x28, 0xe4, 0x28, 0xe4, 0x49, 0x04, 0x00, 0x23, 0x2e, 0xae, 0xe8, 0x07, 0x12,
+    0x00, 0x0e, 0x00, 0x0a, 0x17, 0x00, 0x2e, 0xe1, 0x1c, 0x3a, 0x27, 0xf0, 0x25, 0xe7, 0x28, 0xe2,
+    0x2b, 0xe5, 0x48, 0x04, 0x00, 0xef, 0x25, 0xe4, 0x20, 0x01, 0x69, 0x73, 0x65, 0x6d, 0x6d, 0x65,
+    0xea, 0x20, 0x01, 0xe8, 0x28, 0xf7, 0x1c, 0xe3, 0xaa, 0x27, 0x00, 0x1b, 0x00, 0x12, 0x00, 0xe7,
+    0x22, 0x0a, 0x00, 0x72, 0xe5, 0x20, 0x01, 0xed, 0x28, 0x9f, 0x2d, 0x65, 0x62, 0xe4, 0x20, 0x01,
+    0xee, 0x28, 0xe7, 0x28, 0xe1, 0x48, 0x04, 0x00, 0xa7, 0x2d, 0x62, 0x64, 0xe5, 0x28, 0x9e, 0x0b,
+    0x2e, 0x77, 0x77, 0xf7, 0x04, 0x61, 0x72, 0xe6, 0x28, 0x48, 0x22, 0x39, 0x32, 0x34, 0x74, 0xe3,
+    0x28, 0x9f, 0x2e, 0x38, 0x75, 0x78, 0xf0, 0x28, 0x5c, 0x24, 0xea, 0xe8, 0x09, 0x14, 0x01, 0x06,
+    0x01, 0x62, 0x00, 0xfd, 0x2a, 0x4a, 0x00, 0x46, 0x00, 0x21, 0x2d, 0x1c, 0x00, 0x12, 0x00, 0x79,
+    0x71, 0x78, 0x39, 0x34, 0x71, 0xe9, 0x28, 0xcf, 0x2d, 0xf4, 0x21, 0x01, 0xae, 0xe8, 0x0b, 0xcd,
+    0x26, 0x1e, 0x00, 0xfc, 0x2a, 0x7d, 0x2d, 0x75, 0x2d, 0x6d, 0x2d, 0x64, 0x06, 0x16, 0x00, 0x43,
+    0x2d, 0x3b, 0x2d, 0x60, 0x25, 0xf4, 0x68, 0x4b, 0x2d, 0x8c, 0x2b, 0x8a, 0x18, 0xe3, 0x48, 0x6e,
+    0x2d, 0xb0, 0x2b, 0xee, 0x28, 0xdf, 0x26, 0xe6, 0x21, 0x01, 0xae, 0xe8, 0x09, 0x1d, 0x2b, 0xce,
+    0x2a, 0x4f, 0x2d, 0x47, 0x2d, 0x3f, 0x2d, 0xab, 0x22, 0x0f, 0x2b, 0x0d, 0x2d, 0x32, 0x25, 0xe2,
+    0x21, 0x01, 0xae, 0xe8, 0x0b, 0x97, 0x00, 0x93, 0x00, 0x37, 0x2d, 0x82, 0x00, 0x61, 0x00, 0x5c,
+    0x00, 0x36, 0x00, 0x25, 0x00, 0xfd, 0x2c, 0x1b, 0x00, 0x16, 0x00, 0x79, 0xe5, 0x28, 0xf7, 0x03,
+    0xf6, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xee, 0x28, 0x6a, 0x2a, 0xf4, 0x68, 0xf6, 0x2c, 0x06, 0x00,
+    0xe2, 0x2c, 0x6e, 0xe1, 0x20, 0x01, 0x72, 0x75, 0xe1, 0x20, 0x38, 0xf3, 0x60, 0x15, 0x0e, 0x03,
+    0xf4, 0x20, 0x01, 0x61, 0xe3, 0x20, 0x01, 0xef, 0x28, 0xf6, 0x2b, 0x72, 0x69, 0x73, 0xe9, 0x28,
+    0x27, 0x19, 0x65, 0xf4, 0x20, 0x01, 0x63, 0x65, 0x74, 0xe9, 0x20, 0x01, 0x68, 0xe3, 0x28, 0xe8,
+    0x24, 0x72, 0xf5, 0x28, 0x94, 0x21, 0xef, 0xa8, 0x1b, 0x00, 0xf8, 0x2a, 0x11, 0x00, 0x1d, 0x26,
+    0x0a, 0x00, 0xf4, 0x20, 0x01, 0xf3, 0x28, 0xaa, 0x2a, 0xee, 0x20, 0x01, 0xef, 0x20, 0x01, 0xe3,
+    0x28, 0x87, 0x2c, 0xe3, 0x29, 0x83, 0x2c, 0xed, 0x48, 0xa6, 0x2c, 0x04, 0x00, 0xf3, 0x20, 0x01,
+    0x69, 0xf2, 0x20, 0x01, 0xf5, 0x28, 0x4d, 0x2c, 0xe5, 0x28, 0xd8, 0x2a, 0x61, 0x63, 0x69, 0xf2,
+    0x28, 0xb1, 0x2b, 0x38, 0x64, 0x61, 0x31, 0x74, 0x61, 0x62, 0xe2, 0x20, 0x01, 0xe7, 0x28, 0x20,
+    0x22, 0x36, 0x70, 0x71, 0x67, 0xfa, 0x28, 0x18, 0x25, 0xe9, 0xe8, 0x18, 0xb7, 0x02, 0xb0, 0x02,
+    0x7b, 0x02, 0x52, 0x02, 0x00, 0x02, 0xf6, 0x01, 0xe9, 0x01, 0x71, 0x01, 0x5c, 0x01, 0x31, 0x01,
+    0x2c, 0x01, 0xf5, 0x00, 0xd9, 0x00, 0xd2, 0x00, 0x93, 0x00, 0x61, 0x2b, 0x8a, 0x00, 0x6f, 0x00,
+    0x4e, 0x00, 0x46, 0x09, 0x3f, 0x00, 0x3b, 0x00, 0x34, 0x00, 0x30, 0x00, 0xf9, 0x28, 0xde, 0x2a,
+    0x78, 0xe1, 0x48, 0x69, 0x2b, 0x58, 0x2c, 0xf7, 0x28, 0xc9, 0x27, 0xf6, 0x21, 0x01, 0xae, 0xa8,
+    0xc1, 0x21, 0x3c, 0x2c, 0x2c, 0x2c, 0x2f, 0x2c, 0xfc, 0x29, 0xf4, 0x60, 0x16, 0x0b, 0x03, 0x72,
+    0xe1, 0x20, 0x01, 0xe8, 0x28, 0x0b, 0x2c, 0xe9, 0x48, 0x19, 0x2c, 0x04, 0x00, 0x6e, 0xe9, 0x28,
+    0x40, 0x2a, 0x61, 0x72, 0xe5, 0x20, 0x01, 0xf3, 0x28, 0x0d, 0x1f, 0xf3, 0x49, 0x04, 0x00, 0x04,
+    0x28, 0xae, 0x68, 0x0c, 0x00, 0x06, 0x00, 0x36, 0x25, 0x70, 0x70, 0xe1, 0x28, 0x42, 0x17, 0x65,
+    0x67, 0x61, 0xf0, 0x28, 0x3b, 0x17, 0x72, 0xe1, 0x20, 0x01, 0x72, 0xf2, 0x28, 0xcf, 0x09, 0xee,
+    0x81, 0x20, 0x19, 0x08, 0x04, 0xf2, 0x28, 0xb1, 0x2b, 0xe9, 0x48, 0x04, 0x00, 0xdf, 0x2b, 0x68,
+    0x67, 0x72, 0x6f, 0xe2, 0x20, 0x01, 0xed, 0x28, 0x6c, 0x2a, 0x61, 0x69, 0x72, 0xf0, 0x28, 0xb5,
+    0x20, 0xae, 0xe8, 0x0a, 0x14, 0x00, 0x96, 0x29, 0xc8, 0x2b, 0xc0, 0x2b, 0xb5, 0x28, 0xef, 0x29,
+    0xb5, 0x23, 0xd9, 0x29, 0x8e, 0x2b, 0xab, 0x23, 0xe2, 0x48, 0x05, 0x25, 0x73, 0x2b, 0xed, 0x20,
+    0x01, 0xe1, 0x28, 0xa4, 0x2b, 0xec, 0x61, 0x10, 0x09, 0x03, 0x69, 0x61, 0xed, 0x28, 0xea, 0x18,
+    0x64, 0x72, 0x61, 0xe8, 0x28, 0xe3, 0x02, 0xae, 0x48, 0x04, 0x00, 0xc0, 0x24, 0xe1, 0x28, 0x1a,
+    0x29, 0xeb, 0xc9, 0x24, 0x00, 0x1e, 0x00, 0x1a, 0x00, 0x13, 0x00, 0x0b, 0x2b, 0x0c, 0x00, 0xf5,
+    0x20, 0x01, 0xfa, 0x28, 0x5b, 0x25, 0x6e, 0x69, 0x73, 0xec, 0x28, 0x6f, 0x11, 0xe9, 0x28, 0xe0,
+    0x0e, 0x62, 0x34, 0xe7, 0x28, 0xc7, 0x23, 0xae, 0xe8, 0x07, 0x62, 0x2b, 0x52, 0x2b, 0x83, 0x29,
+    0x22, 0x29, 0x28, 0x2b, 0x20, 0x2b, 0x45, 0x23, 0x6a, 0xf5, 0x28, 0x46, 0x12, 0xe8, 0x40, 0x19,
+    0x02, 0xf3, 0x40, 0x0e, 0x02, 0x69, 0xe2, 0x20, 0x01, 0x75, 0xf3, 0x20, 0x01, 0xf4, 0x28, 0x38,
+    0x2b, 0x61, 0x62, 0x6f, 0xe4, 0x28, 0xe3, 0x29, 0xe3, 0x48, 0x04, 0x00, 0x3d, 0x23, 0xe1, 0x20,
+    0x01, 0xf4, 0x20, 0x01, 0xe9, 0x28, 0x12, 0x2a, 0xe7, 0x21, 0x01, 0xae, 0xa8, 0x0a, 0x00, 0x1f,
+    0x2b, 0x0f, 0x2b, 0xe5, 0x2a, 0xdd, 0x2a, 0xe4, 0x48, 0xf4, 0x29, 0xeb, 0x29, 0xe6, 0x41, 0x09,
+    0x02, 0xef, 0x20, 0x01, 0xee, 0x28, 0x59, 0x27, 0xae, 0xe8, 0x09, 0x5d, 0x00, 0x55, 0x00, 0x48,
+    0x00, 0x37, 0x00, 0xd5, 0x19, 0x1d, 0x00, 0x2e, 0x24, 0x12, 0x00, 0xcc, 0x18, 0x75, 0x76, 0x69,
+    0x73, 0x69, 0x74, 0x6f, 0xeb, 0x28, 0xf6, 0x19, 0x72, 0x65, 0x74, 0x6e, 0x65, 0x63, 0x61, 0x74,
+    0x61, 0x64, 0xae, 0x40, 0x07, 0x02, 0x73, 0xe1, 0x28, 0xd3, 0x1f, 0xef, 0x20, 0x01, 0xed, 0x28,
+    0xc1, 0x26, 0x6d, 0x72, 0x6f, 0x66, 0x74, 0x61, 0x6c, 0x70, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0xae,
+    0x28, 0x20, 0x20, 0xe9, 0x40, 0x07, 0x02, 0x73, 0xf0, 0x28, 0xa3, 0x0a, 0xeb, 0x28, 0x69, 0x29,
+    0x64, 0xee, 0x20, 0x01, 0xe1, 0x28, 0x57, 0x2a, 0x61, 0x77, 0x35, 0x2d, 0x6e, 0x65, 0x6e, 0x69,
+    0x6b, 0xeb, 0x28, 0x74, 0x21, 0xe5, 0x40, 0x06, 0x02, 0xf0, 0x28, 0x26, 0x16, 0x62, 0xe8, 0x28,
+    0x80, 0x2b, 0xe4, 0x48, 0x04, 0x00, 0x76, 0x13, 0xe4, 0x28, 0x0b, 0x26, 0xe3, 0x69, 0x0a, 0x00,
+    0x06, 0x00, 0x8d, 0x2a, 0xe3, 0x28, 0xf9, 0x14, 0xae, 0xe8, 0x0d, 0x33, 0x00, 0x3f, 0x28, 0x2d,
+    0x00, 0x29, 0x00, 0x71, 0x2a, 0xea, 0x29, 0x61, 0x2a, 0xd3, 0x1f, 0x21, 0x00, 0x74, 0x2a, 0x82,
+    0x28, 0x37, 0x2a, 0x1a, 0x00, 0xf6, 0x20, 0x01, 0xf5, 0x28, 0x13, 0x2a, 0xef, 0x68, 0x44, 0x2a,
+    0x12, 0x2a, 0x0a, 0x1f, 0xe5, 0x28, 0x0a, 0x28, 0xe4, 0x48, 0x0e, 0x2a, 0x40, 0x2a, 0x61, 0x79,
+    0x62, 0x2d, 0x74, 0x72, 0x6f, 0x70, 0x6f, 0xf2, 0x20, 0x01, 0xe1, 0x28, 0x30, 0x2b, 0xe2, 0x89,
+    0x1b, 0x00, 0x14, 0x00, 0x08, 0x00, 0xae, 0x29, 0xef, 0x21, 0x01, 0xed, 0x21, 0x01, 0xae, 0x48,
+    0x58, 0x12, 0x53, 0x29, 0x61, 0x68, 0x64, 0xf5, 0x28, 0xfc, 0x26, 0xae, 0xa8, 0x0f, 0x2a, 0xff,
+    0x29, 0x02, 0x2a, 0x12, 0x2a, 0xd5, 0x29, 0xe1, 0xa1, 0x20, 0x1c, 0x18, 0x0d, 0x05, 0x74, 0xee,
+    0x20, 0x01, 0xe9, 0x28, 0x3b, 0x25, 0x64, 0xee, 0x20, 0x01, 0xf5, 0x20, 0x01, 0xf9, 0x28, 0xd9,
+    0x28, 0xe2, 0x28, 0x25, 0x05, 0xb1, 0x28, 0x5d, 0x01, 0xae, 0xa8, 0x58, 0x1f, 0xe1, 0x29, 0xd1,
+    0x29, 0xa1, 0x27, 0x0a, 0x00, 0xf5, 0x20, 0x01, 0xf7, 0x28, 0x28, 0x27, 0x37, 0x61, 0x30, 0xef,
+    0x28, 0x21, 0x19, 0x33, 0x74, 0xf5, 0x28, 0xdc, 0x1d, 0xe8, 0xe8, 0x10, 0x49, 0x02, 0xf6, 0x01,
+    0xe3, 0x01, 0xd9, 0x01, 0x3c, 0x01, 0x31, 0x01, 0x25, 0x01, 0x16, 0x01, 0x14, 0x01, 0x10, 0x01,
+    0x09, 0x01, 0xf3, 0x00, 0x86, 0x00, 0x33, 0x00, 0x24, 0x00, 0x20, 0x00, 0xfa, 0x28, 0x82, 0x29,
+    0x76, 0xef, 0x21, 0x01, 0x2e, 0x6c, 0x6f, 0x70, 0xe4, 0x20, 0x01, 0xf2, 0x28, 0x75, 0x29, 0xf4,
+    0xa1, 0x35, 0x2f, 0x23, 0x1d, 0x05, 0x72, 0xe1, 0x48, 0x6c, 0x26, 0x04, 0x00, 0xe5, 0x21, 0x01,
+    0x2e, 0x73, 0x70, 0x70, 0x61, 0xe4, 0x22, 0x01, 0x2e, 0x7a, 0xfa, 0x28, 0xd0, 0x1a, 0x6f, 0x72,
+    0xf8, 0x28, 0x4f, 0x27, 0x6c, 0x61, 0x65, 0xe8, 0x21, 0x01, 0x2e, 0x61, 0xf2, 0x28, 0x4a, 0x28,
+    0x69, 0x61, 0xe6, 0x29, 0x44, 0x17, 0xae, 0xe8, 0x08, 0x21, 0x27, 0x10, 0x00, 0x4e, 0x29, 0x7a,
+    0x27, 0x3a, 0x02, 0x2b, 0x0f, 0x56, 0x29, 0x13, 0x27, 0x65, 0xee, 0x20, 0x01, 0x69, 0xec, 0x28,
+    0xb2, 0x28, 0xf3, 0x61, 0x15, 0x0b, 0x03, 0xe9, 0x68, 0x91, 0x26, 0xc3, 0x27, 0xdc, 0x25, 0xe1,
+    0x48, 0x21, 0x29, 0x04, 0x00, 0xee, 0x28, 0x06, 0x28, 0xae, 0xe8, 0x08, 0x41, 0x00, 0x37, 0x00,
+    0x18, 0x00, 0x14, 0x00, 0xe0, 0x26, 0xde, 0x28, 0x63, 0x04, 0x10, 0x00, 0xf9, 0x28, 0x57, 0x10,
+    0xf0, 0x28, 0xce, 0x22, 0xed, 0x48, 0xf9, 0x28, 0x04, 0x00, 0x72, 0x6f, 0x66, 0x74, 0x61, 0x6c,
+    0x70, 0xae, 0x88, 0x0c, 0x00, 0x34, 0x1a, 0x08, 0x00, 0xdd, 0x18, 0xf4, 0x28, 0x03, 0x08, 0xe3,
+    0x28, 0xcf, 0x28, 0xec, 0x48, 0xe2, 0x28, 0x04, 0x00, 0xf8, 0x28, 0x25, 0x27, 0xe7, 0x48, 0x04,
+    0x00, 0xe0, 0x28, 0x6e, 0x61, 0xe2, 0x20, 0x01, 0xe8, 0x20, 0x01, 0xf3, 0x28, 0xfd, 0x01, 0xf0,
+    0x21, 0x01, 0xae, 0xe8, 0x08, 0xc7, 0x28, 0x82, 0x27, 0xbf, 0x28, 0xb7, 0x28, 0x3e, 0x08, 0x87,
+    0x26, 0x8d, 0x28, 0x85, 0x28, 0xef, 0x20, 0x01, 0xe3, 0x28, 0x14, 0x24, 0xed, 0x29, 0xe3, 0x0a,
+    0xeb, 0x02, 0xe7, 0x21, 0x01, 0xae, 0xa8, 0xa5, 0x28, 0x9d, 0x28, 0x95, 0x28, 0x6b, 0x28, 0x63,
+    0x28, 0xe6, 0x48, 0x04, 0x00, 0x22, 0x24, 0x32, 0x6c, 0xf0, 0x28, 0x6a, 0x29, 0x64, 0x30, 0x73,
+    0x62, 0xe7, 0x20, 0x01, 0xf0, 0x28, 0x86, 0x29, 0xe3, 0xe9, 0x07, 0x33, 0x00, 0x2f, 0x00, 0x4d,
+    0x23, 0x24, 0x00, 0x18, 0x00, 0x14, 0x00, 0x0e, 0x00, 0x74, 0x61, 0xf7, 0x29, 0xf1, 0x27, 0xf3,
+    0x28, 0x35, 0x27, 0xf2, 0x40, 0x06, 0x02, 0xf5, 0x28, 0xa6, 0x23, 0xe1, 0x28, 0x1e, 0x23, 0x69,
+    0xf2, 0x21, 0x01, 0xe5, 0x20, 0x01, 0xf5, 0x28, 0xc9, 0x24, 0xe1, 0x28, 0x43, 0x28, 0xae, 0xe8,
+    0x0b, 0xf3, 0x15, 0xeb, 0x15, 0x5b, 0x00, 0x50, 0x17, 0x54, 0x00, 0x4e, 0x00, 0x48, 0x00, 0x34,
+    0x00, 0x1a, 0x00, 0x5e, 0x13, 0x16, 0x00, 0xf9, 0x28, 0x1b, 0x13, 0x77, 0x6f, 0x6c, 0x66, 0x2e,
+    0xe5, 0x40, 0x0a, 0x02, 0x6e, 0x69, 0x67, 0x6e, 0xe5, 0x28, 0xc5, 0x10, 0x61, 0x2e, 0xb1, 0x20,
+    0x01, 0xf0, 0x28, 0xca, 0x27, 0xf4, 0x48, 0x04, 0x00, 0xe7, 0x27, 0x65, 0x6e, 0x65, 0x72, 0x69,
+    0xe6, 0x22, 0x01, 0x2e, 0x63, 0xf6, 0x28, 0x95, 0x19, 0x73, 0x6e, 0xe4, 0x28, 0x1f, 0x03, 0xf0,
+    0x48, 0x3a, 0x14, 0x54, 0x27, 0x67, 0x6e, 0x69, 0xeb, 0x28, 0x2c, 0x15, 0x64, 0x75, 0x6f, 0x6c,
+    0x63, 0xad, 0x28, 0x7b, 0x19, 0xe2, 0x49, 0x8d, 0x1f, 0x04, 0x00, 0xed, 0x28, 0xa3, 0x27, 0xb8,
+    0x40, 0x08, 0x02, 0x61, 0x37, 0xed, 0x28, 0x5c, 0x09, 0x38, 0xf9, 0x20, 0x01, 0x76, 0xe6, 0x28,
+    0xd6, 0x1e, 0x34, 0x77, 0x63, 0x33, 0x6f, 0x2d, 0x2d, 0x6e, 0xf8, 0x21, 0x01, 0xae, 0x80, 0x21,
+    0x16, 0x0c, 0x04, 0x72, 0x62, 0x30, 0x65, 0x66, 0xb1, 0x20, 0x25, 0x6c, 0x38, 0x62, 0x78, 0x69,
+    0x38, 0x69, 0xe6, 0x20, 0x1b, 0x69, 0x64, 0x31, 0x6b, 0x7a, 0x75, 0x63, 0xb3, 0x28, 0x79, 0x1e,
+    0xe1, 0x60, 0x1b, 0x12, 0x03, 0x76, 0x65, 0x34, 0x62, 0x33, 0x63, 0x30, 0xef, 0x20, 0x01, 0x63,
+    0xb2, 0x28, 0x07, 0x28, 0x33, 0x6a, 0x30, 0x68, 0x63, 0xb3, 0x28, 0x5e, 0x28, 0x32, 0x78, 0x79,
+    0x63, 0xb3, 0x28, 0x00, 0x1e, 0x30, 0x65, 0x65, 0x35, 0x61, 0x33, 0x6c, 0xe4, 0x28, 0x02, 0x28,
+    0xe7, 0xe8, 0x17, 0xa6, 0x08, 0x48, 0x08, 0x3e, 0x08, 0x37, 0x08, 0x2d, 0x08, 0x14, 0x08, 0x02,
+    0x08, 0xa4, 0x07, 0x96, 0x07, 0x73, 0x07, 0x45, 0x07, 0x3f, 0x07, 0x1f, 0x07, 0xfc, 0x06, 0xf4,
+    0x05, 0xd1, 0x05, 0x60, 0x0b, 0x83, 0x00, 0x56, 0x00, 0x78, 0x27, 0x3c, 0x00, 0x32, 0x00, 0x2e,
+    0x00, 0xf7, 0x28, 0xf9, 0x1e, 0xf6, 0x49, 0x04, 0x00, 0xb2, 0x1d, 0xae, 0x28, 0x2f, 0x23, 0xf5,
+    0x21, 0x01, 0xae, 0xe8, 0x07, 0x4e, 0x10, 0x0d, 0x27, 0x27, 0x27, 0x17, 0x27, 0x0e, 0x00, 0x2a,
+    0x27, 0x54, 0x20, 0xef, 0x48, 0x0d, 0x27, 0xdb, 0x26, 0xf3, 0x41, 0x0f, 0x02, 0x67, 0x62, 0x36,
+    0x33, 0x39, 0x6a, 0x34, 0x33, 0x75, 0xf3, 0x28, 0xa4, 0x1c, 0xae, 0xe8, 0x07, 0x0e, 0x00, 0xff,
+    0x26, 0xef, 0x26, 0xe5, 0x18, 0xcd, 0x26, 0xc5, 0x26, 0xbd, 0x26, 0x64, 0x65, 0x6c, 0x61, 0xe3,
+    0x20, 0x01, 0xf3, 0x28, 0xfc, 0x05, 0xf2, 0x88, 0x40, 0x05, 0x39, 0x05, 0x16, 0x00, 0x08, 0x00,
+    0x75, 0xe2, 0x48, 0x04, 0x00, 0x9e, 0x17, 0xed, 0x20, 0x01, 0xe1, 0x28, 0xbc, 0x25, 0xef, 0x21,
+    0x01, 0xae, 0xe8, 0x14, 0x13, 0x05, 0xe6, 0x04, 0xdd, 0x04, 0x87, 0x04, 0xb1, 0x03, 0xaa, 0x03,
+    0x9e, 0x03, 0x83, 0x03, 0x64, 0x03, 0x4e, 0x03, 0xea, 0x02, 0xd9, 0x02, 0xa7, 0x02, 0x66, 0x02,
+    0x96, 0x01, 0x06, 0x01, 0x4e, 0x00, 0x47, 0x00, 0x37, 0x00, 0x28, 0x00, 0xf9, 0x48, 0x04, 0x00,
+    0xd8, 0x25, 0x6c, 0x69, 0x6d, 0x61, 0x66, 0xf8, 0x28, 0x59, 0x03, 0xf8, 0x40, 0x06, 0x02, 0xf5,
+    0x28, 0x0e, 0x0d, 0xe9, 0x20, 0x01, 0x6e, 0xf5, 0x28, 0x0b, 0x0d, 0x76, 0x72, 0x65, 0xf3, 0x28,
+    0x44, 0x14, 0x75, 0xe5, 0x21, 0x01, 0xae, 0xe8, 0x13, 0xa7, 0x00, 0x8f, 0x0e, 0xa3, 0x00, 0x95,
+    0x00, 0x8f, 0x00, 0xb6, 0x21, 0x89, 0x00, 0x7f, 0x00, 0x75, 0x00, 0x6f, 0x00, 0x67, 0x00, 0x43,
+    0x19, 0x5b, 0x00, 0x4f, 0x00, 0x3e, 0x00, 0x32, 0x00, 0x8a, 0x20, 0x2c, 0x00, 0x26, 0x00, 0xfa,
+    0x48, 0x41, 0x26, 0x34, 0x26, 0xf9, 0x48, 0x3b, 0x26, 0x43, 0x26, 0xf5, 0xa8, 0x50, 0x26, 0x08,
+    0x26, 0x2b, 0x25, 0x1a, 0x25, 0x2d, 0x26, 0xf4, 0xe8, 0x07, 0x43, 0x26, 0x18, 0x26, 0xed, 0x24,
+    0x0d, 0x25, 0x30, 0x26, 0x59, 0x24, 0xbc, 0x25, 0xf3, 0x68, 0xee, 0x25, 0x06, 0x00, 0x78, 0x23,
+    0xe9, 0x29, 0x2b, 0x0b, 0xf2, 0xa8, 0xa6, 0x24, 0xda, 0x25, 0x02, 0x25, 0x9f, 0x21, 0x25, 0x26,
+    0xef, 0x68, 0xf3, 0x25, 0xf8, 0x25, 0xc6, 0x1a, 0xee, 0x48, 0xf8, 0x25, 0xbd, 0x24, 0xec, 0x88,
+    0x0d, 0x26, 0xb7, 0x24, 0xe5, 0x25, 0x86, 0x25, 0xeb, 0x88, 0x50, 0x23, 0xf0, 0x25, 0x74, 0x25,
+    0x48, 0x23, 0xe9, 0x48, 0x78, 0x24, 0x6a, 0x25, 0xe7, 0x48, 0xc6, 0x25, 0xcb, 0x25, 0xe5, 0xc8,
+    0xc0, 0x25, 0x3a, 0x23, 0xa8, 0x25, 0x97, 0x24, 0xda, 0x25, 0x5e, 0x25, 0xe4, 0x28, 0xc4, 0x25,
+    0xe1, 0x48, 0x04, 0x00, 0xc0, 0x25, 0xad, 0x28, 0x55, 0x25, 0xf4, 0xa0, 0x61, 0x43, 0x3b, 0x30,
+    0x05, 0xf3, 0x60, 0x16, 0x0a, 0x03, 0x72, 0x69, 0x66, 0xf9, 0x28, 0xab, 0x18, 0xef, 0x40, 0x06,
+    0x02, 0xec, 0x28, 0xba, 0x03, 0xe8, 0x28, 0x7e, 0x1b, 0xe9, 0x20, 0x01, 0x78, 0x65, 0x74, 0xee,
+    0x48, 0xad, 0x20, 0x04, 0x00, 0xf3, 0x20, 0x01, 0xe5, 0x28, 0xa4, 0x20, 0x6f, 0x69, 0x2d, 0x61,
+    0x6c, 0x6c, 0x69, 0xfa, 0x28, 0x68, 0x24, 0x68, 0x67, 0x69, 0x6e, 0xeb, 0x28, 0x9c, 0x02, 0xe5,
+    0x40, 0x16, 0x02, 0x6e, 0x72, 0x65, 0x74, 0x6e, 0xe9, 0x40, 0x02, 0x07, 0x65, 0x68, 0xf4, 0x20,
+    0x01, 0x66, 0x6f, 0xe4, 0x28, 0x7b, 0x04, 0x65, 0x77, 0xf3, 0x28, 0x6b, 0x03, 0x63, 0xe5, 0x40,
+    0x0a, 0x02, 0x72, 0x69, 0x64, 0x65, 0xf2, 0x28, 0xa4, 0x1e, 0x6a, 0x6f, 0x72, 0x70, 0x61, 0x72,
+    0x6f, 0x64, 0x65, 0x66, 0xae, 0x68, 0xb1, 0x23, 0x06, 0x00, 0x0c, 0x00, 0x67, 0x74, 0x73, 0xae,
+    0x20, 0x01, 0x73, 0xef, 0x20, 0x01, 0xae, 0x28, 0xd7, 0x0d, 0xf3, 0xe8, 0x0b, 0xbb, 0x00, 0xad,
+    0x00, 0x95, 0x00, 0x83, 0x00, 0xb7, 0x1e, 0x7b, 0x00, 0x76, 0x00, 0x35, 0x00, 0x27, 0x00, 0x16,
+    0x00, 0x85, 0x22, 0x74, 0x6e, 0x65, 0x6d, 0x68, 0x63, 0x61, 0x74, 0x74, 0x61, 0xef, 0x20, 0x01,
+    0xed, 0x28, 0xee, 0x24, 0xf3, 0x48, 0x04, 0x00, 0x98, 0x0c, 0x61, 0x2d, 0x73, 0x6b, 0xe3, 0x28,
+    0x82, 0x20, 0x6e, 0xe4, 0xe8, 0x0b, 0x36, 0x00, 0xf3, 0x00, 0x7e, 0x0b, 0xd1, 0x24, 0x2e, 0x00,
+    0x29, 0x00, 0x1e, 0x00, 0x4e, 0x10, 0x1a, 0x00, 0x16, 0x00, 0x64, 0x23, 0xf4, 0x28, 0x9f, 0x24,
+    0xf2, 0x28, 0x77, 0x05, 0x6e, 0x79, 0xe4, 0x21, 0x01, 0xae, 0x48, 0x59, 0x0b, 0x92, 0x24, 0x6d,
+    0xef, 0x28, 0xdc, 0x1f, 0x6b, 0xe3, 0x20, 0x01, 0xf5, 0x28, 0x20, 0x22, 0xad, 0x20, 0x01, 0xf7,
+    0x28, 0x2e, 0x24, 0x6c, 0xf4, 0x28, 0xeb, 0x20, 0x6b, 0x6f, 0x6f, 0x62, 0xad, 0x28, 0x8c, 0x01,
+    0x65, 0x69, 0x72, 0x66, 0x6f, 0x74, 0x61, 0x74, 0x6f, 0x70, 0x68, 0xe3, 0x20, 0x01, 0xf5, 0x28,
+    0x8f, 0x24, 0xe4, 0x40, 0x0b, 0x02, 0x79, 0xec, 0x20, 0x01, 0x69, 0xed, 0x28, 0xb6, 0x1a, 0x69,
+    0x6b, 0x63, 0x65, 0xf4, 0x20, 0x01, 0xae, 0x28, 0xfc, 0x14, 0xe2, 0x40, 0x06, 0x02, 0xe2, 0x28,
+    0xff, 0x01, 0x61, 0x6c, 0xe6, 0x28, 0x43, 0x02, 0xe1, 0x40, 0x08, 0x02, 0x6e, 0x79, 0xed, 0x28,
+    0xaf, 0x0c, 0x69, 0x6c, 0xe1, 0x48, 0x2e, 0x12, 0xa0, 0x11, 0xf2, 0x60, 0x14, 0x08, 0x03, 0x76,
+    0xe4, 0x28, 0xc8, 0x20, 0x67, 0xed, 0x20, 0x01, 0x74, 0xf2, 0x20, 0x01, 0xe5, 0x28, 0x44, 0x24,
+    0xe5, 0x60, 0x21, 0x12, 0x03, 0x73, 0x75, 0x2d, 0x78, 0x75, 0xee, 0x20, 0x01, 0xe9, 0x20, 0x01,
+    0xec, 0x28, 0x57, 0x01, 0x70, 0x70, 0x65, 0x70, 0x74, 0xe5, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xf7,
+    0x28, 0xad, 0x23, 0x67, 0xe1, 0x20, 0x01, 0xf4, 0x28, 0xc2, 0x1f, 0xf0, 0x60, 0x26, 0x10, 0x03,
+    0x74, 0xe6, 0x48, 0x04, 0x00, 0x83, 0x23, 0xe5, 0x48, 0x9e, 0x0a, 0xa9, 0x0a, 0xef, 0x48, 0x0e,
+    0x13, 0x04, 0x00, 0x74, 0x6b, 0x73, 0xe5, 0x20, 0x01, 0xe4, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xe5,
+    0x28, 0x88, 0x22, 0xe9, 0x48, 0x67, 0x23, 0x04, 0x00, 0xe6, 0x28, 0xb6, 0x09, 0xef, 0x40, 0x09,
+    0x02, 0x74, 0xf0, 0x48, 0x5a, 0x20, 0xd1, 0x22, 0x6a, 0x6f, 0xe4, 0x28, 0x1a, 0x11, 0xee, 0x80,
+    0x1f, 0x17, 0x09, 0x04, 0x70, 0xf6, 0x28, 0x88, 0x20, 0xef, 0x48, 0xba, 0x0b, 0x04, 0x00, 0x72,
+    0xf6, 0x20, 0x01, 0xe9, 0x28, 0x66, 0x1f, 0x69, 0x62, 0x70, 0x74, 0xf4, 0x28, 0xab, 0x22, 0x61,
+    0xe6, 0xc0, 0x3b, 0x36, 0x31, 0x2d, 0x0f, 0x06, 0xf8, 0x20, 0x01, 0xef, 0x20, 0x01, 0xf3, 0x20,
+    0xc9, 0xf3, 0x60, 0x15, 0x0c, 0x03, 0xf4, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xf0, 0x20, 0xbb, 0x6e,
+    0x69, 0x75, 0xf2, 0x20, 0x01, 0xe2, 0x20, 0xb2, 0x63, 0x69, 0x74, 0x6c, 0xe5, 0x20, 0xa8, 0xec,
+    0x28, 0x0f, 0x23, 0x65, 0xe7, 0x28, 0x09, 0x0d, 0x63, 0xe6, 0x28, 0xd7, 0x20, 0x62, 0xec, 0x28,
+    0x7a, 0x23, 0xed, 0x40, 0x0d, 0x02, 0x65, 0x64, 0x6f, 0x6d, 0x2d, 0x65, 0x6c, 0xe2, 0x28, 0xfa,
+    0x20, 0x61, 0x63, 0x73, 0xf3, 0x28, 0xfb, 0x08, 0xec, 0x68, 0x12, 0x00, 0x06, 0x00, 0x52, 0x10,
+    0x6c, 0x61, 0x77, 0x65, 0x72, 0x69, 0xe6, 0x48, 0x1c, 0x10, 0xbe, 0x22, 0xe9, 0x48, 0x52, 0x19,
+    0x04, 0x00, 0x76, 0xe5, 0x28, 0x51, 0x01, 0xeb, 0x68, 0x0d, 0x00, 0x2f, 0x22, 0x06, 0x00, 0xee,
+    0x20, 0x01, 0xf5, 0x28, 0x47, 0x23, 0x65, 0x65, 0xe7, 0x20, 0x01, 0x2d, 0xe1, 0x48, 0x3f, 0x01,
+    0x7a, 0x10, 0x67, 0x6f, 0x6c, 0x62, 0x79, 0xed, 0x20, 0x01, 0xe4, 0x28, 0x65, 0x07, 0xe6, 0x20,
+    0x01, 0x65, 0xe8, 0x20, 0x32, 0xe5, 0xe8, 0x08, 0x25, 0x23, 0xce, 0x00, 0xbc, 0x00, 0xa3, 0x00,
+    0x82, 0x00, 0x6b, 0x00, 0x37, 0x00, 0x10, 0x00, 0xf4, 0x40, 0x12, 0x02, 0x69, 0xf3, 0x48, 0x04,
+    0x00, 0xd8, 0x22, 0x2d, 0x79, 0xe2, 0x20, 0x01, 0xe2, 0x28, 0xdb, 0x21, 0x61, 0x64, 0x69, 0x64,
+    0xee, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xe3, 0x20, 0x01, 0xad, 0x20, 0x01, 0xe1, 0x20, 0xef, 0xf2,
+    0x60, 0x1f, 0x1a, 0x03, 0x75, 0x63, 0x65, 0x73, 0x2d, 0x37, 0x37, 0x6e, 0x64, 0x63, 0x2e, 0x6e,
+    0x69, 0x67, 0x69, 0x72, 0x6f, 0x2e, 0x6c, 0xf3, 0x28, 0x45, 0x22, 0x69, 0xf7, 0x28, 0x28, 0x22,
+    0x65, 0x68, 0x77, 0x6f, 0x6e, 0x67, 0x6e, 0x69, 0x6f, 0x67, 0x79, 0x6c, 0xe4, 0x20, 0x01, 0xec,
+    0x28, 0x75, 0x21, 0xee, 0x40, 0x0d, 0x02, 0x75, 0x6d, 0x61, 0xae, 0x20, 0x01, 0x65, 0xec, 0x28,
+    0x68, 0x1d, 0x6f, 0xfa, 0x20, 0x01, 0xe4, 0x28, 0x33, 0x1e, 0xed, 0x60, 0x17, 0x0f, 0x03, 0x6f,
+    0x68, 0x72, 0x75, 0x6f, 0xf9, 0x20, 0x01, 0xf3, 0x28, 0x45, 0x08, 0x61, 0xe7, 0x20, 0x01, 0xe5,
+    0x28, 0x11, 0x09, 0x2d, 0xed, 0x20, 0x01, 0xef, 0x28, 0x00, 0x21, 0xec, 0x40, 0x08, 0x02, 0x70,
+    0x6f, 0x65, 0xf0, 0x20, 0x40, 0x61, 0x73, 0x2d, 0x34, 0xad, 0x20, 0x01, 0x66, 0xe6, 0x20, 0x01,
+    0xf5, 0x28, 0x4f, 0x21, 0x67, 0x72, 0x6f, 0xe6, 0x40, 0x06, 0x02, 0xf0, 0x28, 0x4d, 0x08, 0xec,
+    0x20, 0x01, 0xef, 0x28, 0xef, 0x21, 0x63, 0x69, 0xee, 0x20, 0x4c, 0xe4, 0xa0, 0x45, 0x2e, 0x28,
+    0x23, 0x05, 0x75, 0x6f, 0x6c, 0xe3, 0x40, 0x06, 0x02, 0xed, 0x28, 0x85, 0x1f, 0x61, 0x72, 0x66,
+    0x6e, 0xe9, 0x20, 0x01, 0x61, 0x72, 0xef, 0x20, 0x01, 0xe4, 0x20, 0x01, 0xe5, 0x28, 0xae, 0x20,
+    0x6f, 0x6f, 0xe7, 0x20, 0x22, 0x6e, 0x75, 0x6f, 0xe6, 0x20, 0x23, 0xe5, 0x40, 0x09, 0x02, 0x76,
+    0xe1, 0x20, 0x01, 0xf3, 0x20, 0x18, 0x73, 0x75, 0x66, 0x6e, 0x6f, 0xe3, 0x20, 0x01, 0xf3, 0x28,
+    0xf7, 0x21, 0x61, 0xe2, 0x20, 0x01, 0x2d, 0x79, 0x72, 0x65, 0xf6, 0x20, 0x01, 0xad, 0x28, 0x39,
+    0x0f, 0x62, 0x65, 0x77, 0x2d, 0x6c, 0xec, 0x28, 0x9a, 0x12, 0xe1, 0x68, 0x1a, 0x00, 0x06, 0x00,
+    0x55, 0x1e, 0xf4, 0x40, 0x0b, 0x02, 0x73, 0x69, 0x76, 0x72, 0x65, 0xf4, 0x28, 0x80, 0x21, 0x6e,
+    0x65, 0x69, 0xed, 0x28, 0xad, 0x1a, 0xf2, 0x20, 0x01, 0x65, 0x6d, 0x61, 0x63, 0x79, 0x74, 0x69,
+    0x72, 0x75, 0x63, 0xe5, 0x28, 0x1e, 0x21, 0x37, 0x37, 0x6e, 0x64, 0x63, 0x2e, 0xe3, 0x29, 0x98,
+    0x21, 0x65, 0x62, 0x6d, 0xef, 0x28, 0x84, 0x21, 0x32, 0x6e, 0x30, 0x38, 0x34, 0xf1, 0x20, 0x01,
+    0xec, 0x28, 0xd3, 0x03, 0xef, 0x68, 0xf4, 0x1e, 0x77, 0x21, 0x06, 0x00, 0x6f, 0xe7, 0x21, 0x01,
+    0xae, 0x68, 0xf5, 0x1f, 0x6b, 0x0b, 0x06, 0x00, 0x74, 0x6e, 0x65, 0x74, 0x6e, 0x6f, 0xe3, 0x20,
+    0x01, 0x72, 0x65, 0xf3, 0x28, 0xdc, 0x0e, 0xee, 0xa1, 0xcf, 0xcb, 0x20, 0x1c, 0x05, 0xf5, 0x48,
+    0x04, 0x00, 0xdb, 0x18, 0x72, 0x65, 0x68, 0x63, 0xe9, 0x20, 0x01, 0xf3, 0x20, 0x01, 0xf2, 0x20,
+    0x01, 0xe5, 0x28, 0x9d, 0x1f, 0xef, 0x29, 0xd7, 0x20, 0xe9, 0xe9, 0x0b, 0x9e, 0x00, 0x9a, 0x00,
+    0x94, 0x00, 0x88, 0x00, 0x7b, 0x00, 0x50, 0x1e, 0x6c, 0x00, 0x68, 0x00, 0x53, 0x00, 0x1d, 0x00,
+    0x16, 0x00, 0x76, 0xe9, 0x48, 0xfb, 0x20, 0x12, 0x20, 0xf4, 0xe8, 0x07, 0x34, 0x1d, 0x2b, 0x00,
+    0x24, 0x00, 0x1c, 0x00, 0xab, 0x00, 0x71, 0x1f, 0x0e, 0x00, 0x73, 0x6f, 0xe8, 0x21, 0x01, 0x2e,
+    0x74, 0x66, 0x61, 0x72, 0xe3, 0x28, 0xe1, 0x04, 0x6c, 0xf5, 0x20, 0x01, 0xf3, 0x28, 0x2e, 0x06,
+    0xe8, 0x20, 0x01, 0xe7, 0x28, 0x8e, 0x14, 0x65, 0xeb, 0x20, 0x01, 0xf2, 0x28, 0xf9, 0x13, 0x72,
+    0xe5, 0x48, 0x04, 0x00, 0x0e, 0x16, 0x65, 0xee, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xe7, 0x20, 0x01,
+    0xee, 0x28, 0xb6, 0x20, 0xf0, 0x29, 0xbe, 0x06, 0xee, 0x40, 0x06, 0x02, 0xe9, 0x28, 0xd0, 0x10,
+    0xe1, 0x20, 0x01, 0xe5, 0x28, 0x4b, 0x1f, 0xeb, 0x48, 0xe0, 0x1c, 0x04, 0x00, 0x6f, 0xef, 0x48,
+    0xb0, 0x20, 0xc2, 0x20, 0xe8, 0x40, 0x06, 0x02, 0xf4, 0x28, 0x33, 0x1f, 0xf3, 0x28, 0x23, 0x16,
+    0xe4, 0x48, 0xac, 0x10, 0x09, 0x08, 0xe3, 0x28, 0x78, 0x12, 0xe2, 0x21, 0x01, 0xed, 0x20, 0x01,
+    0xf5, 0x28, 0x77, 0x0a, 0xe1, 0x28, 0xfa, 0x1d, 0xae, 0xe8, 0x0c, 0x30, 0x00, 0x20, 0x1e, 0xa1,
+    0x20, 0x12, 0x1e, 0x2c, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x61, 0x1e, 0x67,
+    0x20, 0x5f, 0x20, 0xef, 0x28, 0xaa, 0x19, 0xee, 0x28, 0x51, 0x1f, 0xed, 0x48, 0xdd, 0x0a, 0x8e,
+    0x0b, 0xec, 0x48, 0x74, 0x20, 0x6c, 0x20, 0xe9, 0x29, 0xee, 0x1d, 0xe4, 0x28, 0x47, 0x1f, 0xed,
+    0x41, 0x06, 0x02, 0xf0, 0x28, 0xf0, 0x1b, 0xae, 0xe8, 0x07, 0x14, 0x00, 0x62, 0x20, 0x5a, 0x20,
+    0x0e, 0x00, 0x55, 0x20, 0x28, 0x20, 0x20, 0x20, 0xed, 0x48, 0x42, 0x1d, 0x61, 0x20, 0xe4, 0x28,
+    0x6c, 0x1f, 0xeb, 0x21, 0x01, 0xae, 0xe8, 0x0a, 0x14, 0x00, 0x1d, 0x12, 0x3c, 0x20, 0x34, 0x20,
+    0x12, 0x05, 0x14, 0x13, 0x7f, 0x11, 0x04, 0x1e, 0x0a, 0x20, 0x2b, 0x18, 0xe7, 0x48, 0x0c, 0x20,
+    0x31, 0x20, 0xe9, 0x48, 0x39, 0x20, 0x6c, 0x1e, 0xe7, 0x21, 0x01, 0xae, 0xc8, 0x25, 0x00, 0x1f,
+    0x20, 0x14, 0x00, 0x12, 0x20, 0x0c, 0x00, 0xdf, 0x1d, 0x73, 0xe1, 0x20, 0x01, 0xe1, 0x28, 0x96,
+    0x1b, 0x6c, 0x65, 0x6e, 0x61, 0xf0, 0x21, 0x01, 0x2e, 0x6e, 0x6f, 0xed, 0x20, 0x01, 0xe5, 0x28,
+    0x00, 0x1c, 0xe1, 0x28, 0xb0, 0x03, 0xe5, 0x49, 0x04, 0x00, 0x05, 0x20, 0xae, 0xe8, 0x09, 0x6c,
+    0x1d, 0xed, 0x1f, 0x16, 0x00, 0xe5, 0x1f, 0x48, 0x0a, 0x12, 0x00, 0xad, 0x1d, 0xb3, 0x1f, 0xab,
+    0x1f, 0xee, 0x28, 0xbd, 0x0f, 0xe9, 0x28, 0x49, 0x1d, 0xe3, 0x49, 0xb5, 0x1f, 0x04, 0x00, 0x7a,
+    0x61, 0x39, 0x61, 0xb0, 0x28, 0x81, 0x20, 0xe2, 0x21, 0x01, 0xae, 0xe8, 0x24, 0x36, 0x14, 0xd5,
+    0x0e, 0xd6, 0x0a, 0x56, 0x00, 0x65, 0x0d, 0x54, 0x00, 0x52, 0x00, 0x50, 0x00, 0x4e, 0x00, 0x4c,
+    0x00, 0xd0, 0x1f, 0xa3, 0x1f, 0xb5, 0x1f, 0x1d, 0x1d, 0x8b, 0x1f, 0x4f, 0x1e, 0x83, 0x1f, 0xab,
+    0x1e, 0x7a, 0x1e, 0x47, 0x19, 0x48, 0x1b, 0x9a, 0x1e, 0xbd, 0x1f, 0xa8, 0x1f, 0xc5, 0x1f, 0x49,
+    0x1f, 0x50, 0x1f, 0xad, 0x1f, 0x41, 0x1f, 0x7e, 0x04, 0x15, 0x1d, 0x03, 0x1e, 0x13, 0x1d, 0xc4,
+    0x20, 0x48, 0x00, 0x34, 0x1c, 0xf9, 0x29, 0xaf, 0x1e, 0xb9, 0x01, 0xb8, 0x01, 0xb7, 0x01, 0xb6,
+    0x01, 0xb5, 0x01, 0xb3, 0x01, 0xe1, 0x41, 0x06, 0x02, 0xf6, 0x28, 0xbf, 0x1c, 0xae, 0x88, 0x5d,
+    0x1f, 0x4a, 0x1c, 0x50, 0x1f, 0x1d, 0x1d, 0xb7, 0x40, 0x08, 0x02, 0x72, 0x62, 0xb2, 0x28, 0xad,
+    0x17, 0x38, 0xe1, 0x20, 0x01, 0x34, 0x64, 0x35, 0x61, 0x34, 0x70, 0x72, 0xe5, 0x28, 0x17, 0x20,
+    0x36, 0x39, 0x76, 0xf1, 0x20, 0x01, 0xe8, 0x28, 0x56, 0x17, 0x35, 0x6d, 0x7a, 0xf4, 0x28, 0xcd,
+    0x14, 0x34, 0x35, 0x35, 0xf3, 0x20, 0x01, 0xe5, 0x28, 0xea, 0x15, 0xb3, 0x40, 0x55, 0x02, 0x39,
+    0x31, 0x77, 0x36, 0x6a, 0x2d, 0x2d, 0x6e, 0xf8, 0x21, 0x01, 0xae, 0xa0, 0x3a, 0x2a, 0x1e, 0x14,
+    0x05, 0xf6, 0x20, 0x01, 0xf4, 0x20, 0x01, 0x61, 0x30, 0xe3, 0x20, 0x01, 0xf5, 0x28, 0xfe, 0x1f,
+    0xed, 0x20, 0x01, 0x31, 0x71, 0x74, 0xf8, 0x28, 0xd1, 0x1f, 0xe7, 0x20, 0x01, 0xec, 0x20, 0x01,
+    0x61, 0x30, 0xe4, 0x28, 0x6f, 0x15, 0xe4, 0x48, 0x04, 0x00, 0xd5, 0x12, 0xb2, 0x20, 0x01, 0x32,
+    0x73, 0x76, 0xe3, 0x28, 0x0b, 0x1f, 0xe1, 0x20, 0x01, 0x35, 0xf7, 0x20, 0x01, 0x71, 0xed, 0x28,
+    0xb1, 0x15, 0x34, 0x34, 0x73, 0xe4, 0x28, 0x7d, 0x15, 0xb2, 0x40, 0x0c, 0x02, 0x38, 0x7a, 0x72,
+    0xe6, 0x20, 0x01, 0xb6, 0x28, 0xb7, 0x1f, 0x34, 0xf7, 0x28, 0xa7, 0x12, 0xe6, 0xe8, 0x12, 0x0e,
+    0x01, 0x04, 0x01, 0xff, 0x00, 0x4f, 0x1c, 0xfb, 0x00, 0xef, 0x00, 0x86, 0x00, 0xdf, 0x00, 0x71,
+    0x1e, 0x82, 0x00, 0x7c, 0x00, 0x51, 0x00, 0x8d, 0x01, 0x46, 0x00, 0x42, 0x00, 0x38, 0x00, 0x2d,
+    0x00, 0x24, 0x00, 0xf7, 0x21, 0x01, 0xae, 0x48, 0xf5, 0x1b, 0x67, 0x16, 0x76, 0x64, 0x37, 0x63,
+    0xeb, 0x20, 0x01, 0xe1, 0x28, 0x4d, 0x1f, 0xf4, 0x49, 0x04, 0x00, 0xc7, 0x1b, 0xae, 0x28, 0xde,
+    0x1b, 0xf2, 0x28, 0x4c, 0x18, 0xf0, 0x21, 0x01, 0xae, 0x68, 0x62, 0x1e, 0x52, 0x1e, 0x28, 0x1e,
+    0xee, 0x21, 0x01, 0xae, 0xe8, 0x08, 0xa6, 0x17, 0x21, 0x00, 0x49, 0x16, 0x1b, 0x00, 0x77, 0x1c,
+    0x10, 0x00, 0x65, 0x01, 0x16, 0x1c, 0x72, 0xe5, 0x48, 0x04, 0x00, 0xcd, 0x1d, 0xe8, 0x28, 0x73,
+    0x1c, 0xed, 0x48, 0x2c, 0x1e, 0x48, 0x09, 0xe3, 0x28, 0x18, 0x1c, 0xec, 0x48, 0x7f, 0x16, 0xf0,
+    0x1d, 0xe9, 0x28, 0x23, 0x11, 0xe3, 0x69, 0x4f, 0x17, 0x0a, 0x00, 0x06, 0x00, 0xee, 0x28, 0x9f,
+    0x1d, 0x61, 0x31, 0x70, 0x2d, 0x2d, 0x6e, 0xf8, 0x21, 0x01, 0xae, 0xe8, 0x08, 0x4c, 0x00, 0x3c,
+    0x00, 0x2b, 0x00, 0x22, 0x00, 0x88, 0x14, 0x19, 0x00, 0x15, 0x00, 0x10, 0x00, 0x7a, 0x69, 0xec,
+    0x20, 0x09, 0x70, 0xe4, 0x20, 0x2c, 0x6e, 0xe8, 0x20, 0x01, 0x61, 0xb1, 0x28, 0xca, 0x14, 0xe6,
+    0x40, 0x02, 0x1d, 0x61, 0xb1, 0x28, 0x58, 0x14, 0xe3, 0x40, 0x06, 0x02, 0xed, 0x28, 0x50, 0x14,
+    0x61, 0x76, 0x63, 0x30, 0x61, 0xe1, 0x28, 0x96, 0x1e, 0x62, 0x38, 0xec, 0x20, 0x01, 0xe5, 0x20,
+    0x01, 0x61, 0xb1, 0x20, 0x01, 0xea, 0x28, 0xc5, 0x1e, 0x61, 0xb1, 0x28, 0xda, 0x1d, 0xe2, 0x49,
+    0x76, 0x11, 0x04, 0x00, 0x77, 0x61, 0xb9, 0x28, 0x8d, 0x1e, 0xe1, 0x29, 0x58, 0x15, 0x32, 0x38,
+    0xb0, 0x20, 0x06, 0x31, 0x39, 0xb8, 0x20, 0x01, 0x78, 0xe9, 0x28, 0x7e, 0x1e, 0x30, 0x66, 0x33,
+    0x72, 0x6b, 0xe3, 0x28, 0x7d, 0x14, 0xe5, 0xe8, 0x1c, 0xed, 0x0c, 0xde, 0x0c, 0xd3, 0x0c, 0xcb,
+    0x0c, 0xc2, 0x0c, 0xab, 0x0c, 0x27, 0x0c, 0x62, 0x0b, 0x02, 0x08, 0xb5, 0x07, 0xa9, 0x07, 0xeb,
+    0x06, 0xcd, 0x06, 0xc0, 0x06, 0x94, 0x06, 0x19, 0x06, 0x69, 0x04, 0xbb, 0x03, 0x74, 0x1c, 0x9d,
+    0x03, 0x00, 0x03, 0xeb, 0x01, 0xde, 0x00, 0xc8, 0x00, 0x58, 0x00, 0x4d, 0x00, 0x49, 0x00, 0x38,
+    0x00, 0xf9, 0x21, 0x01, 0xae, 0xc8, 0x56, 0x1d, 0x4e, 0x1d, 0x46, 0x1d, 0x16, 0x1b, 0x1c, 0x1d,
+    0x14, 0x1d, 0xf8, 0x28, 0x65, 0x18, 0xf7, 0x48, 0x04, 0x00, 0x32, 0x1d, 0x6b, 0xe3, 0x28, 0x87,
+    0x1d, 0xf6, 0xa9, 0x2b, 0x00, 0x8c, 0x19, 0x24, 0x00, 0x0a, 0x00, 0x74, 0x09, 0xe9, 0x68, 0x11,
+    0x00, 0xcc, 0x13, 0x06, 0x00, 0x73, 0x73, 0x65, 0x72, 0xe7, 0x20, 0x01, 0xef, 0x28, 0x3e, 0x1c,
+    0xec, 0x21, 0x01, 0xae, 0x28, 0x08, 0x07, 0x65, 0x33, 0x67, 0xe5, 0x28, 0xe4, 0x13, 0xae, 0xe8,
+    0x0d, 0x3c, 0x00, 0x34, 0x00, 0x2b, 0x00, 0xfe, 0x14, 0x0b, 0x1d, 0x03, 0x1d, 0x25, 0x00, 0xf8,
+    0x14, 0x21, 0x00, 0x1a, 0x00, 0x1c, 0x1b, 0xd1, 0x1c, 0xc9, 0x1c, 0xf3, 0x20, 0x01, 0xf4, 0x28,
+    0xf7, 0x14, 0xf2, 0x28, 0xac, 0x0e, 0xed, 0x48, 0xd4, 0x19, 0xf3, 0x07, 0xe3, 0x20, 0x01, 0xe5,
+    0x48, 0xc9, 0x1c, 0xea, 0x1c, 0xe2, 0x68, 0x28, 0x16, 0x99, 0x16, 0x96, 0x1c, 0xb2, 0x28, 0x95,
+    0x19, 0xf5, 0x48, 0xaa, 0x1c, 0x04, 0x00, 0x71, 0xe9, 0x40, 0x09, 0x02, 0xf4, 0x20, 0x01, 0xf5,
+    0x28, 0x85, 0x1b, 0xee, 0x28, 0xbb, 0x11, 0xf4, 0xc8, 0xe2, 0x00, 0x1d, 0x00, 0xf4, 0x1a, 0xbe,
+    0x14, 0x12, 0x00, 0x0c, 0x00, 0x75, 0x74, 0xe9, 0x28, 0x9a, 0x12, 0xf4, 0x48, 0x04, 0x00, 0xda,
+    0x08, 0x69, 0xef, 0x28, 0x8a, 0x18, 0x69, 0xf3, 0x41, 0x0a, 0x02, 0x62, 0xe5, 0x20, 0x01, 0xf7,
+    0x29, 0x0b, 0x1b, 0xae, 0xe8, 0x0a, 0xaa, 0x00, 0x7f, 0x00, 0x72, 0x00, 0x5b, 0x00, 0x49, 0x00,
+    0x37, 0x00, 0x29, 0x00, 0x1a, 0x00, 0x14, 0x00, 0xbd, 0x1b, 0x78, 0x75, 0xec, 0x28, 0x03, 0x11,
+    0xf4, 0x40, 0x06, 0x02, 0xf3, 0x28, 0x5b, 0x0b, 0xe8, 0x20, 0x01, 0xf2, 0x28, 0xe1, 0x1b, 0xf3,
+    0x20, 0x01, 0x70, 0xf6, 0x20, 0x01, 0xf4, 0x20, 0x01, 0xf3, 0x28, 0x78, 0x12, 0xee, 0x40, 0x09,
+    0x02, 0xef, 0x20, 0x01, 0xf9, 0x28, 0x3c, 0x1c, 0xe5, 0x20, 0x01, 0xf9, 0x28, 0x23, 0x1c, 0x6c,
+    0x61, 0x69, 0x63, 0x6f, 0xf3, 0x20, 0x01, 0xee, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xf0, 0x28, 0x33,
+    0x1c, 0xeb, 0x40, 0x07, 0x02, 0x77, 0xee, 0x28, 0xb4, 0x1a, 0x72, 0x6f, 0x77, 0x74, 0x65, 0x6e,
+    0x6f, 0xe9, 0x20, 0x01, 0xec, 0x28, 0x6b, 0x0f, 0x68, 0x73, 0x6d, 0x72, 0x6f, 0x66, 0x74, 0x61,
+    0xec, 0x20, 0x01, 0xf0, 0x02, 0xe5, 0x88, 0x86, 0x13, 0x23, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x77,
+    0x69, 0xee, 0x28, 0xb9, 0x1a, 0xf2, 0x40, 0x0b, 0x02, 0x6f, 0x63, 0xe5, 0x20, 0x01, 0xf6, 0x28,
+    0x5f, 0x1b, 0x65, 0xf4, 0x20, 0x01, 0xee, 0x28, 0xdf, 0x1b, 0x6e, 0x69, 0xec, 0x28, 0xb2, 0x03,
+    0x61, 0x72, 0xe5, 0x20, 0x01, 0x64, 0x75, 0x6f, 0xec, 0x20, 0x28, 0xe1, 0x48, 0x2d, 0x19, 0x04,
+    0x00, 0x74, 0xf3, 0x40, 0x06, 0x02, 0xec, 0x28, 0x75, 0x1b, 0xe5, 0x41, 0x09, 0x02, 0xec, 0x20,
+    0x01, 0xe1, 0x28, 0x9e, 0x19, 0xae, 0x20, 0x01, 0x65, 0x74, 0x75, 0x70, 0xed, 0x20, 0x01, 0xef,
+    0x20, 0x01, 0xe3, 0x02, 0xf3, 0xc1, 0x28, 0x20, 0x16, 0x0e, 0x0a, 0x06, 0xf5, 0x28, 0x87, 0x1a,
+    0xf2, 0x28, 0x83, 0x1a, 0xee, 0x20, 0x01, 0x65, 0xf3, 0x28, 0x1a, 0x02, 0xe9, 0x48, 0x73, 0x19,
+    0x04, 0x00, 0xf5, 0x28, 0x5f, 0x17, 0xe1, 0x68, 0x7a, 0x1b, 0x19, 0x10, 0xc7, 0x16, 0xae, 0xe8,
+    0x18, 0xd2, 0x00, 0xbd, 0x00, 0xb9, 0x00, 0x9f, 0x00, 0x47, 0x1b, 0x98, 0x00, 0x94, 0x00, 0x90,
+    0x00, 0x86, 0x00, 0x7c, 0x00, 0x56, 0x1a, 0x76, 0x00, 0x62, 0x00, 0x81, 0x1b, 0x5c, 0x00, 0x4d,
+    0x00, 0x3e, 0x00, 0x3a, 0x00, 0xd1, 0x18, 0x37, 0x00, 0xcf, 0x18, 0x30, 0x00, 0xfb, 0x1a, 0xf0,
+    0x17, 0xf8, 0x21, 0x01, 0x75, 0xf6, 0x20, 0x90, 0xf6, 0x20, 0x49, 0xf4, 0x29, 0x11, 0x1b, 0xf3,
+    0x49, 0x02, 0x19, 0x04, 0x00, 0x79, 0x73, 0xf0, 0x20, 0x01, 0xef, 0x28, 0xeb, 0x19, 0xf2, 0x21,
+    0x01, 0x6f, 0x77, 0x65, 0x62, 0x64, 0x6c, 0x75, 0x6f, 0xe3, 0x28, 0x27, 0x0d, 0xf0, 0x49, 0x76,
+    0x1a, 0xa7, 0x1a, 0xee, 0x21, 0x01, 0x6d, 0x79, 0x67, 0x73, 0x6b, 0x75, 0x72, 0xe2, 0x20, 0x01,
+    0xf2, 0x20, 0x01, 0xf5, 0x28, 0x53, 0x17, 0xed, 0x49, 0xf6, 0x1a, 0x12, 0x1b, 0xeb, 0x21, 0x01,
+    0xf3, 0x20, 0x01, 0xe8, 0x28, 0x87, 0x19, 0xe9, 0x21, 0x01, 0xf4, 0x20, 0x01, 0xf2, 0x28, 0xed,
+    0x0f, 0xe8, 0x29, 0x79, 0x19, 0xe7, 0x29, 0xe8, 0x1a, 0xe6, 0x21, 0x01, 0xee, 0x28, 0xd1, 0x1a,
+    0xe4, 0x49, 0xbe, 0x1a, 0x04, 0x00, 0xee, 0x48, 0x3b, 0x03, 0x04, 0x00, 0x75, 0x62, 0x72, 0x6f,
+    0x66, 0x6c, 0x61, 0xee, 0x20, 0x01, 0x75, 0xed, 0x20, 0x0e, 0xe3, 0x29, 0xd1, 0x1a, 0xe2, 0x41,
+    0x0e, 0x02, 0x72, 0x6f, 0xe6, 0x20, 0x01, 0xed, 0x20, 0x01, 0xef, 0x28, 0x39, 0x16, 0x69, 0xe2,
+    0x28, 0x40, 0x19, 0xe1, 0x41, 0x0d, 0x02, 0x64, 0x69, 0x73, 0xee, 0x20, 0x01, 0x69, 0xed, 0x28,
+    0xac, 0x09, 0x62, 0x61, 0x70, 0xae, 0x28, 0x78, 0x14, 0xf2, 0xe9, 0x08, 0x92, 0x00, 0x70, 0x00,
+    0x6c, 0x00, 0x8e, 0x00, 0xf5, 0x0f, 0x45, 0x00, 0x38, 0x00, 0x10, 0x00, 0xf5, 0x88, 0x22, 0x00,
+    0x78, 0x10, 0x0c, 0x00, 0x08, 0x00, 0xfa, 0x28, 0x85, 0x1a, 0xf4, 0x40, 0x0c, 0x02, 0xee, 0x20,
+    0x01, 0xe5, 0x20, 0x01, 0xe3, 0x28, 0x34, 0x18, 0x69, 0xee, 0x20, 0x01, 0xf2, 0x28, 0xef, 0x0c,
+    0xe3, 0x28, 0x19, 0x15, 0xf4, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xe8, 0x28, 0x5c,
+    0x1a, 0x6f, 0x74, 0xf3, 0x21, 0x01, 0xae, 0x40, 0x0d, 0x02, 0x79, 0xe6, 0x20, 0x01, 0xec, 0x20,
+    0x01, 0xec, 0x28, 0xf8, 0x14, 0xe5, 0x40, 0x08, 0x02, 0x73, 0x61, 0xe2, 0x28, 0x22, 0x12, 0x72,
+    0x61, 0xf7, 0x20, 0x01, 0xf0, 0x28, 0x1b, 0x01, 0xe2, 0x28, 0x18, 0x1a, 0xe1, 0x60, 0x0f, 0x0b,
+    0x03, 0x77, 0xf4, 0x20, 0x01, 0xe6, 0x28, 0x93, 0x01, 0xf0, 0x28, 0x01, 0x1a, 0xe3, 0x21, 0x01,
+    0x68, 0xf4, 0x20, 0x01, 0xec, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xe5, 0x28, 0xec, 0x18, 0xae, 0x68,
+    0xe9, 0x16, 0xb5, 0x0e, 0x29, 0x13, 0xf0, 0x61, 0x0e, 0x0a, 0x03, 0xf9, 0x20, 0x01, 0xeb, 0x28,
+    0x6e, 0x19, 0xe9, 0x28, 0x03, 0x13, 0xae, 0xc8, 0xec, 0x16, 0xe4, 0x19, 0xdc, 0x19, 0xd1, 0x16,
+    0xb2, 0x19, 0xaa, 0x19, 0xee, 0x81, 0xa5, 0x84, 0x0e, 0x04, 0x72, 0x75, 0x6f, 0xe2, 0x20, 0x01,
+    0xec, 0x28, 0xce, 0x16, 0xef, 0xa1, 0x41, 0x3d, 0x33, 0x1e, 0x05, 0xfa, 0x21, 0x01, 0xae, 0x88,
+    0x0f, 0x00, 0xaa, 0x04, 0x08, 0x00, 0xf3, 0x0f, 0x6e, 0x6f, 0x74, 0xe9, 0x28, 0xa1, 0x08, 0x36,
+    0xb6, 0x28, 0x15, 0x18, 0x74, 0xf3, 0x48, 0x87, 0x17, 0x04, 0x00, 0xe5, 0x48, 0x04, 0x00, 0xae,
+    0x04, 0x67, 0xe4, 0x20, 0x01, 0xe9, 0x28, 0xff, 0x01, 0x6c, 0x61, 0x74, 0xe9, 0x20, 0x01, 0xf0,
+    0x28, 0x18, 0x17, 0xe8, 0x28, 0x11, 0x19, 0xae, 0x60, 0x20, 0x12, 0x03, 0xeb, 0x20, 0x01, 0x6e,
+    0x69, 0xec, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xed, 0x28, 0x5c, 0x18, 0xe5, 0x20, 0x01, 0x63, 0xe9,
+    0x20, 0x01, 0xf6, 0x20, 0x01, 0xf2, 0x28, 0x24, 0x14, 0x64, 0x65, 0x72, 0x6e, 0xef, 0x21, 0x01,
+    0x2e, 0x67, 0x6e, 0xe9, 0x20, 0x01, 0xe7, 0x28, 0x46, 0x18, 0xe9, 0x48, 0x04, 0x00, 0xa4, 0x16,
+    0x6c, 0x6e, 0xef, 0x21, 0x01, 0xae, 0x68, 0x06, 0x00, 0x0e, 0x00, 0x7c, 0x18, 0x65, 0x67, 0x61,
+    0x74, 0x73, 0xad, 0x20, 0x01, 0x6f, 0x72, 0xe5, 0x28, 0xff, 0x18, 0xe7, 0x20, 0x01, 0xef, 0x28,
+    0xb3, 0x02, 0xed, 0xc9, 0x40, 0x00, 0x21, 0x00, 0x2c, 0x16, 0x13, 0x00, 0x0c, 0x00, 0x7c, 0x16,
+    0xef, 0x20, 0x01, 0xf2, 0x28, 0x5a, 0x14, 0xe9, 0x48, 0x33, 0x18, 0x04, 0x00, 0x74, 0xf7, 0x20,
+    0x01, 0xef, 0x28, 0xae, 0x17, 0xe1, 0x48, 0xc9, 0x18, 0x04, 0x00, 0xee, 0x21, 0x01, 0xae, 0x40,
+    0x06, 0x02, 0x73, 0xe9, 0x20, 0x05, 0x72, 0xe5, 0x20, 0x01, 0x68, 0x2e, 0x74, 0xef, 0x20, 0x01,
+    0xe7, 0x28, 0x3c, 0x0c, 0xae, 0xe8, 0x13, 0x58, 0x01, 0x53, 0x01, 0x43, 0x01, 0x2c, 0x01, 0xb3,
+    0x16, 0x21, 0x01, 0xf9, 0x00, 0xf0, 0x00, 0xe4, 0x00, 0xd6, 0x00, 0xca, 0x00, 0xa9, 0x00, 0x8d,
+    0x00, 0x7f, 0x00, 0x67, 0x00, 0x47, 0x00, 0x3e, 0x00, 0x38, 0x00, 0x26, 0x00, 0xf9, 0x68, 0x36,
+    0x05, 0x06, 0x00, 0xf7, 0x17, 0x6f, 0x6c, 0x70, 0xe5, 0x20, 0x01, 0xe4, 0x28, 0x02, 0x12, 0xf6,
+    0x48, 0xdb, 0x08, 0x6c, 0x18, 0xf5, 0x48, 0x04, 0x00, 0x6e, 0x18, 0xe1, 0x20, 0xef, 0xf4, 0x48,
+    0x82, 0x18, 0x04, 0x00, 0xf3, 0x40, 0x09, 0x02, 0xef, 0x20, 0x01, 0xe8, 0x28, 0x02, 0x18, 0x61,
+    0xe3, 0x20, 0x01, 0x64, 0xee, 0x20, 0x01, 0xf5, 0x20, 0x01, 0xef, 0x28, 0x02, 0x18, 0xf3, 0x88,
+    0x12, 0x00, 0x0e, 0x00, 0x82, 0x0a, 0x08, 0x00, 0x75, 0x6d, 0xe8, 0x28, 0xab, 0x04, 0xee, 0x28,
+    0x08, 0x04, 0xe4, 0x28, 0xd2, 0x17, 0xf2, 0x60, 0xb8, 0x08, 0x03, 0x6f, 0xe6, 0x28, 0x98, 0x05,
+    0x69, 0xe4, 0x20, 0x75, 0xf0, 0x68, 0x09, 0x00, 0x06, 0x00, 0x54, 0x07, 0xea, 0x20, 0x9e, 0xe9,
+    0x48, 0xbe, 0x17, 0x04, 0x00, 0x73, 0x6e, 0x61, 0xf2, 0x20, 0x01, 0x74, 0xae, 0x28, 0xf6, 0x0a,
+    0xef, 0x68, 0x18, 0x00, 0x30, 0x18, 0x06, 0x00, 0xf4, 0x40, 0x06, 0x02, 0xf0, 0x28, 0x17, 0x17,
+    0xee, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xe7, 0x28, 0x5f, 0x04, 0xe2, 0x20, 0x01, 0xed, 0x28, 0xca,
+    0x16, 0x6e, 0xef, 0x20, 0x01, 0x69, 0x74, 0x61, 0x74, 0xf3, 0x28, 0x24, 0x05, 0x6b, 0x63, 0x61,
+    0xf4, 0x20, 0x01, 0xf3, 0x20, 0x01, 0x65, 0xe7, 0x28, 0xcc, 0x17, 0x68, 0x63, 0xf4, 0x20, 0x01,
+    0xe9, 0x20, 0x01, 0xec, 0x28, 0xbb, 0x17, 0xe7, 0x48, 0xf6, 0x17, 0x04, 0x00, 0xf3, 0x20, 0x3d,
+    0xe5, 0x60, 0x23, 0x0a, 0x03, 0xf0, 0x20, 0x01, 0xe3, 0x28, 0xe0, 0x17, 0xe9, 0x40, 0x2e, 0x02,
+    0x6c, 0x70, 0x61, 0xe4, 0x21, 0x01, 0x2e, 0x74, 0x73, 0x6f, 0xe8, 0x20, 0x01, 0x6c, 0xe1, 0x20,
+    0x01, 0xe3, 0x28, 0x04, 0x04, 0xe4, 0x20, 0x15, 0x64, 0x75, 0x6f, 0x6c, 0xe3, 0x20, 0x01, 0xf3,
+    0x28, 0x19, 0x15, 0xe2, 0x48, 0x73, 0x09, 0x04, 0x00, 0xe7, 0x20, 0x01, 0x2d, 0xf2, 0x20, 0x01,
+    0x61, 0x65, 0x67, 0xe5, 0x20, 0x01, 0xec, 0x28, 0x09, 0x0d, 0x61, 0x69, 0x6c, 0xe9, 0x20, 0x01,
+    0xf3, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xf2, 0x28, 0x78, 0x17, 0x36, 0xb6, 0x28, 0x85, 0x17, 0xb4,
+    0x40, 0x0c, 0x02, 0xf0, 0x48, 0x04, 0x00, 0xcb, 0x15, 0xe3, 0x28, 0x90, 0x17, 0x33, 0xb2, 0x28,
+    0x37, 0x16, 0xec, 0xe8, 0x0a, 0x69, 0x00, 0x56, 0x00, 0x4a, 0x00, 0x43, 0x00, 0x3c, 0x00, 0x36,
+    0x00, 0x21, 0x00, 0x1a, 0x00, 0x60, 0x04, 0x14, 0x00, 0x79, 0x74, 0xf3, 0x29, 0x72, 0x05, 0xf0,
+    0x20, 0x01, 0xf0, 0x28, 0x69, 0x17, 0xec, 0x40, 0x0e, 0x02, 0x65, 0x72, 0xe1, 0x20, 0x01, 0xf5,
+    0x20, 0x01, 0xf1, 0x28, 0x59, 0x17, 0x61, 0xf3, 0x28, 0xdb, 0x15, 0xe9, 0x48, 0xba, 0x14, 0xf8,
+    0x07, 0xe7, 0x21, 0x01, 0xef, 0x28, 0xf7, 0x16, 0xe4, 0x20, 0x01, 0xee, 0x28, 0xb5, 0x12, 0xe3,
+    0x40, 0x06, 0x02, 0xf2, 0x28, 0x0f, 0x0c, 0xe1, 0x28, 0x26, 0x17, 0xe2, 0x48, 0x30, 0x17, 0x04,
+    0x00, 0xe9, 0x48, 0xfd, 0x16, 0x04, 0x00, 0xe4, 0x20, 0x01, 0xf5, 0x28, 0x21, 0x17, 0xe1, 0x40,
+    0x06, 0x02, 0xf3, 0x29, 0x5a, 0x0a, 0xe4, 0x20, 0x01, 0xed, 0x28, 0x10, 0x02, 0xeb, 0x41, 0x0a,
+    0x02, 0xe9, 0x68, 0xdd, 0x16, 0xd4, 0x15, 0xe2, 0x16, 0xae, 0xa8, 0x18, 0x00, 0x12, 0x00, 0x69,
+    0x14, 0x0a, 0x00, 0xf4, 0x16, 0xef, 0x68, 0x0c, 0x10, 0x09, 0x15, 0xa9, 0x16, 0xe5, 0x48, 0xdb,
+    0x16, 0xc6, 0x16, 0xe3, 0x48, 0xe8, 0x16, 0x59, 0x16, 0xea, 0x21, 0x01, 0xae, 0x88, 0x48, 0x0c,
+    0xce, 0x16, 0xc1, 0x16, 0x8e, 0x14, 0xe9, 0x61, 0x14, 0x0d, 0x03, 0xf6, 0x48, 0x04, 0x00, 0xa0,
+    0x15, 0xe2, 0x28, 0xa2, 0x13, 0xf4, 0x20, 0x01, 0xe9, 0x28, 0x4e, 0x12, 0xae, 0x68, 0x82, 0x05,
+    0xdb, 0x0f, 0x6c, 0x16, 0xe7, 0xc9, 0xa4, 0x00, 0x31, 0x00, 0x29, 0x00, 0x13, 0x00, 0x0c, 0x00,
+    0x29, 0x01, 0xf2, 0x20, 0x01, 0xef, 0x28, 0x63, 0x15, 0x6e, 0xe1, 0x40, 0x0e, 0x02, 0x72, 0xef,
+    0x21, 0x01, 0x2e, 0xe8, 0x20, 0x01, 0xe3, 0x28, 0x50, 0x11, 0x68, 0xe3, 0x28, 0x11, 0x0a, 0x65,
+    0xec, 0x20, 0x01, 0xec, 0x28, 0x6a, 0x16, 0xe1, 0xa8, 0x03, 0x15, 0x69, 0x00, 0x0e, 0x00, 0x69,
+    0x0e, 0x0a, 0x00, 0xf9, 0x28, 0xa8, 0x14, 0xf0, 0x21, 0x01, 0xae, 0xe0, 0x08, 0x4d, 0x3d, 0x30,
+    0x27, 0x21, 0x18, 0x50, 0x08, 0xf9, 0x40, 0x09, 0x02, 0xeb, 0x20, 0x01, 0xe3, 0x28, 0xc7, 0x10,
+    0x63, 0xf6, 0x28, 0x69, 0x15, 0x74, 0x65, 0xee, 0x20, 0x01, 0xe7, 0x28, 0x3a, 0x09, 0x73, 0x6e,
+    0xe4, 0x28, 0xc4, 0x15, 0x6b, 0x73, 0xe5, 0x20, 0x01, 0xec, 0x28, 0xbb, 0x15, 0x67, 0x72, 0x65,
+    0xe2, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xe4, 0x28, 0x17, 0x16, 0xe4, 0x20, 0x01, 0x65, 0x74, 0x61,
+    0xec, 0x20, 0x01, 0xf3, 0x20, 0x01, 0xee, 0x28, 0x06, 0x06, 0xb3, 0x20, 0x01, 0x78, 0xec, 0x28,
+    0xf8, 0x14, 0x67, 0xf4, 0x20, 0x01, 0xf2, 0x28, 0xe5, 0x14, 0xae, 0xc8, 0x00, 0x16, 0xf8, 0x15,
+    0xf0, 0x15, 0x0c, 0x00, 0xc6, 0x15, 0xbe, 0x15, 0xf4, 0x48, 0xd8, 0x15, 0x04, 0x00, 0xf6, 0x28,
+    0x76, 0x15, 0xe6, 0x48, 0x04, 0x00, 0x6f, 0x09, 0xe1, 0x48, 0xd8, 0x15, 0x64, 0x15, 0xe5, 0xa1,
+    0x1c, 0x18, 0x13, 0x0f, 0x05, 0xf2, 0x48, 0x65, 0x14, 0x04, 0x00, 0xe7, 0x28, 0xc4, 0x11, 0xe7,
+    0x28, 0x8f, 0x15, 0x66, 0xe6, 0x28, 0xb9, 0x15, 0xe5, 0x28, 0x7d, 0x14, 0xae, 0xe8, 0x0a, 0x28,
+    0x00, 0xef, 0x11, 0x24, 0x00, 0xbd, 0x15, 0xed, 0x05, 0x1f, 0x00, 0x18, 0x00, 0x14, 0x00, 0x83,
+    0x15, 0x7b, 0x15, 0xf0, 0x28, 0x85, 0x03, 0xed, 0x20, 0x01, 0xef, 0x28, 0xc7, 0x0e, 0x6b, 0xe9,
+    0x28, 0xfd, 0x10, 0xe5, 0x28, 0xfc, 0x0a, 0xe2, 0x28, 0x1a, 0x09, 0xe4, 0xa9, 0x22, 0x00, 0x1c,
+    0x00, 0x0e, 0x00, 0x28, 0x07, 0x0a, 0x00, 0xef, 0x28, 0x6c, 0x16, 0xe9, 0x40, 0x06, 0x02, 0xf5,
+    0x28, 0x3f, 0x15, 0x73, 0x64, 0xef, 0x28, 0x54, 0x08, 0x61, 0x72, 0xf4, 0x29, 0x5b, 0x03, 0xae,
+    0xe8, 0x15, 0x28, 0x03, 0x1f, 0x03, 0x12, 0x03, 0x0a, 0x03, 0xdc, 0x02, 0xd1, 0x02, 0x84, 0x02,
+    0x6d, 0x02, 0x61, 0x02, 0x57, 0x02, 0x40, 0x02, 0xc2, 0x01, 0xad, 0x01, 0x98, 0x01, 0x0f, 0x01,
+    0x93, 0x00, 0x97, 0x0e, 0x83, 0x00, 0x7d, 0x00, 0x48, 0x00, 0x2a, 0x00, 0x7a, 0x74, 0x65, 0xee,
+    0x40, 0x10, 0x02, 0x73, 0x61, 0x64, 0x74, 0x72, 0x65, 0x74, 0xf4, 0x20, 0x01, 0xe5, 0x28, 0xbe,
+    0x07, 0x6d, 0x69, 0xf4, 0x20, 0x01, 0xe2, 0x28, 0xb9, 0x09, 0xf9, 0x88, 0x1a, 0x00, 0x12, 0x00,
+    0x5a, 0x14, 0x08, 0x00, 0x74, 0x69, 0x63, 0xad, 0x20, 0x01, 0xe1, 0x28, 0x94, 0x08, 0x6b, 0x73,
+    0x75, 0xf2, 0x20, 0x01, 0xe6, 0x02, 0x61, 0x77, 0x65, 0x74, 0x61, 0x67, 0xad, 0x48, 0x04, 0x00,
+    0x68, 0x14, 0x6c, 0x6c, 0x61, 0xf7, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xf2, 0x28, 0x54, 0x0a, 0x78,
+    0xe9, 0x20, 0x01, 0xb2, 0x01, 0x76, 0x72, 0x65, 0x73, 0x69, 0xad, 0x40, 0x93, 0x02, 0xf4, 0x20,
+    0x01, 0xf3, 0x28, 0xa5, 0x0f, 0xf3, 0x80, 0x75, 0x26, 0x10, 0x04, 0x73, 0x6e, 0x64, 0xe4, 0x21,
+    0x01, 0xae, 0x48, 0x91, 0x02, 0x8a, 0x02, 0x6f, 0x70, 0x65, 0x72, 0xad, 0x40, 0x09, 0x02, 0xf4,
+    0x20, 0x01, 0xe9, 0x28, 0x7c, 0x14, 0xee, 0x20, 0x01, 0xf6, 0x28, 0x33, 0x14, 0x6e, 0xe4, 0x80,
+    0x0e, 0x08, 0x04, 0x15, 0xf0, 0x28, 0x28, 0x14, 0x69, 0x73, 0x6f, 0xe3, 0x20, 0x74, 0xad, 0xa0,
+    0x38, 0x2c, 0x1d, 0x0c, 0x05, 0xf9, 0x20, 0x01, 0xe1, 0x28, 0x31, 0x0b, 0x74, 0xe5, 0x20, 0x01,
+    0xee, 0x20, 0x01, 0xf2, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xf4, 0x28, 0xa8, 0x12, 0x73, 0x65, 0x68,
+    0x63, 0xf3, 0x20, 0x01, 0x69, 0xed, 0x20, 0x01, 0xe1, 0x28, 0x3a, 0x02, 0x6e, 0x75, 0xe6, 0x20,
+    0x01, 0xe9, 0x20, 0x01, 0xe1, 0x28, 0x75, 0x14, 0xe4, 0x28, 0xc0, 0x11, 0x64, 0xad, 0x40, 0xdb,
+    0xd3, 0xf2, 0x40, 0x13, 0x02, 0x6f, 0x67, 0x69, 0x76, 0xad, 0x48, 0x04, 0x00, 0xbb, 0x13, 0xee,
+    0x20, 0x01, 0xe9, 0x28, 0x4c, 0x11, 0xe5, 0x80, 0x5a, 0x46, 0x2e, 0x04, 0x76, 0x72, 0x65, 0xf3,
+    0x68, 0x14, 0x00, 0x06, 0x00, 0x21, 0x01, 0x62, 0x65, 0x77, 0x2d, 0x65, 0x6d, 0x6f, 0xe8, 0x21,
+    0x01, 0xae, 0x28, 0xf1, 0x01, 0x2d, 0xe5, 0x40, 0x08, 0x02, 0x6d, 0x6f, 0xe8, 0x28, 0x88, 0x13,
+    0x62, 0x75, 0xe3, 0x28, 0xf3, 0x12, 0xf4, 0x60, 0x0d, 0x08, 0x03, 0x75, 0x6f, 0xf2, 0x20, 0xd5,
+    0x74, 0xf5, 0x28, 0x91, 0x01, 0x61, 0x64, 0xf0, 0x20, 0x01, 0xf5, 0x28, 0x3a, 0x01, 0x73, 0xf5,
+    0x40, 0x02, 0x05, 0xad, 0x20, 0x01, 0x6c, 0xe1, 0x20, 0x01, 0x75, 0xf4, 0x20, 0x01, 0xf2, 0x28,
+    0xf9, 0x0f, 0x6e, 0x74, 0x72, 0x61, 0x70, 0x64, 0x65, 0x65, 0x70, 0x73, 0x2e, 0x72, 0xe5, 0x20,
+    0x01, 0x6d, 0xef, 0x20, 0x01, 0x74, 0xf3, 0x28, 0xc5, 0x11, 0xf0, 0x68, 0x0f, 0x00, 0x06, 0x00,
+    0x29, 0x13, 0x69, 0x6f, 0xe7, 0x21, 0x01, 0xef, 0x28, 0x9e, 0x12, 0xe8, 0x28, 0xd2, 0x02, 0xef,
+    0x20, 0x01, 0x72, 0x70, 0x2d, 0x79, 0xf4, 0x20, 0x01, 0xe9, 0x20, 0x01, 0x6e, 0xf5, 0x20, 0x01,
+    0xed, 0x28, 0x9a, 0x13, 0xee, 0xe0, 0x07, 0x71, 0x69, 0x5d, 0x48, 0x2d, 0x0e, 0x07, 0x70, 0xf6,
+    0x48, 0x48, 0x00, 0x63, 0x01, 0x6f, 0x69, 0x74, 0x61, 0x74, 0x73, 0x6b, 0x73, 0x69, 0x64, 0xad,
+    0x20, 0x01, 0xf9, 0x20, 0x01, 0x67, 0x6f, 0xec, 0x20, 0x01, 0xef, 0x20, 0x01, 0xee, 0x20, 0x01,
+    0xf9, 0x28, 0xfc, 0x12, 0x6e, 0x6f, 0x72, 0x62, 0x6c, 0x69, 0x65, 0x68, 0x2d, 0x73, 0x68, 0x2e,
+    0x74, 0xe9, 0x20, 0x01, 0xae, 0x20, 0x01, 0xf3, 0x20, 0x01, 0x65, 0xe7, 0x28, 0x5f, 0x08, 0xe9,
+    0x40, 0x0f, 0x02, 0x6c, 0x72, 0x65, 0xe2, 0x20, 0x01, 0x2d, 0xee, 0x48, 0x0b, 0x12, 0x1b, 0x01,
+    0x65, 0xed, 0x20, 0x49, 0x65, 0x73, 0x67, 0x6e, 0x75, 0xf4, 0x20, 0x01, 0xe9, 0x28, 0xd3, 0x07,
+    0x61, 0xf7, 0x20, 0x01, 0xad, 0x28, 0xa0, 0x12, 0x2d, 0x69, 0x2d, 0x67, 0x2d, 0x6f, 0xad, 0x28,
+    0x07, 0x12, 0xed, 0x48, 0x1b, 0x13, 0x04, 0x00, 0x72, 0x6f, 0x66, 0x74, 0x74, 0x61, 0x6c, 0xf0,
+    0x20, 0x01, 0xec, 0x20, 0x01, 0xf5, 0x28, 0x86, 0x10, 0xec, 0x20, 0x01, 0xf3, 0x20, 0x01, 0xe4,
+    0x28, 0xbe, 0x0f, 0x6b, 0x65, 0x65, 0x67, 0x6e, 0x69, 0xe5, 0x20, 0x01, 0xf4, 0x20, 0x4a, 0x68,
+    0x63, 0x69, 0x65, 0x72, 0x65, 0x62, 0x73, 0x6e, 0x6f, 0x69, 0x73, 0x73, 0xf5, 0x20, 0x01, 0xeb,
+    0x20, 0x01, 0xf3, 0x28, 0x2e, 0x04, 0xe5, 0xc0, 0x40, 0x34, 0x22, 0x19, 0x0c, 0x06, 0x74, 0x69,
+    0xe5, 0x28, 0xe4, 0x01, 0x6e, 0x69, 0x68, 0x63, 0x61, 0x6d, 0xf9, 0x20, 0x01, 0xe5, 0x28, 0x56,
+    0x0e, 0x6d, 0x6f, 0xe8, 0x20, 0x01, 0xf3, 0x28, 0xb6, 0x0d, 0x6c, 0x75, 0x68, 0x63, 0x73, 0xf6,
+    0x20, 0x01, 0xf2, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xf3, 0x28, 0x6d, 0x11, 0x64, 0x61, 0x72, 0x65,
+    0x67, 0x74, 0x6d, 0x75, 0xe5, 0x28, 0x98, 0x02, 0x63, 0x61, 0x70, 0x73, 0x72, 0x65, 0xe2, 0x20,
+    0x01, 0xf5, 0x02, 0x64, 0xe5, 0x20, 0x01, 0x63, 0x61, 0x6c, 0xf0, 0x28, 0x74, 0x12, 0xe2, 0x60,
+    0x18, 0x11, 0x03, 0x76, 0x7a, 0x2d, 0x6e, 0x65, 0x6c, 0x6c, 0x65, 0x74, 0x73, 0x65, 0xe2, 0x20,
+    0x14, 0xf2, 0x20, 0x01, 0xe2, 0x28, 0x29, 0x0f, 0x6f, 0x77, 0x2d, 0x6e, 0x72, 0x65, 0x66, 0x65,
+    0x69, 0xec, 0x20, 0x01, 0x67, 0x69, 0x74, 0x73, 0xee, 0x28, 0x47, 0x09, 0x61, 0x6d, 0x69, 0xec,
+    0x20, 0x01, 0xb4, 0x01, 0xb7, 0x20, 0x01, 0x65, 0x72, 0xe1, 0x20, 0x01, 0x75, 0xf1, 0x28, 0xcf,
+    0x11, 0x34, 0x32, 0x70, 0xe9, 0x20, 0x01, 0xad, 0x20, 0x0b, 0xb1, 0x20, 0x01, 0xf3, 0x20, 0x01,
+    0x6e, 0xe4, 0x20, 0x01, 0xee, 0x20, 0x01, 0xf9, 0x28, 0x91, 0x0f, 0xe3, 0xa0, 0x8a, 0x50, 0x4c,
+    0x11, 0x05, 0x72, 0x6f, 0xe6, 0x20, 0x01, 0xf2, 0x20, 0x01, 0xe9, 0x28, 0x31, 0x12, 0xee, 0x40,
+    0x0e, 0x02, 0x65, 0x69, 0x63, 0xf3, 0x21, 0x01, 0x2e, 0x6f, 0xe2, 0x28, 0x90, 0x11, 0xe1, 0x88,
+    0x6a, 0x0f, 0x24, 0x00, 0x6e, 0x07, 0x08, 0x00, 0x72, 0x75, 0x73, 0x6e, 0xe9, 0x41, 0x11, 0x02,
+    0x73, 0x72, 0xe5, 0x20, 0x01, 0xec, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xf6, 0x28, 0xe1, 0x01, 0x65,
+    0xe6, 0x28, 0x71, 0x05, 0x69, 0xec, 0x28, 0xca, 0x0f, 0xe9, 0x29, 0x58, 0x07, 0xe1, 0x60, 0x30,
+    0x07, 0x03, 0xf3, 0x28, 0x89, 0x11, 0x70, 0xf3, 0x41, 0x08, 0x02, 0x61, 0x72, 0xf4, 0x28, 0x5f,
+    0x05, 0xae, 0x60, 0x14, 0x0c, 0x03, 0x74, 0x73, 0xe1, 0x20, 0x01, 0xe6, 0x28, 0x29, 0x11, 0x72,
+    0xe5, 0x20, 0x01, 0xe2, 0x28, 0x0d, 0x0f, 0x6c, 0x6c, 0x61, 0x34, 0xf3, 0x28, 0xb4, 0x12, 0x6c,
+    0xf0, 0x21, 0x01, 0xae, 0x28, 0x9a, 0x11, 0x30, 0x6b, 0x72, 0x62, 0x64, 0x34, 0x2d, 0x2d, 0x6e,
+    0xf8, 0x21, 0x01, 0xae, 0x80, 0x23, 0x18, 0x0d, 0x04, 0x64, 0x38, 0x6c, 0x68, 0x62, 0xe4, 0x28,
+    0x2c, 0x07, 0x63, 0x36, 0x79, 0x74, 0x64, 0x67, 0x62, 0xe4, 0x28, 0x9b, 0x11, 0x62, 0x38, 0x61,
+    0x64, 0xe2, 0x20, 0x01, 0xe5, 0x28, 0x51, 0x08, 0x61, 0x32, 0x71, 0x62, 0xe4, 0x28, 0x33, 0x12,
+    0xe2, 0x61, 0x13, 0x0b, 0x03, 0x75, 0xf4, 0x21, 0x01, 0xf5, 0x28, 0x0e, 0x10, 0x6f, 0xf2, 0x20,
+    0x01, 0xf4, 0x28, 0xf1, 0x0f, 0xae, 0xe8, 0x08, 0x22, 0x0f, 0x59, 0x00, 0x4b, 0x00, 0x3e, 0x00,
+    0x2c, 0x00, 0x28, 0x00, 0x10, 0x00, 0x81, 0x0a, 0x73, 0x6e, 0x6f, 0x69, 0x74, 0x75, 0x6c, 0x6f,
+    0x73, 0x74, 0x73, 0x6f, 0x68, 0x72, 0x65, 0x74, 0x6e, 0xe9, 0x20, 0x01, 0xae, 0x28, 0x99, 0x0f,
+    0xf0, 0x28, 0x83, 0x10, 0x6e, 0x65, 0x76, 0x75, 0x65, 0x6c, 0x75, 0x6b, 0x2e, 0x79, 0x78, 0x6f,
+    0x72, 0x70, 0xfa, 0x28, 0xe4, 0x10, 0x6c, 0x72, 0x75, 0x73, 0x6e, 0xe1, 0x20, 0x01, 0xf2, 0x20,
+    0x01, 0xf4, 0x02, 0x67, 0x6e, 0x69, 0x74, 0xf3, 0x20, 0x01, 0xef, 0x20, 0x01, 0xe8, 0x28, 0x4d,
+    0x0a, 0x65, 0x74, 0xe9, 0x20, 0x01, 0x73, 0x62, 0x65, 0xf7, 0x20, 0x01, 0xb3, 0x20, 0x01, 0xb2,
+    0x20, 0x01, 0xb1, 0x01, 0xe1, 0x49, 0x04, 0x00, 0x5b, 0x07, 0xae, 0xe8, 0x07, 0xad, 0x0e, 0xdf,
+    0x10, 0x50, 0x0e, 0xd7, 0x10, 0xd2, 0x10, 0xad, 0x10, 0x9d, 0x10, 0x37, 0x30, 0x37, 0x62, 0x30,
+    0xe5, 0x28, 0x82, 0x07, 0x34, 0x31, 0x38, 0x74, 0xf8, 0x28, 0x9d, 0x07, 0x33, 0x6d, 0x61, 0x30,
+    0x65, 0x31, 0x63, 0xf6, 0x28, 0xd9, 0x08, 0x32, 0x61, 0x36, 0x61, 0x31, 0x62, 0x36, 0x62, 0xb1,
+    0x20, 0x01, 0xe9, 0x28, 0xa8, 0x11, 0xb1, 0x60, 0x10, 0x0a, 0x03, 0x74, 0x61, 0x33, 0xeb, 0x28,
+    0x81, 0x07, 0x37, 0x61, 0xb1, 0x28, 0x44, 0x11, 0x35, 0x33, 0xf7, 0x20, 0x01, 0xec, 0x28, 0x81,
+    0x11, 0xe4, 0xe8, 0x17, 0xa3, 0x04, 0x82, 0x04, 0x79, 0x04, 0x71, 0x04, 0x6c, 0x04, 0x62, 0x04,
+    0x4e, 0x04, 0x46, 0x04, 0x2c, 0x04, 0x02, 0x04, 0xfe, 0x03, 0xf5, 0x03, 0xe8, 0x03, 0x72, 0x03,
+    0x5c, 0x03, 0x45, 0x03, 0x11, 0x03, 0x0b, 0x03, 0xc1, 0x02, 0xa1, 0x02, 0x92, 0x02, 0x35, 0x00,
+    0x2e, 0x00, 0x7a, 0x61, 0x35, 0xe3, 0x28, 0x3a, 0x11, 0x75, 0x6f, 0x6c, 0xe3, 0x21, 0x01, 0xae,
+    0xe8, 0x11, 0x12, 0x02, 0xf6, 0x01, 0xe7, 0x01, 0xdc, 0x01, 0xbe, 0x01, 0xac, 0x01, 0xa1, 0x01,
+    0x94, 0x01, 0x73, 0x01, 0x5f, 0x01, 0x2d, 0x01, 0x23, 0x01, 0x13, 0x01, 0x07, 0x01, 0x43, 0x00,
+    0x32, 0x00, 0x22, 0x00, 0x79, 0x61, 0x77, 0x6f, 0x63, 0x6e, 0xe5, 0x20, 0x01, 0xae, 0x20, 0x01,
+    0xf5, 0x28, 0xe6, 0x0f, 0x78, 0x65, 0x6c, 0x70, 0x63, 0x69, 0x66, 0xe6, 0x20, 0x01, 0xe1, 0x20,
+    0x01, 0xf2, 0x28, 0x18, 0x10, 0x77, 0x63, 0x73, 0xae, 0xc0, 0xac, 0xa2, 0x7e, 0x3a, 0x11, 0x06,
+    0x77, 0x61, 0x77, 0x2d, 0x6c, 0x70, 0xae, 0x60, 0x6c, 0x4e, 0x39, 0xf3, 0x60, 0x23, 0x0e, 0x03,
+    0x6d, 0x61, 0x2d, 0x6c, 0x6e, 0xae, 0x80, 0x5d, 0x3f, 0x38, 0x2a, 0x65, 0x63, 0x6e, 0x61, 0x74,
+    0x73, 0x6e, 0x69, 0xae, 0x48, 0x0c, 0x0c, 0x04, 0x00, 0xf6, 0x20, 0x01, 0xe9, 0x28, 0xee, 0x0e,
+    0xb8, 0x28, 0x53, 0x0b, 0x72, 0x61, 0x70, 0x2d, 0x72, 0x66, 0xae, 0xa0, 0x38, 0x26, 0x1a, 0x13,
+    0x05, 0x73, 0x38, 0xeb, 0x21, 0x01, 0x2e, 0x73, 0xe5, 0x20, 0x01, 0xe4, 0x28, 0x22, 0x0f, 0xed,
+    0x20, 0x01, 0xe8, 0x28, 0xfc, 0x0c, 0x65, 0x74, 0x69, 0x73, 0x62, 0x65, 0xf7, 0x20, 0x01, 0xad,
+    0x20, 0x13, 0x63, 0x6e, 0xe6, 0x21, 0x01, 0x2e, 0x73, 0x6e, 0x6f, 0x69, 0x74, 0xe3, 0x20, 0x01,
+    0xee, 0x28, 0x1b, 0x02, 0xb3, 0x28, 0x08, 0x0f, 0x6c, 0x61, 0x74, 0x65, 0x6d, 0x65, 0x72, 0x61,
+    0x62, 0xae, 0x40, 0x06, 0x02, 0x32, 0xad, 0x20, 0x0d, 0x31, 0xad, 0x40, 0x09, 0x02, 0x73, 0x6d,
+    0x61, 0xad, 0x28, 0xe2, 0x0e, 0x72, 0x61, 0x70, 0xad, 0x28, 0xef, 0x0d, 0x6b, 0x6f, 0x6f, 0x62,
+    0x65, 0x6c, 0xe1, 0x28, 0xcc, 0x0c, 0x67, 0x6e, 0x69, 0x6c, 0x65, 0x62, 0x61, 0x6c, 0x74, 0xf2,
+    0x20, 0x01, 0xe1, 0x20, 0x01, 0xed, 0x28, 0xc7, 0x0e, 0x75, 0x6c, 0x75, 0x6c, 0x65, 0xf4, 0x20,
+    0x01, 0xef, 0x28, 0xc1, 0x08, 0x74, 0x65, 0x6e, 0x72, 0x61, 0x78, 0x61, 0x2e, 0x31, 0xad, 0x20,
+    0x01, 0xf3, 0x28, 0xf5, 0x0e, 0x73, 0x63, 0x69, 0x74, 0xe1, 0x20, 0x01, 0xf4, 0x20, 0xae, 0xf2,
+    0x40, 0x15, 0x02, 0xef, 0x40, 0x0d, 0x02, 0x74, 0x6e, 0x65, 0x6d, 0xe5, 0x20, 0x01, 0xec, 0x28,
+    0xd8, 0x0e, 0xf0, 0x28, 0x2f, 0x0c, 0xe5, 0x40, 0x0a, 0x02, 0x70, 0x6f, 0x6c, 0x72, 0xef, 0x28,
+    0x3d, 0x0d, 0x68, 0x63, 0x6e, 0xe1, 0x20, 0x01, 0xf2, 0x20, 0x01, 0x2d, 0xee, 0x20, 0x01, 0xef,
+    0x02, 0xee, 0x40, 0x07, 0x02, 0x77, 0xef, 0x28, 0xa1, 0x0b, 0x65, 0x76, 0x75, 0x65, 0xec, 0x20,
+    0x01, 0xf5, 0x28, 0x62, 0x0a, 0xed, 0x40, 0x14, 0x02, 0x69, 0x61, 0x6c, 0x63, 0x65, 0x72, 0xae,
+    0x68, 0x58, 0x0c, 0xa4, 0x00, 0x06, 0x00, 0xf3, 0x28, 0x19, 0x0c, 0x65, 0xe4, 0x20, 0x01, 0xe1,
+    0x20, 0x01, 0xe9, 0x28, 0x16, 0x0c, 0x6c, 0x65, 0x74, 0x65, 0x6d, 0x69, 0x72, 0xf0, 0x21, 0x01,
+    0xae, 0x20, 0x83, 0x69, 0x61, 0x7a, 0xee, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xe2, 0x02, 0x67, 0x6e,
+    0x69, 0x74, 0x73, 0x6f, 0x68, 0x64, 0x6e, 0x65, 0x72, 0x74, 0xae, 0x48, 0x85, 0x0a, 0xd3, 0x09,
+    0xe5, 0x48, 0x0b, 0x06, 0x04, 0x00, 0x74, 0x69, 0x73, 0xef, 0x40, 0x0b, 0x02, 0x74, 0x6e, 0x65,
+    0x67, 0xe1, 0x20, 0x01, 0xed, 0x02, 0x69, 0x73, 0x6e, 0xe5, 0x20, 0x01, 0xf3, 0x02, 0x64, 0x72,
+    0x61, 0x79, 0xeb, 0x20, 0x01, 0xee, 0x28, 0xec, 0x01, 0x63, 0x69, 0x74, 0x73, 0x61, 0x6c, 0x65,
+    0x6a, 0xae, 0x20, 0x01, 0xf0, 0x28, 0x63, 0x0a, 0xe2, 0x40, 0x0e, 0x02, 0x65, 0x77, 0x69, 0x6c,
+    0x65, 0xeb, 0x21, 0x01, 0xae, 0x28, 0xf7, 0x03, 0x64, 0x6e, 0xe5, 0x20, 0x01, 0xf6, 0x20, 0x01,
+    0xe1, 0x28, 0x28, 0x0e, 0xe1, 0x60, 0x20, 0x13, 0x03, 0x78, 0xef, 0x21, 0x01, 0xae, 0x40, 0x06,
+    0x02, 0xee, 0x28, 0x38, 0x0e, 0xeb, 0x28, 0x7b, 0x0b, 0x74, 0x63, 0x65, 0xf0, 0x20, 0x01, 0xf3,
+    0x20, 0x01, 0xf2, 0x28, 0x9f, 0x0d, 0x62, 0x75, 0x72, 0x61, 0x2d, 0x76, 0x6e, 0x65, 0x6a, 0xae,
+    0x40, 0x0e, 0x02, 0x61, 0x62, 0x75, 0x72, 0x61, 0x2e, 0x72, 0x75, 0x65, 0xae, 0x20, 0x01, 0xb1,
+    0x20, 0x01, 0xf4, 0x28, 0xb3, 0x0c, 0xf4, 0x69, 0x1e, 0x07, 0x06, 0x00, 0xcf, 0x0c, 0x65, 0x78,
+    0x63, 0xf7, 0x28, 0x45, 0x06, 0xf3, 0x41, 0x0d, 0x02, 0xed, 0x21, 0x01, 0x6b, 0xe3, 0x20, 0x01,
+    0xf2, 0x28, 0xde, 0x0a, 0xae, 0xe8, 0x07, 0x07, 0x0a, 0xd5, 0x0d, 0xc5, 0x0d, 0xf6, 0x0b, 0x95,
+    0x0b, 0x9b, 0x0d, 0xbc, 0x05, 0xf2, 0x88, 0x25, 0x00, 0x1b, 0x00, 0x08, 0x00, 0x1a, 0x01, 0xeb,
+    0x41, 0x0b, 0x02, 0x6a, 0x68, 0x33, 0x61, 0x31, 0xe8, 0x28, 0x88, 0x0e, 0xae, 0x48, 0xa1, 0x0d,
+    0x74, 0x0d, 0x65, 0x66, 0x35, 0x30, 0x36, 0x77, 0xb4, 0x28, 0x9d, 0x04, 0xe1, 0x40, 0x0a, 0x02,
+    0x75, 0xe7, 0x20, 0x01, 0xee, 0x28, 0xbd, 0x0a, 0xe3, 0x40, 0x0a, 0x02, 0xf9, 0x20, 0x01, 0x61,
+    0xec, 0x28, 0xa9, 0x0a, 0x74, 0xe9, 0x20, 0x01, 0xe4, 0x20, 0x01, 0xe5, 0x28, 0x56, 0x09, 0xef,
+    0x48, 0xd0, 0x00, 0x9b, 0x0c, 0xee, 0x68, 0x0a, 0x00, 0x3f, 0x0c, 0x06, 0x00, 0xf5, 0x28, 0xfd,
+    0x0b, 0xe1, 0x48, 0x4d, 0x0d, 0x04, 0x00, 0xec, 0x41, 0x07, 0x02, 0x72, 0xe1, 0x28, 0xb1, 0x09,
+    0x2e, 0x63, 0x69, 0x74, 0x61, 0x74, 0xf3, 0x21, 0x01, 0xae, 0x40, 0x06, 0x02, 0xf6, 0x28, 0x42,
+    0x09, 0xf3, 0x20, 0x01, 0x65, 0xf4, 0x28, 0x68, 0x0a, 0xed, 0x21, 0x01, 0xae, 0x88, 0x33, 0x09,
+    0xe5, 0x0c, 0x0e, 0x00, 0x08, 0x00, 0xf4, 0x48, 0x45, 0x0d, 0x06, 0x0d, 0xf0, 0x28, 0xb6, 0x06,
+    0xec, 0x68, 0x0d, 0x00, 0xeb, 0x0c, 0x06, 0x00, 0xf2, 0x20, 0x01, 0xef, 0x28, 0x73, 0x0a, 0xe9,
+    0x20, 0x01, 0xf5, 0x28, 0xfc, 0x0c, 0xe9, 0xa9, 0x1f, 0x00, 0xf8, 0x0c, 0x12, 0x00, 0x9e, 0x0c,
+    0x0a, 0x00, 0x72, 0xe4, 0x20, 0x01, 0xe1, 0x28, 0x02, 0x0d, 0xef, 0x20, 0x01, 0xf2, 0x20, 0x01,
+    0xe4, 0x20, 0x01, 0xee, 0x28, 0x08, 0x0d, 0xae, 0xe8, 0x0d, 0x4b, 0x00, 0x42, 0x06, 0xc0, 0x0a,
+    0x3e, 0x00, 0x63, 0x0a, 0xea, 0x0c, 0x38, 0x00, 0x2e, 0x00, 0xf5, 0x0c, 0x25, 0x00, 0xb2, 0x0a,
+    0x1a, 0x00, 0xd5, 0x04, 0x79, 0xed, 0x21, 0x01, 0x2e, 0x73, 0xf3, 0x20, 0x01, 0xf2, 0x02, 0x73,
+    0x65, 0xf0, 0x20, 0x01, 0xee, 0x28, 0x65, 0x08, 0xf0, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xec, 0x28,
+    0x4c, 0x0b, 0xef, 0x48, 0xdf, 0x05, 0x7c, 0x0c, 0xe5, 0x20, 0x01, 0xf4, 0x20, 0x01, 0xf2, 0x20,
+    0x01, 0xef, 0x28, 0x39, 0x0b, 0xe1, 0x20, 0x01, 0xf3, 0x28, 0x97, 0x08, 0xe8, 0x68, 0x06, 0x00,
+    0x28, 0x0c, 0xad, 0x0c, 0x64, 0xb3, 0x28, 0xfd, 0x04, 0xe7, 0x21, 0x01, 0xae, 0x48, 0x54, 0x0c,
+    0x4c, 0x0c, 0xe6, 0x28, 0x7e, 0x0c, 0xe5, 0x80, 0x1e, 0x1a, 0x0f, 0x04, 0x74, 0xe9, 0x20, 0x01,
+    0xed, 0x20, 0x01, 0xe9, 0x28, 0x52, 0x0b, 0x73, 0xef, 0x20, 0x01, 0xf0, 0x20, 0x01, 0xf8, 0x28,
+    0x38, 0x0c, 0xf2, 0x29, 0xf1, 0x07, 0xed, 0x21, 0x01, 0xe2, 0x20, 0x01, 0xf5, 0x28, 0xd2, 0x0a,
+    0xe3, 0x41, 0x14, 0x02, 0x67, 0x39, 0x61, 0x32, 0x67, 0x32, 0x62, 0x30, 0x61, 0x65, 0x30, 0x63,
+    0x68, 0x63, 0xec, 0x28, 0xa8, 0x04, 0xae, 0x28, 0x02, 0x0c, 0xe2, 0x22, 0x01, 0x32, 0xe2, 0x28,
+    0x12, 0x0d, 0xe1, 0x89, 0x0f, 0x00, 0x96, 0x09, 0x1d, 0x0a, 0x08, 0x00, 0x6f, 0x6c, 0x6e, 0xf7,
+    0x28, 0x3d, 0x07, 0xae, 0x20, 0xcc, 0x39, 0x63, 0x74, 0x64, 0x76, 0x6b, 0xe3, 0x28, 0x28, 0x03,
+    0x37, 0x35, 0xf9, 0x20, 0x2c, 0x36, 0x39, 0x37, 0x75, 0xf4, 0x28, 0x98, 0x02, 0x35, 0xf8, 0x20,
+    0x01, 0x71, 0xb5, 0x28, 0xa8, 0x01, 0xb3, 0x40, 0x14, 0x02, 0xe3, 0x40, 0x0a, 0x02, 0x39, 0x6a,
+    0x72, 0x63, 0xf0, 0x28, 0xec, 0x0c, 0x34, 0x62, 0xb1, 0x28, 0x6f, 0x0c, 0x31, 0xf7, 0x20, 0x01,
+    0xf2, 0x20, 0x01, 0xf0, 0x28, 0x50, 0x0c, 0x32, 0xf5, 0x28, 0x10, 0x04, 0xe3, 0xe8, 0x14, 0x01,
+    0x03, 0xf5, 0x02, 0xc6, 0x02, 0xa8, 0x02, 0x80, 0x02, 0x2b, 0x02, 0x08, 0x02, 0x67, 0x01, 0x08,
+    0x01, 0x03, 0x01, 0xbc, 0x00, 0xa1, 0x00, 0x86, 0x00, 0x76, 0x00, 0x6a, 0x00, 0x7c, 0x03, 0x56,
+    0x00, 0x30, 0x00, 0x2c, 0x00, 0x28, 0x00, 0xf9, 0x28, 0x9c, 0x0b, 0xf7, 0x28, 0x39, 0x0b, 0xf6,
+    0x21, 0x01, 0xae, 0xe8, 0x07, 0x1b, 0x00, 0xa7, 0x0b, 0x9f, 0x0b, 0x97, 0x0b, 0x67, 0x09, 0x6d,
+    0x0b, 0x0e, 0x00, 0xf6, 0x48, 0x04, 0x00, 0x58, 0x0b, 0xe7, 0x21, 0x01, 0xae, 0x28, 0xec, 0x08,
+    0xe5, 0x20, 0x01, 0xb0, 0x01, 0xf4, 0x69, 0x06, 0x00, 0x07, 0x0b, 0xd9, 0x08, 0xae, 0x48, 0x04,
+    0x00, 0xc0, 0x06, 0xe5, 0x48, 0x75, 0x0b, 0xcb, 0x08, 0x72, 0x65, 0xec, 0x20, 0x01, 0xe3, 0x20,
+    0x01, 0xe5, 0x28, 0x44, 0x0a, 0xee, 0x69, 0x06, 0x00, 0x20, 0x0a, 0xef, 0x0a, 0xae, 0x40, 0x02,
+    0x16, 0xed, 0x28, 0xcc, 0x0a, 0xed, 0x41, 0x0a, 0x02, 0x70, 0x31, 0x61, 0x6b, 0xe3, 0x28, 0x8e,
+    0x0b, 0xae, 0x40, 0x09, 0x02, 0xef, 0x20, 0x01, 0xf3, 0x28, 0x1f, 0x0a, 0xed, 0x28, 0x4d, 0x0b,
+    0xec, 0x49, 0x04, 0x00, 0x15, 0x0a, 0xae, 0xe8, 0x07, 0x33, 0x0b, 0x23, 0x0b, 0x26, 0x0b, 0xf3,
+    0x08, 0xf9, 0x0a, 0xf1, 0x0a, 0x0e, 0x00, 0xf9, 0x28, 0x29, 0x0b, 0xe9, 0x80, 0x2b, 0x12, 0x0b,
+    0x04, 0xf4, 0x20, 0x01, 0xe9, 0x28, 0x0c, 0x0b, 0xf3, 0x20, 0x01, 0xf5, 0x28, 0x0d, 0x0b, 0xee,
+    0x60, 0x13, 0x0f, 0x03, 0x6f, 0x73, 0xe1, 0x20, 0x01, 0xee, 0x20, 0x01, 0xe1, 0x28, 0x88, 0x0a,
+    0xe9, 0x28, 0x6e, 0x09, 0xe1, 0x28, 0xf6, 0x0a, 0xec, 0x40, 0x0a, 0x02, 0x6f, 0xe8, 0x20, 0x01,
+    0xf4, 0x28, 0x77, 0x08, 0x62, 0x75, 0x70, 0x65, 0x72, 0x61, 0x6e, 0xe1, 0x20, 0x01, 0xee, 0x28,
+    0x1c, 0x0a, 0x66, 0xe4, 0x28, 0xc3, 0x09, 0xe5, 0x89, 0x14, 0x00, 0x0c, 0x00, 0xbc, 0x0a, 0x08,
+    0x00, 0xf3, 0x28, 0xb9, 0x0a, 0x62, 0xe5, 0x20, 0x01, 0xf5, 0x28, 0x52, 0x0a, 0xae, 0xe8, 0x0c,
+    0x41, 0x00, 0xc4, 0x07, 0xee, 0x06, 0x3a, 0x00, 0xbc, 0x0a, 0x25, 0x00, 0xac, 0x0a, 0x1e, 0x00,
+    0x18, 0x00, 0x7c, 0x08, 0x82, 0x0a, 0x7a, 0x0a, 0xef, 0x48, 0xc6, 0x08, 0xc2, 0x09, 0xee, 0x20,
+    0x01, 0xe9, 0x28, 0x29, 0x09, 0xec, 0x48, 0x04, 0x00, 0x90, 0x0a, 0x61, 0xe9, 0x20, 0x01, 0x63,
+    0xe9, 0x20, 0x01, 0xe6, 0x20, 0x01, 0xe6, 0x28, 0x8a, 0x0a, 0xe5, 0x20, 0x01, 0xf3, 0x28, 0xbd,
+    0x09, 0x32, 0xb1, 0x28, 0x01, 0x06, 0xe3, 0x61, 0x18, 0x0b, 0x03, 0x61, 0xb1, 0x20, 0x01, 0xec,
+    0x28, 0x6b, 0x0b, 0x30, 0x61, 0x74, 0x66, 0x37, 0x62, 0xb4, 0x20, 0x01, 0xb5, 0x28, 0x5e, 0x0b,
+    0xae, 0xe0, 0x07, 0x73, 0x65, 0x57, 0x3f, 0x2a, 0x0e, 0x07, 0xf8, 0x20, 0x01, 0xf3, 0x28, 0x43,
+    0x0a, 0xf3, 0x68, 0xb1, 0x08, 0x10, 0x00, 0x06, 0x00, 0x73, 0x65, 0x63, 0x63, 0x61, 0x70, 0xf4,
+    0x28, 0xcb, 0x08, 0x6f, 0x74, 0x6f, 0xe8, 0x20, 0x01, 0xf0, 0x28, 0x9b, 0x09, 0x72, 0x65, 0x76,
+    0x72, 0x65, 0xf3, 0x20, 0x01, 0xad, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xed, 0x20, 0x01, 0xe1, 0x28,
+    0xe0, 0x09, 0x6e, 0x77, 0x61, 0x70, 0x73, 0x2e, 0xf3, 0x20, 0x01, 0x65, 0xe3, 0x20, 0x01, 0x6e,
+    0xe1, 0x20, 0x01, 0xf4, 0x20, 0x01, 0xf3, 0x28, 0x2b, 0x08, 0xec, 0x20, 0x01, 0xe9, 0x20, 0x01,
+    0x61, 0xed, 0x20, 0x01, 0xf7, 0x28, 0x05, 0x0a, 0x67, 0x6e, 0xe9, 0x20, 0x01, 0x70, 0x70, 0xe1,
+    0x20, 0x01, 0xf2, 0x28, 0x5c, 0x07, 0x65, 0x75, 0x67, 0x61, 0x65, 0x6c, 0x79, 0x73, 0x61, 0x74,
+    0xee, 0x20, 0x01, 0xe1, 0x28, 0x67, 0x08, 0xe2, 0xa8, 0xe4, 0x09, 0xb7, 0x09, 0x1d, 0x00, 0x0e,
+    0x00, 0x0a, 0x00, 0xf3, 0x28, 0xb3, 0x08, 0x66, 0x37, 0x36, 0x61, 0xb0, 0x20, 0x01, 0x63, 0x37,
+    0x79, 0x6c, 0xf1, 0x28, 0x91, 0x0a, 0xe3, 0x28, 0x6f, 0x08, 0xe1, 0x41, 0x3b, 0x02, 0x33, 0x61,
+    0x30, 0x39, 0x2d, 0x2d, 0x6e, 0xf8, 0x21, 0x01, 0xae, 0xa0, 0x24, 0x1b, 0x0d, 0x09, 0x05, 0xf5,
+    0x28, 0x5c, 0x0a, 0xf4, 0x28, 0xe7, 0x01, 0xe8, 0x40, 0x15, 0x02, 0xfa, 0x20, 0x01, 0xe1, 0x20,
+    0x01, 0xb0, 0x28, 0x86, 0x0a, 0x67, 0xf6, 0x20, 0x01, 0x61, 0xb1, 0x28, 0xe0, 0x01, 0x63, 0x61,
+    0xb1, 0x20, 0x01, 0xef, 0x28, 0x77, 0x0a, 0xae, 0xe8, 0x07, 0x72, 0x09, 0x6a, 0x09, 0x62, 0x09,
+    0x0e, 0x00, 0x32, 0x07, 0x38, 0x09, 0x30, 0x09, 0xf2, 0x20, 0x01, 0xf2, 0x28, 0xbd, 0x06, 0x39,
+    0x6a, 0xf2, 0x40, 0x18, 0x02, 0xe3, 0x60, 0x11, 0x0a, 0x03, 0xf3, 0x20, 0x01, 0xb2, 0x28, 0x4d,
+    0x0a, 0xe8, 0x20, 0x01, 0xb3, 0x28, 0x46, 0x0a, 0xe5, 0x20, 0x27, 0xe2, 0x60, 0x17, 0x6f, 0x03,
+    0xb9, 0x20, 0x01, 0xf3, 0x28, 0x37, 0x0a, 0xb8, 0x40, 0x12, 0x02, 0x63, 0x39, 0xea, 0x20, 0x01,
+    0x72, 0xe2, 0x20, 0x01, 0xb2, 0x20, 0x01, 0xe8, 0x28, 0x23, 0x0a, 0x34, 0x78, 0x78, 0xb2, 0x20,
+    0x01, 0xe7, 0x28, 0x19, 0x0a, 0xb4, 0x80, 0x23, 0x1b, 0x14, 0x04, 0x65, 0x72, 0x64, 0x35, 0x61,
+    0x39, 0x62, 0x31, 0x6b, 0xe3, 0x20, 0x01, 0xe2, 0x28, 0x03, 0x0a, 0x62, 0x79, 0x6a, 0xb9, 0x28,
+    0x3d, 0x09, 0x61, 0xb1, 0x20, 0x01, 0xe5, 0x28, 0xf4, 0x09, 0x34, 0x75, 0x62, 0xb1, 0x20, 0x01,
+    0xeb, 0x28, 0xc7, 0x09, 0x32, 0x65, 0x39, 0x63, 0x32, 0xe3, 0x20, 0x01, 0xfa, 0x28, 0xd2, 0x09,
+    0xb1, 0x40, 0x06, 0x02, 0xe8, 0x28, 0x05, 0x09, 0x31, 0xf1, 0x20, 0x01, 0xb5, 0x28, 0xe8, 0x08,
+    0xe2, 0xe8, 0x10, 0x54, 0x01, 0x35, 0x01, 0x2d, 0x01, 0x11, 0x01, 0xef, 0x00, 0xe4, 0x00, 0xc6,
+    0x00, 0x93, 0x00, 0x8d, 0x00, 0x7d, 0x00, 0x8d, 0x08, 0x6b, 0x00, 0x68, 0x00, 0x51, 0x00, 0x28,
+    0x00, 0x20, 0x00, 0x77, 0x70, 0x2d, 0x67, 0x6e, 0xf5, 0x20, 0x31, 0xf5, 0x40, 0x09, 0x02, 0xf0,
+    0x21, 0x01, 0xae, 0x28, 0xcf, 0x07, 0x6c, 0xe3, 0x41, 0x09, 0x02, 0xf3, 0x20, 0x01, 0xed, 0x28,
+    0xdf, 0x04, 0xae, 0x68, 0x06, 0x00, 0xed, 0x06, 0xbf, 0x07, 0xe5, 0x20, 0x01, 0xec, 0x20, 0x01,
+    0xe5, 0x28, 0x02, 0x02, 0x74, 0x63, 0x2d, 0x72, 0xe5, 0x20, 0x01, 0x74, 0x61, 0x72, 0x65, 0x62,
+    0x73, 0x6e, 0x65, 0x67, 0x6d, 0xf2, 0x20, 0x01, 0xe5, 0x20, 0xe2, 0xf3, 0x21, 0x07, 0xec, 0x49,
+    0x04, 0x00, 0x5a, 0x08, 0xae, 0xa8, 0x56, 0x08, 0x46, 0x08, 0x16, 0x06, 0x1c, 0x08, 0x14, 0x08,
+    0xe4, 0x40, 0x06, 0x02, 0xed, 0x28, 0x01, 0x07, 0x68, 0xe5, 0x20, 0x01, 0xf3, 0x28, 0xff, 0x08,
+    0xe3, 0x48, 0xc2, 0x01, 0xbc, 0x07, 0xe2, 0x49, 0x04, 0x00, 0x45, 0x08, 0xae, 0xe8, 0x08, 0x20,
+    0x00, 0x2d, 0x08, 0x1d, 0x08, 0x1a, 0x00, 0xed, 0x05, 0xf3, 0x07, 0x14, 0x00, 0x10, 0x00, 0xfa,
+    0x28, 0xdf, 0x01, 0xf6, 0x48, 0xd8, 0x07, 0x26, 0x08, 0xef, 0x48, 0x07, 0x08, 0x35, 0x06, 0xe5,
+    0x20, 0x01, 0xf2, 0x20, 0x01, 0xef, 0x28, 0xfa, 0x06, 0xe1, 0xc8, 0x14, 0x00, 0xf7, 0x07, 0x10,
+    0x00, 0xea, 0x07, 0x0c, 0x00, 0x10, 0x08, 0xf2, 0x28, 0x04, 0x08, 0xe8, 0x28, 0xd4, 0x05, 0x30,
+    0x64, 0x63, 0x34, 0xf8, 0x28, 0xc0, 0x08, 0x38, 0x38, 0x75, 0x76, 0xef, 0x20, 0x01, 0xf2, 0x28,
+    0xdc, 0x08, 0xb4, 0x40, 0x0a, 0x02, 0x39, 0xb6, 0x20, 0x01, 0x72, 0xfa, 0x20, 0x2f, 0xb6, 0x40,
+    0x09, 0x02, 0xf1, 0x20, 0x01, 0xe9, 0x28, 0xb9, 0x08, 0x31, 0xf2, 0x20, 0x01, 0xe6, 0x20, 0x01,
+    0xfa, 0x28, 0xba, 0x08, 0xb3, 0x40, 0x0e, 0x02, 0x6a, 0xe3, 0x20, 0x01, 0x61, 0xb1, 0x20, 0x01,
+    0xe4, 0x28, 0xaa, 0x08, 0x62, 0xb2, 0x20, 0x01, 0x6b, 0xe3, 0x20, 0x01, 0xe3, 0x28, 0x9e, 0x08,
+    0x32, 0xf8, 0x20, 0x01, 0xf4, 0x28, 0x6f, 0x08, 0xb1, 0x60, 0x16, 0x0c, 0x03, 0x65, 0x32, 0xeb,
+    0x20, 0x01, 0xe3, 0x28, 0x05, 0x08, 0x36, 0x38, 0x71, 0xf5, 0x20, 0x01, 0xf6, 0x28, 0x7e, 0x08,
+    0x32, 0x35, 0x71, 0xe8, 0x28, 0x10, 0x08, 0x30, 0x30, 0x61, 0x76, 0x65, 0xb5, 0x20, 0x01, 0x61,
+    0x39, 0xe9, 0x28, 0x3f, 0x08, 0xe1, 0xe8, 0x21, 0x2c, 0x08, 0x05, 0x08, 0xe4, 0x07, 0xd0, 0x07,
+    0xc2, 0x07, 0x88, 0x07, 0x81, 0x07, 0x77, 0x07, 0x6c, 0x07, 0xfc, 0x06, 0x5c, 0x06, 0x35, 0x06,
+    0x32, 0x06, 0x28, 0x06, 0x0c, 0x06, 0xff, 0x05, 0xbb, 0x05, 0xb1, 0x05, 0x8e, 0x05, 0x36, 0x05,
+    0xf5, 0x04, 0x70, 0x04, 0xf1, 0x03, 0xdb, 0x03, 0xa0, 0x03, 0x6c, 0x03, 0x49, 0x03, 0xee, 0x00,
+    0xdb, 0x00, 0xcf, 0x00, 0xc3, 0x00, 0xbb, 0x00, 0x42, 0x00, 0xfa, 0x40, 0x09, 0x02, 0xfa, 0x20,
+    0x01, 0xe9, 0x28, 0xa3, 0x06, 0xae, 0xe8, 0x0c, 0x64, 0x00, 0x51, 0x00, 0x14, 0x07, 0x4b, 0x00,
+    0x45, 0x00, 0x33, 0x00, 0x26, 0x00, 0x22, 0x00, 0x1c, 0x00, 0xda, 0x06, 0xd2, 0x06, 0x18, 0x00,
+    0xf7, 0x28, 0x92, 0x05, 0xf4, 0x48, 0xdc, 0x06, 0xa7, 0x06, 0xf3, 0x28, 0x43, 0x05, 0x72, 0x61,
+    0x64, 0xee, 0x20, 0x01, 0xef, 0x20, 0x01, 0xf2, 0x28, 0xa7, 0x06, 0xef, 0x40, 0x06, 0x02, 0xe7,
+    0x28, 0xc4, 0x06, 0xe3, 0x21, 0x01, 0xae, 0x20, 0x01, 0xf4, 0x28, 0xa3, 0x06, 0xed, 0x48, 0x40,
+    0x06, 0xdc, 0x06, 0xec, 0x48, 0xc2, 0x06, 0x32, 0x04, 0xe3, 0x48, 0xd2, 0x06, 0x04, 0x00, 0xe9,
+    0x48, 0xa4, 0x06, 0x04, 0x00, 0xf2, 0x20, 0x01, 0xe7, 0x28, 0xc3, 0x06, 0xe2, 0x20, 0x01, 0xe5,
+    0x28, 0xff, 0x03, 0x79, 0xef, 0x20, 0x01, 0xe7, 0x28, 0x28, 0x04, 0xf8, 0x48, 0xb0, 0x06, 0x04,
+    0x00, 0x69, 0x61, 0xe3, 0x28, 0x2f, 0x05, 0x77, 0xe1, 0x20, 0x01, 0x6e, 0xe9, 0x20, 0x01, 0xeb,
+    0x28, 0x91, 0x06, 0xf6, 0x89, 0x0c, 0x00, 0x08, 0x00, 0x53, 0x01, 0x94, 0x02, 0xe2, 0x28, 0x61,
+    0x06, 0xe1, 0x20, 0x01, 0xea, 0x01, 0xf5, 0x21, 0x01, 0xae, 0xe8, 0x17, 0xff, 0x01, 0xfb, 0x01,
+    0xf9, 0x03, 0xd6, 0x01, 0xc6, 0x01, 0xc0, 0x01, 0xba, 0x01, 0xb7, 0x01, 0x91, 0x01, 0x40, 0x01,
+    0x18, 0x01, 0x08, 0x01, 0xed, 0x00, 0xdd, 0x00, 0xd5, 0x00, 0xb9, 0x00, 0xb5, 0x00, 0xad, 0x00,
+    0x36, 0x06, 0x63, 0x00, 0x5f, 0x00, 0x38, 0x00, 0x2e, 0x00, 0xfa, 0x48, 0x04, 0x00, 0x96, 0x03,
+    0xe9, 0x28, 0x1e, 0x06, 0xf9, 0x60, 0x1d, 0x16, 0x03, 0xf3, 0x60, 0x0c, 0x09, 0x03, 0x74, 0x76,
+    0xef, 0x28, 0x64, 0x01, 0xf3, 0x20, 0x01, 0x61, 0xeb, 0x28, 0x5f, 0x01, 0xed, 0x20, 0x01, 0xf5,
+    0x28, 0x9d, 0x05, 0x69, 0x6b, 0x73, 0x74, 0xe9, 0x28, 0x3f, 0x01, 0xf8, 0x28, 0x05, 0x06, 0xf6,
+    0xe9, 0x07, 0x00, 0x06, 0x38, 0x00, 0x16, 0x00, 0x93, 0x01, 0xe5, 0x04, 0x0e, 0x00, 0xf8, 0x05,
+    0xef, 0x40, 0x02, 0x15, 0xe7, 0x29, 0x2d, 0x01, 0xe9, 0xa0, 0x19, 0x15, 0x0d, 0x09, 0x05, 0xf9,
+    0x28, 0x74, 0x01, 0xf6, 0x28, 0xc2, 0x04, 0x6b, 0xf2, 0x20, 0x01, 0xe1, 0x28, 0x26, 0x01, 0xe8,
+    0x28, 0x12, 0x01, 0x61, 0x6c, 0x6f, 0xeb, 0x28, 0x3e, 0x05, 0xe5, 0x48, 0x04, 0x00, 0x56, 0x01,
+    0x61, 0x6c, 0xef, 0x20, 0x01, 0xeb, 0x28, 0x18, 0x04, 0xf4, 0x68, 0xa7, 0x05, 0x9c, 0x04, 0x36,
+    0x02, 0xf3, 0x28, 0x42, 0x01, 0xf2, 0x88, 0xab, 0x05, 0x0f, 0x00, 0x3e, 0x01, 0x08, 0x00, 0x79,
+    0x6d, 0x6f, 0x74, 0xf9, 0x20, 0x08, 0x69, 0x6d, 0x6f, 0x74, 0xe9, 0x20, 0x01, 0xe8, 0x28, 0x12,
+    0x02, 0xf0, 0x68, 0xf7, 0x02, 0x23, 0x05, 0x0e, 0x02, 0xef, 0x48, 0x87, 0x05, 0x04, 0x00, 0xee,
+    0x20, 0x01, 0xf6, 0x20, 0x01, 0xef, 0x28, 0x73, 0x05, 0xee, 0xc8, 0x77, 0x05, 0xdf, 0x02, 0x3c,
+    0x04, 0x13, 0x00, 0xc5, 0x03, 0x0c, 0x00, 0xf9, 0x20, 0x01, 0xec, 0x28, 0xb1, 0x03, 0x6f, 0x73,
+    0x72, 0xe5, 0x20, 0xb0, 0xed, 0x88, 0xef, 0x00, 0x59, 0x05, 0xe8, 0x04, 0x08, 0x00, 0xf9, 0x20,
+    0x01, 0xf2, 0x20, 0xe2, 0xec, 0x68, 0x19, 0x00, 0x06, 0x00, 0xe0, 0x04, 0x6f, 0x70, 0x6f, 0x74,
+    0x73, 0xe1, 0x40, 0x05, 0x02, 0xf6, 0x20, 0x04, 0xe2, 0x20, 0x01, 0xe5, 0x28, 0xc1, 0x04, 0x69,
+    0x70, 0x6f, 0xee, 0x20, 0x01, 0xf2, 0x20, 0x01, 0xe5, 0x28, 0x41, 0x05, 0xeb, 0x68, 0x24, 0x05,
+    0x2c, 0x05, 0x06, 0x00, 0xf3, 0x60, 0x3c, 0x2e, 0x03, 0xf6, 0x40, 0x17, 0x02, 0x6f, 0x72, 0x74,
+    0x65, 0x70, 0x6f, 0x72, 0xf0, 0x40, 0x05, 0x02, 0xe9, 0x20, 0x04, 0xe5, 0x20, 0x01, 0xee, 0x28,
+    0x6a, 0x02, 0x69, 0x6b, 0x6e, 0x61, 0x72, 0x66, 0xad, 0x20, 0x01, 0x6f, 0x6e, 0xe1, 0x20, 0x01,
+    0xf6, 0x28, 0xb5, 0x03, 0xf4, 0x40, 0x02, 0x13, 0xe5, 0x20, 0x01, 0xee, 0x20, 0x01, 0xef, 0x28,
+    0x4a, 0x02, 0x6e, 0xe1, 0x20, 0x01, 0xe7, 0x20, 0x01, 0xf5, 0x28, 0xbc, 0x03, 0xe9, 0x40, 0x0f,
+    0x02, 0x79, 0x6b, 0x73, 0x74, 0xf9, 0x20, 0x01, 0x6e, 0x6c, 0x65, 0xed, 0x20, 0x16, 0x73, 0x74,
+    0xf6, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xee, 0x20, 0x01, 0xf2, 0x20, 0x01, 0xe5, 0x20, 0x01, 0xe8,
+    0x28, 0xb1, 0x04, 0xe8, 0x20, 0x40, 0xe7, 0x48, 0x8f, 0x03, 0xb7, 0x04, 0xe6, 0x48, 0x69, 0x03,
+    0xd5, 0x02, 0xe5, 0x68, 0x6c, 0x00, 0x06, 0x00, 0xb7, 0x04, 0x6e, 0xf6, 0x20, 0x01, 0xe9, 0x28,
+    0x8a, 0x04, 0xe4, 0x68, 0x13, 0x00, 0x06, 0x00, 0x70, 0x03, 0xef, 0x21, 0x01, 0x72, 0x6f, 0x67,
+    0xe8, 0x20, 0x01, 0xfa, 0x28, 0xdd, 0x01, 0x61, 0x72, 0x67, 0x6f, 0x76, 0xef, 0x20, 0x01, 0xf2,
+    0x20, 0x01, 0xe9, 0x20, 0x01, 0xeb, 0x01, 0xe2, 0x28, 0xf5, 0x03, 0xe1, 0xc0, 0x4a, 0x3f, 0x2a,
+    0x1c, 0x12, 0x06, 0x76, 0x61, 0xf4, 0x20, 0x01, 0xec, 0x20, 0x01, 0xef, 0x28, 0xe9, 0x03, 0xf4,
+    0x20, 0x01, 0xec, 0x20, 0x01, 0xe1, 0x28, 0xd5, 0x03, 0xf3, 0x40, 0x05, 0x02, 0xf3, 0x20, 0x01,
+    0xe5, 0x20, 0x01, 0xe4, 0x28, 0x4d, 0x04, 0xe9, 0x40, 0x07, 0x02, 0x73, 0x74, 0xf9, 0x20, 0x1c,
+    0x68, 0x7a, 0x68, 0x7a, 0x69, 0x72, 0xef, 0x20, 0x01, 0xf0, 0x20, 0xa3, 0x65, 0xed, 0x20, 0x01,
+    0xe9, 0x20, 0x01, 0xf2, 0x28, 0x1d, 0x04, 0x63, 0xe9, 0x20, 0x01, 0xee, 0x20, 0x01, 0xee, 0x20,
+    0x29, 0xf4, 0x80, 0x1d, 0x12, 0x0b, 0x04, 0xef, 0x20, 0x01, 0xf9, 0x28, 0xb7, 0x03, 0xec, 0x20,
+    0x01, 0xe5, 0x28, 0x67, 0x01, 0x65, 0xec, 0x20, 0x01, 0xe8, 0x20, 0x01, 0xf4, 0x28, 0x0f, 0x04,
+    0xe1, 0x28, 0x58, 0x01, 0xf3, 0x61, 0x15, 0x07, 0x03, 0xe9, 0x28, 0x35, 0x02, 0x61, 0xe3, 0x21,
+    0x01, 0x2e, 0x75, 0x62, 0x61, 0x6e, 0x2e, 0xe9, 0x28, 0x39, 0x01, 0xae, 0xe8, 0x08, 0x13, 0x00,
+    0x10, 0x00, 0xde, 0x03, 0x4f, 0x01, 0xce, 0x03, 0x9e, 0x01, 0xa4, 0x03, 0x9c, 0x03, 0xe4, 0x20,
+    0xd0, 0xe2, 0x20, 0x01, 0xf5, 0x28, 0x50, 0x03, 0xf2, 0xa8, 0x34, 0x00, 0x2d, 0x00, 0x18, 0x04,
+    0x19, 0x00, 0x0a, 0x00, 0xf5, 0x40, 0x06, 0x02, 0xf4, 0x28, 0x37, 0x01, 0xeb, 0x20, 0x01, 0xe1,
+    0x28, 0x2d, 0x03, 0xee, 0x21, 0x01, 0x64, 0x35, 0x75, 0x68, 0x66, 0x38, 0x6c, 0x65, 0x35, 0xb8,
+    0x20, 0x01, 0x72, 0xb4, 0x28, 0xca, 0x03, 0xe5, 0x20, 0x01, 0xed, 0x28, 0x1d, 0x01, 0xe1, 0x20,
+    0x01, 0xfa, 0x01, 0xf1, 0x21, 0x01, 0xae, 0xe8, 0x08, 0x02, 0x01, 0x83, 0x03, 0xf4, 0x00, 0x7b,
+    0x03, 0x73, 0x03, 0x51, 0x03, 0x49, 0x03, 0x41, 0x03, 0xf0, 0xa9, 0x44, 0x00, 0x67, 0x03, 0x3d,
+    0x00, 0x0a, 0x00, 0xf3, 0x02, 0x72, 0xe1, 0x21, 0x01, 0xae, 0xc0, 0x25, 0x21, 0x1b, 0x18, 0x0e,
+    0x06, 0x73, 0xe9, 0x20, 0x01, 0xf2, 0x28, 0x10, 0x02, 0x72, 0x64, 0x64, 0xe1, 0x20, 0x01, 0xad,
+    0x28, 0x72, 0x01, 0xee, 0x20, 0x04, 0xe9, 0x20, 0x01, 0xf2, 0x20, 0x97, 0xb6, 0x28, 0xf6, 0x01,
+    0x34, 0xb6, 0x20, 0x01, 0xb1, 0x28, 0x02, 0x03, 0x67, 0x37, 0x68, 0xf9, 0x28, 0x05, 0x04, 0xae,
+    0xe8, 0x08, 0x32, 0x00, 0xf8, 0x00, 0x26, 0x00, 0x20, 0x00, 0x17, 0x00, 0x10, 0x00, 0xea, 0x00,
+    0xf0, 0x02, 0xef, 0x20, 0x01, 0xe2, 0x28, 0x26, 0x03, 0xed, 0x20, 0x01, 0xef, 0x48, 0x04, 0x03,
+    0xf7, 0x02, 0xe7, 0x48, 0x2f, 0x01, 0x0b, 0x03, 0xe4, 0x40, 0x06, 0x02, 0xec, 0x28, 0x80, 0x02,
+    0xe5, 0x28, 0xf8, 0x02, 0xe2, 0x28, 0xb7, 0x02, 0xee, 0xa1, 0x1d, 0x19, 0x15, 0x0c, 0x05, 0xf4,
+    0x20, 0x01, 0xe5, 0x28, 0xf9, 0x02, 0x6f, 0x6c, 0xe5, 0x20, 0x01, 0xe3, 0x28, 0x1c, 0x02, 0xe9,
+    0x28, 0x5d, 0x02, 0xe1, 0x28, 0x1b, 0x01, 0xae, 0xe8, 0x0d, 0x5f, 0x00, 0x5b, 0x00, 0x51, 0x00,
+    0xd2, 0x02, 0x4a, 0x00, 0x3a, 0x00, 0xc2, 0x02, 0xf9, 0x00, 0x32, 0x00, 0x2a, 0x00, 0x22, 0x00,
+    0x1e, 0x00, 0x1a, 0x00, 0xf8, 0x28, 0xb4, 0x02, 0xf6, 0x28, 0xc1, 0x02, 0xf3, 0x40, 0x04, 0x02,
+    0xf7, 0x01, 0xf5, 0x01, 0xf2, 0x48, 0x04, 0x00, 0xac, 0x02, 0xe4, 0x01, 0xef, 0x68, 0x94, 0x02,
+    0xc2, 0x00, 0xbe, 0x01, 0xec, 0x20, 0x01, 0xef, 0x20, 0x01, 0xef, 0x20, 0x01, 0xe8, 0x20, 0x01,
+    0xe3, 0x28, 0x0c, 0x02, 0xe9, 0x20, 0x01, 0xe2, 0x28, 0x64, 0x01, 0xe5, 0x20, 0x01, 0xed, 0x20,
+    0x01, 0xe1, 0x28, 0x62, 0x02, 0xe3, 0x28, 0x6b, 0x02, 0xe1, 0x28, 0x67, 0x02, 0xed, 0x89, 0x1f,
+    0x00, 0x15, 0x00, 0x08, 0x00, 0x6b, 0x02, 0x65, 0x30, 0x30, 0x73, 0xe6, 0x20, 0x01, 0x37, 0x76,
+    0xf1, 0x28, 0x43, 0x03, 0x61, 0xe8, 0x20, 0x01, 0xef, 0x20, 0x01, 0xeb, 0x20, 0xfc, 0xae, 0xc8,
+    0x1a, 0x00, 0x4c, 0x02, 0x3f, 0x02, 0x10, 0x00, 0x0c, 0x00, 0x0a, 0x02, 0xf4, 0x28, 0x24, 0x02,
+    0xf3, 0x20, 0x01, 0xf3, 0x20, 0x01, 0xe5, 0x28, 0x54, 0x01, 0xe3, 0x28, 0x41, 0x02, 0xec, 0x61,
+    0x2a, 0x21, 0x03, 0x6c, 0xe5, 0x40, 0x0f, 0x02, 0x72, 0x62, 0x6d, 0xf5, 0x20, 0x01, 0xe4, 0x20,
+    0x01, 0xe5, 0x28, 0x07, 0x02, 0x6e, 0x69, 0xf3, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xf5, 0x28, 0x03,
+    0x02, 0x69, 0x72, 0x67, 0xee, 0x20, 0x01, 0xe1, 0x20, 0xa8, 0xae, 0xe8, 0x08, 0xf5, 0x01, 0xff,
+    0x01, 0xef, 0x01, 0x20, 0x00, 0x16, 0x00, 0x10, 0x00, 0xc5, 0x01, 0xbd, 0x01, 0xf4, 0x48, 0xd3,
+    0x01, 0x14, 0x00, 0xf2, 0x48, 0x6e, 0x01, 0x04, 0x00, 0xee, 0x28, 0xc5, 0x01, 0xef, 0x20, 0x01,
+    0xe6, 0x20, 0x01, 0xee, 0x20, 0x92, 0xeb, 0x80, 0x1a, 0x12, 0x0e, 0x04, 0xf5, 0x20, 0x01, 0xf3,
+    0x20, 0x01, 0xf4, 0x28, 0xce, 0x01, 0xe5, 0x28, 0x8d, 0x01, 0xe4, 0x20, 0x01, 0xef, 0x20, 0x01,
+    0xf6, 0x01, 0xe1, 0x20, 0x01, 0xf3, 0x28, 0xbb, 0x01, 0xea, 0x20, 0x01, 0xee, 0x20, 0x01, 0xe9,
+    0x28, 0x94, 0x01, 0xe9, 0xa0, 0x39, 0x22, 0x4c, 0x1f, 0x05, 0x73, 0xe1, 0x21, 0x01, 0xae, 0x20,
+    0x01, 0xf3, 0x20, 0x01, 0xee, 0x20, 0x01, 0xe4, 0x20, 0x01, 0xf5, 0x20, 0x01, 0xef, 0x20, 0x01,
+    0xec, 0x28, 0x80, 0x01, 0xeb, 0x21, 0xf9, 0x64, 0x65, 0xed, 0x21, 0x01, 0xae, 0x20, 0x01, 0x72,
+    0xe5, 0x20, 0x01, 0xed, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xf2, 0x20, 0x01, 0xe6, 0x01, 0xe3, 0x20,
+    0x01, 0xee, 0x20, 0x01, 0xe1, 0x20, 0x41, 0x68, 0xf3, 0x20, 0x01, 0xeb, 0x20, 0x01, 0xe9, 0x20,
+    0x01, 0xe8, 0x20, 0xdb, 0xe7, 0x61, 0x13, 0x06, 0x03, 0xef, 0x20, 0xd1, 0x6e, 0x61, 0xf2, 0x20,
+    0x01, 0xe9, 0x20, 0x01, 0xf0, 0x20, 0x01, 0xe9, 0x01, 0xe5, 0x20, 0x01, 0xed, 0x28, 0x44, 0x01,
+    0xe6, 0x48, 0x30, 0x01, 0x04, 0x00, 0xef, 0x28, 0x18, 0x01, 0xe5, 0x20, 0xf4, 0xe4, 0xa0, 0x1f,
+    0x12, 0x0e, 0x0a, 0x05, 0xf4, 0x20, 0x01, 0xec, 0x01, 0xf3, 0x28, 0x32, 0x01, 0xef, 0x28, 0x1b,
+    0x01, 0xee, 0x40, 0x07, 0x02, 0xef, 0x20, 0x01, 0xe8, 0x01, 0xe5, 0x28, 0x1c, 0x01, 0xe1, 0x20,
+    0x01, 0xf4, 0x20, 0x8b, 0xe3, 0x81, 0x2c, 0x0d, 0x04, 0x88, 0x6e, 0x61, 0xe9, 0x20, 0x01, 0xf6,
+    0x28, 0x0c, 0x01, 0xe9, 0x60, 0x1a, 0x09, 0x03, 0xf3, 0x20, 0x01, 0xf2, 0x20, 0xe2, 0xf2, 0x40,
+    0x05, 0x02, 0xe6, 0x20, 0xf9, 0x65, 0xed, 0x20, 0x01, 0xe1, 0x20, 0x01, 0xf2, 0x20, 0x68, 0xed,
+    0x20, 0xec, 0xae, 0xe0, 0x0e, 0x6a, 0x63, 0x5e, 0x5b, 0x53, 0x50, 0x4d, 0xca, 0x2c, 0x29, 0x25,
+    0x22, 0x1a, 0x0e, 0xf9, 0x20, 0x01, 0xf3, 0x20, 0x01, 0xf2, 0x20, 0x01, 0xe1, 0x20, 0xa2, 0x76,
+    0x65, 0x64, 0xf7, 0x20, 0x01, 0xe1, 0x02, 0xf5, 0x20, 0x9c, 0xf4, 0x40, 0x99, 0x82, 0xf3, 0x20,
+    0x95, 0xf0, 0x40, 0x16, 0x02, 0x6f, 0xe8, 0x20, 0x01, 0xf3, 0x20, 0x01, 0x64, 0x61, 0x65, 0x72,
+    0xf0, 0x20, 0x01, 0xf3, 0x20, 0x01, 0xf9, 0x20, 0x92, 0xe9, 0x20, 0x01, 0xad, 0x20, 0x01, 0xef,
+    0x20, 0x74, 0xee, 0x20, 0x8e, 0xec, 0x20, 0x6e, 0xeb, 0x40, 0x04, 0x02, 0xf9, 0x01, 0xf3, 0x01,
+    0xe6, 0x20, 0x63, 0xe5, 0x20, 0x01, 0xf0, 0x01, 0xe3, 0x60, 0x56, 0x36, 0x03, 0xf1, 0x01, 0xe2,
+    0x60, 0x7c, 0x69, 0x54, 0xe2, 0xc1, 0x1a, 0x10, 0x5c, 0x06, 0x64, 0x4f, 0x69, 0xe8, 0x20, 0x01,
+    0xf3, 0x20, 0x01, 0xef, 0x20, 0x66, 0x61, 0xe2, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xec, 0x20, 0x5e,
+    0xae, 0xe0, 0x07, 0x49, 0x41, 0x39, 0x34, 0x17, 0x0f, 0x07, 0xf6, 0x20, 0x01, 0xef, 0x20, 0x01,
+    0xe7, 0x01, 0xf5, 0x20, 0x01, 0xe4, 0x20, 0x01, 0xe5, 0x01, 0xf4, 0x40, 0x16, 0x02, 0xef, 0x20,
+    0x01, 0xf0, 0x20, 0x01, 0xf3, 0x20, 0x01, 0xe7, 0x20, 0x01, 0xef, 0x20, 0x01, 0xec, 0x20, 0x01,
+    0xe2, 0x01, 0xe5, 0x20, 0x01, 0xee, 0x01, 0xf3, 0x20, 0x01, 0xf2, 0x01, 0xed, 0x20, 0x01, 0xef,
+    0x20, 0x01, 0xe3, 0x01, 0xec, 0x20, 0x01, 0xe9, 0x20, 0x01, 0xed, 0x01, 0xe7, 0x20, 0x01, 0xf2,
+    0x20, 0x01, 0xef, 0x01, 0xe1, 0x40, 0x07, 0x02, 0xe9, 0x20, 0x01, 0xf4, 0x01, 0xe1, 0x01, 0x39,
+    0x64, 0x32, 0x63, 0xb2, 0x20, 0x01, 0xb4, 0x20, 0xe4, 0x38, 0x38, 0x33, 0x78, 0xee, 0x20, 0xc6,
+    0xb6, 0xc0, 0x2d, 0x27, 0x1e, 0x15, 0x10, 0x06, 0xec, 0x20, 0x01, 0x62, 0xe7, 0x20, 0x01, 0xf7,
+    0x20, 0xcb, 0x65, 0x63, 0xb7, 0x20, 0x07, 0xe1, 0x20, 0x01, 0xf8, 0x20, 0x01, 0xf1, 0x20, 0xbd,
+    0x35, 0x62, 0x30, 0xb6, 0x20, 0x01, 0xf4, 0x20, 0xb4, 0x32, 0x79, 0x71, 0xf9, 0x20, 0x97, 0xb1,
+    0x20, 0x01, 0x66, 0xb4, 0x20, 0x01, 0x61, 0xb3, 0x20, 0x79, 0x34, 0x78, 0x31, 0x64, 0x37, 0x37,
+    0x78, 0x72, 0xe3, 0x20, 0x01, 0xeb, 0x20, 0x95, 0xb3, 0x40, 0x09, 0x02, 0x36, 0x30, 0x61, 0x30,
+    0xf9, 0x20, 0x4f, 0x32, 0x77, 0x71, 0xf1, 0x20, 0x01, 0xb1, 0x20, 0x81, 0xb2, 0x60, 0x1a, 0x0a,
+    0x03, 0xf1, 0x20, 0x01, 0x62, 0xe4, 0x20, 0x72, 0x65, 0x79, 0x68, 0x33, 0x6c, 0xe1, 0x20, 0x01,
+    0x32, 0x63, 0xeb, 0x20, 0x01, 0xf8, 0x20, 0x65, 0x38, 0x75, 0xe7, 0x20, 0x39, 0xb1, 0x80, 0x1a,
+    0x0f, 0x0b, 0x04, 0x72, 0x64, 0x63, 0x65, 0xf1, 0x20, 0x14, 0x68, 0xe2, 0x20, 0x28, 0x61, 0x70,
+    0x67, 0x36, 0x71, 0xf0, 0x20, 0x01, 0xe3, 0x20, 0x1d, 0x32, 0xef, 0x20, 0x01, 0x61, 0xb0, 0x20,
+    0x01, 0xb8, 0x20, 0x39, 0xb0, 0x80, 0x2d, 0x22, 0x16, 0x04, 0x6e, 0x62, 0x62, 0x30, 0x63, 0xb7,
+    0x20, 0x01, 0xe1, 0x20, 0x01, 0x62, 0xe7, 0x20, 0x01, 0xed, 0x20, 0x21, 0x65, 0x39, 0xe5, 0x20,
+    0x01, 0x62, 0xe7, 0x20, 0x01, 0xee, 0x20, 0x15, 0x32, 0x37, 0xf1, 0x20, 0x01, 0xea, 0x20, 0x01,
+    0xe6, 0x20, 0x0a, 0x30, 0x74, 0x72, 0xeb, 0x20, 0x01, 0xb9, 0x20, 0x01, 0x2d, 0x2d, 0xee, 0x20,
+    0x01, 0xf8, 0x01,
+};
+
+} // namespace
+
+#endif // PUBLICSUFFIXGRAPH_H
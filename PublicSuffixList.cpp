@@ -0,0 +1,146 @@
+// PublicSuffixList.cpp
+
+#include "PublicSuffixList.h"
+#include "PublicSuffixGraph.h"
+#include <cstring>
+
+namespace {
+
+// Start of the label that ends just before |end|
+int labelStart(const char *host, int end)
+{
+    while (end > 0 && host[end - 1] != '.') {
+        --end;
+    }
+    return end;
+}
+
+// No top-level domain is numeric
+bool isAddress(const char *host, int length)
+{
+    return host[0] == '[' || (host[length - 1] >= '0' && host[length - 1] <= '9');
+}
+
+int childOffset(const unsigned char *entry, int width)
+{
+    int offset = entry[0];
+    if (width > 1) {
+        offset |= entry[1] << 8;
+        if (width > 2) {
+            offset |= entry[2] << 16;
+        }
+    }
+    return offset;
+}
+
+// The child whose characters start with |c|, or null
+const unsigned char *findChild(const unsigned char *children, int count, int width, unsigned char c)
+{
+    int low = 0;
+    int high = count;
+    while (low < high) {
+        const int middle = (low + high) / 2;
+        const unsigned char *child = children + childOffset(children + width * middle, width);
+        const unsigned char first = *child & 0x7f;
+        if (first == c) {
+            return child;
+        }
+        if (first < c) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+int PublicSuffixList::registrableDomain(const char *host, int length)
+{
+    if (length > 0 && host[length - 1] == '.') {
+        --length;
+    }
+    if (length <= 0 || isAddress(host, length)) {
+        return -1;
+    }
+
+    // Where the public suffix starts; unlisted ones are the last label.
+    // Longer rules win, and an exception ends the search.
+    int suffix = labelStart(host, length);
+    const unsigned char *node = PublicSuffixGraph;
+    int position = length;
+    for (;;) {
+        const int info = *node++;
+        const int flags = info & 0x7;
+        const int width = ((info >> 3) & 0x3) + 1;
+        int count = info >> 5;
+        if (count == ManyChildren) {
+            count = *node++;
+        }
+        // A rule matches whole labels only
+        if (flags && (position == 0 || host[position - 1] == '.')) {
+            if (flags & Exception) {
+                return position;
+            }
+            if (flags & Normal) {
+                suffix = qMin(suffix, position);
+            }
+            if ((flags & Wildcard) && position > 0) {
+                suffix = qMin(suffix, labelStart(host, position - 1));
+            }
+        }
+        if (position == 0) {
+            break;
+        }
+
+        const unsigned char *child = findChild(node, count, width, static_cast<unsigned char>(host[position - 1]));
+        if (!child) {
+            break;
+        }
+        for (;;) {
+            const unsigned char c = *child++;
+            if (position == 0 || (c & 0x7f) != static_cast<unsigned char>(host[position - 1])) {
+                child = nullptr;
+                break;
+            }
+            --position;
+            if (c & 0x80) {
+                break;
+            }
+        }
+        if (!child) {
+            break;
+        }
+        node = child;
+    }
+
+    if (suffix == 0) {
+        return -1;
+    }
+    return labelStart(host, suffix - 1);
+}
+
+QByteArray PublicSuffixList::registrableDomain(const QByteArray &host)
+{
+    const int begin = registrableDomain(host.constData(), host.size());
+    if (begin < 0) {
+        return QByteArray();
+    }
+    const int end = host.endsWith('.') ? host.size() - 1 : host.size();
+    return host.mid(begin, end - begin);
+}
+
+QByteArray PublicSuffixList::site(const QByteArray &host)
+{
+    const QByteArray domain = registrableDomain(host);
+    return domain.isEmpty() ? host : domain;
+}
+
+bool PublicSuffixList::isSameSite(const char *host, int length, const char *otherHost, int otherLength)
+{
+    const int begin = qMax(0, registrableDomain(host, length));
+    const int otherBegin = qMax(0, registrableDomain(otherHost, otherLength));
+    const int siteLength = length - begin;
+    return siteLength == otherLength - otherBegin && memcmp(host + begin, otherHost + otherBegin, size_t(siteLength)) == 0;
+}
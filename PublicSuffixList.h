@@ -0,0 +1,47 @@
+// PublicSuffixList.h
+
+#ifndef PUBLICSUFFIXLIST_H
+#define PUBLICSUFFIXLIST_H
+
+#include <QByteArray>
+
+// Registrable domains ("eTLD+1") from the Public Suffix List, ICANN and
+// private sections both. The list is compiled into the browser as a DAFSA
+// over its reversed rules, so a lookup walks the host once from its last
+// character and allocates nothing.
+//
+// PublicSuffixGraph.h is generated by PublicSuffixCompiler. Its nodes are
+// a run of characters, the last with bit 7 set, then an info byte: the
+// Rule flags of a rule ending there in bits 0-2, the width of the child
+// offsets less one in bits 3-4 and the child count in bits 5-7, where 7
+// means the count follows in the next byte. Then come the children's
+// offsets, little-endian and counted from the end of the info, ordered by
+// their first character. Children always follow their parents. The root
+// at offset 0 has no characters.
+class PublicSuffixList
+{
+public:
+    enum Rule {
+        Normal = 0x1,
+        // "*.ck": every label below is a public suffix
+        Wildcard = 0x2,
+        // "!www.ck": the name is registrable despite a wildcard
+        Exception = 0x4
+    };
+
+    static const int ManyChildren = 7;
+
+    // Offset in |host| where its registrable domain starts, or -1 when
+    // |host| is a public suffix itself or an address. |host| must be
+    // lowercase and ASCII (punycode); a trailing dot is ignored. Suffixes
+    // the list does not know count as one label.
+    static int registrableDomain(const char *host, int length);
+    static QByteArray registrableDomain(const QByteArray &host);
+
+    // Registrable domain of |host|, or |host| itself when it has none, as
+    // the site cookies and parties are grouped by
+    static QByteArray site(const QByteArray &host);
+    static bool isSameSite(const char *host, int length, const char *otherHost, int otherLength);
+};
+
+#endif // PUBLICSUFFIXLIST_H
@@ -0,0 +1,246 @@
+// QueryParameterFilter.cpp
+
+#include "QueryParameterFilter.h"
+#include <cstring>
+
+namespace {
+
+// Campaign and click ids added to links by ad and analytics platforms
+const char *const BuiltInNames[] = {
+    "utm_*", "fbclid", "gclid", "gclsrc", "dclid", "gbraid", "wbraid", "msclkid", "yclid", "twclid", "ttclid",
+    "igshid", "li_fat_id", "mc_cid", "mc_eid", "_hsenc", "_hsmi", "mkt_tok", "oly_anon_id", "oly_enc_id",
+    "vero_id", "wickedid", "_openstat", "__s", "ck_subscriber_id"
+};
+
+// Request hosts one lookup has to check a scoped entry against
+const int MaxCovering = 16;
+
+} // namespace
+
+void QueryParameterFilter::Builder::addBuiltIns()
+{
+    for (const char *name : BuiltInNames) {
+        addName(QByteArray(name));
+    }
+}
+
+bool QueryParameterFilter::Builder::addRule(const QString &line)
+{
+    const QString text = line.trimmed();
+    const int option = text.lastIndexOf(QLatin1String("$removeparam="));
+    if (option < 0 || text.startsWith(QLatin1String("@@"))) {
+        return false;
+    }
+
+    // Other options, such as domain= or resource types, would narrow the
+    // rule in ways this stage does not follow
+    const QByteArray name = text.mid(option + 13).toUtf8();
+    if (name.isEmpty() || name.contains(',') || name.startsWith('/') || name.startsWith('~') || name.contains('*')) {
+        return false;
+    }
+
+    QString pattern = text.left(option);
+    if (pattern.isEmpty() || pattern == QLatin1String("*")) {
+        return addName(name);
+    }
+    if (!pattern.startsWith(QLatin1String("||"))) {
+        return false;
+    }
+    pattern.remove(0, 2);
+    if (pattern.endsWith('^')) {
+        pattern.chop(1);
+    }
+    const QByteArray host = pattern.toLower().toUtf8();
+    return !host.isEmpty() && addName(name, host);
+}
+
+bool QueryParameterFilter::Builder::addName(const QByteArray &name, const QByteArray &host)
+{
+    const bool prefix = name.endsWith('*');
+    const QByteArray base = prefix ? name.left(name.size() - 1) : name;
+    if (base.isEmpty() || base.size() > 0xffff || base.contains('*') || base.contains('&') || base.contains('=')
+        || base.contains('#')) {
+        return false;
+    }
+    if (!host.isEmpty() && !DomainTrie::isValidHost(host.constData(), host.size())) {
+        return false;
+    }
+
+    int index = m_index.value(name, -1);
+    if (index < 0) {
+        index = m_names.size();
+        m_index.insert(name, index);
+        m_names.append(PendingName{ base, prefix, false, QVector<QByteArray>() });
+    }
+    PendingName &pending = m_names[index];
+    if (host.isEmpty()) {
+        pending.anyHost = true;
+    } else if (!pending.hosts.contains(host)) {
+        pending.hosts.append(host);
+    }
+    return true;
+}
+
+QSharedPointer<const QueryParameterFilter> QueryParameterFilter::Builder::finish() const
+{
+    QSharedPointer<QueryParameterFilter> filter(new QueryParameterFilter);
+
+    DomainTrie::Builder hosts;
+    QHash<QByteArray, qint32> hostIds;
+    for (const PendingName &pending : m_names) {
+        Entry entry;
+        entry.nameOffset = quint32(filter->m_names.size());
+        entry.nameLength = quint16(pending.name.size());
+        entry.flags = (pending.prefix ? Prefix : 0) | (pending.anyHost ? AnyHost : 0);
+        entry.hostBegin = quint32(filter->m_entryHosts.size());
+        entry.hostCount = 0;
+        // A name removed everywhere needs no host list
+        if (!pending.anyHost) {
+            for (const QByteArray &host : pending.hosts) {
+                qint32 id = hostIds.value(host, -1);
+                if (id < 0) {
+                    id = qint32(hostIds.size());
+                    hostIds.insert(host, id);
+                    hosts.insert(host, id);
+                }
+                filter->m_entryHosts.append(id);
+                ++entry.hostCount;
+            }
+        }
+        filter->m_names.append(pending.name);
+        filter->m_entries.append(entry);
+    }
+    hosts.finish(filter->m_nodes, filter->m_labels);
+    filter->m_hosts.attach(filter->m_nodes.constData(), quint32(filter->m_nodes.size()),
+                           filter->m_labels.constData(), quint32(filter->m_labels.size()));
+
+    int slotCount = 16;
+    while (slotCount < filter->m_entries.size() * 2) {
+        slotCount *= 2;
+    }
+    filter->m_slots.fill(-1, slotCount);
+    for (int i = 0; i < filter->m_entries.size(); ++i) {
+        const Entry &entry = filter->m_entries[i];
+        if (entry.flags & Prefix) {
+            filter->m_prefixes.append(i);
+            continue;
+        }
+        quint32 slot = hashName(filter->m_names.constData() + entry.nameOffset, entry.nameLength);
+        while (filter->m_slots[int(slot & quint32(slotCount - 1))] >= 0) {
+            ++slot;
+        }
+        filter->m_slots[int(slot & quint32(slotCount - 1))] = i;
+    }
+    return filter;
+}
+
+bool QueryParameterFilter::strip(const char *url, int length, int hostBegin, int hostEnd, QByteArray &stripped) const
+{
+    const char *fragment = static_cast<const char *>(memchr(url + hostEnd, '#', size_t(length - hostEnd)));
+    const int queryEnd = fragment ? int(fragment - url) : length;
+    const char *question = static_cast<const char *>(memchr(url + hostEnd, '?', size_t(queryEnd - hostEnd)));
+    if (!question || m_entries.isEmpty()) {
+        return false;
+    }
+
+    // Kept parameters are copied once the first one is dropped; until
+    // then the URL is only read
+    qint32 covering[MaxCovering];
+    int coveringCount = -1;
+    bool removed = false;
+    bool first = true;
+    int begin = int(question - url) + 1;
+    while (begin <= queryEnd) {
+        const char *separator = static_cast<const char *>(memchr(url + begin, '&', size_t(queryEnd - begin)));
+        const int end = separator ? int(separator - url) : queryEnd;
+        const char *equals = static_cast<const char *>(memchr(url + begin, '=', size_t(end - begin)));
+        const int nameEnd = equals ? int(equals - url) : end;
+
+        const bool drop = nameEnd > begin && isListed(url + begin, nameEnd - begin, url + hostBegin,
+                                                      hostEnd - hostBegin, covering, coveringCount);
+        if (drop && !removed) {
+            removed = true;
+            stripped.reserve(length);
+            stripped.append(url, begin - 1);
+            // Parameters before this one were all kept
+            if (begin - 1 > int(question - url)) {
+                first = false;
+            }
+        } else if (!drop && removed && end > begin) {
+            stripped.append(first ? '?' : '&');
+            stripped.append(url + begin, end - begin);
+            first = false;
+        }
+        begin = end + 1;
+    }
+    if (!removed) {
+        return false;
+    }
+    if (fragment) {
+        stripped.append(fragment, length - queryEnd);
+    }
+    return true;
+}
+
+int QueryParameterFilter::nameCount() const
+{
+    return m_entries.size();
+}
+
+quint32 QueryParameterFilter::hashName(const char *name, int length)
+{
+    quint32 hash = 2166136261u;
+    for (int i = 0; i < length; ++i) {
+        hash = (hash ^ quint8(name[i])) * 16777619u;
+    }
+    return hash;
+}
+
+bool QueryParameterFilter::isListed(const char *name, int length, const char *host, int hostLength,
+                                    qint32 *covering, int &coveringCount) const
+{
+    const quint32 mask = quint32(m_slots.size() - 1);
+    for (quint32 slot = hashName(name, length);; ++slot) {
+        const qint32 index = m_slots[int(slot & mask)];
+        if (index < 0) {
+            break;
+        }
+        const Entry &entry = m_entries[index];
+        if (entry.nameLength == length && memcmp(m_names.constData() + entry.nameOffset, name, size_t(length)) == 0) {
+            if (appliesTo(entry, host, hostLength, covering, coveringCount)) {
+                return true;
+            }
+            break;
+        }
+    }
+
+    for (int index : m_prefixes) {
+        const Entry &entry = m_entries[index];
+        if (entry.nameLength <= length && memcmp(m_names.constData() + entry.nameOffset, name, entry.nameLength) == 0
+            && appliesTo(entry, host, hostLength, covering, coveringCount)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool QueryParameterFilter::appliesTo(const Entry &entry, const char *host, int hostLength, qint32 *covering,
+                                     int &coveringCount) const
+{
+    if (entry.flags & AnyHost) {
+        return true;
+    }
+    // The request host's listed parents are looked up once per URL
+    if (coveringCount < 0) {
+        coveringCount = m_hosts.findAll(host, hostLength, covering, MaxCovering);
+    }
+    for (quint32 i = 0; i < entry.hostCount; ++i) {
+        const qint32 id = m_entryHosts[int(entry.hostBegin + i)];
+        for (int j = 0; j < coveringCount; ++j) {
+            if (covering[j] == id) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,90 @@
+// QueryParameterFilter.h
+
+#ifndef QUERYPARAMETERFILTER_H
+#define QUERYPARAMETERFILTER_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+
+#include "DomainTrie.h"
+
+// Query parameters that only serve tracking, such as utm_* and click ids,
+// to be removed from request URLs. Names come from a built-in set and from
+// $removeparam filter list rules, optionally limited to a request host and
+// its subdomains.
+class QueryParameterFilter
+{
+public:
+    class Builder
+    {
+    public:
+        // utm_* and the common click and campaign ids
+        void addBuiltIns();
+        // Takes "$removeparam=name" and "||host^$removeparam=name"; regex,
+        // negated and otherwise qualified rules are skipped. Returns
+        // whether the rule was taken.
+        bool addRule(const QString &line);
+        // |name| ending in '*' matches by prefix. An empty |host| applies
+        // the name to every request.
+        bool addName(const QByteArray &name, const QByteArray &host = QByteArray());
+        QSharedPointer<const QueryParameterFilter> finish() const;
+
+    private:
+        struct PendingName {
+            QByteArray name;
+            bool prefix;
+            bool anyHost;
+            QVector<QByteArray> hosts;
+        };
+
+        QVector<PendingName> m_names;
+        // By name as given, '*' included
+        QHash<QByteArray, int> m_index;
+    };
+
+    // When |url| carries listed parameters, writes it without them to
+    // |stripped| and returns true. One pass over the query; nothing is
+    // allocated unless a parameter is removed. |hostBegin| and |hostEnd|
+    // delimit the lowercase request host.
+    bool strip(const char *url, int length, int hostBegin, int hostEnd, QByteArray &stripped) const;
+
+    int nameCount() const;
+
+private:
+    struct Entry {
+        quint32 nameOffset;
+        quint16 nameLength;
+        quint16 flags;
+        quint32 hostBegin;
+        quint32 hostCount;
+    };
+
+    enum EntryFlag : quint16 {
+        Prefix = 1 << 0,
+        AnyHost = 1 << 1
+    };
+
+    QueryParameterFilter() = default;
+    Q_DISABLE_COPY(QueryParameterFilter)
+
+    static quint32 hashName(const char *name, int length);
+    bool isListed(const char *name, int length, const char *host, int hostLength, qint32 *covering,
+                  int &coveringCount) const;
+    bool appliesTo(const Entry &entry, const char *host, int hostLength, qint32 *covering, int &coveringCount) const;
+
+    QVector<Entry> m_entries;
+    QByteArray m_names;
+    // Open addressing over the exact names; -1 marks an empty slot
+    QVector<qint32> m_slots;
+    QVector<int> m_prefixes;
+    // Host ids each scoped entry applies to, and the trie resolving them
+    QVector<qint32> m_entryHosts;
+    QVector<DomainTrie::Node> m_nodes;
+    QByteArray m_labels;
+    DomainTrie m_hosts;
+};
+
+#endif // QUERYPARAMETERFILTER_H
@@ -0,0 +1,125 @@
+// RcuPointer.h
+
+#ifndef RCUPOINTER_H
+#define RCUPOINTER_H
+
+#include <QAtomicPointer>
+#include <QMutex>
+#include <QThread>
+#include <QVector>
+#include <atomic>
+
+// Publishes an immutable object to reader threads without locks. Readers
+// pin the current object in a hazard slot for the duration of a Reader;
+// writers swap in a replacement and free the old one once no slot holds
+// it. Readers never wait on writers, and a reader sees either the old or
+// the new object, never a mix.
+template <typename T>
+class RcuPointer
+{
+public:
+    class Reader
+    {
+    public:
+        explicit Reader(const RcuPointer &pointer)
+            : m_slot(pointer.pin(m_value))
+        {
+        }
+
+        ~Reader()
+        {
+            m_slot->storeRelease(nullptr);
+        }
+
+        const T *get() const { return m_value; }
+        const T *operator->() const { return m_value; }
+        const T &operator*() const { return *m_value; }
+
+    private:
+        const T *m_value;
+        QAtomicPointer<const T> *m_slot;
+
+        Q_DISABLE_COPY(Reader)
+    };
+
+    explicit RcuPointer(const T *value)
+        : m_current(value)
+    {
+    }
+
+    ~RcuPointer()
+    {
+        delete m_current.loadRelaxed();
+        qDeleteAll(m_retired);
+    }
+
+    // Only the publishing threads may look at the current object without
+    // a Reader, and only while no other thread publishes
+    const T *current() const
+    {
+        return m_current.loadAcquire();
+    }
+
+    // Takes ownership of |value|. Returns false while a reader still holds
+    // a replaced object; call reclaim() later to free it.
+    bool publish(const T *value)
+    {
+        QMutexLocker locker(&m_writeLock);
+        m_retired.append(m_current.fetchAndStoreOrdered(value));
+        return reclaimLocked();
+    }
+
+    bool reclaim()
+    {
+        QMutexLocker locker(&m_writeLock);
+        return reclaimLocked();
+    }
+
+private:
+    static const int SlotCount = 64;
+
+    QAtomicPointer<const T> *pin(const T *&value) const
+    {
+        // Spread threads over the slots; all busy only means spinning
+        // until one of the other readers finishes
+        int slot = int((quintptr(QThread::currentThreadId()) >> 4) % SlotCount);
+        for (;;) {
+            value = m_current.loadAcquire();
+            if (m_slots[slot].testAndSetOrdered(nullptr, value)) {
+                // The slot must be visible before the pointer is re-read,
+                // or a writer could free the object in between
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (m_current.loadAcquire() == value) {
+                    return &m_slots[slot];
+                }
+                m_slots[slot].storeRelease(nullptr);
+                continue;
+            }
+            slot = (slot + 1) % SlotCount;
+        }
+    }
+
+    bool reclaimLocked()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (int i = m_retired.size() - 1; i >= 0; --i) {
+            bool pinned = false;
+            for (int slot = 0; slot < SlotCount && !pinned; ++slot) {
+                pinned = m_slots[slot].loadAcquire() == m_retired[i];
+            }
+            if (!pinned) {
+                delete m_retired.takeAt(i);
+            }
+        }
+        return m_retired.isEmpty();
+    }
+
+    QAtomicPointer<const T> m_current;
+    mutable QAtomicPointer<const T> m_slots[SlotCount];
+    QMutex m_writeLock;
+    QVector<const T *> m_retired;
+
+    Q_DISABLE_COPY(RcuPointer)
+};
+
+#endif // RCUPOINTER_H
@@ -0,0 +1,74 @@
+// RequestHeaderRules.cpp
+
+#include "RequestHeaderRules.h"
+
+namespace {
+
+// Patterns covering one host; hostnames have at most 127 labels
+const int MaxCovering = 128;
+
+void mergeHeaders(QMap<QByteArray, QByteArray> &merged, const QMap<QByteArray, QByteArray> &headers)
+{
+    for (auto it = headers.constBegin(); it != headers.constEnd(); ++it) {
+        merged.insert(it.key(), it.value());
+    }
+}
+
+RequestHeaderRules::Headers headerList(const QMap<QByteArray, QByteArray> &headers)
+{
+    RequestHeaderRules::Headers list;
+    list.reserve(headers.size());
+    for (auto it = headers.constBegin(); it != headers.constEnd(); ++it) {
+        list.append(qMakePair(it.key(), it.value()));
+    }
+    return list;
+}
+
+} // namespace
+
+QSharedPointer<const RequestHeaderRules> RequestHeaderRules::compile(const QMap<QByteArray, QMap<QByteArray, QByteArray>> &rules)
+{
+    QSharedPointer<RequestHeaderRules> compiled(new RequestHeaderRules);
+    const QMap<QByteArray, QByteArray> anyHost = rules.value("*");
+    compiled->m_anyHostHeaders = headerList(anyHost);
+
+    DomainTrie::Builder builder;
+    QVector<QByteArray> patterns;
+    for (auto it = rules.constBegin(); it != rules.constEnd(); ++it) {
+        if (it.key() != "*" && !it.value().isEmpty() && builder.insert(it.key(), qint32(patterns.size()))) {
+            patterns.append(it.key());
+        }
+    }
+    builder.finish(compiled->m_nodes, compiled->m_labels);
+    compiled->m_hosts.attach(compiled->m_nodes.constData(), quint32(compiled->m_nodes.size()),
+                             compiled->m_labels.constData(), quint32(compiled->m_labels.size()));
+
+    // Each pattern's set already holds what its parent patterns add
+    compiled->m_hostHeaders.reserve(patterns.size());
+    for (const QByteArray &pattern : patterns) {
+        qint32 covering[MaxCovering];
+        const int count = compiled->m_hosts.findAll(pattern.constData(), pattern.size(), covering, MaxCovering);
+        QMap<QByteArray, QByteArray> merged = anyHost;
+        for (int i = count - 1; i >= 0; --i) {
+            mergeHeaders(merged, rules.value(patterns[covering[i]]));
+        }
+        compiled->m_hostHeaders.append(headerList(merged));
+    }
+    return compiled;
+}
+
+const RequestHeaderRules::Headers &RequestHeaderRules::headers(const char *host, int length) const
+{
+    const qint32 pattern = m_hosts.find(host, length);
+    return pattern < 0 ? m_anyHostHeaders : m_hostHeaders[pattern];
+}
+
+bool RequestHeaderRules::isEmpty() const
+{
+    return m_anyHostHeaders.isEmpty() && m_hostHeaders.isEmpty();
+}
+
+int RequestHeaderRules::patternCount() const
+{
+    return m_hostHeaders.size() + (m_anyHostHeaders.isEmpty() ? 0 : 1);
+}
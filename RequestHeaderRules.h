@@ -0,0 +1,45 @@
+// RequestHeaderRules.h
+
+#ifndef REQUESTHEADERRULES_H
+#define REQUESTHEADERRULES_H
+
+#include <QByteArray>
+#include <QMap>
+#include <QPair>
+#include <QSharedPointer>
+#include <QVector>
+
+#include "DomainTrie.h"
+
+// Extra request headers by host. Each pattern is a hostname, which also
+// covers its subdomains, or "*" for every host. A host gets the headers of
+// every pattern that covers it, the more specific pattern winning when two
+// set the same header; those sets are merged at compile time, so a request
+// costs one trie lookup.
+class RequestHeaderRules
+{
+public:
+    typedef QVector<QPair<QByteArray, QByteArray>> Headers;
+
+    // Patterns that are neither "*" nor a valid hostname are skipped
+    static QSharedPointer<const RequestHeaderRules> compile(const QMap<QByteArray, QMap<QByteArray, QByteArray>> &rules);
+
+    // Headers for requests to |host|, which must be lowercase
+    const Headers &headers(const char *host, int length) const;
+
+    bool isEmpty() const;
+    int patternCount() const;
+
+private:
+    RequestHeaderRules() = default;
+    Q_DISABLE_COPY(RequestHeaderRules)
+
+    QVector<DomainTrie::Node> m_nodes;
+    QByteArray m_labels;
+    DomainTrie m_hosts;
+    // Indexed by the trie's values
+    QVector<Headers> m_hostHeaders;
+    Headers m_anyHostHeaders;
+};
+
+#endif // REQUESTHEADERRULES_H
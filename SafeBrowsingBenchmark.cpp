@@ -0,0 +1,109 @@
+// SafeBrowsingBenchmark.cpp
+//
+// Benchmark for the Safe Browsing prefix set, not linked into the browser.
+// Build it together with HashPrefixSet against QtCore.
+//
+//   SafeBrowsingBenchmark [--lookups 1000000]
+//
+// Builds sets of uniformly random 32-bit prefixes, as SHA-256 gives, and
+// reports their size against a plain sorted array and the cost of a
+// lookup that misses, which is almost every navigation, and one that hits.
+
+#include "HashPrefixSet.h"
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QRandomGenerator>
+#include <QTextStream>
+#include <algorithm>
+
+namespace {
+
+struct LookupResult {
+    qint64 elapsedNs = 0;
+    qint64 found = 0;
+};
+
+template <typename Contains>
+LookupResult lookup(const QVector<quint32> &keys, Contains contains)
+{
+    LookupResult result;
+    QElapsedTimer timer;
+    timer.start();
+    for (quint32 key : keys) {
+        result.found += contains(key) ? 1 : 0;
+    }
+    result.elapsedNs = timer.nsecsElapsed();
+    return result;
+}
+
+qint64 perLookup(const LookupResult &result, int lookups)
+{
+    return qRound64(double(result.elapsedNs) / lookups);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QTextStream out(stdout);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Safe Browsing prefix set benchmark");
+    parser.addHelpOption();
+    QCommandLineOption lookupsOption("lookups", "Lookups per measurement", "count", "1000000");
+    parser.addOption(lookupsOption);
+    parser.process(app);
+    const int lookups = qMax(1, parser.value(lookupsOption).toInt());
+
+    QRandomGenerator random(42);
+    out << "  prefixes  build ms   set KB  bits/prefix  array KB  miss ns  hit ns  array miss ns\n";
+    for (int count : { 10000, 100000, 1000000, 4000000 }) {
+        QVector<quint32> prefixes(count);
+        for (quint32 &prefix : prefixes) {
+            prefix = random.generate();
+        }
+        std::sort(prefixes.begin(), prefixes.end());
+
+        QElapsedTimer timer;
+        timer.start();
+        QVector<HashPrefixSet::Block> blocks;
+        QVector<quint64> words;
+        const quint32 stored = HashPrefixSet::build(prefixes, blocks, words);
+        HashPrefixSet set;
+        if (!set.attach(blocks.constData(), quint32(blocks.size()), words.constData(), quint32(words.size()), stored)) {
+            out << "attach failed for " << count << " prefixes\n";
+            return 1;
+        }
+        const qint64 buildMs = timer.elapsed();
+        prefixes.erase(std::unique(prefixes.begin(), prefixes.end()), prefixes.end());
+
+        // Random keys nearly always miss; listed ones always hit
+        QVector<quint32> misses(lookups);
+        QVector<quint32> hits(lookups);
+        for (int i = 0; i < lookups; ++i) {
+            misses[i] = random.generate();
+            hits[i] = prefixes[int(random.bounded(quint32(prefixes.size())))];
+        }
+
+        const LookupResult miss = lookup(misses, [&set](quint32 key) { return set.contains(key); });
+        const LookupResult hit = lookup(hits, [&set](quint32 key) { return set.contains(key); });
+        const LookupResult arrayMiss = lookup(misses, [&prefixes](quint32 key) {
+            return std::binary_search(prefixes.constBegin(), prefixes.constEnd(), key);
+        });
+        if (hit.found != lookups || arrayMiss.found != miss.found) {
+            out << "lookups disagree with the sorted array for " << count << " prefixes\n";
+            return 1;
+        }
+
+        out << qSetFieldWidth(10) << stored << qSetFieldWidth(10) << buildMs
+            << qSetFieldWidth(9) << set.size() / 1024
+            << qSetFieldWidth(13) << QString::number(double(set.size()) * 8 / stored, 'f', 2)
+            << qSetFieldWidth(10) << qint64(prefixes.size()) * 4 / 1024
+            << qSetFieldWidth(9) << perLookup(miss, lookups) << qSetFieldWidth(8) << perLookup(hit, lookups)
+            << qSetFieldWidth(15) << perLookup(arrayMiss, lookups) << qSetFieldWidth(0) << "\n";
+        out.flush();
+    }
+    return 0;
+}
@@ -0,0 +1,466 @@
+// SafeBrowsingDatabase.cpp
+
+#include "SafeBrowsingDatabase.h"
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QUrl>
+#include <QtEndian>
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+const char HashMagic[8] = { 'C', 'B', 'S', 'B', 'H', 'A', 'S', 'H' };
+const char PrefixMagic[8] = { 'C', 'B', 'S', 'B', 'P', 'R', 'F', 'X' };
+const quint32 FormatVersion = 1;
+
+// Hosts after the exact one are suffixes of its last five labels
+const int MaxHostLabels = 5;
+// The root and up to three directories below it
+const int MaxPathPrefixes = 4;
+const int WriteChunkSize = 1 << 16;
+
+struct HashHeader {
+    char magic[8];
+    quint32 format;
+    quint32 reserved;
+    quint64 version;
+    quint64 count;
+};
+
+// Followed by the blocks, then the words of the prefix set
+struct PrefixHeader {
+    char magic[8];
+    quint32 format;
+    quint32 count;
+    quint64 version;
+    quint32 blockCount;
+    quint32 wordCount;
+};
+
+struct FullHash {
+    uchar bytes[SafeBrowsingDatabase::HashSize];
+
+    bool operator<(const FullHash &other) const
+    {
+        return memcmp(bytes, other.bytes, sizeof(bytes)) < 0;
+    }
+
+    bool operator==(const FullHash &other) const
+    {
+        return memcmp(bytes, other.bytes, sizeof(bytes)) == 0;
+    }
+};
+
+QString hashPath(const QString &storagePath, quint64 version)
+{
+    return storagePath + QStringLiteral("/hashes-%1.bin").arg(version);
+}
+
+QString prefixPath(const QString &storagePath, quint64 version)
+{
+    return storagePath + QStringLiteral("/prefixes-%1.bin").arg(version);
+}
+
+QVector<quint64> storedVersions(const QString &storagePath)
+{
+    QVector<quint64> versions;
+    const QStringList names = QDir(storagePath).entryList(QStringList() << QStringLiteral("hashes-*.bin"), QDir::Files);
+    for (const QString &name : names) {
+        bool ok = false;
+        const quint64 version = name.mid(7, name.size() - 11).toULongLong(&ok);
+        if (ok) {
+            versions.append(version);
+        }
+    }
+    std::sort(versions.begin(), versions.end());
+    return versions;
+}
+
+void removeVersion(const QString &storagePath, quint64 version)
+{
+    QFile::remove(hashPath(storagePath, version));
+    QFile::remove(prefixPath(storagePath, version));
+}
+
+quint32 prefixOf(const uchar *hash)
+{
+    return qFromBigEndian<quint32>(hash);
+}
+
+bool isHexDigit(char c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+bool parseHash(const QByteArray &hex, FullHash &hash)
+{
+    if (hex.size() != 2 * SafeBrowsingDatabase::HashSize || !std::all_of(hex.constBegin(), hex.constEnd(), isHexDigit)) {
+        return false;
+    }
+    memcpy(hash.bytes, QByteArray::fromHex(hex).constData(), sizeof(hash.bytes));
+    return true;
+}
+
+bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+bool isAddress(const QByteArray &host)
+{
+    // No top-level domain is numeric
+    return host.startsWith('[') || (host.at(host.size() - 1) >= '0' && host.at(host.size() - 1) <= '9');
+}
+
+template <typename T>
+void sortUnique(QVector<T> &values)
+{
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+}
+
+} // namespace
+
+SafeBrowsingDatabase::SafeBrowsingDatabase()
+    : m_version(0)
+    , m_hashes(nullptr)
+    , m_hashCount(0)
+    , m_prefixData(nullptr)
+{
+}
+
+SafeBrowsingDatabase::~SafeBrowsingDatabase()
+{
+    if (m_hashFile) {
+        m_hashFile->unmap(const_cast<uchar *>(m_hashes) - sizeof(HashHeader));
+    }
+    if (m_prefixFile) {
+        m_prefixFile->unmap(const_cast<uchar *>(m_prefixData));
+    }
+}
+
+QSharedPointer<const SafeBrowsingDatabase> SafeBrowsingDatabase::open(const QString &storagePath)
+{
+    QSharedPointer<SafeBrowsingDatabase> database(new SafeBrowsingDatabase);
+    database->m_storagePath = storagePath;
+    const QVector<quint64> versions = storedVersions(storagePath);
+    for (int i = versions.size() - 1; i >= 0; --i) {
+        if (database->load(storagePath, versions[i])) {
+            break;
+        }
+    }
+
+    // Older versions are left over from updates, newer ones failed to load
+    for (quint64 version : versions) {
+        if (version != database->m_version) {
+            removeVersion(storagePath, version);
+        }
+    }
+    return database;
+}
+
+QSharedPointer<const SafeBrowsingDatabase> SafeBrowsingDatabase::update(const SafeBrowsingDatabase &current,
+                                                                        const QByteArray &diff, QString *error)
+{
+    quint64 version = 0;
+    bool reset = false;
+    QVector<FullHash> additions;
+    QVector<FullHash> removals;
+
+    // Scanned in place; a full list can run to millions of lines
+    const char *data = diff.constData();
+    int lineNumber = 0;
+    for (int begin = 0; begin < diff.size();) {
+        int end = diff.indexOf('\n', begin);
+        if (end < 0) {
+            end = diff.size();
+        }
+        int first = begin;
+        int last = end;
+        begin = end + 1;
+        ++lineNumber;
+        while (first < last && isSpace(data[first])) {
+            ++first;
+        }
+        while (last > first && isSpace(data[last - 1])) {
+            --last;
+        }
+        if (first == last || data[first] == '#') {
+            continue;
+        }
+
+        int split = first;
+        while (split < last && !isSpace(data[split])) {
+            ++split;
+        }
+        const QByteArray command = QByteArray::fromRawData(data + first, split - first);
+        while (split < last && isSpace(data[split])) {
+            ++split;
+        }
+        const QByteArray argument = QByteArray::fromRawData(data + split, last - split);
+
+        bool ok = true;
+        FullHash hash;
+        if (command == "version") {
+            version = argument.toULongLong(&ok);
+        } else if (command == "reset") {
+            reset = argument.isEmpty();
+            ok = reset;
+        } else if (command == "add" || command == "remove") {
+            ok = parseHash(argument, hash);
+            if (ok) {
+                (command == "add" ? additions : removals).append(hash);
+            }
+        } else if (command == "add-expression" || command == "remove-expression") {
+            // Canonicalized the way URLs are checked
+            const QVector<QByteArray> exact = expressions(QUrl::fromEncoded("http://" + argument));
+            ok = !exact.isEmpty();
+            if (ok) {
+                const QByteArray digest = QCryptographicHash::hash(exact.first(), QCryptographicHash::Sha256);
+                memcpy(hash.bytes, digest.constData(), sizeof(hash.bytes));
+                (command == "add-expression" ? additions : removals).append(hash);
+            }
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            *error = QStringLiteral("Line %1 is not a valid update command").arg(lineNumber);
+            return QSharedPointer<const SafeBrowsingDatabase>();
+        }
+    }
+    if (version <= current.m_version) {
+        *error = QStringLiteral("Update version %1 is not newer than %2").arg(version).arg(current.m_version);
+        return QSharedPointer<const SafeBrowsingDatabase>();
+    }
+    sortUnique(additions);
+    sortUnique(removals);
+
+    // Merge the sorted lists straight into the new file
+    const QString storagePath = current.m_storagePath;
+    QDir().mkpath(storagePath);
+    QSaveFile hashFile(hashPath(storagePath, version));
+    if (!hashFile.open(QIODevice::WriteOnly)) {
+        *error = hashFile.errorString();
+        return QSharedPointer<const SafeBrowsingDatabase>();
+    }
+    HashHeader hashHeader;
+    memcpy(hashHeader.magic, HashMagic, sizeof(HashMagic));
+    hashHeader.format = FormatVersion;
+    hashHeader.reserved = 0;
+    hashHeader.version = version;
+    hashHeader.count = 0;
+    hashFile.write(reinterpret_cast<const char *>(&hashHeader), sizeof(hashHeader));
+
+    const FullHash *listed = reinterpret_cast<const FullHash *>(current.m_hashes);
+    const qint64 listedCount = reset ? 0 : current.m_hashCount;
+    QVector<quint32> prefixes;
+    prefixes.reserve(int(listedCount) + additions.size());
+    QByteArray chunk;
+    chunk.reserve(WriteChunkSize + HashSize);
+    qint64 i = 0;
+    int j = 0;
+    int k = 0;
+    while (i < listedCount || j < additions.size()) {
+        const FullHash *next;
+        if (j == additions.size() || (i < listedCount && listed[i] < additions[j])) {
+            next = &listed[i++];
+        } else {
+            if (i < listedCount && listed[i] == additions[j]) {
+                ++i;
+            }
+            next = &additions[j++];
+        }
+        while (k < removals.size() && removals[k] < *next) {
+            ++k;
+        }
+        if (k < removals.size() && removals[k] == *next) {
+            continue;
+        }
+
+        chunk.append(reinterpret_cast<const char *>(next->bytes), HashSize);
+        prefixes.append(prefixOf(next->bytes));
+        ++hashHeader.count;
+        if (chunk.size() >= WriteChunkSize) {
+            hashFile.write(chunk);
+            chunk.clear();
+        }
+    }
+    hashFile.write(chunk);
+    hashFile.seek(0);
+    hashFile.write(reinterpret_cast<const char *>(&hashHeader), sizeof(hashHeader));
+
+    QVector<HashPrefixSet::Block> blocks;
+    QVector<quint64> words;
+    PrefixHeader prefixHeader;
+    memcpy(prefixHeader.magic, PrefixMagic, sizeof(PrefixMagic));
+    prefixHeader.format = FormatVersion;
+    prefixHeader.count = HashPrefixSet::build(prefixes, blocks, words);
+    prefixHeader.version = version;
+    prefixHeader.blockCount = quint32(blocks.size());
+    prefixHeader.wordCount = quint32(words.size());
+    QSaveFile prefixFile(prefixPath(storagePath, version));
+    if (prefixFile.open(QIODevice::WriteOnly)) {
+        prefixFile.write(reinterpret_cast<const char *>(&prefixHeader), sizeof(prefixHeader));
+        prefixFile.write(reinterpret_cast<const char *>(blocks.constData()), blocks.size() * qint64(sizeof(HashPrefixSet::Block)));
+        prefixFile.write(reinterpret_cast<const char *>(words.constData()), words.size() * qint64(sizeof(quint64)));
+    }
+    // The prefixes go last; open() skips a version without them
+    if (!hashFile.commit() || !prefixFile.commit()) {
+        *error = QStringLiteral("Could not write Safe Browsing version %1").arg(version);
+        removeVersion(storagePath, version);
+        return QSharedPointer<const SafeBrowsingDatabase>();
+    }
+
+    QSharedPointer<SafeBrowsingDatabase> database(new SafeBrowsingDatabase);
+    database->m_storagePath = storagePath;
+    if (!database->load(storagePath, version)) {
+        *error = QStringLiteral("Could not open Safe Browsing version %1").arg(version);
+        return QSharedPointer<const SafeBrowsingDatabase>();
+    }
+    // |current| still maps its own version
+    for (quint64 stored : storedVersions(storagePath)) {
+        if (stored < current.m_version) {
+            removeVersion(storagePath, stored);
+        }
+    }
+    return database;
+}
+
+QVector<QByteArray> SafeBrowsingDatabase::expressions(const QUrl &url)
+{
+    QVector<QByteArray> expressions;
+    QByteArray host = url.host(QUrl::FullyEncoded).toLatin1().toLower();
+    // Stray dots do not make a different host
+    while (host.contains("..")) {
+        host.replace("..", ".");
+    }
+    while (host.startsWith('.')) {
+        host.remove(0, 1);
+    }
+    while (host.endsWith('.')) {
+        host.chop(1);
+    }
+    if (host.isEmpty()) {
+        return expressions;
+    }
+
+    QVector<QByteArray> hosts;
+    hosts.append(host);
+    if (!isAddress(host)) {
+        const QList<QByteArray> labels = host.split('.');
+        for (int first = qMax(1, labels.size() - MaxHostLabels); first < labels.size() - 1; ++first) {
+            hosts.append(labels.mid(first).join('.'));
+        }
+    }
+
+    QByteArray path = url.adjusted(QUrl::NormalizePathSegments).path(QUrl::FullyEncoded).toLatin1();
+    if (!path.startsWith('/')) {
+        path.prepend('/');
+    }
+    while (path.contains("//")) {
+        path.replace("//", "/");
+    }
+    QVector<QByteArray> paths;
+    if (url.hasQuery()) {
+        paths.append(path + '?' + url.query(QUrl::FullyEncoded).toLatin1());
+    }
+    paths.append(path);
+    for (int slash = 0, count = 0; slash >= 0 && count < MaxPathPrefixes; slash = path.indexOf('/', slash + 1), ++count) {
+        const QByteArray prefix = path.left(slash + 1);
+        if (!paths.contains(prefix)) {
+            paths.append(prefix);
+        }
+    }
+
+    expressions.reserve(hosts.size() * paths.size());
+    for (const QByteArray &expressionHost : hosts) {
+        for (const QByteArray &expressionPath : paths) {
+            expressions.append(expressionHost + expressionPath);
+        }
+    }
+    return expressions;
+}
+
+QByteArray SafeBrowsingDatabase::match(const QUrl &url) const
+{
+    if (!m_hashCount) {
+        return QByteArray();
+    }
+    for (const QByteArray &expression : expressions(url)) {
+        const QByteArray hash = QCryptographicHash::hash(expression, QCryptographicHash::Sha256);
+        if (m_prefixes.contains(prefixOf(reinterpret_cast<const uchar *>(hash.constData())))
+            && containsHash(hash.constData())) {
+            return expression;
+        }
+    }
+    return QByteArray();
+}
+
+bool SafeBrowsingDatabase::containsHash(const char *hash) const
+{
+    const FullHash *hashes = reinterpret_cast<const FullHash *>(m_hashes);
+    const FullHash *end = hashes + m_hashCount;
+    const FullHash &key = *reinterpret_cast<const FullHash *>(hash);
+    const FullHash *found = std::lower_bound(hashes, end, key);
+    return found != end && *found == key;
+}
+
+quint64 SafeBrowsingDatabase::version() const
+{
+    return m_version;
+}
+
+qint64 SafeBrowsingDatabase::hashCount() const
+{
+    return m_hashCount;
+}
+
+qint64 SafeBrowsingDatabase::memoryUsage() const
+{
+    return m_prefixes.size();
+}
+
+bool SafeBrowsingDatabase::load(const QString &storagePath, quint64 version)
+{
+    QScopedPointer<QFile> hashFile(new QFile(hashPath(storagePath, version)));
+    QScopedPointer<QFile> prefixFile(new QFile(prefixPath(storagePath, version)));
+    if (!hashFile->open(QIODevice::ReadOnly) || !prefixFile->open(QIODevice::ReadOnly)
+        || hashFile->size() < qint64(sizeof(HashHeader)) || prefixFile->size() < qint64(sizeof(PrefixHeader))) {
+        return false;
+    }
+    uchar *hashData = hashFile->map(0, hashFile->size());
+    uchar *prefixData = prefixFile->map(0, prefixFile->size());
+    if (!hashData || !prefixData) {
+        return false;
+    }
+
+    const HashHeader *hashHeader = reinterpret_cast<const HashHeader *>(hashData);
+    const PrefixHeader *prefixHeader = reinterpret_cast<const PrefixHeader *>(prefixData);
+    const HashPrefixSet::Block *blocks = reinterpret_cast<const HashPrefixSet::Block *>(prefixData + sizeof(PrefixHeader));
+    const quint64 *words = reinterpret_cast<const quint64 *>(blocks + prefixHeader->blockCount);
+    HashPrefixSet prefixes;
+    const bool valid = memcmp(hashHeader->magic, HashMagic, sizeof(HashMagic)) == 0
+        && hashHeader->format == FormatVersion && hashHeader->version == version
+        && quint64(hashFile->size()) == sizeof(HashHeader) + hashHeader->count * HashSize
+        && memcmp(prefixHeader->magic, PrefixMagic, sizeof(PrefixMagic)) == 0
+        && prefixHeader->format == FormatVersion && prefixHeader->version == version
+        && quint64(prefixFile->size()) == sizeof(PrefixHeader) + (quint64(prefixHeader->blockCount) + prefixHeader->wordCount) * 8
+        && prefixes.attach(blocks, prefixHeader->blockCount, words, prefixHeader->wordCount, prefixHeader->count);
+    if (!valid) {
+        hashFile->unmap(hashData);
+        prefixFile->unmap(prefixData);
+        return false;
+    }
+
+    m_version = version;
+    m_hashes = hashData + sizeof(HashHeader);
+    m_hashCount = qint64(hashHeader->count);
+    m_prefixData = prefixData;
+    m_prefixes = prefixes;
+    m_hashFile.swap(hashFile);
+    m_prefixFile.swap(prefixFile);
+    return true;
+}
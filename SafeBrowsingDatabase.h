@@ -0,0 +1,74 @@
+// SafeBrowsingDatabase.h
+
+#ifndef SAFEBROWSINGDATABASE_H
+#define SAFEBROWSINGDATABASE_H
+
+#include <QByteArray>
+#include <QScopedPointer>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+
+#include "HashPrefixSet.h"
+
+class QFile;
+class QUrl;
+
+// Local list of malicious URLs in the Safe Browsing style: SHA-256 hashes
+// of host/path expressions. The hashes' 32-bit prefixes sit in a compressed
+// HashPrefixSet that rules out almost every URL; only a prefix hit reads
+// the sorted full hashes, which stay on disk. Both files are mapped. Never
+// modified once opened; an update writes the next version beside it.
+//
+// Updates are text diffs, one command per line:
+//
+//   version 42                  required, above the current version
+//   reset                       drops the current list first
+//   add <hex SHA-256>           remove <hex SHA-256>
+//   add-expression <host/path>  remove-expression <host/path>
+class SafeBrowsingDatabase
+{
+public:
+    static const int HashSize = 32;
+
+    ~SafeBrowsingDatabase();
+
+    // Newest complete version under |storagePath|, or an empty list
+    static QSharedPointer<const SafeBrowsingDatabase> open(const QString &storagePath);
+
+    // Writes |current| with |diff| applied as a new version and opens it.
+    // Reads the whole list; call it off the GUI thread. Returns null and
+    // sets |error| when the diff is rejected or cannot be written.
+    static QSharedPointer<const SafeBrowsingDatabase> update(const SafeBrowsingDatabase &current, const QByteArray &diff,
+                                                             QString *error);
+
+    // Host/path expressions |url| is checked as, most specific first; at
+    // most five hosts times six paths
+    static QVector<QByteArray> expressions(const QUrl &url);
+
+    // First listed expression of |url|, or empty
+    QByteArray match(const QUrl &url) const;
+    bool containsHash(const char *hash) const;
+
+    quint64 version() const;
+    qint64 hashCount() const;
+    // The prefix set; the full hashes are only paged in on hits
+    qint64 memoryUsage() const;
+
+private:
+    SafeBrowsingDatabase();
+    Q_DISABLE_COPY(SafeBrowsingDatabase)
+
+    bool load(const QString &storagePath, quint64 version);
+
+    QString m_storagePath;
+    quint64 m_version;
+    QScopedPointer<QFile> m_hashFile;
+    QScopedPointer<QFile> m_prefixFile;
+    const uchar *m_hashes;
+    qint64 m_hashCount;
+    const uchar *m_prefixData;
+    HashPrefixSet m_prefixes;
+};
+
+#endif // SAFEBROWSINGDATABASE_H
@@ -0,0 +1,140 @@
+// SafeBrowsingService.cpp
+
+#include "SafeBrowsingService.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QFutureWatcher>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QTimer>
+#include <QUrlQuery>
+#include <QtConcurrent>
+
+namespace {
+
+const int UpdateInterval = 30 * 60 * 1000;
+
+} // namespace
+
+SafeBrowsingService::SafeBrowsingService(const QString &storagePath, QObject *parent)
+    : QObject(parent)
+    , m_networkManager(new QNetworkAccessManager(this))
+    , m_updateTimer(new QTimer(this))
+    , m_database(SafeBrowsingDatabase::open(storagePath))
+    , m_updating(false)
+{
+    // Opening only maps the files, so it stays on the GUI thread
+    m_updateTimer->setInterval(UpdateInterval);
+    connect(m_updateTimer, &QTimer::timeout, this, &SafeBrowsingService::update);
+}
+
+void SafeBrowsingService::setUpdateUrl(const QUrl &url)
+{
+    m_updateUrl = url;
+    if (!url.isValid()) {
+        m_updateTimer->stop();
+        return;
+    }
+    m_updateTimer->start();
+    update();
+}
+
+QUrl SafeBrowsingService::updateUrl() const
+{
+    return m_updateUrl;
+}
+
+QSharedPointer<const SafeBrowsingDatabase> SafeBrowsingService::database() const
+{
+    return m_database;
+}
+
+QByteArray SafeBrowsingService::match(const QUrl &url) const
+{
+    return m_database->match(url);
+}
+
+void SafeBrowsingService::update()
+{
+    if (m_updating || !m_updateUrl.isValid()) {
+        return;
+    }
+    m_updating = true;
+
+    // A local diff is applied again only once it changes
+    if (m_updateUrl.isLocalFile()) {
+        const QFileInfo info(m_updateUrl.toLocalFile());
+        if (info.lastModified() == m_localFileModified) {
+            m_updating = false;
+            return;
+        }
+        startUpdate(QByteArray(), info.filePath());
+        return;
+    }
+
+    // The server answers with the diff from our version, or nothing
+    QUrl url = m_updateUrl;
+    QUrlQuery query(url);
+    query.removeAllQueryItems(QStringLiteral("version"));
+    query.addQueryItem(QStringLiteral("version"), QString::number(m_database->version()));
+    url.setQuery(query);
+
+    QNetworkRequest request(url);
+    request.setAttribute(QNetworkRequest::RedirectPolicyAttribute, QNetworkRequest::NoLessSafeRedirectPolicy);
+    QNetworkReply *reply = m_networkManager->get(request);
+    connect(reply, &QNetworkReply::finished, this, [this, reply]() { handleReply(reply); });
+}
+
+SafeBrowsingService::UpdateResult SafeBrowsingService::applyDiff(QSharedPointer<const SafeBrowsingDatabase> current,
+                                                                 QByteArray diff, const QString &localFile)
+{
+    UpdateResult result;
+    if (!localFile.isEmpty()) {
+        QFile file(localFile);
+        if (!file.open(QIODevice::ReadOnly)) {
+            result.error = file.errorString();
+            return result;
+        }
+        diff = file.readAll();
+    }
+    result.database = SafeBrowsingDatabase::update(*current, diff, &result.error);
+    return result;
+}
+
+void SafeBrowsingService::handleReply(QNetworkReply *reply)
+{
+    reply->deleteLater();
+    if (reply->error() != QNetworkReply::NoError) {
+        m_updating = false;
+        emit updateFailed(reply->errorString());
+        return;
+    }
+    const QByteArray diff = reply->readAll();
+    if (diff.trimmed().isEmpty()) {
+        m_updating = false;
+        return;
+    }
+    startUpdate(diff, QString());
+}
+
+void SafeBrowsingService::startUpdate(const QByteArray &diff, const QString &localFile)
+{
+    // The job holds on to the current version, which stays mapped
+    QFutureWatcher<UpdateResult> *watcher = new QFutureWatcher<UpdateResult>(this);
+    const QDateTime modified = localFile.isEmpty() ? QDateTime() : QFileInfo(localFile).lastModified();
+    connect(watcher, &QFutureWatcher<UpdateResult>::finished, this, [this, watcher, modified]() {
+        const UpdateResult result = watcher->result();
+        watcher->deleteLater();
+        m_updating = false;
+        // A rejected file is not retried until it changes either
+        m_localFileModified = modified;
+        if (!result.database) {
+            emit updateFailed(result.error);
+            return;
+        }
+        m_database = result.database;
+        emit updated(m_database->version());
+    });
+    watcher->setFuture(QtConcurrent::run(&SafeBrowsingService::applyDiff, m_database, diff, localFile));
+}
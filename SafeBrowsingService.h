@@ -0,0 +1,65 @@
+// SafeBrowsingService.h
+
+#ifndef SAFEBROWSINGSERVICE_H
+#define SAFEBROWSINGSERVICE_H
+
+#include <QDateTime>
+#include <QObject>
+#include <QSharedPointer>
+#include <QString>
+#include <QUrl>
+
+#include "SafeBrowsingDatabase.h"
+
+class QNetworkAccessManager;
+class QNetworkReply;
+class QTimer;
+
+// Keeps the local Safe Browsing list current. Diffs come from a file://
+// URL or a server asked for ?version=<current>; an empty reply means no
+// change. Diffs are applied off the GUI thread and the new version swapped
+// in when done; lookups never touch the network.
+class SafeBrowsingService : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit SafeBrowsingService(const QString &storagePath, QObject *parent = nullptr);
+
+    // Updates start at once and repeat every half hour
+    void setUpdateUrl(const QUrl &url);
+    QUrl updateUrl() const;
+
+    QSharedPointer<const SafeBrowsingDatabase> database() const;
+
+    // Listed expression |url| matched, or empty
+    QByteArray match(const QUrl &url) const;
+
+public slots:
+    void update();
+
+signals:
+    void updated(quint64 version);
+    void updateFailed(const QString &error);
+
+private:
+    struct UpdateResult {
+        QSharedPointer<const SafeBrowsingDatabase> database;
+        QString error;
+    };
+
+    // |diff|, or the contents of |localFile| when it is set
+    static UpdateResult applyDiff(QSharedPointer<const SafeBrowsingDatabase> current, QByteArray diff,
+                                  const QString &localFile);
+    void handleReply(QNetworkReply *reply);
+    void startUpdate(const QByteArray &diff, const QString &localFile);
+
+    QNetworkAccessManager *m_networkManager;
+    QTimer *m_updateTimer;
+    QUrl m_updateUrl;
+    QDateTime m_localFileModified;
+    QSharedPointer<const SafeBrowsingDatabase> m_database;
+    bool m_updating;
+};
+
+#endif // SAFEBROWSINGSERVICE_H
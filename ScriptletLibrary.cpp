@@ -0,0 +1,280 @@
+// ScriptletLibrary.cpp
+
+#include "ScriptletLibrary.h"
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonValue>
+
+namespace {
+
+struct Scriptlet {
+    const char *name;
+    const char *aliases[3];
+    // Name of the function |source| defines
+    const char *function;
+    const char *source;
+};
+
+// Helpers every bundle carries. A needle is a substring or /regex/, and a
+// leading ! inverts it; a chain is a dotted property path from window whose
+// missing links are waited for.
+const char Prelude[] = R"JS(
+function matcher(needle) {
+    if (!needle) {
+        return function() { return true; };
+    }
+    var negated = needle.charAt(0) === '!';
+    if (negated) {
+        needle = needle.slice(1);
+    }
+    var test;
+    var regex = /^\/(.+)\/([gimsu]*)$/.exec(needle);
+    if (regex) {
+        var pattern = new RegExp(regex[1], regex[2].replace('g', ''));
+        test = function(text) { return pattern.test(text); };
+    } else {
+        test = function(text) { return text.indexOf(needle) !== -1; };
+    }
+    return function(text) { return test(String(text)) !== negated; };
+}
+function trapChain(chain, onLeaf) {
+    var trap = function(owner, parts) {
+        var name = parts[0];
+        if (parts.length === 1) {
+            onLeaf(owner, name);
+            return;
+        }
+        var value = owner[name];
+        if (value instanceof Object) {
+            trap(value, parts.slice(1));
+            return;
+        }
+        Object.defineProperty(owner, name, {
+            configurable: true,
+            get: function() { return value; },
+            set: function(next) {
+                value = next;
+                if (next instanceof Object) {
+                    trap(next, parts.slice(1));
+                }
+            }
+        });
+    };
+    trap(window, chain.split('.'));
+}
+function preventTimer(method, needle, delay) {
+    var matches = matcher(needle);
+    var negatedDelay = !!delay && delay.charAt(0) === '!';
+    var wanted = delay ? parseInt(negatedDelay ? delay.slice(1) : delay, 10) : NaN;
+    window[method] = new Proxy(window[method], {
+        apply: function(target, self, args) {
+            var delayMatches = isNaN(wanted) || ((Number(args[1]) === wanted) !== negatedDelay);
+            if (delayMatches && matches(args[0])) {
+                args[0] = function() {};
+            }
+            return Reflect.apply(target, self, args);
+        }
+    });
+}
+)JS";
+
+const Scriptlet Scriptlets[] = {
+    { "set-constant", { "set", nullptr, nullptr }, "setConstant", R"JS(
+function setConstant(chain, value) {
+    var constants = {
+        'undefined': undefined, 'null': null, 'true': true, 'false': false, '': '', 'emptyStr': '',
+        'noopFunc': function() {}, 'trueFunc': function() { return true; },
+        'falseFunc': function() { return false; }, 'emptyObj': {}, 'emptyArr': []
+    };
+    var constant;
+    if (Object.prototype.hasOwnProperty.call(constants, String(value))) {
+        constant = constants[String(value)];
+    } else if (/^-?\d+$/.test(value) && Math.abs(Number(value)) <= 0x7fff) {
+        constant = Number(value);
+    } else {
+        return;
+    }
+    trapChain(chain, function(owner, name) {
+        Object.defineProperty(owner, name, {
+            configurable: false,
+            get: function() { return constant; },
+            set: function() {}
+        });
+    });
+}
+)JS" },
+    { "abort-on-property-read", { "aopr", nullptr, nullptr }, "abortOnPropertyRead", R"JS(
+function abortOnPropertyRead(chain) {
+    trapChain(chain, function(owner, name) {
+        Object.defineProperty(owner, name, {
+            configurable: false,
+            get: function() { throw new ReferenceError(name); },
+            set: function() {}
+        });
+    });
+}
+)JS" },
+    { "abort-on-property-write", { "aopw", nullptr, nullptr }, "abortOnPropertyWrite", R"JS(
+function abortOnPropertyWrite(chain) {
+    trapChain(chain, function(owner, name) {
+        var value = owner[name];
+        Object.defineProperty(owner, name, {
+            configurable: false,
+            get: function() { return value; },
+            set: function() { throw new ReferenceError(name); }
+        });
+    });
+}
+)JS" },
+    { "abort-current-inline-script", { "acis", nullptr, nullptr }, "abortCurrentInlineScript", R"JS(
+function abortCurrentInlineScript(chain, needle) {
+    var matches = matcher(needle);
+    trapChain(chain, function(owner, name) {
+        var value = owner[name];
+        var check = function() {
+            var script = document.currentScript;
+            if (script instanceof HTMLScriptElement && !script.src && matches(script.textContent)) {
+                throw new ReferenceError(name);
+            }
+        };
+        Object.defineProperty(owner, name, {
+            configurable: true,
+            get: function() { check(); return value; },
+            set: function(next) { check(); value = next; }
+        });
+    });
+}
+)JS" },
+    { "no-setTimeout-if", { "nostif", "prevent-setTimeout", "setTimeout-defuser" }, "noSetTimeoutIf", R"JS(
+function noSetTimeoutIf(needle, delay) {
+    preventTimer('setTimeout', needle, delay);
+}
+)JS" },
+    { "no-setInterval-if", { "nosiif", "prevent-setInterval", "setInterval-defuser" }, "noSetIntervalIf", R"JS(
+function noSetIntervalIf(needle, delay) {
+    preventTimer('setInterval', needle, delay);
+}
+)JS" },
+    { "prevent-addEventListener", { "aeld", "addEventListener-defuser", nullptr }, "preventAddEventListener", R"JS(
+function preventAddEventListener(type, needle) {
+    if (!type && !needle) {
+        return;
+    }
+    var matchesType = matcher(type);
+    var matchesHandler = matcher(needle);
+    EventTarget.prototype.addEventListener = new Proxy(EventTarget.prototype.addEventListener, {
+        apply: function(target, self, args) {
+            if (matchesType(args[0]) && matchesHandler(args[1])) {
+                return undefined;
+            }
+            return Reflect.apply(target, self, args);
+        }
+    });
+}
+)JS" },
+    { "prevent-window-open", { "nowoif", "window.open-defuser", nullptr }, "preventWindowOpen", R"JS(
+function preventWindowOpen(needle) {
+    var matches = matcher(needle);
+    window.open = new Proxy(window.open, {
+        apply: function(target, self, args) {
+            if (matches(args[0] || '')) {
+                return null;
+            }
+            return Reflect.apply(target, self, args);
+        }
+    });
+}
+)JS" },
+    { "noeval", { "silent-noeval", nullptr, nullptr }, "noEval", R"JS(
+function noEval() {
+    window.eval = new Proxy(window.eval, {
+        apply: function() { return undefined; }
+    });
+}
+)JS" },
+    { "remove-attr", { "ra", nullptr, nullptr }, "removeAttr", R"JS(
+function removeAttr(attributes, selector) {
+    var names = String(attributes || '').split(/\s*\|\s*/).filter(Boolean);
+    if (!names.length) {
+        return;
+    }
+    var query = selector || names.map(function(name) { return '[' + name + ']'; }).join(',');
+    var remove = function() {
+        document.querySelectorAll(query).forEach(function(element) {
+            names.forEach(function(name) { element.removeAttribute(name); });
+        });
+    };
+    remove();
+    new MutationObserver(remove).observe(document, {
+        childList: true, subtree: true, attributes: true, attributeFilter: names
+    });
+}
+)JS" },
+};
+
+const int ScriptletCount = int(sizeof(Scriptlets) / sizeof(Scriptlets[0]));
+
+int findScriptlet(const QString &name)
+{
+    // Lists write both "set" and "set.js"
+    QString key = name.trimmed();
+    if (key.endsWith(QLatin1String(".js"))) {
+        key.chop(3);
+    }
+    for (int i = 0; i < ScriptletCount; ++i) {
+        const Scriptlet &scriptlet = Scriptlets[i];
+        if (key == QLatin1String(scriptlet.name)) {
+            return i;
+        }
+        for (const char *alias : scriptlet.aliases) {
+            if (alias && key == QLatin1String(alias)) {
+                return i;
+            }
+        }
+    }
+    return -1;
+}
+
+} // namespace
+
+QString ScriptletLibrary::canonicalName(const QString &name)
+{
+    const int scriptlet = findScriptlet(name);
+    return scriptlet >= 0 ? QString::fromLatin1(Scriptlets[scriptlet].name) : QString();
+}
+
+QString ScriptletLibrary::bundle(const QString &host, const QVector<QByteArray> &calls)
+{
+    QVector<bool> used(ScriptletCount, false);
+    QString invocations;
+    for (const QByteArray &call : calls) {
+        QJsonArray arguments = QJsonDocument::fromJson(call).array();
+        const int scriptlet = arguments.isEmpty() ? -1 : findScriptlet(arguments.takeAt(0).toString());
+        if (scriptlet < 0) {
+            continue;
+        }
+        used[scriptlet] = true;
+        // One failing scriptlet must not keep the others from running
+        invocations += QStringLiteral("try { %1.apply(null, %2); } catch (e) {}\n")
+                           .arg(QLatin1String(Scriptlets[scriptlet].function),
+                                QString::fromUtf8(QJsonDocument(arguments).toJson(QJsonDocument::Compact)));
+    }
+    if (invocations.isEmpty()) {
+        return QString();
+    }
+
+    // The script also runs in frames of other sites
+    const QString quotedHost = QString::fromUtf8(QJsonDocument(QJsonArray{ host }).toJson(QJsonDocument::Compact));
+    QString script = QStringLiteral("(function(host) {\n'use strict';\n"
+                                    "if (location.hostname !== host && !location.hostname.endsWith('.' + host)) {\n"
+                                    "    return;\n}\n");
+    script += QLatin1String(Prelude);
+    for (int i = 0; i < ScriptletCount; ++i) {
+        if (used[i]) {
+            script += QLatin1String(Scriptlets[i].source);
+        }
+    }
+    script += invocations;
+    script += QStringLiteral("})(%1[0]);\n").arg(quotedHost);
+    return script;
+}
@@ -0,0 +1,27 @@
+// ScriptletLibrary.h
+
+#ifndef SCRIPTLETLIBRARY_H
+#define SCRIPTLETLIBRARY_H
+
+#include <QByteArray>
+#include <QString>
+#include <QVector>
+
+// The scriptlets +js() rules may call: small page-world functions that
+// defuse anti-adblock and tracking code, such as pinning a property to a
+// constant or dropping matching timers. Rules refer to them by uBlock
+// Origin's names and aliases.
+class ScriptletLibrary
+{
+public:
+    // Canonical name of the scriptlet |name| refers to; empty when there
+    // is no such scriptlet
+    static QString canonicalName(const QString &name);
+
+    // One script running |calls| on pages of |host| and its subdomains.
+    // Each call is a JSON array of the canonical name and its arguments.
+    // Only the scriptlets the calls use are included.
+    static QString bundle(const QString &host, const QVector<QByteArray> &calls);
+};
+
+#endif // SCRIPTLETLIBRARY_H
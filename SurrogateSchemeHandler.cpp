@@ -0,0 +1,79 @@
+// SurrogateSchemeHandler.cpp
+
+#include "SurrogateSchemeHandler.h"
+#include <QBuffer>
+#include <QWebEngineUrlRequestJob>
+#include <cstring>
+
+namespace {
+
+struct Surrogate {
+    const char *name;
+    // Names filter lists use for the same resource
+    const char *aliases[2];
+    const char *mimeType;
+    // Base64, so binary images fit in a string literal
+    const char *data;
+};
+
+const Surrogate Surrogates[] = {
+    { "noop.js", { "noopjs", "noop-js" }, "application/javascript", "KGZ1bmN0aW9uKCkgeyAndXNlIHN0cmljdCc7IH0pKCk7" },
+    { "noop.html", { "noopframe", "noop-html" }, "text/html", "PCFET0NUWVBFIGh0bWw+PGh0bWw+PGhlYWQ+PC9oZWFkPjxib2R5PjwvYm9keT48L2h0bWw+" },
+    { "noop.txt", { "nooptext", "noop-txt" }, "text/plain", "" },
+    { "noop.json", { "noopjson", nullptr }, "application/json", "e30=" },
+    { "noop.css", { "noopcss", nullptr }, "text/css", "" },
+    { "empty", { nullptr, nullptr }, "text/plain", "" },
+    { "1x1.gif", { "1x1-transparent.gif", "1x1-transparent-gif" }, "image/gif",
+      "R0lGODlhAQABAIAAAAAAAP///yH5BAEAAAAALAAAAAABAAEAAAIBRAA7" },
+    { "2x2.png", { "2x2-transparent.png", nullptr }, "image/png",
+      "iVBORw0KGgoAAAANSUhEUgAAAAIAAAACCAYAAABytg0kAAAAC0lEQVR42mNgQAcAABIAAeRVjecAAAAASUVORK5CYII=" },
+};
+
+const char *const SurrogatePath = "surrogate/";
+
+const Surrogate *findSurrogate(const char *name, int length)
+{
+    auto equals = [name, length](const char *candidate) {
+        return candidate && int(qstrlen(candidate)) == length && qstrnicmp(candidate, name, uint(length)) == 0;
+    };
+    for (const Surrogate &surrogate : Surrogates) {
+        if (equals(surrogate.name) || equals(surrogate.aliases[0]) || equals(surrogate.aliases[1])) {
+            return &surrogate;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+SurrogateSchemeHandler::SurrogateSchemeHandler(QObject *parent)
+    : QWebEngineUrlSchemeHandler(parent)
+{
+}
+
+QUrl SurrogateSchemeHandler::surrogateUrl(const QByteArray &name)
+{
+    const Surrogate *surrogate = findSurrogate(name.constData(), name.size());
+    if (!surrogate) {
+        return QUrl();
+    }
+    return QUrl(QStringLiteral("browser:") + QLatin1String(SurrogatePath) + QLatin1String(surrogate->name));
+}
+
+void SurrogateSchemeHandler::requestStarted(QWebEngineUrlRequestJob *job)
+{
+    const QByteArray path = job->requestUrl().path().toUtf8();
+    const int prefixLength = int(strlen(SurrogatePath));
+    const Surrogate *surrogate = path.startsWith(SurrogatePath)
+        ? findSurrogate(path.constData() + prefixLength, path.size() - prefixLength)
+        : nullptr;
+    if (!surrogate) {
+        job->fail(QWebEngineUrlRequestJob::UrlNotFound);
+        return;
+    }
+
+    // The job owns the buffer and frees it with the request
+    QBuffer *buffer = new QBuffer(job);
+    buffer->setData(QByteArray::fromBase64(surrogate->data));
+    job->reply(surrogate->mimeType, buffer);
+}
@@ -0,0 +1,27 @@
+// SurrogateSchemeHandler.h
+
+#ifndef SURROGATESCHEMEHANDLER_H
+#define SURROGATESCHEMEHANDLER_H
+
+#include <QWebEngineUrlSchemeHandler>
+#include <QUrl>
+
+// Serves the harmless stand-ins that $redirect filters substitute for
+// blocked resources, such as an empty script or a transparent pixel, as
+// browser:surrogate/<name>. Pages that expect the resource keep working
+// without it ever being fetched.
+class SurrogateSchemeHandler : public QWebEngineUrlSchemeHandler
+{
+    Q_OBJECT
+
+public:
+    explicit SurrogateSchemeHandler(QObject *parent = nullptr);
+
+    // URL serving the surrogate known as |name|, aliases included; invalid
+    // for names there is no surrogate for. Safe on any thread.
+    static QUrl surrogateUrl(const QByteArray &name);
+
+    void requestStarted(QWebEngineUrlRequestJob *job) override;
+};
+
+#endif // SURROGATESCHEMEHANDLER_H
@@ -0,0 +1,213 @@
+// UrlScanner.cpp
+
+#include "UrlScanner.h"
+#include <QVarLengthArray>
+#include <QtAlgorithms>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+const int BlockSize = 64;
+
+#if defined(__AVX2__)
+
+// Bytes in [first, first + count), via a shift into the signed range
+inline __m256i inRange(__m256i bytes, char first, char count)
+{
+    const __m256i shifted = _mm256_add_epi8(bytes, _mm256_set1_epi8(char(0x80 - first)));
+    return _mm256_cmpgt_epi8(_mm256_set1_epi8(char(0x80 + count)), shifted);
+}
+
+// Lowercases one block and returns a bit per byte that is a token
+// character afterwards
+quint64 lowerBlock(const char *in, char *out)
+{
+    quint64 mask = 0;
+    for (int i = 0; i < BlockSize; i += 32) {
+        const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+        const __m256i upper = inRange(bytes, 'A', 26);
+        const __m256i lower = _mm256_or_si256(bytes, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), lower);
+        const __m256i token = _mm256_or_si256(_mm256_or_si256(inRange(lower, 'a', 26), inRange(lower, '0', 10)),
+                                              _mm256_cmpeq_epi8(lower, _mm256_set1_epi8('%')));
+        mask |= quint64(quint32(_mm256_movemask_epi8(token))) << i;
+    }
+    return mask;
+}
+
+#elif defined(__SSE2__)
+
+inline __m128i inRange(__m128i bytes, char first, char count)
+{
+    const __m128i shifted = _mm_add_epi8(bytes, _mm_set1_epi8(char(0x80 - first)));
+    return _mm_cmplt_epi8(shifted, _mm_set1_epi8(char(0x80 + count)));
+}
+
+quint64 lowerBlock(const char *in, char *out)
+{
+    quint64 mask = 0;
+    for (int i = 0; i < BlockSize; i += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        const __m128i upper = inRange(bytes, 'A', 26);
+        const __m128i lower = _mm_or_si128(bytes, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), lower);
+        const __m128i token = _mm_or_si128(_mm_or_si128(inRange(lower, 'a', 26), inRange(lower, '0', 10)),
+                                           _mm_cmpeq_epi8(lower, _mm_set1_epi8('%')));
+        mask |= quint64(quint32(_mm_movemask_epi8(token))) << i;
+    }
+    return mask;
+}
+
+#else
+
+quint64 lowerBlock(const char *in, char *out)
+{
+    quint64 mask = 0;
+    for (int i = 0; i < BlockSize; ++i) {
+        const char c = in[i];
+        out[i] = (c >= 'A' && c <= 'Z') ? char(c + ('a' - 'A')) : c;
+        if (UrlScanner::isTokenChar(out[i])) {
+            mask |= Q_UINT64_C(1) << i;
+        }
+    }
+    return mask;
+}
+
+#endif
+
+// Lowercases |in| into |out|, which may be |in| itself, and hashes the
+// tokens as it goes. Without |out| the input must be lowercase already and
+// only the tokens are produced.
+int scan(const char *in, int length, char *out, quint32 *tokens, int maxTokens)
+{
+    const char *lowered = out ? out : in;
+    char scratch[BlockSize];
+    int count = 0;
+    int tokenBegin = -1;
+
+    for (int base = 0; base < length; base += BlockSize) {
+        quint64 mask;
+        if (length - base >= BlockSize) {
+            mask = lowerBlock(in + base, out ? out + base : scratch);
+        } else {
+            // The zero padding never reads or writes past either buffer and
+            // ends a token that runs to the end of the URL
+            char tail[BlockSize] = {};
+            memcpy(tail, in + base, size_t(length - base));
+            mask = lowerBlock(tail, scratch);
+            if (out) {
+                memcpy(out + base, scratch, size_t(length - base));
+            }
+        }
+
+        // Walk the runs of set bits; a run may continue into the next block
+        int position = 0;
+        while (count < maxTokens && position < BlockSize) {
+            const quint64 rest = (tokenBegin < 0 ? mask : ~mask) >> position;
+            if (!rest) {
+                break;
+            }
+            position += int(qCountTrailingZeroBits(rest));
+            if (tokenBegin < 0) {
+                tokenBegin = base + position;
+                continue;
+            }
+            const int tokenLength = base + position - tokenBegin;
+            if (tokenLength >= 2) {
+                tokens[count++] = UrlScanner::hashToken(lowered + tokenBegin, tokenLength);
+            }
+            tokenBegin = -1;
+        }
+    }
+
+    if (tokenBegin >= 0 && count < maxTokens && length - tokenBegin >= 2) {
+        tokens[count++] = UrlScanner::hashToken(lowered + tokenBegin, length - tokenBegin);
+    }
+    return count;
+}
+
+} // namespace
+
+UrlScanner::Parts UrlScanner::parse(const char *url, int length)
+{
+    Parts parts;
+    const char *scheme = static_cast<const char *>(memchr(url, ':', size_t(length)));
+    if (!scheme || scheme + 2 >= url + length || scheme[1] != '/' || scheme[2] != '/') {
+        return parts;
+    }
+
+    parts.schemeEnd = int(scheme - url);
+    int begin = parts.schemeEnd + 3;
+    int end = begin;
+    while (end < length && url[end] != '/' && url[end] != '?' && url[end] != '#') {
+        if (url[end] == '@') {
+            begin = end + 1;
+        }
+        ++end;
+    }
+    parts.hostBegin = begin;
+
+    if (begin < end && url[begin] == '[') {
+        const char *bracket = static_cast<const char *>(memchr(url + begin, ']', size_t(end - begin)));
+        parts.hostEnd = bracket ? int(bracket - url) + 1 : end;
+        return parts;
+    }
+    const char *port = static_cast<const char *>(memchr(url + begin, ':', size_t(end - begin)));
+    parts.hostEnd = port ? int(port - url) : end;
+    return parts;
+}
+
+int UrlScanner::lowerAndTokenize(const char *url, int length, char *lowered, quint32 *tokens, int maxTokens)
+{
+    return scan(url, length, lowered, tokens, maxTokens);
+}
+
+int UrlScanner::tokenize(const char *lowered, int length, quint32 *tokens, int maxTokens)
+{
+    return scan(lowered, length, nullptr, tokens, maxTokens);
+}
+
+UrlScanner::Parts UrlScanner::normalize(char *url, int length)
+{
+    const Parts parts = parse(url, length);
+    scan(url, parts.schemeEnd, url, nullptr, 0);
+    scan(url + parts.hostBegin, parts.hostEnd - parts.hostBegin, url + parts.hostBegin, nullptr, 0);
+    return parts;
+}
+
+quint64 UrlScanner::normalizedKey(const char *url, int length)
+{
+    QVarLengthArray<char, 2048> normalized(length);
+    memcpy(normalized.data(), url, size_t(length));
+    normalize(normalized.data(), length);
+
+    // FNV-1a, 64-bit
+    quint64 hash = Q_UINT64_C(0xcbf29ce484222325);
+    for (int i = 0; i < length; ++i) {
+        hash ^= quint8(normalized[i]);
+        hash *= Q_UINT64_C(0x100000001b3);
+    }
+    return hash;
+}
+
+quint32 UrlScanner::hashToken(const char *begin, int length)
+{
+    // FNV-1a; zero marks an empty index slot
+    quint32 hash = 2166136261u;
+    for (int i = 0; i < length; ++i) {
+        hash ^= quint8(begin[i]);
+        hash *= 16777619u;
+    }
+    return hash ? hash : 1;
+}
+
+bool UrlScanner::isTokenChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '%';
+}
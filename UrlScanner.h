@@ -0,0 +1,45 @@
+// UrlScanner.h
+
+#ifndef URLSCANNER_H
+#define URLSCANNER_H
+
+#include <QtGlobal>
+
+// Allocation-free URL helpers for the request path. They work on the
+// encoded UTF-8 bytes directly and process 64 bytes per step with AVX2 or
+// SSE2 where the compiler targets them, falling back to plain loops.
+class UrlScanner
+{
+public:
+    // Offsets into an encoded URL. Without a "scheme://" prefix the scheme
+    // and host are empty.
+    struct Parts {
+        int schemeEnd = 0;
+        int hostBegin = 0;
+        int hostEnd = 0;
+    };
+
+    // Finds scheme and host, skipping user info and port
+    static Parts parse(const char *url, int length);
+
+    // Writes the ASCII-lowercased URL to |lowered| and the hashes of its
+    // filter tokens to |tokens|, as AdBlockEngine indexes them. Returns the
+    // number of hashes, at most |maxTokens|; |lowered| is always complete.
+    static int lowerAndTokenize(const char *url, int length, char *lowered, quint32 *tokens, int maxTokens);
+
+    // Same tokens for a URL that is lowercase already
+    static int tokenize(const char *lowered, int length, quint32 *tokens, int maxTokens);
+
+    // Lowercases scheme and host in place; path and user info keep their
+    // case
+    static Parts normalize(char *url, int length);
+
+    // 64-bit hash of the URL with scheme and host lowercased, so spellings
+    // that differ only there share a key
+    static quint64 normalizedKey(const char *url, int length);
+
+    static quint32 hashToken(const char *begin, int length);
+    static bool isTokenChar(char c);
+};
+
+#endif // URLSCANNER_H
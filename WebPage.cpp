@@ -1,17 +1,36 @@
 // WebPage.cpp
 
 #include "WebPage.h"
+#include "PrivacyManager.h"
+#include <QJsonArray>
+#include <QJsonDocument>
 #include <QWebEngineSettings>
 #include <QWebEngineScript>
 #include <QWebEngineScriptCollection>
 #include <QAuthenticator>
+#include <QWebEngineCertificateError>
 #include <QMessageBox>
+#include <QTimer>
+
+namespace {
+
+// Whether |url| is where the interceptor sends |httpUrl|. Stripping
+// tracking parameters may have changed the query on the way.
+bool isHttpsUpgradeOf(const QUrl &url, const QUrl &httpUrl)
+{
+    return url.scheme() == QLatin1String("https") && url.host() == httpUrl.host() && url.path() == httpUrl.path();
+}
+
+} // namespace
 
 WebPage::WebPage(QWebEngineProfile *profile, QObject *parent)
     : QWebEnginePage(profile, parent)
     , m_contentBlockingEnabled(false)
     , m_customCSSEnabled(false)
     , m_customJSEnabled(false)
+    , m_privacyManager(nullptr)
+    , m_fingerprintShieldInstalled(false)
+    , m_httpsUpgradeRedirected(false)
 {
     connect(this, &QWebEnginePage::authenticationRequired,
             this, &WebPage::handleAuthenticationRequired);
@@ -21,10 +40,17 @@ WebPage::WebPage(QWebEngineProfile *profile, QObject *parent)
             this, &WebPage::handleFeaturePermissionRequested);
     connect(this, &QWebEnginePage::renderProcessTerminated,
             this, &WebPage::handleRenderProcessTerminated);
+    connect(this, &QWebEnginePage::loadFinished,
+            this, &WebPage::handleLoadFinished);
 }
 
 bool WebPage::certificateError(const QWebEngineCertificateError &error)
 {
+    // An upgraded load may fall back to http rather than ask
+    if (m_httpsUpgradeRedirected && isHttpsUpgradeOf(error.url(), m_httpsUpgradeUrl)) {
+        return false;
+    }
+
     QMessageBox::StandardButton btn = QMessageBox::warning(
         nullptr,
         tr("Security Error"),
@@ -73,7 +99,9 @@ bool WebPage::isContentBlockingEnabled() const
 void WebPage::setCustomHeaders(const QMap<QString, QString> &headers)
 {
     m_customHeaders = headers;
-    // In a real implementation, this would modify the network request to include these headers
+    if (m_privacyManager) {
+        m_privacyManager->setPageRequestHeaders(this, headers);
+    }
 }
 
 QMap<QString, QString> WebPage::customHeaders() const
@@ -123,6 +151,17 @@ QString WebPage::customJS() const
     return m_customJS;
 }
 
+void WebPage::setPrivacyManager(PrivacyManager *privacyManager)
+{
+    if (m_privacyManager && m_privacyManager != privacyManager) {
+        m_privacyManager->setPageRequestHeaders(this, QMap<QString, QString>());
+    }
+    m_privacyManager = privacyManager;
+    if (m_privacyManager && !m_customHeaders.isEmpty()) {
+        m_privacyManager->setPageRequestHeaders(this, m_customHeaders);
+    }
+}
+
 bool WebPage::acceptNavigationRequest(const QUrl &url, NavigationType type, bool isMainFrame)
 {
     if (m_contentBlockingEnabled) {
@@ -130,7 +169,39 @@ bool WebPage::acceptNavigationRequest(const QUrl &url, NavigationType type, bool
         // Return false if the URL should be blocked
     }
 
-    // Implement any custom navigation logic here
+    // Listed pages are refused before anything is fetched from them
+    const QString scheme = url.scheme();
+    if (m_privacyManager && (scheme == QLatin1String("http") || scheme == QLatin1String("https"))) {
+        const QString expression = m_privacyManager->safeBrowsingMatch(url);
+        if (!expression.isEmpty()) {
+            if (isMainFrame) {
+                // Not from inside the navigation callback
+                QTimer::singleShot(0, this, [this, url, expression]() { showSafeBrowsingWarning(url, expression); });
+            }
+            return false;
+        }
+    }
+
+    // Swap in the new site's hiding rules and scriptlets before its
+    // document is created
+    if (isMainFrame) {
+        injectCosmeticFilters(url);
+        injectScriptlets(url);
+        injectFingerprintShield(url);
+
+        // The interceptor's upgrade arrives here as a redirect to the same
+        // address over https; anything else starts a new load
+        if (m_privacyManager && m_privacyManager->upgradesToHttps(url)) {
+            m_httpsUpgradeUrl = url;
+            m_httpsUpgradeRedirected = false;
+        } else if (type == NavigationTypeRedirect && m_httpsUpgradeUrl.isValid()
+                   && isHttpsUpgradeOf(url, m_httpsUpgradeUrl)) {
+            m_httpsUpgradeRedirected = true;
+        } else {
+            m_httpsUpgradeUrl.clear();
+            m_httpsUpgradeRedirected = false;
+        }
+    }
 
     return QWebEnginePage::acceptNavigationRequest(url, type, isMainFrame);
 }
@@ -148,6 +219,7 @@ QWebEnginePage *WebPage::createWindow(WebWindowType type)
     newPage->enableCustomCSS(m_customCSSEnabled);
     newPage->setCustomJS(m_customJS);
     newPage->enableCustomJS(m_customJSEnabled);
+    newPage->setPrivacyManager(m_privacyManager);
 
     return newPage;
 }
@@ -196,6 +268,43 @@ void WebPage::handleRenderProcessTerminated(RenderProcessTerminationStatus termi
     // In a real implementation, you might want to show an error page or reload the page
 }
 
+void WebPage::triggerAction(WebAction action, bool checked)
+{
+    // A stopped upgrade did not fail; it must not fall back to http
+    if (action == Stop) {
+        m_httpsUpgradeUrl.clear();
+        m_httpsUpgradeRedirected = false;
+    }
+    QWebEnginePage::triggerAction(action, checked);
+}
+
+void WebPage::handleLoadFinished(bool ok)
+{
+    // Only the load of the upgraded address settles the fallback; an older
+    // load that finishes late leaves a newer navigation alone
+    if (!m_httpsUpgradeRedirected || !isHttpsUpgradeOf(url(), m_httpsUpgradeUrl)) {
+        return;
+    }
+    const QUrl httpUrl = m_httpsUpgradeUrl;
+    m_httpsUpgradeUrl.clear();
+    m_httpsUpgradeRedirected = false;
+    if (!ok && m_privacyManager && m_privacyManager->handleHttpsUpgradeFailure(httpUrl)) {
+        setUrl(httpUrl);
+    }
+}
+
+void WebPage::showSafeBrowsingWarning(const QUrl &url, const QString &expression)
+{
+    // There is no way through; the user can still copy the address
+    setHtml(QString("<!DOCTYPE html><html><head><meta charset=\"utf-8\"><title>%1</title></head>"
+                    "<body style=\"font-family: sans-serif; max-width: 40em; margin: 4em auto;\">"
+                    "<h1>%1</h1><p>%2</p><p><code>%3</code></p><p>%4</p></body></html>")
+                .arg(tr("Deceptive or harmful site blocked").toHtmlEscaped(),
+                     tr("This address is on the local Safe Browsing list. Visiting it may harm your device or steal your information.").toHtmlEscaped(),
+                     url.toDisplayString().toHtmlEscaped(),
+                     tr("Listed as %1").arg(expression).toHtmlEscaped()));
+}
+
 void WebPage::injectCustomCSS()
 {
     QWebEngineScript script;
@@ -213,6 +322,97 @@ void WebPage::injectCustomCSS()
     scripts().insert(script);
 }
 
+void WebPage::injectCosmeticFilters(const QUrl &url)
+{
+    // Recompiled lists change the sheet without a change of host
+    const QString css = m_privacyManager ? m_privacyManager->cosmeticStyleSheet(url) : QString();
+    if (css == m_cosmeticStyleSheet) {
+        return;
+    }
+    m_cosmeticStyleSheet = css;
+
+    QWebEngineScript existing = scripts().findScript("CosmeticFilters");
+    if (!existing.isNull()) {
+        scripts().remove(existing);
+    }
+    if (css.isEmpty()) {
+        return;
+    }
+
+    // Quote the sheet as a JSON string so selectors cannot break out of it
+    const QByteArray quoted = QJsonDocument(QJsonArray{ css }).toJson(QJsonDocument::Compact);
+
+    QWebEngineScript script;
+    script.setName("CosmeticFilters");
+    script.setSourceCode(QString("(function() {"
+                                 "    var style = document.createElement('style');"
+                                 "    style.textContent = %1;"
+                                 "    (document.head || document.documentElement).appendChild(style);"
+                                 "})();").arg(QString::fromUtf8(quoted.mid(1, quoted.size() - 2))));
+    script.setInjectionPoint(QWebEngineScript::DocumentCreation);
+    script.setWorldId(QWebEngineScript::ApplicationWorld);
+    script.setRunsOnSubFrames(true);
+
+    scripts().insert(script);
+}
+
+void WebPage::injectScriptlets(const QUrl &url)
+{
+    const QString bundle = m_privacyManager ? m_privacyManager->scriptletBundle(url) : QString();
+    if (bundle == m_scriptletBundle) {
+        return;
+    }
+    m_scriptletBundle = bundle;
+
+    QWebEngineScript existing = scripts().findScript("Scriptlets");
+    if (!existing.isNull()) {
+        scripts().remove(existing);
+    }
+    if (bundle.isEmpty()) {
+        return;
+    }
+
+    // Scriptlets patch the page's own globals, so they share its world;
+    // the bundle checks the frame's host itself
+    QWebEngineScript script;
+    script.setName("Scriptlets");
+    script.setSourceCode(bundle);
+    script.setInjectionPoint(QWebEngineScript::DocumentCreation);
+    script.setWorldId(QWebEngineScript::MainWorld);
+    script.setRunsOnSubFrames(true);
+
+    scripts().insert(script);
+}
+
+void WebPage::injectFingerprintShield(const QUrl &url)
+{
+    // The source is the same on every site; exempt sites go without it
+    const QString shield = m_privacyManager ? m_privacyManager->fingerprintShield(url) : QString();
+    if (shield.isEmpty() != m_fingerprintShieldInstalled) {
+        return;
+    }
+    m_fingerprintShieldInstalled = !shield.isEmpty();
+
+    QWebEngineScript existing = scripts().findScript("FingerprintShield");
+    if (!existing.isNull()) {
+        scripts().remove(existing);
+    }
+    if (shield.isEmpty()) {
+        return;
+    }
+
+    // Runs in every frame before the page's own scripts can keep the
+    // originals
+    QWebEngineScript script;
+    script.setName("FingerprintShield");
+    script.setSourceCode(shield);
+    script.setInjectionPoint(QWebEngineScript::DocumentCreation);
+    script.setWorldId(QWebEngineScript::MainWorld);
+    script.setRunsOnSubFrames(true);
+
+    scripts().insert(script);
+}
+
 void WebPage::injectCustomJS()
 {
     QWebEngineScript script;
@@ -7,6 +7,9 @@
 #include <QWebEngineProfile>
 #include <QWebEngineSettings>
 #include <QMap>
+#include <QUrl>
+
+class PrivacyManager;
 
 class WebPage : public QWebEnginePage
 {
@@ -24,6 +27,7 @@ public:
     void enableContentBlocking(bool enable);
     bool isContentBlockingEnabled() const;
 
+    // Sent with the profile's requests once a PrivacyManager is set
     void setCustomHeaders(const QMap<QString, QString> &headers);
     QMap<QString, QString> customHeaders() const;
 
@@ -35,6 +39,12 @@ public:
     void setCustomJS(const QString &js);
     QString customJS() const;
 
+    // Source of the element hiding rules injected into each new document
+    void setPrivacyManager(PrivacyManager *privacyManager);
+
+    // Stopping a load also drops its pending fallback to http
+    void triggerAction(WebAction action, bool checked = false) override;
+
 protected:
     bool acceptNavigationRequest(const QUrl &url, NavigationType type, bool isMainFrame) override;
     QWebEnginePage *createWindow(WebWindowType type) override;
@@ -44,6 +54,7 @@ private slots:
     void handleProxyAuthenticationRequired(const QUrl &requestUrl, QAuthenticator *authenticator, const QString &proxyHost);
     void handleFeaturePermissionRequested(const QUrl &securityOrigin, Feature feature);
     void handleRenderProcessTerminated(RenderProcessTerminationStatus terminationStatus, int exitCode);
+    void handleLoadFinished(bool ok);
 
 private:
     QString m_customUserAgent;
@@ -53,9 +64,22 @@ private:
     QString m_customJS;
     bool m_customCSSEnabled;
     bool m_customJSEnabled;
+    PrivacyManager *m_privacyManager;
+    // Sources of the installed scripts; empty when there is none
+    QString m_cosmeticStyleSheet;
+    QString m_scriptletBundle;
+    bool m_fingerprintShieldInstalled;
+    // The http address of a main frame load HTTPS-only mode upgrades, and
+    // whether the load has been redirected to https yet
+    QUrl m_httpsUpgradeUrl;
+    bool m_httpsUpgradeRedirected;
 
     void injectCustomCSS();
     void injectCustomJS();
+    void injectCosmeticFilters(const QUrl &url);
+    void injectScriptlets(const QUrl &url);
+    void injectFingerprintShield(const QUrl &url);
+    void showSafeBrowsingWarning(const QUrl &url, const QString &expression);
 };
 
 #endif // WEBPAGE_H
\ No newline at end of file
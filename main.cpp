@@ -39,6 +39,7 @@ void setupTranslations(QApplication& app);
 void setupNetworkSettings();
 void setupWebEngineSettings();
 void setupCustomUrlSchemes();
+void setupRemoteDebugging();
 void loadFonts();
 void setupStyleAndTheme(QApplication& app);
 void checkSingleInstance();
@@ -67,6 +68,9 @@ int main(int argc, char *argv[])
     QCoreApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
     QCoreApplication::setAttribute(Qt::AA_UseHighDpiPixmaps);
 
+    // Must be set before QtWebEngine starts
+    setupRemoteDebugging();
+
     // Create application instance
     QApplication app(argc, argv);
 
@@ -294,15 +298,31 @@ void setupWebEngineSettings()
 
 void setupCustomUrlSchemes()
 {
-    // Register custom URL scheme for the browser
+    // Register custom URL scheme for the browser. Web pages load ad-block
+    // surrogates from it, so it must not be a local scheme, and the page's
+    // content security policy must not reject them.
     QWebEngineUrlScheme customScheme("browser");
-    customScheme.setFlags(QWebEngineUrlScheme::SecureScheme | 
-                          QWebEngineUrlScheme::LocalScheme |
-                          QWebEngineUrlScheme::LocalAccessAllowed);
+    customScheme.setFlags(QWebEngineUrlScheme::SecureScheme |
+                          QWebEngineUrlScheme::CorsEnabled |
+                          QWebEngineUrlScheme::ContentSecurityPolicyIgnored);
     customScheme.setSyntax(QWebEngineUrlScheme::Syntax::Path);
     QWebEngineUrlScheme::registerScheme(customScheme);
 }
 
+void setupRemoteDebugging()
+{
+    // PrivacyManager clears site storage through the DevTools protocol,
+    // which QtWebEngine only serves with remote debugging on. The port has
+    // no authentication, so any local process could drive the browser
+    // through it: it is opt-in, on loopback only. Without it site storage
+    // is reported as not cleared. An explicit setting is left alone.
+    QSettings settings(ORGANIZATION_NAME, APP_NAME);
+    if (settings.value("privacy/clear_site_storage", false).toBool()
+        && qEnvironmentVariableIsEmpty("QTWEBENGINE_REMOTE_DEBUGGING")) {
+        qputenv("QTWEBENGINE_REMOTE_DEBUGGING", "127.0.0.1:9223");
+    }
+}
+
 void loadFonts()
 {
     QDir fontDir(":/fonts");
@@ -474,28 +494,6 @@ void loadUserScripts()
     }
 }
 
-void setupSecurityPolicies()
-{
-    // Set up Content Security Policy
-    QString csp = "default-src 'self'; script-src 'self' 'unsafe-inline' 'unsafe-eval'; style-src 'self' 'unsafe-inline'; img-src 'self' data: https:; connect-src 'self' https:; font-src 'self'; object-src 'none'; media-src 'self' https:; frame-src 'self' https:;";
-    QWebEngineProfile::defaultProfile()->setHttpHeader("Content-Security-Policy", csp);
-
-    // Enable HSTS (HTTP Strict Transport Security)
-    QWebEngineProfile::defaultProfile()->setHttpHeader("Strict-Transport-Security", "max-age=31536000; includeSubDomains");
-
-    // Set X-Frame-Options to prevent clickjacking
-    QWebEngineProfile::defaultProfile()->setHttpHeader("X-Frame-Options", "SAMEORIGIN");
-
-    // Set X-XSS-Protection
-    QWebEngineProfile::defaultProfile()->setHttpHeader("X-XSS-Protection", "1; mode=block");
-
-    // Set X-Content-Type-Options
-    QWebEngineProfile::defaultProfile()->setHttpHeader("X-Content-Type-Options", "nosniff");
-
-    // Set Referrer-Policy
-    QWebEngineProfile::defaultProfile()->setHttpHeader("Referrer-Policy", "strict-origin-when-cross-origin");
-}
-
 void setupDataSynchronization()
 {
     // Set up data synchronization
@@ -564,12 +562,9 @@ void setupContentFilters()
     QString filtersPath = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/filters";
     QDir().mkpath(filtersPath);
 
-    QFile adBlockList(filtersPath + "/adblock.txt");
-    if (adBlockList.open(QIODevice::ReadOnly)) {
-        QStringList rules = QString(adBlockList.readAll()).split('\n');
-        // In a real implementation, you would parse these rules and apply them to web requests
-        qInfo() << "Loaded" << rules.count() << "ad blocking rules";
-    }
+    // filters/adblock.txt is compiled by PrivacyManager, which reuses the
+    // cached snapshot instead of reparsing the list while it is unchanged
+    qInfo() << "User filter list:" << filtersPath + "/adblock.txt";
 
     qInfo() << "Content filters initialized";
 }
@@ -647,6 +642,9 @@ int main(int argc, char *argv[])
     QCoreApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
     QCoreApplication::setAttribute(Qt::AA_UseHighDpiPixmaps);
 
+    // Must be set before QtWebEngine starts
+    setupRemoteDebugging();
+
     // Create application instance
     QApplication app(argc, argv);
 
@@ -744,7 +742,6 @@ int main(int argc, char *argv[])
         checkForUpdates();
 
         // Additional setup functions
-        setupSecurityPolicies();
         setupDataSynchronization();
         setupAccessibility();
         setupPerformanceMonitoring();